@@ -47,6 +47,21 @@
             this.timer1 = new System.Windows.Forms.Timer(this.components);
             this.groupBox2 = new System.Windows.Forms.GroupBox();
             this.restart_button = new System.Windows.Forms.Button();
+            this.WindowComboBox = new System.Windows.Forms.ComboBox();
+            this.label6 = new System.Windows.Forms.Label();
+            this.FormatComboBox = new System.Windows.Forms.ComboBox();
+            this.label7 = new System.Windows.Forms.Label();
+            this.TestComboBox = new System.Windows.Forms.ComboBox();
+            this.label8 = new System.Windows.Forms.Label();
+            this.StatsCheckBox = new System.Windows.Forms.CheckBox();
+            this.CodecCheckBox = new System.Windows.Forms.CheckBox();
+            this.BlockCheckBox = new System.Windows.Forms.CheckBox();
+            this.label9 = new System.Windows.Forms.Label();
+            this.JpegComboBox = new System.Windows.Forms.ComboBox();
+            this.ProgCheckBox = new System.Windows.Forms.CheckBox();
+            this.label10 = new System.Windows.Forms.Label();
+            this.FoveaComboBox = new System.Windows.Forms.ComboBox();
+            this.LatestCheckBox = new System.Windows.Forms.CheckBox();
             this.button5 = new System.Windows.Forms.Button();
             this.button4 = new System.Windows.Forms.Button();
             this.button3 = new System.Windows.Forms.Button();
@@ -123,6 +138,7 @@
             this.pictureBox1.SizeMode = System.Windows.Forms.PictureBoxSizeMode.Zoom;
             this.pictureBox1.TabIndex = 6;
             this.pictureBox1.TabStop = false;
+            this.pictureBox1.MouseClick += new System.Windows.Forms.MouseEventHandler(this.pictureBox1_MouseClick);
             // 
             // PictureDataBox
             // 
@@ -131,7 +147,7 @@
             this.PictureDataBox.Name = "PictureDataBox";
             this.PictureDataBox.ReadOnly = true;
             this.PictureDataBox.ScrollBars = System.Windows.Forms.ScrollBars.Vertical;
-            this.PictureDataBox.Size = new System.Drawing.Size(308, 151);
+            this.PictureDataBox.Size = new System.Drawing.Size(308, 228);
             this.PictureDataBox.TabIndex = 7;
             // 
             // label4
@@ -216,6 +232,21 @@
             // 
             // groupBox2
             // 
+            this.groupBox2.Controls.Add(this.LatestCheckBox);
+            this.groupBox2.Controls.Add(this.FoveaComboBox);
+            this.groupBox2.Controls.Add(this.label10);
+            this.groupBox2.Controls.Add(this.ProgCheckBox);
+            this.groupBox2.Controls.Add(this.JpegComboBox);
+            this.groupBox2.Controls.Add(this.label9);
+            this.groupBox2.Controls.Add(this.BlockCheckBox);
+            this.groupBox2.Controls.Add(this.CodecCheckBox);
+            this.groupBox2.Controls.Add(this.StatsCheckBox);
+            this.groupBox2.Controls.Add(this.label8);
+            this.groupBox2.Controls.Add(this.TestComboBox);
+            this.groupBox2.Controls.Add(this.label7);
+            this.groupBox2.Controls.Add(this.FormatComboBox);
+            this.groupBox2.Controls.Add(this.label6);
+            this.groupBox2.Controls.Add(this.WindowComboBox);
             this.groupBox2.Controls.Add(this.restart_button);
             this.groupBox2.Controls.Add(this.button5);
             this.groupBox2.Controls.Add(this.button4);
@@ -224,7 +255,7 @@
             this.groupBox2.Controls.Add(this.button1);
             this.groupBox2.Location = new System.Drawing.Point(12, 289);
             this.groupBox2.Name = "groupBox2";
-            this.groupBox2.Size = new System.Drawing.Size(253, 177);
+            this.groupBox2.Size = new System.Drawing.Size(253, 331);
             this.groupBox2.TabIndex = 19;
             this.groupBox2.TabStop = false;
             this.groupBox2.Text = "机器人控制区";
@@ -239,6 +270,182 @@
             this.restart_button.UseVisualStyleBackColor = true;
             this.restart_button.Click += new System.EventHandler(this.restart_button_Click);
             // 
+            // label6
+            // 
+            this.label6.AutoSize = true;
+            this.label6.Location = new System.Drawing.Point(14, 143);
+            this.label6.Name = "label6";
+            this.label6.Size = new System.Drawing.Size(53, 12);
+            this.label6.TabIndex = 25;
+            this.label6.Text = "图像窗口";
+            // 
+            // WindowComboBox
+            // 
+            this.WindowComboBox.DropDownStyle = System.Windows.Forms.ComboBoxStyle.DropDownList;
+            this.WindowComboBox.FormattingEnabled = true;
+            this.WindowComboBox.Items.AddRange(new object[] {
+            "320x240",
+            "240x180 居中",
+            "160x120 居中",
+            "80x60 居中",
+            "640x304 VGA 灰度",
+            "320x240 VGA 居中"});
+            this.WindowComboBox.Location = new System.Drawing.Point(93, 140);
+            this.WindowComboBox.Name = "WindowComboBox";
+            this.WindowComboBox.Size = new System.Drawing.Size(138, 20);
+            this.WindowComboBox.TabIndex = 26;
+            this.WindowComboBox.SelectedIndexChanged += new System.EventHandler(this.WindowComboBox_SelectedIndexChanged);
+            // 
+            // label7
+            // 
+            this.label7.AutoSize = true;
+            this.label7.Location = new System.Drawing.Point(14, 170);
+            this.label7.Name = "label7";
+            this.label7.Size = new System.Drawing.Size(53, 12);
+            this.label7.TabIndex = 27;
+            this.label7.Text = "图像格式";
+            // 
+            // FormatComboBox
+            // 
+            this.FormatComboBox.DropDownStyle = System.Windows.Forms.ComboBoxStyle.DropDownList;
+            this.FormatComboBox.FormattingEnabled = true;
+            this.FormatComboBox.Items.AddRange(new object[] {
+            "RGB565",
+            "YUV422",
+            "灰度",
+            "RGB332 抖动"});
+            this.FormatComboBox.Location = new System.Drawing.Point(93, 167);
+            this.FormatComboBox.Name = "FormatComboBox";
+            this.FormatComboBox.Size = new System.Drawing.Size(138, 20);
+            this.FormatComboBox.TabIndex = 28;
+            this.FormatComboBox.SelectedIndexChanged += new System.EventHandler(this.FormatComboBox_SelectedIndexChanged);
+            // 
+            // label8
+            // 
+            this.label8.AutoSize = true;
+            this.label8.Location = new System.Drawing.Point(14, 197);
+            this.label8.Name = "label8";
+            this.label8.Size = new System.Drawing.Size(53, 12);
+            this.label8.TabIndex = 29;
+            this.label8.Text = "测试图案";
+            // 
+            // TestComboBox
+            // 
+            this.TestComboBox.DropDownStyle = System.Windows.Forms.ComboBoxStyle.DropDownList;
+            this.TestComboBox.FormattingEnabled = true;
+            this.TestComboBox.Items.AddRange(new object[] {
+            "关",
+            "传感器彩条",
+            "合成彩条（校验）"});
+            this.TestComboBox.Location = new System.Drawing.Point(93, 194);
+            this.TestComboBox.Name = "TestComboBox";
+            this.TestComboBox.Size = new System.Drawing.Size(138, 20);
+            this.TestComboBox.TabIndex = 30;
+            this.TestComboBox.SelectedIndexChanged += new System.EventHandler(this.TestComboBox_SelectedIndexChanged);
+            // 
+            // StatsCheckBox
+            // 
+            this.StatsCheckBox.AutoSize = true;
+            this.StatsCheckBox.Location = new System.Drawing.Point(93, 223);
+            this.StatsCheckBox.Name = "StatsCheckBox";
+            this.StatsCheckBox.Size = new System.Drawing.Size(96, 16);
+            this.StatsCheckBox.TabIndex = 31;
+            this.StatsCheckBox.Text = "每帧统计信息";
+            this.StatsCheckBox.UseVisualStyleBackColor = true;
+            this.StatsCheckBox.CheckedChanged += new System.EventHandler(this.StatsCheckBox_CheckedChanged);
+            // 
+            // CodecCheckBox
+            // 
+            this.CodecCheckBox.AutoSize = true;
+            this.CodecCheckBox.Location = new System.Drawing.Point(16, 223);
+            this.CodecCheckBox.Name = "CodecCheckBox";
+            this.CodecCheckBox.Size = new System.Drawing.Size(48, 16);
+            this.CodecCheckBox.TabIndex = 32;
+            this.CodecCheckBox.Text = "压缩";
+            this.CodecCheckBox.UseVisualStyleBackColor = true;
+            this.CodecCheckBox.CheckedChanged += new System.EventHandler(this.CodecCheckBox_CheckedChanged);
+            // 
+            // BlockCheckBox
+            // 
+            this.BlockCheckBox.AutoSize = true;
+            this.BlockCheckBox.Location = new System.Drawing.Point(166, 223);
+            this.BlockCheckBox.Name = "BlockCheckBox";
+            this.BlockCheckBox.Size = new System.Drawing.Size(60, 16);
+            this.BlockCheckBox.TabIndex = 33;
+            this.BlockCheckBox.Text = "块刷新";
+            this.BlockCheckBox.UseVisualStyleBackColor = true;
+            this.BlockCheckBox.CheckedChanged += new System.EventHandler(this.BlockCheckBox_CheckedChanged);
+            // 
+            // label9
+            // 
+            this.label9.AutoSize = true;
+            this.label9.Location = new System.Drawing.Point(14, 251);
+            this.label9.Name = "label9";
+            this.label9.Size = new System.Drawing.Size(53, 12);
+            this.label9.TabIndex = 34;
+            this.label9.Text = "JPEG质量";
+            // 
+            // JpegComboBox
+            // 
+            this.JpegComboBox.DropDownStyle = System.Windows.Forms.ComboBoxStyle.DropDownList;
+            this.JpegComboBox.FormattingEnabled = true;
+            this.JpegComboBox.Items.AddRange(new object[] {
+            "关",
+            "30",
+            "50",
+            "75",
+            "90"});
+            this.JpegComboBox.Location = new System.Drawing.Point(93, 248);
+            this.JpegComboBox.Name = "JpegComboBox";
+            this.JpegComboBox.Size = new System.Drawing.Size(138, 20);
+            this.JpegComboBox.TabIndex = 35;
+            this.JpegComboBox.SelectedIndexChanged += new System.EventHandler(this.JpegComboBox_SelectedIndexChanged);
+            // 
+            // ProgCheckBox
+            // 
+            this.ProgCheckBox.AutoSize = true;
+            this.ProgCheckBox.Location = new System.Drawing.Point(16, 277);
+            this.ProgCheckBox.Name = "ProgCheckBox";
+            this.ProgCheckBox.Size = new System.Drawing.Size(72, 16);
+            this.ProgCheckBox.TabIndex = 36;
+            this.ProgCheckBox.Text = "渐进传输";
+            this.ProgCheckBox.UseVisualStyleBackColor = true;
+            this.ProgCheckBox.CheckedChanged += new System.EventHandler(this.ProgCheckBox_CheckedChanged);
+            // 
+            // label10
+            // 
+            this.label10.AutoSize = true;
+            this.label10.Location = new System.Drawing.Point(93, 278);
+            this.label10.Name = "label10";
+            this.label10.Size = new System.Drawing.Size(53, 12);
+            this.label10.TabIndex = 37;
+            this.label10.Text = "ROI外缩小";
+            // 
+            // FoveaComboBox
+            // 
+            this.FoveaComboBox.DropDownStyle = System.Windows.Forms.ComboBoxStyle.DropDownList;
+            this.FoveaComboBox.FormattingEnabled = true;
+            this.FoveaComboBox.Items.AddRange(new object[] {
+            "关",
+            "2倍",
+            "4倍"});
+            this.FoveaComboBox.Location = new System.Drawing.Point(166, 274);
+            this.FoveaComboBox.Name = "FoveaComboBox";
+            this.FoveaComboBox.Size = new System.Drawing.Size(65, 20);
+            this.FoveaComboBox.TabIndex = 38;
+            this.FoveaComboBox.SelectedIndexChanged += new System.EventHandler(this.FoveaComboBox_SelectedIndexChanged);
+            // 
+            // LatestCheckBox
+            // 
+            this.LatestCheckBox.AutoSize = true;
+            this.LatestCheckBox.Location = new System.Drawing.Point(16, 302);
+            this.LatestCheckBox.Name = "LatestCheckBox";
+            this.LatestCheckBox.Size = new System.Drawing.Size(84, 16);
+            this.LatestCheckBox.TabIndex = 39;
+            this.LatestCheckBox.Text = "最新帧优先";
+            this.LatestCheckBox.UseVisualStyleBackColor = true;
+            this.LatestCheckBox.CheckedChanged += new System.EventHandler(this.LatestCheckBox_CheckedChanged);
+            // 
             // button5
             // 
             this.button5.Location = new System.Drawing.Point(16, 54);
@@ -294,7 +501,7 @@
             this.groupBox3.Controls.Add(this.PictureDataBox);
             this.groupBox3.Location = new System.Drawing.Point(271, 289);
             this.groupBox3.Name = "groupBox3";
-            this.groupBox3.Size = new System.Drawing.Size(320, 177);
+            this.groupBox3.Size = new System.Drawing.Size(320, 331);
             this.groupBox3.TabIndex = 20;
             this.groupBox3.TabStop = false;
             this.groupBox3.Text = "控制数据回显区";
@@ -303,7 +510,7 @@
             // 
             this.AutoScaleDimensions = new System.Drawing.SizeF(6F, 12F);
             this.AutoScaleMode = System.Windows.Forms.AutoScaleMode.Font;
-            this.ClientSize = new System.Drawing.Size(603, 477);
+            this.ClientSize = new System.Drawing.Size(603, 631);
             this.Controls.Add(this.groupBox3);
             this.Controls.Add(this.groupBox2);
             this.Controls.Add(this.groupBox1);
@@ -316,6 +523,7 @@
             this.groupBox1.ResumeLayout(false);
             this.groupBox1.PerformLayout();
             this.groupBox2.ResumeLayout(false);
+            this.groupBox2.PerformLayout();
             this.groupBox3.ResumeLayout(false);
             this.groupBox3.PerformLayout();
             this.ResumeLayout(false);
@@ -348,6 +556,21 @@
         private System.Windows.Forms.GroupBox groupBox3;
         private System.Windows.Forms.Button button5;
         private System.Windows.Forms.Button restart_button;
+        private System.Windows.Forms.ComboBox WindowComboBox;
+        private System.Windows.Forms.Label label6;
+        private System.Windows.Forms.ComboBox FormatComboBox;
+        private System.Windows.Forms.Label label7;
+        private System.Windows.Forms.ComboBox TestComboBox;
+        private System.Windows.Forms.Label label8;
+        private System.Windows.Forms.CheckBox StatsCheckBox;
+        private System.Windows.Forms.CheckBox CodecCheckBox;
+        private System.Windows.Forms.CheckBox BlockCheckBox;
+        private System.Windows.Forms.Label label9;
+        private System.Windows.Forms.ComboBox JpegComboBox;
+        private System.Windows.Forms.CheckBox ProgCheckBox;
+        private System.Windows.Forms.Label label10;
+        private System.Windows.Forms.ComboBox FoveaComboBox;
+        private System.Windows.Forms.CheckBox LatestCheckBox;
     }
 }
 
@@ -34,7 +34,110 @@ namespace UDP_Parctice
         public const byte left = 0x0C;
         public const byte rightt = 0x0D;
         public const byte standd = 0x0E;
+        public const byte set_window = 0x05;
+        public const byte set_format = 0x06;
+        public const byte set_test = 0x09;
+        public const byte set_stats = 0x0A;
+        public const byte set_codec = 0x0B;
+        public const byte set_block = 0x0C;
+        public const byte set_jpeg = 0x0D;
+        public const byte set_prog = 0x0E;
+        public const byte set_fovea = 0x0F;
+        public const byte set_latest = 0x10;
 
+        //图像格式，与下位机OV7725_FORMAT_xxx一致
+        public const byte format_rgb565 = 0;
+        public const byte format_yuv422 = 1;
+        public const byte format_gray = 2;
+        public const byte format_rgb332 = 3;    //下位机读出时4x4有序抖动，每像素1字节，一包4行
+
+        //图像参数包：0x55 0xAA 'W' 格式 宽 高 X起点 Y起点（16位，高字节在前） 测试图案 缩小倍数 帧率 压缩方式 包长（16位）
+        //原始图像包第n包是一帧从n*包长开始的一段，行可以跨包，最后一包较短
+        public const int picture_info_len = 18;
+        public const byte picture_info_codec = 0x01;    //压缩方式：RGB565包无损压缩
+        public const byte picture_info_block = 0x02;    //压缩方式：按块条件刷新，一帧以帧结束包为界
+        public const byte picture_info_jpeg = 0x04;     //压缩方式：基线JPEG，一帧以带结束标志的JPEG包为界
+        public const byte picture_info_prog = 0x08;     //渐进传输：一帧分几遍从粗到细，包格式见PictureProgressive
+        public const byte picture_info_fovea = 0x10;    //区域加权：ROI内全分辨率，ROI外缩小，包格式见PictureFovea
+        public static readonly byte[] fovea_scale = { 0, 2, 4 };   //与FoveaComboBox的选项对应
+        public const int fovea_roi_w = 128, fovea_roi_h = 96;      //点击图像时以点击处为中心的ROI大小
+        //JPEG包：0x55 0xAA 'J' 标志 帧号 包序号（16位，高字节在前） JFIF码流的一段，标志bit0为1表示本帧最后一包
+        public const int picture_jpeg_head_len = 8;
+        public const byte picture_jpeg_last = 0x01;
+        public static readonly byte[] jpeg_quality = { 0, 30, 50, 75, 90 };   //与JpegComboBox的选项对应
+        //统计包：0x55 0xAA 'S' 格式 帧序号 像素数 亮度最小 亮度最大 通道和x3 亮度直方图x16 放弃帧数 跳过包数（32位，高字节在前）
+        public const int picture_stats_len = 98;
+        public const int picture_stats_bins = 16;
+
+        //测试图案，与下位机PICTURE_TEST_xxx一致；合成彩条与PictureTestPack()逐字节一致
+        public const byte test_off = 0;
+        public const byte test_sensor = 1;
+        public const byte test_synth = 2;
+        static readonly ushort[] test_bar_rgb565 = { 0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000 };
+        static readonly byte[] test_bar_rgb332 = { 0xFF, 0xFC, 0x1F, 0x1C, 0xE3, 0xE0, 0x03, 0x00 };
+        static readonly byte[,] test_bar_yuv = {
+            { 255, 128, 128 }, { 226,   0, 149 }, { 179, 170,   0 }, { 150,  44,  21 },
+            { 105, 212, 235 }, {  76,  85, 255 }, {  29, 255, 107 }, {   0, 128, 128 },
+        };
+        //预设窗口：X起点 Y起点 宽 高 VGA（QVGA sx+宽<=320，sy+高<=240；VGA sx+宽<=640，sy+高<=480）
+        //VGA一帧要放得进FIFO（宽*高*2<=393216），640宽只能用灰度
+        public static readonly ushort[,] window_preset = {
+            { 0, 0, 320, 240, 0 },
+            { 40, 30, 240, 180, 0 },
+            { 80, 60, 160, 120, 0 },
+            { 120, 90, 80, 60, 0 },
+            { 0, 88, 640, 304, 1 },
+            { 160, 120, 320, 240, 1 },
+        };
+
+
+        //当前图像窗口，由下位机的图像参数包更新
+        int frame_width = 320;
+        int frame_height = 240;
+        int frame_format = format_rgb565;
+        int packet_len = 1472;          //原始图像包的包长，由图像参数包给出
+        int last_len = 1152;            //一帧最后一包的包长
+        uint packets_per_frame = 105;
+
+        //测试图案校验
+        int picture_test = test_off;
+        byte[] test_expect = null;      //一行的期望内容，按包在帧中的位置取，前8字节包头单独检查
+        uint test_seq = 0;              //正在接收的帧序号
+        bool[] test_seen = null;        //本帧已收到的包
+        uint test_seen_count = 0;
+        long test_ok = 0, test_corrupt = 0, test_missing = 0, test_dup = 0;
+
+        //吞吐统计，每秒在回显区输出一次
+        long stat_bytes = 0;
+        long stat_frames = 0;
+        long stat_raw_bytes = 0;        //解压后的字节数，与stat_bytes之比即压缩比
+        long codec_errors = 0;
+        byte[] codec_buf = new byte[1280];
+        long stat_blocks = 0;           //收到的块数
+
+        //按块刷新：块包和刷新帧的原始包都写进block_frame，收到帧结束包再显示
+        bool block_mode = false;
+        byte[] block_frame = new byte[153600];
+        //JPEG：按包序号拼接一帧的码流，收到最后一包后解码，序号不连续整帧丢弃
+        bool jpeg_mode = false;
+        MemoryStream jpeg_stream = new MemoryStream();
+        int jpeg_frame = -1;            //正在拼接的帧号，-1为等下一帧的第一包
+        int jpeg_index = 0;             //下一包应有的序号
+        long jpeg_errors = 0;
+        Image jpeg_image = null;        //最近解出的一帧，由timer1显示
+        //渐进传输：各遍铺进block_frame（与按块刷新不会同时用），每收完一遍显示一次
+        bool prog_mode = false;
+        int prog_frame = -1;            //正在接收的帧号
+        long prog_start = 0;            //本帧第一包到达的时刻（prog_watch计数）
+        System.Diagnostics.Stopwatch prog_watch = System.Diagnostics.Stopwatch.StartNew();
+        long prog_first_ticks = 0, prog_full_ticks = 0, prog_frames = 0;   //每帧到第0遍收完、到最后一遍收完的时间
+        //区域加权：各条铺进block_frame，收到带结束标志的包再显示
+        bool fovea_mode = false;
+        byte fovea_cur = 0;             //当前选的ROI外倍数，点击图像移动ROI时一起发
+        //最近一帧的统计包，每秒随帧率一起输出
+        string stats_text = null;
+        public uint[] stats_hist = new uint[picture_stats_bins];
+        System.Diagnostics.Stopwatch stat_watch = System.Diagnostics.Stopwatch.StartNew();
 
         //定义接收一帧图像的字节数组
         public byte[] picture_byte1 = new byte[153600];
@@ -170,27 +273,363 @@ namespace UDP_Parctice
             {
                 //用来保存发送方的IP和端口号
                 EndPoint RecPoint = new IPEndPoint(IPAddress.Any, 0);
-                byte[] buffer = new byte[1280];
+                byte[] buffer = new byte[1500];
                 int length = socketUDP.ReceiveFrom(buffer, ref RecPoint);
+                if (length == picture_info_len && buffer[0] == 0x55 && buffer[1] == 0xAA && buffer[2] == 'W')
+                {
+                    SetPictureInfo(buffer);
+                    continue;
+                }
+                if (length == picture_stats_len && buffer[0] == 0x55 && buffer[1] == 0xAA && buffer[2] == 'S')
+                {
+                    SetPictureStats(buffer);
+                    continue;
+                }
+                if (jpeg_mode && length >= picture_jpeg_head_len && buffer[0] == 0x55 && buffer[1] == 0xAA && buffer[2] == 'J')
+                {
+                    JpegPacket(buffer, length);
+                    continue;
+                }
+                if (prog_mode && PictureProgressive.IsPacket(buffer, length))
+                {
+                    ProgPacket(buffer, length);
+                    continue;
+                }
+                if (fovea_mode && PictureFovea.IsPacket(buffer, length))
+                {
+                    FoveaPacket(buffer, length);
+                    continue;
+                }
+                if (block_mode && PictureBlock.IsEndPacket(buffer, length))
+                {
+                    BlockFrameEnd();
+                    continue;
+                }
+                if (block_mode && length != packet_len && PictureBlock.IsBlockPacket(buffer, length))
+                {
+                    int bpp = FormatBpp(frame_format);
+                    int n = PictureBlock.Apply(buffer, length, block_frame, frame_width, frame_height, bpp);
+                    if (n == 0)
+                        codec_errors++;
+                    Interlocked.Add(ref stat_blocks, n);
+                    Interlocked.Add(ref stat_bytes, length);
+                    Interlocked.Add(ref stat_raw_bytes, length);
+                    continue;
+                }
+                int wire_length = length;
+                if (length < packet_len && PictureCodec.IsCodecPacket(buffer, length))
+                {
+                    //压缩包，解压后按原始包处理
+                    length = PictureCodec.Decode(buffer, length, frame_width, codec_buf);
+                    if (length == 0)
+                    {
+                        codec_errors++;
+                        continue;
+                    }
+                    buffer = codec_buf;
+                }
+                if (length != packet_len)
+                {
+                    if (length != last_len)     //窗口切换前的旧包
+                        continue;
+                    line = packets_per_frame - 1;   //最后一包较短，前面丢了包也在这里对齐到帧尾
+                }
+                Interlocked.Add(ref stat_bytes, wire_length);
+                Interlocked.Add(ref stat_raw_bytes, length);
+                if (picture_test == test_synth)
+                    VerifyTestPacket(buffer, length);
+                if (block_mode)
+                {
+                    //刷新帧按顺序整包发来
+                    if (line < packets_per_frame)
+                        Array.Copy(buffer, 0, block_frame, packet_len * line, length);
+                    line++;
+                    continue;
+                }
                 if (picture_flag)
                 {
-                    buffer.CopyTo(picture_byte1, 1280 * line);
+                    Array.Copy(buffer, 0, picture_byte1, packet_len * line, length);
                 }
                 else
                 {
-                    buffer.CopyTo(picture_byte2, 1280 * line);
+                    Array.Copy(buffer, 0, picture_byte2, packet_len * line, length);
                 }
                 line++;
-                if (line == 120)
+                if (line == packets_per_frame)
                 {
                     line = 0;
                     picture_flag = !picture_flag;
                     picture_success_flag = true;
-                    Thread.Sleep(50);  //这里的时间应该大于定时器的间隔时间，要不然会出现视频画面的前面一小部分显示的是下一帧的画面
+                    Interlocked.Increment(ref stat_frames);
+                    if (picture_test != test_synth)    //测速时不等，否则socket缓冲区溢出丢包
+                        Thread.Sleep(50);  //这里的时间应该大于定时器的间隔时间，要不然会出现视频画面的前面一小部分显示的是下一帧的画面
                 }   
             }
         }
 
+        //帧结束包：把补好的一帧复制到显示缓冲
+        private void BlockFrameEnd()
+        {
+            line = 0;
+            if (picture_flag)
+                Array.Copy(block_frame, picture_byte1, Math.Min(block_frame.Length, picture_byte1.Length));
+            else
+                Array.Copy(block_frame, picture_byte2, Math.Min(block_frame.Length, picture_byte2.Length));
+            picture_flag = !picture_flag;
+            picture_success_flag = true;
+            Interlocked.Increment(ref stat_frames);
+            Thread.Sleep(50);
+        }
+
+        //JPEG包：包序号从0开始连续才拼接，最后一包到了解码成一帧
+        private void JpegPacket(byte[] buffer, int length)
+        {
+            int frame = (buffer[4] << 8) | buffer[5];
+            int index = (buffer[6] << 8) | buffer[7];
+            Interlocked.Add(ref stat_bytes, length);
+            if (index == 0)
+            {
+                if (jpeg_frame >= 0)
+                    jpeg_errors++;      //上一帧没收完
+                jpeg_stream.SetLength(0);
+                jpeg_frame = frame;
+                jpeg_index = 0;
+            }
+            if (frame != jpeg_frame || index != jpeg_index)
+            {
+                if (jpeg_frame >= 0)
+                    jpeg_errors++;
+                jpeg_frame = -1;
+                return;
+            }
+            jpeg_stream.Write(buffer, picture_jpeg_head_len, length - picture_jpeg_head_len);
+            jpeg_index++;
+            if ((buffer[3] & picture_jpeg_last) == 0)
+                return;
+            jpeg_frame = -1;
+            try
+            {
+                jpeg_stream.Position = 0;
+                using (Image img = Image.FromStream(jpeg_stream))
+                    jpeg_image = new Bitmap(img);
+            }
+            catch (ArgumentException)
+            {
+                jpeg_errors++;
+                return;
+            }
+            int bpp = FormatBpp(frame_format);
+            Interlocked.Add(ref stat_raw_bytes, frame_width * frame_height * bpp);
+            Interlocked.Increment(ref stat_frames);
+            picture_success_flag = true;
+        }
+
+        //渐进包：铺进block_frame，一遍收完就把当前的图交给timer1显示，不等整帧
+        private void ProgPacket(byte[] buffer, int length)
+        {
+            int bpp = FormatBpp(frame_format);
+            int frame = PictureProgressive.Frame(buffer);
+            long now = prog_watch.ElapsedTicks;
+            Interlocked.Add(ref stat_bytes, length);
+            Interlocked.Add(ref stat_raw_bytes, length);
+            if (frame != prog_frame)
+            {
+                prog_frame = frame;
+                prog_start = now;
+            }
+            if (PictureProgressive.Apply(buffer, length, block_frame, frame_width, frame_height, bpp) == 0)
+            {
+                codec_errors++;
+                return;
+            }
+            if (!PictureProgressive.IsPassEnd(buffer, frame_height))
+                return;
+            if (PictureProgressive.Pass(buffer) == 0)
+                Interlocked.Add(ref prog_first_ticks, now - prog_start);
+            picture_flag = !picture_flag;
+            if (picture_flag)
+                Array.Copy(block_frame, picture_byte1, Math.Min(block_frame.Length, picture_byte1.Length));
+            else
+                Array.Copy(block_frame, picture_byte2, Math.Min(block_frame.Length, picture_byte2.Length));
+            picture_success_flag = true;
+            if (PictureProgressive.Pass(buffer) == PictureProgressive.Passes(buffer) - 1)
+            {
+                Interlocked.Add(ref prog_full_ticks, now - prog_start);
+                Interlocked.Increment(ref prog_frames);
+                Interlocked.Increment(ref stat_frames);
+            }
+        }
+
+        //区域加权包：铺进block_frame，最后一包到了显示；发出比例按整帧原始大小算
+        private void FoveaPacket(byte[] buffer, int length)
+        {
+            int bpp = FormatBpp(frame_format);
+            Interlocked.Add(ref stat_bytes, length);
+            if (PictureFovea.Apply(buffer, length, block_frame, frame_width, frame_height, bpp) == 0)
+            {
+                codec_errors++;
+                return;
+            }
+            if (!PictureFovea.IsLast(buffer))
+                return;
+            Interlocked.Add(ref stat_raw_bytes, frame_width * frame_height * bpp);
+            BlockFrameEnd();
+        }
+
+        //按图像参数包重新确定帧大小，从下一包开始算新的一帧
+        private void SetPictureInfo(byte[] info)
+        {
+            int w = (info[4] << 8) | info[5];
+            int h = (info[6] << 8) | info[7];
+            int sx = (info[8] << 8) | info[9];
+            int sy = (info[10] << 8) | info[11];
+            int bpp = FormatBpp(info[3]);
+            if (w == 0 || h == 0 || info[3] > format_rgb332)
+                return;
+            picture_success_flag = false;
+            if (w != frame_width || h != frame_height || info[3] != frame_format)
+            {
+                picture_byte1 = new byte[w * h * bpp];
+                picture_byte2 = new byte[w * h * bpp];
+                frame_width = w;
+                frame_height = h;
+                frame_format = info[3];
+                block_frame = new byte[w * h * bpp];
+            }
+            int frame_len = w * h * bpp;
+            packet_len = (info[16] << 8) | info[17];
+            if (packet_len == 0 || packet_len > frame_len)
+                packet_len = frame_len;
+            packets_per_frame = (uint)((frame_len + packet_len - 1) / packet_len);
+            last_len = frame_len - (int)(packets_per_frame - 1) * packet_len;
+            line = 0;
+            block_mode = (info[15] & picture_info_block) != 0;
+            jpeg_mode = (info[15] & picture_info_jpeg) != 0;
+            jpeg_frame = -1;
+            prog_mode = (info[15] & picture_info_prog) != 0;
+            prog_frame = -1;
+            fovea_mode = (info[15] & picture_info_fovea) != 0;
+            picture_test = info[12];
+            if (picture_test == test_synth)
+                MakeTestExpect();
+            PictureDataBox.AppendText("window " + sx + "," + sy + " " + w + "x" + h + " format " + info[3]
+                                      + " bin " + info[13] + " test " + info[12] + " fps " + info[14]
+                                      + " codec " + (info[15] & picture_info_codec) + " block " + ((info[15] & picture_info_block) >> 1)
+                                      + " jpeg " + ((info[15] & picture_info_jpeg) >> 2)
+                                      + " prog " + ((info[15] & picture_info_prog) >> 3)
+                                      + " fovea " + ((info[15] & picture_info_fovea) >> 4)
+                                      + " packet " + packet_len + "x" + packets_per_frame + "\r\n");
+        }
+
+        //每像素字节数：灰度、RGB332为1，其余为2
+        static int FormatBpp(int format)
+        {
+            return (format == format_gray || format == format_rgb332) ? 1 : 2;
+        }
+
+        static uint GetU32(byte[] buf, int i)
+        {
+            return (uint)((buf[i] << 24) | (buf[i + 1] << 16) | (buf[i + 2] << 8) | buf[i + 3]);
+        }
+
+        //解析统计包：RGB565输出R G B均值，YUV422输出Y U V均值（U V每2像素一个），灰度输出Y均值
+        private void SetPictureStats(byte[] stats)
+        {
+            uint pixels = GetU32(stats, 8);
+            if (pixels == 0)
+                return;
+            for (int i = 0; i < picture_stats_bins; i++)
+                stats_hist[i] = GetU32(stats, 26 + i * 4);
+            double c0 = GetU32(stats, 14), c1 = GetU32(stats, 18), c2 = GetU32(stats, 22);
+            string s;
+            if (stats[3] == format_rgb565 || stats[3] == format_rgb332)
+                s = "R " + (c0 / pixels).ToString("F0") + " G " + (c1 / pixels).ToString("F0")
+                    + " B " + (c2 / pixels).ToString("F0");
+            else if (stats[3] == format_yuv422)
+                s = "Y " + (c0 / pixels).ToString("F0") + " U " + (c1 * 2 / pixels).ToString("F0")
+                    + " V " + (c2 * 2 / pixels).ToString("F0");
+            else
+                s = "Y " + (c0 / pixels).ToString("F0");
+            stats_text = s + " [" + stats[12] + "-" + stats[13] + "]";
+            uint stale = GetU32(stats, 90);
+            if (stale != 0)
+                stats_text += " stale " + stale + "/" + GetU32(stats, 94);
+        }
+
+        //按当前宽度和格式生成测试图案一行的期望内容，规则同下位机PictureTestPack()
+        private void MakeTestExpect()
+        {
+            int bpp = FormatBpp(frame_format);
+            int line_len = frame_width * bpp;
+            byte[] expect = new byte[line_len];
+            for (int pos = 0; pos < line_len; pos++)
+            {
+                int x = pos / bpp;
+                int bar = x * 8 / frame_width;
+                if (frame_format == format_rgb565)
+                    expect[pos] = (byte)(((pos & 1) != 0) ? (test_bar_rgb565[bar] & 0xff) : (test_bar_rgb565[bar] >> 8));
+                else if (frame_format == format_yuv422)
+                    expect[pos] = ((pos & 1) != 0) ? test_bar_yuv[bar, ((x & 1) != 0) ? 2 : 1] : test_bar_yuv[bar, 0];
+                else if (frame_format == format_rgb332)
+                    expect[pos] = test_bar_rgb332[bar];
+                else
+                    expect[pos] = test_bar_yuv[bar, 0];
+            }
+            test_expect = expect;
+            test_seen = new bool[packets_per_frame];
+            test_seen_count = 0;
+            test_seq = 0;
+        }
+
+        //逐字节校验一包测试图案，统计损坏、缺失、重复的包
+        private void VerifyTestPacket(byte[] buffer, int length)
+        {
+            if (test_expect == null || length < 8)
+                return;
+            uint seq = ((uint)buffer[0] << 24) | ((uint)buffer[1] << 16) | ((uint)buffer[2] << 8) | buffer[3];
+            int index = (buffer[4] << 8) | buffer[5];
+            int check = (buffer[6] << 8) | buffer[7];
+            if ((index ^ check) != 0xFFFF || index >= packets_per_frame
+                || length != ((index == packets_per_frame - 1) ? last_len : packet_len))
+            {
+                test_corrupt++;
+                return;
+            }
+            int line_len = test_expect.Length;
+            int pos = (int)((long)index * packet_len % line_len);
+            for (int i = 0; i < length; i++, pos++)
+            {
+                if (pos == line_len)
+                    pos = 0;
+                if (i >= 8 && buffer[i] != test_expect[pos])
+                {
+                    test_corrupt++;
+                    return;
+                }
+            }
+            if (seq != test_seq)
+            {
+                //上一帧没收到的包，以及中间整帧丢掉的包
+                if (test_seq != 0)
+                {
+                    test_missing += packets_per_frame - test_seen_count;
+                    if (seq > test_seq + 1)
+                        test_missing += (long)(seq - test_seq - 1) * packets_per_frame;
+                }
+                test_seq = seq;
+                Array.Clear(test_seen, 0, test_seen.Length);
+                test_seen_count = 0;
+            }
+            if (test_seen[index])
+            {
+                test_dup++;
+                return;
+            }
+            test_seen[index] = true;
+            test_seen_count++;
+            test_ok++;
+        }
+
         private void RecMsg2()  //暂时未用到
         {
             //这是一个线程，所以用死循环
@@ -240,13 +679,54 @@ namespace UDP_Parctice
 
         private void timer1_Tick(object sender, EventArgs e)
         {
+            long ms = stat_watch.ElapsedMilliseconds;
+            if (ms >= 1000)
+            {
+                //每秒输出帧率和码率，测试图案另外输出校验结果（单位：行，每包2行）
+                long bytes = Interlocked.Exchange(ref stat_bytes, 0);
+                long frames = Interlocked.Exchange(ref stat_frames, 0);
+                long raw_bytes = Interlocked.Exchange(ref stat_raw_bytes, 0);
+                long blocks = Interlocked.Exchange(ref stat_blocks, 0);
+                stat_watch.Restart();
+                if (bytes > 0)
+                {
+                    string s = (frames * 1000.0 / ms).ToString("F1") + " fps  "
+                               + (bytes * 8 / 1000.0 / ms).ToString("F2") + " Mbit/s";
+                    if (picture_test == test_synth)
+                        s += "  ok " + test_ok * 2 + " corrupt " + test_corrupt * 2
+                             + " missing " + test_missing * 2 + " dup " + test_dup * 2;
+                    if (jpeg_mode)
+                        s += "  jpeg " + ((double)raw_bytes / bytes).ToString("F2") + " err " + jpeg_errors;
+                    else if (fovea_mode)
+                        s += "  fovea " + ((double)raw_bytes / bytes).ToString("F2") + " err " + codec_errors;
+                    else if (raw_bytes != bytes)
+                        s += "  codec " + ((double)raw_bytes / bytes).ToString("F2") + " err " + codec_errors;
+                    if (block_mode)
+                        s += "  blocks " + blocks;
+                    long pf = Interlocked.Exchange(ref prog_frames, 0);
+                    long first = Interlocked.Exchange(ref prog_first_ticks, 0);
+                    long full = Interlocked.Exchange(ref prog_full_ticks, 0);
+                    if (prog_mode && pf > 0)
+                    {
+                        //第一幅粗图、整帧各用了多久，从本帧第一包算起
+                        double tick_ms = 1000.0 / System.Diagnostics.Stopwatch.Frequency;
+                        s += "  prog first " + (first * tick_ms / pf).ToString("F1")
+                             + " ms full " + (full * tick_ms / pf).ToString("F1") + " ms";
+                    }
+                    if (stats_text != null)
+                        s += "  " + stats_text;
+                    PictureDataBox.AppendText(s + "\r\n");
+                }
+            }
             if (picture_success_flag)
             {
                 //将字节数组转换为图片
-                if(picture_flag)
-                    pictureBox1.Image = GetDataPicture(pictureBox1.Width, pictureBox1.Height, picture_byte1);
+                if (jpeg_mode)
+                    pictureBox1.Image = jpeg_image;
+                else if(picture_flag)
+                    pictureBox1.Image = GetDataPicture(frame_width, frame_height, frame_format, picture_byte1);
                 else
-                    pictureBox1.Image = GetDataPicture(pictureBox1.Width, pictureBox1.Height, picture_byte2);
+                    pictureBox1.Image = GetDataPicture(frame_width, frame_height, frame_format, picture_byte2);
                // threadUDPWatch.Suspend();
                 picture_success_flag = false;
                 return;
@@ -318,6 +798,72 @@ namespace UDP_Parctice
             //return data;
         }
 
+        private static byte clamp(int v)
+        {
+            return (byte)(v < 0 ? 0 : (v > 255 ? 255 : v));
+        }
+
+        //YUV(BT.601)转RGB
+        private static Color yuv_2_color(int y, int u, int v)
+        {
+            u -= 128;
+            v -= 128;
+            return Color.FromArgb(clamp(y + ((359 * v) >> 8)),
+                                  clamp(y - ((88 * u + 183 * v) >> 8)),
+                                  clamp(y + ((454 * u) >> 8)));
+        }
+
+        public Bitmap GetDataPicture(int w, int h, int format, byte[] data)
+        {
+            if (format == format_gray)
+                return GetGrayPicture(w, h, data);
+            if (format == format_yuv422)
+                return GetYUV422Picture(w, h, data);
+            if (format == format_rgb332)
+                return GetRGB332Picture(w, h, data);
+            return GetDataPicture(w, h, data);
+        }
+
+        //RGB332：每像素1字节，R3 G3 B2，按位重复展开到8位
+        public Bitmap GetRGB332Picture(int w, int h, byte[] data)
+        {
+            Bitmap pic = new Bitmap(w, h, System.Drawing.Imaging.PixelFormat.Format24bppRgb);
+            for (int i = 0; i < data.Length && i < w * h; i++)
+            {
+                int r = data[i] >> 5, g = (data[i] >> 2) & 7, b = data[i] & 3;
+                pic.SetPixel(i % w, i / w, Color.FromArgb((r << 5) | (r << 2) | (r >> 1), (g << 5) | (g << 2) | (g >> 1), b * 85));
+            }
+            return pic;
+        }
+
+        //每像素1字节的灰度数据
+        public Bitmap GetGrayPicture(int w, int h, byte[] data)
+        {
+            Bitmap pic = new Bitmap(w, h, System.Drawing.Imaging.PixelFormat.Format24bppRgb);
+            for (int i = 0; i < data.Length && i < w * h; i++)
+            {
+                pic.SetPixel(i % w, i / w, Color.FromArgb(data[i], data[i], data[i]));
+            }
+            return pic;
+        }
+
+        //YUYV：每2个像素4字节，共用U、V
+        public Bitmap GetYUV422Picture(int w, int h, byte[] data)
+        {
+            Bitmap pic = new Bitmap(w, h, System.Drawing.Imaging.PixelFormat.Format24bppRgb);
+            int j = 0;
+            for (int i = 0; i + 3 < data.Length && j + 1 < w * h; i += 4)
+            {
+                int u = data[i + 1];
+                int v = data[i + 3];
+                pic.SetPixel(j % w, j / w, yuv_2_color(data[i], u, v));
+                j++;
+                pic.SetPixel(j % w, j / w, yuv_2_color(data[i + 2], u, v));
+                j++;
+            }
+            return pic;
+        }
+
         public Bitmap GetDataPicture(int w, int h, byte[] data)
         {
             Bitmap pic = new Bitmap(w, h, System.Drawing.Imaging.PixelFormat.Format24bppRgb);
@@ -393,6 +939,157 @@ namespace UDP_Parctice
             PictureDataBox.AppendText("stand\r\n");
         }
 
+        //发送改变窗口命令：0x05 X起点 Y起点 宽 高（16位，高字节在前） VGA
+        private void WindowComboBox_SelectedIndexChanged(object sender, EventArgs e)
+        {
+            int i = WindowComboBox.SelectedIndex;
+            if (i < 0 || !start_flag)
+                return;
+            byte[] cmd = new byte[10];
+            cmd[0] = set_window;
+            for (int k = 0; k < 4; k++)
+            {
+                cmd[1 + k * 2] = (byte)(window_preset[i, k] >> 8);
+                cmd[2 + k * 2] = (byte)(window_preset[i, k] & 0xff);
+            }
+            cmd[9] = (byte)window_preset[i, 4];
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set window " + WindowComboBox.Text + "\r\n");
+        }
+
+        //发送切换格式命令：0x06 格式
+        private void FormatComboBox_SelectedIndexChanged(object sender, EventArgs e)
+        {
+            int i = FormatComboBox.SelectedIndex;
+            if (i < 0 || !start_flag)
+                return;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_format;
+            cmd[1] = (byte)i;
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set format " + FormatComboBox.Text + "\r\n");
+        }
+
+        //发送测试图案命令：0x09 模式，并清零校验统计
+        private void TestComboBox_SelectedIndexChanged(object sender, EventArgs e)
+        {
+            int i = TestComboBox.SelectedIndex;
+            if (i < 0 || !start_flag)
+                return;
+            test_ok = test_corrupt = test_missing = test_dup = 0;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_test;
+            cmd[1] = (byte)i;
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set test " + TestComboBox.Text + "\r\n");
+        }
+
+        //发送统计开关命令：0x0A 开关
+        private void StatsCheckBox_CheckedChanged(object sender, EventArgs e)
+        {
+            if (!start_flag)
+                return;
+            stats_text = null;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_stats;
+            cmd[1] = (byte)(StatsCheckBox.Checked ? 1 : 0);
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set stats " + cmd[1] + "\r\n");
+        }
+
+        //发送压缩开关命令：0x0B 开关
+        private void CodecCheckBox_CheckedChanged(object sender, EventArgs e)
+        {
+            if (!start_flag)
+                return;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_codec;
+            cmd[1] = (byte)(CodecCheckBox.Checked ? 1 : 0);
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set codec " + cmd[1] + "\r\n");
+        }
+
+        //发送按块刷新开关命令：0x0C 开关
+        private void BlockCheckBox_CheckedChanged(object sender, EventArgs e)
+        {
+            if (!start_flag)
+                return;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_block;
+            cmd[1] = (byte)(BlockCheckBox.Checked ? 1 : 0);
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set block " + cmd[1] + "\r\n");
+        }
+
+        //发送JPEG质量命令：0x0D 质量（0为关）
+        private void JpegComboBox_SelectedIndexChanged(object sender, EventArgs e)
+        {
+            int i = JpegComboBox.SelectedIndex;
+            if (i < 0 || !start_flag)
+                return;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_jpeg;
+            cmd[1] = jpeg_quality[i];
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set jpeg " + cmd[1] + "\r\n");
+        }
+
+        //发送渐进传输开关命令：0x0E 开关
+        private void ProgCheckBox_CheckedChanged(object sender, EventArgs e)
+        {
+            if (!start_flag)
+                return;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_prog;
+            cmd[1] = (byte)(ProgCheckBox.Checked ? 1 : 0);
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set prog " + cmd[1] + "\r\n");
+        }
+
+        //发送最新帧优先开关命令：0x10 开关
+        private void LatestCheckBox_CheckedChanged(object sender, EventArgs e)
+        {
+            if (!start_flag)
+                return;
+            byte[] cmd = new byte[2];
+            cmd[0] = set_latest;
+            cmd[1] = (byte)(LatestCheckBox.Checked ? 1 : 0);
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set latest " + cmd[1] + "\r\n");
+        }
+
+        //发送区域加权命令：0x0F ROI外倍数（0为关）
+        private void FoveaComboBox_SelectedIndexChanged(object sender, EventArgs e)
+        {
+            int i = FoveaComboBox.SelectedIndex;
+            if (i < 0 || !start_flag)
+                return;
+            fovea_cur = fovea_scale[i];
+            byte[] cmd = new byte[2];
+            cmd[0] = set_fovea;
+            cmd[1] = fovea_cur;
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set fovea " + cmd[1] + "\r\n");
+        }
+
+        //点击图像把ROI移到点击处：0x0F 倍数 ROI的X Y 宽 高（16位，高字节在前，窗口内坐标）
+        private void pictureBox1_MouseClick(object sender, MouseEventArgs e)
+        {
+            if (!start_flag || fovea_cur == 0)
+                return;
+            //图像按Zoom居中显示，换算回窗口内坐标
+            double k = Math.Min((double)pictureBox1.Width / frame_width, (double)pictureBox1.Height / frame_height);
+            int cx = (int)((e.X - (pictureBox1.Width - frame_width * k) / 2) / k);
+            int cy = (int)((e.Y - (pictureBox1.Height - frame_height * k) / 2) / k);
+            int w = Math.Min(fovea_roi_w, frame_width), h = Math.Min(fovea_roi_h, frame_height);
+            int x = Math.Max(0, Math.Min(cx - w / 2, frame_width - w));
+            int y = Math.Max(0, Math.Min(cy - h / 2, frame_height - h));
+            byte[] cmd = { set_fovea, fovea_cur, (byte)(x >> 8), (byte)x, (byte)(y >> 8), (byte)y,
+                           (byte)(w >> 8), (byte)w, (byte)(h >> 8), (byte)h };
+            socketUDP.SendTo(cmd, new IPEndPoint(IPAddress.Parse("192.168.1.88"), 8088));
+            PictureDataBox.AppendText("set roi " + x + "," + y + " " + w + "x" + h + "\r\n");
+        }
+
         private void restart_button_Click(object sender, EventArgs e)
         {
             send_data[0] = restart;
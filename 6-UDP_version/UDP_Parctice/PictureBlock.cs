@@ -0,0 +1,52 @@
+﻿using System;
+
+namespace UDP_Parctice
+{
+    //按16x16块条件刷新的接收，规则同下位机block.c
+    //块包：0x55 0xAA 'B' 块数，每块：块列 块行 块数据（逐行）；右边、下边的块按实际大小
+    //帧结束包：0x55 0xAA 'E' 刷新标志 帧序号（32位，高字节在前）
+    static class PictureBlock
+    {
+        public const int size = 16;
+        public const int head_len = 4;
+        public const int end_len = 8;
+
+        public static bool IsBlockPacket(byte[] buf, int len)
+        {
+            return len >= head_len && buf[0] == 0x55 && buf[1] == 0xAA && buf[2] == 'B';
+        }
+
+        public static bool IsEndPacket(byte[] buf, int len)
+        {
+            return len == end_len && buf[0] == 0x55 && buf[1] == 0xAA && buf[2] == 'E';
+        }
+
+        //把块包贴到整帧上，返回块数，包错误返回0
+        public static int Apply(byte[] input, int len, byte[] frame, int width, int height, int bpp)
+        {
+            if (!IsBlockPacket(input, len))
+                return 0;
+            int p = head_len;
+            int n;
+            for (n = 0; n < input[3]; n++)
+            {
+                if (len - p < 2)
+                    return 0;
+                int x0 = input[p] * size, y0 = input[p + 1] * size;
+                if (x0 >= width || y0 >= height)
+                    return 0;
+                int bw = Math.Min(size, width - x0), bh = Math.Min(size, height - y0);
+                int row = bw * bpp;
+                p += 2;
+                if (len - p < row * bh)
+                    return 0;
+                for (int y = 0; y < bh; y++)
+                {
+                    Array.Copy(input, p, frame, ((y0 + y) * width + x0) * bpp, row);
+                    p += row;
+                }
+            }
+            return (p == len) ? n : 0;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+﻿using System;
+
+namespace UDP_Parctice
+{
+    //RGB565一包（2行）无损压缩的解码，规则同下位机codec.c
+    //压缩包：0x55 0xAA 'C' 格式 原始字节数（16位，高字节在前） 码流
+    //每个像素依次R(5位) G(6位) B(5位)，第1行左预测，第2行MED预测，残差自适应Rice编码
+    static class PictureCodec
+    {
+        public const int head_len = 6;
+        const int qmax = 16;
+        static readonly int[] bits = { 5, 6, 5 };
+        static readonly int[] shift = { 11, 5, 0 };
+
+        public static bool IsCodecPacket(byte[] buf, int len)
+        {
+            return len >= head_len && buf[0] == 0x55 && buf[1] == 0xAA && buf[2] == 'C';
+        }
+
+        static int Channel(byte[] buf, int i, int ch)
+        {
+            int p = (buf[i * 2] << 8) | buf[i * 2 + 1];
+            return (p >> shift[ch]) & ((1 << bits[ch]) - 1);
+        }
+
+        static int Predict(byte[] buf, int width, int i, int ch)
+        {
+            int x = i % width;
+            if (i < width)
+                return x > 0 ? Channel(buf, i - 1, ch) : (1 << (bits[ch] - 1));
+            if (x == 0)
+                return Channel(buf, i - width, ch);
+            int a = Channel(buf, i - 1, ch), b = Channel(buf, i - width, ch), c = Channel(buf, i - width - 1, ch);
+            int mx = Math.Max(a, b), mn = Math.Min(a, b);
+            if (c >= mx)
+                return mn;
+            if (c <= mn)
+                return mx;
+            return a + b - c;
+        }
+
+        //解压到output，返回原始字节数，码流错误返回0
+        public static int Decode(byte[] input, int len, int width, byte[] output)
+        {
+            int raw_len = width * 4;
+            if (!IsCodecPacket(input, len) || input[3] != 0 || ((input[4] << 8) | input[5]) != raw_len)
+                return 0;
+            int[] a = { 2, 2, 2 };
+            int[] n = { 1, 1, 1 };
+            int pos = head_len, acc = 0, have = 0;
+            Func<int, int> get = (cnt) =>
+            {
+                while (have < cnt)
+                {
+                    if (pos >= len)
+                        return -1;
+                    acc = ((acc << 8) | input[pos++]) & 0xffffff;
+                    have += 8;
+                }
+                have -= cnt;
+                return (acc >> have) & ((1 << cnt) - 1);
+            };
+
+            for (int i = 0; i < width * 2; i++)
+            {
+                int p = 0;
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    int k = 0;
+                    while ((n[ch] << k) < a[ch] && k < bits[ch])
+                        k++;
+                    int q, u, b;
+                    for (q = 0; q < qmax; q++)
+                    {
+                        if ((b = get(1)) < 0)
+                            return 0;
+                        if (b == 0)
+                            break;
+                    }
+                    if (q == qmax)
+                    {
+                        if ((u = get(bits[ch])) < 0)
+                            return 0;
+                    }
+                    else
+                    {
+                        b = 0;
+                        if (k > 0 && (b = get(k)) < 0)
+                            return 0;
+                        u = (q << k) | b;
+                    }
+                    a[ch] += u;
+                    if (++n[ch] == 32)
+                    {
+                        a[ch] >>= 1;
+                        n[ch] >>= 1;
+                    }
+                    int s = (u & 1) != 0 ? -((u + 1) >> 1) : (u >> 1);
+                    int v = (Predict(output, width, i, ch) + s) & ((1 << bits[ch]) - 1);
+                    p |= v << shift[ch];
+                }
+                output[i * 2] = (byte)(p >> 8);
+                output[i * 2 + 1] = (byte)(p & 0xff);
+            }
+            return raw_len;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+﻿using System;
+
+namespace UDP_Parctice
+{
+    //区域加权的接收，规则同下位机PictureFoveaPack()
+    //区域加权包：0x55 0xAA 'F' 倍数 帧号 首行 条数 标志 ROI的X Y 宽 高（16位，高字节在前） 各条
+    //一条是“倍数”行：合并后的一行，条在ROI的行范围内时再跟ROI的“倍数”行原始像素
+    static class PictureFovea
+    {
+        public const int head_len = 18;
+        public const byte last = 0x01;
+
+        public static bool IsPacket(byte[] buf, int len)
+        {
+            return len >= head_len && buf[0] == 0x55 && buf[1] == 0xAA && buf[2] == 'F';
+        }
+
+        public static bool IsLast(byte[] buf) { return (buf[9] & last) != 0; }
+
+        static int U16(byte[] buf, int i) { return (buf[i] << 8) | buf[i + 1]; }
+
+        //先把合并的像素铺满倍数x倍数的格子，再贴ROI，返回条数，包错误返回0
+        public static int Apply(byte[] input, int len, byte[] frame, int width, int height, int bpp)
+        {
+            if (!IsPacket(input, len))
+                return 0;
+            int scale = input[3];
+            int y = U16(input, 6), strips = input[8];
+            int rx = U16(input, 10), ry = U16(input, 12), rw = U16(input, 14), rh = U16(input, 16);
+            if ((scale != 2 && scale != 4) || width % scale != 0 || y % scale != 0
+                || rx + rw > width || ry + rh > height)
+                return 0;
+            int cw = width / scale;
+            int p = head_len;
+            for (int n = 0; n < strips; n++, y += scale)
+            {
+                bool roi = rw > 0 && y >= ry && y < ry + rh;
+                if (y + scale > height || len - p < (cw + (roi ? scale * rw : 0)) * bpp)
+                    return 0;
+                for (int x = 0; x < cw; x++, p += bpp)
+                {
+                    for (int dy = 0; dy < scale; dy++)
+                    {
+                        int o = ((y + dy) * width + x * scale) * bpp;
+                        for (int dx = 0; dx < scale; dx++, o += bpp)
+                        {
+                            frame[o] = input[p];
+                            if (bpp == 2)
+                                frame[o + 1] = input[p + 1];
+                        }
+                    }
+                }
+                if (!roi)
+                    continue;
+                for (int dy = 0; dy < scale; dy++)
+                {
+                    Array.Copy(input, p, frame, ((y + dy) * width + rx) * bpp, rw * bpp);
+                    p += rw * bpp;
+                }
+            }
+            return (p == len) ? strips : 0;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+﻿using System;
+
+namespace UDP_Parctice
+{
+    //渐进传输的接收，规则同下位机PictureProgPack()
+    //渐进包：0x55 0xAA 'P' 遍 总遍数 x起点<<4|x步长 y起点<<4|y步长 行数 帧号 首行（16位，高字节在前） 像素
+    //每个像素铺满(x步长-x起点)x(y步长-y起点)的格子：第0遍2x2，第1遍1x2，第2遍1x1，后面的遍覆盖前面的粗图
+    static class PictureProgressive
+    {
+        public const int head_len = 12;
+
+        public static bool IsPacket(byte[] buf, int len)
+        {
+            return len >= head_len && buf[0] == 0x55 && buf[1] == 0xAA && buf[2] == 'P';
+        }
+
+        public static int Pass(byte[] buf) { return buf[3]; }
+        public static int Passes(byte[] buf) { return buf[4]; }
+        public static int Frame(byte[] buf) { return (buf[8] << 8) | buf[9]; }
+
+        //这一包是否是本遍最后一包，收到后这一遍的图就完整了
+        public static bool IsPassEnd(byte[] buf, int height)
+        {
+            int ystep = buf[6] & 0x0f;
+            int row = (buf[10] << 8) | buf[11];
+            return row + buf[7] * ystep >= height;
+        }
+
+        //把渐进包的像素铺到整帧上，返回行数，包错误返回0
+        public static int Apply(byte[] input, int len, byte[] frame, int width, int height, int bpp)
+        {
+            if (!IsPacket(input, len))
+                return 0;
+            int x0 = input[5] >> 4, xstep = input[5] & 0x0f;
+            int y0 = input[6] >> 4, ystep = input[6] & 0x0f;
+            int rows = input[7];
+            int row = (input[10] << 8) | input[11];
+            if (xstep == 0 || ystep == 0 || x0 >= xstep || y0 >= ystep || (row - y0) % ystep != 0)
+                return 0;
+            int fw = xstep - x0, fh = ystep - y0;
+            int row_len = (width - x0 + xstep - 1) / xstep * bpp;
+            if (len != head_len + rows * row_len || row + (rows - 1) * ystep >= height)
+                return 0;
+            int p = head_len;
+            for (int r = 0; r < rows; r++, row += ystep)
+            {
+                int h = Math.Min(fh, height - row);
+                for (int x = x0; x < width; x += xstep, p += bpp)
+                {
+                    int w = Math.Min(fw, width - x);
+                    for (int dy = 0; dy < h; dy++)
+                    {
+                        int o = ((row + dy) * width + x) * bpp;
+                        for (int dx = 0; dx < w; dx++, o += bpp)
+                        {
+                            frame[o] = input[p];
+                            if (bpp == 2)
+                                frame[o + 1] = input[p + 1];
+                        }
+                    }
+                }
+            }
+            return rows;
+        }
+    }
+}
@@ -0,0 +1,2 @@
+/* 主机区分大小写，"Types.h"在这里转到W5500/types.h */
+#include "../../User/BSP/Ethernet/W5500/types.h"
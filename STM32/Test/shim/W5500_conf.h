@@ -0,0 +1,2 @@
+/* 主机区分大小写，"W5500_conf.h"在这里转到W5500/w5500_conf.h */
+#include "../../User/BSP/Ethernet/W5500/w5500_conf.h"
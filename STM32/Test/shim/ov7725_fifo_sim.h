@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * @file    ov7725_fifo_sim.h
+  * @brief   主机单元测试用的AL422B读口模型
+  ******************************************************************************
+  * @attention
+  *
+  * 定义了OV7725_FIFO_SIM时由bsp_ov7725.h在FIFO引脚宏之后包含，
+  * 读时钟、读复位改为操作这里的模型：RRST为低时的RCLK上升沿把读指针
+  * 复位到0，之后每个上升沿把sim_fifo[读指针]放到PB8~PB15并前进一字节，
+  * 到头回绕，与FIFO_PREPARE、READ_FIFO_xxx的用法一致。
+  * IDR的低8位填固定的0x5A，检查读出时有没有屏蔽干净。
+  * sim_fifo_bench置1时数据口不变、也不计数，上升沿只写一次RCLK口的BSRR，
+  * 与目标板上的引脚操作相当，用来比较读出循环本身的开销
+  *
+  ******************************************************************************
+  */
+#ifndef __OV7725_FIFO_SIM_H
+#define __OV7725_FIFO_SIM_H
+
+#include "stm32f10x.h"
+
+#define SIM_FIFO_SIZE       393216u     /* AL422B容量 */
+#define SIM_FIFO_IDR_LOW    0x5Au       /* 数据口以外的引脚 */
+
+extern uint8_t           sim_fifo[SIM_FIFO_SIZE];   /* FIFO里的数据 */
+extern uint32_t          sim_fifo_rp;               /* 读指针：下一个上升沿输出的地址 */
+extern uint32_t          sim_fifo_clocks;           /* RCLK上升沿计数 */
+extern volatile uint8_t  sim_fifo_rrst;             /* RRST引脚电平 */
+extern uint8_t           sim_fifo_bench;            /* 1：只写引脚，测速用 */
+
+static inline void sim_fifo_rclk_h(void)
+{
+	if(sim_fifo_bench)
+	{
+		GPIOC->BSRR = GPIO_Pin_5;
+		return;
+	}
+	if(!sim_fifo_rrst)
+	{
+		sim_fifo_rp = 0;                        /* 读复位，不输出 */
+	}
+	else
+	{
+		GPIOB->IDR = ((uint32_t)sim_fifo[sim_fifo_rp] << 8) | SIM_FIFO_IDR_LOW;
+		if(++sim_fifo_rp == SIM_FIFO_SIZE)
+			sim_fifo_rp = 0;
+	}
+	sim_fifo_clocks++;
+}
+
+#undef FIFO_RCLK_H
+#undef FIFO_RCLK_L
+#undef FIFO_RRST_H
+#undef FIFO_RRST_L
+#define FIFO_RCLK_H()       sim_fifo_rclk_h()
+#define FIFO_RCLK_L()       ((void)0)
+#define FIFO_RRST_H()       (sim_fifo_rrst = 1)
+#define FIFO_RRST_L()       (sim_fifo_rrst = 0)
+
+#endif
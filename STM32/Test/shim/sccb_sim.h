@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file    sccb_sim.h
+  * @brief   主机单元测试用的SCCB引脚替身
+  ******************************************************************************
+  * @attention
+  *
+  * 定义了SCCB_SIM时由bsp_sccb.h在引脚宏之后包含。SCL、SDA的每次操作
+  * 都调用测试程序里的sim_sccb_pin()，由测试中的从机模型按引脚变化
+  * 解析起始、停止、数据位并应答；SDA_read读线与：主机和从机都释放才为高
+  *
+  ******************************************************************************
+  */
+#ifndef __SCCB_SIM_H
+#define __SCCB_SIM_H
+
+#include <stdint.h>
+
+#define SIM_SCCB_SCL        0
+#define SIM_SCCB_SDA        1
+
+void    sim_sccb_pin(uint8_t pin, uint8_t level);
+uint8_t sim_sccb_read(uint8_t pin);
+
+#undef SCL_H
+#undef SCL_L
+#undef SDA_H
+#undef SDA_L
+#undef SCL_read
+#undef SDA_read
+#define SCL_H               sim_sccb_pin(SIM_SCCB_SCL, 1)
+#define SCL_L               sim_sccb_pin(SIM_SCCB_SCL, 0)
+#define SDA_H               sim_sccb_pin(SIM_SCCB_SDA, 1)
+#define SDA_L               sim_sccb_pin(SIM_SCCB_SDA, 0)
+#define SCL_read            sim_sccb_read(SIM_SCCB_SCL)
+#define SDA_read            sim_sccb_read(SIM_SCCB_SDA)
+
+#endif
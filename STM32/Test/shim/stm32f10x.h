@@ -0,0 +1,24 @@
+/**
+  ******************************************************************************
+  * @file    stm32f10x.h
+  * @brief   主机单元测试用的stm32f10x.h外壳
+  ******************************************************************************
+  * @attention
+  *
+  * 寄存器定义照用库里的头文件；core_cm3.h里的屏障是ARM内联汇编，
+  * 这里换成主机的内存屏障。外设地址由测试程序在主机上映射（见sim.c）
+  *
+  ******************************************************************************
+  */
+#ifndef __STM32F10X_SHIM_H
+#define __STM32F10X_SHIM_H
+
+#include "../../Libraries/CMSIS/stm32f10x.h"
+
+/*sim_barrier非空时每个__DMB()之后调用，多线程测试在屏障处插入任务切换*/
+extern void (*sim_barrier)(void);
+#define __DMB()             do{ __sync_synchronize(); if(sim_barrier) sim_barrier(); }while(0)
+#define __DSB()             __sync_synchronize()
+#define __ISB()             __sync_synchronize()
+
+#endif
@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    wiz_spi_sim.h
+  * @brief   主机单元测试用的W5500连续写替身
+  ******************************************************************************
+  * @attention
+  *
+  * 定义了WIZ_SPI_SIM时由w5500_conf.h在WIZ_WRITE_STREAM_BYTE之后包含。
+  * 连续写直接写SPI的DR，映射成内存的寄存器看不到每个字节，
+  * 这里改为调用测试程序里的sim_wiz_stream_byte()，交给W5500模型；
+  * 其余的SPI、片选操作经过库函数，由测试程序提供
+  *
+  ******************************************************************************
+  */
+#ifndef __WIZ_SPI_SIM_H
+#define __WIZ_SPI_SIM_H
+
+#include <stdint.h>
+
+void sim_wiz_stream_byte(uint8_t b);
+
+#undef WIZ_WRITE_STREAM_BYTE
+#define WIZ_WRITE_STREAM_BYTE(b)    sim_wiz_stream_byte(b)
+
+#endif
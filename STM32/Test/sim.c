@@ -0,0 +1,418 @@
+/**
+  ******************************************************************************
+  * @file    sim.c
+  * @brief   主机单元测试的公共部分：uC/OS-III、uC-CPU替身和外设地址映射
+  ******************************************************************************
+  * @attention
+  *
+  * 被测的源文件原样编译，它们调用的内核服务在这里用pthread实现：
+  * 临界区是一把递归锁，信号量、互斥量用条件变量。单线程的测试没有别的线程来
+  * 释放信号量，任务挂起前先调用sim_idle，由测试在里面推进硬件模型
+  * （相当于任务挂起期间DMA、定时器在跑、中断在发生）
+  *
+  * 外设寄存器地址（0x40000000起、内核的0xE000E000起）映射成普通内存，
+  * 库函数读写寄存器不会出错，测试直接看寄存器内容模拟硬件
+  *
+  ******************************************************************************
+  */
+#define _GNU_SOURCE                     /* pthread_attr_setaffinity_np */
+#define OS_GLOBALS
+#include "stm32f10x.h"
+#include <os.h>
+#include <lib_mem.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include "sim.h"
+#include "ov7725_fifo_sim.h"
+
+int sim_fail = 0;
+void (*sim_idle)(void) = 0;
+void (*sim_barrier)(void) = 0;
+uint32_t (*sim_ts)(void) = 0;
+
+static pthread_mutex_t sim_cpu_lock;                                 /* 关中断 */
+static pthread_mutex_t sim_os_lock = PTHREAD_MUTEX_INITIALIZER;      /* 内核对象 */
+static pthread_cond_t  sim_os_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t        sim_seed = 1;
+static __thread uint8_t sim_self;                                   /* 地址当作本线程（任务）的TCB */
+
+uint8_t          sim_fifo[SIM_FIFO_SIZE];
+uint32_t         sim_fifo_rp;
+uint32_t         sim_fifo_clocks;
+volatile uint8_t sim_fifo_rrst = 1;
+uint8_t          sim_fifo_bench;
+
+
+/************************************************
+ * 函数名：sim_map
+ * 描述  ：把一段外设地址映射成可读写的内存
+ * 输入  ：addr:起始地址 size:字节数
+ * 输出  ：无
+ * 注意  ：地址被占用就退出
+ ************************************************/
+static void sim_map(uintptr_t addr, size_t size)
+{
+	void *p = mmap((void *)addr, size, PROT_READ | PROT_WRITE,
+	               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+	if(p != (void *)addr)
+	{
+		printf("sim: cannot map 0x%08lx\n", (unsigned long)addr);
+		exit(2);
+	}
+}
+
+/************************************************
+ * 函数名：sim_init
+ * 描述  ：映射外设地址，初始化临界区锁
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：每个测试程序开头调用一次
+ ************************************************/
+void sim_init(void)
+{
+	pthread_mutexattr_t attr;
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&sim_cpu_lock, &attr);
+
+	sim_map(PERIPH_BASE, 0x30000);          /* APB1、APB2、DMA、RCC */
+	sim_map(SCS_BASE, 0x1000);              /* NVIC、SCB */
+	OSRunning = OS_STATE_OS_RUNNING;
+}
+
+/************************************************
+ * 函数名：sim_ns
+ * 描述  ：单调时钟，纳秒
+ ************************************************/
+uint64_t sim_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/************************************************
+ * 函数名：sim_rand
+ * 描述  ：可复现的伪随机数（xorshift32）
+ ************************************************/
+uint32_t sim_rand(void)
+{
+	sim_seed ^= sim_seed << 13;
+	sim_seed ^= sim_seed >> 17;
+	sim_seed ^= sim_seed << 5;
+	return sim_seed;
+}
+
+void sim_srand(uint32_t seed)
+{
+	sim_seed = seed ? seed : 1;
+}
+
+/************************************************
+ * 函数名：sim_done
+ * 描述  ：打印测试结果
+ * 输入  ：name:测试名
+ * 输出  ：main的返回值，0为通过
+ ************************************************/
+int sim_done(const char *name)
+{
+	printf("%s: %s\n", name, sim_fail ? "FAIL" : "PASS");
+	return sim_fail ? 1 : 0;
+}
+
+/************************************************
+ * 函数名：sim_run2
+ * 描述  ：两个线程同时跑a、b，都返回后才返回
+ * 输入  ：cpu:>=0时两个线程绑在这个CPU上，相当于单核上的任务切换；<0不绑
+ * 输出  ：无
+ * 注意  ：a先启动
+ ************************************************/
+void sim_run2(void *(*a)(void *), void *(*b)(void *), int cpu)
+{
+	pthread_t ta, tb;
+	pthread_attr_t attr;
+	cpu_set_t set;
+
+	pthread_attr_init(&attr);
+	if(cpu >= 0)
+	{
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+	}
+	pthread_create(&ta, &attr, a, NULL);
+	pthread_create(&tb, &attr, b, NULL);
+	pthread_join(ta, NULL);
+	pthread_join(tb, NULL);
+	pthread_attr_destroy(&attr);
+}
+
+
+/*********************************** uC-CPU ***********************************/
+
+CPU_SR CPU_SR_Save(void)
+{
+	pthread_mutex_lock(&sim_cpu_lock);
+	return 0;
+}
+
+void CPU_SR_Restore(CPU_SR cpu_sr)
+{
+	(void)cpu_sr;
+	pthread_mutex_unlock(&sim_cpu_lock);
+}
+
+void CPU_IntDisMeasStart(void)
+{
+}
+
+void CPU_IntDisMeasStop(void)
+{
+}
+
+CPU_TS_TMR CPU_TS_TmrRd(void)
+{
+	if(sim_ts)
+		return sim_ts();                            /* 测试里的硬件模型计时 */
+	return (CPU_TS_TMR)(sim_ns() * 72 / 1000);      /* 按72MHz计数 */
+}
+
+
+/*********************************** uC-LIB ***********************************/
+
+void Mem_Copy(void *pdest, const void *psrc, CPU_SIZE_T size)
+{
+	memcpy(pdest, psrc, size);
+}
+
+void Mem_Move(void *pdest, const void *psrc, CPU_SIZE_T size)
+{
+	memmove(pdest, psrc, size);
+}
+
+void Mem_Clr(void *pmem, CPU_SIZE_T size)
+{
+	memset(pmem, 0, size);
+}
+
+void Mem_Set(void *pmem, CPU_INT08U data_val, CPU_SIZE_T size)
+{
+	memset(pmem, data_val, size);
+}
+
+
+/********************************* uC/OS-III *********************************/
+
+/************************************************
+ * 函数名：sim_wait
+ * 描述  ：在内核锁里等待条件变化，timeout为节拍（1ms），0为一直等
+ * 输出  ：0:被唤醒 1:超时
+ ************************************************/
+static int sim_wait(OS_TICK timeout)
+{
+	struct timespec ts;
+
+	if(timeout == 0)
+	{
+		pthread_cond_wait(&sim_os_cond, &sim_os_lock);
+		return 0;
+	}
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_nsec += (long)(timeout % 1000) * 1000000;
+	ts.tv_sec  += timeout / 1000 + ts.tv_nsec / 1000000000;
+	ts.tv_nsec %= 1000000000;
+	return pthread_cond_timedwait(&sim_os_cond, &sim_os_lock, &ts) == ETIMEDOUT;
+}
+
+void OSSemCreate(OS_SEM *p_sem, CPU_CHAR *p_name, OS_SEM_CTR cnt, OS_ERR *p_err)
+{
+	memset(p_sem, 0, sizeof(*p_sem));
+	p_sem->Type = OS_OBJ_TYPE_SEM;
+	p_sem->NamePtr = p_name;
+	p_sem->Ctr = cnt;
+	*p_err = OS_ERR_NONE;
+}
+
+OS_SEM_CTR OSSemPend(OS_SEM *p_sem, OS_TICK timeout, OS_OPT opt, CPU_TS *p_ts, OS_ERR *p_err)
+{
+	OS_SEM_CTR ctr;
+
+	if(p_ts)
+		*p_ts = 0;
+	if(p_sem->Ctr == 0 && sim_idle && !(opt & OS_OPT_PEND_NON_BLOCKING))
+		sim_idle();                                     /* 挂起期间硬件在跑 */
+
+	pthread_mutex_lock(&sim_os_lock);
+	while(p_sem->Ctr == 0)
+	{
+		if((opt & OS_OPT_PEND_NON_BLOCKING) || sim_idle)
+		{
+			pthread_mutex_unlock(&sim_os_lock);
+			*p_err = (opt & OS_OPT_PEND_NON_BLOCKING) ? OS_ERR_PEND_WOULD_BLOCK : OS_ERR_TIMEOUT;
+			return 0;
+		}
+		if(sim_wait(timeout))
+		{
+			pthread_mutex_unlock(&sim_os_lock);
+			*p_err = OS_ERR_TIMEOUT;
+			return 0;
+		}
+	}
+	ctr = --p_sem->Ctr;
+	pthread_mutex_unlock(&sim_os_lock);
+	*p_err = OS_ERR_NONE;
+	return ctr;
+}
+
+OS_SEM_CTR OSSemPost(OS_SEM *p_sem, OS_OPT opt, OS_ERR *p_err)
+{
+	OS_SEM_CTR ctr;
+
+	(void)opt;
+	pthread_mutex_lock(&sim_os_lock);
+	ctr = ++p_sem->Ctr;
+	pthread_cond_broadcast(&sim_os_cond);
+	pthread_mutex_unlock(&sim_os_lock);
+	*p_err = OS_ERR_NONE;
+	return ctr;
+}
+
+void OSSemSet(OS_SEM *p_sem, OS_SEM_CTR cnt, OS_ERR *p_err)
+{
+	pthread_mutex_lock(&sim_os_lock);
+	p_sem->Ctr = cnt;
+	pthread_mutex_unlock(&sim_os_lock);
+	*p_err = OS_ERR_NONE;
+}
+
+/*互斥量：持有者是线程，持有者再拿只加嵌套数，放到0才交出，同uC/OS-III*/
+void OSMutexCreate(OS_MUTEX *p_mutex, CPU_CHAR *p_name, OS_ERR *p_err)
+{
+	memset(p_mutex, 0, sizeof(*p_mutex));
+	p_mutex->Type = OS_OBJ_TYPE_MUTEX;
+	p_mutex->NamePtr = p_name;
+	*p_err = OS_ERR_NONE;
+}
+
+void OSMutexPend(OS_MUTEX *p_mutex, OS_TICK timeout, OS_OPT opt, CPU_TS *p_ts, OS_ERR *p_err)
+{
+	OS_TCB *self = (OS_TCB *)&sim_self;
+
+	if(p_ts)
+		*p_ts = 0;
+	pthread_mutex_lock(&sim_os_lock);
+	if(p_mutex->OwnerTCBPtr == self)
+	{
+		p_mutex->OwnerNestingCtr++;
+		pthread_mutex_unlock(&sim_os_lock);
+		*p_err = OS_ERR_MUTEX_OWNER;
+		return;
+	}
+	while(p_mutex->OwnerNestingCtr != 0)
+	{
+		if((opt & OS_OPT_PEND_NON_BLOCKING) || sim_wait(timeout))
+		{
+			pthread_mutex_unlock(&sim_os_lock);
+			*p_err = (opt & OS_OPT_PEND_NON_BLOCKING) ? OS_ERR_PEND_WOULD_BLOCK : OS_ERR_TIMEOUT;
+			return;
+		}
+	}
+	p_mutex->OwnerTCBPtr = self;
+	p_mutex->OwnerNestingCtr = 1;
+	pthread_mutex_unlock(&sim_os_lock);
+	*p_err = OS_ERR_NONE;
+}
+
+void OSMutexPost(OS_MUTEX *p_mutex, OS_OPT opt, OS_ERR *p_err)
+{
+	(void)opt;
+	pthread_mutex_lock(&sim_os_lock);
+	if(p_mutex->OwnerTCBPtr != (OS_TCB *)&sim_self)
+	{
+		pthread_mutex_unlock(&sim_os_lock);
+		*p_err = OS_ERR_MUTEX_NOT_OWNER;
+		return;
+	}
+	if(--p_mutex->OwnerNestingCtr != 0)
+	{
+		pthread_mutex_unlock(&sim_os_lock);
+		*p_err = OS_ERR_MUTEX_NESTING;
+		return;
+	}
+	p_mutex->OwnerTCBPtr = 0;
+	pthread_cond_broadcast(&sim_os_cond);
+	pthread_mutex_unlock(&sim_os_lock);
+	*p_err = OS_ERR_NONE;
+}
+
+void OSMemCreate(OS_MEM *p_mem, CPU_CHAR *p_name, void *p_addr, OS_MEM_QTY n_blks,
+                 OS_MEM_SIZE blk_size, OS_ERR *p_err)
+{
+	OS_MEM_QTY i;
+	uint8_t   *p = (uint8_t *)p_addr;
+
+	memset(p_mem, 0, sizeof(*p_mem));
+	for(i = 0; i + 1 < n_blks; i++)                     /* 空闲块串成链表，同uC/OS-III */
+		*(void **)(p + (size_t)i * blk_size) = p + (size_t)(i + 1) * blk_size;
+	*(void **)(p + (size_t)i * blk_size) = 0;
+	p_mem->Type = OS_OBJ_TYPE_MEM;
+	p_mem->NamePtr = p_name;
+	p_mem->AddrPtr = p_addr;
+	p_mem->FreeListPtr = p_addr;
+	p_mem->BlkSize = blk_size;
+	p_mem->NbrMax = n_blks;
+	p_mem->NbrFree = n_blks;
+	*p_err = OS_ERR_NONE;
+}
+
+void *OSMemGet(OS_MEM *p_mem, OS_ERR *p_err)
+{
+	void *p;
+
+	pthread_mutex_lock(&sim_os_lock);
+	if(p_mem->NbrFree == 0)
+	{
+		pthread_mutex_unlock(&sim_os_lock);
+		*p_err = OS_ERR_MEM_NO_FREE_BLKS;
+		return 0;
+	}
+	p = p_mem->FreeListPtr;
+	p_mem->FreeListPtr = *(void **)p;
+	p_mem->NbrFree--;
+	pthread_mutex_unlock(&sim_os_lock);
+	*p_err = OS_ERR_NONE;
+	return p;
+}
+
+void OSMemPut(OS_MEM *p_mem, void *p_blk, OS_ERR *p_err)
+{
+	pthread_mutex_lock(&sim_os_lock);
+	*(void **)p_blk = p_mem->FreeListPtr;
+	p_mem->FreeListPtr = p_blk;
+	p_mem->NbrFree++;
+	pthread_mutex_unlock(&sim_os_lock);
+	*p_err = OS_ERR_NONE;
+}
+
+void OSTimeDly(OS_TICK dly, OS_OPT opt, OS_ERR *p_err)
+{
+	struct timespec ts;
+
+	(void)opt;
+	ts.tv_sec = dly / 1000;
+	ts.tv_nsec = (long)(dly % 1000) * 1000000;
+	nanosleep(&ts, 0);
+	*p_err = OS_ERR_NONE;
+}
+
+OS_TICK OSTimeGet(OS_ERR *p_err)
+{
+	*p_err = OS_ERR_NONE;
+	return (OS_TICK)(sim_ns() / 1000000u);
+}
@@ -0,0 +1,28 @@
+#ifndef __SIM_H
+#define __SIM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*检查一个条件，不成立则打印位置并记一次失败*/
+#define SIM_CHECK(cond)     do{\
+                              if(!(cond))\
+                              {\
+                                printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);\
+                                sim_fail++;\
+                              }\
+                            }while(0)
+
+extern int sim_fail;                    /* 失败次数，main返回它 */
+extern void (*sim_idle)(void);          /* 任务将要挂起时调用：单线程测试在这里推进硬件模型 */
+extern uint32_t (*sim_ts)(void);        /* 非空时OS_TS_GET()取它，测试按硬件模型计时 */
+
+void     sim_init(void);
+uint64_t sim_ns(void);
+uint32_t sim_rand(void);
+void     sim_srand(uint32_t seed);
+int      sim_done(const char *name);
+void     sim_run2(void *(*a)(void *), void *(*b)(void *), int cpu);
+
+#endif
@@ -0,0 +1,333 @@
+/**
+  ******************************************************************************
+  * @file    test_binning.c
+  * @brief   OV7725_ReadBinned、区域加权：与逐分量直接计算的参考结果比较，主机上的相对速度
+  ******************************************************************************
+  * @attention
+  *
+  * bsp_ov7725.c原样编译，读口接到shim/ov7725_fifo_sim.h的AL422B模型。
+  * 参考实现逐像素拆出R、G、B（灰度取Y），每个分量按
+  * (和 + n/2) / n 取整，n = factor*factor，结果要逐字节相同。
+  * 随机数据之外再测全1，检查分量累加不会进位到相邻分量。
+  * OV7725_ReadBinnedRoi：合并的一行同上，ROI的原始像素与FIFO中的逐字节相同。
+  * PictureFoveaPack：接收端一样拆包，各条合并的行、ROI的像素与参考比较，
+  * 条首尾相接盖满窗口，ROI按4像素对齐、限制到窗口内、宽度限制到一条放得进一包，
+  * 一帧读完读指针正好在帧尾；ROI为空、在窗口中、被窗口截断、超出窗口、比一包宽几种
+  *
+  ******************************************************************************
+  */
+#define _POSIX_C_SOURCE     200112L     /* 不要sys/types.h里的u_int，与W5500的types.h冲突 */
+#include <string.h>
+#include "sim.h"
+#include "image.h"
+
+
+#define MAX_W               640
+
+extern OV7725_MODE_PARAM cam_mode;
+
+static uint8_t  out[MAX_W * 2];
+static uint8_t  ref[MAX_W * 2];
+static uint8_t  roi_out[4 * MAX_W * 2 + 1];
+static uint32_t pkt_w[PICTURE_PACKET_MAX / 4];
+static uint8_t *pkt = (uint8_t *)pkt_w;
+static uint32_t raw_w[(MAX_W * 2 * 4) / 4];
+static uint8_t *raw = (uint8_t *)raw_w;
+
+/*参考：FIFO从from起factor行，每行width个像素，每像素2字节*/
+static uint16_t bin_ref(uint32_t from, uint16_t width, uint8_t factor, uint8_t format)
+{
+	uint32_t r, g, b, n = (uint32_t)factor * factor;
+	uint32_t pos;
+	uint16_t x, px, p;
+	uint8_t  dx, dy;
+
+	for(x = 0; x < width / factor; x++)
+	{
+		r = g = b = 0;
+		for(dy = 0; dy < factor; dy++)
+		{
+			for(dx = 0; dx < factor; dx++)
+			{
+				px  = x * factor + dx;
+				pos = (from + ((uint32_t)dy * width + px) * 2) % SIM_FIFO_SIZE;
+				if(format == OV7725_FORMAT_GRAY)
+				{
+					g += sim_fifo[(pos + OV7725_Y_OFFSET) % SIM_FIFO_SIZE];
+					continue;
+				}
+				p = ((uint16_t)sim_fifo[pos] << 8) | sim_fifo[(pos + 1) % SIM_FIFO_SIZE];
+				r += p >> 11;
+				g += (p >> 5) & 0x3f;
+				b += p & 0x1f;
+			}
+		}
+		if(format == OV7725_FORMAT_GRAY)
+		{
+			ref[x] = (uint8_t)((g + n / 2) / n);
+			continue;
+		}
+		p = (uint16_t)((((r + n / 2) / n) << 11) | (((g + n / 2) / n) << 5) | ((b + n / 2) / n));
+		ref[x * 2]     = (uint8_t)(p >> 8);
+		ref[x * 2 + 1] = (uint8_t)p;
+	}
+	return (format == OV7725_FORMAT_GRAY) ? width / factor : width / factor * 2;
+}
+
+static void fifo_at(uint32_t from)
+{
+	FIFO_PREPARE;
+	GPIOB->IDR = ((uint32_t)sim_fifo[from] << 8) | SIM_FIFO_IDR_LOW;
+	sim_fifo_rp = (from + 1) % SIM_FIFO_SIZE;
+}
+
+static void check_one(uint16_t width, uint8_t factor, uint8_t format, uint32_t from)
+{
+	uint16_t n, len;
+
+	fifo_at(from);
+	memset(out, 0xEE, sizeof(out));
+	len = OV7725_ReadBinned(out, width, factor, format);
+	n = bin_ref(from, width, factor, format);
+	SIM_CHECK(len == n);
+	SIM_CHECK(memcmp(out, ref, n) == 0);
+	SIM_CHECK(n == sizeof(out) || out[n] == 0xEE);
+	SIM_CHECK(sim_fifo_rp == (from + (uint32_t)width * factor * 2 + 1) % SIM_FIFO_SIZE);
+}
+
+static void test_ref(void)
+{
+	static const uint16_t width[] = {640, 320, 240, 160, 8};
+	static const uint8_t  format[] = {OV7725_FORMAT_RGB565, OV7725_FORMAT_GRAY};
+	uint32_t i;
+	int w, f, k, r;
+
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)sim_rand();
+	for(w = 0; w < (int)(sizeof(width) / sizeof(width[0])); w++)
+		for(f = 0; f < 2; f++)
+			for(k = 2; k <= 4; k += 2)
+				for(r = 0; r < 8; r++)
+					check_one(width[w], (uint8_t)k, format[f], sim_rand() % SIM_FIFO_SIZE);
+
+	/*全1：每个分量取最大值，和最大*/
+	memset(sim_fifo, 0xFF, SIM_FIFO_SIZE);
+	for(f = 0; f < 2; f++)
+		for(k = 2; k <= 4; k += 2)
+			check_one(320, (uint8_t)k, format[f], 0);
+
+	/*四舍五入的边界：一个像素为1其余为0，以及n/2个像素为1*/
+	memset(sim_fifo, 0, SIM_FIFO_SIZE);
+	for(i = 0; i < 8; i++)
+		sim_fifo[i * 2 + 1] = 0x21;     /* R=0 G=1 B=1 */
+	for(f = 0; f < 2; f++)
+		for(k = 2; k <= 4; k += 2)
+			check_one(16, (uint8_t)k, format[f], 0);
+}
+
+/*roi中factor行[x, x+w)的原始像素与FIFO从from起的是否相同，灰度只有Y*/
+static int roi_same(const uint8_t *roi, uint32_t from, uint16_t width, uint8_t factor, uint8_t format, uint16_t x, uint16_t w)
+{
+	uint32_t pos;
+	uint16_t dy, px;
+
+	for(dy = 0; dy < factor; dy++)
+	{
+		for(px = x; px < x + w; px++)
+		{
+			pos = (from + ((uint32_t)dy * width + px) * 2) % SIM_FIFO_SIZE;
+			if(format == OV7725_FORMAT_GRAY)
+			{
+				if(*roi++ != sim_fifo[(pos + OV7725_Y_OFFSET) % SIM_FIFO_SIZE])
+					return 0;
+				continue;
+			}
+			if(roi[0] != sim_fifo[pos] || roi[1] != sim_fifo[(pos + 1) % SIM_FIFO_SIZE])
+				return 0;
+			roi += 2;
+		}
+	}
+	return 1;
+}
+
+static void check_roi(uint16_t width, uint8_t factor, uint8_t format, uint32_t from, uint16_t x, uint16_t w)
+{
+	uint32_t roi_len = (uint32_t)factor * w * ((format == OV7725_FORMAT_GRAY) ? 1 : 2);
+	uint16_t n, len;
+
+	fifo_at(from);
+	memset(out, 0xEE, sizeof(out));
+	memset(roi_out, 0xEE, sizeof(roi_out));
+	len = OV7725_ReadBinnedRoi(out, width, factor, format, w ? roi_out : NULL, x, w);
+	n = bin_ref(from, width, factor, format);
+	SIM_CHECK(len == n);
+	SIM_CHECK(memcmp(out, ref, n) == 0);
+	SIM_CHECK(roi_same(roi_out, from, width, factor, format, x, w));
+	SIM_CHECK(roi_out[roi_len] == 0xEE);
+	SIM_CHECK(sim_fifo_rp == (from + (uint32_t)width * factor * 2 + 1) % SIM_FIFO_SIZE);
+}
+
+/*ROI为空、整行、靠两边、随机位置*/
+static void test_roi(void)
+{
+	static const uint16_t width[] = {640, 320, 160, 8};
+	static const uint8_t  format[] = {OV7725_FORMAT_RGB565, OV7725_FORMAT_GRAY};
+	uint32_t i;
+	uint16_t x, w;
+	int wi, f, k, r;
+
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)sim_rand();
+	for(wi = 0; wi < (int)(sizeof(width) / sizeof(width[0])); wi++)
+		for(f = 0; f < 2; f++)
+			for(k = 2; k <= 4; k += 2)
+			{
+				check_roi(width[wi], (uint8_t)k, format[f], sim_rand() % SIM_FIFO_SIZE, 0, 0);
+				check_roi(width[wi], (uint8_t)k, format[f], sim_rand() % SIM_FIFO_SIZE, 0, width[wi]);
+				check_roi(width[wi], (uint8_t)k, format[f], sim_rand() % SIM_FIFO_SIZE, 0, (uint16_t)k);
+				check_roi(width[wi], (uint8_t)k, format[f], sim_rand() % SIM_FIFO_SIZE, width[wi] - k, (uint16_t)k);
+				for(r = 0; r < 8; r++)
+				{
+					x = sim_rand() % (width[wi] / k) * k;
+					w = sim_rand() % ((width[wi] - x) / k + 1) * k;
+					check_roi(width[wi], (uint8_t)k, format[f], sim_rand() % SIM_FIFO_SIZE, x, w);
+				}
+			}
+}
+
+typedef struct
+{
+	uint16_t width, height;
+	uint8_t  format, scale;
+	PICTURE_FOVEA_ROI set;                  /* picture_fovea_roi */
+	PICTURE_FOVEA_ROI use;                  /* 本帧应该用的ROI（包长1472） */
+	const char *name;
+}FOVEA_CASE;
+
+/*按接收端的方式拆一帧的区域加权包，与参考比较*/
+static void check_fovea(const FOVEA_CASE *c)
+{
+	uint8_t  bpp = (c->format == OV7725_FORMAT_GRAY) ? 1 : 2;
+	uint16_t coarse_len = c->width / c->scale * bpp;
+	uint16_t roi_len = c->scale * c->use.w * bpp;
+	uint16_t y = 0, frame = 0, len, n, in, packets = 0;
+	uint32_t clocks, frame_bytes = (uint32_t)c->width * c->height * 2;
+	uint8_t *o;
+
+	cam_mode.cam_width = c->width;
+	cam_mode.cam_height = c->height;
+	cam_mode.format = c->format;
+	picture_fovea = c->scale;
+	picture_fovea_roi = c->set;
+	SIM_CHECK(PictureFoveaActive());
+	fifo_at(0);
+	clocks = sim_fifo_clocks;
+	PictureFoveaBegin();
+	for(;;)
+	{
+		memset(pkt, 0xEE, PICTURE_PACKET_MAX);
+		len = PictureFoveaPack(pkt);
+		if(len == 0)
+			break;
+		SIM_CHECK(len <= PICTURE_PACKET_MAX);
+		SIM_CHECK(pkt[0] == 0x55 && pkt[1] == 0xAA && pkt[2] == 'F' && pkt[3] == c->scale);
+		if(packets == 0)
+			frame = (pkt[4] << 8) | pkt[5];
+		SIM_CHECK(((pkt[4] << 8) | pkt[5]) == frame);
+		SIM_CHECK(((pkt[6] << 8) | pkt[7]) == y);
+		SIM_CHECK(((pkt[10] << 8) | pkt[11]) == c->use.x && ((pkt[12] << 8) | pkt[13]) == c->use.y);
+		SIM_CHECK(((pkt[14] << 8) | pkt[15]) == c->use.w && ((pkt[16] << 8) | pkt[17]) == c->use.h);
+		o = pkt + PICTURE_FOVEA_HEAD_LEN;
+		for(n = pkt[8]; n > 0; n--)
+		{
+			in = y >= c->use.y && y < c->use.y + c->use.h && c->use.w;
+			bin_ref((uint32_t)y * c->width * 2, c->width, c->scale, c->format);
+			SIM_CHECK(memcmp(o, ref, coarse_len) == 0);
+			o += coarse_len;
+			if(in)
+			{
+				SIM_CHECK(roi_same(o, (uint32_t)y * c->width * 2, c->width, c->scale, c->format, c->use.x, c->use.w));
+				o += roi_len;
+			}
+			y += c->scale;
+		}
+		SIM_CHECK(o == pkt + len);
+		packets++;
+		SIM_CHECK((pkt[9] == PICTURE_FOVEA_LAST) == (y >= c->height));
+		/*下一条放不进本包才换包*/
+		in = y >= c->use.y && y < c->use.y + c->use.h && c->use.w;
+		SIM_CHECK(y >= c->height || pkt[8] == 255 || len + coarse_len + (in ? roi_len : 0) > PICTURE_PACKET_MAX);
+	}
+	SIM_CHECK(y == c->height);
+	SIM_CHECK(sim_fifo_clocks - clocks == frame_bytes);
+	SIM_CHECK(sim_fifo_rp == frame_bytes + 1);
+	printf("  fovea %-9s %3ux%-3u %-6s /%u ROI (%u,%u,%u,%u) -> (%u,%u,%u,%u), %u packets\n",
+	       c->name, c->width, c->height, (c->format == OV7725_FORMAT_GRAY) ? "gray" : "RGB565", c->scale,
+	       c->set.x, c->set.y, c->set.w, c->set.h, c->use.x, c->use.y, c->use.w, c->use.h, packets);
+}
+
+static void test_fovea(void)
+{
+	static const FOVEA_CASE cases[] = {
+		{320, 240, OV7725_FORMAT_RGB565, 2, {  0,   0,    0,    0}, {  0,   0,   0,   0}, "none"},
+		{320, 240, OV7725_FORMAT_RGB565, 4, { 10,  10,  100,    2}, {  8,   8, 100,   0}, "none"},
+		{320, 240, OV7725_FORMAT_RGB565, 2, { 96,  72,  128,   96}, { 96,  72, 128,  96}, "partial"},
+		{320, 240, OV7725_FORMAT_GRAY,   4, { 98,  75,  101,   50}, { 96,  72, 100,  48}, "partial"},
+		{320, 240, OV7725_FORMAT_RGB565, 4, {300, 200,  100,  100}, {300, 200,  20,  40}, "clipped"},
+		{320, 240, OV7725_FORMAT_GRAY,   2, {400, 300,   16,   16}, {320, 240,   0,   0}, "outside"},
+		{320, 240, OV7725_FORMAT_RGB565, 2, {  0,   0,  320,  240}, {  0,   0, 280, 240}, "oversize"},
+		{640, 300, OV7725_FORMAT_RGB565, 4, {  0,   0,  640,  300}, {  0,   0, 140, 300}, "oversize"},
+		{640, 300, OV7725_FORMAT_GRAY,   2, {100, 100, 1000, 1000}, {100, 100, 540, 200}, "clipped"},
+		{100,  76, OV7725_FORMAT_GRAY,   2, {  0,   0,  100,   76}, {  0,   0, 100,  76}, "full"},
+	};
+	uint32_t i;
+
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)sim_rand();
+	for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+		check_fovea(&cases[i]);
+	picture_fovea = 0;
+}
+
+static void bench(void)
+{
+	uint64_t t, t_bin[2] = {~0ull, ~0ull}, t_raw = ~0ull;
+	uint16_t y;
+	int r, k;
+
+	sim_fifo_bench = 1;
+	for(r = 0; r < 5; r++)
+	{
+		for(k = 0; k < 2; k++)
+		{
+			t = sim_ns();
+			for(y = 0; y < 240; y += 2 << k)
+				OV7725_ReadBinned(out, 320, (uint8_t)(2 << k), OV7725_FORMAT_RGB565);
+			t = sim_ns() - t;
+			if(t < t_bin[k])
+				t_bin[k] = t;
+		}
+		t = sim_ns();
+		for(y = 0; y < 240; y += 2)
+			OV7725_ReadLines(raw, 320, 2);
+		t = sim_ns() - t;
+		if(t < t_raw)
+			t_raw = t;
+	}
+	sim_fifo_bench = 0;
+	printf("  bench (host, QVGA RGB565 frame, best of 5):\n");
+	printf("    OV7725_ReadLines      %.2f ns/input byte\n", (double)t_raw / 153600);
+	printf("    OV7725_ReadBinned 2x2 %.2f ns/input byte (%.2fx ReadLines)\n", (double)t_bin[0] / 153600, (double)t_bin[0] / t_raw);
+	printf("    OV7725_ReadBinned 4x4 %.2f ns/input byte (%.2fx ReadLines)\n", (double)t_bin[1] / 153600, (double)t_bin[1] / t_raw);
+}
+
+int main(void)
+{
+	sim_init();
+	sim_srand(8);
+	test_ref();
+	test_roi();
+	test_fovea();
+	bench();
+	return sim_done("test_binning");
+}
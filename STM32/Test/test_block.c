@@ -0,0 +1,339 @@
+/**
+  ******************************************************************************
+  * @file    test_block.c
+  * @brief   按块条件刷新：签名、门限、块包往返，合成序列上的流量和画质
+  ******************************************************************************
+  * @attention
+  *
+  * block.c原样编译。签名与直接按子块求均值的结果比较，块包经
+  * PictureBlock_Put打包、PictureBlock_Apply贴回必须与原图相同，
+  * 错误的块包返回0。
+  *
+  * 回放：按image.c中PictureBlockPack的做法（门限、整帧刷新周期取app_cfg.h，
+  * 每包块数按包长算）发送300帧合成的QVGA RGB565序列，接收端用
+  * PictureBlock_Apply拼帧，统计发出的字节占原始数据的比例，以及接收端
+  * 画面相对无噪声场景的PSNR，与每帧都整帧发送时比较。序列是合成的，
+  * 不是实拍的
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include <math.h>
+#include "sim.h"
+#include "block.h"
+#include "app_cfg.h"
+
+
+#define W                   320
+#define H                   240
+#define COLS                ((W + BLOCK_SIZE - 1) / BLOCK_SIZE)
+#define ROWS                ((H + BLOCK_SIZE - 1) / BLOCK_SIZE)
+#define PKT_MAX             (APP_CFG_PICTURE_MTU & ~3)
+#define FRAMES              300
+
+static uint8_t pkt[PKT_MAX];
+
+static uint8_t luma(const uint8_t *p, uint8_t pix)
+{
+	uint16_t v = (p[0] << 8) | p[1];
+
+	if(pix != BLOCK_PIX_RGB565)
+		return p[0];
+	return (uint8_t)(((v >> 11) + ((v >> 5) & 0x3f) + (v & 0x1f)) * 2);
+}
+
+/*参考：4个8x8子块各自求均值，块不满16时按实际像素数*/
+static void sign_ref(const uint8_t *p, uint16_t stride, uint8_t bw, uint8_t bh, uint8_t pix, uint8_t *sig)
+{
+	uint32_t sum[4] = {0, 0, 0, 0}, n[4] = {0, 0, 0, 0};
+	uint8_t x, y, q;
+
+	for(y = 0; y < bh; y++)
+		for(x = 0; x < bw; x++)
+		{
+			q = (uint8_t)((y >= 8) * 2 + (x >= 8));
+			sum[q] += luma(p + (uint32_t)y * stride + x * BLOCK_BPP(pix), pix);
+			n[q]++;
+		}
+	for(q = 0; q < 4; q++)
+		sig[q] = (uint8_t)(n[q] ? sum[q] / n[q] : 0);
+}
+
+static void test_sign(void)
+{
+	static const uint8_t size[] = {1, 7, 8, 9, 15, 16};
+	static uint8_t buf[BLOCK_SIZE * 40 * 2];
+	uint8_t sig[BLOCK_SIG_LEN], ref[BLOCK_SIG_LEN], pix;
+	uint32_t i;
+	int a, b, r;
+
+	for(pix = 0; pix < 3; pix++)
+		for(a = 0; a < (int)sizeof(size); a++)
+			for(b = 0; b < (int)sizeof(size); b++)
+				for(r = 0; r < 20; r++)
+				{
+					for(i = 0; i < sizeof(buf); i++)
+						buf[i] = (r & 1) ? (uint8_t)sim_rand() : 0xFF;
+					PictureBlock_Sign(buf + 6, 40 * 2, size[a], size[b], pix, sig);
+					sign_ref(buf + 6, 40 * 2, size[a], size[b], pix, ref);
+					SIM_CHECK(memcmp(sig, ref, BLOCK_SIG_LEN) == 0);
+				}
+}
+
+static void test_changed(void)
+{
+	uint8_t sig[BLOCK_SIG_LEN] = {100, 100, 100, 100}, ref[BLOCK_SIG_LEN];
+	uint8_t i;
+
+	for(i = 0; i < BLOCK_SIG_LEN; i++)
+	{
+		memcpy(ref, sig, sizeof(ref));
+		ref[i] = 104;
+		SIM_CHECK(PictureBlock_Changed(sig, ref, 4) == 0);      /* 等于门限不发 */
+		ref[i] = 105;
+		SIM_CHECK(PictureBlock_Changed(sig, ref, 4) == 1);
+		ref[i] = 95;
+		SIM_CHECK(PictureBlock_Changed(sig, ref, 4) == 1);
+		ref[i] = 0;
+		SIM_CHECK(PictureBlock_Changed(sig, ref, 255) == 0);
+	}
+}
+
+/*整帧所有块打成块包再贴回；宽高不是16的倍数，右边、下边是窄块*/
+static void test_put_apply(void)
+{
+	static uint8_t src[328 * 250 * 2], dst[328 * 250 * 2];
+	const uint16_t w = 328, h = 250;
+	uint16_t len, bx, by, cols = (w + 15) / 16, rows = (h + 15) / 16, blocks = 0;
+	uint8_t bpp, cap, count, bw, bh;
+	uint32_t i;
+
+	for(bpp = 1; bpp <= 2; bpp++)
+	{
+		for(i = 0; i < sizeof(src); i++)
+			src[i] = (uint8_t)sim_rand();
+		memset(dst, 0, sizeof(dst));
+		cap = (uint8_t)((PKT_MAX - BLOCK_HEAD_LEN) / (2 + BLOCK_SIZE * BLOCK_SIZE * bpp));
+		blocks = 0;
+		for(by = 0; by < rows; by++)
+		{
+			bh = (uint8_t)((h - by * 16 < 16) ? h - by * 16 : 16);
+			count = 0;
+			len = BLOCK_HEAD_LEN;
+			for(bx = 0; bx < cols; bx++)
+			{
+				bw = (uint8_t)((w - bx * 16 < 16) ? w - bx * 16 : 16);
+				len += PictureBlock_Put(pkt + len, src + ((uint32_t)by * 16 * w + bx * 16) * bpp, w * bpp,
+				                        (uint8_t)bx, (uint8_t)by, bw, bh, bpp);
+				SIM_CHECK(len <= PKT_MAX);
+				if(++count == cap || bx == cols - 1)
+				{
+					pkt[0] = 0x55; pkt[1] = 0xAA; pkt[2] = 'B'; pkt[3] = count;
+					SIM_CHECK(PictureBlock_Apply(pkt, len, dst, w, h, bpp) == count);
+					blocks += count;
+					count = 0;
+					len = BLOCK_HEAD_LEN;
+				}
+			}
+		}
+		SIM_CHECK(blocks == cols * rows);
+		SIM_CHECK(memcmp(src, dst, (uint32_t)w * h * bpp) == 0);
+	}
+
+	/*错误的块包：包头、截短、多余字节、块号越界、块数多了*/
+	bpp = 2;
+	len = BLOCK_HEAD_LEN + PictureBlock_Put(pkt + BLOCK_HEAD_LEN, src, w * bpp, 20, 15, 8, 10, bpp);
+	pkt[0] = 0x55; pkt[1] = 0xAA; pkt[2] = 'B'; pkt[3] = 1;
+	SIM_CHECK(PictureBlock_Apply(pkt, len, dst, w, h, bpp) == 1);
+	SIM_CHECK(PictureBlock_Apply(pkt, len - 1, dst, w, h, bpp) == 0);
+	SIM_CHECK(PictureBlock_Apply(pkt, len + 1, dst, w, h, bpp) == 0);
+	SIM_CHECK(PictureBlock_Apply(pkt, 2, dst, w, h, bpp) == 0);
+	pkt[3] = 2;
+	SIM_CHECK(PictureBlock_Apply(pkt, len, dst, w, h, bpp) == 0);
+	pkt[3] = 1;
+	pkt[BLOCK_HEAD_LEN] = 21;
+	SIM_CHECK(PictureBlock_Apply(pkt, len, dst, w, h, bpp) == 0);
+	pkt[BLOCK_HEAD_LEN] = 20;
+	pkt[2] = 'C';
+	SIM_CHECK(PictureBlock_Apply(pkt, len, dst, w, h, bpp) == 0);
+}
+
+
+/********************************** 回放 **********************************/
+
+static double scene[H][W][3];       /* 无噪声场景，通道值（R5 G6 B5的刻度） */
+static uint8_t cur[W * H * 2];      /* 读出的一帧（含噪声） */
+static uint8_t rx[W * H * 2];       /* 接收端的画面 */
+static uint8_t sig_tab[ROWS * COLS][BLOCK_SIG_LEN];
+
+static float gauss_tab[65536];      /* 标准正态分布样本，按随机下标取用 */
+
+static void gauss_init(void)
+{
+	double u1, u2;
+	uint32_t i;
+
+	for(i = 0; i < 65536; i++)
+	{
+		u1 = (sim_rand() + 1.0) / 4294967297.0;
+		u2 = sim_rand() / 4294967296.0;
+		gauss_tab[i] = (float)(sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2));
+	}
+}
+
+static double gauss(void)
+{
+	return gauss_tab[sim_rand() >> 16];
+}
+
+/*静止背景（渐变加方格纹理），亮度乘gain，move>=0时叠加一个40x40的运动物体*/
+static void make_scene(int frame, double gain, int move)
+{
+	int x, y, ox = -100, oy = 100;
+
+	if(move >= 0)
+	{
+		ox = (frame * move) % (2 * (W - 40));
+		if(ox > W - 40)
+			ox = 2 * (W - 40) - ox;
+	}
+	for(y = 0; y < H; y++)
+		for(x = 0; x < W; x++)
+		{
+			double t = (((x / 20) + (y / 20)) & 1) ? 3.0 : 0.0;
+
+			if(x >= ox && x < ox + 40 && y >= oy && y < oy + 40)
+			{
+				scene[y][x][0] = 26 - ((x - ox) & 7);
+				scene[y][x][1] = 12 + ((y - oy) & 15);
+				scene[y][x][2] = 6;
+				continue;
+			}
+			scene[y][x][0] = (6 + 16.0 * x / W + t) * gain;
+			scene[y][x][1] = (12 + 32.0 * y / H + t * 2) * gain;
+			scene[y][x][2] = (20 - 10.0 * x / W + t) * gain;
+		}
+}
+
+static void capture(double sigma)
+{
+	static const int max[3] = {31, 63, 31};
+	int x, y, c, v[3];
+
+	for(y = 0; y < H; y++)
+		for(x = 0; x < W; x++)
+		{
+			for(c = 0; c < 3; c++)
+			{
+				v[c] = (int)floor(scene[y][x][c] + sigma * gauss() * (c == 1 ? 2 : 1) + 0.5);
+				v[c] = v[c] < 0 ? 0 : (v[c] > max[c] ? max[c] : v[c]);
+			}
+			cur[(y * W + x) * 2] = (uint8_t)((v[0] << 3) | (v[1] >> 3));
+			cur[(y * W + x) * 2 + 1] = (uint8_t)((v[1] << 5) | v[2]);
+		}
+}
+
+/*接收画面相对无噪声场景的PSNR，各通道按8位刻度*/
+static double psnr(const uint8_t *img)
+{
+	static const double scale[3] = {255.0 / 31, 255.0 / 63, 255.0 / 31};
+	double mse = 0, d;
+	int x, y;
+	uint16_t p;
+
+	for(y = 0; y < H; y++)
+		for(x = 0; x < W; x++)
+		{
+			p = (uint16_t)((img[(y * W + x) * 2] << 8) | img[(y * W + x) * 2 + 1]);
+			d = ((p >> 11) - scene[y][x][0]) * scale[0];
+			mse += d * d;
+			d = (((p >> 5) & 63) - scene[y][x][1]) * scale[1];
+			mse += d * d;
+			d = ((p & 31) - scene[y][x][2]) * scale[2];
+			mse += d * d;
+		}
+	mse /= W * H * 3;
+	return 10 * log10(255.0 * 255.0 / mse);
+}
+
+/*按PictureBlockPack发一帧，返回发出的字节数*/
+static uint32_t send_frame(int refresh)
+{
+	const uint8_t cap = (PKT_MAX - BLOCK_HEAD_LEN) / (2 + BLOCK_SIZE * BLOCK_SIZE * 2);
+	uint8_t sig[BLOCK_SIG_LEN], bw, bh, count;
+	uint16_t bx, by, len;
+	uint32_t bytes = BLOCK_END_LEN;
+
+	for(by = 0; by < ROWS; by++)
+	{
+		bh = (uint8_t)((H - by * BLOCK_SIZE < BLOCK_SIZE) ? H - by * BLOCK_SIZE : BLOCK_SIZE);
+		count = 0;
+		len = BLOCK_HEAD_LEN;
+		for(bx = 0; bx < COLS; bx++)
+		{
+			const uint8_t *p = cur + ((uint32_t)by * BLOCK_SIZE * W + bx * BLOCK_SIZE) * 2;
+
+			bw = (uint8_t)((W - bx * BLOCK_SIZE < BLOCK_SIZE) ? W - bx * BLOCK_SIZE : BLOCK_SIZE);
+			PictureBlock_Sign(p, W * 2, bw, bh, BLOCK_PIX_RGB565, sig);
+			if(refresh)
+			{
+				memcpy(sig_tab[by * COLS + bx], sig, BLOCK_SIG_LEN);
+				continue;
+			}
+			if(PictureBlock_Changed(sig, sig_tab[by * COLS + bx], APP_CFG_PICTURE_BLOCK_THRESH))
+			{
+				memcpy(sig_tab[by * COLS + bx], sig, BLOCK_SIG_LEN);
+				len += PictureBlock_Put(pkt + len, p, W * 2, (uint8_t)bx, (uint8_t)by, bw, bh, 2);
+				count++;
+			}
+			if(count && (count == cap || bx == COLS - 1))
+			{
+				pkt[0] = 0x55; pkt[1] = 0xAA; pkt[2] = 'B'; pkt[3] = count;
+				SIM_CHECK(PictureBlock_Apply(pkt, len, rx, W, H, 2) == count);
+				bytes += len;
+				count = 0;
+				len = BLOCK_HEAD_LEN;
+			}
+		}
+	}
+	if(refresh)
+	{
+		memcpy(rx, cur, sizeof(rx));
+		bytes += sizeof(cur);
+	}
+	return bytes;
+}
+
+static void replay(const char *name, double sigma, double drift, int move)
+{
+	double q_blk = 0, q_full = 0;
+	uint64_t bytes = 0;
+	int f;
+
+	for(f = 0; f < FRAMES; f++)
+	{
+		make_scene(f, 1.0 + drift * f / FRAMES, move);
+		capture(sigma);
+		bytes += send_frame(f % APP_CFG_PICTURE_BLOCK_REFRESH == 0);
+		q_blk += psnr(rx);
+		q_full += psnr(cur);
+	}
+	printf("  %-28s %5.1f%% of raw  %5.1f dB (full %5.1f)\n", name,
+	       100.0 * bytes / ((double)FRAMES * sizeof(cur)), q_blk / FRAMES, q_full / FRAMES);
+}
+
+int main(void)
+{
+	sim_srand(16);
+	test_sign();
+	test_changed();
+	test_put_apply();
+	gauss_init();
+	printf("  %d frames QVGA RGB565, thresh %d, refresh every %d frames:\n", FRAMES,
+	       APP_CFG_PICTURE_BLOCK_THRESH, APP_CFG_PICTURE_BLOCK_REFRESH);
+	replay("static, noise 0.5 LSB", 0.5, 0, -1);
+	replay("static + 15% drift, noise 0.5", 0.5, 0.15, -1);
+	replay("moving object, noise 1", 1.0, 0, 2);
+	replay("moving object, noise 2", 2.0, 0, 2);
+	return sim_done("test_block");
+}
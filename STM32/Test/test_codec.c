@@ -0,0 +1,273 @@
+/**
+  ******************************************************************************
+  * @file    test_codec.c
+  * @brief   RGB565包编解码：往返无损、转义码、行首预测、输出缓冲满，压缩率和主机速度
+  ******************************************************************************
+  * @attention
+  *
+  * codec.c原样编译。每包2行，编码后必须逐字节解回原数据；
+  * 压缩后不比原始小、或out_max放不下时返回0，且不写出out_max。
+  *
+  * 压缩率在合成的QVGA图上统计，速度是主机上的ns/像素，
+  * 目标板上的周期数看picture_codec_stat
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include "sim.h"
+#include "codec.h"
+
+
+#define W                   320
+#define H                   240
+#define GUARD               16
+
+static uint8_t img[W * H * 2];
+static uint8_t enc[W * 4 + GUARD];
+static uint8_t dec[W * 4 + GUARD];
+
+static void put_px(uint8_t *buf, uint32_t i, uint16_t p)
+{
+	buf[i * 2] = (uint8_t)(p >> 8);
+	buf[i * 2 + 1] = (uint8_t)p;
+}
+
+static uint16_t rgb(int r, int g, int b)
+{
+	r = r < 0 ? 0 : (r > 31 ? 31 : r);
+	g = g < 0 ? 0 : (g > 63 ? 63 : g);
+	b = b < 0 ? 0 : (b > 31 ? 31 : b);
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/*近似正态分布（12个均匀分布相加），均值0，标准差sigma*/
+static int noise(int sigma)
+{
+	int i, s = 0;
+
+	for(i = 0; i < 12; i++)
+		s += (int)(sim_rand() & 0xffff);
+	return (int)(((int64_t)(s - 6 * 65536) * sigma) / 65536);
+}
+
+/*编一包再解回，检查往返；返回压缩后长度，0为发原始数据*/
+static uint16_t round_trip(const uint8_t *in, uint16_t width, uint16_t out_max)
+{
+	uint16_t n, raw = width * 4;
+
+	memset(enc, 0xEE, sizeof(enc));
+	n = PictureCodec_Encode(in, width, enc, out_max);
+	SIM_CHECK(n < raw);
+	SIM_CHECK(n <= out_max);
+	SIM_CHECK(enc[out_max < raw ? out_max : raw - 1] == 0xEE || n == 0);
+	if(n == 0)
+		return 0;
+	SIM_CHECK(n > CODEC_HEAD_LEN);
+	memset(dec, 0xEE, sizeof(dec));
+	SIM_CHECK(PictureCodec_Decode(enc, n, width, dec) == raw);
+	SIM_CHECK(memcmp(dec, in, raw) == 0);
+	SIM_CHECK(dec[raw] == 0xEE);
+	return n;
+}
+
+static void test_round_trip(void)
+{
+	static const uint16_t width[] = {1, 2, 3, 8, 160, 320};
+	uint8_t pkt[W * 4];
+	uint32_t i;
+	int w, r, fallback = 0;
+
+	for(w = 0; w < (int)(sizeof(width) / sizeof(width[0])); w++)
+	{
+		for(r = 0; r < 200; r++)
+		{
+			uint16_t base = (uint16_t)sim_rand();
+			int sigma = r % 8;
+
+			for(i = 0; i < width[w] * 2u; i++)
+			{
+				switch(r % 4)
+				{
+					case 0:  put_px(pkt, i, (uint16_t)sim_rand()); break;         /* 随机 */
+					case 1:  put_px(pkt, i, base); break;                         /* 常数 */
+					case 2:  put_px(pkt, i, (sim_rand() & 1) ? 0x0000 : 0xFFFF); break;
+					default: put_px(pkt, i, rgb(((base >> 11) & 31) + noise(sigma), ((base >> 5) & 63) + noise(sigma),
+					                            (base & 31) + noise(sigma))); break;
+				}
+			}
+			if(round_trip(pkt, width[w], sizeof(enc) - GUARD) == 0)
+				fallback++;
+		}
+	}
+	SIM_CHECK(fallback > 0);            /* 随机数据应当发原始 */
+
+	/*第1行行首用中间值，第2行行首用上方像素：行首与预测值差最大的情况*/
+	for(i = 0; i < W * 2; i++)
+		put_px(pkt, i, 0x8410);
+	put_px(pkt, 0, 0x0000);
+	put_px(pkt, W, 0xFFFF);
+	put_px(pkt, W + 1, 0x0000);
+	SIM_CHECK(round_trip(pkt, W, sizeof(enc) - GUARD) != 0);
+	put_px(pkt, 0, 0xFFFF);
+	put_px(pkt, W, 0x0000);
+	put_px(pkt, W - 1, 0x0000);
+	SIM_CHECK(round_trip(pkt, W, sizeof(enc) - GUARD) != 0);
+}
+
+/*读码流第pos位起的n位*/
+static uint32_t bits_at(const uint8_t *p, uint32_t pos, uint8_t n)
+{
+	uint32_t v = 0;
+
+	while(n--)
+	{
+		v = (v << 1) | ((p[pos >> 3] >> (7 - (pos & 7))) & 1);
+		pos++;
+	}
+	return v;
+}
+
+/*转义：全为中间值(R16 G32 B16)，第6个像素为0。前5个像素残差为0，
+  各通道k已降到0（第1个像素k=1，每通道2位，之后每通道1位），共18个0；
+  第6个像素R残差-16折成31，商31>=CODEC_QMAX，写16个1再写5位原值，G、B同样*/
+static void test_escape(void)
+{
+	uint8_t pkt[16 * 4];
+	uint16_t n;
+	uint32_t i, pos;
+
+	for(i = 0; i < 32; i++)
+		put_px(pkt, i, 0x8410);
+	put_px(pkt, 5, 0x0000);
+	n = round_trip(pkt, 16, sizeof(enc) - GUARD);
+	SIM_CHECK(n != 0);
+	pos = CODEC_HEAD_LEN * 8;
+	SIM_CHECK(bits_at(enc, pos, 18) == 0);
+	pos += 18;
+	SIM_CHECK(bits_at(enc, pos, CODEC_QMAX) == (1u << CODEC_QMAX) - 1);
+	SIM_CHECK(bits_at(enc, pos + CODEC_QMAX, 5) == 31);
+	pos += CODEC_QMAX + 5;
+	SIM_CHECK(bits_at(enc, pos, CODEC_QMAX) == (1u << CODEC_QMAX) - 1);
+	SIM_CHECK(bits_at(enc, pos + CODEC_QMAX, 6) == 63);
+	pos += CODEC_QMAX + 6;
+	SIM_CHECK(bits_at(enc, pos, CODEC_QMAX) == (1u << CODEC_QMAX) - 1);
+	SIM_CHECK(bits_at(enc, pos + CODEC_QMAX, 5) == 31);
+
+	/*商为CODEC_QMAX-1时仍用一元码：15个1、1个0*/
+	put_px(pkt, 5, 0x8410 - (8u << 11));   /* R残差-8折成15，k=0 */
+	n = round_trip(pkt, 16, sizeof(enc) - GUARD);
+	SIM_CHECK(n != 0);
+	SIM_CHECK(bits_at(enc, CODEC_HEAD_LEN * 8 + 18, CODEC_QMAX) == (1u << CODEC_QMAX) - 2);
+}
+
+/*输出缓冲：刚好放得下的长度成功，少1字节返回0，不写出out_max*/
+static void test_full(void)
+{
+	uint8_t pkt[W * 4];
+	uint16_t n, m;
+	uint32_t i;
+
+	for(i = 0; i < W * 2; i++)
+		put_px(pkt, i, rgb(i % 32, (i / 4) % 64, 31 - i % 32));
+	n = round_trip(pkt, W, sizeof(enc) - GUARD);
+	SIM_CHECK(n != 0);
+	SIM_CHECK(round_trip(pkt, W, n) == n);
+	for(m = 0; m < n; m++)
+		SIM_CHECK(round_trip(pkt, W, m) == 0);
+
+	/*截短、包头错误的码流解码返回0*/
+	n = PictureCodec_Encode(pkt, W, enc, sizeof(enc) - GUARD);
+	for(m = 0; m < n; m += 7)
+		SIM_CHECK(PictureCodec_Decode(enc, m, W, dec) == 0);
+	enc[2] = 'X';
+	SIM_CHECK(PictureCodec_Decode(enc, n, W, dec) == 0);
+	enc[2] = 'C';
+	SIM_CHECK(PictureCodec_Decode(enc, n, W / 2, dec) == 0);
+}
+
+/*合成图*/
+static void make_image(int kind)
+{
+	uint32_t x, y;
+	static const uint16_t bars[8] = {0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000};
+
+	for(y = 0; y < H; y++)
+		for(x = 0; x < W; x++)
+		{
+			uint16_t p;
+
+			switch(kind)
+			{
+				case 0:  p = bars[x * 8 / W]; break;
+				case 1:  p = rgb((int)(x * 32 / W), (int)((x + y) * 64 / (W + H)), (int)(y * 32 / H)); break;
+				case 2:  p = rgb(16 + noise(1), 32 + noise(1), 16 + noise(1)); break;
+				case 3:  p = rgb(16 + noise(3), 32 + noise(3), 16 + noise(3)); break;
+				default: p = (uint16_t)sim_rand(); break;
+			}
+			put_px(img, y * W + x, p);
+		}
+}
+
+/*整幅图按包编码一遍，统计字节数和时间*/
+static void code_image(uint32_t *out, uint32_t *raw_pkts, uint64_t *t_enc, uint64_t *t_dec)
+{
+	uint64_t t;
+	uint16_t n;
+	int y;
+
+	*out = *raw_pkts = 0;
+	*t_enc = *t_dec = 0;
+	for(y = 0; y < H; y += 2)
+	{
+		t = sim_ns();
+		n = PictureCodec_Encode(img + y * W * 2, W, enc, sizeof(enc) - GUARD);
+		*t_enc += sim_ns() - t;
+		if(n == 0)
+		{
+			*out += W * 4;
+			(*raw_pkts)++;
+			continue;
+		}
+		*out += n;
+		t = sim_ns();
+		SIM_CHECK(PictureCodec_Decode(enc, n, W, dec) == W * 4);
+		*t_dec += sim_ns() - t;
+		SIM_CHECK(memcmp(dec, img + y * W * 2, W * 4) == 0);
+	}
+}
+
+static void bench(void)
+{
+	static const char *name[] = {"color bars", "smooth gradient", "noise sigma=1", "noise sigma=3", "uniform random"};
+	uint64_t t_enc, t_dec, best_enc, best_dec;
+	uint32_t out, raw_pkts;
+	int kind, r;
+
+	printf("  host, QVGA in 2-line packets, best of 5:\n");
+	printf("  %-16s %7s %8s %8s %9s %9s\n", "corpus", "ratio", "bit/px", "raw pkt", "enc ns/px", "dec ns/px");
+	for(kind = 0; kind < 5; kind++)
+	{
+		make_image(kind);
+		best_enc = best_dec = ~0ull;
+		for(r = 0; r < 5; r++)
+		{
+			code_image(&out, &raw_pkts, &t_enc, &t_dec);
+			if(t_enc < best_enc)
+				best_enc = t_enc;
+			if(t_dec < best_dec)
+				best_dec = t_dec;
+		}
+		printf("  %-16s %6.2f:1 %8.2f %5u/%u %9.1f %9.1f\n", name[kind], (double)(W * H * 2) / out, out * 8.0 / (W * H),
+		       (unsigned)raw_pkts, H / 2, (double)best_enc / (W * H), (double)best_dec / (W * H));
+	}
+}
+
+int main(void)
+{
+	sim_srand(15);
+	test_escape();
+	test_round_trip();
+	test_full();
+	bench();
+	return sim_done("test_codec");
+}
@@ -0,0 +1,664 @@
+/**
+  ******************************************************************************
+  * @file    test_fifo_dma.c
+  * @brief   TIM8+DMA读FIFO的主机模型：功能、时序余量和读出速度
+  ******************************************************************************
+  * @attention
+  *
+  * bsp_ov7725_dma.c原样编译，任务在OV7725_DMA_Wait里挂起时由本文件的
+  * 硬件模型按寄存器内容推进：TIM8计数，CC1/CC2/更新事件向DMA2请求，
+  * DMA2按优先级一次搬一个，数据通道从模型的AL422B读出口取值（按字读IDR，
+  * 低8位和高16位填随机数），RCLK通道改引脚电平，拉高时FIFO读指针前进。
+  * RCLK拉高通道传完后经过中断延迟调用OV7725_DMA_ISR。
+  * bsp_ov7725.c按OV7725_READ_SRC_DMA=1编译，只留Y、合并、隔列、RGB332
+  * 也从DMA读进的行缓冲取数据，结果与按FIFO内容直接算的相同，RCLK数正好
+  *
+  * 时间单位为72MHz的时钟周期。AL422B读时序取数据手册的交流参数，
+  * DMA响应延迟、中断和任务切换开销是估计值，都在下面的宏里，
+  * 时序扫描给出在多大的额外总线延迟下仍然没有违例
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include "sim.h"
+#include "./ov7725/bsp_ov7725.h"
+#include "./ov7725/bsp_ov7725_dma.h"
+
+
+#define SIM_NS(t)           ((double)(t) * 1000.0 / 72.0)    /* 周期 -> ns */
+
+/*AL422B读口时序（ns）*/
+#define FIFO_T_AC           15.0        /* RCLK上升沿到数据有效 */
+#define FIFO_T_OH           4.0         /* RCLK上升沿后旧数据保持 */
+#define FIFO_T_PW           7.0         /* RCLK高、低电平最小宽度 */
+#define FIFO_T_RC           20.0        /* 读周期最小值 */
+
+/*STM32F103（估计值）*/
+#define DMA_LAT_MIN         2           /* 请求到总线访问：仲裁+地址+APB桥 */
+#define DMA_LAT_MAX         5
+#define DMA_XFER            2           /* 一次传输占用DMA的周期 */
+#define GPIO_SYNC           1           /* IDR比引脚晚一个APB2周期 */
+#define IRQ_LAT             60          /* 传输完成到中断里停下定时器 */
+#define TASK_GAP            400         /* 中断、任务切换、启动下一段（约5.6us） */
+
+#define FIFO_LEN            (64 * 1024)
+
+typedef struct
+{
+	DMA_Channel_TypeDef *ch;
+	uint16_t             de;        /* TIM8_DIER里的DMA请求使能位 */
+	uint16_t             flag;      /* TIM8_SR里的事件标志 */
+	uint8_t              pending;   /* 已请求还没响应 */
+	uint16_t             start;     /* 本段启动时的传输数目 */
+	int64_t              req_t;
+}SIM_REQ;
+
+static SIM_REQ req[3];              /* 0:CC1数据 1:CC2拉低 2:更新拉高 */
+
+static uint8_t  fifo[FIFO_LEN];     /* FIFO里的数据流 */
+static uint32_t rp;                 /* 读指针：口上输出fifo[rp] */
+static int64_t  t_now;              /* 模型时间 */
+static int64_t  t_rise = -1000;     /* 上次RCLK上升沿 */
+static int64_t  t_fall = -1000;
+static int64_t  dma_free;           /* DMA2下一次能开始传输的时刻 */
+static uint32_t lat_extra[3];       /* 扫描用：某个通道额外的总线延迟 */
+static uint8_t  rclk_pin_state = 1;
+static uint8_t  stall;              /* 置1模拟定时器不走（测超时） */
+
+static uint32_t rises, samples, violations, lost, irqs;
+static double   setup_min, high_min, low_min, cycle_min;
+static int64_t  t_busy;             /* 读出占用的总时间 */
+
+
+/************************************************
+ * 函数名：fifo_sample
+ * 描述  ：在t时刻读IDR：数据口在bit8~15，其余位是别的引脚
+ ************************************************/
+static uint32_t fifo_sample(int64_t t)
+{
+	double  pin = SIM_NS(t - GPIO_SYNC - t_rise);   /* 引脚被采进IDR的时刻距上升沿 */
+	uint8_t data;
+
+	if(rises && pin < FIFO_T_OH)
+		data = fifo[(rp - 1) % FIFO_LEN];           /* 旧数据还在 */
+	else
+		data = fifo[rp % FIFO_LEN];
+	if(rises && pin >= FIFO_T_OH && pin < FIFO_T_AC)
+		violations++;                               /* 采在数据变化的窗口里 */
+	if(rises && pin - FIFO_T_AC < setup_min)
+		setup_min = pin - FIFO_T_AC;
+	samples++;
+	return (sim_rand() & 0xffff00ffu) | ((uint32_t)data << 8);
+}
+
+/************************************************
+ * 函数名：rclk_edge
+ * 描述  ：RCLK引脚在t时刻变为level
+ ************************************************/
+static void rclk_edge(int64_t t, uint8_t level)
+{
+	if(level == rclk_pin_state)
+		return;
+	rclk_pin_state = level;
+	if(level)
+	{
+		if(SIM_NS(t - t_fall) < low_min)
+			low_min = SIM_NS(t - t_fall);
+		if(rises && SIM_NS(t - t_rise) < cycle_min)
+			cycle_min = SIM_NS(t - t_rise);
+		t_rise = t;
+		rp++;
+		rises++;
+	}
+	else
+	{
+		if(SIM_NS(t - t_rise) < high_min)
+			high_min = SIM_NS(t - t_rise);
+		t_fall = t;
+	}
+}
+
+/************************************************
+ * 函数名：dma_xfer
+ * 描述  ：通道按寄存器配置在t时刻搬一次
+ * 输出  ：1:这次传完了（计数到0）
+ ************************************************/
+static int dma_xfer(SIM_REQ *r, int64_t t)
+{
+	DMA_Channel_TypeDef *ch = r->ch;
+	uint32_t n = ch->CNDTR;
+	uint32_t idx = r->start - n;        /* 内存地址自增时的下标 */
+	uint32_t v;
+
+	if(ch->CCR & DMA_CCR1_DIR)
+	{
+		/*内存 -> 外设：RCLK通道写BSRR/BRR*/
+		v = *(uint32_t *)(uintptr_t)ch->CMAR;
+		*(uint32_t *)(uintptr_t)ch->CPAR = v;
+		if(ch->CPAR == (uint32_t)(uintptr_t)&OV7725_RCLK_GPIO_PORT->BSRR && (v & OV7725_RCLK_GPIO_PIN))
+			rclk_edge(t, 1);
+		else if(ch->CPAR == (uint32_t)(uintptr_t)&OV7725_RCLK_GPIO_PORT->BRR && (v & OV7725_RCLK_GPIO_PIN))
+			rclk_edge(t, 0);
+	}
+	else
+	{
+		/*外设 -> 内存：按MSIZE截断存放，同硬件*/
+		v = fifo_sample(t);
+		switch(ch->CCR & DMA_CCR1_MSIZE)
+		{
+			case 0:      ((uint8_t  *)(uintptr_t)ch->CMAR)[idx] = (uint8_t)v;  break;
+			case 0x400:  ((uint16_t *)(uintptr_t)ch->CMAR)[idx] = (uint16_t)v; break;
+			default:     ((uint32_t *)(uintptr_t)ch->CMAR)[idx] = v;           break;
+		}
+	}
+	ch->CNDTR = n - 1;
+	return n - 1 == 0;
+}
+
+/************************************************
+ * 函数名：hw_run
+ * 描述  ：推进TIM8和DMA2，直到中断里停下定时器
+ * 注意  ：作为sim_idle在任务挂起时调用
+ ************************************************/
+static void hw_run(void)
+{
+	TIM_TypeDef *tim = OV7725_RCLK_TIM;
+	int64_t  t0, te, t_irq = -1, best_at;
+	uint32_t period, ch_no;
+	int      i, k, best;
+
+	if(stall || !(tim->CR1 & TIM_CR1_CEN))
+		return;
+
+	/*软件清掉的事件标志同时撤销没响应的请求（启动时先清标志再开通道）*/
+	for(i = 0; i < 3; i++)
+	{
+		if(!(tim->SR & req[i].flag))
+			req[i].pending = 0;
+		req[i].start = req[i].ch->CNDTR;
+	}
+
+	t_now += TASK_GAP;
+	t0 = t_now - tim->CNT;
+	period = tim->ARR + 1;
+	k = 0;
+	while(1)
+	{
+		/*下一个定时器事件：CC1、CC2、更新依次出现*/
+		te = t0 + ((k == 0) ? tim->CCR1 : (k == 1) ? tim->CCR2 : period);
+
+		/*DMA2空下来时，已到的请求里按优先级（软件优先级，再按通道号小的）响应*/
+		best = -1;
+		best_at = -1;
+		for(i = 0; i < 3; i++)
+			if(req[i].pending && (req[i].ch->CCR & DMA_CCR1_EN) && req[i].ch->CNDTR &&
+			   (best_at < 0 || req[i].req_t < best_at))
+				best_at = req[i].req_t;
+		if(best_at >= 0 && best_at < dma_free)
+			best_at = dma_free;
+		for(i = 0; i < 3 && best_at >= 0; i++)
+		{
+			if(!req[i].pending || !(req[i].ch->CCR & DMA_CCR1_EN) || req[i].ch->CNDTR == 0 || req[i].req_t > best_at)
+				continue;
+			if(best < 0 || (req[i].ch->CCR & DMA_CCR1_PL) > (req[best].ch->CCR & DMA_CCR1_PL) ||
+			   ((req[i].ch->CCR & DMA_CCR1_PL) == (req[best].ch->CCR & DMA_CCR1_PL) && req[i].ch < req[best].ch))
+				best = i;
+		}
+
+		if(best >= 0 && best_at <= te)
+		{
+			t_now = best_at + DMA_LAT_MIN + sim_rand() % (DMA_LAT_MAX - DMA_LAT_MIN + 1) + lat_extra[best];
+			dma_free = t_now + DMA_XFER;
+			req[best].pending = 0;
+			if(dma_xfer(&req[best], t_now) && (req[best].ch->CCR & DMA_CCR1_TCIE))
+			{
+				ch_no = ((uint32_t)(uintptr_t)req[best].ch - DMA2_Channel1_BASE) / 0x14;
+				DMA2->ISR |= 0x3u << (4 * ch_no);   /* GIF、TCIF */
+				t_irq = t_now + IRQ_LAT;
+			}
+			continue;
+		}
+
+		if(t_irq >= 0 && te >= t_irq)
+			break;
+		tim->SR |= req[k].flag;
+		if(tim->DIER & req[k].de)
+		{
+			if(req[k].pending && req[k].ch->CNDTR)
+				lost++;                             /* 上一个请求还没响应，这个丢了 */
+			req[k].pending = 1;
+			req[k].req_t = te;
+		}
+		if(++k == 3)
+		{
+			k = 0;
+			t0 += period;
+		}
+	}
+
+	/*中断里停定时器、清标志并释放信号量*/
+	t_now = t_irq;
+	tim->CNT = (uint16_t)((t_irq - t0) % period);
+	irqs++;
+	OV7725_DMA_ISR();
+	DMA2->ISR &= ~DMA2->IFCR;
+	DMA2->IFCR = 0;
+	t_busy = t_now;
+}
+
+/************************************************
+ * 函数名：stat_reset
+ ************************************************/
+static void stat_reset(void)
+{
+	violations = 0;
+	samples = 0;
+	lost = 0;
+	setup_min = high_min = low_min = cycle_min = 1e9;
+}
+
+/************************************************
+ * 函数名：fifo_fill
+ * 描述  ：FIFO填随机数，读指针回到0（相当于FIFO_PREPARE）
+ ************************************************/
+static void fifo_fill(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < FIFO_LEN; i++)
+		fifo[i] = (uint8_t)sim_rand();
+	rp = 0;
+	rises = 0;
+	t_rise = t_fall = t_now - 1000;
+}
+
+static uint8_t buf[2048];
+
+/************************************************
+ * 函数名：test_blocks
+ * 描述  ：不同长度连续读出，跨段、跨块都和FIFO内容一致
+ ************************************************/
+static void test_blocks(void)
+{
+	static const uint16_t lens[] = {1, 2, 3, 4, 5, 127, 128, 129, 255, 256, 257, 383, 640, 1280, 1472};
+	uint32_t pos = 0, i;
+	OS_ERR   err;
+
+	fifo_fill();
+	stat_reset();
+	for(i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+	{
+		memset(buf, 0xA5, sizeof(buf));
+		OV7725_DMA_ReadBlock(buf, lens[i], &err);
+		SIM_CHECK(err == OS_ERR_NONE);
+		SIM_CHECK(memcmp(buf, fifo + pos, lens[i]) == 0);
+		SIM_CHECK(buf[lens[i]] == 0xA5);            /* 不多写 */
+		pos += lens[i];
+		SIM_CHECK(rises == pos);                    /* RCLK个数正好 */
+		SIM_CHECK(OV7725_RCLK_GPIO_PORT->BSRR == OV7725_RCLK_GPIO_PIN);
+	}
+	SIM_CHECK(violations == 0);
+	printf("  blocks: %u bytes in %u reads, samples %u, violations %u\n",
+	       (unsigned)pos, (unsigned)i, (unsigned)samples, (unsigned)violations);
+}
+
+/************************************************
+ * 函数名：test_config
+ * 描述  ：数据通道按字访问整个IDR（RM0008：GPIO寄存器只能按字访问），
+ *         存低半字
+ ************************************************/
+static void test_config(void)
+{
+	DMA_Channel_TypeDef *ch = OV7725_DATA_DMA_CHANNEL;
+
+	SIM_CHECK(ch->CPAR == (uint32_t)(uintptr_t)&OV7725_DATA_GPIO_PORT->IDR);
+	SIM_CHECK((ch->CPAR & 3) == 0);
+	SIM_CHECK((ch->CCR & DMA_CCR1_PSIZE) == DMA_CCR1_PSIZE_1);     /* 32位 */
+	SIM_CHECK((ch->CCR & DMA_CCR1_MSIZE) == DMA_CCR1_MSIZE_0);    /* 16位 */
+	SIM_CHECK(ch->CCR & DMA_CCR1_MINC);
+	SIM_CHECK(!(ch->CCR & DMA_CCR1_DIR));
+}
+
+/************************************************
+ * 函数名：test_timeout
+ * 描述  ：定时器不走时超时返回，RCLK留在高电平
+ ************************************************/
+static void test_timeout(void)
+{
+	OS_ERR err;
+
+	stall = 1;
+	OV7725_RCLK_GPIO_PORT->BSRR = 0;
+	OV7725_DMA_ReadBlock(buf, 300, &err);
+	SIM_CHECK(err == OS_ERR_TIMEOUT);
+	SIM_CHECK(!(OV7725_RCLK_TIM->CR1 & TIM_CR1_CEN));
+	SIM_CHECK(OV7725_RCLK_GPIO_PORT->BSRR == OV7725_RCLK_GPIO_PIN);
+	stall = 0;
+}
+
+/************************************************
+ * 函数名：derived_ref
+ * 描述  ：按FIFO内容直接算的参考结果
+ ************************************************/
+static uint8_t y_at(uint32_t pos)
+{
+	return fifo[(pos + OV7725_Y_OFFSET) % FIFO_LEN];
+}
+
+static uint16_t px_at(uint32_t pos)
+{
+	return ((uint16_t)fifo[pos % FIFO_LEN] << 8) | fifo[(pos + 1) % FIFO_LEN];   /* 先读的是高字节 */
+}
+
+/*一个分量：v取0~in_max，输出0~out_max级，m为4x4 Bayer矩阵的值（同test_rgb332）*/
+static uint32_t level(uint32_t v, uint32_t in_max, uint32_t out_max, uint8_t m)
+{
+	uint32_t l = (32 * v * out_max + (2 * m + 1) * in_max) / (32 * in_max);
+
+	return (l > out_max) ? out_max : l;
+}
+
+/*合并：factor行、每factor*factor个像素各分量取平均，四舍五入*/
+static uint16_t bin_ref(uint8_t *o, uint32_t pos, uint16_t width, uint8_t factor, uint8_t format)
+{
+	uint32_t r, g, b, y, area = factor * factor, p;
+	uint16_t ox, x, l;
+
+	for(ox = 0; ox < width / factor; ox++)
+	{
+		r = g = b = y = 0;
+		for(l = 0; l < factor; l++)
+		{
+			for(x = ox * factor; x < (ox + 1) * factor; x++)
+			{
+				p = pos + ((uint32_t)l * width + x) * 2;
+				y += y_at(p);
+				r += px_at(p) >> 11;
+				g += (px_at(p) >> 5) & 0x3f;
+				b += px_at(p) & 0x1f;
+			}
+		}
+		if(format == OV7725_FORMAT_GRAY)
+		{
+			*o++ = (uint8_t)((y + area / 2) / area);
+			continue;
+		}
+		p = (((r + area / 2) / area) << 11) | (((g + area / 2) / area) << 5) | ((b + area / 2) / area);
+		*o++ = (uint8_t)(p >> 8);
+		*o++ = (uint8_t)p;
+	}
+	return (format == OV7725_FORMAT_GRAY) ? width / factor : width / factor * 2;
+}
+
+static uint8_t  out[2048], roi[4096], ref[4096];
+static uint32_t derived_pos, derived_bad;
+
+/*一次读出后：输出与参考相同，RCLK正好走了bytes个，RCLK在高电平*/
+static void derived_check(const uint8_t *got, uint16_t len, uint32_t bytes)
+{
+	derived_pos += bytes;
+	if(memcmp(got, ref, len) != 0)
+		derived_bad++;
+	SIM_CHECK(rises == derived_pos);
+	SIM_CHECK(ov7725_read_err == 0);
+	SIM_CHECK(OV7725_RCLK_GPIO_PORT->BSRR == OV7725_RCLK_GPIO_PIN);
+}
+
+/************************************************
+ * 函数名：test_derived
+ * 描述  ：只留Y、合并、区域合并、隔列、RGB332按DMA方式读，跨段、跨调用
+ ************************************************/
+static void test_derived(void)
+{
+	static const uint16_t widths[] = {640, 320, 160, 16};
+	static const uint16_t ys[] = {2, 6, 160, 320, 642, 1472};
+	uint32_t pos, calls = 0;
+	uint16_t width, n, x, k, len;
+	uint8_t  format, factor, phase, d, line, lines;
+	uint16_t p;
+	int      w, i;
+
+	fifo_fill();
+	stat_reset();
+	derived_pos = 0;
+	derived_bad = 0;
+	for(w = 0; w < (int)(sizeof(widths) / sizeof(widths[0])); w++)
+	{
+		width = widths[w];
+
+		/*只留Y：到一包的Y（VGA灰度一包1472个，读2944字节，跨5段）*/
+		for(i = 0; i < (int)(sizeof(ys) / sizeof(ys[0])); i++)
+		{
+			n = ys[i];
+			pos = derived_pos;
+			for(k = 0; k < n; k++)
+				ref[k] = y_at(pos + k * 2);
+			SIM_CHECK(OV7725_ReadY(out, n) == n);
+			derived_check(out, n, (uint32_t)n * 2);
+			calls++;
+		}
+
+		/*隔列*/
+		for(format = OV7725_FORMAT_RGB565; format <= OV7725_FORMAT_GRAY; format += OV7725_FORMAT_GRAY - OV7725_FORMAT_RGB565)
+		for(phase = 0; phase < 2; phase++)
+		{
+			pos = derived_pos;
+			for(x = phase, k = 0; x < width; x += 2)
+			{
+				if(format == OV7725_FORMAT_GRAY)
+					ref[k++] = y_at(pos + x * 2);
+				else
+				{
+					ref[k++] = fifo[(pos + x * 2) % FIFO_LEN];
+					ref[k++] = fifo[(pos + x * 2 + 1) % FIFO_LEN];
+				}
+			}
+			len = OV7725_ReadHalf(out, width, phase, format);
+			SIM_CHECK(len == k);
+			derived_check(out, len, (uint32_t)width * 2);
+			calls++;
+		}
+
+		/*合并、区域合并*/
+		for(format = OV7725_FORMAT_RGB565; format <= OV7725_FORMAT_GRAY; format += OV7725_FORMAT_GRAY - OV7725_FORMAT_RGB565)
+		for(factor = 2; factor <= 4; factor *= 2)
+		{
+			if(width % (2 * factor))
+				continue;
+			pos = derived_pos;
+			len = bin_ref(ref, pos, width, factor, format);
+			SIM_CHECK(OV7725_ReadBinned(out, width, factor, format) == len);
+			derived_check(out, len, (uint32_t)width * 2 * factor);
+
+			pos = derived_pos;
+			len = bin_ref(ref, pos, width, factor, format);
+			memset(roi, 0xEE, sizeof(roi));
+			SIM_CHECK(OV7725_ReadBinnedRoi(out, width, factor, format, roi, factor, width / 2) == len);
+			derived_check(out, len, (uint32_t)width * 2 * factor);
+			for(line = 0, k = 0; line < factor; line++)
+			{
+				for(x = factor; x < factor + width / 2; x++)
+				{
+					if(format == OV7725_FORMAT_GRAY)
+						SIM_CHECK(roi[k++] == y_at(pos + ((uint32_t)line * width + x) * 2));
+					else
+					{
+						SIM_CHECK(roi[k++] == fifo[(pos + ((uint32_t)line * width + x) * 2) % FIFO_LEN]);
+						SIM_CHECK(roi[k++] == fifo[(pos + ((uint32_t)line * width + x) * 2 + 1) % FIFO_LEN]);
+					}
+				}
+			}
+			SIM_CHECK(roi[k] == 0xEE);
+			calls += 2;
+		}
+
+		/*RGB332：一包的行数，4的倍数*/
+		if(width <= 320)
+		{
+			lines = (1472 / width) & ~3;
+			pos = derived_pos;
+			for(line = 0, k = 0; line < lines; line++)
+			{
+				for(x = 0; x < width; x++)
+				{
+					p = px_at(pos + ((uint32_t)line * width + x) * 2);
+					d = (uint8_t)(((line & 3) << 2) | (x & 3));
+					d = (uint8_t[16]){0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5}[d];
+					ref[k++] = (uint8_t)((level(p >> 11, 31, 7, d) << 5) | (level((p >> 5) & 0x3f, 63, 7, d) << 2) | level(p & 0x1f, 31, 3, d));
+				}
+			}
+			SIM_CHECK(OV7725_ReadRGB332(out, width, lines) == k);
+			derived_check(out, k, (uint32_t)width * lines * 2);
+			calls++;
+		}
+	}
+	SIM_CHECK(derived_bad == 0);
+	SIM_CHECK(violations == 0);
+	printf("  derived reads: %u calls, %u bytes through DMA, every output matches\n", (unsigned)calls, (unsigned)derived_pos);
+
+	/*超时：置ov7725_read_err，读出照常返回，定时器停下、RCLK在高电平*/
+	stall = 1;
+	OV7725_RCLK_GPIO_PORT->BSRR = 0;
+	SIM_CHECK(OV7725_ReadY(out, 1472) == 1472);
+	SIM_CHECK(ov7725_read_err == 1);
+	SIM_CHECK(!(OV7725_RCLK_TIM->CR1 & TIM_CR1_CEN));
+	SIM_CHECK(OV7725_RCLK_GPIO_PORT->BSRR == OV7725_RCLK_GPIO_PIN);
+	ov7725_read_err = 0;
+	stall = 0;
+}
+
+/************************************************
+ * 函数名：timing_run
+ * 描述  ：按给定的周期、采样点、拉低点读一块，打印时序余量
+ * 输入  ：period/sample/fall:72MHz周期 extra:每次传输额外的总线延迟
+ * 输出  ：1:数据正确且没有时序违例
+ ************************************************/
+static int timing_run(uint16_t period, uint16_t sample, uint16_t fall, uint32_t extra)
+{
+	OS_ERR err;
+	int    ok;
+
+	OV7725_RCLK_TIM->ARR = period - 1;
+	OV7725_RCLK_TIM->CCR1 = sample;
+	OV7725_RCLK_TIM->CCR2 = fall;
+	lat_extra[0] = lat_extra[1] = lat_extra[2] = extra;
+	fifo_fill();
+	stat_reset();
+	OV7725_DMA_ReadBlock(buf, 1472, &err);
+	ok = (err == OS_ERR_NONE && memcmp(buf, fifo, 1472) == 0);
+	printf("  %6u %6u %4u %5u  %9.1f %8.1f %7.1f %9.1f  %10u %4u  %s\n", period, sample, fall, (unsigned)extra,
+	       setup_min, high_min, low_min, cycle_min, (unsigned)violations, (unsigned)lost, ok ? "ok" : "BAD");
+	ok = ok && violations == 0 && lost == 0 && high_min >= FIFO_T_PW && low_min >= FIFO_T_PW && cycle_min >= FIFO_T_RC;
+	lat_extra[0] = lat_extra[1] = lat_extra[2] = 0;
+	return ok;
+}
+
+/************************************************
+ * 函数名：test_timing
+ * 描述  ：程序里的时序和快、慢两种对比，加不同的总线延迟
+ * 注意  ：每字节三次DMA传输，DMA2忙不过来时请求会丢，数据错位；
+ *         DMA1上SPI同时在搬、CPU访问SRAM时，一次传输要多等几个周期
+ ************************************************/
+static void test_timing(void)
+{
+	static const uint16_t periods[] = {OV7725_RCLK_TIM_PERIOD, 24, 48};
+	uint32_t i, extra;
+	int      ok;
+
+	printf("  timing: DMA latency %u..%u + %u cycles busy (72MHz), AL422B tAC %.0fns tOH %.0fns tPW %.0fns\n",
+	       DMA_LAT_MIN, DMA_LAT_MAX, DMA_XFER, FIFO_T_AC, FIFO_T_OH, FIFO_T_PW);
+	printf("  period sample fall extra  setup(ns) high(ns) low(ns) cycle(ns)  violations lost  data\n");
+	for(i = 0; i < sizeof(periods) / sizeof(periods[0]); i++)
+	{
+		if(i && periods[i] == OV7725_RCLK_TIM_PERIOD)
+			continue;
+		for(extra = 0; extra <= 8; extra += 2)
+		{
+			if(i == 0)
+				ok = timing_run(OV7725_RCLK_TIM_PERIOD, OV7725_RCLK_TIM_SAMPLE, OV7725_RCLK_TIM_FALL, extra);
+			else
+				ok = timing_run(periods[i], periods[i] / 4, periods[i] / 2, extra);
+			if(i == 0 && extra <= 4)
+				SIM_CHECK(ok);                      /* 程序里的时序要有余量 */
+		}
+	}
+	OV7725_RCLK_TIM->ARR = OV7725_RCLK_TIM_PERIOD - 1;
+	OV7725_RCLK_TIM->CCR1 = OV7725_RCLK_TIM_SAMPLE;
+	OV7725_RCLK_TIM->CCR2 = OV7725_RCLK_TIM_FALL;
+}
+
+/************************************************
+ * 函数名：bench
+ * 描述  ：模型时间算读出速度；主机上量一下取字节的开销
+ ************************************************/
+static void bench(void)
+{
+	static uint16_t stage[OV7725_DMA_CHUNK];
+	OS_ERR   err;
+	int64_t  t;
+	uint64_t ns;
+	uint32_t i, raw_irqs, gray_irqs;
+	uint16_t n;
+	double   mbs;
+
+	fifo_fill();
+	t = t_now;
+	OV7725_DMA_ReadBlock(buf, 1472, &err);
+	t = t_busy - t;
+	mbs = 1472.0 * 72.0 / (double)t;
+	printf("  bench: 1472-byte block %.1f us in model, %.2f MB/s (raw RCLK %.2f MB/s), %u chunks\n",
+	       (double)t / 72.0, mbs, 72.0 / OV7725_RCLK_TIM_PERIOD,
+	       (unsigned)((1472 + OV7725_DMA_CHUNK - 1) / OV7725_DMA_CHUNK));
+	printf("  bench: QVGA RGB565 frame (153600 bytes) %.1f ms\n", 153600.0 / mbs / 1000.0);
+
+	/*一帧QVGA按包读出的中断数：原始RGB565、只留Y的灰度、2x2合并*/
+	irqs = 0;
+	for(i = 0; i < 153600; i += n)
+	{
+		n = (153600 - i > 1472) ? 1472 : 153600 - i;
+		OV7725_DMA_ReadBlock(buf, n, &err);
+	}
+	raw_irqs = irqs;
+	irqs = 0;
+	for(i = 0; i < 76800; i += n)
+	{
+		n = (76800 - i > 1472) ? 1472 : 76800 - i;
+		OV7725_ReadY(buf, n);
+	}
+	gray_irqs = irqs;
+	irqs = 0;
+	for(i = 0; i < 240; i += 2)
+		OV7725_ReadBinned(buf, 320, 2, OV7725_FORMAT_RGB565);
+	printf("  bench: DMA interrupts per QVGA frame (%u-byte segments): RGB565 %u, gray (ReadY) %u, 2x2 binned %u\n",
+	       OV7725_DMA_CHUNK, (unsigned)raw_irqs, (unsigned)gray_irqs, (unsigned)irqs);
+
+	for(i = 0; i < OV7725_DMA_CHUNK; i++)
+		stage[i] = sim_rand();
+	ns = sim_ns();
+	for(i = 0; i < 100000; i++)
+		OV7725_DMA_Unpack(buf + (i & 7), stage, OV7725_DMA_CHUNK);
+	ns = sim_ns() - ns;
+	printf("  bench: unpack on host %.2f ns/byte\n", (double)ns / 100000.0 / OV7725_DMA_CHUNK);
+}
+
+int main(void)
+{
+	sim_init();
+	sim_srand(1);
+	sim_idle = hw_run;
+
+	req[0].ch = OV7725_DATA_DMA_CHANNEL;   req[0].de = TIM_DIER_CC1DE; req[0].flag = TIM_SR_CC1IF;
+	req[1].ch = OV7725_RCLK_L_DMA_CHANNEL; req[1].de = TIM_DIER_CC2DE; req[1].flag = TIM_SR_CC2IF;
+	req[2].ch = OV7725_RCLK_H_DMA_CHANNEL; req[2].de = TIM_DIER_UDE;   req[2].flag = TIM_SR_UIF;
+
+	OV7725_DMA_Init();
+	OV7725_RCLK_GPIO_PORT->BSRR = OV7725_RCLK_GPIO_PIN;
+
+	test_config();
+	test_blocks();
+	test_timeout();
+	test_derived();
+	test_timing();
+	bench();
+	return sim_done("test_fifo_dma");
+}
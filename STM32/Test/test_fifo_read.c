@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    test_fifo_read.c
+  * @brief   CPU读FIFO：OV7725_ReadLines、OV7725_ReadBytes的正确性和主机上的相对速度
+  ******************************************************************************
+  * @attention
+  *
+  * bsp_ov7725.c原样编译，读口接到shim/ov7725_fifo_sim.h的AL422B模型。
+  * 检查按字读（偶数宽度）和逐字节读（奇数宽度）读出的数据、RCLK个数与FIFO一致，
+  * 不写出缓冲区，读指针到头回绕。
+  *
+  * 测速时模型换成只写引脚（sim_fifo_bench），得到的是主机上的ns/字节，
+  * 只能比较各种读法循环开销的相对大小，不代表目标板上的时间
+  * （目标板上用capture_stat中的read_cycles_per_px比较）
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include "sim.h"
+#include "./ov7725/bsp_ov7725.h"
+
+
+#define GUARD               16
+#define BENCH_BYTES         (320 * 240 * 2)
+#define BENCH_PKT           1280        /* 按包读，一包4行 */
+
+static uint32_t buf_w[(BENCH_BYTES + GUARD) / 4];
+static uint8_t *buf = (uint8_t *)buf_w;
+
+/*FIFO填随机数，读指针放到from*/
+static void fifo_fill(uint32_t from)
+{
+	uint32_t i;
+
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)sim_rand();
+	FIFO_PREPARE;
+	SIM_CHECK(sim_fifo_rp == 1);
+	sim_fifo_rp = from;
+	GPIOB->IDR = ((uint32_t)sim_fifo[from] << 8) | SIM_FIFO_IDR_LOW;
+	sim_fifo_rp = (from + 1) % SIM_FIFO_SIZE;
+}
+
+/*比较buf[0..n)与FIFO从from起的n字节，后面的保护字节没被改写*/
+static int fifo_same(uint32_t from, uint32_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		if(buf[i] != sim_fifo[(from + i) % SIM_FIFO_SIZE])
+			return 0;
+	for(i = n; i < n + GUARD; i++)
+		if(buf[i] != 0xEE)
+			return 0;
+	return 1;
+}
+
+/*应用里CPU逐字节读的写法（APP_CFG_OV7725_READ_MODE == OV7725_READ_BYTE）*/
+static void read_byte_loop(uint8_t *dst, uint16_t n)
+{
+	uint16_t k;
+	uint8_t Camera_Data;
+
+	for(k = 0; k < n; k++)
+	{
+		READ_FIFO_PIXEL(Camera_Data);
+		dst[k] = Camera_Data;
+	}
+}
+
+static void test_prepare(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)(i * 7 + 3);
+	sim_fifo_rp = 12345;
+	FIFO_PREPARE;
+	memset(buf, 0xEE, 64 + GUARD);
+	OV7725_ReadBytes(buf, 64);
+	SIM_CHECK(fifo_same(0, 64));            /* 复位后第一个字节是地址0 */
+}
+
+static void test_lines(void)
+{
+	static const uint16_t width[] = {320, 240, 160, 200, 8, 201, 1};
+	uint32_t from, clocks, n;
+	uint16_t lines;
+	int w;
+
+	for(w = 0; w < (int)(sizeof(width) / sizeof(width[0])); w++)
+	{
+		for(lines = 1; lines <= 4; lines++)
+		{
+			n = (uint32_t)width[w] * lines * 2;
+			from = sim_rand() % SIM_FIFO_SIZE;
+			fifo_fill(from);
+			memset(buf, 0xEE, n + GUARD);
+			clocks = sim_fifo_clocks;
+			OV7725_ReadLines(buf, width[w], lines);
+			SIM_CHECK(fifo_same(from, n));
+			SIM_CHECK(sim_fifo_clocks - clocks == n);
+		}
+	}
+}
+
+static void test_bytes(void)
+{
+	uint32_t from, clocks;
+	uint16_t n;
+
+	for(n = 4; n <= 1472; n += 4)
+	{
+		from = sim_rand() % SIM_FIFO_SIZE;
+		fifo_fill(from);
+		memset(buf, 0xEE, n + GUARD);
+		clocks = sim_fifo_clocks;
+		SIM_CHECK(OV7725_ReadBytes(buf, n) == n);
+		SIM_CHECK(fifo_same(from, n));
+		SIM_CHECK(sim_fifo_clocks - clocks == n);
+	}
+
+	/*跨过FIFO末尾*/
+	from = SIM_FIFO_SIZE - 20;
+	fifo_fill(from);
+	memset(buf, 0xEE, 64 + GUARD);
+	OV7725_ReadBytes(buf, 64);
+	SIM_CHECK(fifo_same(from, 64));
+}
+
+static double bench_one(int mode)
+{
+	uint64_t t, best = ~0ull;
+	uint32_t off;
+	int r;
+
+	for(r = 0; r < 5; r++)
+	{
+		FIFO_PREPARE;
+		t = sim_ns();
+		for(off = 0; off < BENCH_BYTES; off += BENCH_PKT)
+		{
+			switch(mode)
+			{
+				case 0:  read_byte_loop(buf + off, BENCH_PKT); break;
+				case 1:  OV7725_ReadLines(buf + off, 320, BENCH_PKT / 640); break;
+				case 2:  OV7725_ReadLines(buf + off, 128, BENCH_PKT / 256); break;
+				default: OV7725_ReadBytes(buf + off, BENCH_PKT); break;
+			}
+		}
+		t = sim_ns() - t;
+		if(t < best)
+			best = t;
+	}
+	return (double)best / BENCH_BYTES;
+}
+
+static void bench(void)
+{
+	double byte_ns, lines_ns, generic_ns, bytes_ns;
+
+	sim_fifo_bench = 1;
+	byte_ns = bench_one(0);
+	lines_ns = bench_one(1);
+	generic_ns = bench_one(2);
+	bytes_ns = bench_one(3);
+	sim_fifo_bench = 0;
+
+
+	printf("  bench (host, QVGA RGB565 frame, best of 5):\n");
+	printf("    byte loop (READ_FIFO_PIXEL)     %.2f ns/byte\n", byte_ns);
+	printf("    OV7725_ReadLines width 320      %.2f ns/byte  (%.2fx)\n", lines_ns, byte_ns / lines_ns);
+	printf("    OV7725_ReadLines width 128      %.2f ns/byte  (%.2fx)\n", generic_ns, byte_ns / generic_ns);
+	printf("    OV7725_ReadBytes                %.2f ns/byte  (%.2fx)\n", bytes_ns, byte_ns / bytes_ns);
+}
+
+int main(void)
+{
+	sim_init();
+	sim_srand(3);
+	test_prepare();
+	test_lines();
+	test_bytes();
+	bench();
+	return sim_done("test_fifo_read");
+}
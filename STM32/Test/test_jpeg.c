@@ -0,0 +1,330 @@
+/**
+  ******************************************************************************
+  * @file    test_jpeg.c
+  * @brief   基线JPEG编码器：libjpeg解码检查、缓冲上限，压缩率、画质和主机速度
+  ******************************************************************************
+  * @attention
+  *
+  * jpeg.c原样编译，按MCU行喂整帧（与带缓冲相同），编出的码流交给主机的
+  * libjpeg解码（需要libjpeg开发包，链接-ljpeg）：
+  *   80x60到640x480、宽高不是16倍数的窗口，三种输入格式，质量1~100，
+  *   解码无错误无警告，尺寸、分量数对；文件头、每个MCU、结尾不超过
+  *   JPEG_HEAD_MAX、JPEG_MCU_MAX、JPEG_END_MAX（随机噪声q100是MCU最大的情况）；
+  *   测试图q25以上Y的PSNR超过30dB，彩色不比同质量的libjpeg差0.5dB以上
+  *
+  * 测速在合成的测试图上：大小、bit/px、PSNR（彩色按RGB，灰度按Y），
+  * 同样质量下libjpeg（4:2:0，默认设置）的结果作对照；时间是主机上的
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <setjmp.h>
+#include <jpeglib.h>
+#include "sim.h"
+#include "jpeg.h"
+
+
+#define W_MAX               640
+#define H_MAX               480
+#define OUT_MAX             (W_MAX * H_MAX * 4)
+
+static JPEG_ENC enc;
+static uint8_t  src[W_MAX * H_MAX * 2];             /* 输入，与FIFO读出的字节顺序相同 */
+static uint8_t  rgb[W_MAX * H_MAX * 3];             /* 输入的8位RGB（灰度、YUYV只用Y） */
+static uint8_t  out[OUT_MAX];
+static uint8_t  dec[W_MAX * H_MAX * 3];
+static uint16_t mcu_max, head_max, end_max;
+
+/*编一帧，返回字节数*/
+static uint32_t encode(uint16_t w, uint16_t h, uint8_t pix, uint8_t q)
+{
+	uint8_t bpp = (pix == JPEG_PIX_GRAY) ? 1 : 2;
+	uint8_t lines, step;
+	uint32_t len;
+	uint16_t n, x, y;
+
+	Jpeg_Quality(&enc, q);
+	len = Jpeg_Begin(&enc, out, w, h, pix);
+	if(len > head_max)
+		head_max = (uint16_t)len;
+	step = JPEG_MCU_LINES(&enc);
+	for(y = 0; y < h; y += step)
+	{
+		lines = (uint8_t)((h - y < step) ? h - y : step);
+		for(x = 0; x < w; x += step)
+		{
+			n = Jpeg_Mcu(&enc, src + (uint32_t)y * w * bpp, w * bpp, x, lines, out + len);
+			if(n > mcu_max)
+				mcu_max = n;
+			len += n;
+		}
+	}
+	n = Jpeg_End(&enc, out + len);
+	if(n > end_max)
+		end_max = n;
+	return len + n;
+}
+
+/*libjpeg出错时跳回，警告计数*/
+typedef struct
+{
+	struct jpeg_error_mgr pub;
+	jmp_buf jump;
+}DEC_ERR;
+
+static void dec_error_exit(j_common_ptr cinfo)
+{
+	longjmp(((DEC_ERR *)cinfo->err)->jump, 1);
+}
+
+static void dec_output(j_common_ptr cinfo)
+{
+	(void)cinfo;
+}
+
+/*解码，成功返回分量数，出错或有警告返回0*/
+static int decode(uint32_t len, uint16_t w, uint16_t h, int ycc)
+{
+	struct jpeg_decompress_struct cinfo;
+	DEC_ERR jerr;
+	JSAMPROW row;
+	int comps;
+
+	cinfo.err = jpeg_std_error(&jerr.pub);
+	jerr.pub.error_exit = dec_error_exit;
+	jerr.pub.output_message = dec_output;
+	if(setjmp(jerr.jump))
+	{
+		jpeg_destroy_decompress(&cinfo);
+		return 0;
+	}
+	jpeg_create_decompress(&cinfo);
+	jpeg_mem_src(&cinfo, out, len);
+	jpeg_read_header(&cinfo, TRUE);
+	if(ycc && cinfo.num_components == 3)
+		cinfo.out_color_space = JCS_YCbCr;
+	jpeg_start_decompress(&cinfo);
+	if(cinfo.output_width != w || cinfo.output_height != h)
+	{
+		jpeg_destroy_decompress(&cinfo);
+		return 0;
+	}
+	comps = cinfo.output_components;
+	while(cinfo.output_scanline < cinfo.output_height)
+	{
+		row = dec + (uint32_t)cinfo.output_scanline * w * comps;
+		jpeg_read_scanlines(&cinfo, &row, 1);
+	}
+	jpeg_finish_decompress(&cinfo);
+	jpeg_destroy_decompress(&cinfo);
+	return jerr.pub.num_warnings ? 0 : comps;
+}
+
+/*同样质量下libjpeg的大小，解码结果放在dec*/
+static uint32_t libjpeg_ref(uint16_t w, uint16_t h, uint8_t q)
+{
+	struct jpeg_compress_struct cinfo;
+	struct jpeg_error_mgr jerr;
+	unsigned char *mem = 0;
+	unsigned long size = 0;
+	JSAMPROW row;
+
+	cinfo.err = jpeg_std_error(&jerr);
+	jpeg_create_compress(&cinfo);
+	jpeg_mem_dest(&cinfo, &mem, &size);
+	cinfo.image_width = w;
+	cinfo.image_height = h;
+	cinfo.input_components = 3;
+	cinfo.in_color_space = JCS_RGB;
+	jpeg_set_defaults(&cinfo);
+	jpeg_set_quality(&cinfo, q, TRUE);
+	jpeg_start_compress(&cinfo, TRUE);
+	while(cinfo.next_scanline < h)
+	{
+		row = rgb + (uint32_t)cinfo.next_scanline * w * 3;
+		jpeg_write_scanlines(&cinfo, &row, 1);
+	}
+	jpeg_finish_compress(&cinfo);
+	jpeg_destroy_compress(&cinfo);
+	memcpy(out, mem, size);
+	free(mem);
+	SIM_CHECK(decode(size, w, h, 0) == 3);
+	return size;
+}
+
+/*输入图：kind 0 合成测试图（渐变、色条、圆、细线，加少量噪声），1 随机噪声
+  rgb中是8位RGB，src按pix填RGB565、YUYV或灰度*/
+static void make_input(uint16_t w, uint16_t h, uint8_t pix, int kind)
+{
+	static const uint8_t bars[8][3] = {{255,255,255},{255,255,0},{0,255,255},{0,255,0},
+	                                   {255,0,255},{255,0,0},{0,0,255},{0,0,0}};
+	uint32_t x, y, i;
+	int r, g, b, yy, u, v, d;
+	uint16_t p;
+
+	for(y = 0; y < h; y++)
+		for(x = 0; x < w; x++)
+		{
+			i = y * w + x;
+			if(kind)
+			{
+				r = sim_rand() & 255; g = sim_rand() & 255; b = sim_rand() & 255;
+			}
+			else if(y < h / 4)
+			{
+				r = bars[x * 8 / w][0]; g = bars[x * 8 / w][1]; b = bars[x * 8 / w][2];
+			}
+			else
+			{
+				r = (int)(x * 255 / w);
+				g = (int)(y * 255 / h);
+				b = 128 + (int)(60 * sin(x * 0.05) * cos(y * 0.07));
+				d = (int)((x - w / 2) * (x - w / 2) + (y - h * 5 / 8) * (y - h * 5 / 8));
+				if(d < (int)(h * h / 25))
+				{
+					r = 230; g = 200; b = 40;
+				}
+				if(x % 40 == 0 || y % 40 == 0)
+					r = g = b = 20;
+				r += (int)(sim_rand() % 5) - 2; g += (int)(sim_rand() % 5) - 2; b += (int)(sim_rand() % 5) - 2;
+				r = r < 0 ? 0 : (r > 255 ? 255 : r);
+				g = g < 0 ? 0 : (g > 255 ? 255 : g);
+				b = b < 0 ? 0 : (b > 255 ? 255 : b);
+			}
+			if(pix == JPEG_PIX_RGB565)
+			{
+				p = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+				src[i * 2] = (uint8_t)(p >> 8);
+				src[i * 2 + 1] = (uint8_t)p;
+				/*与编码器相同的5、6位扩展*/
+				r = ((p >> 8) & 0xF8) | (p >> 13);
+				g = ((p >> 3) & 0xFC) | ((p >> 9) & 0x03);
+				b = ((p << 3) & 0xF8) | ((p >> 2) & 0x07);
+				rgb[i * 3] = (uint8_t)r; rgb[i * 3 + 1] = (uint8_t)g; rgb[i * 3 + 2] = (uint8_t)b;
+				continue;
+			}
+			yy = (77 * r + 150 * g + 29 * b + 128) >> 8;
+			rgb[i * 3] = (uint8_t)yy;
+			if(pix == JPEG_PIX_GRAY)
+			{
+				src[i] = (uint8_t)yy;
+				continue;
+			}
+			u = ((-43 * r - 85 * g + 128 * b + 128) >> 8) + 128;
+			v = ((128 * r - 107 * g - 21 * b + 128) >> 8) + 128;
+			src[i * 2] = (uint8_t)yy;
+			src[i * 2 + 1] = (uint8_t)((x & 1) ? v : u);     /* Y0 U Y1 V */
+		}
+}
+
+/*彩色：dec为RGB，与rgb比；灰度、YUYV：dec的Y与rgb[i*3]比*/
+static double psnr(uint16_t w, uint16_t h, int comps, int rgb_cmp)
+{
+	double mse = 0, d;
+	uint32_t i, n = (uint32_t)w * h;
+
+	for(i = 0; i < n; i++)
+	{
+		if(rgb_cmp)
+		{
+			d = dec[i * 3] - rgb[i * 3];         mse += d * d;
+			d = dec[i * 3 + 1] - rgb[i * 3 + 1]; mse += d * d;
+			d = dec[i * 3 + 2] - rgb[i * 3 + 2]; mse += d * d;
+		}
+		else
+		{
+			d = dec[i * comps] - rgb[i * 3];
+			mse += d * d * 3;
+		}
+	}
+	mse /= n * 3.0;
+	return mse > 0 ? 10 * log10(255.0 * 255.0 / mse) : 99.0;
+}
+
+static void test_sweep(void)
+{
+	static const uint16_t size[][2] = {{80, 60}, {160, 120}, {168, 120}, {200, 150}, {320, 240}, {640, 480}, {8, 8}};
+	static const uint8_t quality[] = {1, 10, 25, 50, 75, 90, 100};
+	uint32_t len;
+	uint8_t pix;
+	int s, q, kind, comps, frames = 0;
+	double p;
+
+	for(s = 0; s < (int)(sizeof(size) / sizeof(size[0])); s++)
+		for(pix = 0; pix < 3; pix++)
+			for(kind = 0; kind < 2; kind++)
+			{
+				make_input(size[s][0], size[s][1], pix, kind);
+				for(q = 0; q < (int)sizeof(quality); q++)
+				{
+					len = encode(size[s][0], size[s][1], pix, quality[q]);
+					comps = decode(len, size[s][0], size[s][1], pix == JPEG_PIX_YUYV);
+					SIM_CHECK(comps == ((pix == JPEG_PIX_GRAY) ? 1 : 3));
+					/*有损，但不能错得离谱：测试图q25以上，Y比30dB好；彩色受4:2:0限制，
+					  与同样质量的libjpeg比，PSNR差不到0.5dB*/
+					if(kind == 0 && quality[q] >= 25 && size[s][0] >= 80)
+					{
+						p = psnr(size[s][0], size[s][1], comps, pix == JPEG_PIX_RGB565);
+						if(pix == JPEG_PIX_RGB565)
+						{
+							libjpeg_ref(size[s][0], size[s][1], quality[q]);
+							SIM_CHECK(p > psnr(size[s][0], size[s][1], 3, 1) - 0.5);
+						}
+						else
+							SIM_CHECK(p > 30.0);
+					}
+					frames++;
+				}
+			}
+	SIM_CHECK(head_max <= JPEG_HEAD_MAX);
+	SIM_CHECK(mcu_max <= JPEG_MCU_MAX);
+	SIM_CHECK(end_max <= JPEG_END_MAX);
+	printf("  %d frames decoded by libjpeg; largest header %u/%u, MCU %u/%u, end %u/%u bytes\n", frames,
+	       head_max, JPEG_HEAD_MAX, mcu_max, JPEG_MCU_MAX, end_max, JPEG_END_MAX);
+}
+
+static void bench_one(uint16_t w, uint16_t h, uint8_t pix, uint8_t q)
+{
+	uint64_t t, best = ~0ull;
+	uint32_t len = 0, ref;
+	double p, p_ref = 0;
+	int r, comps;
+
+	make_input(w, h, pix, 0);
+	for(r = 0; r < 5; r++)
+	{
+		t = sim_ns();
+		len = encode(w, h, pix, q);
+		t = sim_ns() - t;
+		if(t < best)
+			best = t;
+	}
+	comps = decode(len, w, h, pix == JPEG_PIX_YUYV);
+	p = psnr(w, h, comps, pix == JPEG_PIX_RGB565);
+	if(pix == JPEG_PIX_RGB565)
+	{
+		ref = libjpeg_ref(w, h, q);
+		p_ref = psnr(w, h, 3, 1);
+		printf("  %3ux%-3u RGB565 q%-3u %6.1f KB %5.2f bpp %5.1f dB %6.2f ms   libjpeg %6.1f KB %5.1f dB\n",
+		       w, h, q, len / 1024.0, len * 8.0 / (w * h), p, best / 1e6, ref / 1024.0, p_ref);
+	}
+	else
+		printf("  %3ux%-3u %-6s q%-3u %6.1f KB %5.2f bpp %5.1f dB %6.2f ms\n", w, h,
+		       (pix == JPEG_PIX_GRAY) ? "gray" : "YUYV", q, len / 1024.0, len * 8.0 / (w * h), p, best / 1e6);
+}
+
+int main(void)
+{
+	sim_srand(17);
+	test_sweep();
+	printf("  test image, host, best of 5 (gray and YUYV PSNR on Y):\n");
+	bench_one(320, 240, JPEG_PIX_RGB565, 50);
+	bench_one(320, 240, JPEG_PIX_RGB565, 75);
+	bench_one(320, 240, JPEG_PIX_YUYV, 50);
+	bench_one(320, 240, JPEG_PIX_GRAY, 50);
+	bench_one(160, 120, JPEG_PIX_RGB565, 50);
+	return sim_done("test_jpeg");
+}
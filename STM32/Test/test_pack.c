@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    test_pack.c
+  * @brief   图像包的打包方式：包长、一帧的包数、FIFO偏移和合成测试图案
+  ******************************************************************************
+  * @attention
+  *
+  * image.c、bsp_ov7725.c原样编译，读口接到shim/ov7725_fifo_sim.h的AL422B模型。
+  * 对合法的窗口（按OV7725_Window_Change、PictureFits、PictureBinSet的限制）、
+  * 各种格式、缩小倍数、压缩开关，PicturePackingSet()之后检查：
+  *   各包PicturePacketSize()之和为frame_len，每包不超过PICTURE_PACKET_MAX、是4的倍数；
+  *   按AppTaskOV7725队列方式的写法逐包读FIFO，每包存入的字节数等于包长，
+  *   读过的RCLK数等于PictureFifoOffset()，一帧读完正好是FIFO中的一帧；
+  *   PictureTestPack()各包拼起来每行都是8条竖彩条，包头是帧序号、包序号
+  *
+  ******************************************************************************
+  */
+#define _POSIX_C_SOURCE     200112L     /* 不要sys/types.h里的u_int，与W5500的types.h冲突 */
+#include <string.h>
+#include "sim.h"
+#include "image.h"
+
+
+extern OV7725_MODE_PARAM cam_mode;
+
+/*合成测试图案的8条竖彩条（与接收端相同）：白 黄 青 绿 品红 红 蓝 黑*/
+static const uint16_t bar_rgb565[8] = {0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000};
+static const uint8_t  bar_rgb332[8] = {0xFF, 0xFC, 0x1F, 0x1C, 0xE3, 0xE0, 0x03, 0x00};
+static const uint8_t  bar_yuv[8][3] = {
+	{255, 128, 128}, {226,   0, 149}, {179, 170,   0}, {150,  44,  21},
+	{105, 212, 235}, { 76,  85, 255}, { 29, 255, 107}, {  0, 128, 128},
+};
+
+static uint32_t slot_w[PICTURE_PACKET_MAX / 4 + 4];
+static uint8_t *slot = (uint8_t *)slot_w;
+static uint32_t combos, packets_total;
+static uint16_t max_packets;
+
+/*按AppTaskOV7725的写法（队列方式、CPU读）从FIFO读一包，返回存入的字节数*/
+static uint16 read_packet(uint16 pkt_len)
+{
+	uint16 len, fifo_len;
+
+	if(picture_bin > 1)
+	{
+		for(len = 0; len < pkt_len; )
+			len += OV7725_ReadBinned(slot + len, cam_mode.cam_width, picture_bin, cam_mode.format);
+		return len;
+	}
+	if(cam_mode.format == OV7725_FORMAT_GRAY && pkt_len * 2 > PICTURE_PACKET_MAX)
+		return OV7725_ReadY(slot, pkt_len);
+	if(cam_mode.format == OV7725_FORMAT_RGB332)
+		return OV7725_ReadRGB332(slot, cam_mode.cam_width, pkt_len / cam_mode.cam_width);
+	fifo_len = (cam_mode.format == OV7725_FORMAT_GRAY) ? pkt_len * 2 : pkt_len;
+	OV7725_ReadBytes(slot, fifo_len);
+	if(cam_mode.format == OV7725_FORMAT_GRAY)
+		return OV7725_Keep_Y(slot, fifo_len);
+	return fifo_len;
+}
+
+/*测试图案一帧中偏移o处的字节*/
+static uint8_t bar_byte(uint32_t o)
+{
+	uint16 w = cam_mode.cam_width / picture_bin;
+	uint8_t bpp = (cam_mode.format == OV7725_FORMAT_GRAY || cam_mode.format == OV7725_FORMAT_RGB332) ? 1 : 2;
+	uint16 pos = o % (w * bpp);
+	uint16 x = pos / bpp;
+	uint8_t bar = x * 8 / w;
+
+	switch(cam_mode.format)
+	{
+		case OV7725_FORMAT_RGB565: return (pos & 1) ? (uint8_t)bar_rgb565[bar] : bar_rgb565[bar] >> 8;
+		case OV7725_FORMAT_YUV422: return (pos & 1) ? bar_yuv[bar][(x & 1) ? 2 : 1] : bar_yuv[bar][0];
+		case OV7725_FORMAT_RGB332: return bar_rgb332[bar];
+		default:                   return bar_yuv[bar][0];
+	}
+}
+
+static void check_sizes(void)
+{
+	uint16 w = cam_mode.cam_width / picture_bin;
+	uint16 h = cam_mode.cam_height / picture_bin;
+	uint8_t bpp = (cam_mode.format == OV7725_FORMAT_GRAY || cam_mode.format == OV7725_FORMAT_RGB332) ? 1 : 2;
+	uint32_t sum = 0;
+	uint16 i, len;
+
+	SIM_CHECK(picture_pack.frame_len == (uint32_t)w * h * bpp);
+	SIM_CHECK(picture_pack.packets > 0 && PicturePacketLen() == picture_pack.len);
+	SIM_CHECK(picture_pack.lines == 0 || picture_pack.len == picture_pack.lines * picture_pack.line_len);
+	for(i = 0; i < picture_pack.packets; i++)
+	{
+		len = PicturePacketSize(i);
+		SIM_CHECK(len > 0 && len <= PICTURE_PACKET_MAX && len <= 1472);
+		SIM_CHECK((len & 3) == 0);
+		SIM_CHECK(i == picture_pack.packets - 1 || len == picture_pack.len);
+		sum += len;
+	}
+	SIM_CHECK(sum == picture_pack.frame_len);
+}
+
+static void check_fifo(void)
+{
+	uint32_t c0, off = 0;
+	uint16 i, len;
+	int raw = picture_bin == 1 && (cam_mode.format == OV7725_FORMAT_RGB565 || cam_mode.format == OV7725_FORMAT_YUV422);
+
+	FIFO_PREPARE;
+	c0 = sim_fifo_clocks;
+	for(i = 0; i < picture_pack.packets; i++)
+	{
+		len = PicturePacketSize(i);
+		SIM_CHECK(read_packet(len) == len);
+		if(raw)
+			SIM_CHECK(memcmp(slot, sim_fifo + off, len) == 0);
+		off += len;
+		SIM_CHECK(sim_fifo_clocks - c0 == PictureFifoOffset(i + 1));
+	}
+	SIM_CHECK(PictureFifoOffset(picture_pack.packets) == (uint32_t)cam_mode.cam_width * cam_mode.cam_height * 2);
+}
+
+static void check_test_pack(void)
+{
+	uint32_t seq = 0x12345678u + combos, o = 0;
+	uint16 i, k, len;
+
+	picture_test = PICTURE_TEST_SYNTH;
+	for(i = 0; i < picture_pack.packets; i++)
+	{
+		memset(slot, 0xEE, PICTURE_PACKET_MAX);
+		len = PictureTestPack(slot, seq, i);
+		SIM_CHECK(len == PicturePacketSize(i));
+		SIM_CHECK(slot[0] == 0x12 && slot[3] == (uint8_t)seq);
+		SIM_CHECK(slot[4] == i >> 8 && slot[5] == (uint8_t)i);
+		SIM_CHECK(slot[6] == (uint8_t)(~i >> 8) && slot[7] == (uint8_t)~i);
+		for(k = 8; k < len; k++)
+			if(slot[k] != bar_byte(o + k))
+				break;
+		SIM_CHECK(k == len);
+		SIM_CHECK(len == PICTURE_PACKET_MAX || slot[len] == 0xEE);
+		o += len;
+	}
+	picture_test = PICTURE_TEST_OFF;
+}
+
+/*合法窗口：同OV7725_Window_Change的限制*/
+static int window_ok(uint16_t w, uint16_t h, uint8_t vga, uint8_t format)
+{
+	if(w < 16 || (w & 3) || h < 2 || (h & 1) || (format == OV7725_FORMAT_RGB332 && (h & 3)))
+		return 0;
+	if(w > (vga ? 640 : 320) || h > (vga ? 480 : 240) || (uint32_t)w * h * 2 > SIM_FIFO_SIZE)
+		return 0;
+	return PictureFits(w, format, 1);
+}
+
+int main(void)
+{
+	static const uint16_t widths[] = {16, 20, 24, 28, 36, 44, 100, 124, 160, 164, 200, 236, 240, 252, 320, 324, 400, 480, 636, 640};
+	static const uint16_t heights[] = {2, 4, 8, 12, 16, 30, 60, 96, 120, 122, 200, 240, 300, 480};
+	uint32_t i;
+	uint8_t vga, format, bin, codec;
+	int wi, hi;
+
+	sim_init();
+	sim_srand(23);
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)sim_rand();
+
+	for(wi = 0; wi < (int)(sizeof(widths) / sizeof(widths[0])); wi++)
+	for(hi = 0; hi < (int)(sizeof(heights) / sizeof(heights[0])); hi++)
+	for(vga = 0; vga < 2; vga++)
+	for(format = OV7725_FORMAT_RGB565; format <= OV7725_FORMAT_RGB332; format++)
+	for(bin = 1; bin <= 4; bin *= 2)
+	for(codec = 0; codec < 2; codec++)
+	{
+		if(!window_ok(widths[wi], heights[hi], vga, format) || (vga && widths[wi] <= 320 && heights[hi] <= 240))
+			continue;
+		if(codec && format != OV7725_FORMAT_RGB565)
+			continue;
+		cam_mode.cam_width = widths[wi];
+		cam_mode.cam_height = heights[hi];
+		cam_mode.QVGA_VGA = vga;
+		cam_mode.format = format;
+		picture_bin = 1;
+		if(PictureBinSet(bin) != SUCCESS)
+			continue;
+		picture_codec = codec;
+		PicturePackingSet();
+		check_sizes();
+		check_fifo();
+		check_test_pack();
+		combos++;
+		packets_total += picture_pack.packets;
+		if(picture_pack.packets > max_packets)
+			max_packets = picture_pack.packets;
+	}
+	picture_bin = 1;
+	picture_codec = 0;
+	printf("  %u window/format/bin/codec combinations, %u packets, up to %u packets per frame\n",
+	       combos, packets_total, max_packets);
+	return sim_done("test_pack");
+}
@@ -0,0 +1,175 @@
+/**
+  ******************************************************************************
+  * @file    test_pipe.c
+  * @brief   FIFO帧流水线：帧首尾相接、到头回绕时读到的是哪一帧，重读回到帧头
+  ******************************************************************************
+  * @attention
+  *
+  * bsp_ov7725.c原样编译，读口接shim/ov7725_fifo_sim.h的模型，写口在这里模拟：
+  * OV7725_Frame_VSYNC()复位了写指针（rewind_seq变了）就从地址0写，
+  * 打开写时把下一帧整帧写进FIFO（比实际早，写得比读快也能查出覆盖）。
+  * 每帧的字节由帧序号和帧内偏移决定，读到的帧头、帧尾不对就是读错了位置。
+  *
+  *   随机：每读一帧前来0~2个VSYNC，随机重读、空读跳过、丢弃全部帧；
+  *   稳定：每帧一个VSYNC，FIFO一直不空，写指针只复位一次，
+  *         帧序号一直涨，重读的空读数不能随之增长（不超过FIFO容量）；
+  *   帧序号从接近32位上限开始，跨过回绕
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include "sim.h"
+#include "./ov7725/bsp_ov7725.h"
+
+
+#define CHECK_BYTES         16
+
+static uint32_t wp;                     /* 写指针 */
+static uint32_t rewinds;                /* 写指针复位次数 */
+static uint32_t rewind_max;             /* 一次重读的最大RCLK数 */
+static uint32_t buf_w[CHECK_BYTES / 4];
+static uint8_t *buf = (uint8_t *)buf_w;
+
+/*帧f偏移o处的字节，前4字节是帧序号*/
+static uint8_t frame_byte(uint32_t f, uint32_t o)
+{
+	if(o < 4)
+		return (uint8_t)(f >> (o * 8));
+	return (uint8_t)(f * 7 + o + (o >> 8) * 3);
+}
+
+/*VSYNC中断，加上写口*/
+static void vsync(void)
+{
+	uint32_t rewind = ov7725_pipe.rewind_seq;
+	uint32_t f, o;
+
+	OV7725_Frame_VSYNC();
+	if(ov7725_pipe.rewind_seq != rewind)
+	{
+		wp = 0;
+		rewinds++;
+	}
+	if(ov7725_pipe.writing)
+	{
+		f = ov7725_pipe.write_seq + 1;
+		for(o = 0; o < ov7725_pipe.frame_bytes; o++)
+		{
+			sim_fifo[wp] = frame_byte(f, o);
+			if(++wp == SIM_FIFO_SIZE)
+				wp = 0;
+		}
+	}
+}
+
+/*从当前读指针读CHECK_BYTES字节，应是帧f偏移o处*/
+static int read_check(uint32_t f, uint32_t o)
+{
+	uint32_t i;
+
+	OV7725_ReadLines(buf, CHECK_BYTES / 2, 1);
+	for(i = 0; i < CHECK_BYTES; i++)
+		if(buf[i] != frame_byte(f, o + i))
+			return 0;
+	return 1;
+}
+
+static void rewind_check(uint32_t f)
+{
+	uint32_t clocks = sim_fifo_clocks;
+
+	OV7725_Frame_Rewind();
+	clocks = sim_fifo_clocks - clocks;
+	if(clocks > rewind_max)
+		rewind_max = clocks;
+	SIM_CHECK(clocks <= SIM_FIFO_SIZE + 2);
+	SIM_CHECK(read_check(f, 0));
+}
+
+/*读一帧：查帧头，可能重读，查帧尾或跳过*/
+static void read_frame(int random)
+{
+	uint32_t fb = ov7725_pipe.frame_bytes;
+	uint32_t f = ov7725_pipe.read_seq + 1;
+	uint32_t r = random ? sim_rand() % 8 : 0;
+
+	SIM_CHECK(read_check(f, 0));
+	if(r < 3 || !random)
+		rewind_check(f);
+	if(r == 7)
+	{
+		OV7725_Frame_Skip(fb - CHECK_BYTES);
+		return;
+	}
+	OV7725_Skip(fb - 3 * CHECK_BYTES);
+	SIM_CHECK(read_check(f, fb - 2 * CHECK_BYTES));
+	if(r == 1)
+	{
+		rewind_check(f);                    /* 读到帧尾后重读，再跳到帧尾 */
+		OV7725_Skip(fb - 2 * CHECK_BYTES);
+	}
+	SIM_CHECK(read_check(f, fb - CHECK_BYTES));
+	OV7725_Frame_End();
+}
+
+static void pipe_reset(uint32_t frame_bytes, uint32_t seq)
+{
+	memset(&ov7725_pipe, 0, sizeof(ov7725_pipe));
+	ov7725_pipe.frame_bytes = frame_bytes;
+	ov7725_pipe.write_seq = ov7725_pipe.read_seq = ov7725_pipe.rewind_seq = seq;
+	rewinds = 0;
+	FIFO_PREPARE;
+}
+
+static void test_random(uint32_t frame_bytes, uint32_t frames)
+{
+	uint32_t n = 0, v;
+
+	pipe_reset(frame_bytes, 0xFFFFFF00u);
+	while(n < frames)
+	{
+		for(v = sim_rand() % 3; v > 0; v--)
+			vsync();
+		if(!OV7725_Frame_Begin())
+			continue;
+		if(sim_rand() % 64 == 0)
+		{
+			OV7725_Frame_Discard();
+			continue;
+		}
+		read_frame(1);
+		n++;
+	}
+	printf("  %6u B/frame: %u frames read at random, write pointer reset %u times, %u dropped, %u overrun\n",
+	       frame_bytes, frames, rewinds, ov7725_pipe.dropped, ov7725_pipe.overrun);
+}
+
+static void test_steady(uint32_t frame_bytes, uint32_t frames)
+{
+	uint32_t n;
+
+	pipe_reset(frame_bytes, 0xFFFFFF00u);
+	vsync();
+	vsync();
+	for(n = 0; n < frames; n++)
+	{
+		vsync();
+		SIM_CHECK(OV7725_Frame_Begin());
+		read_frame(0);
+	}
+	SIM_CHECK(rewinds == 1);
+	printf("  %6u B/frame: %u frames without the FIFO running empty, every one re-read\n", frame_bytes, frames);
+}
+
+int main(void)
+{
+	sim_init();
+	sim_srand(19);
+	test_random(320 * 240 * 2, 300);
+	test_random(160 * 120 * 2, 1000);
+	test_random(100 * 76 * 2, 2000);        /* 不整除FIFO容量 */
+	test_steady(320 * 240 * 2, 300);
+	test_steady(160 * 120 * 2, 3000);
+	printf("  longest re-read skip %u RCLK (FIFO %u bytes)\n", rewind_max, SIM_FIFO_SIZE);
+	return sim_done("test_pipe");
+}
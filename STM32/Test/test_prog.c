@@ -0,0 +1,164 @@
+/**
+  ******************************************************************************
+  * @file    test_prog.c
+  * @brief   渐进传输：接收端按包头把三遍的格点拼回一帧，与FIFO中的原图比较
+  ******************************************************************************
+  * @attention
+  *
+  * image.c、bsp_ov7725.c原样编译，读口接到shim/ov7725_fifo_sim.h的AL422B模型。
+  * 帧放在FIFO中read_addr起（有的跨过FIFO尾回绕），读指针就绪后
+  * PictureProgBegin()，PictureProgPack()取到返回0，每遍之间OV7725_Frame_Rewind()。
+  * 接收端只看包头（遍、格点起点步长、行数、首行、帧号）把像素放回原位，检查：
+  *   每个像素收到且只收到一次，与原图相同（灰度为Y）；
+  *   像素属于它的格点所在的遍：第0遍偶数行偶数列，第1遍偶数行奇数列，第2遍奇数行；
+  *   每包不超过PICTURE_PACKET_MAX，包长与行数相符，各遍的行接着上一包；
+  *   三遍读完读指针正好在帧尾，RCLK数为三遍整帧加两次重读（复位读指针、空读到帧头）
+  *
+  ******************************************************************************
+  */
+#define _POSIX_C_SOURCE     200112L     /* 不要sys/types.h里的u_int，与W5500的types.h冲突 */
+#include <string.h>
+#include "sim.h"
+#include "image.h"
+
+
+#define MAX_PIXELS          (640 * 300)
+
+extern OV7725_MODE_PARAM cam_mode;
+
+static uint32_t pkt_w[PICTURE_PACKET_MAX / 4];
+static uint8_t *pkt = (uint8_t *)pkt_w;
+static uint8_t  img[MAX_PIXELS * 2];    /* 接收端拼出的一帧 */
+static uint8_t  pass_of[MAX_PIXELS];    /* 每个像素在第几遍收到，0xFF为没收到 */
+
+static void fifo_at(uint32_t from)
+{
+	FIFO_PREPARE;
+	GPIOB->IDR = ((uint32_t)sim_fifo[from] << 8) | SIM_FIFO_IDR_LOW;
+	sim_fifo_rp = (from + 1) % SIM_FIFO_SIZE;
+}
+
+/*原图中(x, y)像素的第i字节，灰度只有Y*/
+static uint8_t src_byte(uint32_t addr, uint16_t width, uint16_t x, uint16_t y, uint8_t i)
+{
+	uint32_t pos = addr + ((uint32_t)y * width + x) * 2;
+
+	if(cam_mode.format == OV7725_FORMAT_GRAY)
+		pos += OV7725_Y_OFFSET;
+	else
+		pos += i;
+	return sim_fifo[pos % SIM_FIFO_SIZE];
+}
+
+static void check_frame(uint16_t width, uint16_t height, uint8_t format, uint32_t addr)
+{
+	uint8_t  bpp = (format == OV7725_FORMAT_GRAY) ? 1 : 2;
+	uint32_t frame_bytes = (uint32_t)width * height * 2;
+	uint32_t clocks, i, bad = 0, missing = 0, wrong_pass = 0;
+	uint16_t len, frame = 0, row_len, rows, row, x, y, k, packets = 0;
+	uint16_t next_row[PICTURE_PROG_PASSES] = {0, 0, 1};
+	uint8_t  pass, gx0, gxs, gy0, gys, b, expect;
+	uint8_t *o;
+
+	cam_mode.cam_width = width;
+	cam_mode.cam_height = height;
+	cam_mode.format = format;
+	ov7725_pipe.read_addr = addr;
+	ov7725_pipe.frame_bytes = frame_bytes;
+	memset(pass_of, 0xFF, sizeof(pass_of));
+	fifo_at(addr);
+	clocks = sim_fifo_clocks;
+	SIM_CHECK(PictureProgActive());
+	PictureProgBegin();
+	for(;;)
+	{
+		len = PictureProgPack(pkt);
+		if(len == 0)
+			break;
+		SIM_CHECK(len <= PICTURE_PACKET_MAX);
+		SIM_CHECK(pkt[0] == 0x55 && pkt[1] == 0xAA && pkt[2] == 'P' && pkt[4] == PICTURE_PROG_PASSES);
+		pass = pkt[3];
+		gx0 = pkt[5] >> 4;
+		gxs = pkt[5] & 0x0f;
+		gy0 = pkt[6] >> 4;
+		gys = pkt[6] & 0x0f;
+		rows = pkt[7];
+		row = (pkt[10] << 8) | pkt[11];
+		if(packets == 0)
+			frame = (pkt[8] << 8) | pkt[9];
+		SIM_CHECK(((pkt[8] << 8) | pkt[9]) == frame);
+		SIM_CHECK(pass < PICTURE_PROG_PASSES && gxs > 0 && gys > 0 && rows > 0);
+		SIM_CHECK(row == next_row[pass] && (row - gy0) % gys == 0);
+		row_len = (width - gx0 + gxs - 1) / gxs * bpp;
+		SIM_CHECK(len == PICTURE_PROG_HEAD_LEN + rows * row_len);
+		o = pkt + PICTURE_PROG_HEAD_LEN;
+		for(k = 0; k < rows; k++, row += gys)
+		{
+			for(x = gx0; x < width; x += gxs)
+			{
+				i = (uint32_t)row * width + x;
+				if(row >= height || pass_of[i] != 0xFF)
+					bad++;
+				else
+				{
+					pass_of[i] = pass;
+					for(b = 0; b < bpp; b++)
+						img[i * bpp + b] = o[b];
+				}
+				o += bpp;
+			}
+		}
+		next_row[pass] = row;
+		packets++;
+	}
+	SIM_CHECK(bad == 0);
+	for(y = 0; y < height; y++)
+	{
+		for(x = 0; x < width; x++)
+		{
+			i = (uint32_t)y * width + x;
+			if(pass_of[i] == 0xFF)
+			{
+				missing++;
+				continue;
+			}
+			expect = (y & 1) ? 2 : (x & 1);
+			if(pass_of[i] != expect)
+				wrong_pass++;
+			for(b = 0; b < bpp; b++)
+				if(img[i * bpp + b] != src_byte(addr, width, x, y, b))
+					bad++;
+		}
+	}
+	SIM_CHECK(missing == 0);
+	SIM_CHECK(wrong_pass == 0);
+	SIM_CHECK(bad == 0);
+	SIM_CHECK(PictureProgPack(pkt) == 0);
+	SIM_CHECK(sim_fifo_rp == (addr + frame_bytes + 1) % SIM_FIFO_SIZE);
+	/*每次重读FIFO_PREPARE两个RCLK，再空读到read_addr*/
+	SIM_CHECK(sim_fifo_clocks - clocks == PICTURE_PROG_PASSES * frame_bytes + (PICTURE_PROG_PASSES - 1) * (2 + addr));
+	printf("  %3ux%-3u %-6s at %6u%s: %3u packets, 3 passes, every pixel back in place\n",
+	       width, height, (format == OV7725_FORMAT_GRAY) ? "gray" : "RGB565", addr,
+	       (addr + frame_bytes > SIM_FIFO_SIZE) ? " (wraps)" : "        ", packets);
+}
+
+int main(void)
+{
+	uint32_t i;
+
+	sim_init();
+	sim_srand(19);
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)sim_rand();
+	picture_prog = 1;
+	check_frame(320, 240, OV7725_FORMAT_RGB565, 0);
+	check_frame(320, 240, OV7725_FORMAT_RGB565, 300000);
+	check_frame(320, 240, OV7725_FORMAT_GRAY, 153600);
+	check_frame(640, 300, OV7725_FORMAT_RGB565, 0);
+	check_frame(640, 300, OV7725_FORMAT_GRAY, 9216);
+	check_frame(160, 120, OV7725_FORMAT_GRAY, 390000);
+	check_frame(100, 76, OV7725_FORMAT_RGB565, 15200);
+	check_frame(36, 30, OV7725_FORMAT_GRAY, 393000);
+	picture_prog = 0;
+	return sim_done("test_prog");
+}
@@ -0,0 +1,179 @@
+/**
+  ******************************************************************************
+  * @file    test_rgb332.c
+  * @brief   OV7725_ReadRGB332：与直接按4x4 Bayer矩阵计算的参考结果比较，跨包的抖动相位
+  ******************************************************************************
+  * @attention
+  *
+  * bsp_ov7725.c原样编译，读口接到shim/ov7725_fifo_sim.h的AL422B模型。
+  * 参考实现不查表，逐像素拆出R、G、B，每个分量按
+  *   min(最大级, floor(v*最大级/输入最大值 + (M+0.5)/16))
+  * 计算，M为4x4 Bayer矩阵在(行&3, 列&3)处的值，结果要逐字节相同。
+  * 一帧按一包的行数（PicturePackingSet的规则：尽量多的整行，4的倍数）分几次读，
+  * 矩阵的行取帧中的行号，各包接起来抖动图案连续。
+  * 平场：4x4格内输出级的平均值与v*最大级/输入最大值相差不超过1/32级
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include <math.h>
+#include "sim.h"
+#include "./ov7725/bsp_ov7725.h"
+
+
+#define MAX_W               320         /* RGB332按RGB565读，一行不超过PICTURE_LINE_MAX字节 */
+#define PACKET_MAX          1472
+
+static const uint8_t bayer[4][4] = {
+	{ 0,  8,  2, 10},
+	{12,  4, 14,  6},
+	{ 3, 11,  1,  9},
+	{15,  7, 13,  5}
+};
+
+static uint8_t  out[240 * MAX_W + 16];
+static uint32_t raw_w[MAX_W * 4 / 4];
+static uint8_t *raw = (uint8_t *)raw_w;
+
+/*一个分量：v取0~in_max，输出0~out_max级*/
+static uint32_t level(uint32_t v, uint32_t in_max, uint32_t out_max, uint8_t m)
+{
+	uint32_t l = (32 * v * out_max + (2 * m + 1) * in_max) / (32 * in_max);
+
+	return (l > out_max) ? out_max : l;
+}
+
+static uint8_t rgb332_ref(uint16_t p, uint16_t line, uint16_t x)
+{
+	uint8_t m = bayer[line & 3][x & 3];
+
+	return (uint8_t)((level(p >> 11, 31, 7, m) << 5) | (level((p >> 5) & 0x3f, 63, 7, m) << 2) | level(p & 0x1f, 31, 3, m));
+}
+
+static void fifo_at(uint32_t from)
+{
+	FIFO_PREPARE;
+	GPIOB->IDR = ((uint32_t)sim_fifo[from] << 8) | SIM_FIFO_IDR_LOW;
+	sim_fifo_rp = (from + 1) % SIM_FIFO_SIZE;
+}
+
+/*从from起读width x height的一帧，每次读pkt_lines行（最后一次读剩下的），与参考比较*/
+static void check_frame(uint16_t width, uint16_t height, uint16_t pkt_lines, uint32_t from)
+{
+	uint32_t clocks, pos, bad = 0;
+	uint16_t y, x, n, p;
+	uint8_t *o = out;
+
+	fifo_at(from);
+	memset(out, 0xEE, sizeof(out));
+	clocks = sim_fifo_clocks;
+	for(y = 0; y < height; y += n)
+	{
+		n = (height - y < pkt_lines) ? height - y : pkt_lines;
+		SIM_CHECK(OV7725_ReadRGB332(o, width, n) == width * n);
+		o += width * n;
+	}
+	SIM_CHECK(sim_fifo_clocks - clocks == (uint32_t)width * height * 2);
+	SIM_CHECK(out[width * height] == 0xEE);
+	for(y = 0; y < height; y++)
+	{
+		for(x = 0; x < width; x++)
+		{
+			pos = (from + ((uint32_t)y * width + x) * 2) % SIM_FIFO_SIZE;
+			p = ((uint16_t)sim_fifo[pos] << 8) | sim_fifo[(pos + 1) % SIM_FIFO_SIZE];
+			if(out[y * width + x] != rgb332_ref(p, y, x))
+				bad++;
+		}
+	}
+	SIM_CHECK(bad == 0);
+}
+
+static void test_ref(void)
+{
+	static const uint16_t width[] = {320, 240, 160, 100, 16};
+	uint32_t i;
+	uint16_t lines;
+	int w, r;
+
+	for(i = 0; i < SIM_FIFO_SIZE; i++)
+		sim_fifo[i] = (uint8_t)sim_rand();
+	for(w = 0; w < (int)(sizeof(width) / sizeof(width[0])); w++)
+	{
+		lines = (PACKET_MAX / width[w]) & ~3;   //一包的行数，同PicturePackingSet
+		for(r = 0; r < 4; r++)
+		{
+			check_frame(width[w], 240, lines, sim_rand() % SIM_FIFO_SIZE);
+			check_frame(width[w], 36, 4, sim_rand() % SIM_FIFO_SIZE);
+		}
+	}
+	printf("  reference: 5 widths, packets of 4..%u lines, every pixel matches\n", (PACKET_MAX / 16) & ~3);
+}
+
+/*每个分量的每个值铺满4x4格，输出级平均后无偏*/
+static void test_flat(void)
+{
+	static const uint8_t shift[3] = {11, 5, 0}, max_in[3] = {31, 63, 31}, max_out[3] = {7, 7, 3}, pos[3] = {5, 2, 0};
+	double a, mean, err, err_max = 0;
+	uint32_t i, sum;
+	uint16_t p;
+	uint8_t c, v;
+
+	for(c = 0; c < 3; c++)
+	{
+		for(v = 0; v <= max_in[c]; v++)
+		{
+			p = (uint16_t)(v << shift[c]);
+			for(i = 0; i < 32; i++)
+				sim_fifo[i] = (i & 1) ? (uint8_t)p : (uint8_t)(p >> 8);
+			fifo_at(0);
+			OV7725_ReadRGB332(out, 4, 4);
+			for(i = 0, sum = 0; i < 16; i++)
+				sum += (out[i] >> pos[c]) & max_out[c];
+			a = (double)v * max_out[c] / max_in[c];
+			mean = sum / 16.0;
+			err = fabs(mean - a);
+			if(err > err_max)
+				err_max = err;
+			SIM_CHECK(err <= 1.0 / 32 + 1e-9);
+		}
+	}
+	printf("  flat fields: mean of a 4x4 tile within %.4f levels of the input (limit 1/32)\n", err_max);
+}
+
+static void bench(void)
+{
+	uint64_t t, t_332 = ~0ull, t_raw = ~0ull;
+	uint16_t y;
+	int r;
+
+	sim_fifo_bench = 1;
+	for(r = 0; r < 5; r++)
+	{
+		t = sim_ns();
+		for(y = 0; y < 240; y += 4)
+			OV7725_ReadRGB332(out, 320, 4);
+		t = sim_ns() - t;
+		if(t < t_332)
+			t_332 = t;
+		t = sim_ns();
+		for(y = 0; y < 240; y++)
+			OV7725_ReadLines(raw, 320, 1);
+		t = sim_ns() - t;
+		if(t < t_raw)
+			t_raw = t;
+	}
+	sim_fifo_bench = 0;
+	printf("  bench (host, QVGA RGB565 frame, best of 5):\n");
+	printf("    OV7725_ReadLines   %.2f ns/input byte\n", (double)t_raw / 153600);
+	printf("    OV7725_ReadRGB332  %.2f ns/input byte (%.2fx ReadLines)\n", (double)t_332 / 153600, (double)t_332 / t_raw);
+}
+
+int main(void)
+{
+	sim_init();
+	sim_srand(18);
+	test_ref();
+	test_flat();
+	bench();
+	return sim_done("test_rgb332");
+}
@@ -0,0 +1,461 @@
+/**
+  ******************************************************************************
+  * @file    test_ring.c
+  * @brief   包队列：采集、发送两个任务同时跑时的内容、顺序、引用计数和吞吐，与原来的队列对照
+  ******************************************************************************
+  * @attention
+  *
+  * image.c原样编译，OSMemGet/OSMemPut、信号量用sim.c的替身，两个pthread线程
+  * 按AppTaskOV7725、AppTaskSendPicture的写法当生产者和消费者：
+  *   生产者Reserve，没有空格就等picture_free_sem，包头包尾写序号后Commit；
+  *   消费者Peek，队列空等picture_ready_sem（10节拍超时，同发送任务），
+  *   读包头、（注入时让出CPU）、再读包尾，包被提前改写或交还就对不上，然后Release
+  * 检查每包都收到且只收到一次、按提交顺序、长度对，分区块数不漏不多。
+  * 消费者随机用PictureBufRef()把包留作“重传缓存”，过几包再PictureBufFree()；
+  * 生产者随机PictureFrameAbandon()，跳过的只能是作废代号的图像包；
+  * 一次跳过的几包只释放一次picture_free_sem。
+  *
+  *   单核：两个线程绑在同一个CPU上，相当于M3上的任务切换；
+  *   多核：不绑CPU，两边真正同时跑；
+  *   注入：每个__DMB()之后随机让出CPU，消费者发送中也让出，在这些地方切换任务
+  * 队列空时等待超时、醒来队列却不空，再等1秒也没有释放的次数记为漏唤醒，应为0。
+  * 吞吐是主机上的：一个线程轮流提交、取出时每包的纳秒数是队列本身的开销；
+  * 两个线程时包缓冲只有4块，双方大多在信号量上等，包/秒主要是替身里
+  * 线程挂起、唤醒的代价，不代表目标板（目标板上的瓶颈在SPI）。
+  *
+  * 对照：原来的PictureQueue（InitQueue、EnQueue、NextRear、DeQueue）照抄在这里，
+  * 生产者、消费者按原来AppTaskOV7725、AppTaskSendPicture的写法，跑同样的几种调度：
+  *   size在两个任务里都读改写，M3上是LDRB、ADDS、STRB，注入时在读、写之间让出CPU；
+  *   DeQueue先出队再发送，发送中格子可能被下一包改写：包头包尾对不上记为改写，
+  *   整包被改写则表现为这一包丢、下一包重复；
+  *   原来发送任务每次OSTimeDlyHMSM 1ms，这里队列空时只让出CPU，吞吐只比较队列本身
+  * 原队列的丢包、重复、乱序、包被改写只统计不判失败
+  *
+  ******************************************************************************
+  */
+#define _POSIX_C_SOURCE     200112L     /* 不要sys/types.h里的u_int，与W5500的types.h冲突 */
+#include <string.h>
+#include <sched.h>
+#include "sim.h"
+#include "image.h"
+
+
+#define HOLD_MAX            2           /* 同时留作重传缓存的包数，小于APP_CFG_PICTURE_BUF_COUNT-1 */
+
+static uint32_t packets;                /* 本轮要发的包数 */
+static volatile uint32_t produced;      /* 已提交的包数，作废的计入跳过 */
+static uint32_t abandon_every;          /* 0不作废，否则约每这么多包放弃一帧 */
+static uint8_t  *keep_flag;             /* 每包提交时的keep */
+static uint8_t  *got;                   /* 每包收到的次数 */
+static uint32_t late;                   /* 漏唤醒 */
+static volatile uint8_t stop;           /* 漏唤醒太多，每包要等超时，不跑完了 */
+static uint32_t dup, order, bad;
+static uint32_t yields;
+static uint8_t  send_yield;             /* 1：消费者读完包头让出CPU */
+
+#define BASE_SIZE           4           /* 原来的PictureMaxSize */
+
+/*原来的队列，Fornt从1、Rear从0开始，入队前先写NextRear()格*/
+static struct
+{
+	volatile uint8_t Fornt;
+	volatile uint8_t Rear;
+	volatile uint8_t size;
+}base_q;
+static uint8_t  base_data[BASE_SIZE][PICTURE_PACKET_MAX];
+static uint16_t base_len[BASE_SIZE];
+
+/*包序号决定的包长和包头包尾*/
+#define PKT_LEN(seq)        (uint16)(16 + (seq) * 37 % (PICTURE_PACKET_MAX - 15) / 4 * 4)
+
+static void pkt_fill(uint8_t *p, uint32_t seq)
+{
+	uint16 len = PKT_LEN(seq);
+
+	memcpy(p, &seq, 4);
+	memcpy(p + len - 4, &seq, 4);
+}
+
+/*两个线程各自的随机数，sim_rand()不是线程安全的*/
+static uint32_t rnd(void)
+{
+	static __thread uint32_t x = 0x2545F491u;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x;
+}
+
+/*每个__DMB()后随机让出CPU*/
+static void preempt(void)
+{
+	if((rnd() & 3) == 0)
+	{
+		yields++;
+		sched_yield();
+	}
+}
+
+static int Scc(int value)
+{
+	if (++value == BASE_SIZE)
+		value = 0;
+	return value;
+}
+
+/*size的读改写，读、写之间可能切换任务*/
+static void base_size_add(int d)
+{
+	uint8_t s = base_q.size;
+
+	if(sim_barrier)
+		sim_barrier();
+	base_q.size = s + d;
+}
+
+static uint8 EnQueue(void)
+{
+	if(base_q.size >= BASE_SIZE)
+		return 0;
+	base_size_add(1);
+	base_q.Rear = Scc(base_q.Rear);
+	return base_q.Rear;
+}
+
+static uint8 NextRear(void)
+{
+	return Scc(base_q.Rear);
+}
+
+static uint8 DeQueue(void)
+{
+	uint8 temp_fornt;
+	OS_ERR err;
+
+	if(base_q.size == 0)
+		return 0;
+	temp_fornt = base_q.Fornt;
+	base_size_add(-1);
+	base_q.Fornt = Scc(base_q.Fornt);
+	OSSemPost(&picture_free_sem, OS_OPT_POST_1, &err);
+	return temp_fornt;
+}
+
+static void *base_producer(void *arg)
+{
+	OS_ERR err;
+	uint32_t seq;
+	uint8 i;
+
+	(void)arg;
+	for(seq = 0; seq < packets; seq++)
+	{
+		while(base_q.size >= BASE_SIZE)
+			OSSemPend(&picture_free_sem, 100, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+		i = NextRear();
+		pkt_fill(base_data[i], seq);
+		base_len[i] = PKT_LEN(seq);
+		EnQueue();
+		produced = seq + 1;
+	}
+	return NULL;
+}
+
+static void *base_consumer(void *arg)
+{
+	uint32_t seq, tail_seq, last = 0, n, first = 1;
+	uint16 len;
+	uint8 i;
+
+	(void)arg;
+	for(n = 0; n < 4 * packets; n++)      /* size乱了可能多取，不会一直取 */
+	{
+		if(base_q.size == 0)
+		{
+			if(produced == packets)
+				break;
+			sched_yield();
+			continue;
+		}
+		i = DeQueue();
+		memcpy(&seq, base_data[i], 4);
+		if(send_yield)
+			sched_yield();
+		len = base_len[i];
+		if(seq >= packets || len != PKT_LEN(seq))
+		{
+			bad++;
+			continue;
+		}
+		memcpy(&tail_seq, base_data[i] + len - 4, 4);
+		if(tail_seq != seq)
+			bad++;
+		if(got[seq]++)
+			dup++;
+		if(!first && seq <= last)
+			order++;
+		first = 0;
+		last = seq;
+	}
+	return NULL;
+}
+
+static void *producer(void *arg)
+{
+	OS_ERR err;
+	uint8_t *p;
+	uint32_t seq;
+
+	(void)arg;
+	for(seq = 0; seq < packets && !stop; seq++)
+	{
+		while((p = PictureRingReserve()) == NULL && !stop)
+			OSSemPend(&picture_free_sem, 100, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+		if(p == NULL)
+			break;
+		pkt_fill(p, seq);
+		keep_flag[seq] = (seq % 13 == 0);   /* 参数包、统计包 */
+		PictureRingCommit(PKT_LEN(seq), keep_flag[seq]);
+		produced = seq + 1;
+		if(abandon_every && seq % abandon_every == abandon_every - 1)
+			PictureFrameAbandon(1);
+	}
+	return NULL;
+}
+
+static void *consumer(void *arg)
+{
+	OS_ERR err;
+	PICTURE_BUF *buf, *hold[HOLD_MAX];
+	uint32_t seq, tail_seq, last = 0, n, holds = 0, first = 1, i;
+
+	(void)arg;
+	for(n = 0;;)
+	{
+		buf = PictureRingPeek();
+		if(buf == NULL)
+		{
+			if(produced == packets && PictureRingCount() == 0)
+				break;
+			OSSemPend(&picture_ready_sem, 10, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+			if(err == OS_ERR_TIMEOUT && PictureRingCount() != 0)
+			{
+				/*超时和提交可能刚好同时，提交时会释放；再等1秒仍没有才是漏唤醒*/
+				OSSemPend(&picture_ready_sem, 1000, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+				if(err == OS_ERR_TIMEOUT && ++late == 3)
+					stop = 1;
+			}
+			if(stop)
+				break;
+			continue;
+		}
+		memcpy(&seq, buf->data, 4);
+		if(send_yield)
+			sched_yield();                   /* 发送中，生产者可以跑 */
+		if(seq >= packets || buf->len != PKT_LEN(seq))
+		{
+			bad++;
+			PictureRingRelease();
+			continue;
+		}
+		memcpy(&tail_seq, buf->data + buf->len - 4, 4);
+		if(tail_seq != seq)
+			bad++;
+		if(got[seq]++)
+			dup++;
+		if(!first && seq <= last)
+			order++;
+		first = 0;
+		last = seq;
+		n++;
+		if(holds < HOLD_MAX && (rnd() & 7) == 0)
+		{
+			PictureBufRef(buf);
+			hold[holds++] = buf;
+		}
+		PictureRingRelease();
+		if(holds == HOLD_MAX)
+		{
+			for(i = 0; i < holds; i++)
+			{
+				memcpy(&seq, hold[i]->data, 4);     /* 留着的包不会被重用 */
+				if(seq >= packets || !got[seq])
+					bad++;
+				PictureBufFree(hold[i]);
+			}
+			holds = 0;
+		}
+	}
+	for(i = 0; i < holds; i++)
+		PictureBufFree(hold[i]);
+	return NULL;
+}
+
+/*原来的队列跑一轮，调度同run()，只统计*/
+static void run_base(const char *name, uint32_t n, int cpu, int inject)
+{
+	uint64_t t;
+	uint32_t i, lost = 0;
+
+	packets = n;
+	produced = 0;
+	dup = order = bad = yields = 0;
+	got = calloc(n, 1);
+	send_yield = inject;
+	base_q.Fornt = 1;
+	base_q.Rear = 0;
+	base_q.size = 0;
+	OSSemSet(&picture_free_sem, 0, &(OS_ERR){0});
+	sim_barrier = inject ? preempt : NULL;
+
+	t = sim_ns();
+	sim_run2(base_consumer, base_producer, cpu);
+	t = sim_ns() - t;
+	sim_barrier = NULL;
+	OSSemSet(&picture_free_sem, 0, &(OS_ERR){0});
+
+	for(i = 0; i < n; i++)
+		if(!got[i])
+			lost++;
+	printf("  queue %-9s %8u pkts %6.2f Mpkt/s  lost %u, dup %u, order %u, overwritten %u, yields %u\n",
+	       name, n, n / (t / 1e3), lost, dup, order, bad, yields);
+	free(got);
+}
+
+/*跑一轮，cpu<0不绑CPU；inject为1时在屏障处、消费者发送中让出CPU，为0时测吞吐*/
+static void run(const char *name, uint32_t n, int cpu, int inject, uint32_t abandon)
+{
+	uint64_t t;
+	uint32_t i, lost = 0, skipped = 0;
+	uint32_t alloc = picture_buf_stat.alloc, drop = picture_latest_stat.packets;
+
+	packets = n;
+	produced = 0;
+	abandon_every = abandon;
+	late = dup = order = bad = yields = 0;
+	stop = 0;
+	keep_flag = calloc(n, 1);
+	got = calloc(n, 1);
+	send_yield = inject;
+	sim_barrier = inject ? preempt : NULL;
+
+	t = sim_ns();
+	sim_run2(consumer, producer, cpu);
+	t = sim_ns() - t;
+	sim_barrier = NULL;
+
+	for(i = 0; i < n; i++)
+		if(!got[i])
+		{
+			if(keep_flag[i] || !abandon)
+				lost++;
+			skipped++;
+		}
+	drop = picture_latest_stat.packets - drop;
+	SIM_CHECK(lost == 0);
+	SIM_CHECK(skipped == drop);
+	SIM_CHECK(dup == 0);
+	SIM_CHECK(order == 0);
+	SIM_CHECK(bad == 0);
+	SIM_CHECK(late == 0);
+	SIM_CHECK(PictureRingCount() == 0);
+	SIM_CHECK(picture_buf_stat.used == 0);
+	SIM_CHECK(picture_mem.NbrFree == APP_CFG_PICTURE_BUF_COUNT);
+	SIM_CHECK(picture_buf_stat.alloc - alloc == n);
+	printf("  ring  %-9s %8u pkts %6.2f Mpkt/s  skipped %u, lost %u, dup %u, order %u, bad %u, late wakeups %u, yields %u\n",
+	       name, n, n / (t / 1e3), skipped, lost, dup, order, bad, late, yields);
+	free(keep_flag);
+	free(got);
+	if(stop)
+		exit(sim_done("test_ring"));    /* 队列里还有包，后面的不跑了 */
+}
+
+/*放弃一帧后队列里的3个图像包一次跳过，picture_free_sem只释放一次*/
+static void test_peek_batch(void)
+{
+	OS_SEM_CTR ctr;
+	PICTURE_BUF *buf;
+	uint32_t seq, drop = picture_latest_stat.packets;
+
+	for(seq = 0; seq < 3; seq++)
+	{
+		pkt_fill(PictureRingReserve(), seq);
+		PictureRingCommit(PKT_LEN(seq), 0);
+	}
+	PictureFrameAbandon(1);
+	pkt_fill(PictureRingReserve(), 3);
+	PictureRingCommit(PKT_LEN(3), 1);
+	ctr = picture_free_sem.Ctr;
+	buf = PictureRingPeek();
+	SIM_CHECK(buf != NULL && memcmp(buf->data, &(uint32_t){3}, 4) == 0);
+	SIM_CHECK(picture_free_sem.Ctr == ctr + 1);
+	SIM_CHECK(picture_latest_stat.packets - drop == 3);
+	SIM_CHECK(picture_mem.NbrFree == APP_CFG_PICTURE_BUF_COUNT - 1);
+	PictureRingRelease();
+	SIM_CHECK(picture_free_sem.Ctr == ctr + 2);
+	SIM_CHECK(PictureRingPeek() == NULL && picture_free_sem.Ctr == ctr + 2);
+	SIM_CHECK(picture_mem.NbrFree == APP_CFG_PICTURE_BUF_COUNT);
+	OSSemSet(&picture_free_sem, 0, &(OS_ERR){0});
+}
+
+/*一个线程里轮流提交、取出，队列本身（含分区申请、交还）每包的开销*/
+static void bench_single(uint32_t n)
+{
+	uint64_t t;
+	uint32_t seq;
+	uint8_t *p;
+	PICTURE_BUF *buf;
+
+	t = sim_ns();
+	for(seq = 0; seq < n; seq++)
+	{
+		p = PictureRingReserve();
+		pkt_fill(p, seq);
+		PictureRingCommit(PKT_LEN(seq), 0);
+		buf = PictureRingPeek();
+		if(buf == NULL || buf->data != p)
+			bad++;
+		PictureRingRelease();
+	}
+	t = sim_ns() - t;
+	SIM_CHECK(bad == 0);
+	SIM_CHECK(picture_buf_stat.used == 0);
+	printf("  one thread %7u pkts %6.1f ns/pkt for Reserve+Commit+Peek+Release\n", n, (double)t / n);
+
+	base_q.Fornt = 1;
+	base_q.Rear = 0;
+	base_q.size = 0;
+	t = sim_ns();
+	for(seq = 0; seq < n; seq++)
+	{
+		pkt_fill(base_data[NextRear()], seq);
+		EnQueue();
+		if(memcmp(base_data[DeQueue()], &seq, 4) != 0)
+			bad++;
+	}
+	t = sim_ns() - t;
+	SIM_CHECK(bad == 0);
+	OSSemSet(&picture_free_sem, 0, &(OS_ERR){0});
+	printf("  one thread %7u pkts %6.1f ns/pkt for NextRear+EnQueue+DeQueue (old queue)\n", n, (double)t / n);
+}
+
+int main(void)
+{
+	sim_init();
+	PictureRingInit();
+	test_peek_batch();
+	bench_single(1000000);
+	run_base("1 CPU", 300000, 0, 0);
+	run("1 CPU", 300000, 0, 0, 0);
+	run_base("SMP", 300000, -1, 0);
+	run("SMP", 300000, -1, 0, 0);
+	run_base("inject", 100000, 0, 1);
+	run("inject", 100000, 0, 1, 0);
+	run_base("inject", 100000, -1, 1);
+	run("inject", 100000, -1, 1, 0);
+	run("abandon", 100000, 0, 1, 50);
+	run("abandon", 300000, -1, 0, 50);
+	printf("  depth %u, %u buffers, %u bytes each\n", PictureMaxSize, APP_CFG_PICTURE_BUF_COUNT, (unsigned)sizeof(PICTURE_BUF));
+	return sim_done("test_ring");
+}
@@ -0,0 +1,574 @@
+/**
+  ******************************************************************************
+  * @file    test_sccb.c
+  * @brief   SCCB定时器状态机：操作表在总线上的波形、从机应答和出错处理
+  ******************************************************************************
+  * @attention
+  *
+  * bsp_sccb.c原样编译，引脚接到本文件的OV7725 SCCB从机模型（shim/sccb_sim.h）。
+  * 任务在SCCB_Xfer_Wait里挂起时，按TIM6是否在计数逐拍调用SCCB_Tick，
+  * 相当于定时器中断；返回1时调用SCCB_Done，与SCCB_TIM_INT_FUNCTION一致。
+  *
+  * 从机在SCL上升沿采样、下降沿改SDA，检查：
+  *   SDA只在SCL为低时变化，起始、停止之外SCL为高时SDA不动
+  *   SCL每个高、低电平至少一拍，起始、停止与SCL的变化不在同一拍
+  *   写入、读出的寄存器值，每个寄存器的拍数，出错时总线释放
+  * 改窗口、开关彩条按原来的读改写（本文件里的base_xxx）和bsp_ov7725.c的寄存器影子
+  * 各做一遍，两边传感器寄存器相同，比较总线传输次数和时间；影子读回校验发现不符时重写
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include "sim.h"
+#include "./sccb/bsp_sccb.h"
+#include "./ov7725/bsp_ov7725.h"
+
+
+uint32_t SystemCoreClock = 72000000;
+
+#define P_IDLE              0
+#define P_DEV               1       /* 收器件地址 */
+#define P_REG               2       /* 收寄存器地址 */
+#define P_DATA              3       /* 收寄存器值 */
+#define P_TX                4       /* 发寄存器值 */
+#define P_NAK               5       /* 不应答，等停止 */
+
+#define TICK_LIMIT          100000
+
+static struct
+{
+	uint8_t  scl, sda_m, sda_s;     /* SCL，主机SDA，从机SDA（1为释放） */
+	uint8_t  phase, next;
+	uint8_t  bits;                  /* 本字节已过的SCL上升沿 */
+	uint8_t  byte;
+	uint8_t  reg;
+	uint8_t  stuck;                 /* 1：SDA被别的器件拉低 */
+	int32_t  ack_left;              /* 还应答几次器件地址，<0为一直应答 */
+	uint32_t starts, stops, bad;    /* bad：违反时序或协议的次数 */
+	uint8_t  regs[256];
+}slv;
+
+static uint32_t tick_now;
+static uint32_t scl_tick;           /* SCL上次变化的拍 */
+static uint32_t bus_ticks;          /* 本批的拍数 */
+static uint8_t  tick_budget;        /* 非0：sim_idle只走这么多拍，模拟超时 */
+
+static uint8_t bus_sda(void)
+{
+	return slv.sda_m & slv.sda_s & !slv.stuck;
+}
+
+static void slave_reset(void)
+{
+	uint8_t regs[256];
+
+	memcpy(regs, slv.regs, sizeof(regs));
+	memset(&slv, 0, sizeof(slv));
+	memcpy(slv.regs, regs, sizeof(regs));
+	slv.scl = slv.sda_m = slv.sda_s = 1;
+	slv.ack_left = -1;
+}
+
+static void slave_rise(void)
+{
+	if(slv.phase == P_IDLE || slv.phase == P_NAK)
+		return;
+	slv.bits++;
+	if(slv.bits <= 8)
+	{
+		if(slv.phase != P_TX)
+			slv.byte = (uint8_t)((slv.byte << 1) | bus_sda());
+	}
+	else if(slv.phase == P_TX && bus_sda())
+		slv.phase = P_NAK;                  /* 主机NACK，读结束 */
+}
+
+static void slave_fall(void)
+{
+	if(slv.phase == P_IDLE)
+		return;
+	if(slv.phase == P_NAK)
+	{
+		slv.sda_s = 1;
+		return;
+	}
+	if(slv.bits == 8 && slv.phase != P_TX)
+	{
+		uint8_t ack = 1;
+
+		switch(slv.phase)
+		{
+			case P_DEV:
+				if((slv.byte & 0xFE) != ADDR_OV7725 || slv.ack_left == 0)
+				{
+					ack = 0;
+					slv.next = P_NAK;
+					break;
+				}
+				if(slv.ack_left > 0)
+					slv.ack_left--;
+				slv.next = (slv.byte & 1) ? P_TX : P_REG;
+				break;
+			case P_REG:
+				slv.reg = slv.byte;
+				slv.next = P_DATA;
+				break;
+			default:
+				slv.regs[slv.reg++] = slv.byte;
+				slv.next = P_DATA;
+				break;
+		}
+		slv.sda_s = ack ? 0 : 1;
+	}
+	else if(slv.bits == 9)
+	{
+		slv.sda_s = 1;
+		slv.bits = 0;
+		slv.byte = 0;
+		if(slv.phase != P_TX)
+			slv.phase = slv.next;
+		if(slv.phase == P_TX)
+		{
+			slv.byte = slv.regs[slv.reg];
+			slv.sda_s = slv.byte >> 7;
+		}
+	}
+	else if(slv.phase == P_TX)
+	{
+		slv.sda_s = (slv.bits < 8) ? (slv.byte >> (7 - slv.bits)) & 1 : 1;
+	}
+}
+
+void sim_sccb_pin(uint8_t pin, uint8_t level)
+{
+	uint8_t old = bus_sda();
+
+	if(pin == SIM_SCCB_SCL)
+	{
+		if(level == slv.scl)
+			return;
+		if(scl_tick == tick_now && tick_now != 0)
+			slv.bad++;                          /* 一拍里SCL变了两次 */
+		scl_tick = tick_now;
+		slv.scl = level;
+		if(level)
+			slave_rise();
+		else
+			slave_fall();
+		return;
+	}
+	slv.sda_m = level;
+	if(!slv.scl || bus_sda() == old)
+		return;
+	if(scl_tick == tick_now && tick_now != 0)
+		slv.bad++;                              /* 起始、停止与SCL在同一拍 */
+	if(!bus_sda())
+	{
+		if(slv.phase != P_IDLE)
+			slv.bad++;                          /* SCCB不用重复起始，这是数据位里的SDA跳变 */
+		slv.starts++;
+		slv.phase = P_DEV;
+		slv.bits = 0;
+		slv.byte = 0;
+	}
+	else
+	{
+		if(slv.bits > 1 && slv.phase != P_NAK)
+			slv.bad++;                          /* 字节中间的停止（停止本身有一个SCL上升沿） */
+		slv.stops++;
+		slv.phase = P_IDLE;
+		slv.sda_s = 1;
+	}
+}
+
+uint8_t sim_sccb_read(uint8_t pin)
+{
+	return (pin == SIM_SCCB_SCL) ? slv.scl : bus_sda();
+}
+
+/*任务挂起期间TIM6在跑：逐拍调用中断里做的事*/
+static void run_bus(void)
+{
+	uint32_t n = 0;
+
+	while(SCCB_TIM->CR1 & TIM_CR1_CEN)
+	{
+		if(tick_budget && n == tick_budget)
+			return;
+		if(++n > TICK_LIMIT)
+		{
+			printf("  FAIL bus did not finish\n");
+			sim_fail++;
+			return;
+		}
+		tick_now++;
+		bus_ticks++;
+		if(SCCB_Tick())
+			SCCB_Done();
+	}
+}
+
+static ErrorStatus xfer_run(SCCB_XFER *xfer, SCCB_REG *regs, uint8_t n, uint8_t read)
+{
+	xfer->regs = regs;
+	xfer->n = n;
+	xfer->read = read;
+	bus_ticks = 0;
+	if(SCCB_Xfer_Start(xfer) != SUCCESS)
+		return ERROR;
+	return SCCB_Xfer_Wait(xfer, SCCB_TIMEOUT);
+}
+
+/*传完或出错后总线必须释放，起始和停止成对*/
+static void check_idle(void)
+{
+	SIM_CHECK(slv.scl == 1 && slv.sda_m == 1);
+	SIM_CHECK(slv.phase == P_IDLE);
+	SIM_CHECK(slv.starts == slv.stops);
+	SIM_CHECK(slv.bad == 0);
+	SIM_CHECK(!(SCCB_TIM->CR1 & TIM_CR1_CEN));
+}
+
+#define BATCH               16          /* 同OV7725_REG_BATCH */
+
+static SCCB_REG regs[BATCH];
+static uint32_t write_ticks, read_ticks;
+
+static void test_write(void)
+{
+	SCCB_XFER xfer;
+	int i;
+
+	slave_reset();
+	memset(slv.regs, 0, sizeof(slv.regs));
+	for(i = 0; i < BATCH; i++)
+	{
+		regs[i].addr = (uint8_t)(0x10 + i * 5);
+		regs[i].value = (uint8_t)sim_rand();
+	}
+	SIM_CHECK(xfer_run(&xfer, regs, BATCH, 0) == SUCCESS);
+	SIM_CHECK(xfer.state == SCCB_XFER_OK && xfer.done == BATCH);
+	for(i = 0; i < BATCH; i++)
+		SIM_CHECK(slv.regs[regs[i].addr] == regs[i].value);
+	SIM_CHECK(slv.starts == BATCH);
+	check_idle();
+	write_ticks = bus_ticks / BATCH;
+	SIM_CHECK(bus_ticks % BATCH == 0);
+	SIM_CHECK(write_ticks == 2 + 3 * 9 * SCCB_TICKS_PER_BIT + 3);    /* 起始 3字节 停止 */
+}
+
+static void test_read(void)
+{
+	SCCB_XFER xfer;
+	uint8_t buf[4];
+	int i;
+
+	slave_reset();
+	for(i = 0; i < 256; i++)
+		slv.regs[i] = (uint8_t)sim_rand();
+	for(i = 0; i < BATCH; i++)
+	{
+		regs[i].addr = (uint8_t)(0x80 + i * 3);
+		regs[i].value = 0;
+	}
+	SIM_CHECK(xfer_run(&xfer, regs, BATCH, 1) == SUCCESS);
+	SIM_CHECK(xfer.done == BATCH);
+	for(i = 0; i < BATCH; i++)
+		SIM_CHECK(regs[i].value == slv.regs[regs[i].addr]);
+	SIM_CHECK(slv.starts == BATCH * 2);
+	check_idle();
+	read_ticks = bus_ticks / BATCH;
+	SIM_CHECK(read_ticks == 2 * (2 + 2 * 9 * SCCB_TICKS_PER_BIT + 3));
+
+	/*原来的单字节接口*/
+	slave_reset();
+	SIM_CHECK(SCCB_WriteByte(0x12, 0x5A) == ENABLE);
+	SIM_CHECK(slv.regs[0x12] == 0x5A);
+	slv.regs[0x0b] = 0x21;
+	slv.regs[0x0c] = 0x77;
+	SIM_CHECK(SCCB_ReadByte(buf, 2, 0x0b) == ENABLE);
+	SIM_CHECK(buf[0] == 0x21 && buf[1] == 0x77);
+	check_idle();
+}
+
+static void test_errors(void)
+{
+	SCCB_XFER xfer;
+	uint32_t errors = sccb_stat.errors;
+	int i;
+
+	for(i = 0; i < BATCH; i++)
+	{
+		regs[i].addr = (uint8_t)i;
+		regs[i].value = (uint8_t)(i + 1);
+	}
+
+	/*器件不在：第一个器件地址就无应答*/
+	slave_reset();
+	memset(slv.regs, 0, sizeof(slv.regs));
+	slv.ack_left = 0;
+	SIM_CHECK(xfer_run(&xfer, regs, BATCH, 0) == ERROR);
+	SIM_CHECK(xfer.state == SCCB_XFER_ERR && xfer.done == 0);
+	SIM_CHECK(slv.starts == 1);
+	check_idle();
+
+	/*传到一半器件不应答：done为已写完的个数，后面的没有写*/
+	slave_reset();
+	slv.ack_left = 5;
+	SIM_CHECK(xfer_run(&xfer, regs, BATCH, 0) == ERROR);
+	SIM_CHECK(xfer.done == 5);
+	SIM_CHECK(slv.regs[4] == 5 && slv.regs[5] == 0);
+	check_idle();
+
+	/*读到一半器件不应答*/
+	slave_reset();
+	slv.ack_left = 7;                   /* 3个寄存器，第4个写地址时无应答 */
+	SIM_CHECK(xfer_run(&xfer, regs, BATCH, 1) == ERROR);
+	SIM_CHECK(xfer.done == 3);
+	check_idle();
+
+	/*SDA被拉低：起始时发现总线忙*/
+	slave_reset();
+	slv.stuck = 1;
+	SIM_CHECK(xfer_run(&xfer, regs, BATCH, 0) == ERROR);
+	SIM_CHECK(xfer.done == 0);
+	slv.stuck = 0;
+	SIM_CHECK(slv.scl == 1 && slv.sda_m == 1);
+	SIM_CHECK(!(SCCB_TIM->CR1 & TIM_CR1_CEN));
+	SIM_CHECK(sccb_stat.errors == errors + 4);
+
+	/*超时：挂起期间定时器只走了几拍，中止后总线释放，下一批正常*/
+	slave_reset();
+	tick_budget = 30;
+	SIM_CHECK(xfer_run(&xfer, regs, BATCH, 0) == ERROR);
+	tick_budget = 0;
+	SIM_CHECK(xfer.state == SCCB_XFER_ERR);
+	SIM_CHECK(sccb_stat.timeouts == 1);
+	SIM_CHECK(!(SCCB_TIM->CR1 & TIM_CR1_CEN));
+	SIM_CHECK(slv.scl == 1 && slv.sda_m == 1);
+	slave_reset();
+	SIM_CHECK(xfer_run(&xfer, regs, 2, 0) == SUCCESS);
+	check_idle();
+}
+
+/*---------------- 改窗口、彩条的总线开销：寄存器影子与原来的读改写 ----------------*/
+
+/*同bsp_ov7725.c*/
+typedef struct
+{
+	uint8_t Address;
+	uint8_t Value;
+}Reg_Info;
+
+extern Reg_Info Sensor_Config[];
+extern uint8_t OV7725_REG_NUM;
+extern OV7725_MODE_PARAM cam_mode;
+
+static uint8_t base_regs[256], shadow_regs[256];   /* 两种写法各自的传感器寄存器 */
+static uint32_t cost_starts, cost_ticks;
+
+static uint8_t base_default(uint8_t reg)
+{
+	uint8_t i;
+
+	for(i = 0; i < OV7725_REG_NUM; i++)
+	{
+		if(Sensor_Config[i].Address == reg)
+			return Sensor_Config[i].Value;
+	}
+	return 0;
+}
+
+/*原来的OV7725_Window_Set：每个寄存器直接写，加偏移前从传感器读原值*/
+static void base_window_set(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height, uint8_t QVGA_VGA)
+{
+	uint8_t reg_raw;
+
+	if(QVGA_VGA == 0)
+		SCCB_WriteByte(REG_COM7, (cam_mode.format == OV7725_FORMAT_RGB565) ? 0x46 : 0x40);
+	else
+		SCCB_WriteByte(REG_COM7, (cam_mode.format == OV7725_FORMAT_RGB565) ? 0x06 : 0x00);
+	SCCB_ReadByte(&reg_raw, 1, REG_HSTART);
+	SCCB_WriteByte(REG_HSTART, reg_raw + (sx >> 2));
+	SCCB_WriteByte(REG_HSIZE, width >> 2);
+	SCCB_ReadByte(&reg_raw, 1, REG_VSTRT);
+	SCCB_WriteByte(REG_VSTRT, reg_raw + (sy >> 1));
+	SCCB_WriteByte(REG_VSIZE, height >> 1);
+	SCCB_ReadByte(&reg_raw, 1, REG_HREF);
+	SCCB_WriteByte(REG_HREF, reg_raw | (width & 0x03) | ((height & 0x01) << 2) | ((sx & 0x03) << 4) | ((sy & 0x01) << 6));
+	SCCB_WriteByte(REG_HOutSize, width >> 2);
+	SCCB_WriteByte(REG_VOutSize, height >> 1);
+	SCCB_ReadByte(&reg_raw, 1, REG_EXHCH);
+	SCCB_WriteByte(REG_EXHCH, reg_raw | (width & 0x03) | ((height & 0x01) << 2));
+}
+
+/*原来的OV7725_Window_Change的寄存器部分*/
+static void base_window_change(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height, uint8_t QVGA_VGA)
+{
+	SCCB_WriteByte(REG_HSTART, QVGA_VGA ? OV7725_VGA_HSTART : base_default(REG_HSTART));
+	SCCB_WriteByte(REG_VSTRT,  QVGA_VGA ? OV7725_VGA_VSTRT : base_default(REG_VSTRT));
+	SCCB_WriteByte(REG_HREF,   base_default(REG_HREF));
+	SCCB_WriteByte(REG_EXHCH,  base_default(REG_EXHCH));
+	base_window_set(sx, sy, width, height, QVGA_VGA);
+}
+
+/*原来的OV7725_ColorBar*/
+static void base_colorbar(uint8_t on)
+{
+	uint8_t reg_raw;
+
+	SCCB_ReadByte(&reg_raw, 1, REG_COM3);
+	if(on)
+		reg_raw |= 0x01;
+	else
+		reg_raw &= ~0x01;
+	SCCB_WriteByte(REG_COM3, reg_raw);
+}
+
+static void cost_begin(uint8_t *regs)
+{
+	slave_reset();
+	memcpy(slv.regs, regs, sizeof(slv.regs));
+	cost_starts = slv.starts;
+	cost_ticks = tick_now;
+}
+
+static void cost_end(uint8_t *regs, uint32_t *starts, uint32_t *ticks)
+{
+	check_idle();
+	memcpy(regs, slv.regs, sizeof(slv.regs));
+	*starts = slv.starts - cost_starts;
+	*ticks = tick_now - cost_ticks;
+}
+
+#define OP_WINDOW           0
+#define OP_BAR              1
+
+typedef struct
+{
+	uint8_t     op;
+	uint16_t    sx, sy, width, height;
+	uint8_t     vga;                /* 彩条：1打开 0关闭 */
+	const char *name;
+}SHADOW_CASE;
+
+static const SHADOW_CASE shadow_cases[] = {
+	{OP_WINDOW,  0,  0, 160, 120, 0, "window resize 320x240 -> 160x120"},
+	{OP_WINDOW, 80, 60, 160, 120, 0, "window move to 80,60"},
+	{OP_WINDOW, 84, 62, 160, 120, 0, "window move by 4,2"},
+	{OP_WINDOW, 84, 62, 160, 120, 0, "same window again"},
+	{OP_WINDOW,  0,  0, 640, 300, 1, "QVGA -> VGA 640x300"},
+	{OP_WINDOW,  0,  0, 320, 240, 0, "VGA -> QVGA 320x240"},
+	{OP_BAR,     0,  0,   0,   0, 1, "colour bar on"},
+	{OP_BAR,     0,  0,   0,   0, 0, "colour bar off"},
+};
+
+/*同一串操作分别按原来的写法和影子写法做，两边传感器寄存器要相同；
+  影子的读回校验每帧一次读，单独统计*/
+static void test_shadow(void)
+{
+	uint32_t irq_hz = SCCB_BUS_HZ * SCCB_TICKS_PER_BIT;
+	uint32_t base_starts, base_ticks, sh_starts, sh_ticks, load_starts, load_ticks, verified;
+	uint32_t total_base = 0, total_sh = 0;
+	const SHADOW_CASE *c;
+	int i, k;
+
+	slave_reset();
+	for(i = 0; i < 256; i++)
+		slv.regs[i] = (uint8_t)sim_rand();
+	for(i = 0; i < OV7725_REG_NUM; i++)
+		slv.regs[Sensor_Config[i].Address] = Sensor_Config[i].Value;
+	memcpy(base_regs, slv.regs, sizeof(base_regs));
+	memcpy(shadow_regs, slv.regs, sizeof(shadow_regs));
+	ov7725_present = 1;
+	cam_mode.format = OV7725_FORMAT_RGB565;
+
+	cost_begin(shadow_regs);
+	OV7725_Reg_Load();
+	cost_end(shadow_regs, &load_starts, &load_ticks);
+	SIM_CHECK(load_starts == 2 * (OV7725_REG_LAST + 1));
+
+	printf("  register shadow vs read-modify-write (bus transactions, bus time):\n");
+	printf("    %-34s  %-14s %-14s %s\n", "", "before", "shadow", "verify reads");
+	for(k = 0; k < (int)(sizeof(shadow_cases) / sizeof(shadow_cases[0])); k++)
+	{
+		c = &shadow_cases[k];
+		cost_begin(base_regs);
+		if(c->op == OP_WINDOW)
+			base_window_change(c->sx, c->sy, c->width, c->height, c->vga);
+		else
+			base_colorbar(c->vga);
+		cost_end(base_regs, &base_starts, &base_ticks);
+
+		cost_begin(shadow_regs);
+		if(c->op == OP_WINDOW)
+			SIM_CHECK(OV7725_Window_Change(c->sx, c->sy, c->width, c->height, c->vga) == SUCCESS);
+		else
+		{
+			SIM_CHECK(OV7725_ColorBar(c->vga) == SUCCESS);
+			OV7725_Reg_Flush();         /* 采集任务在帧间隙写出 */
+		}
+		cost_end(shadow_regs, &sh_starts, &sh_ticks);
+
+		/*之后每帧读回一个*/
+		verified = ov7725_reg_stat.verified;
+		cost_begin(shadow_regs);
+		for(i = 0; i < 256; i++)
+			OV7725_Reg_Verify();
+		check_idle();
+		verified = ov7725_reg_stat.verified - verified;
+		SIM_CHECK(slv.starts - cost_starts == verified * 2);
+
+		SIM_CHECK(memcmp(base_regs, shadow_regs, sizeof(base_regs)) == 0);
+		SIM_CHECK(sh_starts <= base_starts);
+		printf("    %-34s %3u, %6.2f ms %3u, %6.2f ms %u\n", c->name,
+		       (unsigned)base_starts, base_ticks * 1e3 / irq_hz, (unsigned)sh_starts, sh_ticks * 1e3 / irq_hz, (unsigned)verified);
+		total_base += base_ticks;
+		total_sh += sh_ticks;
+	}
+	SIM_CHECK(ov7725_reg_stat.mismatch == 0 && ov7725_reg_stat.write_err == 0);
+
+	/*写出后传感器里的值被改了：读回发现，下次写出时重写*/
+	cost_begin(shadow_regs);
+	OV7725_ColorBar(1);
+	SIM_CHECK(OV7725_Reg_Flush() == 1);
+	slv.regs[REG_COM3] ^= 0x10;
+	for(i = 0; i < 256; i++)
+		OV7725_Reg_Verify();
+	SIM_CHECK(ov7725_reg_stat.mismatch == 1);
+	SIM_CHECK(OV7725_Reg_Flush() == 1);
+	SIM_CHECK(slv.regs[REG_COM3] == OV7725_Reg_Read(REG_COM3));
+	OV7725_ColorBar(0);
+	SIM_CHECK(OV7725_Reg_Flush() == 1);
+	check_idle();
+	printf("    %-34s %10.2f ms    %6.2f ms\n", "total", total_base * 1e3 / irq_hz, total_sh * 1e3 / irq_hz);
+	printf("    shadow load at boot: %u transactions, %.1f ms\n", (unsigned)load_starts, load_ticks * 1e3 / irq_hz);
+}
+
+static void report(void)
+{
+	uint32_t irq_hz = SCCB_BUS_HZ * SCCB_TICKS_PER_BIT;
+
+	printf("  SCL %d Hz, TIM6 period %u cycles, %u IRQ/s while a batch runs\n", SCCB_BUS_HZ,
+	       (unsigned)(SystemCoreClock / irq_hz), (unsigned)irq_hz);
+	printf("  write: %u ticks/reg = %.0f us, %d-reg batch %.1f ms\n", (unsigned)write_ticks,
+	       write_ticks * 1e6 / irq_hz, BATCH, write_ticks * BATCH * 1e3 / irq_hz);
+	printf("  read:  %u ticks/reg = %.0f us, %d-reg batch %.1f ms\n", (unsigned)read_ticks,
+	       read_ticks * 1e6 / irq_hz, BATCH, read_ticks * BATCH * 1e3 / irq_hz);
+}
+
+int main(void)
+{
+	sim_init();
+	sim_srand(14);
+	slave_reset();
+	SCCB_GPIO_Config();
+	SIM_CHECK(SCCB_TIM->ARR == SystemCoreClock / (SCCB_BUS_HZ * SCCB_TICKS_PER_BIT) - 1);
+	sim_idle = run_bus;
+	test_write();
+	test_read();
+	test_errors();
+	report();
+	test_shadow();
+	return sim_done("test_sccb");
+}
@@ -0,0 +1,486 @@
+/**
+  ******************************************************************************
+  * @file    test_wiz.c
+  * @brief   W5500的SPI：锁的嵌套、连续发送期间独占，轮询与DMA传输的周期数
+  ******************************************************************************
+  * @attention
+  *
+  * w5500_conf.c、w5500.c、socket.c原样编译。SPI、片选的库函数由这里提供，
+  * 接到一个按字节解析的W5500模型（3字节地址段、读写寄存器和缓冲区，
+  * Sn_CR写SEND时检查发送缓冲区里这一包）；连续写经shim/wiz_spi_sim.h接到同一模型；
+  * DMA1通道2、3的寄存器在映射的内存里，任务挂起等DMA时由sim_idle搬数据、进中断。
+  *
+  *   锁：sendto_stream_begin()返回后到sendto_stream_end()之前，别的线程拿不到锁；
+  *       里面的寄存器访问、再加的wiz_spi_lock()只加嵌套，放完才交出；
+  *       目的地址为0、空间不够时返回0且不持有锁；
+  *   两个线程（绑在一个CPU上，每个SPI字节后随机让出CPU）：
+  *       一个连续发送，一个读版本号寄存器、用DMA读缓冲区、写寄存器，
+  *       统计片选为低时另一线程动总线的次数；没有互斥量（wiz_spi_os_init()之前）作对照；
+  *   周期：OS_TS_GET()取模型的时钟，SPI每字节32周期（72MHz四分频），
+  *       每次调用SPI、GPIO库函数按CALL_CYCLES计，DMA传完的中断和两次任务切换按
+  *       ISR_CYCLES、SWITCH_CYCLES计（估计值），轮询时CPU一直在等，
+  *       DMA时CPU只花在启动、中断和切换上
+  *
+  ******************************************************************************
+  */
+#define _POSIX_C_SOURCE     200112L     /* 不要sys/types.h里的u_int，与W5500的types.h冲突 */
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include "sim.h"
+#include <os.h>
+#include "w5500_conf.h"
+#include "w5500.h"
+#include "socket.h"
+
+
+#define BYTE_CYCLES         32          /* 一个SPI字节：72MHz四分频，8位 */
+#define CALL_CYCLES         10          /* 调一次库函数（调用、读寄存器、比较、返回） */
+#define ISR_CYCLES          40          /* DMA传完中断：进出中断和wiz_spi_dma_isr() */
+#define SWITCH_CYCLES       150         /* 一次任务切换 */
+
+#define SOCK                SOCK_UDPS2
+#define PKT_MAX             1472
+
+extern uint16 SSIZE[MAX_SOCK_NUM];
+
+/*W5500模型*/
+static uint8_t  wiz_mem[32][65536];     /* 按块选择（BSB）分开的寄存器、缓冲区 */
+static volatile uint8_t cs_low;
+static uint8_t *volatile cs_owner;      /* 拉低片选的线程 */
+static uint8_t  phase, bsb, wr;
+static uint16_t addr;
+static uint8_t  spi_rx;
+static uint16_t sent_ptr;               /* 上一包发出后的发送写指针 */
+static uint32_t sends, sends_bad, interleaved, stray;
+static uint32_t pkt_seq;                /* 下一包应有的序号 */
+static uint8_t  dma_on;
+static uint8_t  yield_bus;              /* 1：每个字节后随机让出CPU */
+static __thread uint8_t self;
+
+/*模型时钟*/
+static uint64_t clk, wire_end;
+
+static uint32_t ts(void)
+{
+	return (uint32_t)clk;
+}
+
+static uint32_t rnd(void)
+{
+	static __thread uint32_t x = 0x9E3779B9u;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x;
+}
+
+/*一包的内容：前4字节是序号*/
+static uint8_t pkt_byte(uint32_t seq, uint16_t i)
+{
+	return (i < 4) ? (uint8_t)(seq >> (i * 8)) : (uint8_t)(seq * 31 + i);
+}
+
+/*发送命令：从上一包的结尾到发送写指针是这一包*/
+static void wiz_send(uint8_t s)
+{
+	uint8_t *sreg = wiz_mem[s * 4 + 1];
+	uint8_t *tx = wiz_mem[s * 4 + 2];
+	uint16_t wp = (sreg[0x24] << 8) | sreg[0x25];
+	uint16_t len = wp - sent_ptr, i;
+	uint32_t seq = 0;
+
+	for(i = 0; i < 4 && i < len; i++)
+		seq |= (uint32_t)tx[(uint16_t)(sent_ptr + i)] << (i * 8);
+	for(i = 0; i < len; i++)
+		if(tx[(uint16_t)(sent_ptr + i)] != pkt_byte(seq, i))
+			break;
+	if(i != len || len < 16 || seq != pkt_seq || sreg[0x0C] != 192 || ((sreg[0x10] << 8) | sreg[0x11]) != 5000)
+		sends_bad++;
+	pkt_seq = seq + 1;
+	sent_ptr = wp;
+	sends++;
+}
+
+/*总线上一个字节，返回W5500送回的字节*/
+static uint8_t wiz_byte(uint8_t b)
+{
+	uint8_t *m, r = 0;
+
+	if(!cs_low)
+	{
+		stray++;
+		return 0;
+	}
+	if(cs_owner != &self)
+		interleaved++;
+	switch(phase)
+	{
+		case 0: addr = b << 8; phase = 1; return 0;
+		case 1: addr |= b; phase = 2; return 0;
+		case 2: bsb = b >> 3; wr = b & 4; phase = 3; return 0;
+	}
+	m = wiz_mem[bsb];
+	if(wr)
+	{
+		m[addr] = b;
+		if((bsb & 3) == 1 && addr == 0x01 && b == Sn_CR_SEND)
+			wiz_send(bsb >> 2);
+	}
+	else if((bsb & 3) == 1 && addr == 0x01)
+		r = 0;                                  /* 命令立即执行完 */
+	else if((bsb & 3) == 1 && addr == 0x02)
+		r = Sn_IR_SEND_OK;
+	else
+		r = m[addr];
+	addr++;
+	return r;
+}
+
+static void bus_yield(void)
+{
+	if(yield_bus && (rnd() & 3) == 0)
+		sched_yield();
+}
+
+/*库函数替身：SPI*/
+void SPI_I2S_SendData(SPI_TypeDef *SPIx, uint16_t Data)
+{
+	(void)SPIx;
+	clk += CALL_CYCLES;
+	wire_end = ((wire_end > clk) ? wire_end : clk) + BYTE_CYCLES;
+	spi_rx = wiz_byte((uint8_t)Data);
+	bus_yield();
+}
+
+uint16_t SPI_I2S_ReceiveData(SPI_TypeDef *SPIx)
+{
+	(void)SPIx;
+	clk += CALL_CYCLES;
+	return spi_rx;
+}
+
+/*RXNE、BSY：等这个字节移完*/
+FlagStatus SPI_I2S_GetFlagStatus(SPI_TypeDef *SPIx, uint16_t SPI_I2S_FLAG)
+{
+	(void)SPIx;
+	clk += CALL_CYCLES;
+	if((SPI_I2S_FLAG == SPI_I2S_FLAG_RXNE || SPI_I2S_FLAG == SPI_I2S_FLAG_BSY) && clk < wire_end)
+		clk = wire_end;
+	return (SPI_I2S_FLAG == SPI_I2S_FLAG_BSY) ? RESET : SET;
+}
+
+void SPI_I2S_DMACmd(SPI_TypeDef *SPIx, uint16_t SPI_I2S_DMAReq, FunctionalState NewState)
+{
+	(void)SPIx;
+	(void)SPI_I2S_DMAReq;
+	clk += CALL_CYCLES;
+	dma_on = (NewState == ENABLE);
+}
+
+/*连续写：只等发送缓冲空，SPI一直在移位*/
+void sim_wiz_stream_byte(uint8_t b)
+{
+	if(clk + BYTE_CYCLES < wire_end)
+		clk = wire_end - BYTE_CYCLES;
+	wire_end = ((wire_end > clk) ? wire_end : clk) + BYTE_CYCLES;
+	clk += 2;
+	wiz_byte(b);
+	bus_yield();
+}
+
+/*库函数替身：片选*/
+void GPIO_ResetBits(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	clk += CALL_CYCLES;
+	if(GPIOx != WIZ_SPIx_SCS_PORT || GPIO_Pin != WIZ_SPIx_SCS)
+		return;
+	if(cs_low)
+		interleaved++;                          /* 别人的一次访问还没完 */
+	cs_low = 1;
+	cs_owner = &self;
+	phase = 0;
+	bus_yield();
+}
+
+void GPIO_SetBits(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	clk += CALL_CYCLES;
+	if(GPIOx == WIZ_SPIx_SCS_PORT && GPIO_Pin == WIZ_SPIx_SCS)
+		cs_low = 0;
+}
+
+/*任务等DMA：搬完数据，进传完中断；时钟走过线上时间、中断和两次任务切换*/
+static void hw_run(void)
+{
+	DMA_Channel_TypeDef *tx = WIZ_SPIx_DMA_TX_CHANNEL, *rx = WIZ_SPIx_DMA_RX_CHANNEL;
+	uint8_t *src = (uint8_t *)(uintptr_t)tx->CMAR, *dst = (uint8_t *)(uintptr_t)rx->CMAR, r;
+	uint16_t n = tx->CNDTR, i;
+
+	if(!dma_on || !(tx->CCR & DMA_CCR1_EN) || !(rx->CCR & DMA_CCR1_EN) || n != rx->CNDTR)
+		return;
+	for(i = 0; i < n; i++)
+	{
+		r = wiz_byte(src[(tx->CCR & DMA_MemoryInc_Enable) ? i : 0]);
+		dst[(rx->CCR & DMA_MemoryInc_Enable) ? i : 0] = r;
+	}
+	tx->CNDTR = rx->CNDTR = 0;
+	clk += SWITCH_CYCLES + (uint64_t)n * BYTE_CYCLES + ISR_CYCLES + SWITCH_CYCLES;
+	DMA1->ISR |= DMA1_IT_TC2 | DMA1_IT_GL2;
+	OSIntNestingCtr++;
+	wiz_spi_dma_isr();
+	OSIntNestingCtr--;
+	DMA1->ISR = 0;
+}
+
+/*W5500上电后的寄存器*/
+static void wiz_reset(void)
+{
+	memset(wiz_mem, 0, sizeof(wiz_mem));
+	wiz_mem[0][0x39] = 0x04;                    /* VERSIONR */
+	wiz_mem[SOCK * 4 + 1][0x03] = SOCK_UDP;
+	wiz_mem[SOCK * 4 + 1][0x20] = 0x08;         /* TX_FSR 2048 */
+	wiz_mem[SOCK * 4 + 1][0x24] = 0xFF;         /* TX_WR从0xFF00起，跨过16位回绕 */
+	sent_ptr = 0xFF00;
+	SSIZE[SOCK] = 2048;
+	sends = sends_bad = interleaved = stray = 0;
+	pkt_seq = 0;
+}
+
+/*连续发送一包：按AppTaskOV7725的写法，先开连续写，逐字节写入，再发出*/
+static int stream_pkt(uint32_t seq, uint16_t len)
+{
+	static uint8 dst[4] = {192, 168, 1, 105};
+	uint16_t i;
+
+	if(sendto_stream_begin(SOCK, len, dst, 5000) != len)
+		return 0;
+	for(i = 0; i < len; i++)
+		WIZ_WRITE_STREAM_BYTE(pkt_byte(seq, i));
+	return sendto_stream_end(SOCK, len) == len;
+}
+
+/*别的线程能不能拿到锁：另起线程去拿，等20ms*/
+static pthread_t probe_thread;
+static volatile uint8_t probe_done;
+
+static void *probe(void *arg)
+{
+	(void)arg;
+	wiz_spi_lock();
+	wiz_spi_unlock();
+	probe_done = 1;
+	return NULL;
+}
+
+static void probe_start(void)
+{
+	OS_ERR err;
+
+	probe_done = 0;
+	pthread_create(&probe_thread, NULL, probe, NULL);
+	OSTimeDly(20, OS_OPT_TIME_DLY, &err);
+}
+
+static void probe_join(void)
+{
+	pthread_join(probe_thread, NULL);
+}
+
+static void test_lock(void)
+{
+	static uint8 zero[4] = {0, 0, 0, 0};
+	static uint8 dst[4] = {192, 168, 1, 105};
+	uint16_t i;
+
+	wiz_reset();
+	/*连续发送期间锁一直在，里面的寄存器访问只是嵌套*/
+	SIM_CHECK(sendto_stream_begin(SOCK, 64, dst, 5000) == 64);
+	SIM_CHECK(cs_low);
+	probe_start();
+	SIM_CHECK(!probe_done);
+	wiz_spi_lock();                             /* 再嵌套一层 */
+	wiz_spi_unlock();
+	for(i = 0; i < 64; i++)
+		WIZ_WRITE_STREAM_BYTE(pkt_byte(0, i));
+	SIM_CHECK(!probe_done);
+	SIM_CHECK(sendto_stream_end(SOCK, 64) == 64);
+	SIM_CHECK(!cs_low);
+	probe_join();
+	SIM_CHECK(probe_done);
+	SIM_CHECK(sends == 1 && sends_bad == 0);
+
+	/*显式嵌套：放到最外层才交出*/
+	wiz_spi_lock();
+	wiz_spi_lock();
+	SIM_CHECK(IINCHIP_READ(VERSIONR) == 0x04);
+	wiz_spi_unlock();
+	probe_start();
+	SIM_CHECK(!probe_done);
+	wiz_spi_unlock();
+	probe_join();
+	SIM_CHECK(probe_done);
+
+	/*打不开时不持有锁*/
+	SIM_CHECK(sendto_stream_begin(SOCK, 64, zero, 5000) == 0);
+	SIM_CHECK(sendto_stream_begin(SOCK, 64, dst, 0) == 0);
+	SIM_CHECK(sendto_stream_begin(SOCK, 4096, dst, 5000) == 0);
+	wiz_mem[SOCK * 4 + 1][0x20] = 0;
+	wiz_mem[SOCK * 4 + 1][0x21] = 32;           /* 只剩32字节 */
+	SIM_CHECK(sendto_stream_begin(SOCK, 64, dst, 5000) == 0);
+	wiz_mem[SOCK * 4 + 1][0x20] = 0x08;
+	wiz_mem[SOCK * 4 + 1][0x21] = 0;
+	SIM_CHECK(!cs_low);
+	probe_start();
+	probe_join();
+	SIM_CHECK(probe_done);
+	SIM_CHECK(sends == 1 && stray == 0 && interleaved == 0);
+	printf("  lock held from sendto_stream_begin() to _end(), nesting released at the outermost unlock, not held on refusal\n");
+}
+
+/*两个线程：连续发送与其他访问*/
+static volatile uint8_t race_stop;
+static uint32_t race_pkts, race_bad_reads;
+
+static void *race_sender(void *arg)
+{
+	uint32_t seq;
+
+	(void)arg;
+	for(seq = 0; seq < race_pkts; seq++)
+		stream_pkt(seq, (uint16_t)(16 + seq * 97 % (PKT_MAX - 16)));
+	race_stop = 1;
+	return NULL;
+}
+
+/*没有互斥量时的连续写，作对照*/
+static void *race_raw_sender(void *arg)
+{
+	uint32_t seq;
+	uint16_t i;
+
+	(void)arg;
+	for(seq = 0; seq < race_pkts; seq++)
+	{
+		wiz_write_stream_begin(0x001010);       /* 块4的0x0010起 */
+		for(i = 0; i < 64; i++)
+			WIZ_WRITE_STREAM_BYTE(pkt_byte(seq, i));
+		wiz_write_stream_end();
+	}
+	race_stop = 1;
+	return NULL;
+}
+
+static void *race_other(void *arg)
+{
+	static uint8 buf[64];
+	uint8_t k;
+
+	(void)arg;
+	while(!race_stop)
+	{
+		if(IINCHIP_READ(VERSIONR) != 0x04)
+			race_bad_reads++;
+		wiz_read_buf(0x000018, buf, sizeof(buf));      /* 块3的0x0000起：DMA读 */
+		for(k = 0; k < sizeof(buf); k++)
+			if(buf[k] != (uint8_t)(k * 5))
+			{
+				race_bad_reads++;
+				break;
+			}
+		IINCHIP_WRITE(0x002E00, 0x5A);                  /* 通用寄存器区的一个寄存器 */
+	}
+	return NULL;
+}
+
+static void race(const char *name, void *(*sender)(void *), uint32_t pkts)
+{
+	uint16_t k;
+
+	wiz_reset();
+	for(k = 0; k < 64; k++)
+		wiz_mem[3][k] = (uint8_t)(k * 5);
+	race_pkts = pkts;
+	race_stop = 0;
+	race_bad_reads = 0;
+	yield_bus = 1;
+	sim_run2(sender, race_other, 0);
+	yield_bus = 0;
+	printf("  %-9s %5u bursts: %u bus accesses interleaved into another transfer, %u bad reads, %u datagrams bad\n",
+	       name, pkts, interleaved, race_bad_reads, sends_bad);
+}
+
+/*一种长度读写各做几次，返回每字节的周期数*/
+static void measure(uint16_t len, double *w, double *r)
+{
+	static uint8 buf[PKT_MAX];
+	uint32_t c, b;
+	int i;
+
+	memset(&wiz_spi_stat, 0, sizeof(wiz_spi_stat));
+	for(i = 0; i < 8; i++)
+		wiz_write_buf(0x000014 + (i << 8), buf, len);
+	c = wiz_spi_stat.poll_cycles + wiz_spi_stat.dma_cycles;
+	b = wiz_spi_stat.poll_bytes + wiz_spi_stat.dma_bytes;
+	*w = (double)c / b;
+	memset(&wiz_spi_stat, 0, sizeof(wiz_spi_stat));
+	for(i = 0; i < 8; i++)
+		wiz_read_buf(0x000018 + (i << 8), buf, len);
+	c = wiz_spi_stat.poll_cycles + wiz_spi_stat.dma_cycles;
+	b = wiz_spi_stat.poll_bytes + wiz_spi_stat.dma_bytes;
+	*r = (double)c / b;
+}
+
+static const uint16_t lens[] = {16, 64, 256, 1472};
+static double poll_w[4], poll_r[4];
+
+static void bench_poll(void)
+{
+	int i;
+
+	for(i = 0; i < 4; i++)
+		measure(lens[i], &poll_w[i], &poll_r[i]);
+}
+
+static void bench_dma(void)
+{
+	double w, r, cpu;
+	uint64_t c;
+	int i;
+
+	printf("  wiz_spi_transfer cycles per data byte (model, 72MHz, SPI 18MHz):\n");
+	printf("    %5s  %13s  %13s  %s\n", "len", "polled w/r", "DMA w/r", "DMA CPU busy");
+	for(i = 0; i < 4; i++)
+	{
+		measure(lens[i], &w, &r);
+		SIM_CHECK(wiz_spi_stat.dma_bytes == 8u * lens[i] && wiz_spi_stat.poll_bytes == 0);
+		/*除去线上时间，其余是CPU花的（任务挂起期间CPU可以跑别的任务）*/
+		cpu = (double)(wiz_spi_stat.dma_cycles - wiz_spi_stat.dma_bytes * BYTE_CYCLES) / wiz_spi_stat.dma_bytes;
+		printf("    %5u  %6.1f %6.1f  %6.1f %6.1f  %6.1f\n", lens[i], poll_w[i], poll_r[i], w, r, cpu);
+	}
+	/*连续写*/
+	c = clk;
+	stream_pkt(pkt_seq, PKT_MAX);
+	c = clk - c;
+	printf("    stream 1472 B datagram incl. socket registers: %.1f cycles/byte, CPU busy throughout\n", (double)c / PKT_MAX);
+	SIM_CHECK(wiz_spi_stat.dma_timeout == 0);
+}
+
+int main(void)
+{
+	sim_init();
+	sim_ts = ts;
+	sim_idle = hw_run;
+	wiz_reset();
+	bench_poll();                               /* wiz_spi_os_init()之前都是轮询 */
+	race("no mutex", race_raw_sender, 2000);
+	SIM_CHECK(interleaved > 0);
+	wiz_spi_os_init();
+	test_lock();
+	race("mutex", race_sender, 2000);
+	SIM_CHECK(interleaved == 0 && race_bad_reads == 0 && sends_bad == 0 && sends == 2000 && stray == 0);
+	wiz_reset();
+	bench_dma();
+	return sim_done("test_wiz");
+}
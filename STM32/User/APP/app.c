@@ -44,23 +44,84 @@
 *********************************************************************************************************
 */
 
-OS_FLAG_GRP	watchDogFlag;    //һ¼־
+OS_FLAG_GRP	watchDogFlag;    //声明一个事件标志组
 #define OV7725_EVENT	(0x01 << 0)
 #define SENDPICTURE_EVENT	(0x01 << 1)
 #define RECIVEDATA_EVENT	(0x01 << 2)
 #define CONTROLSEND_EVENT	(0x01 << 3)
 
 uint8_t transfer_falg = 0;
-extern uint8_t Ov7725_vsync;
+#if (APP_CFG_PICTURE_SEND_MODE == PICTURE_SEND_STREAM)
+uint8_t stream_falg = 1;                 //1：边读边发，0：经picture_data队列发送
+#else
+uint8_t stream_falg = 0;
+#endif
 extern OV7725_MODE_PARAM cam_mode;
-/*ͼƬڴ*/
-//OS_MEM picture_mem;
-uint8_t picture_data[PictureMaxSize][1280];
-struct PictureQueue temp_Q = {
-								1,
-								0,
-								0};
-Queue Q = &temp_Q;
+uint8_t picture_info_falg = 0;           //1：下一帧前先发图像参数包
+
+/*控制命令0x05请求的新窗口，采集任务在帧间隙应用*/
+typedef struct
+{
+	volatile uint8_t req;           //1：有未应用的请求，其余成员写完后才置1
+	uint16_t sx;
+	uint16_t sy;
+	uint16_t width;
+	uint16_t height;
+	uint8_t vga;                    //0：QVGA 1：VGA
+}WINDOW_REQ;
+
+WINDOW_REQ window_req;
+volatile uint8_t format_req = 0xff;      //控制命令0x06请求的输出格式，0xff为没有请求
+volatile uint8_t bin_req = 0;            //控制命令0x07请求的缩小倍数，0为没有请求
+volatile uint8_t test_req = 0xff;        //控制命令0x09请求的测试图案，0xff为没有请求
+
+/*采集计时统计（单位：us），可在调试器中查看*/
+typedef struct
+{
+	uint32_t frame_cnt;             //已采集帧数
+	uint32_t frame_seq;             //上一帧的帧序号（ov7725_pipe.read_seq），帧计数见ov7725_pipe
+	uint32_t vsync_wait_us;         //上一次FIFO中没有帧时等待VSYNC的时间
+	uint32_t capture_us;            //上一帧从开始读FIFO到读完的时间（含等待队列；直发方式含发送）
+	uint32_t queue_wait_us;         //上一帧中等待队列空位的时间
+	uint32_t capture_max_us;
+	uint32_t queue_wait_max_us;
+	uint32_t read_cycles;           //上一帧读FIFO的DWT周期数（不含等待队列；DMA方式为等待DMA完成的时间）
+	uint32_t read_cycles_per_px;    //上一帧每像素读出周期数，用于比较各读出方式
+	uint32_t stats_cycles;          //上一帧读出时统计花的DWT周期数（已含在read_cycles或capture_us中）
+}CAPTURE_STAT;
+
+CAPTURE_STAT capture_stat;
+
+/*帧率控制状态，可在调试器中查看*/
+#define RATE_QUEUE      0x01            //等队列空位的时间超过本帧采集时间的1/4
+#define RATE_DROP       0x02            //FIFO没有空间，传感器写的帧被跳过
+#define RATE_TXBUF      0x04            //W5500发送缓冲区放不下一包
+
+typedef struct
+{
+	uint8_t  div;                   //当前CLKRC分频，见OV7725_FrameRate_Set()
+	uint8_t  target_fps;            //当前传感器帧率
+	uint8_t  reason;                //上一次降档的原因，RATE_xxx按位或
+	uint8_t  up_pending;            //1：刚升档，还没通畅满up_frames帧
+	uint16_t up_frames;             //升一档需要的连续通畅帧数
+	uint16_t busy_frames;           //连续拥塞的帧数
+	uint16_t idle_frames;           //连续通畅的帧数
+	uint32_t last_dropped;          //上一帧时的ov7725_pipe.dropped
+	uint32_t step_down;             //降档次数
+	uint32_t step_up;               //升档次数
+}RATE_CTRL;
+
+RATE_CTRL rate_ctrl = {
+								0,                          //div，与cam_mode.clk_div的初值一致
+								OV7725_FPS_BASE,            //target_fps
+								0,                          //reason
+								0,                          //up_pending
+								APP_CFG_RATE_UP_FRAMES,     //up_frames
+								0,                          //busy_frames
+								0,                          //idle_frames
+								0,                          //last_dropped
+								0,                          //step_down
+								0};                         //step_up
 
 /*
 *********************************************************************************************************
@@ -68,10 +129,10 @@ Queue Q = &temp_Q;
 *********************************************************************************************************
 */
 
-static  OS_TCB   AppTaskStartTCB;    //ƿ
+static  OS_TCB   AppTaskStartTCB;    //任务控制块
 
 static  OS_TCB	 AppTaskWatchDogTCB;
-static  OS_TCB   AppTaskOV7725TCB;
+        OS_TCB   AppTaskOV7725TCB;                 //VSYNC中断向该任务发送任务信号量
 static  OS_TCB   AppTaskSendPictureTCB;
 static  OS_TCB   AppTaskRecvieDataTCB;
 static  OS_TCB   APPTaskControlSendTCB;
@@ -83,7 +144,7 @@ static  OS_TCB   APPTaskControlSendTCB;
 *********************************************************************************************************
 */
 
-static  CPU_STK  AppTaskStartStk[APP_TASK_START_STK_SIZE];       //ջ 
+static  CPU_STK  AppTaskStartStk[APP_TASK_START_STK_SIZE];       //任务堆栈 
 
 static  CPU_STK  AppTakWatchDogSTK[APP_TASK_WATCHDOG_STK_SIZE];
 static  CPU_STK  AppTaskOV7725Stk [ APP_TASK_OV7725_STK_SIZE ];
@@ -98,13 +159,34 @@ static  CPU_STK  APPTaskControlSendStk [ APP_TASK_CONTROL_SEND_SIZE ];
 *********************************************************************************************************
 */
 
-static  void  AppTaskStart  (void *p_arg);               //
+static  void  AppTaskStart  (void *p_arg);               //任务函数声明
 
 static  void  AppTaskWatchDog(void *p_arg);
 static  void  AppTaskOV7725  ( void * p_arg );
 static  void  AppTaskSendPicture(void *p_arg);
 static  void  AppTaskReciveData ( void * p_arg );
 static  void  APPTaskControlSend(void * p_arg);
+static  void  AppPacketSend(const uint8_t *buf, uint16 len);
+static  void  AppPictureInfoSend(void);
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+static  void  AppPictureStatsSend(uint32_t seq);
+#endif
+static  void  AppTestFrameSend(uint32_t seq);
+#if (PICTURE_BAND_EN == DEF_ENABLED) && (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+static  CPU_TS  AppBandSend(void);
+#endif
+#if (PICTURE_DIRECT_EN == DEF_ENABLED)
+static  CPU_TS  AppDirectSend(void);
+#endif
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+static  void  AppPictureBlockEnd(uint32_t seq);
+#endif
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+static  uint8_t  AppFrameStale(uint16 packets);
+#endif
+#if (APP_CFG_RATE_CTRL_EN == DEF_ENABLED)
+static  void  AppRateControl(void);
+#endif
 
 
 /*
@@ -125,24 +207,24 @@ int  main (void)
     OS_ERR  err;
 
 	
-    OSInit(&err);                                                           //ʼ uC/OS-III
-
-	  /* ʼ */
-    OSTaskCreate((OS_TCB     *)&AppTaskStartTCB,                            //ƿַ
-                 (CPU_CHAR   *)"App Task Start",                            //
-                 (OS_TASK_PTR ) AppTaskStart,                               //
-                 (void       *) 0,                                          //ݸβp_argʵ
-                 (OS_PRIO     ) APP_TASK_START_PRIO,                        //ȼ
-                 (CPU_STK    *)&AppTaskStartStk[0],                         //ջĻַ
-                 (CPU_STK_SIZE) APP_TASK_START_STK_SIZE / 10,               //ջռʣ1/10ʱ
-                 (CPU_STK_SIZE) APP_TASK_START_STK_SIZE,                    //ջռ䣨λsizeof(CPU_STK)
-                 (OS_MSG_QTY  ) 5u,                                         //ɽյϢ
-                 (OS_TICK     ) 0u,                                         //ʱƬ0ĬֵOSCfg_TickRate_Hz/10
-                 (void       *) 0,                                          //չ0չ
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //ѡ
-                 (OS_ERR     *)&err);                                       //ش
-
-    OSStart(&err);                                                          //uC/OS-IIIƣ
+    OSInit(&err);                                                           //初始化 uC/OS-III
+
+	  /* 创建起始任务 */
+    OSTaskCreate((OS_TCB     *)&AppTaskStartTCB,                            //任务控制块地址
+                 (CPU_CHAR   *)"App Task Start",                            //任务名称
+                 (OS_TASK_PTR ) AppTaskStart,                               //任务函数
+                 (void       *) 0,                                          //传递给任务函数（形参p_arg）的实参
+                 (OS_PRIO     ) APP_TASK_START_PRIO,                        //任务的优先级
+                 (CPU_STK    *)&AppTaskStartStk[0],                         //任务堆栈的基地址
+                 (CPU_STK_SIZE) APP_TASK_START_STK_SIZE / 10,               //任务堆栈空间剩下1/10时限制其增长
+                 (CPU_STK_SIZE) APP_TASK_START_STK_SIZE,                    //任务堆栈空间（单位：sizeof(CPU_STK)）
+                 (OS_MSG_QTY  ) 5u,                                         //任务可接收的最大消息数
+                 (OS_TICK     ) 0u,                                         //任务的时间片节拍数（0表默认值OSCfg_TickRate_Hz/10）
+                 (void       *) 0,                                          //任务扩展（0表不扩展）
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //任务选项
+                 (OS_ERR     *)&err);                                       //返回错误类型
+
+    OSStart(&err);                                                          //启动多任务管理（交由uC/OS-III控制）
 
 }
 
@@ -172,121 +254,123 @@ static  void  AppTaskStart (void *p_arg)
 
     (void)p_arg;
 
-    BSP_Init();                                                 //弶ʼ
-    CPU_Init();                                                 //ʼ CPU ʱжʱ
+    BSP_Init();                                                 //板级初始化
+    CPU_Init();                                                 //初始化 CPU 组件（时间戳、关中断时间测量和主机名）
 
-    cpu_clk_freq = BSP_CPU_ClkFreq();                           //ȡ CPU ںʱƵʣSysTick ʱӣ
-    cnts = cpu_clk_freq / (CPU_INT32U)OSCfg_TickRate_Hz;        //û趨ʱӽƵʼ SysTick ʱļֵ
-    OS_CPU_SysTickInit(cnts);                                   // SysTick ʼöʱֵʱ
+    cpu_clk_freq = BSP_CPU_ClkFreq();                           //获取 CPU 内核时钟频率（SysTick 工作时钟）
+    cnts = cpu_clk_freq / (CPU_INT32U)OSCfg_TickRate_Hz;        //根据用户设定的时钟节拍频率计算 SysTick 定时器的计数值
+    OS_CPU_SysTickInit(cnts);                                   //调用 SysTick 初始化函数，设置定时器计数值和启动定时器
 
-    Mem_Init();                                                 //ʼڴڴغڴر
+    Mem_Init();                                                 //初始化内存管理组件（堆内存池和内存池表）
 
-#if OS_CFG_STAT_TASK_EN > 0u                                    //ʹܣĬʹܣͳ
-    OSStatTaskCPUUsageInit(&err);                               //ûӦֻпʱ CPU ģ
-#endif                                                          // OS_Stat_IdleCtrMax ֵΪ CPU 
-                                                                //ʹʹã
-    CPU_IntDisMeasMaxCurReset();                                //λ㣩ǰжʱ
+#if OS_CFG_STAT_TASK_EN > 0u                                    //如果使能（默认使能）了统计任务
+    OSStatTaskCPUUsageInit(&err);                               //计算没有应用任务（只有空闲任务）运行时 CPU 的（最大）
+#endif                                                          //容量（决定 OS_Stat_IdleCtrMax 的值，为后面计算 CPU 
+                                                                //使用率使用）。
+    CPU_IntDisMeasMaxCurReset();                                //复位（清零）当前最大关中断时间
 
     
-    /* ʱƬת */		
-    OSSchedRoundRobinCfg((CPU_BOOLEAN   )DEF_ENABLED,          //ʹʱƬת
-		                 (OS_TICK       )0,                    // OSCfg_TickRate_Hz / 10 ΪĬʱƬֵ
-						 (OS_ERR       *)&err );               //ش
+    /* 配置时间片轮转调度 */		
+    OSSchedRoundRobinCfg((CPU_BOOLEAN   )DEF_ENABLED,          //使能时间片轮转调度
+		                 (OS_TICK       )0,                    //把 OSCfg_TickRate_Hz / 10 设为默认时间片值
+						 (OS_ERR       *)&err );               //返回错误类型
 
 
-	//¼־
-	OSFlagCreate((OS_FLAG_GRP  *)&watchDogFlag,  //¼־ָ
-                 (CPU_CHAR     *)"flag for watchdog", //¼־
-                 (OS_FLAGS      )0,  //־ʼֵ
+	//创建事件标志组
+	OSFlagCreate((OS_FLAG_GRP  *)&watchDogFlag,  //事件标志组指针
+                 (CPU_CHAR     *)"flag for watchdog", //命名事件标志组
+                 (OS_FLAGS      )0,  //标志初始值
                  (OS_ERR       *)&err);
 
-	/*ͼƬ*/
-	// OSMemCreate((OS_MEM       *)&picture_mem,    //ڴƿ
-    //             (CPU_CHAR     *)"picture_mem",   //ڴ
-    //             (void         *)picture_data,   //ڴ׵ַ
-    //             (OS_MEM_QTY    )3,   //ڴĿ
-    //             (OS_MEM_SIZE   )1280, //ڴСλֽڣ
-    //             (OS_ERR       *)&err);
-				
-	/**/
-	InitQueue(Q);
-
-	OSTaskCreate((OS_TCB     *)&AppTaskWatchDogTCB,                             //ƿַ
-						(CPU_CHAR   *)"App Task WatchDog",                             //
-						(OS_TASK_PTR ) AppTaskWatchDog,                                //
-						(void       *) 0,                                          //ݸβp_argʵ
-						(OS_PRIO     ) APP_TASK_WATCHDOG_PRIO,                         //ȼ
-						(CPU_STK    *)&AppTakWatchDogSTK[0],                          //ջĻַ
-						(CPU_STK_SIZE) APP_TASK_WATCHDOG_STK_SIZE / 10,                //ջռʣ1/10ʱ
-						(CPU_STK_SIZE) APP_TASK_WATCHDOG_STK_SIZE,                     //ջռ䣨λsizeof(CPU_STK)
-						(OS_MSG_QTY  ) 5u,                                         //ɽյϢ
-						(OS_TICK     ) 0u,                                         //ʱƬ0Ĭֵ
-						(void       *) 0,                                          //չ0չ
-						(OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //ѡ
+	/*创建队列和包缓冲分区picture_mem*/
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	PictureRingInit();
+#endif
+#if (PICTURE_BAND_EN == DEF_ENABLED)
+	PictureBandInit();              //按块刷新、JPEG的带缓冲从堆中申请，要在Mem_Init()之后
+#endif
+
+#if (APP_CFG_OV7725_READ_MODE == OV7725_READ_DMA)
+	/*FIFO定时器+DMA读出初始化*/
+	OV7725_DMA_Init();
+#endif
+
+	OSTaskCreate((OS_TCB     *)&AppTaskWatchDogTCB,                             //任务控制块地址
+						(CPU_CHAR   *)"App Task WatchDog",                             //任务名称
+						(OS_TASK_PTR ) AppTaskWatchDog,                                //任务函数
+						(void       *) 0,                                          //传递给任务函数（形参p_arg）的实参
+						(OS_PRIO     ) APP_TASK_WATCHDOG_PRIO,                         //任务的优先级
+						(CPU_STK    *)&AppTakWatchDogSTK[0],                          //任务堆栈的基地址
+						(CPU_STK_SIZE) APP_TASK_WATCHDOG_STK_SIZE / 10,                //任务堆栈空间剩下1/10时限制其增长
+						(CPU_STK_SIZE) APP_TASK_WATCHDOG_STK_SIZE,                     //任务堆栈空间（单位：sizeof(CPU_STK)）
+						(OS_MSG_QTY  ) 5u,                                         //任务可接收的最大消息数
+						(OS_TICK     ) 0u,                                         //任务的时间片节拍数（0表默认值）
+						(void       *) 0,                                          //任务扩展（0表不扩展）
+						(OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //任务选项
 						(OS_ERR     *)&err);
 
-		/*  OV7725ͷ  */
-    OSTaskCreate((OS_TCB     *)&AppTaskOV7725TCB,                             //ƿַ
-                 (CPU_CHAR   *)"App Task OV7725",                             //
-                 (OS_TASK_PTR ) AppTaskOV7725,                                //
-                 (void       *) 0,                                          //ݸβp_argʵ
-                 (OS_PRIO     ) APP_TASK_OV7725_PRIO,                         //ȼ
-                 (CPU_STK    *)&AppTaskOV7725Stk[0],                          //ջĻַ
-                 (CPU_STK_SIZE) APP_TASK_OV7725_STK_SIZE / 10,                //ջռʣ1/10ʱ
-                 (CPU_STK_SIZE) APP_TASK_OV7725_STK_SIZE,                     //ջռ䣨λsizeof(CPU_STK)
-                 (OS_MSG_QTY  ) 5u,                                         //ɽյϢ
-                 (OS_TICK     ) 0u,                                         //ʱƬ0Ĭֵ
-                 (void       *) 0,                                          //չ0չ
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //ѡ
-                 (OS_ERR     *)&err);                                       //ش
-
-	OSTaskCreate((OS_TCB     *)&AppTaskRecvieDataTCB,                             //ƿַ
-                 (CPU_CHAR   *)"App Task Recvie Data",                             //
-                 (OS_TASK_PTR ) AppTaskReciveData,                                //
-                 (void       *) 0,                                          //ݸβp_argʵ
-                 (OS_PRIO     ) APP_TASK_RECVIE_DATA_PRIO,                         //ȼ
-                 (CPU_STK    *)&AppTaskReceiveDataStk[0],                          //ջĻַ
-                 (CPU_STK_SIZE) APP_TASK_RECVIE_DATA_STK_SIZE / 10,                //ջռʣ1/10ʱ
-                 (CPU_STK_SIZE) APP_TASK_RECVIE_DATA_STK_SIZE,                     //ջռ䣨λsizeof(CPU_STK)
-                 (OS_MSG_QTY  ) 5u,                                         //ɽյϢ
-                 (OS_TICK     ) 0u,                                         //ʱƬ0Ĭֵ
-                 (void       *) 0,                                          //չ0չ
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //ѡ
-                 (OS_ERR     *)&err);                                       //ش
-
-	OSTaskCreate((OS_TCB     *)&APPTaskControlSendTCB,                             //ƿַ
-                 (CPU_CHAR   *)"App Task Control Send",                             //
-                 (OS_TASK_PTR ) APPTaskControlSend,                                //
-                 (void       *) 0,                                          //ݸβp_argʵ
-                 (OS_PRIO     ) APP_TASK_CONTROL_SEND_PRIO,                         //ȼ
-                 (CPU_STK    *)&APPTaskControlSendStk[0],                          //ջĻַ
-                 (CPU_STK_SIZE) APP_TASK_CONTROL_SEND_SIZE / 10,                //ջռʣ1/10ʱ
-                 (CPU_STK_SIZE) APP_TASK_CONTROL_SEND_SIZE,                     //ջռ䣨λsizeof(CPU_STK)
-                 (OS_MSG_QTY  ) 5u,                                         //ɽյϢ
-                 (OS_TICK     ) 0u,                                         //ʱƬ0Ĭֵ
-                 (void       *) 0,                                          //չ0չ
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //ѡ
-                 (OS_ERR     *)&err);                                       //ش
-
-    OSTaskCreate((OS_TCB     *)&AppTaskSendPictureTCB,                             //ƿַ
-                 (CPU_CHAR   *)"App Task Send Picture",                             //
-                 (OS_TASK_PTR ) AppTaskSendPicture,                                //
-                 (void       *) 0,                                          //ݸβp_argʵ
-                 (OS_PRIO     ) APP_TASK_SEND_PICTURE_PRIO,                         //ȼ
-                 (CPU_STK    *)&AppTaskSendPictureSTK[0],                          //ջĻַ
-                 (CPU_STK_SIZE) APP_TASK_SEND_PICTURE_STK_SIZE / 10,                //ջռʣ1/10ʱ
-                 (CPU_STK_SIZE) APP_TASK_SEND_PICTURE_STK_SIZE,                     //ջռ䣨λsizeof(CPU_STK)
-                 (OS_MSG_QTY  ) 5u,                                         //ɽյϢ
-                 (OS_TICK     ) 0u,                                         //ʱƬ0Ĭֵ
-                 (void       *) 0,                                          //չ0չ
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //ѡ
+		/* 创建 OV7725摄像头 任务 */
+    OSTaskCreate((OS_TCB     *)&AppTaskOV7725TCB,                             //任务控制块地址
+                 (CPU_CHAR   *)"App Task OV7725",                             //任务名称
+                 (OS_TASK_PTR ) AppTaskOV7725,                                //任务函数
+                 (void       *) 0,                                          //传递给任务函数（形参p_arg）的实参
+                 (OS_PRIO     ) APP_TASK_OV7725_PRIO,                         //任务的优先级
+                 (CPU_STK    *)&AppTaskOV7725Stk[0],                          //任务堆栈的基地址
+                 (CPU_STK_SIZE) APP_TASK_OV7725_STK_SIZE / 10,                //任务堆栈空间剩下1/10时限制其增长
+                 (CPU_STK_SIZE) APP_TASK_OV7725_STK_SIZE,                     //任务堆栈空间（单位：sizeof(CPU_STK)）
+                 (OS_MSG_QTY  ) 5u,                                         //任务可接收的最大消息数
+                 (OS_TICK     ) 0u,                                         //任务的时间片节拍数（0表默认值）
+                 (void       *) 0,                                          //任务扩展（0表不扩展）
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //任务选项
+                 (OS_ERR     *)&err);                                       //返回错误类型
+
+	OSTaskCreate((OS_TCB     *)&AppTaskRecvieDataTCB,                             //任务控制块地址
+                 (CPU_CHAR   *)"App Task Recvie Data",                             //任务名称
+                 (OS_TASK_PTR ) AppTaskReciveData,                                //任务函数
+                 (void       *) 0,                                          //传递给任务函数（形参p_arg）的实参
+                 (OS_PRIO     ) APP_TASK_RECVIE_DATA_PRIO,                         //任务的优先级
+                 (CPU_STK    *)&AppTaskReceiveDataStk[0],                          //任务堆栈的基地址
+                 (CPU_STK_SIZE) APP_TASK_RECVIE_DATA_STK_SIZE / 10,                //任务堆栈空间剩下1/10时限制其增长
+                 (CPU_STK_SIZE) APP_TASK_RECVIE_DATA_STK_SIZE,                     //任务堆栈空间（单位：sizeof(CPU_STK)）
+                 (OS_MSG_QTY  ) 5u,                                         //任务可接收的最大消息数
+                 (OS_TICK     ) 0u,                                         //任务的时间片节拍数（0表默认值）
+                 (void       *) 0,                                          //任务扩展（0表不扩展）
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //任务选项
+                 (OS_ERR     *)&err);                                       //返回错误类型
+
+	OSTaskCreate((OS_TCB     *)&APPTaskControlSendTCB,                             //任务控制块地址
+                 (CPU_CHAR   *)"App Task Control Send",                             //任务名称
+                 (OS_TASK_PTR ) APPTaskControlSend,                                //任务函数
+                 (void       *) 0,                                          //传递给任务函数（形参p_arg）的实参
+                 (OS_PRIO     ) APP_TASK_CONTROL_SEND_PRIO,                         //任务的优先级
+                 (CPU_STK    *)&APPTaskControlSendStk[0],                          //任务堆栈的基地址
+                 (CPU_STK_SIZE) APP_TASK_CONTROL_SEND_SIZE / 10,                //任务堆栈空间剩下1/10时限制其增长
+                 (CPU_STK_SIZE) APP_TASK_CONTROL_SEND_SIZE,                     //任务堆栈空间（单位：sizeof(CPU_STK)）
+                 (OS_MSG_QTY  ) 5u,                                         //任务可接收的最大消息数
+                 (OS_TICK     ) 0u,                                         //任务的时间片节拍数（0表默认值）
+                 (void       *) 0,                                          //任务扩展（0表不扩展）
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //任务选项
+                 (OS_ERR     *)&err);                                       //返回错误类型
+
+    OSTaskCreate((OS_TCB     *)&AppTaskSendPictureTCB,                             //任务控制块地址
+                 (CPU_CHAR   *)"App Task Send Picture",                             //任务名称
+                 (OS_TASK_PTR ) AppTaskSendPicture,                                //任务函数
+                 (void       *) 0,                                          //传递给任务函数（形参p_arg）的实参
+                 (OS_PRIO     ) APP_TASK_SEND_PICTURE_PRIO,                         //任务的优先级
+                 (CPU_STK    *)&AppTaskSendPictureSTK[0],                          //任务堆栈的基地址
+                 (CPU_STK_SIZE) APP_TASK_SEND_PICTURE_STK_SIZE / 10,                //任务堆栈空间剩下1/10时限制其增长
+                 (CPU_STK_SIZE) APP_TASK_SEND_PICTURE_STK_SIZE,                     //任务堆栈空间（单位：sizeof(CPU_STK)）
+                 (OS_MSG_QTY  ) 5u,                                         //任务可接收的最大消息数
+                 (OS_TICK     ) 0u,                                         //任务的时间片节拍数（0表默认值）
+                 (void       *) 0,                                          //任务扩展（0表不扩展）
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), //任务选项
                  (OS_ERR     *)&err);
 
 	
 
 	IWDG_Config(IWDG_Prescaler_64, 3500);
 
-	OSTaskDel ( 0, & err );                     //ɾʼ
+	OSTaskDel ( 0, & err );                     //删除起始任务本身，该任务不再运行
 		
 		
 }
@@ -303,16 +387,16 @@ static  void  AppTaskWatchDog(void *p_arg)
 
 	while(DEF_TRUE)
 	{
-		flag_rdy = OSFlagPend((OS_FLAG_GRP  *)&watchDogFlag,   //¼־ָ
-                      		  (OS_FLAGS      )(OV7725_EVENT | SENDPICTURE_EVENT | RECIVEDATA_EVENT | CONTROLSEND_EVENT),   //ѡҪı־λ
-                      		  (OS_TICK       )0, //ȴޣλʱӽģ
-                              (OS_OPT        )(OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_BLOCKING),     //ѡ
-                              (CPU_TS       *)0,    //صȵ¼־ʱʱ
-                              (OS_ERR       *)&err);   //ش
+		flag_rdy = OSFlagPend((OS_FLAG_GRP  *)&watchDogFlag,   //事件标志组指针
+                      		  (OS_FLAGS      )(OV7725_EVENT | SENDPICTURE_EVENT | RECIVEDATA_EVENT | CONTROLSEND_EVENT),   //选定要操作的标志位
+                      		  (OS_TICK       )0, //等待期限（单位：时钟节拍）
+                              (OS_OPT        )(OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_BLOCKING),     //选项
+                              (CPU_TS       *)0,    //返回等到事件标志时的时间戳
+                              (OS_ERR       *)&err);   //返回错误类型
 
 		if(flag_rdy & (OV7725_EVENT | SENDPICTURE_EVENT | RECIVEDATA_EVENT | CONTROLSEND_EVENT) == (OV7725_EVENT | SENDPICTURE_EVENT | RECIVEDATA_EVENT | CONTROLSEND_EVENT))
 		{
-			//ι
+			//喂狗
 			IWDG_Feed();
 		}
 		OSTimeDlyHMSM ( 0, 0, 2, 0, OS_OPT_TIME_DLY, & err );
@@ -327,15 +411,16 @@ static  void  AppTaskWatchDog(void *p_arg)
 static  void  APPTaskControlSend(void * p_arg)
 {
 	OS_ERR      err;
-	uint8_t buff[1] = {0};
+	uint8_t buff[10] = {0};
+	uint16 len = 0;
 	(void)p_arg;
 	while(DEF_TRUE)
 	{
-		//׳¼
-		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //¼־ָ
-                   (OS_FLAGS      )CONTROLSEND_EVENT, //ѡҪı־λ
-                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //ѡ
-                   (OS_ERR       *)&err); //ش;
+		//抛出事件
+		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //事件标志组指针
+                   (OS_FLAGS      )CONTROLSEND_EVENT, //选定要操作的标志位
+                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //选项
+                   (OS_ERR       *)&err); //返回错误类型;
 		
 		while(getSn_SR(SOCK_UDPS) == SOCK_CLOSED)
 		{
@@ -344,19 +429,95 @@ static  void  APPTaskControlSend(void * p_arg)
 
 		if(getSn_IR(SOCK_UDPS) & Sn_IR_RECV)
 		{
-			setSn_IR(SOCK_UDPS, Sn_IR_RECV);                                     /*ж*/
-			if((getSn_RX_RSR(SOCK_UDPS))>0)                                    /*յ*/
+			setSn_IR(SOCK_UDPS, Sn_IR_RECV);                                     /*清接收中断*/
+			if((getSn_RX_RSR(SOCK_UDPS))>0)                                    /*接收到数据*/
 			{
-				recvfrom(SOCK_UDPS,buff, 1, remote_ip,&remote_port);               /*W5500ռ*/
+				len = recvfrom(SOCK_UDPS,buff, sizeof(buff), remote_ip,&remote_port);   /*W5500接收计算机发送来的数据*/
 				if(buff[0] == 0x01)
+				{
 					transfer_falg = 1;
+					picture_info_falg = 1;  //先告诉接收端当前窗口
+				}
+				else if(buff[0] == 0x05 && len >= 9)
+				{
+					/*改变窗口：X起点 Y起点 宽 高，16位，高字节在前*/
+					window_req.sx = (buff[1] << 8) | buff[2];
+					window_req.sy = (buff[3] << 8) | buff[4];
+					window_req.width = (buff[5] << 8) | buff[6];
+					window_req.height = (buff[7] << 8) | buff[8];
+					window_req.vga = (len >= 10) ? buff[9] : 0;   //第10字节可选，旧接收端不发即QVGA
+					window_req.req = 1;
+				}
+				else if(buff[0] == 0x06 && len >= 2)
+					format_req = buff[1];   //输出格式：0 RGB565，1 YUV422，2 灰度，3 RGB332
+				else if(buff[0] == 0x07 && len >= 2 && buff[1] != 0)
+					bin_req = buff[1];      //缩小倍数：1、2、4
+				else if(buff[0] == 0x09 && len >= 2)
+					test_req = buff[1];     //测试图案：0 关，1 传感器彩条，2 合成彩条
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+				else if(buff[0] == 0x0A && len >= 2)
+					picture_stats_on = (buff[1] != 0);   //每帧统计包：0 关，1 开
+#endif
+#if (APP_CFG_PICTURE_CODEC_EN == DEF_ENABLED)
+				else if(buff[0] == 0x0B && len >= 2)
+				{
+					picture_codec = (buff[1] != 0);      //RGB565无损压缩：0 关，1 开
+					picture_info_falg = 1;
+				}
+#endif
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+				else if(buff[0] == 0x0C && len >= 2)
+				{
+					picture_block = (buff[1] != 0);      //按块条件刷新：0 关，1 开
+					picture_info_falg = 1;
+				}
+#endif
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+				else if(buff[0] == 0x0D && len >= 2)
+				{
+					picture_jpeg = (buff[1] > 100) ? 100 : buff[1];   //JPEG质量：0 关，1~100
+					picture_info_falg = 1;
+				}
+#endif
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED)
+				else if(buff[0] == 0x0E && len >= 2)
+				{
+					picture_prog = (buff[1] != 0);       //渐进传输：0 关，1 开
+					picture_info_falg = 1;
+				}
+#endif
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+				else if(buff[0] == 0x10 && len >= 2)
+					picture_latest = (buff[1] != 0);         //最新帧优先：0 关（每帧发完），1 开
+#endif
+#if (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+				else if(buff[0] == 0x0F && len >= 2)
+				{
+					/*区域加权：ROI外倍数（0 关，2、4），可选ROI的X Y 宽 高（16位，高字节在前），下一帧对齐后生效*/
+					picture_fovea = (buff[1] == 2 || buff[1] == 4) ? buff[1] : 0;
+					if(len >= 10)
+					{
+						picture_fovea_roi.x = (buff[2] << 8) | buff[3];
+						picture_fovea_roi.y = (buff[4] << 8) | buff[5];
+						picture_fovea_roi.w = (buff[6] << 8) | buff[7];
+						picture_fovea_roi.h = (buff[8] << 8) | buff[9];
+					}
+					picture_info_falg = 1;
+				}
+#endif
 				else if(buff[0] == 0x02)
 					SystemReset();
 				else if(buff[0] == 0x08)
 					transfer_falg = 0;
+#if (APP_CFG_PICTURE_SEND_MODE == PICTURE_SEND_BOTH)
+				else if(buff[0] == 0x03)
+					stream_falg = 1;        //切换为边读边发
+				else if(buff[0] == 0x04)
+					stream_falg = 0;        //切换为队列发送
+#endif
 			}
 		}
-		OSTimeDlyHMSM ( 0, 0, 0, 5, OS_OPT_TIME_DLY, & err );     //ÿ500msһ
+		OSTimeDlyHMSM ( 0, 0, 0, 5, OS_OPT_TIME_DLY, & err );     //每隔500ms发送一次
 	}	
 }
 
@@ -369,64 +530,617 @@ static  void  APPTaskControlSend(void * p_arg)
 static  void  AppTaskOV7725 ( void * p_arg )
 {
 	OS_ERR      err;
-	uint16_t i = 0,j = 0,k = 0; 
-	uint16_t data_line = 0;
-	uint8 temp_Q = 0;
+#if (APP_CFG_OV7725_READ_MODE == OV7725_READ_BYTE)
+	uint16_t k = 0; 
 	uint8_t Camera_Data;
+#endif
+	uint16_t data_packet = 0;
+	uint16 pkt_len;
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	uint8_t *slot;
+	uint16 slot_len, fifo_len;
+#endif
+	uint8_t frame_err = 0;
+	uint8_t frame_stale = 0;
+	uint8_t format;
+	uint32_t test_seq = 0;
+	CPU_TS ts_start, ts_wait, ts_read, ts_cycles, read_cycles;
+	CPU_INT32U cycles_per_us = BSP_CPU_ClkFreq() / 1000000u;
 
 	//CPU_SR_ALLOC();
 	(void)p_arg;
 	
-	while (DEF_TRUE) {                                   //壬ͨдһѭ
-		//׳¼
-		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //¼־ָ
-                   (OS_FLAGS      )OV7725_EVENT, //ѡҪı־λ
-                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //ѡ
-                   (OS_ERR       *)&err); //ش;
+	while (DEF_TRUE) {                                   //任务体，通常写成一个死循环
+		//抛出事件
+		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //事件标志组指针
+                   (OS_FLAGS      )OV7725_EVENT, //选定要操作的标志位
+                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //选项
+                   (OS_ERR       *)&err); //返回错误类型;
+
+		if(window_req.req)              //帧间隙改变窗口
+		{
+			window_req.req = 0;
+			if(!PictureFits(window_req.width, cam_mode.format, 1)
+			   || OV7725_Window_Change(window_req.sx, window_req.sy, window_req.width, window_req.height, window_req.vga) != SUCCESS)
+				printf("\r\nwindow %d,%d %dx%d %s invalid\r\n", window_req.sx, window_req.sy, window_req.width, window_req.height,
+				       window_req.vga ? "VGA" : "QVGA");
+			picture_info_falg = 1;      //不管是否成功都通告实际窗口
+		}
+		if(format_req != 0xff)          //帧间隙切换输出格式
+		{
+			format = format_req;
+			format_req = 0xff;
+			if(!PictureFits(cam_mode.cam_width, format, 1) || OV7725_Format_Change(format) != SUCCESS)
+				printf("\r\nformat %d invalid\r\n", format);
+			picture_info_falg = 1;
+		}
+		if(bin_req)                     //帧间隙改变缩小倍数
+		{
+			if(PictureBinSet(bin_req) != SUCCESS)
+				printf("\r\nbin %d invalid\r\n", bin_req);
+			bin_req = 0;
+			picture_info_falg = 1;
+		}
+		if(picture_info_falg && PictureBinSet(picture_bin) != SUCCESS)
+			PictureBinSet(1);           //窗口或格式改变后原倍数不再适用
+		if(test_req != 0xff)            //帧间隙切换测试图案
+		{
+			picture_test = test_req;
+			test_req = 0xff;
+			if(picture_test > PICTURE_TEST_SYNTH)
+				picture_test = PICTURE_TEST_OFF;
+			if(OV7725_ColorBar(picture_test == PICTURE_TEST_SENSOR) != SUCCESS && picture_test == PICTURE_TEST_SENSOR)
+				picture_test = PICTURE_TEST_SYNTH;  //没有摄像头，改用合成图案
+			picture_info_falg = 1;
+		}
+		OV7725_Reg_Flush();             //帧间隙写出改过的传感器寄存器
 
 		if(transfer_falg)
 		{
-			if( Ov7725_vsync == 2 )
+			if(picture_info_falg)
+			{
+				picture_info_falg = 0;
+				AppPictureInfoSend();       //在下一帧图像包之前发出
+			}
+			if(picture_test == PICTURE_TEST_SYNTH)
+			{
+				/*合成测试图案，不读FIFO，按队列/网络能跑多快就发多快*/
+				ts_start = OS_TS_GET();
+				AppTestFrameSend(++test_seq);
+				capture_stat.frame_cnt++;
+				capture_stat.frame_seq = test_seq;
+				capture_stat.capture_us = (OS_TS_GET() - ts_start) / cycles_per_us;
+				OSTimeDly(1, OS_OPT_TIME_DLY, &err);    //让出CPU给低优先级的控制任务
+			}
+			else if( !OV7725_Frame_Begin() )     //FIFO中没有写完的帧
+			{
+				OV7725_Reg_Verify();        //反正要等VSYNC，读回校验一个写过的寄存器
+				ts_start = OS_TS_GET();
+				OSTaskSemPend ((OS_TICK   )OSCfg_TickRate_Hz / 10,      //等待VSYNC中断通知一帧已写入FIFO，超时回去喂狗
+				               (OS_OPT    )OS_OPT_PEND_BLOCKING,
+				               (CPU_TS   *)0,
+				               (OS_ERR   *)&err);
+				capture_stat.vsync_wait_us = (OS_TS_GET() - ts_start) / cycles_per_us;
+			}
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+			else if(AppFrameStale(0))       //还没开始读就已有更新的帧，整帧跳过
+			{
+			}
+#endif
+			else
 			{
-				FIFO_PREPARE;  			/*FIFO׼*/	
-				for (data_line = 0; data_line < cam_mode.cam_height; ) //Сڻ߶ȣһֱȴ
+				/*读这一帧时传感器已在往FIFO后面写下一帧*/
+				ts_start = OS_TS_GET();
+				ts_cycles = 0;
+				read_cycles = 0;
+				frame_err = 0;
+				frame_stale = 0;
+				data_packet = 0;
+				PictureStatsBegin();
+				PictureJpegBegin();
+				PictureBlockBegin();
+				PictureProgBegin();
+				PictureFoveaBegin();
+				PicturePackingSet();        //与图像参数包中的包长相同
+#if (PICTURE_DIRECT_EN == DEF_ENABLED)
+				if(PictureDirectFrame())
 				{
-					if(Q->size < PictureMaxSize)	//δ
+					/*渐进传输、区域加权：图像模块自己读FIFO打包，不按行读*/
+					ts_read = OS_TS_GET();
+					ts_wait = AppDirectSend();
+					ts_cycles += ts_wait;
+					read_cycles += OS_TS_GET() - ts_read - ts_wait;
+					data_packet = picture_pack.packets;
+#if (APP_CFG_OV7725_READ_MODE == OV7725_READ_DMA)
+					if(ov7725_read_err)
+					{
+						ov7725_read_err = 0;
+						frame_err = 1;          //DMA读超时，读指针位置不确定
+					}
+#endif
+				}
+#endif
+				for ( ; data_packet < picture_pack.packets; ) //包数小于一帧的包数，一直等待
+				{
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+					if(data_packet && AppFrameStale(data_packet))
+					{
+						frame_stale = 1;    //读的过程中又写完了一帧
+						break;
+					}
+#endif
+					pkt_len = PicturePacketSize(data_packet);
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_QUEUE)
+					if(stream_falg)
+					{
+						/*一包直接从FIFO写进W5500发出，独占SPI防止其它任务在连续写中访问W5500*/
+						ts_read = OS_TS_GET();
+						wiz_spi_lock();
+						SendPictureStream(pkt_len);
+						wiz_spi_unlock();
+						read_cycles += OS_TS_GET() - ts_read;
+						data_packet++;
+						continue;
+					}
+#endif
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+					slot = PictureRingReserve();
+					if(slot == NULL)	//如果队列已满，挂起等待发送任务发完一格
+					{
+						ts_wait = OS_TS_GET();
+						OSSemPend(&picture_free_sem, (OS_TICK)OSCfg_TickRate_Hz / 10, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+						ts_cycles += OS_TS_GET() - ts_wait;
+						continue;
+					}
+					ts_read = OS_TS_GET();
+					if(picture_bin > 1)
+					{
+						/*每picture_bin行合并成1行，读满一包的行数*/
+						for(slot_len = 0; slot_len < pkt_len; )
+							slot_len += OV7725_ReadBinned(slot + slot_len, cam_mode.cam_width, picture_bin, cam_mode.format);
+					}
+					else if(cam_mode.format == OV7725_FORMAT_GRAY && pkt_len * 2 > PICTURE_PACKET_MAX)
+					{
+						/*原始数据是Y的2倍，放不下一块，边读边丢U、V*/
+						slot_len = OV7725_ReadY(slot, pkt_len);
+					}
+					else if(cam_mode.format == OV7725_FORMAT_RGB332)
 					{
-						if(data_line%2 == 0)
-						{			
-							temp_Q = EnQueue(Q);
-							i = 0;
-							k = 0;
+						/*边读边按4x4抖动查表转成RGB332，一包的行数为4的倍数*/
+						slot_len = OV7725_ReadRGB332(slot, cam_mode.cam_width, pkt_len / cam_mode.cam_width);
+					}
+					else
+					{
+						fifo_len = (cam_mode.format == OV7725_FORMAT_GRAY) ? pkt_len * 2 : pkt_len;
+#if (APP_CFG_OV7725_READ_MODE == OV7725_READ_DMA)
+						OV7725_DMA_ReadBlock(slot, fifo_len, &err);   //DMA读出一包，读完前任务挂起
+						if(err != OS_ERR_NONE)
+						{
+							frame_err = 1;      //读超时，读指针位置不确定
+							break;
 						}
-						while (i < 2)  //֤2
+#elif (APP_CFG_OV7725_READ_MODE == OV7725_READ_LINES)
+						OV7725_ReadBytes(slot, fifo_len);   //展开读，行可以跨包
+#else
+						for(k = 0; k < fifo_len; k++)
 						{
-							for(j = 0; j < cam_mode.cam_width; j++)
-							{
-								READ_FIFO_PIXEL(Camera_Data);		/* FIFOһrgb565صĸλCamera_Data */
-								picture_data[temp_Q][k++] = Camera_Data;
-								READ_FIFO_PIXEL(Camera_Data);		/* FIFOһrgb565صĵλCamera_Data */
-								picture_data[temp_Q][k++] = Camera_Data;
-							}
-							i++;
+							READ_FIFO_PIXEL(Camera_Data);		/* 从FIFO读出一个字节到Camera_Data变量 */
+							slot[k] = Camera_Data;
 						}
-						data_line += 2;
-						//OS_CRITICAL_ENTER(); //ٽΣ⴮ڴӡ
-						//printf ( "\r\n1\r\n");        		
-						//OS_CRITICAL_EXIT();  //˳ٽ
+#endif
+						slot_len = fifo_len;
+						if(cam_mode.format == OV7725_FORMAT_GRAY)
+							slot_len = OV7725_Keep_Y(slot, slot_len);   //只留Y
 					}
-					OSTimeDlyHMSM ( 0, 0, 0, 1, OS_OPT_TIME_DLY, & err );
+#if (APP_CFG_OV7725_READ_MODE == OV7725_READ_DMA)
+					if(ov7725_read_err)
+					{
+						ov7725_read_err = 0;
+						frame_err = 1;          //合并、只留Y、RGB332的DMA读超时
+						break;
+					}
+#endif
+					if(PictureStatsTake())
+						PictureStatsAdd(slot, slot_len);   //抽样统计，计入读出时间
+#if (PICTURE_BAND_EN == DEF_ENABLED)
+					if(PictureBandFrame())
+					{
+						/*按块刷新、JPEG：这一格只作暂存，数据复制进带缓冲，带满后再把要发的包入队*/
+						ts_wait = 0;
+						if(PictureBandAdd(slot, slot_len))
+							ts_wait = AppBandSend();
+						ts_cycles += ts_wait;
+						read_cycles -= ts_wait;
+					}
+					else
+#endif
+					PictureRingCommit(slot_len, 0);
+					data_packet++;
+					read_cycles += OS_TS_GET() - ts_read;
+#endif
+					//OS_CRITICAL_ENTER(); //进入临界段，避免串口打印被打断
+					//printf ( "\r\n1\r\n");        		
+					//OS_CRITICAL_EXIT();  //退出临界段
 				}
 				
-				Ov7725_vsync = 0;			
+				if(frame_err)
+				{
+					OV7725_Frame_Discard();     //丢掉FIFO中的帧，下一个VSYNC重新对齐读写指针
+					continue;
+				}
+				if(frame_stale)
+					continue;                   //已空读到帧尾，不计入本帧统计
+				OV7725_Frame_End();
 				macLED1_TOGGLE();
+
+				/*本帧计时统计*/
+				capture_stat.frame_cnt++;
+				capture_stat.frame_seq = ov7725_pipe.read_seq;
+				capture_stat.capture_us = (OS_TS_GET() - ts_start) / cycles_per_us;
+				capture_stat.queue_wait_us = ts_cycles / cycles_per_us;
+				capture_stat.read_cycles = read_cycles;
+				capture_stat.read_cycles_per_px = read_cycles / ((uint32_t)cam_mode.cam_width * cam_mode.cam_height);
+				if(capture_stat.capture_us > capture_stat.capture_max_us)
+					capture_stat.capture_max_us = capture_stat.capture_us;
+				if(capture_stat.queue_wait_us > capture_stat.queue_wait_max_us)
+					capture_stat.queue_wait_max_us = capture_stat.queue_wait_us;
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+				AppPictureBlockEnd(capture_stat.frame_seq);
+#endif
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+				capture_stat.stats_cycles = picture_stats.cycles;
+				AppPictureStatsSend(capture_stat.frame_seq);
+#endif
+#if (APP_CFG_RATE_CTRL_EN == DEF_ENABLED)
+				AppRateControl();
+#endif
 			}
 		}
-		OSTimeDlyHMSM ( 0, 0, 0, 5, OS_OPT_TIME_DLY, & err );	
+		else
+		{
+			OSTimeDlyHMSM ( 0, 0, 0, 5, OS_OPT_TIME_DLY, & err );	
+		}
 	}		
 }
 
 
+/*
+*********************************************************************************************************
+*                                          PACKET SEND
+*
+* Description : 在图像包之间插入发送一个短包（参数包、统计包）。
+*               队列方式下也经队列发出，保证与图像包的先后顺序不变。
+*
+* Arguments   : buf     包内容
+*               len     包长，不大于PICTURE_PACKET_MAX
+*********************************************************************************************************
+*/
+static  void  AppPacketSend(const uint8_t *buf, uint16 len)
+{
+	OS_ERR err;
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	uint8_t *slot;
+#endif
+
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_QUEUE)
+	if(stream_falg)
+	{
+		wiz_spi_lock();
+		if(getSn_SR(SOCK_UDPS) == SOCK_UDP)
+			sendto(SOCK_UDPS, (uint8 *)buf, len, remote_ip, remote_port);
+		wiz_spi_unlock();
+		return;
+	}
+#endif
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	while((slot = PictureRingReserve()) == NULL)
+		OSSemPend(&picture_free_sem, (OS_TICK)OSCfg_TickRate_Hz / 10, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+	Mem_Copy(slot, buf, len);
+	PictureRingCommit(len, 1);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          PICTURE INFO
+*
+* Description : 发送图像参数包（窗口大小、格式），接收端据此确定每帧的包数和包长。
+*               参数包排在旧窗口的图像包之后。
+*********************************************************************************************************
+*/
+static  void  AppPictureInfoSend(void)
+{
+	uint8_t info[PICTURE_INFO_LEN];
+
+	PictureInfoPack(info);
+	AppPacketSend(info, PICTURE_INFO_LEN);
+}
+
+
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                          PICTURE STATS
+*
+* Description : 一帧读完后发送读出时累加的统计包，内容见PictureStatsPack()。
+*
+* Arguments   : seq     帧序号
+*********************************************************************************************************
+*/
+static  void  AppPictureStatsSend(uint32_t seq)
+{
+	uint8_t stats[PICTURE_STATS_LEN];
+	uint16 len;
+
+	len = PictureStatsPack(stats, seq);
+	if(len)
+		AppPacketSend(stats, len);
+}
+#endif
+
+
+#if (PICTURE_BAND_EN == DEF_ENABLED) && (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+/*
+*********************************************************************************************************
+*                                          BAND SEND
+*
+* Description : 一带存满后，把这一带要发的块包（刷新帧为原始图像包）或JPEG包直接打包进队列。
+*
+* Returns     : 等待队列空位的DWT周期数
+*********************************************************************************************************
+*/
+static  CPU_TS  AppBandSend(void)
+{
+	OS_ERR err;
+	CPU_TS ts, wait = 0;
+	uint8_t *slot;
+	uint16 len;
+
+	while(DEF_TRUE)
+	{
+		slot = PictureRingReserve();
+		if(slot == NULL)
+		{
+			ts = OS_TS_GET();
+			OSSemPend(&picture_free_sem, (OS_TICK)OSCfg_TickRate_Hz / 10, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+			wait += OS_TS_GET() - ts;
+			continue;
+		}
+		len = PictureBandPack(slot);
+		if(len == 0)
+			break;
+		PictureRingCommit(len, 0);
+	}
+	return wait;
+}
+#endif
+
+
+#if (PICTURE_DIRECT_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                          DIRECT SEND
+*
+* Description : 发送图像模块自己读FIFO打包的一帧：渐进传输（每遍重读FIFO中的这一帧，
+*               第0遍1/4分辨率，后面的遍补齐其余格点），或区域加权（ROI全分辨率，ROI外缩小）。
+*               边读边发时每包持有一次W5500锁（wiz_spi_lock）；队列方式直接打包进队列。
+*
+* Returns     : 等待队列空位的DWT周期数
+*********************************************************************************************************
+*/
+static  CPU_TS  AppDirectSend(void)
+{
+	OS_ERR err;
+	CPU_TS wait = 0;
+	uint16 len;
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	CPU_TS ts;
+	uint8_t *slot;
+#endif
+
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_QUEUE)
+	if(stream_falg)
+	{
+		do
+		{
+			wiz_spi_lock();
+			len = SendPictureDirect();
+			wiz_spi_unlock();
+		}while(len);
+		return wait;
+	}
+#endif
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	while(DEF_TRUE)
+	{
+		slot = PictureRingReserve();
+		if(slot == NULL)
+		{
+			ts = OS_TS_GET();
+			OSSemPend(&picture_free_sem, (OS_TICK)OSCfg_TickRate_Hz / 10, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+			wait += OS_TS_GET() - ts;
+			continue;
+		}
+		len = PictureDirectPack(slot);
+		if(len == 0)
+			break;
+		PictureRingCommit(len, 0);
+	}
+#endif
+	return wait;
+}
+#endif
+
+
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+
+/*
+*********************************************************************************************************
+*                                          BLOCK END
+*
+* Description : 按块发送的帧读完后发帧结束包，接收端收到后显示补好的一帧。
+*
+* Arguments   : seq     帧序号
+*********************************************************************************************************
+*/
+static  void  AppPictureBlockEnd(uint32_t seq)
+{
+	uint8_t end[BLOCK_END_LEN];
+	uint16 len;
+
+	len = PictureBlockEnd(end, seq);
+	if(len)
+		AppPacketSend(end, len);
+}
+#endif
+
+
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                          STALE FRAME
+*
+* Description : 最新帧优先打开、正在读的帧后面FIFO中已有写完的帧时，这一帧不读完了：空读到帧尾，
+*               队列中还没发的图像包作废，让出带宽先发更新的帧。关闭时每帧都完整送出（原行为）。
+*               接收端靠下一帧的第一包（或最后一包较短）重新对齐，放弃的帧不会显示。
+*
+* Arguments   : packets     这一帧已读出的包数
+*
+* Returns     : 1：已放弃，0：接着读
+*********************************************************************************************************
+*/
+static  uint8_t  AppFrameStale(uint16 packets)
+{
+	if(!picture_latest || ov7725_pipe.write_seq - ov7725_pipe.read_seq < 2)
+		return 0;
+	OV7725_Frame_Skip(ov7725_pipe.frame_bytes - PictureFifoOffset(packets));
+	PictureFrameAbandon(!stream_falg);
+	return 1;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TEST FRAME
+*
+* Description : 发送一帧合成测试图案，内容见PictureTestPack()。
+*
+* Arguments   : seq     帧序号，写在每包的包头中
+*********************************************************************************************************
+*/
+static  void  AppTestFrameSend(uint32_t seq)
+{
+	OS_ERR err;
+	uint16_t index;
+	uint16_t packets;
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_QUEUE)
+	static uint8_t test_buf[PICTURE_PACKET_MAX];
+	uint16_t len;
+#endif
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	uint8_t *slot;
+#endif
+
+	PicturePackingSet();
+	packets = picture_pack.packets;
+	for(index = 0; index < packets; index++)
+	{
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_QUEUE)
+		if(stream_falg)
+		{
+			len = PictureTestPack(test_buf, seq, index);
+			wiz_spi_lock();
+			if(getSn_SR(SOCK_UDPS) == SOCK_UDP)
+				sendto(SOCK_UDPS, test_buf, len, remote_ip, remote_port);
+			wiz_spi_unlock();
+			continue;
+		}
+#endif
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+		while((slot = PictureRingReserve()) == NULL)
+			OSSemPend(&picture_free_sem, (OS_TICK)OSCfg_TickRate_Hz / 10, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+		PictureRingCommit(PictureTestPack(slot, seq, index), 0);
+#endif
+	}
+}
+
+
+#if (APP_CFG_RATE_CTRL_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                          RATE CONTROL
+*
+* Description : 每读完一帧调用一次，按积压情况调整传感器帧率。发送跟不上时与其让FIFO中的帧
+*               越积越旧、被跳过，不如让传感器慢下来，每帧都完整、及时地送出。
+*               连续APP_CFG_RATE_DOWN_FRAMES帧拥塞降一档；连续up_frames帧通畅升一档，
+*               升档后很快又拥塞说明上一档已是极限，up_frames加倍，避免来回振荡。
+*               每次调整都发图像参数包，接收端据此显示目标帧率。
+*********************************************************************************************************
+*/
+static  void  AppRateControl(void)
+{
+	uint8_t reason = 0;
+	uint8_t div;
+
+	if(capture_stat.queue_wait_us * 4 > capture_stat.capture_us)
+		reason |= RATE_QUEUE;
+	if(ov7725_pipe.dropped != rate_ctrl.last_dropped)
+		reason |= RATE_DROP;
+	rate_ctrl.last_dropped = ov7725_pipe.dropped;
+	if(getSn_SR(SOCK_UDPS) == SOCK_UDP && getSn_TX_FSR(SOCK_UDPS) < PicturePacketLen())
+		reason |= RATE_TXBUF;
+
+	if(reason)
+	{
+		rate_ctrl.idle_frames = 0;
+		if(++rate_ctrl.busy_frames < APP_CFG_RATE_DOWN_FRAMES || rate_ctrl.div >= APP_CFG_RATE_DIV_MAX)
+			return;
+		div = rate_ctrl.div + 1;
+		if(rate_ctrl.up_pending)
+		{
+			if(rate_ctrl.up_frames < APP_CFG_RATE_UP_FRAMES * 8)
+				rate_ctrl.up_frames *= 2;
+		}
+		else
+			rate_ctrl.up_frames = APP_CFG_RATE_UP_FRAMES;   //不是升档引起的，情况变了，重新试探
+	}
+	else
+	{
+		rate_ctrl.busy_frames = 0;
+		if(++rate_ctrl.idle_frames < rate_ctrl.up_frames)
+			return;
+		rate_ctrl.idle_frames = 0;
+		rate_ctrl.up_pending = 0;
+		if(rate_ctrl.div == 0)
+			return;
+		div = rate_ctrl.div - 1;
+	}
+
+	if(OV7725_FrameRate_Set(div) != SUCCESS)
+		return;
+	if(div > rate_ctrl.div)
+	{
+		rate_ctrl.step_down++;
+		rate_ctrl.reason = reason;
+		rate_ctrl.up_pending = 0;
+	}
+	else
+	{
+		rate_ctrl.step_up++;
+		rate_ctrl.up_pending = 1;
+	}
+	rate_ctrl.div = div;
+	rate_ctrl.target_fps = OV7725_FPS_BASE / (div + 1);
+	rate_ctrl.busy_frames = 0;
+	printf("\r\nrate %d fps (%s%s%s)\r\n", rate_ctrl.target_fps, (reason & RATE_QUEUE) ? "q" : "",
+	       (reason & RATE_DROP) ? "d" : "", (reason & RATE_TXBUF) ? "t" : "");
+	picture_info_falg = 1;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          Send Picture Data TASK
@@ -435,43 +1149,51 @@ static  void  AppTaskOV7725 ( void * p_arg )
 static  void  AppTaskSendPicture(void *p_arg)
 {
 	OS_ERR err;
-	uint8 DeQueue_Temp = 0;
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	PICTURE_BUF *buf;
+#endif
 	//CPU_SR_ALLOC();
 
 	while(DEF_TRUE)
 	{
-		//׳¼
-		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //¼־ָ
-                   (OS_FLAGS      )SENDPICTURE_EVENT, //ѡҪı־λ
-                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //ѡ
-                   (OS_ERR       *)&err); //ش;
+		//抛出事件
+		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //事件标志组指针
+                   (OS_FLAGS      )SENDPICTURE_EVENT, //选定要操作的标志位
+                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //选项
+                   (OS_ERR       *)&err); //返回错误类型;
 		//if (transfer_falg)
 		// {
-			if(Q->size > 0)
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+			buf = PictureRingPeek();
+			if(buf == NULL)
+			{
+				/*队列空才挂起，采集任务提交后马上醒来；超时也回来喂狗*/
+				OSSemPend(&picture_ready_sem, (OS_TICK)OSCfg_TickRate_Hz / 100, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+			}
+			else
 			{
-				DeQueue_Temp = DeQueue(Q);
-				switch(getSn_SR(SOCK_UDPS))                                                /*ȡsocket״̬*/
+				switch(getSn_SR(SOCK_UDPS))                                                /*获取socket的状态*/
 				{
-					case SOCK_CLOSED:                                                        /*socketڹر״̬*/
+					case SOCK_CLOSED:                                                        /*socket处于关闭状态*/
 					{
-						socket(SOCK_UDPS2,Sn_MR_UDP,local_port,0);                              /*ʼsocket*/
+						socket(SOCK_UDPS2,Sn_MR_UDP,local_port,0);                              /*初始化socket*/
 						break;
 					}
 					case SOCK_UDP:
 					{
-						sendto(SOCK_UDPS,picture_data[DeQueue_Temp], 1280, remote_ip, remote_port);
+						PictureSend(buf->data, buf->len);
 						break;
 					}
 				}
-				// OS_CRITICAL_ENTER();                              //ٽΣ⴮ڴӡ
+				PictureRingRelease();       //发完才交还这一包，采集任务不会改写正在发的数据
+				// OS_CRITICAL_ENTER();                              //进入临界段，避免串口打印被打断
 				// printf ( "\r\n2\r\n");        		
-				// OS_CRITICAL_EXIT();  //˳ٽ
+				// OS_CRITICAL_EXIT();  //退出临界
 			}
+#else
+			OSTimeDlyHMSM ( 0, 0, 0, 10, OS_OPT_TIME_DLY, & err );   //边读边发，这里只喂狗
+#endif
 		// }
-		
-		
-		
-		OSTimeDlyHMSM ( 0, 0, 0, 1, OS_OPT_TIME_DLY, & err );
 	}
 	
 }
@@ -485,33 +1207,33 @@ static  void  AppTaskSendPicture(void *p_arg)
 static  void  AppTaskReciveData ( void * p_arg )
 {
 	OS_ERR      err;
-	uint8_t len = 0;
-	uint16 local_port2 = 7000;                              /*屾ض˿UDP2*/
+	uint16 len = 0;
+	uint16 local_port2 = 7000;                              /*定义本地端口UDP2*/
 	uint8_t buff[1] = {0};
 	(void)p_arg;
 	
-	while (DEF_TRUE) {                                   //壬ͨдһѭ
-		//׳¼
-		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //¼־ָ
-                   (OS_FLAGS      )RECIVEDATA_EVENT, //ѡҪı־λ
-                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //ѡ
-                   (OS_ERR       *)&err); //ش;
-
-		switch(getSn_SR(SOCK_UDPS2))                                                /*ȡsocket״̬*/
+	while (DEF_TRUE) {                                   //任务体，通常写成一个死循环
+		//抛出事件
+		OSFlagPost((OS_FLAG_GRP  *)&watchDogFlag, //事件标志组指针
+                   (OS_FLAGS      )RECIVEDATA_EVENT, //选定要操作的标志位
+                   (OS_OPT        )OS_OPT_POST_FLAG_SET,   //选项
+                   (OS_ERR       *)&err); //返回错误类型;
+
+		switch(getSn_SR(SOCK_UDPS2))                                                /*获取socket的状态*/
 		{
-			case SOCK_CLOSED:                                                        /*socketڹر״̬*/
-				socket(SOCK_UDPS2,Sn_MR_UDP,local_port2,0);                              /*ʼsocket*/
+			case SOCK_CLOSED:                                                        /*socket处于关闭状态*/
+				socket(SOCK_UDPS2,Sn_MR_UDP,local_port2,0);                              /*初始化socket*/
 				break;
 			
-			case SOCK_UDP:                                                           /*socketʼ*/
+			case SOCK_UDP:                                                           /*socket初始化完成*/
 				if(getSn_IR(SOCK_UDPS2) & Sn_IR_RECV)
 				{
-					setSn_IR(SOCK_UDPS2, Sn_IR_RECV);                                     /*ж*/
+					setSn_IR(SOCK_UDPS2, Sn_IR_RECV);                                     /*清接收中断*/
 				}
 				//sendto(SOCK_UDPS2,buff1,6, remote_ip, remote_port);
-				if((len=getSn_RX_RSR(SOCK_UDPS2))>0)                                    /*յ*/
+				if((len=getSn_RX_RSR(SOCK_UDPS2))>0)                                    /*接收到数据*/
 				{
-					recvfrom(SOCK_UDPS2,buff, len, remote_ip,&remote_port2);               /*W5500ռ*/
+					recvfrom(SOCK_UDPS2,buff, sizeof(buff), remote_ip,&remote_port2);      /*W5500接收计算机发送来的数据，多出的字节丢弃*/
 					if(buff[0] == 0x0A)                                                    
 						printf("u");
 					if(buff[0] == 0x0B)                                                    
@@ -522,11 +1244,11 @@ static  void  AppTaskReciveData ( void * p_arg )
 						printf("r");
 					if(buff[0] == 0x0E)                                                    
 						printf("s");
-					//sendto(SOCK_UDPS,AckData, 1, remote_ip, remote_port);                /*W5500ѽյݷ͸Remote*/
+					//sendto(SOCK_UDPS,AckData, 1, remote_ip, remote_port);                /*W5500把接收到的数据发送给Remote*/
 				}
 				break;
 		}	
-		OSTimeDlyHMSM ( 0, 0, 0, 20, OS_OPT_TIME_DLY, & err );                   //ÿ20msɨһ
+		OSTimeDlyHMSM ( 0, 0, 0, 20, OS_OPT_TIME_DLY, & err );                   //每20ms扫描一次
 	}
 	
 }
@@ -39,7 +39,45 @@
 *********************************************************************************************************
 */
 
-#define  APP_CFG_SERIAL_EN                          DEF_DISABLED          // Modified by fire ԭ DEF_ENABLED
+#define  APP_CFG_SERIAL_EN                          DEF_DISABLED          // Modified by fire （原是 DEF_ENABLED）
+
+#define  OV7725_READ_BYTE                           0                     //CPU逐字节读（原实现）
+#define  OV7725_READ_LINES                          1                     //CPU按字读，OV7725_ReadBytes()，行可以跨包
+#define  OV7725_READ_DMA                            2                     //定时器+DMA读，合并、只留Y、RGB332也从DMA行缓冲取；连续写W5500、空读仍由CPU
+#define  APP_CFG_OV7725_READ_MODE                   OV7725_READ_DMA       //FIFO读出方式
+
+#define  PICTURE_SEND_QUEUE                         0                     //读到picture_data再由发送任务发出（原实现）
+#define  PICTURE_SEND_STREAM                        1                     //边读FIFO边写W5500，不要picture_data
+#define  PICTURE_SEND_BOTH                          2                     //两种都编译，控制字0x03/0x04运行时切换
+#define  APP_CFG_PICTURE_SEND_MODE                  PICTURE_SEND_BOTH     //图片发送方式
+#define  APP_CFG_PICTURE_MTU                        1472                  //一包最大字节数（UDP载荷），1280~1472；以太网MTU 1500时为1472
+#define  APP_CFG_PICTURE_QUEUE_DEPTH                4                     //队列格数，2的幂
+#define  APP_CFG_PICTURE_BUF_COUNT                  4                     //包缓冲块数（每块PICTURE_PACKET_MAX+4字节），不少于队列格数，多出的给重传缓存、预览等持有者
+
+#define  APP_CFG_PICTURE_STATS_EN                   DEF_ENABLED           //读出时统计直方图等，控制字0x0A运行时开关
+#define  APP_CFG_PICTURE_STATS_STEP                 4                     //每几包统计1包
+
+#define  APP_CFG_PICTURE_CODEC_EN                   DEF_ENABLED           //RGB565图像包无损压缩，控制字0x0B运行时开关
+
+#define  APP_CFG_PICTURE_BLOCK_EN                   DEF_ENABLED           //按16x16块条件刷新，控制字0x0C运行时开关
+#define  APP_CFG_PICTURE_BLOCK_THRESH               4                     //块签名（4个子块的亮度均值）变化超过此值才发
+#define  APP_CFG_PICTURE_BLOCK_REFRESH              100                   //每多少帧整帧刷新一次
+
+#define  APP_CFG_PICTURE_JPEG_EN                    DEF_ENABLED           //基线JPEG，控制字0x0D运行时设质量（0为关）
+#define  APP_CFG_PICTURE_JPEG_QUALITY               50                    //开机时预先算好量化表的质量
+
+#define  APP_CFG_PICTURE_PROG_EN                    DEF_ENABLED           //渐进传输，先发1/4分辨率再补全，控制字0x0E运行时开关
+#define  APP_CFG_PICTURE_FOVEA_EN                   DEF_ENABLED           //区域加权，ROI外缩小2或4倍，控制字0x0F运行时设倍数和ROI
+
+#define  APP_CFG_PICTURE_LATEST_EN                  DEF_ENABLED           //最新帧优先，FIFO中有更新的帧时放弃正在读的帧，控制字0x10运行时开关；要有队列，发送方式不能是STREAM
+
+#define  APP_CFG_WIZ_SPI_DMA_EN                     DEF_ENABLED           //W5500读写缓冲区用SPI DMA，传输期间任务挂起
+#define  APP_CFG_WIZ_SPI_DMA_MIN                    16                    //少于此字节数（寄存器访问等）仍逐字节轮询
+
+#define  APP_CFG_RATE_CTRL_EN                       DEF_ENABLED           //按队列、FIFO、W5500的积压自动调整传感器帧率
+#define  APP_CFG_RATE_DIV_MAX                       5                     //最多降到OV7725_FPS_BASE/6
+#define  APP_CFG_RATE_DOWN_FRAMES                   3                     //连续拥塞的帧数，降一档
+#define  APP_CFG_RATE_UP_FRAMES                     50                    //连续通畅的帧数，升一档（升档后又降则加倍）
 
 /*
 *********************************************************************************************************
@@ -47,7 +85,7 @@
 *********************************************************************************************************
 */
 
-#define  APP_TASK_START_PRIO                        2            //ȼ
+#define  APP_TASK_START_PRIO                        2            //任务优先级
 
 #define  APP_TASK_WATCHDOG_PRIO                      3
 #define  APP_TASK_OV7725_PRIO                       9
@@ -64,7 +102,7 @@
 *********************************************************************************************************
 */
 
-#define  APP_TASK_START_STK_SIZE                    128          //ջռ䣨λsizeof(CPU_STK)
+#define  APP_TASK_START_STK_SIZE                    128          //任务堆栈空间（单位：sizeof(CPU_STK)）
 
 #define  APP_TASK_WATCHDOG_STK_SIZE                 128
 #define  APP_TASK_OV7725_STK_SIZE                   512
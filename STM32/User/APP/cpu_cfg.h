@@ -96,7 +96,7 @@
 */
 
                                                                 /* Configure CPU timestamp features (see Note #1) :     */
-#define  CPU_CFG_TS_32_EN                       DEF_ENABLED          // Modified by fire ԭ DEF_DISABLED
+#define  CPU_CFG_TS_32_EN                       DEF_ENABLED          // Modified by fire （原是 DEF_DISABLED）
 #define  CPU_CFG_TS_64_EN                       DEF_DISABLED
                                                                 /*   DEF_DISABLED  CPU timestamps DISABLED              */
                                                                 /*   DEF_ENABLED   CPU timestamps ENABLED               */
@@ -132,7 +132,7 @@
 *********************************************************************************************************
 */
 
-#if 1          // Modified by fire ԭ 0                    /* Configure CPU interrupts disabled time ...           */
+#if 1          // Modified by fire （原是 0）                    /* Configure CPU interrupts disabled time ...           */
 #define  CPU_CFG_INT_DIS_MEAS_EN                                /* ... measurements feature (see Note #1a).             */
 #endif
 
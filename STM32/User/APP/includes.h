@@ -83,7 +83,7 @@
 *********************************************************************************************************
 */
 
-#include "stm32f10x.h"          // Modified by fire (ԭ #include  <stm32f10x_lib.h>) 
+#include "stm32f10x.h"          // Modified by fire (原是 #include  <stm32f10x_lib.h>) 
 
 
 /*
@@ -3,7 +3,7 @@
 
 #include "stm32f10x.h"
 #include "Types.h"
-extern uint16 udp_port;/*UDPһ˿ڲʼ*/
+extern uint16 udp_port;/*定义UDP的一个端口并初始化*/
 void do_udp(void);
 #endif 
 
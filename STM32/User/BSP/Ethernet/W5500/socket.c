@@ -4,7 +4,7 @@
 * @author  		WIZnet Software Team 
 * @version 		V1.0
 * @date    		2015-xx-xx
-* @brief   		Socketغ 
+* @brief   		Socket编程相关函数 
 ******************************************************************************
 */
 #include "socket.h"
@@ -32,6 +32,7 @@ uint8 socket(SOCKET s, uint8 protocol, uint16 port, uint8 flag)
         ((protocol&0x0F) == Sn_MR_PPPOE)
       )
    {
+      wiz_spi_lock();
       close(s);
       IINCHIP_WRITE(Sn_MR(s) ,protocol | flag);
       if (port != 0) {
@@ -48,6 +49,7 @@ uint8 socket(SOCKET s, uint8 protocol, uint16 port, uint8 flag)
       while( IINCHIP_READ(Sn_CR(s)) )
          ;
       /* ------- */
+      wiz_spi_unlock();
       ret = 1;
    }
    else
@@ -65,7 +67,7 @@ uint8 socket(SOCKET s, uint8 protocol, uint16 port, uint8 flag)
 */
 void close(SOCKET s)
 {
-
+   wiz_spi_lock();
    IINCHIP_WRITE( Sn_CR(s) ,Sn_CR_CLOSE);
 
    /* wait to process the command... */
@@ -73,6 +75,7 @@ void close(SOCKET s)
        ;/* ------- */
    
 	IINCHIP_WRITE( Sn_IR(s) , 0xFF);	 /* all clear */
+   wiz_spi_unlock();
 }
 
 
@@ -85,6 +88,7 @@ void close(SOCKET s)
 uint8 listen(SOCKET s)
 {
    uint8 ret;
+   wiz_spi_lock();
    if (IINCHIP_READ( Sn_SR(s) ) == SOCK_INIT)
    {
       IINCHIP_WRITE( Sn_CR(s) ,Sn_CR_LISTEN);
@@ -98,6 +102,7 @@ uint8 listen(SOCKET s)
    {
       ret = 0;
    }
+   wiz_spi_unlock();
    return ret;
 }
 
@@ -125,6 +130,7 @@ uint8 connect(SOCKET s, uint8 * addr, uint16 port)
     else
     {
         ret = 1;
+        wiz_spi_lock();
         // set destination IP
         IINCHIP_WRITE( Sn_DIPR0(s), addr[0]);
         IINCHIP_WRITE( Sn_DIPR1(s), addr[1]);
@@ -149,6 +155,7 @@ uint8 connect(SOCKET s, uint8 * addr, uint16 port)
                 break;
             }
         }
+        wiz_spi_unlock();
     }
 
    return ret;
@@ -161,12 +168,14 @@ uint8 connect(SOCKET s, uint8 * addr, uint16 port)
 */
 void disconnect(SOCKET s)
 {
+   wiz_spi_lock();
    IINCHIP_WRITE( Sn_CR(s) ,Sn_CR_DISCON);
 
    /* wait to process the command... */
    while( IINCHIP_READ(Sn_CR(s) ) )
       ;
    /* ------- */
+   wiz_spi_unlock();
 }
 
 /**
@@ -185,6 +194,7 @@ uint16 send(SOCKET s, const uint8 * buf, uint16 len)
   if (len > getIINCHIP_TxMAX(s)) ret = getIINCHIP_TxMAX(s); // check size not to exceed MAX size.
   else ret = len;
 
+  wiz_spi_lock();
   // if freebuf is available, start.
   do
   {
@@ -211,6 +221,7 @@ uint16 send(SOCKET s, const uint8 * buf, uint16 len)
     {
       printf("SEND_OK Problem!!\r\n");
       close(s);
+      wiz_spi_unlock();
       return 0;
     }
   }
@@ -221,6 +232,7 @@ uint16 send(SOCKET s, const uint8 * buf, uint16 len)
 #else
    IINCHIP_WRITE( Sn_IR(s) , Sn_IR_SEND_OK);
 #endif
+   wiz_spi_unlock();
 
    return ret;
 }
@@ -238,11 +250,13 @@ uint16 recv(SOCKET s, uint8 * buf, uint16 len)
    uint16 ret=0;
    if ( len > 0 )
    {
+      wiz_spi_lock();
       recv_data_processing(s, buf, len);
       IINCHIP_WRITE( Sn_CR(s) ,Sn_CR_RECV);
       /* wait to process the command... */
       while( IINCHIP_READ(Sn_CR(s) ));
       /* ------- */
+      wiz_spi_unlock();
       ret = len;
    }
    return ret;
@@ -273,6 +287,7 @@ uint16 sendto(SOCKET s, const uint8 * buf, uint16 len, uint8 * addr, uint16 port
    }
    else
    {
+      wiz_spi_lock();
       IINCHIP_WRITE( Sn_DIPR0(s), addr[0]);
       IINCHIP_WRITE( Sn_DIPR1(s), addr[1]);
       IINCHIP_WRITE( Sn_DIPR2(s), addr[2]);
@@ -292,14 +307,91 @@ uint16 sendto(SOCKET s, const uint8 * buf, uint16 len, uint8 * addr, uint16 port
       {
             /* clear interrupt */
       IINCHIP_WRITE( Sn_IR(s) , (Sn_IR_SEND_OK | Sn_IR_TIMEOUT)); /* clear SEND_OK & TIMEOUT */
+      wiz_spi_unlock();
       return 0;
       }
      }
       IINCHIP_WRITE( Sn_IR(s) , Sn_IR_SEND_OK);
+      wiz_spi_unlock();
    }
    return ret;
 }
 
+/**
+*@brief   This function opens a streaming UDP send. The destination is set and one SPI burst
+					is opened at the socket's Tx write pointer; the caller then pushes exactly len bytes
+					with WIZ_WRITE_STREAM_BYTE() and closes the burst with sendto_stream_end().
+					The W5500 lock (wiz_spi_lock()) is taken here and held until sendto_stream_end(),
+					so other tasks wait instead of breaking into the burst.
+*@param		s: socket number.
+*@param		len: data length that will be streamed.
+*@param		addr: IP address to send.
+*@param		port: IP port to send.
+*@return  len if the burst is open (lock held), else 0 (bad destination or not enough Tx free size, lock not held).
+*/
+uint16 sendto_stream_begin(SOCKET s, uint16 len, uint8 * addr, uint16 port)
+{
+   uint16 ptr = 0;
+
+   if( ((addr[0] == 0x00) && (addr[1] == 0x00) && (addr[2] == 0x00) && (addr[3] == 0x00)) || (port == 0x00) || (len == 0) )
+      return 0;
+   wiz_spi_lock();
+   if( len > getIINCHIP_TxMAX(s) || getSn_TX_FSR(s) < len )
+   {
+      wiz_spi_unlock();
+      return 0;
+   }
+
+   IINCHIP_WRITE( Sn_DIPR0(s), addr[0]);
+   IINCHIP_WRITE( Sn_DIPR1(s), addr[1]);
+   IINCHIP_WRITE( Sn_DIPR2(s), addr[2]);
+   IINCHIP_WRITE( Sn_DIPR3(s), addr[3]);
+   IINCHIP_WRITE( Sn_DPORT0(s),(uint8)((port & 0xff00) >> 8));
+   IINCHIP_WRITE( Sn_DPORT1(s),(uint8)(port & 0x00ff));
+
+   ptr = IINCHIP_READ( Sn_TX_WR0(s) );
+   ptr = ((ptr & 0x00ff) << 8) + IINCHIP_READ(Sn_TX_WR1(s));
+   wiz_write_stream_begin((uint32)(ptr<<8) + (s<<5) + 0x10);
+   return len;
+}
+
+/**
+*@brief   This function closes the burst opened by sendto_stream_begin(), moves the Tx write
+					pointer by len, sends the datagram and releases the W5500 lock taken by sendto_stream_begin().
+*@param		s: socket number.
+*@param		len: data length that was streamed, must match sendto_stream_begin().
+*@return  len for success else 0.
+*/
+uint16 sendto_stream_end(SOCKET s, uint16 len)
+{
+   uint16 ptr = 0;
+
+   wiz_write_stream_end();
+
+   ptr = IINCHIP_READ( Sn_TX_WR0(s) );
+   ptr = ((ptr & 0x00ff) << 8) + IINCHIP_READ(Sn_TX_WR1(s));
+   ptr += len;
+   IINCHIP_WRITE( Sn_TX_WR0(s) ,(uint8)((ptr & 0xff00) >> 8));
+   IINCHIP_WRITE( Sn_TX_WR1(s),(uint8)(ptr & 0x00ff));
+
+   IINCHIP_WRITE( Sn_CR(s) ,Sn_CR_SEND);
+   /* wait to process the command... */
+   while( IINCHIP_READ( Sn_CR(s) ) )
+   ;
+   while( (IINCHIP_READ( Sn_IR(s) ) & Sn_IR_SEND_OK) != Sn_IR_SEND_OK )
+   {
+      if (IINCHIP_READ( Sn_IR(s) ) & Sn_IR_TIMEOUT)
+      {
+         IINCHIP_WRITE( Sn_IR(s) , (Sn_IR_SEND_OK | Sn_IR_TIMEOUT)); /* clear SEND_OK & TIMEOUT */
+         wiz_spi_unlock();
+         return 0;
+      }
+   }
+   IINCHIP_WRITE( Sn_IR(s) , Sn_IR_SEND_OK);
+   wiz_spi_unlock();
+   return len;
+}
+
 /**
 *@brief   This function is an application I/F function which is used to receive the data in other then
 					TCP mode. This function is used to receive UDP, IP_RAW and MAC_RAW mode, and handle the header as well.
@@ -318,6 +410,7 @@ uint16 recvfrom(SOCKET s, uint8 * buf, uint16 len, uint8 * addr, uint16 *port)
    uint32 addrbsb =0;
    if ( len > 0 )
    {
+      wiz_spi_lock();
       ptr     = IINCHIP_READ(Sn_RX_RD0(s) );
       ptr     = ((ptr & 0x00ff) << 8) + IINCHIP_READ(Sn_RX_RD1(s));
       addrbsb = (uint32)(ptr<<8) +  (s<<5) + 0x18;
@@ -338,7 +431,7 @@ uint16 recvfrom(SOCKET s, uint8 * buf, uint16 len, uint8 * addr, uint16 *port)
         data_len = (data_len << 8) + head[7];
 
         addrbsb = (uint32)(ptr<<8) +  (s<<5) + 0x18;
-        wiz_read_buf(addrbsb, buf, data_len);                
+        wiz_read_buf(addrbsb, buf, (data_len > len) ? len : data_len); /* bytes beyond len are dropped */
         ptr += data_len;
 
         IINCHIP_WRITE( Sn_RX_RD0(s), (uint8)((ptr & 0xff00) >> 8));
@@ -359,7 +452,7 @@ uint16 recvfrom(SOCKET s, uint8 * buf, uint16 len, uint8 * addr, uint16 *port)
 
         addrbsb  = (uint32)(ptr<<8) +  (s<<5) + 0x18;
 	   
-//		printf(" data%d \r\n",data_len);
+//		printf(" data：%d \r\n",data_len);
         wiz_read_buf(addrbsb, buf, data_len);
 		 	        
         ptr += data_len;
@@ -397,6 +490,7 @@ uint16 recvfrom(SOCKET s, uint8 * buf, uint16 len, uint8 * addr, uint16 *port)
       /* wait to process the command... */
       while( IINCHIP_READ( Sn_CR(s)) ) ;
       /* ------- */
+      wiz_spi_unlock();
    }
    return data_len;
 }
@@ -5,7 +5,7 @@
 #include "stm32f10x.h"
 #include "Types.h"
 
-/*Socket ˿ѡ񣬿ɰԼϰ߶*/
+/*Socket 端口选择，可按自己的习惯定义*/
 #define SOCK_TCPS             0
 #define SOCK_HUMTEM			  0
 #define SOCK_PING			  0
@@ -17,7 +17,7 @@
 #define SOCK_UDPS2            5
 #define SOCK_SMTP             6
 #define SOCK_NTP              7
-//#define NETBIOS_SOCK    6 //netbios.cѶ
+//#define NETBIOS_SOCK    6 //在netbios.c已定义
 
 extern uint8 socket(SOCKET s, uint8 protocol, uint16 port, uint8 flag); // Opens a socket(TCP or UDP or IP_RAW mode)
 extern void close(SOCKET s); // Close socket
@@ -28,6 +28,8 @@ extern uint16 send(SOCKET s, const uint8 * buf, uint16 len); // Send data (TCP)
 extern uint16 recv(SOCKET s, uint8 * buf, uint16 len);	// Receive data (TCP)
 extern uint16 sendto(SOCKET s, const uint8 * buf, uint16 len, uint8 * addr, uint16 port); // Send data (UDP/IP RAW)
 extern uint16 recvfrom(SOCKET s, uint8 * buf, uint16 len, uint8 * addr, uint16  *port); // Receive data (UDP/IP RAW)
+extern uint16 sendto_stream_begin(SOCKET s, uint16 len, uint8 * addr, uint16 port); // Open a streaming send (UDP)
+extern uint16 sendto_stream_end(SOCKET s, uint16 len); // Close the streaming send and send it (UDP)
 
 #ifdef __MACRAW__
 void macraw_open(void);
@@ -4,7 +4,7 @@
 * @author  			WIZnet Software Team 
 * @version 			V1.0
 * @date    			2015-02-14
-* @brief 				ʵú ʱ ݸʽת 
+* @brief 				公共实用函数 延时函数 数据格式转换 
 ******************************************************************************
 */
 #include "w5500.h"
@@ -16,25 +16,25 @@
 #include <stdarg.h>
 
 
-static u8  fac_us=0;																										/*usʱ*/
-static u16 fac_ms=0;																										/*msʱ*/
+static u8  fac_us=0;																										/*us延时倍乘数*/
+static u16 fac_ms=0;																										/*ms延时倍乘数*/
 
 /**
-*@brief		ʼӳٺ
-*@param		SYSCLK:ϵͳʱ
-*@return	
+*@brief		初始化延迟函数
+*@param		SYSCLK:系统时钟
+*@return	无
 */
 void systick_init (u8 sysclk)
 {
-	SysTick->CTRL&=0xfffffffb;																						/*bit2,ѡⲿʱ  HCLK/8*/
+	SysTick->CTRL&=0xfffffffb;																						/*bit2清空,选择外部时钟  HCLK/8*/
 	fac_us=sysclk/8;		    
 	fac_ms=(u16)fac_us*1000;
 }								    
 
 /**
-*@brief	  ʱ
-*@param		time_s:Ҫʱʱ
-*@return	
+*@brief	  秒延时函数
+*@param		time_s:要延时秒时间数
+*@return	无
 */
 void delay_s( uint32 time_s )
 {
@@ -43,49 +43,49 @@ void delay_s( uint32 time_s )
 }
 
 /**
-*@brief	  ʱ
-*@param		time_ms:Ҫʱʱ
-*@return	
+*@brief	  毫秒延时函数
+*@param		time_ms:要延时毫秒时间数
+*@return	无
 */
 void delay_ms( uint32 time_ms )
 {	 		  	  
 	u32 temp;		   
-	SysTick->LOAD=(u32)time_ms*fac_ms;																		/*ʱ(SysTick->LOADΪ24bit)*/
-	SysTick->VAL =0x00;           																				/*ռ*/
-	SysTick->CTRL=0x01 ;         																					/*ʼ*/ 
+	SysTick->LOAD=(u32)time_ms*fac_ms;																		/*时间加载(SysTick->LOAD为24bit)*/
+	SysTick->VAL =0x00;           																				/*清空计数器*/
+	SysTick->CTRL=0x01 ;         																					/*开始倒数*/ 
 	do
 	{
 		temp=SysTick->CTRL;
 	}
-	while(temp&0x01&&!(temp&(1<<16)));																		/*ȴʱ䵽*/
-	SysTick->CTRL=0x00;       																						/*رռ*/
-	SysTick->VAL =0X00;      																							/*ռ*/	  	    
+	while(temp&0x01&&!(temp&(1<<16)));																		/*等待时间到达*/
+	SysTick->CTRL=0x00;       																						/*关闭计数器*/
+	SysTick->VAL =0X00;      																							/*清空计数器*/	  	    
 }   
 
 /**
-*@brief	  ΢ʱ
-*@param		time_ms:Ҫʱ΢ʱ
-*@return	
+*@brief	  微秒延时函数
+*@param		time_ms:要延时微秒时间数
+*@return	无
 */
 void delay_us( uint32 time_us )
 {		
 	u32 temp;	    	 
-	SysTick->LOAD=time_us*fac_us; 																				/*ʱ*/	  		 
-	SysTick->VAL=0x00;        																						/*ռ*/
-	SysTick->CTRL=0x01 ;      																						/*ʼ */	
+	SysTick->LOAD=time_us*fac_us; 																				/*时间加载*/	  		 
+	SysTick->VAL=0x00;        																						/*清空计数器*/
+	SysTick->CTRL=0x01 ;      																						/*开始倒数 */	
 	do
 	{
 		temp=SysTick->CTRL;
 	}
-	while(temp&0x01&&!(temp&(1<<16)));																		/*ȴʱ䵽*/
-	SysTick->CTRL=0x00;       																						/*رռ*/
-	SysTick->VAL =0X00;       																						/*ռ*/
+	while(temp&0x01&&!(temp&(1<<16)));																		/*等待时间到达*/
+	SysTick->CTRL=0x00;       																						/*关闭计数器*/
+	SysTick->VAL =0X00;       																						/*清空计数器*/
 }
 
 /**
-*@brief	 	ַתתΪ8λͺ
-*@param		str:Ҫתַ base:
-*@return	num:ת
+*@brief	 	字符转转化为8位整型函数
+*@param		str:要转化字符串， base:
+*@return	num:返回转化后的整型数
 */
 uint16 atoi16(char* str,uint16 base	)
 {
@@ -96,9 +96,9 @@ uint16 atoi16(char* str,uint16 base	)
 }
 
 /**
-*@brief	 	ַתתΪ32λͺ
-*@param		str:Ҫתַ base:
-*@return	num:ת
+*@brief	 	字符转转化为32位整型函数
+*@param		str:要转化字符串， base:
+*@return	num:返回转化后的整型数
 */
 uint32 atoi32(char* str,uint16 base	)
 {
@@ -109,9 +109,9 @@ uint32 atoi32(char* str,uint16 base	)
 }
 
 /**
-*@brief	 	תΪַ
-*@param		n:Ҫת str[5]:תַ  len
-*@return	
+*@brief	 	整型数转化为字符串函数
+*@param		n:要转化整数， str[5]:存放转化后的字符串  len：整型数长度
+*@return	无
 */
 void itoa(uint16 n,uint8 str[5], uint8 len)
 {
@@ -129,9 +129,9 @@ void itoa(uint16 n,uint8 str[5], uint8 len)
 
 
 /**
-*@brief	 	ַתΪʮƻʮ
-*@param		str:Ҫתַ len
-*@return	ɹ - 1, ʧ - 0
+*@brief	 	把字符串转化为十进制或十六进制数函数
+*@param		str:要转化字符串， len：整型数长度
+*@return	成功 - 1, 失败 - 0
 */
 int validatoi(char* str, int base,int* ret)
 {
@@ -150,9 +150,9 @@ int validatoi(char* str, int base,int* ret)
 }
 
 /**
-*@brief	 	µַȥ滻ַַ
-*@param		str:滻ַoldchar:ַnewcharµַ	
-*@return	
+*@brief	 	用新的字符去替换字符串中特殊的字符
+*@param		str:替换后字符串，oldchar:特殊的字符，newchar：新的字符	
+*@return	无
 */
 void replacetochar(char * str,	char oldchar,char newchar	)
 {
@@ -162,9 +162,9 @@ void replacetochar(char * str,	char oldchar,char newchar	)
 }
 
 /**
-*@brief	 	ʮתΪַ
-*@param		c:Ҫתʮ
-*@return	һַ
+*@brief	 	把十进制数转化为字符型
+*@param		c:要转化十进制数据
+*@return	返回一个字符型数据
 */
 char c2d(uint8 c	)
 {
@@ -179,9 +179,9 @@ char c2d(uint8 c	)
 }
 
 /**
-*@brief	 	16λַ8λ8λת
-*@param		i:Ҫת
-*@return	ת
+*@brief	 	16位字符高8位低8位转换
+*@param		i:要转化的数据
+*@return	转换后的数据
 */
 uint16 swaps(uint16 i)
 {
@@ -191,9 +191,9 @@ uint16 swaps(uint16 i)
   return ret;	
 }
 /**
-*@brief	 	32λַߵλ任
-*@param		i:Ҫת
-*@return	ת
+*@brief	 	32位字符高低位变换
+*@param		i:要转化的数据
+*@return	转换后的数据
 */
 uint32 swapl(uint32 l)
 {
@@ -206,9 +206,9 @@ uint32 swapl(uint32 l)
 }
 
 /**
-*@brief	 	ַ
-*@param		srcĿַ s1 s2ַ
-*@return	
+*@brief	 	字符串处理
+*@param		src目标字符串 s1 s2操作字符串
+*@return	无
 */
 void mid(int8* src, int8* s1, int8* s2, int8* sub)
 {
@@ -225,9 +225,9 @@ void mid(int8* src, int8* s1, int8* s2, int8* sub)
 }
 
 /**
-*@brief	 	ipַת
-*@param		adrַ ipip
-*@return	
+*@brief	 	ip网络地址转换
+*@param		adr：地址 ip：ip
+*@return	无
 */
 void inet_addr_(unsigned char* addr,unsigned char *ip)
 {
@@ -250,9 +250,9 @@ void inet_addr_(unsigned char* addr,unsigned char *ip)
 }	
  
 /**
-*@brief	 	32ַתΪʮƸʽ
-*@param		addr:  Ҫתַ
-*@return	ʮƸʽַ
+*@brief	 	将32地址转化为十进制格式
+*@param		addr:  要转化地址
+*@return	返回十进制格式地址
 */
 char* inet_ntoa(
 	unsigned long addr	
@@ -265,9 +265,9 @@ char* inet_ntoa(
 }
 
 /**
-*@brief	 	16ַתΪʮƸʽ
-*@param		addr:  Ҫתַ
-*@return	ʮƸʽַ
+*@brief	 	将16地址转化为十进制格式
+*@param		addr:  要转化地址
+*@return	返回十进制格式地址
 */
 char* inet_ntoa_pad(unsigned long addr)
 {
@@ -278,9 +278,9 @@ char* inet_ntoa_pad(unsigned long addr)
 }
  
 /**
-*@brief	 	֤IPַ
+*@brief	 	验证IP地址
 *@param		ip addr
-*@return	ɹ - 1, ʧ - 0
+*@return	成功 - 1, 失败 - 0
 */
 char verify_ip_address(char* src, uint8 * ip)
 {
@@ -310,9 +310,9 @@ char verify_ip_address(char* src, uint8 * ip)
 }
 
 /**
-*@brief		һ ģʽunsigned shortתģʽTCP/IP ֽڸʽ.
-*@param		Ҫת
-*@return 	ģʽ
+*@brief		将一个 主机模式的unsigned short型数据转换到大端模式的TCP/IP 网络字节格式的数据.
+*@param		要转换的数据
+*@return 	大端模式的数据
 */ 
 uint16 htons( 
 	uint16 hostshort	/**< A 16-bit number in host byte order.  */
@@ -326,9 +326,9 @@ uint16 htons(
 }
 
 /**
-*@brief		һ ģʽunsigned longתģʽTCP/IP ֽڸʽ.
-*@param		Ҫת
-*@return 	ģʽ
+*@brief		将一个 主机模式的unsigned long型数据转换到大端模式的TCP/IP 网络字节格式的数据.
+*@param		要转换的数据
+*@return 	大端模式的数据
 */ 
 unsigned long htonl(
 	unsigned long hostlong		/**< hostshort  - A 32-bit number in host byte order.  */
@@ -344,9 +344,9 @@ unsigned long htonl(
 
 
 /**
-*@brief		һģʽTCP/IP ֽڸʽתģʽunsigned short
-*@param		Ҫת
-*@return 	unsigned shortģʽ
+*@brief		将一个大端模式的TCP/IP 网络字节格式的数据转换到主机模式的unsigned short型数据
+*@param		要转换的数据
+*@return 	unsigned short模式的数据
 */ 
 unsigned long ntohs(
 	unsigned short netshort	/**< netshort - network odering 16bit value */
@@ -361,9 +361,9 @@ unsigned long ntohs(
 
 
 /**
-*@brief		һģʽTCP/IP ֽڸʽתģʽunsigned long
-*@param		Ҫת
-*@return 	unsigned longģʽ
+*@brief		将一个大端模式的TCP/IP 网络字节格式的数据转换到主机模式的unsigned long型数据
+*@param		要转换的数据
+*@return 	unsigned long模式的数据
 */ 
 unsigned long ntohl(unsigned long netlong)
 {
@@ -377,9 +377,9 @@ unsigned long ntohl(unsigned long netlong)
 
 
 /**
-*@brief		ַУֵ
-*@param		Ҫת
-*@return 	Уֵ
+*@brief		计算字符串校验值
+*@param		要转换的数据
+*@return 	校验值
 */ 
 unsigned short checksum(
 	unsigned char * src, 	/**< pointer to stream  */
@@ -414,9 +414,9 @@ unsigned short checksum(
 }
 
 /**
-*@brief		ַǷ
-*@param		Ҫת
-*@return 	ɹΪ1 ʧΪ0
+*@brief		检查地址是否批评
+*@param		要转换的数据
+*@return 	成功为1 失败为0
 */ 
 u_char check_dest_in_local(u_long destip)
 {
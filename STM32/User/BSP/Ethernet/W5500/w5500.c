@@ -4,7 +4,7 @@
 * @author  		WIZnet Software Team 
 * @version 		V1.0
 * @date    		2015-02-14
-* @brief   		дW5500Ĵײ㺯
+* @brief   		读写W5500寄存器底层函数
 ******************************************************************************
 */
 #include <stdio.h>
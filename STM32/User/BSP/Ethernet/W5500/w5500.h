@@ -4,7 +4,7 @@
 * @author  		WIZnet Software Team 
 * @version 		V1.0
 * @date    		2015-02-14
-* @brief  		W5500Ĵַ/궨
+* @brief  		W5500寄存器地址定义/宏定义等
 * @attention
 ******************************************************************************
 **/
@@ -4,7 +4,7 @@
 * @author  		WIZnet Software Team 
 * @version 		V1.0
 * @date    		2015-02-14
-* @brief  		MCUֲW5500Ҫ޸ĵļW5500MACIPַ
+* @brief  		配置MCU，移植W5500程序需要修改的文件，配置W5500的MAC和IP地址
 **************************************************************************************************
 */
 #include <stdio.h> 
@@ -18,78 +18,90 @@
 #include "bsp_TiMbase.h"
 #include "bsp_i2c_ee.h"
 #include "bsp_i2c_gpio.h"
+#include  <lib_def.h>
+#include  <app_cfg.h>
+#include  <os.h>
 
-CONFIG_MSG  ConfigMsg;																	/*ýṹ*/
-EEPROM_MSG_STR EEPROM_MSG;															/*EEPROM洢Ϣṹ*/
+CONFIG_MSG  ConfigMsg;																	/*配置结构体*/
+EEPROM_MSG_STR EEPROM_MSG;															/*EEPROM存储信息结构体*/
 
-/*MACַ,W5500ͬһֳʹòͬMACַ*/
+/*定义MAC地址,如果多块W5500网络适配板在同一现场工作，请使用不同的MAC地址*/
 uint8 mac[6]={0x00,0x08,0xdc,0x11,0x11,0x11};
 
-/*ĬIPϢ*/
-uint8 local_ip[4]  ={192,168,1,88};											/*W5500ĬIPַ*/
-uint8 subnet[4]    ={255,255,255,0};										/*W5500Ĭ*/
-uint8 gateway[4]   ={192,168,1,1};											/*W5500Ĭ*/
-uint8 dns_server[4]={114,114,114,114};									/*W5500ĬDNS*/
+/*定义默认IP信息*/
+uint8 local_ip[4]  ={192,168,1,88};											/*定义W5500默认IP地址*/
+uint8 subnet[4]    ={255,255,255,0};										/*定义W5500默认子网掩码*/
+uint8 gateway[4]   ={192,168,1,1};											/*定义W5500默认网关*/
+uint8 dns_server[4]={114,114,114,114};									/*定义W5500默认DNS*/
 
-uint16 local_port=8088;	                       					/*屾ض˿UDP1*/
+uint16 local_port=8088;	                       					/*定义本地端口UDP1*/
 
 
-/*ԶIPϢ*/
-uint8  remote_ip[4]={192,168,1,105};											/*ԶIPַ*/
-uint16 remote_port=5000;																/*Զ˶˿ں*/
-uint16 remote_port2=6000;																/*Զ˶˿ں*/
-/*IP÷ѡѡ*/
+/*定义远端IP信息*/
+uint8  remote_ip[4]={192,168,1,105};											/*远端IP地址*/
+uint16 remote_port=5000;																/*远端端口号*/
+uint16 remote_port2=6000;																/*远端端口号*/
+/*IP配置方法选择，请自行选择*/
 uint8	ip_from=IP_FROM_DEFINE;				
 
-uint8   dhcp_ok   = 0;													   			/*dhcpɹȡIP*/
-uint32	ms        = 0;															  	/**/
-uint32	dhcp_time = 0;															  	/*DHCPм*/
-vu8	    ntptimer  = 0;															  	/*NPT*/
+uint8   dhcp_ok   = 0;													   			/*dhcp成功获取IP*/
+uint32	ms        = 0;															  	/*毫秒计数*/
+uint32	dhcp_time = 0;															  	/*DHCP运行计数*/
+vu8	    ntptimer  = 0;															  	/*NPT秒计数*/
+
+WIZ_SPI_STAT wiz_spi_stat;																/*SPI传输统计*/
+static OS_MUTEX wiz_spi_mutex;														/*一次访问（片选拉低到拉高）期间独占SPI*/
+static uint8    wiz_spi_os = 0;														/*1：互斥量、信号量已创建，可以挂起*/
+#if (APP_CFG_WIZ_SPI_DMA_EN == DEF_ENABLED)
+static OS_SEM   wiz_dma_sem;															/*一块DMA传完信号量*/
+static const uint8 wiz_dma_zero = 0;											/*读时DMA发送的空字节*/
+static uint8    wiz_dma_sink;															/*写时DMA接收的丢弃字节*/
+#endif
 
 /**
-*@brief		W5500IPַ
-*@param		
-*@return	
+*@brief		配置W5500的IP地址
+*@param		无
+*@return	无
 */
 void set_w5500_ip(void)
 {	
 		
-   /*ƶϢýṹ*/
+   /*复制定义的配置信息到配置结构体*/
 	memcpy(ConfigMsg.mac, mac, 6);
 	memcpy(ConfigMsg.lip,local_ip,4);
 	memcpy(ConfigMsg.sub,subnet,4);
 	memcpy(ConfigMsg.gw,gateway,4);
 	memcpy(ConfigMsg.dns,dns_server,4);
 	if(ip_from==IP_FROM_DEFINE)	
-		printf(" ʹöIPϢW5500\r\n");
+		printf(" 使用定义的IP信息配置W5500\r\n");
 	
-	/*ʹEEPROM洢IP*/	
+	/*使用EEPROM存储的IP参数*/	
 	if(ip_from==IP_FROM_EEPROM)
 	{
     
-		/*EEPROMжȡIPϢ*/
+		/*从EEPROM中读取IP配置信息*/
 		read_config_from_eeprom();		
 		
-		/*ȡEEPROMMACϢ,ãʹ*/		
+		/*如果读取EEPROM中MAC信息,如果已配置，则可使用*/		
 		if( *(EEPROM_MSG.mac)==0x00&& *(EEPROM_MSG.mac+1)==0x08&&*(EEPROM_MSG.mac+2)==0xdc)		
 		{
 			printf(" IP from EEPROM\r\n");
-			/*EEPROMϢõĽṹ*/
+			/*复制EEPROM配置信息到配置的结构体变量*/
 			memcpy(ConfigMsg.lip,EEPROM_MSG.lip, 4);				
 			memcpy(ConfigMsg.sub,EEPROM_MSG.sub, 4);
 			memcpy(ConfigMsg.gw, EEPROM_MSG.gw, 4);
 		}
 		else
 		{
-			printf(" EEPROMδ,ʹöIPϢW5500,дEEPROM\r\n");
-			write_config_to_eeprom();	/*ʹĬϵIPϢʼEEPROM*/
+			printf(" EEPROM未配置,使用定义的IP信息配置W5500,并写入EEPROM\r\n");
+			write_config_to_eeprom();	/*使用默认的IP信息，并初始化EEPROM中数据*/
 		}			
 	}
 
-	/*ʹDHCPȡIPDHCPӺ*/		
+	/*使用DHCP获取IP参数，需调用DHCP子函数*/		
 	if(ip_from==IP_FROM_DHCP)								
 	{
-		/*DHCPȡϢýṹ*/
+		/*复制DHCP获取的配置信息到配置结构体*/
 		if(dhcp_ok==1)
 		{
 			printf(" IP from DHCP\r\n");		 
@@ -100,32 +112,32 @@ void set_w5500_ip(void)
 		}
 		else
 		{
-			printf(" DHCPӳδ,߲ɹ\r\n");
-			printf(" ʹöIPϢW5500\r\n");
+			printf(" DHCP子程序未运行,或者不成功\r\n");
+			printf(" 使用定义的IP信息配置W5500\r\n");
 		}
 	}
 		
-	/*ϢҪѡ*/	
+	/*以下配置信息，根据需要选用*/	
 	ConfigMsg.sw_ver[0]=FW_VER_HIGH;
 	ConfigMsg.sw_ver[1]=FW_VER_LOW;	
 
-	/*IPϢдW5500ӦĴ*/	
+	/*将IP配置信息写入W5500相应寄存器*/	
 	setSUBR(ConfigMsg.sub);
 	setGAR(ConfigMsg.gw);
 	setSIPR(ConfigMsg.lip);
 	
 	getSIPR (local_ip);			
-	printf(" W5500 IPַ   : %d.%d.%d.%d\r\n", local_ip[0],local_ip[1],local_ip[2],local_ip[3]);
+	printf(" W5500 IP地址   : %d.%d.%d.%d\r\n", local_ip[0],local_ip[1],local_ip[2],local_ip[3]);
 	getSUBR(subnet);
-	printf(" W5500  : %d.%d.%d.%d\r\n", subnet[0],subnet[1],subnet[2],subnet[3]);
+	printf(" W5500 子网掩码 : %d.%d.%d.%d\r\n", subnet[0],subnet[1],subnet[2],subnet[3]);
 	getGAR(gateway);
-	printf(" W5500      : %d.%d.%d.%d\r\n", gateway[0],gateway[1],gateway[2],gateway[3]);
+	printf(" W5500 网关     : %d.%d.%d.%d\r\n", gateway[0],gateway[1],gateway[2],gateway[3]);
 }
 
 /**
-*@brief		W5500MACַ
-*@param		
-*@return	
+*@brief		配置W5500的MAC地址
+*@param		无
+*@return	无
 */
 void set_w5500_mac(void)
 {
@@ -135,14 +147,18 @@ void set_w5500_mac(void)
 }
 
 /**
-*@brief		W5500GPIOӿ
-*@param		
-*@return	
+*@brief		配置W5500的GPIO接口
+*@param		无
+*@return	无
 */
 void gpio_for_w5500_config(void)
 {
   SPI_InitTypeDef  SPI_InitStructure;
   GPIO_InitTypeDef GPIO_InitStructure;
+#if (APP_CFG_WIZ_SPI_DMA_EN == DEF_ENABLED)
+  DMA_InitTypeDef  DMA_InitStructure;
+  NVIC_InitTypeDef NVIC_InitStructure;
+#endif
 	
   RCC_APB2PeriphClockCmd(WIZ_SPIx_RESET_CLK|WIZ_SPIx_INT_CLK, ENABLE);
 	
@@ -177,35 +193,65 @@ void gpio_for_w5500_config(void)
 
 
   /* SPI1 configuration */
-  SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;  //˫ȫ˫
-  SPI_InitStructure.SPI_Mode = SPI_Mode_Master;  //ģʽsck
+  SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;  //双线全双工
+  SPI_InitStructure.SPI_Mode = SPI_Mode_Master;  //主机模式，决定sck由哪里产生
   SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
-  SPI_InitStructure.SPI_CPOL = SPI_CPOL_High;  //Ϊģʽ3
+  SPI_InitStructure.SPI_CPOL = SPI_CPOL_High;  //配置为模式3
   SPI_InitStructure.SPI_CPHA = SPI_CPHA_2Edge;
-  SPI_InitStructure.SPI_NSS = SPI_NSS_Soft; //ƬѡģʽΪֶ
-  SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_4; //ʱ4Ƶ
-  SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;    //λ
+  SPI_InitStructure.SPI_NSS = SPI_NSS_Soft; //片选模式为手动设置
+  SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_4; //时钟4分频
+  SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;    //高位数据在先
   SPI_InitStructure.SPI_CRCPolynomial = 7;
   SPI_Init(WIZ_SPIx, &SPI_InitStructure);
   SPI_Cmd(WIZ_SPIx, ENABLE);
+
+#if (APP_CFG_WIZ_SPI_DMA_EN == DEF_ENABLED)
+  /*SPI1的DMA通道：外设地址固定为DR，内存地址和是否自增每次传输时设置*/
+  RCC_AHBPeriphClockCmd(WIZ_SPIx_DMA_CLK, ENABLE);
+  DMA_DeInit(WIZ_SPIx_DMA_RX_CHANNEL);
+  DMA_DeInit(WIZ_SPIx_DMA_TX_CHANNEL);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&WIZ_SPIx->DR;
+  DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)&wiz_dma_sink;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Disable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;    //接收来不及取会溢出，比发送优先
+  DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+  DMA_Init(WIZ_SPIx_DMA_RX_CHANNEL, &DMA_InitStructure);
+  DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)&wiz_dma_zero;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  DMA_Init(WIZ_SPIx_DMA_TX_CHANNEL, &DMA_InitStructure);
+  DMA_ITConfig(WIZ_SPIx_DMA_RX_CHANNEL, DMA_IT_TC, ENABLE);
+
+  NVIC_InitStructure.NVIC_IRQChannel = WIZ_SPIx_DMA_IRQ;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+  NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&NVIC_InitStructure);
+#endif
 	
-  /*RESET*/
-  GPIO_InitStructure.GPIO_Pin = WIZ_RESET;					       /*ѡҪƵGPIO*/		 
-  GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;		     /*Ϊ50MHz */		
-  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;		     /*ģʽΪͨ*/	
-  GPIO_Init(WIZ_SPIx_RESET_PORT, &GPIO_InitStructure);		 /*ÿ⺯ʼGPIO*/
+  /*定义RESET引脚*/
+  GPIO_InitStructure.GPIO_Pin = WIZ_RESET;					       /*选择要控制的GPIO引脚*/		 
+  GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;		     /*设置引脚速率为50MHz */		
+  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;		     /*设置引脚模式为通用推挽输出*/	
+  GPIO_Init(WIZ_SPIx_RESET_PORT, &GPIO_InitStructure);		 /*调用库函数，初始化GPIO*/
   GPIO_SetBits(WIZ_SPIx_RESET_PORT, WIZ_RESET);		
-  /*INT*/	
-  GPIO_InitStructure.GPIO_Pin = WIZ_INT;						       /*ѡҪƵGPIO*/		 
-  GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;		     /*Ϊ50MHz*/		
-  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;				     /*ģʽΪͨģ*/		
-  GPIO_Init(WIZ_SPIx_INT_PORT, &GPIO_InitStructure);			 /*ÿ⺯ʼGPIO*/
+  /*定义INT引脚*/	
+  GPIO_InitStructure.GPIO_Pin = WIZ_INT;						       /*选择要控制的GPIO引脚*/		 
+  GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;		     /*设置引脚速率为50MHz*/		
+  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;				     /*设置引脚模式为通用推挽模拟上拉输入*/		
+  GPIO_Init(WIZ_SPIx_INT_PORT, &GPIO_InitStructure);			 /*调用库函数，初始化GPIO*/
 }
 
 /**
-*@brief		W5500Ƭѡźú
-*@param		val: Ϊ0ʾƬѡ˿ΪͣΪ1ʾƬѡ˿Ϊ
-*@return	
+*@brief		W5500片选信号设置函数
+*@param		val: 为“0”表示片选端口为低，为“1”表示片选端口为高
+*@return	无
 */
 void wiz_cs(uint8_t val)
 {
@@ -220,9 +266,9 @@ void wiz_cs(uint8_t val)
 }
 
 /**
-*@brief		W5500Ƭѡ˿SCSnΪ
-*@param		
-*@return	
+*@brief		设置W5500的片选端口SCSn为低
+*@param		无
+*@return	无
 */
 void iinchip_csoff(void)
 {
@@ -230,9 +276,9 @@ void iinchip_csoff(void)
 }
 
 /**
-*@brief		W5500Ƭѡ˿SCSnΪ
-*@param		
-*@return	
+*@brief		设置W5500的片选端口SCSn为高
+*@param		无
+*@return	无
 */
 void iinchip_cson(void)
 {	
@@ -240,13 +286,13 @@ void iinchip_cson(void)
 }
 
 /**
-*@brief		W5500λú
-*@param		
-*@return	
+*@brief		W5500复位设置函数
+*@param		无
+*@return	无
 */
 void reset_w5500(void)
 {
-	GPIO_ResetBits(WIZ_SPIx_RESET_PORT, WIZ_RESET); //λ
+	GPIO_ResetBits(WIZ_SPIx_RESET_PORT, WIZ_RESET); //复位引脚
 	delay_us(2); 	
 	GPIO_SetBits(WIZ_SPIx_RESET_PORT, WIZ_RESET);
 	delay_ms(1600);
@@ -268,9 +314,9 @@ uint8_t SPI_SendByte(uint8_t byte)
 }
 
 /**
-*@brief		STM32 SPI1д8λ
-*@param		datд8λ
-*@return	
+*@brief		STM32 SPI1读写8位数据
+*@param		dat：写入的8位数据
+*@return	无
 */
 uint8  IINCHIP_SpiSendData(uint8 dat)
 {
@@ -278,92 +324,268 @@ uint8  IINCHIP_SpiSendData(uint8 dat)
 }
 
 /**
-*@brief		дһ8λݵW5500
-*@param		addrbsb: дݵĵַ
-*@param   dataд8λ
-*@return	
+*@brief		创建SPI互斥量和DMA信号量，之后的访问才互斥、才用DMA
+*@param		无
+*@return	无
+*@note		在任务中、W5500初始化完后调用；之前的访问只有一个任务，逐字节轮询
+*/
+void wiz_spi_os_init(void)
+{
+	OS_ERR err;
+
+	OSMutexCreate(&wiz_spi_mutex, "wiz spi mutex", &err);
+#if (APP_CFG_WIZ_SPI_DMA_EN == DEF_ENABLED)
+	OSSemCreate(&wiz_dma_sem, "wiz dma sem", 0, &err);
+#endif
+	wiz_spi_os = 1;
+}
+
+/**
+*@brief		独占W5500的SPI，已持有时只加嵌套数
+*@param		无
+*@return	无
+*@note		DMA传输时任务挂起、片选仍为低，别的任务这时访问W5500会打乱这次传输，
+*         所以每次访问都要先拿互斥量；中断中、锁调度器时拿不到就不拿（与原来一样不互斥）
+*/
+void wiz_spi_lock(void)
+{
+	OS_ERR err;
+
+	if(wiz_spi_os && OSIntNestingCtr == 0)
+		OSMutexPend(&wiz_spi_mutex, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+}
+
+/**
+*@brief		放开W5500的SPI，与wiz_spi_lock()成对调用
+*@param		无
+*@return	无
+*@note		没拿到时互斥量返回“不是持有者”，不影响别的任务
+*/
+void wiz_spi_unlock(void)
+{
+	OS_ERR err;
+
+	if(wiz_spi_os && OSIntNestingCtr == 0)
+		OSMutexPost(&wiz_spi_mutex, OS_OPT_POST_NONE, &err);
+}
+
+#if (APP_CFG_WIZ_SPI_DMA_EN == DEF_ENABLED)
+/**
+*@brief		停止SPI DMA
+*@param		无
+*@return	无
+*/
+static void wiz_dma_stop(void)
+{
+	SPI_I2S_DMACmd(WIZ_SPIx, SPI_I2S_DMAReq_Tx | SPI_I2S_DMAReq_Rx, DISABLE);
+	DMA_Cmd(WIZ_SPIx_DMA_TX_CHANNEL, DISABLE);
+	DMA_Cmd(WIZ_SPIx_DMA_RX_CHANNEL, DISABLE);
+}
+
+/**
+*@brief		启动一块SPI DMA传输
+*@param		tx：要发送的数据，NULL时发0x00
+*@param		rx：存放接收的数据，NULL时丢弃
+*@param		len：字节数
+*@return	无
+*@note		先开接收通道，发送通道一开SPI就开始移位
+*/
+static void wiz_dma_start(const uint8 *tx, uint8 *rx, uint16 len)
+{
+	wiz_dma_stop();
+	WIZ_SPIx_DMA_RX_CHANNEL->CMAR = (uint32_t)(rx ? rx : &wiz_dma_sink);
+	WIZ_SPIx_DMA_TX_CHANNEL->CMAR = (uint32_t)(tx ? tx : &wiz_dma_zero);
+	WIZ_SPIx_DMA_RX_CHANNEL->CCR = (WIZ_SPIx_DMA_RX_CHANNEL->CCR & ~DMA_MemoryInc_Enable) | (rx ? DMA_MemoryInc_Enable : 0);
+	WIZ_SPIx_DMA_TX_CHANNEL->CCR = (WIZ_SPIx_DMA_TX_CHANNEL->CCR & ~DMA_MemoryInc_Enable) | (tx ? DMA_MemoryInc_Enable : 0);
+	DMA_SetCurrDataCounter(WIZ_SPIx_DMA_RX_CHANNEL, len);
+	DMA_SetCurrDataCounter(WIZ_SPIx_DMA_TX_CHANNEL, len);
+	DMA_ClearITPendingBit(WIZ_SPIx_DMA_IT_GL);
+	DMA_Cmd(WIZ_SPIx_DMA_RX_CHANNEL, ENABLE);
+	DMA_Cmd(WIZ_SPIx_DMA_TX_CHANNEL, ENABLE);
+	SPI_I2S_DMACmd(WIZ_SPIx, SPI_I2S_DMAReq_Tx | SPI_I2S_DMAReq_Rx, ENABLE);
+}
+
+/**
+*@brief		SPI DMA接收通道传完中断处理：最后一个字节已移入，可以拉高片选
+*@param		无
+*@return	无
+*@note		在中断服务函数中调用
+*/
+void wiz_spi_dma_isr(void)
+{
+	OS_ERR err;
+
+	if(DMA_GetITStatus(WIZ_SPIx_DMA_IT_TC) != RESET)
+	{
+		wiz_dma_stop();
+		DMA_ClearITPendingBit(WIZ_SPIx_DMA_IT_GL);
+		OSSemPost(&wiz_dma_sem, OS_OPT_POST_1, &err);
+	}
+}
+#endif
+
+/**
+*@brief		传输数据段（地址段之后），片选已拉低
+*@param		tx：要发送的数据，NULL时发0x00
+*@param		rx：存放接收的数据，NULL时丢弃
+*@param		len：字节数
+*@return	无
+*@note		APP_CFG_WIZ_SPI_DMA_MIN字节以上、在任务中且没锁调度器时用DMA，传完前任务挂起；
+*         其余（寄存器访问、初始化、锁调度器时）逐字节轮询，等TXE、RXNE
+*/
+static void wiz_spi_transfer(const uint8 *tx, uint8 *rx, uint16 len)
+{
+	uint16 idx;
+	uint8 data;
+	CPU_TS ts = OS_TS_GET();
+#if (APP_CFG_WIZ_SPI_DMA_EN == DEF_ENABLED)
+	OS_ERR err;
+
+	if(len >= APP_CFG_WIZ_SPI_DMA_MIN && wiz_spi_os && OSIntNestingCtr == 0 && OSSchedLockNestingCtr == 0)
+	{
+		wiz_dma_start(tx, rx, len);
+		OSSemPend(&wiz_dma_sem, WIZ_SPIx_DMA_TIMEOUT, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+		if(err != OS_ERR_NONE)
+		{
+			wiz_dma_stop();
+			OSSemSet(&wiz_dma_sem, 0, &err);   //停止前刚好传完时中断已释放一次，清掉
+			wiz_spi_stat.dma_timeout++;
+		}
+		wiz_spi_stat.dma_bytes += len;
+		wiz_spi_stat.dma_cycles += OS_TS_GET() - ts;
+		return;
+	}
+#endif
+	for(idx = 0; idx < len; idx++)
+	{
+		data = IINCHIP_SpiSendData(tx ? tx[idx] : 0x00);
+		if(rx)
+			rx[idx] = data;
+	}
+	wiz_spi_stat.poll_bytes += len;
+	wiz_spi_stat.poll_cycles += OS_TS_GET() - ts;
+}
+
+/**
+*@brief		写入一个8位数据到W5500
+*@param		addrbsb: 写入数据的地址
+*@param   data：写入的8位数据
+*@return	无
 */
 void IINCHIP_WRITE( uint32 addrbsb,  uint8 data)
 {
+   wiz_spi_lock();
    iinchip_csoff();                              		
    IINCHIP_SpiSendData( (addrbsb & 0x00FF0000)>>16);	
    IINCHIP_SpiSendData( (addrbsb & 0x0000FF00)>> 8);
    IINCHIP_SpiSendData( (addrbsb & 0x000000F8) + 4);  
    IINCHIP_SpiSendData(data);                   
    iinchip_cson();                            
+   wiz_spi_unlock();
 }
 
 /**
-*@brief		W5500һ8λ
-*@param		addrbsb: дݵĵַ
-*@param   dataдĵַȡ8λ
-*@return	
+*@brief		从W5500读出一个8位数据
+*@param		addrbsb: 写入数据的地址
+*@param   data：从写入的地址处读取到的8位数据
+*@return	无
 */
 uint8 IINCHIP_READ(uint32 addrbsb)
 {
    uint8 data = 0;
+   wiz_spi_lock();
    iinchip_csoff();                            
    IINCHIP_SpiSendData( (addrbsb & 0x00FF0000)>>16);
    IINCHIP_SpiSendData( (addrbsb & 0x0000FF00)>> 8);
    IINCHIP_SpiSendData( (addrbsb & 0x000000F8))    ;
    data = IINCHIP_SpiSendData(0x00);            
    iinchip_cson();                               
+   wiz_spi_unlock();
    return data;    
 }
 
 /**
-*@brief		W5500дlenֽ
-*@param		addrbsb: дݵĵַ
-*@param   bufдַ
-*@param   lenַ
-*@return	lenַ
+*@brief		向W5500写入len字节数据
+*@param		addrbsb: 写入数据的地址
+*@param   buf：写入字符串
+*@param   len：字符串长度
+*@return	len：返回字符串长度
+*@note		数据段较长时用DMA，传完前调用的任务挂起
 */
 uint16 wiz_write_buf(uint32 addrbsb,uint8* buf,uint16 len)
 {
-   uint16 idx = 0;
    if(len == 0) printf("Unexpected2 length 0\r\n");
+   wiz_spi_lock();
    iinchip_csoff();                               
    IINCHIP_SpiSendData( (addrbsb & 0x00FF0000)>>16);
    IINCHIP_SpiSendData( (addrbsb & 0x0000FF00)>> 8);
    IINCHIP_SpiSendData( (addrbsb & 0x000000F8) + 4); 
-   for(idx = 0; idx < len; idx++)
-   {
-     IINCHIP_SpiSendData(buf[idx]);
-   }
+   wiz_spi_transfer(buf, NULL, len);
    iinchip_cson();                           
+   wiz_spi_unlock();
    return len;  
 }
 
 /**
-*@brief		W5500lenֽ
-*@param		addrbsb: ȡݵĵַ
-*@param 	bufŶȡ
-*@param		lenַ
-*@return	lenַ
+*@brief		打开一次向W5500的连续写，片选保持为低，之后用WIZ_WRITE_STREAM_BYTE逐字节写入
+*@param		addrbsb: 写入数据的地址
+*@return	无
+*@note		到wiz_write_stream_end()前独占SPI
+*/
+void wiz_write_stream_begin(uint32 addrbsb)
+{
+   wiz_spi_lock();
+   iinchip_csoff();                               
+   IINCHIP_SpiSendData( (addrbsb & 0x00FF0000)>>16);
+   IINCHIP_SpiSendData( (addrbsb & 0x0000FF00)>> 8);
+   IINCHIP_SpiSendData( (addrbsb & 0x000000F8) + 4); 
+}
+
+/**
+*@brief		结束连续写：等最后一个字节移出后拉高片选
+*@param		无
+*@return	无
+*/
+void wiz_write_stream_end(void)
+{
+   while (SPI_I2S_GetFlagStatus(WIZ_SPIx, SPI_I2S_FLAG_TXE) == RESET);
+   while (SPI_I2S_GetFlagStatus(WIZ_SPIx, SPI_I2S_FLAG_BSY) == SET);
+   /* 连续写时没有读接收数据，先读DR再读SR清除溢出标志 */
+   SPI_I2S_ReceiveData(WIZ_SPIx);
+   SPI_I2S_GetFlagStatus(WIZ_SPIx, SPI_I2S_FLAG_OVR);
+   iinchip_cson();                           
+   wiz_spi_unlock();
+}
+
+/**
+*@brief		从W5500读出len字节数据
+*@param		addrbsb: 读取数据的地址
+*@param 	buf：存放读取数据
+*@param		len：字符串长度
+*@return	len：返回字符串长度
+*@note		数据段较长时用DMA，传完前调用的任务挂起
 */
 uint16 wiz_read_buf(uint32 addrbsb, uint8* buf,uint16 len)
 {
-  uint16 idx = 0;
   if(len == 0)
   {
     printf("Unexpected2 length 0\r\n");
   }
+  wiz_spi_lock();
   iinchip_csoff();                                
   IINCHIP_SpiSendData( (addrbsb & 0x00FF0000)>>16);
   IINCHIP_SpiSendData( (addrbsb & 0x0000FF00)>> 8);
   IINCHIP_SpiSendData( (addrbsb & 0x000000F8));    
-  for(idx = 0; idx < len; idx++)                   
-  {
-    buf[idx] = IINCHIP_SpiSendData(0x00);
-  }
+  wiz_spi_transfer(NULL, buf, len);
   iinchip_cson();                                  
+  wiz_spi_unlock();
   return len;
 }
 
 /**
-*@brief		дϢEEPROM
-*@param		
-*@return	
+*@brief		写配置信息到EEPROM
+*@param		无
+*@return	无
 */
 void write_config_to_eeprom(void)
 {
@@ -373,9 +595,9 @@ void write_config_to_eeprom(void)
 }
 
 /**
-*@brief		EEPROMϢ
-*@param		
-*@return	
+*@brief		从EEPROM读配置信息
+*@param		无
+*@return	无
 */
 void read_config_from_eeprom(void)
 {
@@ -384,21 +606,21 @@ void read_config_from_eeprom(void)
 }
 
 /**
-*@brief		STM32ʱ2ʼ
-*@param		
-*@return	
+*@brief		STM32定时器2初始化
+*@param		无
+*@return	无
 */
 void timer2_init(void)
 {
-	TIM2_Configuration();																		/* TIM2 ʱ */
-	TIM2_NVIC_Configuration();															/* ʱжȼ */
-	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2 , ENABLE);		/* TIM2 ¿ʱӣʼʱ */
+	TIM2_Configuration();																		/* TIM2 定时配置 */
+	TIM2_NVIC_Configuration();															/* 定时器的中断优先级 */
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2 , ENABLE);		/* TIM2 重新开时钟，开始计时 */
 }
 
 /**
-*@brief		dhcpõĶʱʼ
-*@param		
-*@return	
+*@brief		dhcp用到的定时器初始化
+*@param		无
+*@return	无
 */
 void dhcp_timer_init(void)
 {
@@ -406,9 +628,9 @@ void dhcp_timer_init(void)
 }
 
 /**
-*@brief		ntpõĶʱʼ
-*@param		
-*@return	
+*@brief		ntp用到的定时器初始化
+*@param		无
+*@return	无
 */
 void ntp_timer_init(void)
 {
@@ -416,9 +638,9 @@ void ntp_timer_init(void)
 }
 
 /**
-*@brief		ʱ2жϺ
-*@param		
-*@return	
+*@brief		定时器2中断函数
+*@param		无
+*@return	无
 */
 void timer2_isr(void)
 {
@@ -426,51 +648,52 @@ void timer2_isr(void)
   if(ms>=1000)
   {  
     ms=0;
-    dhcp_time++;																					/*DHCPʱ1S*/
+    dhcp_time++;																					/*DHCP定时加1S*/
 	  #ifndef	__NTP_H__
-	  ntptimer++;																						/*NTPʱ1S*/
+	  ntptimer++;																						/*NTP重试时间加1S*/
 	  #endif
   }
 
 }
 /**
-*@brief		STM32ϵͳλ
-*@param		
-*@return	
+*@brief		STM32系统软复位函数
+*@param		无
+*@return	无
 */
 void reboot(void)
 {
   pFunction Jump_To_Application;
   uint32 JumpAddress;
-  printf(" ϵͳС\r\n");
+  printf(" 系统重启中……\r\n");
   JumpAddress = *(vu32*) (0x00000004);
   Jump_To_Application = (pFunction) JumpAddress;
   Jump_To_Application();
 }
 
 /**
-*@brief		W5500ʼ
-*@param		
-*@return	
+*@brief		W5500初始化函数
+*@param		无
+*@return	无
 */
 void W5500_Init(void)
 {
-	systick_init(72);										/*ʼSystickʱ*/
-	i2c_CfgGpio();											/*ʼeeprom*/
-	printf("  Ұ ʼ Demo V1.0 \r\n");		
-
-	gpio_for_w5500_config();						/*ʼMCU*/
-	reset_w5500();											/*ӲλW5500*/
-	set_w5500_mac();										/*MACַ*/
-	printf("  MACַ \r\n");
-	set_w5500_ip();											/*IPַ*/
-	printf("  IPַ \r\n");
-	socket_buf_init(txsize, rxsize);		/*ʼ8SocketķͽջС*/
+	systick_init(72);										/*初始化Systick工作时钟*/
+	i2c_CfgGpio();											/*初始化eeprom*/
+	printf("  野火网络适配版 网络初始化 Demo V1.0 \r\n");		
+
+	gpio_for_w5500_config();						/*初始化MCU相关引脚*/
+	reset_w5500();											/*硬复位W5500*/
+	set_w5500_mac();										/*配置MAC地址*/
+	printf("  配置MAC地址 \r\n");
+	set_w5500_ip();											/*配置IP地址*/
+	printf("  配置IP地址 \r\n");
+	socket_buf_init(txsize, rxsize);		/*初始化8个Socket的发送接收缓存大小*/
+	wiz_spi_os_init();									/*之后的访问互斥，缓冲区读写用DMA*/
 	
-	printf(" W5500Ժ͵ԵUDP˿ͨѶ \r\n");
-	printf(" W5500ıض˿Ϊ:%d \r\n",local_port);
-	printf(" Զ˶˿Ϊ:%d \r\n",remote_port);
-	printf(" ӳɹPCݸW5500W5500ضӦ \r\n");
+	printf(" W5500可以和电脑的UDP端口通讯 \r\n");
+	printf(" W5500的本地端口为:%d \r\n",local_port);
+	printf(" 远端端口为:%d \r\n",remote_port);
+	printf(" 连接成功后，PC机发送数据给W5500，W5500将返回对应数据 \r\n");
 }
 
 
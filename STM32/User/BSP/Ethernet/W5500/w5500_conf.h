@@ -8,61 +8,71 @@
 
 typedef  void (*pFunction)(void);
 
-extern uint8    remote_ip[4];                            	  /* ԶIPַ                   */
-extern uint16   remote_port;                            	  /* Զ˶˿ں                   */
-extern uint16   remote_port2;                            	  /* Զ˶˿ں                   */
-extern uint16   local_port;                             	  /* 屾ض˿                 */
-extern uint8    use_dhcp;                              	    /* ǷʹDHCPȡIP           */
-extern uint8    use_eeprom;                             	  /* ǷʹEEPROMеIPϢ */
+extern uint8    remote_ip[4];                            	  /* 远端IP地址                   */
+extern uint16   remote_port;                            	  /* 远端端口号                   */
+extern uint16   remote_port2;                            	  /* 远端端口号                   */
+extern uint16   local_port;                             	  /* 定义本地端口                 */
+extern uint8    use_dhcp;                              	    /* 是否使用DHCP获取IP           */
+extern uint8    use_eeprom;                             	  /* 是否使用EEPROM中的IP配置信息 */
 
 /*
- * ͨ궨ѡĿ꿪
- * STM32F103ZET6 -> ҰISO-V3
- * STM32F103VET6 -> ҰISO-MINI-V3
+ * 通过宏定义选择目标开发板
+ * STM32F103ZET6 -> 野火ISO-V3开发板
+ * STM32F103VET6 -> 野火ISO-MINI-V3开发板
  */
-/*ʹҰISO-MINI-V3*/
+/*使用野火ISO-MINI-V3开发板*/
 #define STM32F103VET6
 #undef  STM32F103ZET6
 
-/*SPI2ΪW5500Ӳӿ*/
-#define WIZ_SPIx_GPIO_PORT      GPIOA									  	  /* GPIO˿                     */
-#define WIZ_SPIx_GPIO_CLK       RCC_APB2Periph_GPIOA	  	  /* GPIO˿ʱ                 */
-#define WIZ_SPIx                SPI1                   	    /* W5500õSPIӿ       */
+/*定义SPI2作为W5500的硬件接口*/
+#define WIZ_SPIx_GPIO_PORT      GPIOA									  	  /* GPIO端口                     */
+#define WIZ_SPIx_GPIO_CLK       RCC_APB2Periph_GPIOA	  	  /* GPIO端口时钟                 */
+#define WIZ_SPIx                SPI1                   	    /* 定义W5500所用的SPI接口       */
 #define WIZ_SPIx_CLK_CMD        RCC_APB2PeriphClockCmd
-#define WIZ_SPIx_CLK            RCC_APB2Periph_SPI1    	    /* W5500õSPIӿʱ   */
-#define WIZ_SPIx_SCLK           GPIO_Pin_5						   	  /* W5500ʱӹܽ          */
-#define WIZ_SPIx_MISO           GPIO_Pin_6						   	  /* W5500MISOܽ          */
-#define WIZ_SPIx_MOSI           GPIO_Pin_7						   	  /* W5500MOSIܽ          */
+#define WIZ_SPIx_CLK            RCC_APB2Periph_SPI1    	    /* 定义W5500所用的SPI接口时钟   */
+#define WIZ_SPIx_SCLK           GPIO_Pin_5						   	  /* 定义W5500的时钟管脚          */
+#define WIZ_SPIx_MISO           GPIO_Pin_6						   	  /* 定义W5500的MISO管脚          */
+#define WIZ_SPIx_MOSI           GPIO_Pin_7						   	  /* 定义W5500的MOSI管脚          */
+
+/*SPI1的DMA：接收、发送两个通道同时开，接收通道传完（最后一个字节已移入）即整块结束*/
+#define WIZ_SPIx_DMA_CLK        RCC_AHBPeriph_DMA1
+#define WIZ_SPIx_DMA_RX_CHANNEL DMA1_Channel2                  	  /* SPI1_RX                      */
+#define WIZ_SPIx_DMA_TX_CHANNEL DMA1_Channel3                  	  /* SPI1_TX                      */
+#define WIZ_SPIx_DMA_IT_TC      DMA1_IT_TC2
+#define WIZ_SPIx_DMA_IT_GL      DMA1_IT_GL2
+#define WIZ_SPIx_DMA_IRQ        DMA1_Channel2_IRQn
+#define WIZ_SPIx_DMA_INT_FUNCTION  DMA1_Channel2_IRQHandler
+#define WIZ_SPIx_DMA_TIMEOUT    10                          	  /* 等待一块传完的超时（时钟节拍）*/
 
 
 
 #ifdef  STM32F103ZET6 
-  #define WIZ_SPIx_SCS          GPIO_Pin_9						   	  /* W5500Ƭѡܽ          */
-  #define WIZ_SPIx_SCS_PORT     GPIOG									   	  /* GPIO˿                     */
-  #define WIZ_SPIx_SCS_CLK      RCC_APB2Periph_GPIOG	   	  /* GPIO˿ʱ                 */
+  #define WIZ_SPIx_SCS          GPIO_Pin_9						   	  /* 定义W5500的片选管脚          */
+  #define WIZ_SPIx_SCS_PORT     GPIOG									   	  /* GPIO端口                     */
+  #define WIZ_SPIx_SCS_CLK      RCC_APB2Periph_GPIOG	   	  /* GPIO端口时钟                 */
    
-	#define WIZ_RESET             GPIO_Pin_15									/* W5500RESETܽ         */
-  #define WIZ_SPIx_RESET_PORT   GPIOG									   	  /* GPIO˿                     */
-  #define WIZ_SPIx_RESET_CLK    RCC_APB2Periph_GPIOG	  	  /* GPIO˿ʱ                 */
+	#define WIZ_RESET             GPIO_Pin_15									/* 定义W5500的RESET管脚         */
+  #define WIZ_SPIx_RESET_PORT   GPIOG									   	  /* GPIO端口                     */
+  #define WIZ_SPIx_RESET_CLK    RCC_APB2Periph_GPIOG	  	  /* GPIO端口时钟                 */
   
-	#define WIZ_INT               GPIO_Pin_8									/* W5500INTܽ           */
-  #define WIZ_SPIx_INT_PORT     GPIOG									  	  /* GPIO˿                     */
-  #define WIZ_SPIx_INT_CLK      RCC_APB2Periph_GPIOG		    /* GPIO˿ʱ                 */
+	#define WIZ_INT               GPIO_Pin_8									/* 定义W5500的INT管脚           */
+  #define WIZ_SPIx_INT_PORT     GPIOG									  	  /* GPIO端口                     */
+  #define WIZ_SPIx_INT_CLK      RCC_APB2Periph_GPIOG		    /* GPIO端口时钟                 */
 #endif
 
 
 #ifdef STM32F103VET6 
-  #define WIZ_SPIx_SCS          GPIO_Pin_4						 	    /* W5500Ƭѡܽ          */
-  #define WIZ_SPIx_SCS_PORT     GPIOA									 	    /* GPIO˿                     */
-  #define WIZ_SPIx_SCS_CLK      RCC_APB2Periph_GPIOA	 	    /* GPIO˿ʱ                 */
+  #define WIZ_SPIx_SCS          GPIO_Pin_4						 	    /* 定义W5500的片选管脚          */
+  #define WIZ_SPIx_SCS_PORT     GPIOA									 	    /* GPIO端口                     */
+  #define WIZ_SPIx_SCS_CLK      RCC_APB2Periph_GPIOA	 	    /* GPIO端口时钟                 */
   
-	#define WIZ_RESET             GPIO_Pin_6									/* W5500RESETܽ         */
-  #define WIZ_SPIx_RESET_PORT   GPIOE									  	  /* GPIO˿                     */
-  #define WIZ_SPIx_RESET_CLK    RCC_APB2Periph_GPIOE	 	    /* GPIO˿ʱ                 */
+	#define WIZ_RESET             GPIO_Pin_6									/* 定义W5500的RESET管脚         */
+  #define WIZ_SPIx_RESET_PORT   GPIOE									  	  /* GPIO端口                     */
+  #define WIZ_SPIx_RESET_CLK    RCC_APB2Periph_GPIOE	 	    /* GPIO端口时钟                 */
   
-	#define WIZ_INT               GPIO_Pin_5									/* W5500INTܽ           */
-  #define WIZ_SPIx_INT_PORT     GPIOE									      /* GPIO˿                     */
-  #define WIZ_SPIx_INT_CLK      RCC_APB2Periph_GPIOE	      /* GPIO˿ʱ                 */
+	#define WIZ_INT               GPIO_Pin_5									/* 定义W5500的INT管脚           */
+  #define WIZ_SPIx_INT_PORT     GPIOE									      /* GPIO端口                     */
+  #define WIZ_SPIx_INT_CLK      RCC_APB2Periph_GPIOE	      /* GPIO端口时钟                 */
 #endif
 
 #define FW_VER_HIGH  						1               
@@ -72,71 +82,100 @@ extern uint8    use_eeprom;                             	  /* 
 #define HIGH	           	 			1
 #define LOW		             			0
 
-#define MAX_BUF_SIZE		 				1460       			            /*ÿݰĴС*/
+#define MAX_BUF_SIZE		 				1460       			            /*定义每个数据包的大小*/
 #define KEEP_ALIVE_TIME	     		30	// 30sec
 #define TX_RX_MAX_BUF_SIZE      2048							 
 #define EEPROM_MSG_LEN        	sizeof(EEPROM_MSG)
 
-#define IP_FROM_DEFINE	        0       			              /*ʹóʼIPϢ*/
-#define IP_FROM_DHCP	          1       			              /*ʹDHCPȡIPϢ*/
-#define IP_FROM_EEPROM	        2       			              /*ʹEEPROMIPϢ*/
-extern uint8	ip_from;											                /*ѡIPϢԴ*/
+#define IP_FROM_DEFINE	        0       			              /*使用初始定义的IP信息*/
+#define IP_FROM_DHCP	          1       			              /*使用DHCP获取IP信息*/
+#define IP_FROM_EEPROM	        2       			              /*使用EEPROM定义的IP信息*/
+extern uint8	ip_from;											                /*选择IP信息配置源*/
 #pragma pack(1)
-/*˽ṹ嶨W5500ɹõҪ*/
+/*此结构体定义了W5500可供配置的主要参数*/
 typedef struct _CONFIG_MSG											
 {
-  uint8 mac[6];																							/*MACַ*/
-  uint8 lip[4];																							/*local IPIPַ*/
-  uint8 sub[4];																							/**/
-  uint8 gw[4];																							/**/	
-  uint8 dns[4];																							/*DNSַ*/
-  uint8 rip[4];																							/*remote IPԶIPַ*/
-	uint8 sw_ver[2];																					/*汾*/
+  uint8 mac[6];																							/*MAC地址*/
+  uint8 lip[4];																							/*local IP本地IP地址*/
+  uint8 sub[4];																							/*子网掩码*/
+  uint8 gw[4];																							/*网关*/	
+  uint8 dns[4];																							/*DNS服务器地址*/
+  uint8 rip[4];																							/*remote IP远程IP地址*/
+	uint8 sw_ver[2];																					/*软件版本号*/
 
 }CONFIG_MSG;
 #pragma pack()
 
+/*SPI传输统计，可在调试器中查看：字节数/周期数*主频为有效速率，
+  轮询的周期全部占用CPU，DMA的周期中任务挂起，CPU可做别的事*/
+typedef struct
+{
+	uint32 dma_bytes;                       /*DMA传输的数据字节数*/
+	uint32 dma_cycles;                      /*DMA传输从启动到完成的DWT周期数*/
+	uint32 dma_timeout;                     /*DMA超时次数*/
+	uint32 poll_bytes;                      /*逐字节轮询传输的数据字节数（不含3字节地址段）*/
+	uint32 poll_cycles;                     /*轮询传输的DWT周期数*/
+}WIZ_SPI_STAT;
+
+extern WIZ_SPI_STAT wiz_spi_stat;
+
 #pragma pack(1)
-/*˽ṹ嶨eepromдļɰ޸*/
+/*此结构体定义了eeprom写入的几个变量，可按需修改*/
 typedef struct _EEPROM_MSG	                    
 {
-	uint8 mac[6];																							/*MACַ*/
-  uint8 lip[4];																							/*local IPIPַ*/
-  uint8 sub[4];																							/**/
-  uint8 gw[4];																							/**/
+	uint8 mac[6];																							/*MAC地址*/
+  uint8 lip[4];																							/*local IP本地IP地址*/
+  uint8 sub[4];																							/*子网掩码*/
+  uint8 gw[4];																							/*网关*/
 }EEPROM_MSG_STR;
 #pragma pack()
 
 extern EEPROM_MSG_STR EEPROM_MSG;
 extern CONFIG_MSG  	ConfigMsg;
-extern uint8 dhcp_ok;																				/*DHCPȡɹ*/
-extern uint32	dhcp_time;																		/*DHCPм*/
-extern vu8	ntptimer;																				/*NPT*/
-
-/*MCUغ*/
-void gpio_for_w5500_config(void);														/*SPIӿreset ж*/
-void timer2_init(void);																			/*STM32ʱ2ʼ*/
-void timer2_isr(void);																			/*ʱжִеĺ*/
-void reboot(void);																					/*STM32λ*/
-void write_config_to_eeprom(void);													/*дϢEEPROM*/
-void read_config_from_eeprom(void);													/*EEPROMжϢ*/
-
-/*W5500SPIغ*/
-void IINCHIP_WRITE( uint32 addrbsb,  uint8 data);						/*дһ8λݵW5500*/
-uint8 IINCHIP_READ(uint32 addrbsb);													/*W5500һ8λ*/
-uint16 wiz_write_buf(uint32 addrbsb,uint8* buf,uint16 len);	/*W5500дlenֽ*/
-uint16 wiz_read_buf(uint32 addrbsb, uint8* buf,uint16 len);	/*W5500lenֽ*/
-
-/*W5500غ*/
-void reset_w5500(void);																			/*ӲλW5500*/
-void set_w5500_mac(void);																		/*W5500MACַ*/
-void set_w5500_ip(void);																		/*W5500IPַ*/
-
-/*ҪöʱĵӦú*/
-void dhcp_timer_init(void);																	/*dhcpõĶʱʼ*/
-void ntp_timer_init(void);																	/*nptõĶʱʼ*/
-
-/* W5500ʼ */
+extern uint8 dhcp_ok;																				/*DHCP获取成功*/
+extern uint32	dhcp_time;																		/*DHCP运行计数*/
+extern vu8	ntptimer;																				/*NPT秒计数*/
+
+/*MCU配置相关函数*/
+void gpio_for_w5500_config(void);														/*SPI接口reset 及中断引脚*/
+void timer2_init(void);																			/*STM32定时器2初始化*/
+void timer2_isr(void);																			/*定时器中断执行的函数*/
+void reboot(void);																					/*STM32软复位*/
+void write_config_to_eeprom(void);													/*写配置信息到EEPROM中*/
+void read_config_from_eeprom(void);													/*从EEPROM中读出信息*/
+
+/*W5500SPI相关函数*/
+void IINCHIP_WRITE( uint32 addrbsb,  uint8 data);						/*写入一个8位数据到W5500*/
+uint8 IINCHIP_READ(uint32 addrbsb);													/*从W5500读出一个8位数据*/
+uint16 wiz_write_buf(uint32 addrbsb,uint8* buf,uint16 len);	/*向W5500写入len字节数据*/
+uint16 wiz_read_buf(uint32 addrbsb, uint8* buf,uint16 len);	/*从W5500读出len字节数据*/
+void wiz_write_stream_begin(uint32 addrbsb);								/*打开一次连续写*/
+void wiz_write_stream_end(void);														/*结束连续写*/
+void wiz_spi_os_init(void);																	/*创建SPI互斥量、DMA信号量*/
+void wiz_spi_lock(void);																		/*独占W5500的SPI，可嵌套*/
+void wiz_spi_unlock(void);																	/*放开W5500的SPI*/
+void wiz_spi_dma_isr(void);																	/*SPI DMA传完中断处理*/
+
+/*连续写中写入一个字节：只等发送缓冲空，不等接收，SPI移位与取数据重叠*/
+#define WIZ_WRITE_STREAM_BYTE(b)    do{\
+                                      while((WIZ_SPIx->SR & SPI_I2S_FLAG_TXE) == 0);\
+                                      WIZ_SPIx->DR = (b);\
+                                    }while(0)
+
+#ifdef WIZ_SPI_SIM
+#include "wiz_spi_sim.h"        //主机测试：连续写接到W5500模型，见Test/shim
+#endif
+
+/*W5500基本配置相关函数*/
+void reset_w5500(void);																			/*硬复位W5500*/
+void set_w5500_mac(void);																		/*配置W5500的MAC地址*/
+void set_w5500_ip(void);																		/*配置W5500的IP地址*/
+
+/*需要用定时的的应用函数*/
+void dhcp_timer_init(void);																	/*dhcp用到的定时器初始化*/
+void ntp_timer_init(void);																	/*npt用到的定时器初始化*/
+
+/* W5500初始化函数 */
 void W5500_Init(void);
 
 #endif
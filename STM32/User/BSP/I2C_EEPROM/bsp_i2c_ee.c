@@ -1,16 +1,16 @@
 /**
   ******************************************************************************
   * @file    bsp_i2c_ee.c
-  * @author  armfly (ʽ)
+  * @author  armfly (格式重新整理)
   * @version V1.0
   * @date    2013-xx-xx
-  * @brief   i2c EEPROM(AT24C02)Ӧúbsp
+  * @brief   i2c EEPROM(AT24C02)应用函数bsp
   ******************************************************************************
   * @attention
   *
-  * ʵƽ̨:Ұ ISO-MINI STM32  
-  * ̳    :http://www.firebbs.cn
-  * Ա    :https://fire-stm32.taobao.com
+  * 实验平台:野火 ISO-MINI STM32 开发板 
+  * 论坛    :http://www.firebbs.cn
+  * 淘宝    :https://fire-stm32.taobao.com
   *
   ******************************************************************************
   */ 
@@ -21,10 +21,10 @@
 #include "types.h"
 /*
 *********************************************************************************************************
-*	  : ee_CheckOk
-*	˵: жϴEERPOMǷ
-*	    Σ
-*	  ֵ: 1 ʾ 0 ʾ
+*	函 数 名: ee_CheckOk
+*	功能说明: 判断串行EERPOM是否正常
+*	形    参：无
+*	返 回 值: 1 表示正常， 0 表示不正常
 *********************************************************************************************************
 */
 uint8_t ee_CheckOk(void)
@@ -35,7 +35,7 @@ uint8_t ee_CheckOk(void)
 	}
 	else
 	{
-		/* ʧܺмǷI2Cֹͣź */
+		/* 失败后，切记发送I2C总线停止信号 */
 		i2c_Stop();		
 		return 0;
 	}
@@ -43,86 +43,86 @@ uint8_t ee_CheckOk(void)
 
 /*
 *********************************************************************************************************
-*	  : ee_ReadBytes
-*	˵: ӴEEPROMַָʼȡ
-*	    Σ_usAddress : ʼַ
-*			 _usSize : ݳȣλΪֽ
-*			 _pReadBuf : ŶݵĻָ
-*	  ֵ: 0 ʾʧܣ1ʾɹ
+*	函 数 名: ee_ReadBytes
+*	功能说明: 从串行EEPROM指定地址处开始读取若干数据
+*	形    参：_usAddress : 起始地址
+*			 _usSize : 数据长度，单位为字节
+*			 _pReadBuf : 存放读到的数据的缓冲区指针
+*	返 回 值: 0 表示失败，1表示成功
 *********************************************************************************************************
 */
 uint8_t ee_ReadBytes(uint8_t *_pReadBuf, uint16_t _usAddress, uint16_t _usSize)
 {
 	uint16_t i;
 	
-	/* ôEEPROM漴ȡָУȡֽ */
+	/* 采用串行EEPROM随即读取指令序列，连续读取若干字节 */
 	
-	/* 1I2Cź */
+	/* 第1步：发起I2C总线启动信号 */
 	i2c_Start();
 	
-	/* 2ֽڣ7bitǵַbit0Ƕдλ0ʾд1ʾ */
-	i2c_SendByte(EE_DEV_ADDR | I2C_WR);	/* ˴дָ */
+	/* 第2步：发起控制字节，高7bit是地址，bit0是读写控制位，0表示写，1表示读 */
+	i2c_SendByte(EE_DEV_ADDR | I2C_WR);	/* 此处是写指令 */
 	
-	/* 3ACK */
+	/* 第3步：发送ACK */
 	if (i2c_WaitAck() != 0)
 	{
-		goto cmd_fail;	/* EEPROMӦ */
+		goto cmd_fail;	/* EEPROM器件无应答 */
 	}
 
-	/* 4ֽڵַ24C02ֻ256ֽڣ1ֽھ͹ˣ24C04ϣô˴Ҫַ */
+	/* 第4步：发送字节地址，24C02只有256字节，因此1个字节就够了，如果是24C04以上，那么此处需要连发多个地址 */
 	i2c_SendByte((uint8_t)_usAddress);
 	
-	/* 5ACK */
+	/* 第5步：发送ACK */
 	if (i2c_WaitAck() != 0)
 	{
-		goto cmd_fail;	/* EEPROMӦ */
+		goto cmd_fail;	/* EEPROM器件无应答 */
 	}
 	
-	/* 6I2CߡǰĴĿEEPROM͵ַ濪ʼȡ */
+	/* 第6步：重新启动I2C总线。前面的代码的目的向EEPROM传送地址，下面开始读取数据 */
 	i2c_Start();
 	
-	/* 7ֽڣ7bitǵַbit0Ƕдλ0ʾд1ʾ */
-	i2c_SendByte(EE_DEV_ADDR | I2C_RD);	/* ˴Ƕָ */
+	/* 第7步：发起控制字节，高7bit是地址，bit0是读写控制位，0表示写，1表示读 */
+	i2c_SendByte(EE_DEV_ADDR | I2C_RD);	/* 此处是读指令 */
 	
-	/* 8ACK */
+	/* 第8步：发送ACK */
 	if (i2c_WaitAck() != 0)
 	{
-		goto cmd_fail;	/* EEPROMӦ */
+		goto cmd_fail;	/* EEPROM器件无应答 */
 	}	
 	
-	/* 9ѭȡ */
+	/* 第9步：循环读取数据 */
 	for (i = 0; i < _usSize; i++)
 	{
-		_pReadBuf[i] = i2c_ReadByte();	/* 1ֽ */
+		_pReadBuf[i] = i2c_ReadByte();	/* 读1个字节 */
 		
-		/* ÿ1ֽںҪAck һֽڲҪAckNack */
+		/* 每读完1个字节后，需要发送Ack， 最后一个字节不需要Ack，发Nack */
 		if (i != _usSize - 1)
 		{
-			i2c_Ack();	/* мֽڶCPUACKź(SDA = 0) */
+			i2c_Ack();	/* 中间字节读完后，CPU产生ACK信号(驱动SDA = 0) */
 		}
 		else
 		{
-			i2c_NAck();	/* 1ֽڶCPUNACKź(SDA = 1) */
+			i2c_NAck();	/* 最后1个字节读完后，CPU产生NACK信号(驱动SDA = 1) */
 		}
 	}
-	/* I2Cֹͣź */
+	/* 发送I2C总线停止信号 */
 	i2c_Stop();
-	return 1;	/* ִгɹ */
+	return 1;	/* 执行成功 */
 
-cmd_fail: /* ִʧܺмǷֹͣźţӰI2C豸 */
-	/* I2Cֹͣź */
+cmd_fail: /* 命令执行失败后，切记发送停止信号，避免影响I2C总线上其他设备 */
+	/* 发送I2C总线停止信号 */
 	i2c_Stop();
 	return 0;
 }
 
 /*
 *********************************************************************************************************
-*	  : ee_WriteBytes
-*	˵: EEPROMַָдݣҳддЧ
-*	    Σ_usAddress : ʼַ
-*			 _usSize : ݳȣλΪֽ
-*			 _pWriteBuf : ŶݵĻָ
-*	  ֵ: 0 ʾʧܣ1ʾɹ
+*	函 数 名: ee_WriteBytes
+*	功能说明: 向串行EEPROM指定地址写入若干数据，采用页写操作提高写入效率
+*	形    参：_usAddress : 起始地址
+*			 _usSize : 数据长度，单位为字节
+*			 _pWriteBuf : 存放读到的数据的缓冲区指针
+*	返 回 值: 0 表示失败，1表示成功
 *********************************************************************************************************
 */
 uint8_t ee_WriteBytes(uint8_t *_pWriteBuf, uint16_t _usAddress, uint16_t _usSize)
@@ -131,33 +131,33 @@ uint8_t ee_WriteBytes(uint8_t *_pWriteBuf, uint16_t _usAddress, uint16_t _usSize
 	uint16_t usAddr;
 	
 	/* 
-		дEEPROMȡֽܶڣÿдֻͬһpage
-		24xx02page size = 8
-		򵥵ĴΪֽдģʽûд1ֽڣ͵ַ
-		ΪдЧ: page wirte
+		写串行EEPROM不像读操作可以连续读取很多字节，每次写操作只能在同一个page。
+		对于24xx02，page size = 8
+		简单的处理方法为：按字节写操作模式，没写1个字节，都发送地址
+		为了提高连续写的效率: 本函数采用page wirte操作。
 	*/
 
 	usAddr = _usAddress;	
 	for (i = 0; i < _usSize; i++)
 	{
-		/* ͵1ֽڻҳ׵ַʱҪ·źź͵ַ */
+		/* 当发送第1个字节或是页面首地址时，需要重新发起启动信号和地址 */
 		if ((i == 0) || (usAddr & (EE_PAGE_SIZE - 1)) == 0)
 		{
-			/*ڣֹͣźţڲд*/
+			/*　第０步：发停止信号，启动内部写操作　*/
 			i2c_Stop();
 			
-			/* ͨӦķʽжڲдǷ, һС 10ms 			
-				CLKƵΪ200KHzʱѯΪ30
+			/* 通过检查器件应答的方式，判断内部写操作是否完成, 一般小于 10ms 			
+				CLK频率为200KHz时，查询次数为30次左右
 			*/
 			for (m = 0; m < 100; m++)
 			{				
-				/* 1I2Cź */
+				/* 第1步：发起I2C总线启动信号 */
 				i2c_Start();
 				
-				/* 2ֽڣ7bitǵַbit0Ƕдλ0ʾд1ʾ */
-				i2c_SendByte(EE_DEV_ADDR | I2C_WR);	/* ˴дָ */
+				/* 第2步：发起控制字节，高7bit是地址，bit0是读写控制位，0表示写，1表示读 */
+				i2c_SendByte(EE_DEV_ADDR | I2C_WR);	/* 此处是写指令 */
 				
-				/* 3һʱӣжǷȷӦ */
+				/* 第3步：发送一个时钟，判断器件是否正确应答 */
 				if (i2c_WaitAck() == 0)
 				{
 					break;
@@ -165,37 +165,37 @@ uint8_t ee_WriteBytes(uint8_t *_pWriteBuf, uint16_t _usAddress, uint16_t _usSize
 			}
 			if (m  == 1000)
 			{
-				goto cmd_fail;	/* EEPROMдʱ */
+				goto cmd_fail;	/* EEPROM器件写超时 */
 			}
 		
-			/* 4ֽڵַ24C02ֻ256ֽڣ1ֽھ͹ˣ24C04ϣô˴Ҫַ */
+			/* 第4步：发送字节地址，24C02只有256字节，因此1个字节就够了，如果是24C04以上，那么此处需要连发多个地址 */
 			i2c_SendByte((uint8_t)usAddr);
 			
-			/* 5ACK */
+			/* 第5步：发送ACK */
 			if (i2c_WaitAck() != 0)
 			{
-				goto cmd_fail;	/* EEPROMӦ */
+				goto cmd_fail;	/* EEPROM器件无应答 */
 			}
 		}
 	
-		/* 6ʼд */
+		/* 第6步：开始写入数据 */
 		i2c_SendByte(_pWriteBuf[i]);
 	
-		/* 7ACK */
+		/* 第7步：发送ACK */
 		if (i2c_WaitAck() != 0)
 		{
-			goto cmd_fail;	/* EEPROMӦ */
+			goto cmd_fail;	/* EEPROM器件无应答 */
 		}
 
-		usAddr++;	/* ַ1 */		
+		usAddr++;	/* 地址增1 */		
 	}
 	
-	/* ִгɹI2Cֹͣź */
+	/* 命令执行成功，发送I2C总线停止信号 */
 	i2c_Stop();
 	return 1;
 
-cmd_fail: /* ִʧܺмǷֹͣźţӰI2C豸 */
-	/* I2Cֹͣź */
+cmd_fail: /* 命令执行失败后，切记发送停止信号，避免影响I2C总线上其他设备 */
+	/* 发送I2C总线停止信号 */
 	i2c_Stop();
 	return 0;
 }
@@ -205,34 +205,34 @@ void ee_Erase(void)
 	uint16_t i;
 	uint8_t buf[EE_SIZE];
 	
-	/* 仺 */
+	/* 填充缓冲区 */
 	for (i = 0; i < EE_SIZE; i++)
 	{
 		buf[i] = 0xFF;
 	}
 	
-	/* дEEPROM, ʼַ = 0ݳΪ 256 */
+	/* 写EEPROM, 起始地址 = 0，数据长度为 256 */
 	if (ee_WriteBytes(buf, 0, EE_SIZE) == 0)
 	{
-		printf("eeprom\r\n");
+		printf("擦除eeprom出错！\r\n");
 		return;
 	}
 	else
 	{
-		printf("eepromɹ\r\n");
+		printf("擦除eeprom成功！\r\n");
 	}
 }
 
 
 /*--------------------------------------------------------------------------------------------------*/
 
-static void ee_Delay(__IO uint32_t nCount)	 //򵥵ʱ
+static void ee_Delay(__IO uint32_t nCount)	 //简单的延时函数
 {
 	for(; nCount != 0; nCount--);
 }
 
 /*
- * eeprom AT24C02 д
+ * eeprom AT24C02 读写测试
  */
 void ee_Test(void)
 {
@@ -243,13 +243,13 @@ void ee_Test(void)
 /*-----------------------------------------------------------------------------------*/  
   if (ee_CheckOk() == 0)
 	{
-		/* ûм⵽EEPROM */
-		printf("ûм⵽EEPROM!\r\n");
+		/* 没有检测到EEPROM */
+		printf("没有检测到串行EEPROM!\r\n");
 				
-		while (1);	/* ͣ */
+		while (1);	/* 停机 */
 	}
 /*------------------------------------------------------------------------------------*/  
-  /* Ի */
+  /* 填充测试缓冲区 */
 	for (i = 0; i < EE_SIZE; i++)
 	{		
 		write_buf[i] = i;
@@ -257,25 +257,25 @@ void ee_Test(void)
 /*------------------------------------------------------------------------------------*/  
   if (ee_WriteBytes(write_buf, 0, EE_SIZE) == 0)
 	{
-		printf("дeeprom\r\n");
+		printf("写eeprom出错！\r\n");
 		return;
 	}
 	else
 	{		
-		printf("дeepromɹ\r\n");
+		printf("写eeprom成功！\r\n");
 	}
   
-  /*д֮ҪʵʱȥȻ*/
+  /*写完之后需要适当的延时再去读，不然会出错*/
   ee_Delay(0x0FFFFF);
 /*-----------------------------------------------------------------------------------*/
   if (ee_ReadBytes(read_buf, 0, EE_SIZE) == 0)
 	{
-		printf("eeprom\r\n");
+		printf("读eeprom出错！\r\n");
 		return;
 	}
 	else
 	{		
-		printf("eepromɹ£\r\n");
+		printf("读eeprom成功，数据如下：\r\n");
 	}
 /*-----------------------------------------------------------------------------------*/  
   for (i = 0; i < EE_SIZE; i++)
@@ -283,7 +283,7 @@ void ee_Test(void)
 		if(read_buf[i] != write_buf[i])
 		{
 			printf("0x%02X ", read_buf[i]);
-			printf(":EEPROMдݲһ");
+			printf("错误:EEPROM读出与写入的数据不一致");
 			return;
 		}
     printf(" %02X", read_buf[i]);
@@ -293,6 +293,6 @@ void ee_Test(void)
 			printf("\r\n");	
 		}		
 	}
-  printf("eepromдԳɹ\r\n");
+  printf("eeprom读写测试成功\r\n");
   while(1);
 }
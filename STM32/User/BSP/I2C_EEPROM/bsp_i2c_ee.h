@@ -13,14 +13,14 @@
  * 1 0 1 0 0  0  0  1 = 0XA1 
  */
 
-/* AT24C01/02ÿҳ8ֽ 
- * AT24C04/08A/16Aÿҳ16ֽ 
+/* AT24C01/02每页有8个字节 
+ * AT24C04/08A/16A每页有16个字节 
  */
 	
 
-#define EE_DEV_ADDR			0xA0		/* 24xx02豸ַ */
-#define EE_PAGE_SIZE		8			  /* 24xx02ҳС */
-#define EE_SIZE				256			  /* 24xx02 */
+#define EE_DEV_ADDR			0xA0		/* 24xx02的设备地址 */
+#define EE_PAGE_SIZE		8			  /* 24xx02的页面大小 */
+#define EE_SIZE				256			  /* 24xx02总容量 */
 
 
 uint8_t ee_CheckOk(void);
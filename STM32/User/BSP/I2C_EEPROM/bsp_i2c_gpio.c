@@ -4,20 +4,20 @@
   * @author  armfly 
   * @version V1.0
   * @date    2013-xx-xx
-  * @brief   gpioģi2c, STM32ϵCPUģ鲻Ӧò֡I2C߻
+  * @brief   用gpio模拟i2c总线, 适用于STM32系列CPU。该模块不包括应用层命令帧，仅包括I2C总线基本操作函数。
   ******************************************************************************
   * @attention
   *
-  * ʵƽ̨:Ұ ISO-MINI STM32  
-  * ̳    :http://www.firebbs.cn
-  * Ա    :https://fire-stm32.taobao.com
+  * 实验平台:野火 ISO-MINI STM32 开发板 
+  * 论坛    :http://www.firebbs.cn
+  * 淘宝    :https://fire-stm32.taobao.com
   *
   ******************************************************************************
   */ 
 
 /*
-	Ӧ˵
-	ڷI2C豸ǰȵ i2c_CheckDevice() I2C豸ǷúGPIO
+	应用说明：
+	在访问I2C设备前，请先调用 i2c_CheckDevice() 检测I2C设备是否正常，该函数会配置GPIO
 
 */
 
@@ -30,39 +30,39 @@
 
 /*
 *********************************************************************************************************
-*	  : i2c_Delay
-*	˵: I2Cλӳ٣400KHz
-*	    Σ
-*	  ֵ: 
+*	函 数 名: i2c_Delay
+*	功能说明: I2C总线位延迟，最快400KHz
+*	形    参：无
+*	返 回 值: 无
 *********************************************************************************************************
 */
 static void i2c_Delay(void)
 {
 	uint8_t i;
 
-	/*
-	 	ʱͨAX-Pro߼ǲԵõġ
-		CPUƵ72MHzʱڲFlash, MDK̲Ż
-		ѭΪ10ʱSCLƵ = 205KHz 
-		ѭΪ7ʱSCLƵ = 347KHz SCLߵƽʱ1.5usSCL͵ƽʱ2.87us 
-	 	ѭΪ5ʱSCLƵ = 421KHz SCLߵƽʱ1.25usSCL͵ƽʱ2.375us 
+	/*　
+	 	下面的时间是通过安富莱AX-Pro逻辑分析仪测试得到的。
+		CPU主频72MHz时，在内部Flash运行, MDK工程不优化
+		循环次数为10时，SCL频率 = 205KHz 
+		循环次数为7时，SCL频率 = 347KHz， SCL高电平时间1.5us，SCL低电平时间2.87us 
+	 	循环次数为5时，SCL频率 = 421KHz， SCL高电平时间1.25us，SCL低电平时间2.375us 
         
-    IAṞЧʸߣΪ7
+    IAR工程编译效率高，不能设置为7
 	*/
 	for (i = 0; i < 10; i++);
 }
 
 /*
 *********************************************************************************************************
-*	  : i2c_Start
-*	˵: CPUI2Cź
-*	    Σ
-*	  ֵ: 
+*	函 数 名: i2c_Start
+*	功能说明: CPU发起I2C总线启动信号
+*	形    参：无
+*	返 回 值: 无
 *********************************************************************************************************
 */
 void i2c_Start(void)
 {
-	/* SCLߵƽʱSDAһرʾI2Cź */
+	/* 当SCL高电平时，SDA出现一个下跳沿表示I2C总线启动信号 */
 	I2C_SDA_1();
 	I2C_SCL_1();
 	i2c_Delay();
@@ -74,15 +74,15 @@ void i2c_Start(void)
 
 /*
 *********************************************************************************************************
-*	  : i2c_Start
-*	˵: CPUI2Cֹͣź
-*	    Σ
-*	  ֵ: 
+*	函 数 名: i2c_Start
+*	功能说明: CPU发起I2C总线停止信号
+*	形    参：无
+*	返 回 值: 无
 *********************************************************************************************************
 */
 void i2c_Stop(void)
 {
-	/* SCLߵƽʱSDAһرʾI2Cֹͣź */
+	/* 当SCL高电平时，SDA出现一个上跳沿表示I2C总线停止信号 */
 	I2C_SDA_0();
 	I2C_SCL_1();
 	i2c_Delay();
@@ -91,17 +91,17 @@ void i2c_Stop(void)
 
 /*
 *********************************************************************************************************
-*	  : i2c_SendByte
-*	˵: CPUI2C豸8bit
-*	    Σ_ucByte  ȴ͵ֽ
-*	  ֵ: 
+*	函 数 名: i2c_SendByte
+*	功能说明: CPU向I2C总线设备发送8bit数据
+*	形    参：_ucByte ： 等待发送的字节
+*	返 回 值: 无
 *********************************************************************************************************
 */
 void i2c_SendByte(uint8_t _ucByte)
 {
 	uint8_t i;
 
-	/* ȷֽڵĸλbit7 */
+	/* 先发送字节的高位bit7 */
 	for (i = 0; i < 8; i++)
 	{		
 		if (_ucByte & 0x80)
@@ -118,19 +118,19 @@ void i2c_SendByte(uint8_t _ucByte)
 		I2C_SCL_0();
 		if (i == 7)
 		{
-			 I2C_SDA_1(); // ͷ
+			 I2C_SDA_1(); // 释放总线
 		}
-		_ucByte <<= 1;	/* һbit */
+		_ucByte <<= 1;	/* 左移一个bit */
 		i2c_Delay();
 	}
 }
 
 /*
 *********************************************************************************************************
-*	  : i2c_ReadByte
-*	˵: CPUI2C豸ȡ8bit
-*	    Σ
-*	  ֵ: 
+*	函 数 名: i2c_ReadByte
+*	功能说明: CPU从I2C总线设备读取8bit数据
+*	形    参：无
+*	返 回 值: 读到的数据
 *********************************************************************************************************
 */
 uint8_t i2c_ReadByte(void)
@@ -138,7 +138,7 @@ uint8_t i2c_ReadByte(void)
 	uint8_t i;
 	uint8_t value;
 
-	/* 1bitΪݵbit7 */
+	/* 读到第1个bit为数据的bit7 */
 	value = 0;
 	for (i = 0; i < 8; i++)
 	{
@@ -157,21 +157,21 @@ uint8_t i2c_ReadByte(void)
 
 /*
 *********************************************************************************************************
-*	  : i2c_WaitAck
-*	˵: CPUһʱӣȡACKӦź
-*	    Σ
-*	  ֵ: 0ʾȷӦ1ʾӦ
+*	函 数 名: i2c_WaitAck
+*	功能说明: CPU产生一个时钟，并读取器件的ACK应答信号
+*	形    参：无
+*	返 回 值: 返回0表示正确应答，1表示无器件响应
 *********************************************************************************************************
 */
 uint8_t i2c_WaitAck(void)
 {
 	uint8_t re;
 
-	I2C_SDA_1();	/* CPUͷSDA */
+	I2C_SDA_1();	/* CPU释放SDA总线 */
 	i2c_Delay();
-	I2C_SCL_1();	/* CPUSCL = 1, ʱ᷵ACKӦ */
+	I2C_SCL_1();	/* CPU驱动SCL = 1, 此时器件会返回ACK应答 */
 	i2c_Delay();
-	if (I2C_SDA_READ())	/* CPUȡSDA״̬ */
+	if (I2C_SDA_READ())	/* CPU读取SDA口线状态 */
 	{
 		re = 1;
 	}
@@ -186,36 +186,36 @@ uint8_t i2c_WaitAck(void)
 
 /*
 *********************************************************************************************************
-*	  : i2c_Ack
-*	˵: CPUһACKź
-*	    Σ
-*	  ֵ: 
+*	函 数 名: i2c_Ack
+*	功能说明: CPU产生一个ACK信号
+*	形    参：无
+*	返 回 值: 无
 *********************************************************************************************************
 */
 void i2c_Ack(void)
 {
-	I2C_SDA_0();	/* CPUSDA = 0 */
+	I2C_SDA_0();	/* CPU驱动SDA = 0 */
 	i2c_Delay();
-	I2C_SCL_1();	/* CPU1ʱ */
+	I2C_SCL_1();	/* CPU产生1个时钟 */
 	i2c_Delay();
 	I2C_SCL_0();
 	i2c_Delay();
-	I2C_SDA_1();	/* CPUͷSDA */
+	I2C_SDA_1();	/* CPU释放SDA总线 */
 }
 
 /*
 *********************************************************************************************************
-*	  : i2c_NAck
-*	˵: CPU1NACKź
-*	    Σ
-*	  ֵ: 
+*	函 数 名: i2c_NAck
+*	功能说明: CPU产生1个NACK信号
+*	形    参：无
+*	返 回 值: 无
 *********************************************************************************************************
 */
 void i2c_NAck(void)
 {
-	I2C_SDA_1();	/* CPUSDA = 1 */
+	I2C_SDA_1();	/* CPU驱动SDA = 1 */
 	i2c_Delay();
-	I2C_SCL_1();	/* CPU1ʱ */
+	I2C_SCL_1();	/* CPU产生1个时钟 */
 	i2c_Delay();
 	I2C_SCL_0();
 	i2c_Delay();	
@@ -223,49 +223,49 @@ void i2c_NAck(void)
 
 /*
 *********************************************************************************************************
-*	  : i2c_CfgGpio
-*	˵: I2CߵGPIOģIOķʽʵ
-*	    Σ
-*	  ֵ: 
+*	函 数 名: i2c_CfgGpio
+*	功能说明: 配置I2C总线的GPIO，采用模拟IO的方式实现
+*	形    参：无
+*	返 回 值: 无
 *********************************************************************************************************
 */
 void i2c_CfgGpio(void)
 {
 	GPIO_InitTypeDef GPIO_InitStructure;
 
-	RCC_APB2PeriphClockCmd(RCC_I2C_PORT, ENABLE);	/* GPIOʱ */
+	RCC_APB2PeriphClockCmd(RCC_I2C_PORT, ENABLE);	/* 打开GPIO时钟 */
 
 	GPIO_InitStructure.GPIO_Pin = I2C_SCL_PIN | I2C_SDA_PIN;
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;  	/* © */
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;  	/* 开漏输出 */
 	GPIO_Init(GPIO_PORT_I2C, &GPIO_InitStructure);
 
-	/* һֹͣź, λI2Cϵ豸ģʽ */
+	/* 给一个停止信号, 复位I2C总线上的所有设备到待机模式 */
 	i2c_Stop();
 }
 
 /*
 *********************************************************************************************************
-*	  : i2c_CheckDevice
-*	˵: I2C豸CPU豸ַȻȡ豸Ӧжϸ豸Ƿ
-*	    Σ_Address豸I2Cߵַ
-*	  ֵ: ֵ 0 ʾȷ 1ʾδ̽⵽
+*	函 数 名: i2c_CheckDevice
+*	功能说明: 检测I2C总线设备，CPU向发送设备地址，然后读取设备应答来判断该设备是否存在
+*	形    参：_Address：设备的I2C总线地址
+*	返 回 值: 返回值 0 表示正确， 返回1表示未探测到
 *********************************************************************************************************
 */
 uint8_t i2c_CheckDevice(uint8_t _Address)
 {
 	uint8_t ucAck;
 
-	i2c_CfgGpio();		/* GPIO */
+	i2c_CfgGpio();		/* 配置GPIO */
 
 	
-	i2c_Start();		/* ź */
+	i2c_Start();		/* 发送启动信号 */
 
-	/* 豸ַ+дbit0 = w 1 = r) bit7 ȴ */
+	/* 发送设备地址+读写控制bit（0 = w， 1 = r) bit7 先传 */
 	i2c_SendByte(_Address | I2C_WR);
-	ucAck = i2c_WaitAck();	/* 豸ACKӦ */
+	ucAck = i2c_WaitAck();	/* 检测设备的ACK应答 */
 
-	i2c_Stop();			/* ֹͣź */
+	i2c_Stop();			/* 发送停止信号 */
 
 	return ucAck;
 }
@@ -0,0 +1,116 @@
+#include "block.h"
+
+/*
+ * 签名取块内4个8x8子块的亮度均值：只用整块均值时，物体边缘移进一块的一两列
+ * 对均值影响太小，要累积几帧才超过门限，拖出残影；分成4块后灵敏度高4倍。
+ * 比较的是上次发出这一块时的签名，不是上一帧的，缓慢变化累积过门限后也会发出，
+ * 接收端的块与实际内容之差不会无限累积。
+ */
+
+/*一个像素的亮度，RGB565用(R5+G6+B5)*2近似，0~250*/
+static uint8_t Block_Luma(const uint8_t *p, uint8_t pix)
+{
+	uint16_t v;
+
+	if(pix == BLOCK_PIX_GRAY || pix == BLOCK_PIX_YUYV)
+		return p[0];
+	v = (p[0] << 8) | p[1];       /*高字节在前*/
+	return ((v >> 11) + ((v >> 5) & 0x3f) + (v & 0x1f)) << 1;
+}
+
+void PictureBlock_Sign(const uint8_t *p, uint16_t stride, uint8_t bw, uint8_t bh, uint8_t pix, uint8_t *sig)
+{
+	uint8_t bpp = BLOCK_BPP(pix);
+	uint8_t half = BLOCK_SIZE / 2;
+	uint16_t sum[BLOCK_SIG_LEN] = {0, 0, 0, 0};
+	uint16_t n[BLOCK_SIG_LEN] = {0, 0, 0, 0};
+	uint16_t *s;
+	uint16_t *c;
+	uint8_t x, y, i;
+	const uint8_t *q;
+
+	for(y = 0; y < bh; y++)
+	{
+		q = p + (uint32_t)y * stride;
+		s = sum + ((y >= half) ? 2 : 0);
+		c = n + ((y >= half) ? 2 : 0);
+		for(x = 0; x < bw && x < half; x++, q += bpp)
+			s[0] += Block_Luma(q, pix);
+		c[0] += x;
+		for(; x < bw; x++, q += bpp)
+			s[1] += Block_Luma(q, pix);
+		if(x > half)
+			c[1] += x - half;
+	}
+	for(i = 0; i < BLOCK_SIG_LEN; i++)
+		sig[i] = n[i] ? sum[i] / n[i] : 0;
+}
+
+uint8_t PictureBlock_Changed(const uint8_t *sig, const uint8_t *ref, uint8_t thresh)
+{
+	uint8_t i, d;
+
+	for(i = 0; i < BLOCK_SIG_LEN; i++)
+	{
+		d = (sig[i] > ref[i]) ? sig[i] - ref[i] : ref[i] - sig[i];
+		if(d > thresh)
+			return 1;
+	}
+	return 0;
+}
+
+uint16_t PictureBlock_Put(uint8_t *out, const uint8_t *p, uint16_t stride, uint8_t bx, uint8_t by,
+                          uint8_t bw, uint8_t bh, uint8_t bpp)
+{
+	uint16_t row = (uint16_t)bw * bpp;
+	uint16_t i;
+	uint8_t y;
+	uint8_t *o = out;
+
+	*o++ = bx;
+	*o++ = by;
+	for(y = 0; y < bh; y++)
+	{
+		for(i = 0; i < row; i++)
+			o[i] = p[i];
+		o += row;
+		p += stride;
+	}
+	return o - out;
+}
+
+uint16_t PictureBlock_Apply(const uint8_t *in, uint16_t len, uint8_t *frame, uint16_t width, uint16_t height, uint8_t bpp)
+{
+	const uint8_t *p = in + BLOCK_HEAD_LEN;
+	const uint8_t *end = in + len;
+	uint16_t n, i, bx, by, bw, bh, row, x0, y0, y;
+	uint8_t *f;
+
+	if(len < BLOCK_HEAD_LEN || in[0] != 0x55 || in[1] != 0xAA || in[2] != 'B')
+		return 0;
+	for(n = 0; n < in[3]; n++)
+	{
+		if(end - p < 2)
+			return 0;
+		bx = p[0];
+		by = p[1];
+		x0 = bx * BLOCK_SIZE;
+		y0 = by * BLOCK_SIZE;
+		if(x0 >= width || y0 >= height)
+			return 0;
+		bw = (width - x0 < BLOCK_SIZE) ? width - x0 : BLOCK_SIZE;
+		bh = (height - y0 < BLOCK_SIZE) ? height - y0 : BLOCK_SIZE;
+		row = bw * bpp;
+		p += 2;
+		if(end - p < (int32_t)row * bh)
+			return 0;
+		for(y = 0; y < bh; y++)
+		{
+			f = frame + ((uint32_t)(y0 + y) * width + x0) * bpp;
+			for(i = 0; i < row; i++)
+				f[i] = p[i];
+			p += row;
+		}
+	}
+	return (p == end) ? n : 0;
+}
@@ -0,0 +1,32 @@
+#ifndef __BLOCK_H
+#define __BLOCK_H
+
+#include <stdint.h>
+
+/*按16x16块的条件刷新：每块记一个签名，只发签名变化超过门限的块
+  块包：0x55 0xAA 'B' 块数，每块：块列 块行 块数据（逐行，与图像包同样的字节顺序）
+  帧结束包：0x55 0xAA 'E' 刷新标志 帧序号（32位，高字节在前）
+  右边、下边的块不足16像素时按实际大小*/
+#define BLOCK_SIZE				16
+#define BLOCK_HEAD_LEN			4
+#define BLOCK_END_LEN			8
+#define BLOCK_SIG_LEN			4		/*每块签名的字节数*/
+
+/*像素类型，取值与OV7725_FORMAT_xxx相同*/
+#define BLOCK_PIX_RGB565		0		/*2字节，签名用R+G+B*/
+#define BLOCK_PIX_YUYV			1		/*2字节，签名只用Y（偶数字节）*/
+#define BLOCK_PIX_GRAY			2		/*1字节*/
+
+#define BLOCK_BPP(pix)			(((pix) == BLOCK_PIX_GRAY) ? 1 : 2)
+
+/*求一块的签名：左上 右上 左下 右下4个子块的亮度均值，0~255*/
+void PictureBlock_Sign(const uint8_t *p, uint16_t stride, uint8_t bw, uint8_t bh, uint8_t pix, uint8_t *sig);
+/*签名与上次发出时相比，任一子块变化超过门限返回1*/
+uint8_t PictureBlock_Changed(const uint8_t *sig, const uint8_t *ref, uint8_t thresh);
+/*把一块写进块包（块列 块行 数据），返回写入的字节数*/
+uint16_t PictureBlock_Put(uint8_t *out, const uint8_t *p, uint16_t stride, uint8_t bx, uint8_t by,
+                          uint8_t bw, uint8_t bh, uint8_t bpp);
+/*把一个块包贴到整帧上，返回块数，包错误返回0；接收端和主机仿真用*/
+uint16_t PictureBlock_Apply(const uint8_t *in, uint16_t len, uint8_t *frame, uint16_t width, uint16_t height, uint8_t bpp);
+
+#endif
@@ -0,0 +1,228 @@
+#include "codec.h"
+
+/*
+ * 每个像素依次编R(5位) G(6位) B(5位)三个通道，各通道有自己的Rice参数状态。
+ * 预测：第1行用左边像素（行首用中间值），第2行用上、左、左上三个像素的中值预测（MED）。
+ * 残差按通道位数取模，折成无符号数后Rice编码：商用一元码（1...10），余数k位。
+ * k按本通道已编残差的平均值自适应，每包从同一初值开始。
+ */
+
+typedef struct
+{
+	uint16_t a;     /*残差累计*/
+	uint8_t  n;     /*残差个数*/
+}CODEC_CTX;
+
+typedef struct
+{
+	uint32_t acc;
+	uint8_t  bits;
+	uint8_t  *p;
+	uint8_t  *end;
+}BIT_WRITER;
+
+typedef struct
+{
+	uint32_t acc;
+	uint8_t  bits;
+	const uint8_t *p;
+	const uint8_t *end;
+}BIT_READER;
+
+static const uint8_t codec_bits[3] = {5, 6, 5};
+static const uint8_t codec_shift[3] = {11, 5, 0};
+
+#define CODEC_CTX_INIT(c)	do{ (c).a = 2; (c).n = 1; }while(0)
+
+/*Rice参数：使n*2^k >= a的最小k*/
+static uint8_t Codec_K(const CODEC_CTX *c, uint8_t bits)
+{
+	uint8_t k = 0;
+
+	while(((uint16_t)c->n << k) < c->a && k < bits)
+		k++;
+	return k;
+}
+
+static void Codec_Update(CODEC_CTX *c, uint16_t u)
+{
+	c->a += u;
+	if(++c->n == 32)
+	{
+		c->a >>= 1;
+		c->n >>= 1;
+	}
+}
+
+/*MED预测：左a 上b 左上c*/
+static uint8_t Codec_Med(uint8_t a, uint8_t b, uint8_t c)
+{
+	uint8_t mx = (a > b) ? a : b;
+	uint8_t mn = (a > b) ? b : a;
+
+	if(c >= mx)
+		return mn;
+	if(c <= mn)
+		return mx;
+	return a + b - c;
+}
+
+/*取第i个像素的通道ch*/
+#define CODEC_PIXEL(buf, i)		(((uint16_t)(buf)[(i) * 2] << 8) | (buf)[(i) * 2 + 1])
+#define CODEC_CH(p, ch)			(((p) >> codec_shift[ch]) & ((1u << codec_bits[ch]) - 1))
+
+static uint8_t Codec_Predict(const uint8_t *buf, uint16_t width, uint16_t i, uint8_t ch)
+{
+	uint16_t x = i % width;
+
+	if(i < width)
+		return x ? CODEC_CH(CODEC_PIXEL(buf, i - 1), ch) : (1u << (codec_bits[ch] - 1));
+	if(x == 0)
+		return CODEC_CH(CODEC_PIXEL(buf, i - width), ch);
+	return Codec_Med(CODEC_CH(CODEC_PIXEL(buf, i - 1), ch),
+	                 CODEC_CH(CODEC_PIXEL(buf, i - width), ch),
+	                 CODEC_CH(CODEC_PIXEL(buf, i - width - 1), ch));
+}
+
+/*写n位（n<=24），缓冲区满返回0*/
+static uint8_t Codec_Put(BIT_WRITER *w, uint32_t v, uint8_t n)
+{
+	w->acc = (w->acc << n) | v;
+	w->bits += n;
+	while(w->bits >= 8)
+	{
+		if(w->p >= w->end)
+			return 0;
+		w->bits -= 8;
+		*w->p++ = (uint8_t)(w->acc >> w->bits);
+	}
+	return 1;
+}
+
+uint16_t PictureCodec_Encode(const uint8_t *in, uint16_t width, uint8_t *out, uint16_t out_max)
+{
+	BIT_WRITER w;
+	CODEC_CTX ctx[3];
+	uint16_t raw_len = width * 4;
+	uint16_t i, p, u, q;
+	uint8_t ch, bits, k, v, e;
+	int8_t s;
+
+	if(out_max > raw_len - 1)
+		out_max = raw_len - 1;      /*不比原始小就不压*/
+	if(out_max <= CODEC_HEAD_LEN)
+		return 0;
+	out[0] = 0x55;
+	out[1] = 0xAA;
+	out[2] = 'C';
+	out[3] = 0;                     /*OV7725_FORMAT_RGB565*/
+	out[4] = raw_len >> 8;
+	out[5] = raw_len & 0xff;
+	w.acc = 0;
+	w.bits = 0;
+	w.p = out + CODEC_HEAD_LEN;
+	w.end = out + out_max;
+	for(ch = 0; ch < 3; ch++)
+		CODEC_CTX_INIT(ctx[ch]);
+
+	for(i = 0; i < width * 2; i++)
+	{
+		p = CODEC_PIXEL(in, i);
+		for(ch = 0; ch < 3; ch++)
+		{
+			bits = codec_bits[ch];
+			v = CODEC_CH(p, ch);
+			e = (v - Codec_Predict(in, width, i, ch)) & ((1u << bits) - 1);
+			s = (e & (1u << (bits - 1))) ? (int8_t)(e - (1u << bits)) : (int8_t)e;
+			u = (s >= 0) ? (uint16_t)(s * 2) : (uint16_t)(-s * 2 - 1);
+			k = Codec_K(&ctx[ch], bits);
+			q = u >> k;
+			if(q < CODEC_QMAX)
+			{
+				/*q个1、1个0、k位余数一次写出*/
+				if(!Codec_Put(&w, ((((uint32_t)1 << (q + 1)) - 2) << k) | (u & ((1u << k) - 1)), q + 1 + k))
+					return 0;
+			}
+			else
+			{
+				if(!Codec_Put(&w, ((uint32_t)1 << CODEC_QMAX) - 1, CODEC_QMAX) || !Codec_Put(&w, u, bits))
+					return 0;
+			}
+			Codec_Update(&ctx[ch], u);
+		}
+	}
+	if(w.bits && !Codec_Put(&w, 0, 8 - w.bits))
+		return 0;
+	return (uint16_t)(w.p - out);
+}
+
+/*读n位（n<=16），码流不够返回0*/
+static uint8_t Codec_Get(BIT_READER *r, uint16_t *v, uint8_t n)
+{
+	while(r->bits < n)
+	{
+		if(r->p >= r->end)
+			return 0;
+		r->acc = (r->acc << 8) | *r->p++;
+		r->bits += 8;
+	}
+	r->bits -= n;
+	*v = (r->acc >> r->bits) & ((1u << n) - 1);
+	return 1;
+}
+
+uint16_t PictureCodec_Decode(const uint8_t *in, uint16_t len, uint16_t width, uint8_t *out)
+{
+	BIT_READER r;
+	CODEC_CTX ctx[3];
+	uint16_t raw_len = width * 4;
+	uint16_t i, p, u, q, b;
+	uint8_t ch, bits, k, v;
+	int8_t s;
+
+	if(len < CODEC_HEAD_LEN || in[0] != 0x55 || in[1] != 0xAA || in[2] != 'C' || in[3] != 0
+	   || ((in[4] << 8) | in[5]) != raw_len)
+		return 0;
+	r.acc = 0;
+	r.bits = 0;
+	r.p = in + CODEC_HEAD_LEN;
+	r.end = in + len;
+	for(ch = 0; ch < 3; ch++)
+		CODEC_CTX_INIT(ctx[ch]);
+
+	for(i = 0; i < width * 2; i++)
+	{
+		p = 0;
+		for(ch = 0; ch < 3; ch++)
+		{
+			bits = codec_bits[ch];
+			k = Codec_K(&ctx[ch], bits);
+			for(q = 0; q < CODEC_QMAX; q++)
+			{
+				if(!Codec_Get(&r, &b, 1))
+					return 0;
+				if(!b)
+					break;
+			}
+			if(q == CODEC_QMAX)
+			{
+				if(!Codec_Get(&r, &u, bits))
+					return 0;
+			}
+			else
+			{
+				if(k && !Codec_Get(&r, &b, k))
+					return 0;
+				u = (q << k) | (k ? b : 0);
+			}
+			Codec_Update(&ctx[ch], u);
+			s = (u & 1) ? -(int8_t)((u + 1) >> 1) : (int8_t)(u >> 1);
+			/*预测用到的像素都已解出；当前像素还没写，通道在p中拼好后一起写*/
+			v = (Codec_Predict(out, width, i, ch) + s) & ((1u << bits) - 1);
+			p |= (uint16_t)v << codec_shift[ch];
+		}
+		out[i * 2] = p >> 8;
+		out[i * 2 + 1] = p & 0xff;
+	}
+	return raw_len;
+}
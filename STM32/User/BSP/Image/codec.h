@@ -0,0 +1,17 @@
+#ifndef __CODEC_H
+#define __CODEC_H
+
+#include <stdint.h>
+
+/*RGB565一包（2行）无损压缩：逐通道预测 + 自适应Rice编码
+  压缩包：0x55 0xAA 'C' 格式 原始字节数（16位，高字节在前） 码流
+  每包单独编码，预测和Rice参数都不跨包，丢包不影响其它包*/
+#define CODEC_HEAD_LEN			6
+#define CODEC_QMAX				16		/*商达到QMAX时直接写原值*/
+
+/*压缩一包RGB565数据（高字节在前），压缩后不比原始小时返回0，调用者发原始数据*/
+uint16_t PictureCodec_Encode(const uint8_t *in, uint16_t width, uint8_t *out, uint16_t out_max);
+/*解压一包，返回原始字节数，码流错误返回0；接收端和主机测试用*/
+uint16_t PictureCodec_Decode(const uint8_t *in, uint16_t len, uint16_t width, uint8_t *out);
+
+#endif
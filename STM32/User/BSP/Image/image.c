@@ -1,54 +1,1347 @@
 #include "image.h"
 
-/*ʼ*/
-void InitQueue(Queue Q)
+OS_SEM picture_free_sem;      /*发送任务每发完一格、或包缓冲还回分区时释放一次，队列满时采集任务在此等待*/
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+OS_SEM picture_ready_sem;     /*队列由空变为非空时释放，发送任务队列空时在此等待*/
+OS_MEM picture_mem;           /*包缓冲分区*/
+PICTURE_BUF_STAT picture_buf_stat;
+static __align(4) PICTURE_BUF picture_buf_pool[APP_CFG_PICTURE_BUF_COUNT];   /*按字对齐，块大小也是4的倍数*/
+static PICTURE_RING picture_ring;
+#endif
+uint8_t picture_latest = 0;   /*1：最新帧优先，FIFO中有更新的帧时放弃正在读的帧*/
+PICTURE_LATEST_STAT picture_latest_stat;
+uint8_t picture_bin = 1;      /*读出时缩小的倍数（1、2、4），发送的图像为窗口的1/bin*/
+uint8_t picture_test = PICTURE_TEST_OFF;   /*测试图案，PICTURE_TEST_xxx*/
+#if (APP_CFG_PICTURE_CODEC_EN == DEF_ENABLED)
+uint8_t picture_codec = 0;     /*1：RGB565图像包压缩后发送*/
+PICTURE_CODEC_STAT picture_codec_stat;   /*压缩统计，可在调试器中查看*/
+#endif
+#if (PICTURE_BAND_EN == DEF_ENABLED)
+#define PICTURE_BAND_LINES		16      /*带缓冲的行数：一行块（BLOCK_SIZE），或彩色JPEG的一行MCU*/
+#define PICTURE_BAND_LEN		(PICTURE_LINE_MAX * PICTURE_BAND_LINES)
+
+static uint8_t *picture_band;  /*带缓冲，按块刷新和JPEG共用，从堆中申请*/
+#endif
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+uint8_t picture_block = 0;     /*1：按16x16块条件刷新，下一帧开始生效*/
+PICTURE_BLOCK_STAT picture_block_stat;   /*按块刷新统计，可在调试器中查看*/
+
+#define PICTURE_BLOCK_MAX		((640 / BLOCK_SIZE) * (480 / BLOCK_SIZE))
+
+/*按块刷新的状态：读出的行先存进带缓冲，存满BLOCK_SIZE行（一带）再逐块比较签名后发出*/
+typedef struct
+{
+	uint8_t  active;                        /*1：本帧按块发送*/
+	uint8_t  refresh;                       /*1：本帧整帧按原始包发出，只更新签名*/
+	uint8_t  pix;                           /*BLOCK_PIX_xxx*/
+	uint8_t  bpp;
+	uint16_t width;                         /*发送的图像宽高（缩小后），变了就整帧刷新*/
+	uint16_t height;
+	uint16_t line_len;                      /*一行的字节数*/
+	uint16_t line;                          /*本帧已存入的行数*/
+	uint16_t band_y;                        /*当前带第一行*/
+	uint8_t  band_lines;                    /*当前带已存入的行数*/
+	uint8_t  cols;                          /*每带的块数*/
+	uint16_t next;                          /*当前带下一个要比较的块，刷新帧为下一包*/
+	uint16_t frames;                        /*距上次整帧刷新的帧数，0为下一帧刷新*/
+	uint8_t  *sig;                          /*每块上次发出时的签名，BLOCK_SIG_LEN字节*/
+}PICTURE_BLOCK_CTX;
+
+static PICTURE_BLOCK_CTX picture_blk;
+#endif
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+uint8_t picture_jpeg = 0;      /*JPEG质量1~100，0为不用JPEG，下一帧开始生效*/
+PICTURE_JPEG_STAT picture_jpeg_stat;     /*JPEG统计，可在调试器中查看*/
+
+#define PICTURE_JPEG_PAYLOAD	(PICTURE_PACKET_MAX - PICTURE_JPEG_HEAD_LEN)
+
+/*JPEG的状态：读出的行存进带缓冲，存满一行MCU后逐个MCU编码，码流攒够一包就发
+  一个MCU编码后可能跨两包，多出的部分留在out中接到下一包*/
+typedef struct
+{
+	uint8_t  active;                        /*1：本帧按JPEG发送*/
+	uint8_t  ended;                         /*1：EOI已写进out*/
+	uint8_t  lines;                         /*每带行数，即MCU高度*/
+	uint8_t  band_lines;                    /*当前带已存入的行数*/
+	uint16_t width;                         /*发送的图像宽高（缩小后）*/
+	uint16_t height;
+	uint16_t line_len;                      /*一行的字节数*/
+	uint16_t line;                          /*本帧已存入的行数*/
+	uint16_t x;                             /*当前带下一个MCU的左边列*/
+	uint16_t frame;                         /*帧号，写进包头*/
+	uint16_t index;                         /*本帧下一包的序号*/
+	uint16_t fill;                          /*out中已编码、未发出的字节数*/
+	JPEG_ENC *enc;                          /*编码器，从堆中申请*/
+	uint8_t  *out;                          /*码流缓冲，一包数据加一个MCU*/
+}PICTURE_JPEG_CTX;
+
+static PICTURE_JPEG_CTX picture_jpg;
+#endif
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED)
+uint8_t picture_prog = 0;      /*1：渐进传输，下一帧开始生效*/
+PICTURE_PROG_STAT picture_prog_stat;     /*渐进传输统计，可在调试器中查看*/
+
+#define PICTURE_PROG_PAYLOAD	(PICTURE_PACKET_MAX - PICTURE_PROG_HEAD_LEN)
+
+/*各遍的格点：x起点 x步长 y起点 y步长
+  第0遍每2x2取左上一点，第1遍补偶数行的奇数列，第2遍补全部奇数行*/
+static const uint8_t picture_prog_grid[PICTURE_PROG_PASSES][4] =
+{
+	{0, 2, 0, 2},
+	{1, 2, 0, 2},
+	{0, 1, 1, 2},
+};
+
+/*渐进传输的状态：FIFO中这一帧每遍从头重读一次，只取本遍格点上的像素，其余行空读跳过*/
+typedef struct
+{
+	uint8_t  active;                        /*1：本帧渐进发送*/
+	uint8_t  pass;                          /*当前遍，PICTURE_PROG_PASSES为本帧已发完*/
+	uint8_t  bpp;
+	uint16_t width;
+	uint16_t height;
+	uint16_t row;                           /*本遍下一个要发的行*/
+	uint16_t line;                          /*FIFO读指针所在的行*/
+	uint16_t frame;                         /*帧号，写进包头*/
+	CPU_TS   ts;                            /*本帧开始的时刻*/
+}PICTURE_PROG_CTX;
+
+static PICTURE_PROG_CTX picture_prg;
+#endif
+#if (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+uint8_t picture_fovea = 0;     /*ROI外的缩小倍数2或4，0为不用，下一帧开始生效*/
+PICTURE_FOVEA_ROI picture_fovea_roi = {96, 72, 128, 96};   /*ROI，窗口内坐标，每帧开始时对齐、限制到窗口内*/
+PICTURE_FOVEA_STAT picture_fovea_stat;   /*区域加权统计，可在调试器中查看*/
+
+#define PICTURE_FOVEA_PAYLOAD	(PICTURE_PACKET_MAX - PICTURE_FOVEA_HEAD_LEN)
+
+/*区域加权的状态：每次读scale行（一条），合并成一行，ROI的行范围内同时留下ROI的原始像素*/
+typedef struct
+{
+	uint8_t  active;                        /*1：本帧按区域加权发送*/
+	uint8_t  scale;                         /*ROI外的缩小倍数*/
+	uint8_t  bpp;
+	uint16_t width;
+	uint16_t height;
+	uint16_t y;                             /*下一条的第一行*/
+	uint16_t frame;                         /*帧号，写进包头*/
+	PICTURE_FOVEA_ROI roi;                  /*本帧实际用的ROI*/
+}PICTURE_FOVEA_CTX;
+
+static PICTURE_FOVEA_CTX picture_fov;
+#endif
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+uint8_t picture_stats_on = 0;  /*1：读出时统计，每帧后发统计包，下一帧开始生效*/
+PICTURE_STATS picture_stats;   /*当前帧的统计，可在调试器中查看*/
+#endif
+
+/*合成测试图案的8条竖彩条：白 黄 青 绿 品红 红 蓝 黑*/
+static const uint16_t test_bar_rgb565[8] = {0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000};
+static const uint8_t test_bar_rgb332[8] = {0xFF, 0xFC, 0x1F, 0x1C, 0xE3, 0xE0, 0x03, 0x00};
+static const uint8_t test_bar_yuv[8][3] =   /*Y U V，BT.601全范围*/
+{
+	{255, 128, 128}, {226,   0, 149}, {179, 170,   0}, {150,  44,  21},
+	{105, 212, 235}, { 76,  85, 255}, { 29, 255, 107}, {  0, 128, 128},
+};
+
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+/*申请包缓冲，引用计数为1；分区空返回NULL并计入fail，可在任务和中断中调用*/
+PICTURE_BUF *PictureBufAlloc(void)
+{
+	OS_ERR err;
+	PICTURE_BUF *buf;
+	CPU_SR_ALLOC();
+
+	buf = (PICTURE_BUF *)OSMemGet(&picture_mem, &err);
+	CPU_CRITICAL_ENTER();
+	if(buf == NULL)
+	{
+		picture_buf_stat.fail++;
+	}
+	else
+	{
+		buf->refs = 1;
+		buf->len = 0;
+		picture_buf_stat.alloc++;
+		picture_buf_stat.used++;
+		if(picture_buf_stat.used > picture_buf_stat.peak)
+			picture_buf_stat.peak = picture_buf_stat.used;
+	}
+	CPU_CRITICAL_EXIT();
+	return buf;
+}
+
+/*多一个持有者（重传缓存、预览等），用完后各自调用PictureBufFree()*/
+void PictureBufRef(PICTURE_BUF *buf)
+{
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	buf->refs++;
+	picture_buf_stat.shared++;
+	CPU_CRITICAL_EXIT();
+}
+
+/*少一个持有者，最后一个释放时还回分区，返回1；不唤醒采集任务*/
+static uint8_t PictureBufPut(PICTURE_BUF *buf)
+{
+	OS_ERR err;
+	uint8_t refs;
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	refs = --buf->refs;
+	if(refs == 0)
+		picture_buf_stat.used--;
+	CPU_CRITICAL_EXIT();
+	if(refs != 0)
+		return 0;
+	OSMemPut(&picture_mem, buf, &err);
+	return 1;
+}
+
+/*少一个持有者，最后一个释放时还回分区并唤醒等待的采集任务，返回1*/
+uint8_t PictureBufFree(PICTURE_BUF *buf)
+{
+	OS_ERR err;
+
+	if(!PictureBufPut(buf))
+		return 0;
+	OSSemPost(&picture_free_sem, OS_OPT_POST_1, &err);
+	return 1;
+}
+
+/*初始化队列和包缓冲分区*/
+void PictureRingInit(void)
+{
+	OS_ERR err;
+
+	OSMemCreate((OS_MEM       *)&picture_mem,    //内存分区控制块
+	            (CPU_CHAR     *)"picture mem",   //命名内存分区
+	            (void         *)picture_buf_pool,   //内存分区首地址
+	            (OS_MEM_QTY    )APP_CFG_PICTURE_BUF_COUNT,   //内存块数目
+	            (OS_MEM_SIZE   )sizeof(PICTURE_BUF), //内存块大小（单位：字节）
+	            (OS_ERR       *)&err);
+	picture_ring.head = 0;
+	picture_ring.tail = 0;
+	picture_ring.pending = NULL;
+	picture_ring.epoch = 0;
+	OSSemCreate(&picture_free_sem, "picture free sem", 0, &err);
+	OSSemCreate(&picture_ready_sem, "picture ready sem", 0, &err);
+}
+
+/*队列中已提交、未发完的包数，两个任务都可以调用*/
+uint8_t PictureRingCount(void)
+{
+	return (uint8_t)(picture_ring.head - picture_ring.tail);
+}
+
+/*生产者：取下一个空格并申请包缓冲，队列满或分区空（块被其它持有者占着）返回NULL
+  提交前可反复调用，得到的是同一块*/
+uint8_t *PictureRingReserve(void)
+{
+	if(picture_ring.head - picture_ring.tail >= PictureMaxSize)
+		return NULL;
+	if(picture_ring.pending == NULL)
+	{
+		picture_ring.pending = PictureBufAlloc();
+		if(picture_ring.pending == NULL)
+			return NULL;
+	}
+	return picture_ring.pending->data;
+}
+
+/*生产者：提交PictureRingReserve()取到的包缓冲，队列持有它的一个引用
+  图像包keep为0，记下当前代号；参数包、统计包等keep为1，放弃帧时也要发
+  发布head后队列里只有这一包，说明发送任务可能在等，唤醒它*/
+void PictureRingCommit(uint16 len, uint8_t keep)
+{
+	OS_ERR err;
+	uint32_t head = picture_ring.head;
+
+	picture_ring.pending->len = len;
+	picture_ring.pending->epoch = keep ? PICTURE_EPOCH_KEEP : picture_ring.epoch;
+	picture_ring.slot[head & (PictureMaxSize - 1)] = picture_ring.pending;
+	picture_ring.pending = NULL;
+	__DMB();                    /*包内数据（含DMA写入的）、包长、格内指针写完后才发布head*/
+	picture_ring.head = head + 1;
+	__DMB();                    /*head写出后再读tail，与交还时配对，双方不会都读到旧值而漏唤醒发送任务*/
+	if(picture_ring.tail == head)
+		OSSemPost(&picture_ready_sem, OS_OPT_POST_1, &err);
+}
+
+/*消费者：交还最早的一格，放掉队列的引用，不唤醒采集任务*/
+static void PictureRingAdvance(void)
+{
+	uint32_t tail = picture_ring.tail;
+	PICTURE_BUF *buf = picture_ring.slot[tail & (PictureMaxSize - 1)];
+
+	__DMB();                    /*包内数据读完（已写进W5500）后才交还*/
+	picture_ring.tail = tail + 1;
+	__DMB();                    /*tail写出后再读head，与提交时配对*/
+	PictureBufPut(buf);
+}
+
+/*消费者：取最早提交的包，队列空返回NULL；发完后调用PictureRingRelease()
+  重传缓存、预览等要在交还后继续用的，先PictureBufRef()
+  放弃的帧留在队列中的图像包（代号不是当前代号）直接交还，不发；
+  跳过的一批交还完只唤醒采集任务一次*/
+PICTURE_BUF *PictureRingPeek(void)
+{
+	uint32_t tail;
+	PICTURE_BUF *buf;
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+	OS_ERR err;
+	uint8_t dropped = 0;
+#endif
+
+	for(;;)
+	{
+		tail = picture_ring.tail;
+		if(picture_ring.head == tail)
+		{
+			buf = NULL;
+			break;
+		}
+		__DMB();                /*先看到head，再读格内指针和包内数据*/
+		buf = picture_ring.slot[tail & (PictureMaxSize - 1)];
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+		if(buf->epoch != PICTURE_EPOCH_KEEP && buf->epoch != picture_ring.epoch)
+		{
+			picture_latest_stat.packets++;
+			PictureRingAdvance();
+			dropped = 1;
+			continue;
+		}
+#endif
+		break;
+	}
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED)
+	if(dropped)
+		OSSemPost(&picture_free_sem, OS_OPT_POST_1, &err);
+#endif
+	return buf;
+}
+
+/*消费者：交还PictureRingPeek()取到的包，放掉队列的引用，唤醒等待空格的采集任务
+  块还有其它持有者、没回分区时，空出的格也要通知*/
+void PictureRingRelease(void)
+{
+	OS_ERR err;
+
+	PictureRingAdvance();
+	OSSemPost(&picture_free_sem, OS_OPT_POST_1, &err);
+}
+#endif
+
+/*采集任务：FIFO中已有更新的帧，正在读的帧不读完了（读指针由调用者移到帧尾）
+  队列发送时队列中这一帧及更早的图像包作废；按块刷新时作废的包里可能有块更新，下一帧整帧刷新*/
+void PictureFrameAbandon(uint8_t queued)
 {
-	if(Q == NULL)
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+	uint8_t epoch;
+
+	if(queued)
 	{
-		printf("Q is NULL\n");
+		epoch = picture_ring.epoch + 1;
+		if(epoch == PICTURE_EPOCH_KEEP)
+			epoch = 0;
+		picture_ring.epoch = epoch;
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+		picture_blk.frames = 0;
+#endif
+	}
+#else
+	(void)queued;
+#endif
+	picture_latest_stat.frames++;
+}
+
+extern OV7725_MODE_PARAM cam_mode;
+
+PICTURE_PACKING picture_pack;  /*当前的打包方式，图像参数包里的包长即picture_pack.len*/
+
+/*按当前窗口、格式、缩小倍数和打开的功能定打包方式，发图像参数包时和每帧开始时调用
+  原始数据不缩小时按字节打包：一包PICTURE_PACKET_MAX字节，行可以跨包，只有一帧的最后一包较短
+  缩小、RGB332要按行处理，一包装尽量多的整行（RGB332为4的倍数，抖动相位各包相同），包长取4的倍数
+  压缩、按块刷新、JPEG的编码按2行一包，仍是2行；一帧的字节数不是4的倍数（奇数行高）时也按2行，各包都按字读出*/
+void PicturePackingSet(void)
+{
+	uint16 w = cam_mode.cam_width / picture_bin;
+	uint16 h = cam_mode.cam_height / picture_bin;
+	uint8_t bpp = (cam_mode.format == OV7725_FORMAT_GRAY || cam_mode.format == OV7725_FORMAT_RGB332) ? 1 : 2;
+
+	picture_pack.line_len = w * bpp;
+	picture_pack.frame_len = (uint32_t)picture_pack.line_len * h;
+	if(PictureCodecActive() || PictureBlockActive() || PictureJpegActive() || (picture_pack.frame_len & 3))
+	{
+		picture_pack.lines = 2;
+	}
+	else if(picture_bin > 1 || cam_mode.format == OV7725_FORMAT_RGB332)
+	{
+		picture_pack.lines = PICTURE_PACKET_MAX / picture_pack.line_len;
+		if(cam_mode.format == OV7725_FORMAT_RGB332)
+			picture_pack.lines &= ~3;
+		if(picture_pack.lines > h)
+			picture_pack.lines = h;
+		if(picture_pack.line_len & 2)
+			picture_pack.lines &= ~1;       //缩小后的灰度行长可能不是4的倍数，取偶数行使包长是4的倍数
+	}
+	else
+	{
+		picture_pack.lines = 0;
+		picture_pack.len = (picture_pack.frame_len < PICTURE_PACKET_MAX) ? picture_pack.frame_len : PICTURE_PACKET_MAX;
+	}
+	if(picture_pack.lines)
+		picture_pack.len = picture_pack.lines * picture_pack.line_len;
+	picture_pack.packets = (picture_pack.frame_len + picture_pack.len - 1) / picture_pack.len;
+}
+
+/*一包（非最后一包）的字节数*/
+uint16 PicturePacketLen(void)
+{
+	return picture_pack.len;
+}
+
+/*第index包的字节数，最后一包是一帧剩下的部分*/
+uint16 PicturePacketSize(uint16 index)
+{
+	uint32_t pos = (uint32_t)index * picture_pack.len;
+
+	if(pos + picture_pack.len > picture_pack.frame_len)
+		return (uint16)(picture_pack.frame_len - pos);
+	return picture_pack.len;
+}
+
+/*前packets包从FIFO读出的字节数，放弃一帧时用来算剩下的字节数
+  整行打包时每包读lines*bin行原始数据；按字节打包时不缩小，灰度FIFO中为YUYV，每像素2字节
+  最后一包较短，包括最后一包时即FIFO中的一帧*/
+uint32_t PictureFifoOffset(uint16 packets)
+{
+	uint32_t frame = (uint32_t)cam_mode.cam_width * cam_mode.cam_height * 2;
+	uint32_t off;
+
+	if(picture_pack.lines)
+		off = (uint32_t)packets * picture_pack.lines * picture_bin * cam_mode.cam_width * 2;
+	else if(cam_mode.format == OV7725_FORMAT_GRAY)
+		off = (uint32_t)packets * picture_pack.len * 2;
+	else
+		off = (uint32_t)packets * picture_pack.len;
+	return (off < frame) ? off : frame;
+}
+
+/*按给定的行宽、格式、缩小倍数，一行是否放得下
+  压缩、按块刷新、JPEG一包2行，带缓冲每行PICTURE_LINE_MAX字节，都要放得下
+  RGB565、YUV422每像素2字节，灰度1字节；RGB332每像素1字节，但FIFO中仍是RGB565，同样按2字节算*/
+uint8_t PictureFits(uint16 width, uint8_t format, uint8_t bin)
+{
+	uint32_t len = (uint32_t)width / bin;
+
+	if(format != OV7725_FORMAT_GRAY)
+		len *= 2;
+	return len <= PICTURE_LINE_MAX;
+}
+
+/*设置缩小倍数，在帧间隙调用
+  每包要读2*factor行，窗口宽需为2*factor的倍数、高需为2*factor的倍数；YUV422、RGB332不支持*/
+ErrorStatus PictureBinSet(uint8_t factor)
+{
+	if(factor != 1 && factor != 2 && factor != 4)
+		return ERROR;
+	if(factor > 1 && (cam_mode.format == OV7725_FORMAT_YUV422 || cam_mode.format == OV7725_FORMAT_RGB332
+	   || cam_mode.cam_width > 640
+	   || cam_mode.cam_width % (2 * factor) || cam_mode.cam_height % (2 * factor)))
+		return ERROR;
+	picture_bin = factor;
+	return SUCCESS;
+}
+
+/*按当前cam_mode填写图像参数包，窗口改变或开始传输时发给接收端*/
+void PictureInfoPack(uint8_t *buf)
+{
+	buf[0] = 0x55;
+	buf[1] = 0xAA;
+	buf[2] = 'W';
+	buf[3] = cam_mode.format;
+	buf[4] = (cam_mode.cam_width / picture_bin) >> 8;
+	buf[5] = (cam_mode.cam_width / picture_bin) & 0xff;
+	buf[6] = (cam_mode.cam_height / picture_bin) >> 8;
+	buf[7] = (cam_mode.cam_height / picture_bin) & 0xff;
+	buf[8] = cam_mode.cam_sx >> 8;
+	buf[9] = cam_mode.cam_sx & 0xff;
+	buf[10] = cam_mode.cam_sy >> 8;
+	buf[11] = cam_mode.cam_sy & 0xff;
+	buf[12] = picture_test;
+	buf[13] = picture_bin;
+	buf[14] = OV7725_FPS_BASE / (cam_mode.clk_div + 1);
+	buf[15] = 0;
+	PicturePackingSet();
+	buf[16] = picture_pack.len >> 8;
+	buf[17] = picture_pack.len & 0xff;
+#if (APP_CFG_PICTURE_CODEC_EN == DEF_ENABLED)
+	if(picture_codec)
+		buf[15] |= PICTURE_INFO_CODEC;
+#endif
+	if(PictureBlockActive())
+		buf[15] |= PICTURE_INFO_BLOCK;
+	if(PictureJpegActive())
+		buf[15] |= PICTURE_INFO_JPEG;
+	if(PictureProgActive())
+		buf[15] |= PICTURE_INFO_PROG;
+	if(PictureFoveaActive())
+		buf[15] |= PICTURE_INFO_FOVEA;
+}
+
+/*合成测试图案的一包，返回字节数
+  内容为当前格式、缩小后宽度的8条竖彩条，按包在帧中的位置取（行可以跨包），前8字节改为
+  帧序号(4) 包序号(2) 包序号取反(2)，高字节在前；接收端按同样规则生成后逐字节比较*/
+uint16 PictureTestPack(uint8_t *buf, uint32_t seq, uint16_t index)
+{
+	uint16 len = PicturePacketSize(index);
+	uint16 w = cam_mode.cam_width / picture_bin;
+	uint8_t bpp = (cam_mode.format == OV7725_FORMAT_GRAY || cam_mode.format == OV7725_FORMAT_RGB332) ? 1 : 2;
+	uint16 line_len = w * bpp;
+	uint16 i, pos, x;
+	uint8_t bar;
+
+	pos = (uint16)((uint32_t)index * picture_pack.len % line_len);
+	for(i = 0; i < len; i++, pos++)
+	{
+		if(pos == line_len)
+			pos = 0;
+		x = pos / bpp;
+		bar = (uint8_t)((uint32_t)x * 8 / w);
+		if(cam_mode.format == OV7725_FORMAT_RGB565)
+			buf[i] = (pos & 1) ? (test_bar_rgb565[bar] & 0xff) : (test_bar_rgb565[bar] >> 8);
+		else if(cam_mode.format == OV7725_FORMAT_YUV422)
+			buf[i] = (pos & 1) ? test_bar_yuv[bar][(x & 1) ? 2 : 1] : test_bar_yuv[bar][0];
+		else if(cam_mode.format == OV7725_FORMAT_RGB332)
+			buf[i] = test_bar_rgb332[bar];
+		else
+			buf[i] = test_bar_yuv[bar][0];
+	}
+	if(len >= 8)
+	{
+		buf[0] = seq >> 24;
+		buf[1] = seq >> 16;
+		buf[2] = seq >> 8;
+		buf[3] = seq;
+		buf[4] = index >> 8;
+		buf[5] = index;
+		buf[6] = ~index >> 8;
+		buf[7] = ~index;
+	}
+	return len;
+}
+
+static void PicturePutU32(uint8_t *buf, uint32_t v)
+{
+	buf[0] = v >> 24;
+	buf[1] = v >> 16;
+	buf[2] = v >> 8;
+	buf[3] = v;
+}
+
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+/*一帧开始前调用，清零统计，并决定本帧是否统计*/
+void PictureStatsBegin(void)
+{
+	uint8_t i;
+
+	picture_stats.active = picture_stats_on;
+	picture_stats.packet = 0;
+	picture_stats.pixels = 0;
+	picture_stats.min = 255;
+	picture_stats.max = 0;
+	picture_stats.sum[0] = picture_stats.sum[1] = picture_stats.sum[2] = 0;
+	for(i = 0; i < PICTURE_STATS_BINS; i++)
+		picture_stats.hist[i] = 0;
+	picture_stats.cycles = 0;
+}
+
+/*每读一包前调用，返回1表示这一包要统计
+  每APP_CFG_PICTURE_STATS_STEP包统计1包，限制每帧多花的周期数*/
+uint8_t PictureStatsTake(void)
+{
+	if(!picture_stats.active)
+		return 0;
+	return (picture_stats.packet++ % APP_CFG_PICTURE_STATS_STEP) == 0;
+}
+
+/*统计一包读出的数据（缩小后或只留Y后的数据，格式同发送的包）
+  亮度直方图、各通道和、亮度最小最大值：
+  RGB565、RGB332按8位展开（低位补0）后累加R G B，亮度Y=(77R+150G+29B)/256；
+  YUV422累加Y U V（U V每2像素一个）；灰度只累加Y*/
+void PictureStatsAdd(const uint8_t *buf, uint16 len)
+{
+	CPU_TS ts = OS_TS_GET();
+	uint32_t sum0 = 0, sum1 = 0, sum2 = 0;
+	uint32_t *hist = picture_stats.hist;
+	uint8_t min = picture_stats.min, max = picture_stats.max;
+	uint16 i, p;
+	uint8_t r, g, b, y;
+
+	switch(cam_mode.format)
+	{
+		case OV7725_FORMAT_GRAY:
+			for(i = 0; i < len; i++)
+			{
+				y = buf[i];
+				hist[y >> 4]++;
+				sum0 += y;
+				if(y < min) min = y;
+				if(y > max) max = y;
+			}
+			picture_stats.pixels += len;
+			break;
+		case OV7725_FORMAT_YUV422:
+			for(i = 0; i < len; i += 2)
+			{
+				y = buf[i + OV7725_Y_OFFSET];
+				hist[y >> 4]++;
+				sum0 += y;
+				if(y < min) min = y;
+				if(y > max) max = y;
+				if(i & 0x02)
+					sum2 += buf[i + 1 - OV7725_Y_OFFSET];   /*YUYV中第2个像素带V*/
+				else
+					sum1 += buf[i + 1 - OV7725_Y_OFFSET];
+			}
+			picture_stats.pixels += len / 2;
+			break;
+		case OV7725_FORMAT_RGB332:
+			for(i = 0; i < len; i++)
+			{
+				p = buf[i];
+				r = p & 0xe0;
+				g = (p << 3) & 0xe0;
+				b = (p << 6) & 0xc0;
+				y = (77 * r + 150 * g + 29 * b) >> 8;
+				hist[y >> 4]++;
+				sum0 += r;
+				sum1 += g;
+				sum2 += b;
+				if(y < min) min = y;
+				if(y > max) max = y;
+			}
+			picture_stats.pixels += len;
+			break;
+		default:
+			for(i = 0; i < len; i += 2)
+			{
+				p = (buf[i] << 8) | buf[i + 1];       /*高字节在前*/
+				r = (p >> 8) & 0xf8;
+				g = (p >> 3) & 0xfc;
+				b = (p << 3) & 0xf8;
+				y = (77 * r + 150 * g + 29 * b) >> 8;
+				hist[y >> 4]++;
+				sum0 += r;
+				sum1 += g;
+				sum2 += b;
+				if(y < min) min = y;
+				if(y > max) max = y;
+			}
+			picture_stats.pixels += len / 2;
+			break;
+	}
+	picture_stats.sum[0] += sum0;
+	picture_stats.sum[1] += sum1;
+	picture_stats.sum[2] += sum2;
+	picture_stats.min = min;
+	picture_stats.max = max;
+	picture_stats.cycles += OS_TS_GET() - ts;
+}
+
+/*填写统计包，seq为帧序号，返回包长；本帧没有统计返回0*/
+uint16 PictureStatsPack(uint8_t *buf, uint32_t seq)
+{
+	uint8_t i;
+
+	if(!picture_stats.active)
+		return 0;
+	buf[0] = 0x55;
+	buf[1] = 0xAA;
+	buf[2] = 'S';
+	buf[3] = cam_mode.format;
+	PicturePutU32(buf + 4, seq);
+	PicturePutU32(buf + 8, picture_stats.pixels);
+	buf[12] = picture_stats.min;
+	buf[13] = picture_stats.max;
+	for(i = 0; i < 3; i++)
+		PicturePutU32(buf + 14 + i * 4, picture_stats.sum[i]);
+	for(i = 0; i < PICTURE_STATS_BINS; i++)
+		PicturePutU32(buf + 26 + i * 4, picture_stats.hist[i]);
+	PicturePutU32(buf + 90, picture_latest_stat.frames);
+	PicturePutU32(buf + 94, picture_latest_stat.packets);
+	return PICTURE_STATS_LEN;
+}
+#endif
+
+#if (PICTURE_BAND_EN == DEF_ENABLED)
+/*带缓冲、签名表、JPEG编码器只在按块刷新或JPEG时用，放在uC-LIB的堆中（堆没有其它用户），不另占静态RAM*/
+void PictureBandInit(void)
+{
+	CPU_SIZE_T octets;
+	LIB_ERR err;
+
+	picture_band = (uint8_t *)Mem_HeapAlloc(PICTURE_BAND_LEN, sizeof(CPU_ALIGN), &octets, &err);
+	if(picture_band == NULL)
+		printf("\r\nband buffer alloc failed\r\n");
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+	picture_blk.sig = (uint8_t *)Mem_HeapAlloc(PICTURE_BLOCK_MAX * BLOCK_SIG_LEN, 1, &octets, &err);
+	if(picture_blk.sig == NULL)
+		printf("\r\nblock buffer alloc failed\r\n");
+#endif
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+	picture_jpg.enc = (JPEG_ENC *)Mem_HeapAlloc(sizeof(JPEG_ENC), sizeof(CPU_ALIGN), &octets, &err);
+	picture_jpg.out = (uint8_t *)Mem_HeapAlloc(PICTURE_JPEG_PAYLOAD + JPEG_MCU_MAX, sizeof(CPU_ALIGN), &octets, &err);
+	if(picture_jpg.enc == NULL || picture_jpg.out == NULL)
+		printf("\r\njpeg buffer alloc failed\r\n");
+	else
+		Jpeg_Quality(picture_jpg.enc, APP_CFG_PICTURE_JPEG_QUALITY);
+#endif
+}
+#endif
+
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+/*JPEG优先：两个都打开时按JPEG发*/
+uint8_t PictureBlockActive(void)
+{
+	uint16 w = cam_mode.cam_width / picture_bin;
+	uint16 h = cam_mode.cam_height / picture_bin;
+
+	if(!picture_block || picture_test == PICTURE_TEST_SYNTH || picture_band == NULL || picture_blk.sig == NULL
+	   || cam_mode.format == OV7725_FORMAT_RGB332 || PictureJpegActive())
+		return 0;
+	return (uint32_t)((w + BLOCK_SIZE - 1) / BLOCK_SIZE) * ((h + BLOCK_SIZE - 1) / BLOCK_SIZE) <= PICTURE_BLOCK_MAX;
+}
+
+/*窗口、格式、缩小倍数变了，或刚打开，或每APP_CFG_PICTURE_BLOCK_REFRESH帧，整帧刷新一次
+  刷新帧发原始图像包，接收端丢包留下的旧块、门限以下的差异都在这时补齐*/
+void PictureBlockBegin(void)
+{
+	uint16 w = cam_mode.cam_width / picture_bin;
+	uint16 h = cam_mode.cam_height / picture_bin;
+
+	picture_blk.active = PictureBlockActive();
+	if(!picture_blk.active)
+	{
+		picture_blk.frames = 0;        /*再打开时先刷新*/
 		return;
 	}
-	Q->Fornt = 1;
-	Q->Rear = 0;
-	Q->size = 0;
+	if(w != picture_blk.width || h != picture_blk.height || cam_mode.format != picture_blk.pix)
+	{
+		picture_blk.width = w;
+		picture_blk.height = h;
+		picture_blk.pix = cam_mode.format;
+		picture_blk.bpp = BLOCK_BPP(picture_blk.pix);
+		picture_blk.line_len = w * picture_blk.bpp;
+		picture_blk.cols = (w + BLOCK_SIZE - 1) / BLOCK_SIZE;
+		picture_blk.frames = 0;
+	}
+	picture_blk.refresh = (picture_blk.frames == 0);
+	if(++picture_blk.frames >= APP_CFG_PICTURE_BLOCK_REFRESH)
+		picture_blk.frames = 0;
+	picture_blk.line = 0;
+	picture_blk.band_y = 0;
+	picture_blk.band_lines = 0;
+	picture_blk.next = 0;
 }
 
-/*ж϶ǷΪ*/
-uint8_t IsEmpty(Queue Q)
+/*读出的一包复制进带缓冲；包长不对（不会发生）时丢弃*/
+static uint8_t PictureBlockAdd(const uint8_t *buf, uint16 len)
 {
-	return Q->size == 0;
+	CPU_TS ts;
+
+	if(len != picture_blk.line_len * 2 || picture_blk.band_lines + 2 > BLOCK_SIZE)
+		return 0;
+	ts = OS_TS_GET();
+	Mem_Copy(picture_band + (uint32_t)picture_blk.band_lines * picture_blk.line_len, buf, len);
+	picture_blk.band_lines += 2;
+	picture_blk.line += 2;
+	picture_block_stat.in_bytes += len;
+	picture_block_stat.cycles += OS_TS_GET() - ts;
+	return picture_blk.band_lines == BLOCK_SIZE || picture_blk.line >= picture_blk.height;
 }
-/*ж϶ǷΪ*/
-uint8_t IsFullQ(Queue Q)
+
+/*刷新帧：第一次调用时记下这一带所有块的签名，然后按原始图像包（2行）逐包取出
+  其它帧：逐块比较签名，变化超过门限的块装进块包，一包装满或这一带比较完就返回*/
+static uint16 PictureBlockPack(uint8_t *buf)
 {
-	return Q->size >= PictureMaxSize;
+	CPU_TS ts = OS_TS_GET();
+	uint8_t by = picture_blk.band_y / BLOCK_SIZE;
+	uint8_t bh = picture_blk.band_lines;
+	uint8_t bpp = picture_blk.bpp;
+	uint8_t cap = (PICTURE_PACKET_MAX - BLOCK_HEAD_LEN) / (2 + BLOCK_SIZE * BLOCK_SIZE * bpp);
+	uint8_t count = 0;
+	uint8_t bw, i, sig[BLOCK_SIG_LEN];
+	uint8_t *ref;
+	uint16 x, len = 0;
+
+	if(picture_blk.refresh)
+	{
+		if(picture_blk.next == 0)
+		{
+			for(x = 0; x < picture_blk.cols; x++)
+			{
+				bw = (picture_blk.width - x * BLOCK_SIZE < BLOCK_SIZE) ? picture_blk.width - x * BLOCK_SIZE : BLOCK_SIZE;
+				PictureBlock_Sign(picture_band + x * BLOCK_SIZE * bpp, picture_blk.line_len, bw, bh, picture_blk.pix,
+				                  picture_blk.sig + ((uint16)by * picture_blk.cols + x) * BLOCK_SIG_LEN);
+			}
+		}
+		if(picture_blk.next * 2 < bh)
+		{
+			len = picture_blk.line_len * 2;
+			Mem_Copy(buf, picture_band + (uint32_t)picture_blk.next * len, len);
+			picture_blk.next++;
+		}
+	}
+	else
+	{
+		len = BLOCK_HEAD_LEN;
+		while(picture_blk.next < picture_blk.cols && count < cap)
+		{
+			x = picture_blk.next * BLOCK_SIZE;
+			bw = (picture_blk.width - x < BLOCK_SIZE) ? picture_blk.width - x : BLOCK_SIZE;
+			PictureBlock_Sign(picture_band + x * bpp, picture_blk.line_len, bw, bh, picture_blk.pix, sig);
+			ref = picture_blk.sig + ((uint16)by * picture_blk.cols + picture_blk.next) * BLOCK_SIG_LEN;
+			picture_block_stat.blocks++;
+			if(PictureBlock_Changed(sig, ref, APP_CFG_PICTURE_BLOCK_THRESH))
+			{
+				for(i = 0; i < BLOCK_SIG_LEN; i++)
+					ref[i] = sig[i];
+				len += PictureBlock_Put(buf + len, picture_band + x * bpp, picture_blk.line_len,
+				                        picture_blk.next, by, bw, bh, bpp);
+				count++;
+			}
+			picture_blk.next++;
+		}
+		if(count)
+		{
+			buf[0] = 0x55;
+			buf[1] = 0xAA;
+			buf[2] = 'B';
+			buf[3] = count;
+			picture_block_stat.changed += count;
+		}
+		else
+			len = 0;
+	}
+	if(len == 0)
+	{
+		/*这一带发完，下一带从头存*/
+		picture_blk.band_y += bh;
+		picture_blk.band_lines = 0;
+		picture_blk.next = 0;
+	}
+	picture_block_stat.out_bytes += len;
+	picture_block_stat.cycles += OS_TS_GET() - ts;
+	return len;
+}
+
+uint16 PictureBlockEnd(uint8_t *buf, uint32_t seq)
+{
+	if(!picture_blk.active)
+		return 0;
+	buf[0] = 0x55;
+	buf[1] = 0xAA;
+	buf[2] = 'E';
+	buf[3] = picture_blk.refresh;
+	PicturePutU32(buf + 4, seq);
+	picture_block_stat.frames++;
+	if(picture_blk.refresh)
+		picture_block_stat.refresh++;
+	picture_block_stat.out_bytes += BLOCK_END_LEN;
+	return BLOCK_END_LEN;
+}
+#endif
+
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+uint8_t PictureJpegActive(void)
+{
+	return picture_jpeg && picture_test != PICTURE_TEST_SYNTH && cam_mode.format != OV7725_FORMAT_RGB332 && picture_band != NULL
+	       && picture_jpg.enc != NULL && picture_jpg.out != NULL;
+}
+
+/*质量变了先重算量化表；文件头先放进out，与第一批MCU一起发出*/
+void PictureJpegBegin(void)
+{
+	CPU_TS ts;
+
+	picture_jpg.active = PictureJpegActive();
+	if(!picture_jpg.active)
+		return;
+	ts = OS_TS_GET();
+	if(picture_jpeg != picture_jpg.enc->quality)
+		Jpeg_Quality(picture_jpg.enc, picture_jpeg);
+	picture_jpg.width = cam_mode.cam_width / picture_bin;
+	picture_jpg.height = cam_mode.cam_height / picture_bin;
+	picture_jpg.line_len = picture_jpg.width * ((cam_mode.format == OV7725_FORMAT_GRAY) ? 1 : 2);
+	picture_jpg.fill = Jpeg_Begin(picture_jpg.enc, picture_jpg.out, picture_jpg.width, picture_jpg.height, cam_mode.format);
+	picture_jpg.lines = JPEG_MCU_LINES(picture_jpg.enc);
+	picture_jpg.line = 0;
+	picture_jpg.band_lines = 0;
+	picture_jpg.x = 0;
+	picture_jpg.index = 0;
+	picture_jpg.ended = 0;
+	picture_jpg.frame++;
+	picture_jpeg_stat.frames++;
+	picture_jpeg_stat.cycles += OS_TS_GET() - ts;
 }
 
-static int Scc(int value)
+static uint8_t PictureJpegAdd(const uint8_t *buf, uint16 len)
 {
-	if (++value == PictureMaxSize)
-		value = 0;
-	return value;
+	CPU_TS ts;
+
+	if(len != picture_jpg.line_len * 2 || picture_jpg.band_lines + 2 > picture_jpg.lines)
+		return 0;
+	ts = OS_TS_GET();
+	Mem_Copy(picture_band + (uint32_t)picture_jpg.band_lines * picture_jpg.line_len, buf, len);
+	picture_jpg.band_lines += 2;
+	picture_jpg.line += 2;
+	picture_jpeg_stat.in_bytes += len;
+	picture_jpeg_stat.cycles += OS_TS_GET() - ts;
+	return picture_jpg.band_lines == picture_jpg.lines || picture_jpg.line >= picture_jpg.height;
 }
-/**/
-uint8 EnQueue(Queue Q)
+
+/*逐个MCU编码，码流攒够一包（或最后一带编完写了EOI）就发一包
+  最后一带的MCU都编完后写EOI，剩下的码流全部发出，最后一包带PICTURE_JPEG_LAST*/
+static uint16 PictureJpegPack(uint8_t *buf)
 {
-	if(IsFullQ(Q))
+	CPU_TS ts = OS_TS_GET();
+	uint16 n = 0;
+
+	while(DEF_TRUE)
+	{
+		if(picture_jpg.fill >= PICTURE_JPEG_PAYLOAD || (picture_jpg.ended && picture_jpg.fill))
+		{
+			n = (picture_jpg.fill < PICTURE_JPEG_PAYLOAD) ? picture_jpg.fill : PICTURE_JPEG_PAYLOAD;
+			break;
+		}
+		if(picture_jpg.x < picture_jpg.width)
+		{
+			picture_jpg.fill += Jpeg_Mcu(picture_jpg.enc, picture_band, picture_jpg.line_len, picture_jpg.x,
+			                             picture_jpg.band_lines, picture_jpg.out + picture_jpg.fill);
+			picture_jpg.x += picture_jpg.lines;
+			continue;
+		}
+		if(picture_jpg.line >= picture_jpg.height && !picture_jpg.ended)
+		{
+			picture_jpg.fill += Jpeg_End(picture_jpg.enc, picture_jpg.out + picture_jpg.fill);
+			picture_jpg.ended = 1;
+			continue;
+		}
+		/*这一带编完，剩下不足一包的码流接到下一带*/
+		picture_jpg.band_lines = 0;
+		picture_jpg.x = 0;
+		picture_jpeg_stat.cycles += OS_TS_GET() - ts;
 		return 0;
-	Q->size++;
-	Q->Rear = Scc(Q->Rear);
-	return Q->Rear;
+	}
+	buf[0] = 0x55;
+	buf[1] = 0xAA;
+	buf[2] = 'J';
+	buf[3] = (picture_jpg.ended && n == picture_jpg.fill) ? PICTURE_JPEG_LAST : 0;
+	buf[4] = picture_jpg.frame >> 8;
+	buf[5] = picture_jpg.frame;
+	buf[6] = picture_jpg.index >> 8;
+	buf[7] = picture_jpg.index;
+	Mem_Copy(buf + PICTURE_JPEG_HEAD_LEN, picture_jpg.out, n);
+	picture_jpg.fill -= n;
+	if(picture_jpg.fill)
+		Mem_Move(picture_jpg.out, picture_jpg.out + n, picture_jpg.fill);
+	picture_jpg.index++;
+	picture_jpeg_stat.packets++;
+	picture_jpeg_stat.bytes += n;
+	picture_jpeg_stat.cycles += OS_TS_GET() - ts;
+	return n + PICTURE_JPEG_HEAD_LEN;
+}
+#endif
+
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED)
+/*只用于不缩小的RGB565和灰度：YUV422隔点取会拆开U、V，RGB332的抖动按4x4格点排好；JPEG、按块刷新优先*/
+uint8_t PictureProgActive(void)
+{
+	uint8_t bpp = (cam_mode.format == OV7725_FORMAT_GRAY) ? 1 : 2;
+
+	return picture_prog && picture_bin == 1 && picture_test != PICTURE_TEST_SYNTH
+	       && (cam_mode.format == OV7725_FORMAT_RGB565 || cam_mode.format == OV7725_FORMAT_GRAY)
+	       && cam_mode.cam_width * bpp <= PICTURE_PROG_PAYLOAD
+	       && !PictureJpegActive() && !PictureBlockActive();
 }
-/**/
-uint8 DeQueue(Queue Q)
+
+void PictureProgBegin(void)
+{
+	picture_prg.active = PictureProgActive();
+	if(!picture_prg.active)
+		return;
+	picture_prg.bpp = (cam_mode.format == OV7725_FORMAT_GRAY) ? 1 : 2;
+	picture_prg.width = cam_mode.cam_width;
+	picture_prg.height = cam_mode.cam_height;
+	picture_prg.pass = 0;
+	picture_prg.row = picture_prog_grid[0][2];
+	picture_prg.line = 0;
+	picture_prg.frame++;
+	picture_prg.ts = OS_TS_GET();
+	picture_prog_stat.frames++;
+}
+
+/*一遍发完后把这一帧剩下的行空读掉，再让FIFO读指针回到帧头开始下一遍
+  最后一遍读完时读指针正好在帧尾，下一帧接着读*/
+uint16 PictureProgPack(uint8_t *buf)
 {
-	uint8 temp_fornt;
-	if(IsEmpty(Q))
+	const uint8_t *g;
+	uint8_t *o = buf + PICTURE_PROG_HEAD_LEN;
+	uint16 row_len, rows, k;
+
+	if(picture_prg.pass >= PICTURE_PROG_PASSES)
 		return 0;
-	temp_fornt = Q->Fornt;
-	Q->size--;
-	Q->Fornt = Scc(Q->Fornt);
-	return temp_fornt;
+	g = picture_prog_grid[picture_prg.pass];
+	row_len = (picture_prg.width - g[0] + g[1] - 1) / g[1] * picture_prg.bpp;
+	rows = (picture_prg.height - picture_prg.row + g[3] - 1) / g[3];   /*本遍还剩的行数*/
+	if(rows > PICTURE_PROG_PAYLOAD / row_len)
+		rows = PICTURE_PROG_PAYLOAD / row_len;
+
+	buf[0] = 0x55;
+	buf[1] = 0xAA;
+	buf[2] = 'P';
+	buf[3] = picture_prg.pass;
+	buf[4] = PICTURE_PROG_PASSES;
+	buf[5] = (g[0] << 4) | g[1];
+	buf[6] = (g[2] << 4) | g[3];
+	buf[7] = rows;
+	buf[8] = picture_prg.frame >> 8;
+	buf[9] = picture_prg.frame & 0xff;
+	buf[10] = picture_prg.row >> 8;
+	buf[11] = picture_prg.row & 0xff;
+
+	for(k = 0; k < rows; k++)
+	{
+		OV7725_Skip((uint32_t)(picture_prg.row - picture_prg.line) * picture_prg.width * 2);
+		if(g[1] == 2)
+			o += OV7725_ReadHalf(o, picture_prg.width, g[0], cam_mode.format);
+		else if(picture_prg.bpp == 1)
+			o += OV7725_ReadY(o, picture_prg.width);
+		else
+		{
+			OV7725_ReadLines(o, picture_prg.width, 1);
+			o += row_len;
+		}
+		picture_prg.line = picture_prg.row + 1;
+		picture_prg.row += g[3];
+	}
+	picture_prog_stat.packets++;
+	picture_prog_stat.bytes += o - buf;
+
+	if(picture_prg.row >= picture_prg.height)
+	{
+		OV7725_Skip((uint32_t)(picture_prg.height - picture_prg.line) * picture_prg.width * 2);
+		if(picture_prg.pass == 0)
+			picture_prog_stat.first_cycles += OS_TS_GET() - picture_prg.ts;
+		if(++picture_prg.pass < PICTURE_PROG_PASSES)
+		{
+			picture_prg.row = picture_prog_grid[picture_prg.pass][2];
+			picture_prg.line = 0;
+			OV7725_Frame_Rewind();
+		}
+		else
+			picture_prog_stat.cycles += OS_TS_GET() - picture_prg.ts;
+	}
+	return o - buf;
+}
+#endif
+
+#if (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+/*只用于不缩小的RGB565和灰度（同OV7725_ReadBinned()）；JPEG、按块刷新、渐进传输优先*/
+uint8_t PictureFoveaActive(void)
+{
+	uint8_t bpp = (cam_mode.format == OV7725_FORMAT_GRAY) ? 1 : 2;
+
+	return (picture_fovea == 2 || picture_fovea == 4) && picture_bin == 1 && picture_test != PICTURE_TEST_SYNTH
+	       && (cam_mode.format == OV7725_FORMAT_RGB565 || cam_mode.format == OV7725_FORMAT_GRAY)
+	       && cam_mode.cam_width % (2 * picture_fovea) == 0 && cam_mode.cam_height % picture_fovea == 0
+	       && cam_mode.cam_width / picture_fovea * bpp <= PICTURE_FOVEA_PAYLOAD
+	       && !PictureJpegActive() && !PictureBlockActive() && !PictureProgActive();
+}
+
+/*ROI按PICTURE_FOVEA_ALIGN对齐、限制到窗口内；宽度再限制到一条放得进一包*/
+void PictureFoveaBegin(void)
+{
+	PICTURE_FOVEA_ROI *roi = &picture_fov.roi;
+	uint16 max_w;
+
+	picture_fov.active = PictureFoveaActive();
+	if(!picture_fov.active)
+		return;
+	picture_fov.scale = picture_fovea;
+	picture_fov.bpp = (cam_mode.format == OV7725_FORMAT_GRAY) ? 1 : 2;
+	picture_fov.width = cam_mode.cam_width;
+	picture_fov.height = cam_mode.cam_height;
+	picture_fov.y = 0;
+	picture_fov.frame++;
+
+	roi->x = picture_fovea_roi.x / PICTURE_FOVEA_ALIGN * PICTURE_FOVEA_ALIGN;
+	roi->y = picture_fovea_roi.y / PICTURE_FOVEA_ALIGN * PICTURE_FOVEA_ALIGN;
+	roi->w = picture_fovea_roi.w / PICTURE_FOVEA_ALIGN * PICTURE_FOVEA_ALIGN;
+	roi->h = picture_fovea_roi.h / PICTURE_FOVEA_ALIGN * PICTURE_FOVEA_ALIGN;
+	if(roi->x > picture_fov.width)
+		roi->x = picture_fov.width;
+	if(roi->y > picture_fov.height)
+		roi->y = picture_fov.height;
+	if(roi->w > picture_fov.width - roi->x)
+		roi->w = picture_fov.width - roi->x;
+	if(roi->h > picture_fov.height - roi->y)
+		roi->h = picture_fov.height - roi->y;
+	max_w = (PICTURE_FOVEA_PAYLOAD / picture_fov.bpp - picture_fov.width / picture_fov.scale) / picture_fov.scale;
+	max_w = max_w / PICTURE_FOVEA_ALIGN * PICTURE_FOVEA_ALIGN;
+	if(roi->w > max_w)
+		roi->w = max_w;
+	picture_fovea_stat.frames++;
+}
+
+/*一包装尽量多的条，每条先是合并后的一行，在ROI的行范围内再跟scale行ROI原始像素*/
+uint16 PictureFoveaPack(uint8_t *buf)
+{
+	PICTURE_FOVEA_ROI *roi = &picture_fov.roi;
+	uint8_t *o = buf + PICTURE_FOVEA_HEAD_LEN;
+	uint16 coarse_len = picture_fov.width / picture_fov.scale * picture_fov.bpp;
+	uint16 len;
+	uint8_t in, n = 0;
+
+	if(picture_fov.y >= picture_fov.height)
+		return 0;
+	buf[0] = 0x55;
+	buf[1] = 0xAA;
+	buf[2] = 'F';
+	buf[3] = picture_fov.scale;
+	buf[4] = picture_fov.frame >> 8;
+	buf[5] = picture_fov.frame & 0xff;
+	buf[6] = picture_fov.y >> 8;
+	buf[7] = picture_fov.y & 0xff;
+	buf[10] = roi->x >> 8;
+	buf[11] = roi->x & 0xff;
+	buf[12] = roi->y >> 8;
+	buf[13] = roi->y & 0xff;
+	buf[14] = roi->w >> 8;
+	buf[15] = roi->w & 0xff;
+	buf[16] = roi->h >> 8;
+	buf[17] = roi->h & 0xff;
+
+	while(picture_fov.y < picture_fov.height && n < 255)
+	{
+		in = (picture_fov.y >= roi->y && picture_fov.y < roi->y + roi->h && roi->w);
+		len = coarse_len + (in ? picture_fov.scale * roi->w * picture_fov.bpp : 0);
+		if(o + len > buf + PICTURE_PACKET_MAX)
+			break;
+		OV7725_ReadBinnedRoi(o, picture_fov.width, picture_fov.scale, cam_mode.format,
+		                     in ? o + coarse_len : NULL, roi->x, roi->w);
+		o += len;
+		picture_fov.y += picture_fov.scale;
+		n++;
+	}
+	buf[8] = n;
+	buf[9] = (picture_fov.y >= picture_fov.height) ? PICTURE_FOVEA_LAST : 0;
+	picture_fovea_stat.in_bytes += (uint32_t)n * picture_fov.scale * picture_fov.width * picture_fov.bpp;
+	picture_fovea_stat.bytes += o - buf;
+	picture_fovea_stat.packets++;
+	return o - buf;
+}
+#endif
+
+#if (PICTURE_DIRECT_EN == DEF_ENABLED)
+uint8_t PictureDirectFrame(void)
+{
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED)
+	if(picture_prg.active)
+		return 1;
+#endif
+#if (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+	if(picture_fov.active)
+		return 1;
+#endif
+	return 0;
+}
+
+uint16 PictureDirectPack(uint8_t *buf)
+{
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED)
+	if(picture_prg.active)
+		return PictureProgPack(buf);
+#endif
+#if (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+	if(picture_fov.active)
+		return PictureFoveaPack(buf);
+#endif
+	return 0;
+}
+#endif
+
+#if (PICTURE_BAND_EN == DEF_ENABLED)
+uint8_t PictureBandFrame(void)
+{
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+	if(picture_jpg.active)
+		return 1;
+#endif
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+	if(picture_blk.active)
+		return 1;
+#endif
+	return 0;
+}
+
+uint8_t PictureBandAdd(const uint8_t *buf, uint16 len)
+{
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+	if(picture_jpg.active)
+		return PictureJpegAdd(buf, len);
+#endif
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+	if(picture_blk.active)
+		return PictureBlockAdd(buf, len);
+#endif
+	return 0;
+}
+
+uint16 PictureBandPack(uint8_t *buf)
+{
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+	if(picture_jpg.active)
+		return PictureJpegPack(buf);
+#endif
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+	if(picture_blk.active)
+		return PictureBlockPack(buf);
+#endif
+	return 0;
+}
+#endif
+
+/*发送一包，socket未就绪时丢弃
+  压缩打开且是当前窗口的RGB565图像包时先压缩，压不小就发原始数据
+  0x55 0xAA开头的包不压缩：块包、JPEG包可能恰好与图像包一样长，图像包开头是0x55 0xAA时发原始数据也不影响接收*/
+uint16 PictureSend(uint8_t *buf, uint16 len)
+{
+#if (APP_CFG_PICTURE_CODEC_EN == DEF_ENABLED)
+	static uint8_t codec_buf[PICTURE_PACKET_MAX];
+	CPU_TS ts;
+	uint16 n;
+#endif
+
+	if(getSn_SR(SOCK_UDPS) != SOCK_UDP)
+		return 0;
+#if (APP_CFG_PICTURE_CODEC_EN == DEF_ENABLED)
+	if(PictureCodecActive() && len == PicturePacketLen() && !(buf[0] == 0x55 && buf[1] == 0xAA))
+	{
+		ts = OS_TS_GET();
+		n = PictureCodec_Encode(buf, len / 4, codec_buf, sizeof(codec_buf));
+		picture_codec_stat.cycles += OS_TS_GET() - ts;
+		picture_codec_stat.packets++;
+		picture_codec_stat.in_bytes += len;
+		if(n)
+		{
+			picture_codec_stat.out_bytes += n;
+			return sendto(SOCK_UDPS, codec_buf, n, remote_ip, remote_port);
+		}
+		picture_codec_stat.out_bytes += len;
+		picture_codec_stat.raw++;
+	}
+#endif
+	return sendto(SOCK_UDPS, buf, len, remote_ip, remote_port);
+}
+
+static __align(4) uint8_t pkt_buf[PICTURE_PACKET_MAX];   /*边读边发时，缩小后或要统计的一包、渐进传输的一包*/
+
+/*从FIFO直接读一包写入W5500发送缓冲区并发送，不经过picture_data
+  len为发送字节数（PicturePacketSize），灰度时FIFO中读出2*len字节只发Y
+  SPI移出一个字节的同时读下一个FIFO字节，整包只有一次SPI片选
+  sendto_stream_begin()到sendto_stream_end()之间自己持有W5500的锁；调用者再wiz_spi_lock()，
+  查socket状态和整包读写也不被别的任务打断
+  socket未就绪时仍把这一包读掉，保证FIFO读指针与行对齐
+  缩小时读picture_bin倍的行，合并后普通发送；RGB332边读边查表转换后普通发送
+  按块刷新或JPEG时存进带缓冲，一带存满后把要发的块包（或刷新帧的原始包、JPEG包）都发出*/
+uint16 SendPictureStream(uint16 len)
+{
+	uint16 i;
+	uint8_t Camera_Data, Skip_Data;
+	uint8_t gray = (cam_mode.format == OV7725_FORMAT_GRAY);
+	uint8_t rgb332 = (cam_mode.format == OV7725_FORMAT_RGB332);
+	uint8_t stats = PictureStatsTake();
+
+	if(picture_bin > 1 || rgb332 || stats || PictureCodecActive() || PictureBandFrame())
+	{
+		/*缩小要先累加factor行，RGB332要查表，统计、压缩、按块比较、JPEG要再看一遍数据，都不能边读边写，读完一包后普通发送*/
+		if(picture_bin > 1)
+		{
+			for(i = 0; i < len; )
+				i += OV7725_ReadBinned(pkt_buf + i, cam_mode.cam_width, picture_bin, cam_mode.format);
+		}
+		else if(gray)
+			i = OV7725_ReadY(pkt_buf, len);
+		else if(rgb332)
+			i = OV7725_ReadRGB332(pkt_buf, cam_mode.cam_width, len / cam_mode.cam_width);
+		else
+			i = OV7725_ReadBytes(pkt_buf, len);
+		if(stats)
+			PictureStatsAdd(pkt_buf, i);
+#if (PICTURE_BAND_EN == DEF_ENABLED)
+		if(PictureBandFrame())
+		{
+			if(PictureBandAdd(pkt_buf, i))
+			{
+				while((len = PictureBandPack(pkt_buf)) != 0)   /*pkt_buf中的行已复制进带缓冲*/
+					PictureSend(pkt_buf, len);
+			}
+			return i;
+		}
+#endif
+		return PictureSend(pkt_buf, i);
+	}
+
+	if(getSn_SR(SOCK_UDPS) != SOCK_UDP || sendto_stream_begin(SOCK_UDPS, len, remote_ip, remote_port) == 0)
+	{
+		if(gray)
+			len *= 2;
+		for(i = 0; i < len; i++)
+			READ_FIFO_PIXEL(Camera_Data);
+		return 0;
+	}
+	if(gray)
+	{
+		for(i = 0; i < len; i++)
+		{
+#if (OV7725_Y_OFFSET == 0)
+			READ_FIFO_PIXEL(Camera_Data);
+			READ_FIFO_PIXEL(Skip_Data);
+#else
+			READ_FIFO_PIXEL(Skip_Data);
+			READ_FIFO_PIXEL(Camera_Data);
+#endif
+			WIZ_WRITE_STREAM_BYTE(Camera_Data);
+		}
+	}
+	else
+	{
+		for(i = 0; i < len; i++)
+		{
+			READ_FIFO_PIXEL(Camera_Data);
+			WIZ_WRITE_STREAM_BYTE(Camera_Data);
+		}
+	}
+	(void)Skip_Data;
+	return sendto_stream_end(SOCK_UDPS, len);
+}
+
+#if (PICTURE_DIRECT_EN == DEF_ENABLED)
+/*边读边发时渐进传输、区域加权的一包：读进pkt_buf后普通发送，返回包长，本帧发完返回0
+  sendto()自己持有W5500的锁，调用者的wiz_spi_lock()同SendPictureStream()*/
+uint16 SendPictureDirect(void)
+{
+	uint16 len = PictureDirectPack(pkt_buf);
+
+	if(len)
+		PictureSend(pkt_buf, len);
+	return len;
 }
+#endif
 
 
@@ -8,39 +8,381 @@
 #include "stdio.h"
 #include "w5500.h"
 #include  <os.h>
+#include  <lib_mem.h>
+#include  <app_cfg.h>
+#include "codec.h"
+#include "block.h"
+#include "jpeg.h"
 
-#define PictureMaxSize	4
+#define PictureMaxSize	APP_CFG_PICTURE_QUEUE_DEPTH
+#if (PictureMaxSize & (PictureMaxSize - 1)) || (PictureMaxSize > 128)
+#error "APP_CFG_PICTURE_QUEUE_DEPTH must be a power of two, at most 128"
+#endif
+#define PICTURE_PACKET_MAX		(APP_CFG_PICTURE_MTU & ~3)	/*一包最大字节数，即每块包缓冲的大小，按字对齐*/
+#define PICTURE_LINE_MAX		640		/*一行最多的字节数：QVGA RGB565，或VGA灰度*/
+#if (APP_CFG_PICTURE_BUF_COUNT < PictureMaxSize)
+#error "APP_CFG_PICTURE_BUF_COUNT must be at least APP_CFG_PICTURE_QUEUE_DEPTH"
+#endif
+#if (APP_CFG_PICTURE_MTU > 1472) || (APP_CFG_PICTURE_MTU < PICTURE_LINE_MAX * 2)
+#error "APP_CFG_PICTURE_MTU must be between 1280 and 1472"
+#endif
+/*最新帧优先要作废队列中已读出的包，只边读边发时没有队列*/
+#if (APP_CFG_PICTURE_LATEST_EN == DEF_ENABLED) && (APP_CFG_PICTURE_SEND_MODE == PICTURE_SEND_STREAM)
+#error "APP_CFG_PICTURE_LATEST_EN needs the packet queue, APP_CFG_PICTURE_SEND_MODE must not be PICTURE_SEND_STREAM"
+#endif
+
+/*图像参数包：0x55 0xAA 'W' 格式 宽 高 X起点 Y起点（16位，高字节在前） 测试图案 缩小倍数 帧率 压缩方式 包长（16位）
+  格式即OV7725_FORMAT_xxx，宽高为缩小后的大小；接收端按包长和包头区分
+  包长为原始图像包的字节数：第n包是一帧按字节顺序排好后从n*包长开始的一段，最后一包较短，行可以跨包*/
+#define PICTURE_INFO_LEN		18
+#define PICTURE_INFO_CODEC		0x01	/*压缩方式：RGB565包无损压缩*/
+#define PICTURE_INFO_BLOCK		0x02	/*压缩方式：按块条件刷新，一帧以帧结束包为界*/
+#define PICTURE_INFO_JPEG		0x04	/*压缩方式：基线JPEG，一帧以带结束标志的JPEG包为界*/
+#define PICTURE_INFO_PROG		0x08	/*渐进传输：一帧分PICTURE_PROG_PASSES遍，每遍从粗到细补格点*/
+#define PICTURE_INFO_FOVEA		0x10	/*区域加权：ROI内全分辨率，ROI外缩小，一帧以带结束标志的区域加权包为界*/
+
+/*JPEG包：0x55 0xAA 'J' 标志 帧号 包序号（16位，高字节在前） JFIF码流的一段
+  标志bit0为1表示本帧最后一包；接收端按包序号拼接，序号不连续整帧丢弃*/
+#define PICTURE_JPEG_HEAD_LEN	8
+#define PICTURE_JPEG_LAST		0x01
+
+/*渐进包：0x55 0xAA 'P' 遍 总遍数 x起点<<4|x步长 y起点<<4|y步长 行数 帧号 首行（16位，高字节在前） 像素
+  包里是首行起每隔y步长一行、共“行数”行，每行从x起点起每隔x步长取一个像素
+  第0遍为1/4分辨率；接收端把每个像素铺满(x步长-x起点)x(y步长-y起点)的格子，后面的遍再覆盖，每遍收完即可显示*/
+#define PICTURE_PROG_HEAD_LEN	12
+#define PICTURE_PROG_PASSES		3
+
+/*区域加权包：0x55 0xAA 'F' 倍数 帧号 首行 条数 标志 ROI的X Y 宽 高（16位，高字节在前） 各条
+  一条是窗口中的“倍数”行：先是合并后的一行（宽/倍数个像素），条在ROI的行范围内时再跟ROI的“倍数”行原始像素
+  接收端先把合并的像素铺满倍数x倍数的格子，再贴ROI；标志bit0为1表示本帧最后一包*/
+#define PICTURE_FOVEA_HEAD_LEN	18
+#define PICTURE_FOVEA_LAST		0x01
+#define PICTURE_FOVEA_ALIGN		4	/*ROI的位置、大小按4像素对齐，条不会跨ROI的边*/
 
+/*统计包：0x55 0xAA 'S' 格式 帧序号(32位) 统计像素数(32位) 亮度最小 亮度最大
+  通道和x3(32位，RGB565、RGB332为R G B，YUV422为Y U V，灰度为Y 0 0) 亮度直方图x16(32位)
+  最新帧优先放弃的帧数(32位) 跳过的包数(32位)
+  多字节均为高字节在前；包长不是4的倍数，不会与图像包混淆*/
+#define PICTURE_STATS_LEN		98
+#define PICTURE_STATS_BINS		16
 
-struct PictureQueue;
-typedef uint8_t *data;
-typedef struct PictureQueue *Queue;
+/*测试图案*/
+#define PICTURE_TEST_OFF		0	/*摄像头图像*/
+#define PICTURE_TEST_SENSOR		1	/*传感器彩条，经过DSP，只用来看画面和测速*/
+#define PICTURE_TEST_SYNTH		2	/*采集任务合成彩条，接收端逐字节校验*/
+
+/*渐进传输和区域加权不按行读，由图像模块自己读FIFO打包*/
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED) || (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+#define PICTURE_DIRECT_EN		DEF_ENABLED
+#else
+#define PICTURE_DIRECT_EN		DEF_DISABLED
+#endif
+
+/*按块刷新和JPEG都要先把读出的行存进带缓冲*/
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED) || (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+#define PICTURE_BAND_EN			DEF_ENABLED
+#else
+#define PICTURE_BAND_EN			DEF_DISABLED
+#endif
 
 
-extern uint8  remote_ip[4];											/*ԶIPַ*/
+
+extern uint8  remote_ip[4];											/*远端IP地址*/
 extern uint16 remote_port;
-extern uint8_t picture_data[PictureMaxSize][1280];
-extern Queue Q;
 extern OS_MEM picture_mem;
+extern OS_SEM picture_free_sem;
+extern OS_SEM picture_ready_sem;
+extern uint8_t picture_bin;
+extern uint8_t picture_test;
+
+#if (APP_CFG_PICTURE_CODEC_EN == DEF_ENABLED)
+/*压缩统计，压缩比=in_bytes/out_bytes，每像素周期数=cycles/(in_bytes/2)*/
+typedef struct
+{
+	uint32_t packets;                       /*送去压缩的包数*/
+	uint32_t raw;                           /*压不小、发原始数据的包数*/
+	uint32_t in_bytes;
+	uint32_t out_bytes;                     /*实际发出的字节数（含原始发送的包）*/
+	uint32_t cycles;                        /*压缩花的DWT周期数*/
+}PICTURE_CODEC_STAT;
+
+extern uint8_t picture_codec;
+extern PICTURE_CODEC_STAT picture_codec_stat;
+#define PictureCodecActive()	(picture_codec && cam_mode.format == OV7725_FORMAT_RGB565)
+#else
+#define PictureCodecActive()	0
+#endif
+
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+/*按块刷新统计，发出比例=out_bytes/in_bytes*/
+typedef struct
+{
+	uint32_t frames;
+	uint32_t refresh;                       /*整帧刷新的帧数*/
+	uint32_t blocks;                        /*比较过签名的块数（不含刷新帧）*/
+	uint32_t changed;                       /*发出的块数*/
+	uint32_t in_bytes;                      /*读出的图像字节数*/
+	uint32_t out_bytes;                     /*实际交给发送的字节数（含刷新帧的原始包）*/
+	uint32_t cycles;                        /*存带缓冲、算签名、打包花的DWT周期数*/
+}PICTURE_BLOCK_STAT;
+
+extern uint8_t picture_block;
+extern PICTURE_BLOCK_STAT picture_block_stat;
+#endif
+
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+/*JPEG统计，平均每帧字节数=bytes/frames，每帧周期数=cycles/frames*/
+typedef struct
+{
+	uint32_t frames;
+	uint32_t in_bytes;                      /*读出的图像字节数*/
+	uint32_t bytes;                         /*JPEG码流字节数（不含包头）*/
+	uint32_t packets;
+	uint32_t cycles;                        /*存带缓冲、编码、打包花的DWT周期数*/
+}PICTURE_JPEG_STAT;
+
+extern uint8_t picture_jpeg;
+extern PICTURE_JPEG_STAT picture_jpeg_stat;
+#endif
+
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED)
+/*渐进传输统计，第0遍平均用时=first_cycles/frames，即接收端看到第一幅粗图前的读出时间*/
+typedef struct
+{
+	uint32_t frames;
+	uint32_t packets;
+	uint32_t bytes;                         /*发出的字节数（含包头）*/
+	uint32_t first_cycles;                  /*帧开始到第0遍发完的DWT周期数*/
+	uint32_t cycles;                        /*帧开始到最后一遍发完的DWT周期数（含重读FIFO、等待队列）*/
+}PICTURE_PROG_STAT;
+
+extern uint8_t picture_prog;
+extern PICTURE_PROG_STAT picture_prog_stat;
+#endif
+
+#if (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+/*ROI，窗口内坐标*/
+typedef struct
+{
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+}PICTURE_FOVEA_ROI;
 
-/*ͼƬݶ*/
-struct PictureQueue
-{
-	uint8_t Fornt;
-	uint8_t Rear;
-	uint8_t size;
-};
-
-/*ʼ*/
-void InitQueue(Queue Q);
-/*ж϶ǷΪ*/
-uint8_t IsFullQ(Queue Q);
-/*ж϶ǷΪ*/
-uint8_t IsEmpty(Queue Q);
-/**/
-uint8 EnQueue(Queue Q);
-/**/
-uint8 DeQueue(Queue Q);
+/*区域加权统计，发出比例=bytes/in_bytes*/
+typedef struct
+{
+	uint32_t frames;
+	uint32_t packets;
+	uint32_t in_bytes;                      /*读出的图像字节数*/
+	uint32_t bytes;                         /*发出的字节数（含包头）*/
+}PICTURE_FOVEA_STAT;
+
+extern uint8_t picture_fovea;
+extern PICTURE_FOVEA_ROI picture_fovea_roi;
+extern PICTURE_FOVEA_STAT picture_fovea_stat;
+#endif
+
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+/*一帧的统计，读出时按抽样的包累加*/
+typedef struct
+{
+	uint8_t  active;                        /*1：本帧统计*/
+	uint16_t packet;                        /*本帧已读的包数，用于抽样*/
+	uint32_t pixels;                        /*参与统计的像素数*/
+	uint8_t  min;                           /*亮度最小值*/
+	uint8_t  max;                           /*亮度最大值*/
+	uint32_t sum[3];                        /*各通道和*/
+	uint32_t hist[PICTURE_STATS_BINS];      /*亮度直方图，每格16级*/
+	uint32_t cycles;                        /*本帧统计花的DWT周期数*/
+}PICTURE_STATS;
+
+extern uint8_t picture_stats_on;
+extern PICTURE_STATS picture_stats;
+#endif
+
+/*包缓冲：从picture_mem（OS_MEM分区，APP_CFG_PICTURE_BUF_COUNT块）申请，带引用计数
+  发送队列、重传缓存、本地预览等可同时持有同一块，各自PictureBufRef()/PictureBufFree()，不用拷贝
+  最后一个持有者释放时才还回分区；data按字对齐，OV7725_ReadLines、DMA可按32位写入*/
+typedef struct
+{
+	volatile uint8_t refs;                  /*持有者个数，0为在分区中*/
+	uint8_t  epoch;                         /*提交时队列的代号，PICTURE_EPOCH_KEEP为不可跳过*/
+	uint16_t len;                           /*要发送的字节数*/
+	uint8_t  data[PICTURE_PACKET_MAX];
+}PICTURE_BUF;
+
+/*包缓冲统计，可在调试器中查看，按peak定APP_CFG_PICTURE_BUF_COUNT*/
+typedef struct
+{
+	uint32_t alloc;                         /*申请成功次数*/
+	uint32_t fail;                          /*分区空、申请失败的次数*/
+	uint32_t shared;                        /*PictureBufRef()次数*/
+	uint16_t used;                          /*当前在用块数*/
+	uint16_t peak;                          /*在用块数的最大值*/
+}PICTURE_BUF_STAT;
+
+extern PICTURE_BUF_STAT picture_buf_stat;
+
+/*图片数据队列：单生产者（采集任务）单消费者（发送任务）的环形队列，格中放包缓冲指针
+  head只由生产者写，tail只由消费者写，都是自由增长的计数，格号为计数&(PictureMaxSize-1)
+  生产者PictureRingReserve()申请包缓冲、直接写进去、PictureRingCommit()提交
+  消费者PictureRingPeek()取包、发完后PictureRingRelease()交还，正在发的包不会被改写
+  最新帧优先：生产者放弃一帧时epoch加1，消费者跳过代号不同的图像包，参数包、统计包等不跳*/
+typedef struct
+{
+	volatile uint32_t head;                 /*已提交的包数*/
+	volatile uint32_t tail;                 /*已发完交还的包数*/
+	PICTURE_BUF *slot[PictureMaxSize];
+	PICTURE_BUF *pending;                   /*已申请、未提交的包缓冲，只由生产者访问*/
+	volatile uint8_t epoch;                 /*当前代号，只由生产者写*/
+}PICTURE_RING;
+
+#define PICTURE_EPOCH_KEEP		0xFF
+
+/*最新帧优先统计，可在调试器中查看，也在统计包中发出*/
+typedef struct
+{
+	uint32_t frames;                        /*FIFO中已有更新的帧、没读完就放弃的帧数*/
+	uint32_t packets;                       /*队列中因此跳过不发的包数*/
+}PICTURE_LATEST_STAT;
+
+extern uint8_t picture_latest;
+extern PICTURE_LATEST_STAT picture_latest_stat;
+
+#if (APP_CFG_PICTURE_SEND_MODE != PICTURE_SEND_STREAM)
+/*申请包缓冲，引用计数为1，分区空返回NULL*/
+PICTURE_BUF *PictureBufAlloc(void);
+/*多一个持有者*/
+void PictureBufRef(PICTURE_BUF *buf);
+/*少一个持有者，还回分区时返回1*/
+uint8_t PictureBufFree(PICTURE_BUF *buf);
+/*初始化队列和包缓冲分区*/
+void PictureRingInit(void);
+/*队列中的包数*/
+uint8_t PictureRingCount(void);
+/*取下一个空格，满或分区空返回NULL*/
+uint8_t *PictureRingReserve(void);
+/*提交取到的格，keep为1时最新帧优先也不跳过*/
+void PictureRingCommit(uint16 len, uint8_t keep);
+/*取最早的包，空返回NULL；要另外保留的调用PictureBufRef()*/
+PICTURE_BUF *PictureRingPeek(void);
+/*交还发完的包*/
+void PictureRingRelease(void);
+#endif
+/*放弃正在读的帧，queued为1时队列中已提交的图像包作废*/
+void PictureFrameAbandon(uint8_t queued);
+/*原始图像包的打包方式*/
+typedef struct
+{
+	uint16 line_len;                        /*发送的一行字节数（缩小后）*/
+	uint16 lines;                           /*按整行打包时一包的行数，0为按字节打包、行可以跨包*/
+	uint16 len;                             /*一包的字节数，一帧的最后一包可能较短*/
+	uint16 packets;                         /*一帧的包数*/
+	uint32_t frame_len;                     /*一帧的字节数*/
+}PICTURE_PACKING;
+
+extern PICTURE_PACKING picture_pack;
+
+/*按当前设置定打包方式*/
+void PicturePackingSet(void);
+/*一包要发送的字节数*/
+uint16 PicturePacketLen(void);
+/*第index包的字节数*/
+uint16 PicturePacketSize(uint16 index);
+/*前packets包从FIFO读出的字节数*/
+uint32_t PictureFifoOffset(uint16 packets);
+/*一包是否放得下*/
+uint8_t PictureFits(uint16 width, uint8_t format, uint8_t bin);
+/*设置缩小倍数*/
+ErrorStatus PictureBinSet(uint8_t factor);
+/*生成一包合成测试图案*/
+uint16 PictureTestPack(uint8_t *buf, uint32_t seq, uint16_t index);
+#if (APP_CFG_PICTURE_STATS_EN == DEF_ENABLED)
+/*一帧开始前清零统计*/
+void PictureStatsBegin(void);
+/*这一包是否要统计*/
+uint8_t PictureStatsTake(void);
+/*统计一包数据*/
+void PictureStatsAdd(const uint8_t *buf, uint16 len);
+/*填写统计包*/
+uint16 PictureStatsPack(uint8_t *buf, uint32_t seq);
+#else
+#define PictureStatsBegin()
+#define PictureStatsTake()				0
+#define PictureStatsAdd(buf, len)
+#endif
+#if (PICTURE_BAND_EN == DEF_ENABLED)
+/*从堆中申请带缓冲、签名表、JPEG编码器，Mem_Init()之后调用一次*/
+void PictureBandInit(void);
+/*本帧是否经带缓冲发送（按块刷新或JPEG）*/
+uint8_t PictureBandFrame(void);
+/*存入读出的一包（2行），一带存满或一帧读完返回1，此时反复调用PictureBandPack()*/
+uint8_t PictureBandAdd(const uint8_t *buf, uint16 len);
+/*取出当前带下一个要发的包，返回包长，这一带发完返回0*/
+uint16 PictureBandPack(uint8_t *buf);
+#else
+#define PictureBandFrame()				0
+#endif
+#if (APP_CFG_PICTURE_BLOCK_EN == DEF_ENABLED)
+/*按块刷新是否可用（打开、没有用JPEG、不是合成测试图案和RGB332、缓冲放得下当前窗口）*/
+uint8_t PictureBlockActive(void);
+/*一帧开始前调用，决定本帧是否按块发送、是否整帧刷新*/
+void PictureBlockBegin(void);
+/*填写帧结束包，本帧没有按块发送返回0*/
+uint16 PictureBlockEnd(uint8_t *buf, uint32_t seq);
+#else
+#define PictureBlockActive()			0
+#define PictureBlockBegin()
+#endif
+#if (APP_CFG_PICTURE_JPEG_EN == DEF_ENABLED)
+/*JPEG是否可用（质量不为0、不是合成测试图案和RGB332、缓冲申请成功）*/
+uint8_t PictureJpegActive(void);
+/*一帧开始前调用，决定本帧是否按JPEG发送，写文件头*/
+void PictureJpegBegin(void);
+#else
+#define PictureJpegActive()				0
+#define PictureJpegBegin()
+#endif
+#if (APP_CFG_PICTURE_PROG_EN == DEF_ENABLED)
+/*渐进传输是否可用（打开、不缩小、RGB565或灰度、不是合成测试图案、没有用JPEG和按块刷新）*/
+uint8_t PictureProgActive(void);
+/*一帧开始前调用，决定本帧是否渐进发送*/
+void PictureProgBegin(void);
+/*从FIFO读出下一包渐进包，返回包长，本帧发完返回0*/
+uint16 PictureProgPack(uint8_t *buf);
+#else
+#define PictureProgActive()				0
+#define PictureProgBegin()
+#endif
+#if (APP_CFG_PICTURE_FOVEA_EN == DEF_ENABLED)
+/*区域加权是否可用（ROI外倍数为2或4、不缩小、RGB565或灰度、不是合成测试图案、没有用JPEG、按块刷新和渐进传输）*/
+uint8_t PictureFoveaActive(void);
+/*一帧开始前调用，决定本帧是否按区域加权发送，确定本帧的ROI*/
+void PictureFoveaBegin(void);
+/*从FIFO读出下一包区域加权包，返回包长，本帧发完返回0*/
+uint16 PictureFoveaPack(uint8_t *buf);
+#else
+#define PictureFoveaActive()			0
+#define PictureFoveaBegin()
+#endif
+#if (PICTURE_DIRECT_EN == DEF_ENABLED)
+/*本帧是否由图像模块自己读FIFO（渐进传输或区域加权），是则不按行读，反复调用PictureDirectPack()或SendPictureDirect()直到返回0*/
+uint8_t PictureDirectFrame(void);
+/*读出下一包，返回包长，本帧发完返回0*/
+uint16 PictureDirectPack(uint8_t *buf);
+/*读出下一包并发送（边读边发方式）*/
+uint16 SendPictureDirect(void);
+#else
+#define PictureDirectFrame()			0
+#endif
+/*发送一包，按需压缩*/
+uint16 PictureSend(uint8_t *buf, uint16 len);
+/*从FIFO直接读一包写入W5500并发送*/
+uint16 SendPictureStream(uint16 len);
+/*填写图像参数包*/
+void PictureInfoPack(uint8_t *buf);
 
 
 #endif
@@ -0,0 +1,521 @@
+#include "jpeg.h"
+
+/*
+ * 每个MCU：取像素（RGB565转YCbCr，4:2:0的色度取2x2平均），减128后做AAN定点DCT，
+ * 输出系数带AAN的比例因子，量化时一并除掉（乘预先算好的倒数），再按Z字形顺序Huffman编码。
+ * AAN一维8点只要5次乘法，乘数取8位定点，精度与IJG的jfdctfst相同。
+ * Huffman码表按附录K的标准表预先生成，放在Flash中。
+ */
+
+/*Huffman表（附录K.3）：各码长的码字个数，[0]亮度 [1]色度*/
+static const uint8_t jpeg_dc_bits[2][16] = {
+	{
+		0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0
+	},
+	{
+		0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0
+	}
+};
+
+static const uint8_t jpeg_ac_bits[2][16] = {
+	{
+		0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D
+	},
+	{
+		0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77
+	}
+};
+
+/*AC表的符号（游程<<4|位数），按码长排列*/
+static const uint8_t jpeg_ac_val[2][162] = {
+	{
+		0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71,
+		0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72,
+		0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37,
+		0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+		0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83,
+		0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3,
+		0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+		0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+		0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA
+	},
+	{
+		0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22,
+		0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15, 0x62, 0x72, 0xD1,
+		0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36,
+		0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+		0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+		0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A,
+		0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA,
+		0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+		0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA
+	}
+};
+
+/*由上面的表预先生成的码字和码长，按符号查*/
+static const uint16_t jpeg_dc_code[2][12] = {
+	{
+		0x0000, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x000E, 0x001E, 0x003E, 0x007E, 0x00FE, 0x01FE
+	},
+	{
+		0x0000, 0x0001, 0x0002, 0x0006, 0x000E, 0x001E, 0x003E, 0x007E, 0x00FE, 0x01FE, 0x03FE, 0x07FE
+	}
+};
+
+static const uint8_t jpeg_dc_size[2][12] = {
+	{
+		2, 3, 3, 3, 3, 3, 4, 5, 6, 7, 8, 9
+	},
+	{
+		2, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11
+	}
+};
+
+static const uint16_t jpeg_ac_code[2][256] = {
+	{
+		0x000A, 0x0000, 0x0001, 0x0004, 0x000B, 0x001A, 0x0078, 0x00F8, 0x03F6, 0xFF82, 0xFF83, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x000C, 0x001B, 0x0079, 0x01F6, 0x07F6, 0xFF84, 0xFF85, 0xFF86, 0xFF87, 0xFF88, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x001C, 0x00F9, 0x03F7, 0x0FF4, 0xFF89, 0xFF8A, 0xFF8B, 0xFF8C, 0xFF8D, 0xFF8E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x003A, 0x01F7, 0x0FF5, 0xFF8F, 0xFF90, 0xFF91, 0xFF92, 0xFF93, 0xFF94, 0xFF95, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x003B, 0x03F8, 0xFF96, 0xFF97, 0xFF98, 0xFF99, 0xFF9A, 0xFF9B, 0xFF9C, 0xFF9D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x007A, 0x07F7, 0xFF9E, 0xFF9F, 0xFFA0, 0xFFA1, 0xFFA2, 0xFFA3, 0xFFA4, 0xFFA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x007B, 0x0FF6, 0xFFA6, 0xFFA7, 0xFFA8, 0xFFA9, 0xFFAA, 0xFFAB, 0xFFAC, 0xFFAD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x00FA, 0x0FF7, 0xFFAE, 0xFFAF, 0xFFB0, 0xFFB1, 0xFFB2, 0xFFB3, 0xFFB4, 0xFFB5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x01F8, 0x7FC0, 0xFFB6, 0xFFB7, 0xFFB8, 0xFFB9, 0xFFBA, 0xFFBB, 0xFFBC, 0xFFBD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x01F9, 0xFFBE, 0xFFBF, 0xFFC0, 0xFFC1, 0xFFC2, 0xFFC3, 0xFFC4, 0xFFC5, 0xFFC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x01FA, 0xFFC7, 0xFFC8, 0xFFC9, 0xFFCA, 0xFFCB, 0xFFCC, 0xFFCD, 0xFFCE, 0xFFCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x03F9, 0xFFD0, 0xFFD1, 0xFFD2, 0xFFD3, 0xFFD4, 0xFFD5, 0xFFD6, 0xFFD7, 0xFFD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x03FA, 0xFFD9, 0xFFDA, 0xFFDB, 0xFFDC, 0xFFDD, 0xFFDE, 0xFFDF, 0xFFE0, 0xFFE1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x07F8, 0xFFE2, 0xFFE3, 0xFFE4, 0xFFE5, 0xFFE6, 0xFFE7, 0xFFE8, 0xFFE9, 0xFFEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0xFFEB, 0xFFEC, 0xFFED, 0xFFEE, 0xFFEF, 0xFFF0, 0xFFF1, 0xFFF2, 0xFFF3, 0xFFF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x07F9, 0xFFF5, 0xFFF6, 0xFFF7, 0xFFF8, 0xFFF9, 0xFFFA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+	},
+	{
+		0x0000, 0x0001, 0x0004, 0x000A, 0x0018, 0x0019, 0x0038, 0x0078, 0x01F4, 0x03F6, 0x0FF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x000B, 0x0039, 0x00F6, 0x01F5, 0x07F6, 0x0FF5, 0xFF88, 0xFF89, 0xFF8A, 0xFF8B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x001A, 0x00F7, 0x03F7, 0x0FF6, 0x7FC2, 0xFF8C, 0xFF8D, 0xFF8E, 0xFF8F, 0xFF90, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x001B, 0x00F8, 0x03F8, 0x0FF7, 0xFF91, 0xFF92, 0xFF93, 0xFF94, 0xFF95, 0xFF96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x003A, 0x01F6, 0xFF97, 0xFF98, 0xFF99, 0xFF9A, 0xFF9B, 0xFF9C, 0xFF9D, 0xFF9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x003B, 0x03F9, 0xFF9F, 0xFFA0, 0xFFA1, 0xFFA2, 0xFFA3, 0xFFA4, 0xFFA5, 0xFFA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0079, 0x07F7, 0xFFA7, 0xFFA8, 0xFFA9, 0xFFAA, 0xFFAB, 0xFFAC, 0xFFAD, 0xFFAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x007A, 0x07F8, 0xFFAF, 0xFFB0, 0xFFB1, 0xFFB2, 0xFFB3, 0xFFB4, 0xFFB5, 0xFFB6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x00F9, 0xFFB7, 0xFFB8, 0xFFB9, 0xFFBA, 0xFFBB, 0xFFBC, 0xFFBD, 0xFFBE, 0xFFBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x01F7, 0xFFC0, 0xFFC1, 0xFFC2, 0xFFC3, 0xFFC4, 0xFFC5, 0xFFC6, 0xFFC7, 0xFFC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x01F8, 0xFFC9, 0xFFCA, 0xFFCB, 0xFFCC, 0xFFCD, 0xFFCE, 0xFFCF, 0xFFD0, 0xFFD1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x01F9, 0xFFD2, 0xFFD3, 0xFFD4, 0xFFD5, 0xFFD6, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x01FA, 0xFFDB, 0xFFDC, 0xFFDD, 0xFFDE, 0xFFDF, 0xFFE0, 0xFFE1, 0xFFE2, 0xFFE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x07F9, 0xFFE4, 0xFFE5, 0xFFE6, 0xFFE7, 0xFFE8, 0xFFE9, 0xFFEA, 0xFFEB, 0xFFEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x3FE0, 0xFFED, 0xFFEE, 0xFFEF, 0xFFF0, 0xFFF1, 0xFFF2, 0xFFF3, 0xFFF4, 0xFFF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x03FA, 0x7FC3, 0xFFF6, 0xFFF7, 0xFFF8, 0xFFF9, 0xFFFA, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+	}
+};
+
+static const uint8_t jpeg_ac_size[2][256] = {
+	{
+		4, 2, 2, 3, 4, 5, 7, 8, 10, 16, 16, 0, 0, 0, 0, 0,
+		0, 4, 5, 7, 9, 11, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 5, 8, 10, 12, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 6, 9, 12, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 6, 10, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 7, 11, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 7, 12, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 8, 12, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 9, 15, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 10, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 10, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 11, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		11, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0
+	},
+	{
+		2, 2, 3, 4, 5, 5, 6, 7, 9, 10, 12, 0, 0, 0, 0, 0,
+		0, 4, 6, 8, 9, 11, 12, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 5, 8, 10, 12, 15, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 5, 8, 10, 12, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 6, 9, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 6, 10, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 7, 11, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 7, 11, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 8, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 11, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		10, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0
+	}
+};
+
+/*标准量化表（附录K.1），自然顺序，质量50*/
+static const uint8_t jpeg_std_q[2][64] = {
+	{
+		16, 11, 10, 16, 24, 40, 51, 61,
+		12, 12, 14, 19, 26, 58, 60, 55,
+		14, 13, 16, 24, 40, 57, 69, 56,
+		14, 17, 22, 29, 51, 87, 80, 62,
+		18, 22, 37, 56, 68, 109, 103, 77,
+		24, 35, 55, 64, 81, 104, 113, 92,
+		49, 64, 78, 87, 103, 121, 120, 101,
+		72, 92, 95, 98, 112, 100, 103, 99
+	},
+	{
+		17, 18, 24, 47, 99, 99, 99, 99,
+		18, 21, 26, 66, 99, 99, 99, 99,
+		24, 26, 56, 99, 99, 99, 99, 99,
+		47, 66, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99
+	}
+};
+
+/*AAN比例因子 aan(u)*aan(v)*2^14，aan(0)=1，aan(k)=cos(k*pi/16)*sqrt(2)*/
+static const uint16_t jpeg_aan_scale[64] = {
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	22725, 31521, 29692, 26722, 22725, 17855, 12299,  6270,
+	21407, 29692, 27969, 25172, 21407, 16819, 11585,  5906,
+	19266, 26722, 25172, 22654, 19266, 15137, 10426,  5315,
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	12873, 17855, 16819, 15137, 12873, 10114,  6967,  3552,
+	 8867, 12299, 11585, 10426,  8867,  6967,  4799,  2446,
+	 4520,  6270,  5906,  5315,  4520,  3552,  2446,  1247
+};
+
+/*Z字形顺序第k个系数在自然顺序中的位置*/
+static const uint8_t jpeg_zigzag[64] = {
+	 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+#define JPEG_FIX_0_382683433	98		/*8位定点*/
+#define JPEG_FIX_0_541196100	139
+#define JPEG_FIX_0_707106781	181
+#define JPEG_FIX_1_306562965	334
+#define JPEG_MUL(v, c)			(((v) * (c)) >> 8)
+
+/*AAN一维8点DCT，d按step取8个数*/
+static void Jpeg_Fdct8(int32_t *d, uint8_t step)
+{
+	int32_t t0, t1, t2, t3, t4, t5, t6, t7;
+	int32_t t10, t11, t12, t13;
+	int32_t z1, z2, z3, z4, z5, z11, z13;
+
+	t0 = d[0] + d[7 * step];
+	t7 = d[0] - d[7 * step];
+	t1 = d[step] + d[6 * step];
+	t6 = d[step] - d[6 * step];
+	t2 = d[2 * step] + d[5 * step];
+	t5 = d[2 * step] - d[5 * step];
+	t3 = d[3 * step] + d[4 * step];
+	t4 = d[3 * step] - d[4 * step];
+
+	/*偶数部分*/
+	t10 = t0 + t3;
+	t13 = t0 - t3;
+	t11 = t1 + t2;
+	t12 = t1 - t2;
+	d[0] = t10 + t11;
+	d[4 * step] = t10 - t11;
+	z1 = JPEG_MUL(t12 + t13, JPEG_FIX_0_707106781);
+	d[2 * step] = t13 + z1;
+	d[6 * step] = t13 - z1;
+
+	/*奇数部分*/
+	t10 = t4 + t5;
+	t11 = t5 + t6;
+	t12 = t6 + t7;
+	z5 = JPEG_MUL(t10 - t12, JPEG_FIX_0_382683433);
+	z2 = JPEG_MUL(t10, JPEG_FIX_0_541196100) + z5;
+	z4 = JPEG_MUL(t12, JPEG_FIX_1_306562965) + z5;
+	z3 = JPEG_MUL(t11, JPEG_FIX_0_707106781);
+	z11 = t7 + z3;
+	z13 = t7 - z3;
+	d[5 * step] = z13 + z2;
+	d[3 * step] = z13 - z2;
+	d[step] = z11 + z4;
+	d[7 * step] = z11 - z4;
+}
+
+void Jpeg_Quality(JPEG_ENC *e, uint8_t quality)
+{
+	uint32_t scale, q;
+	uint8_t t, i;
+
+	if(quality < 1)
+		quality = 1;
+	if(quality > 100)
+		quality = 100;
+	e->quality = quality;
+	scale = (quality < 50) ? 5000 / quality : 200 - quality * 2;
+	for(t = 0; t < 2; t++)
+	{
+		for(i = 0; i < 64; i++)
+		{
+			q = (jpeg_std_q[t][i] * scale + 50) / 100;
+			if(q < 1)
+				q = 1;
+			if(q > 255)
+				q = 255;
+			e->qtbl[t][i] = q;
+			q *= jpeg_aan_scale[i];               /*除数=q*8*aan(u)*aan(v)=q*aan_scale/2^11*/
+			e->recip[t][i] = ((1UL << 26) + q / 2) / q;
+		}
+	}
+}
+
+/*写位，满8位写出一个字节，0xFF后补0*/
+static uint8_t *Jpeg_Bits(JPEG_ENC *e, uint8_t *o, uint32_t code, uint8_t size)
+{
+	uint8_t b;
+
+	e->acc = (e->acc << size) | (code & ((1UL << size) - 1));
+	e->bits += size;
+	while(e->bits >= 8)
+	{
+		e->bits -= 8;
+		b = e->acc >> e->bits;
+		*o++ = b;
+		if(b == 0xFF)
+			*o++ = 0;
+	}
+	return o;
+}
+
+/*系数的位数（类别）*/
+static uint8_t Jpeg_Cat(int32_t v)
+{
+	uint8_t n = 0;
+
+	if(v < 0)
+		v = -v;
+	while(v)
+	{
+		v >>= 1;
+		n++;
+	}
+	return n;
+}
+
+/*对e->blk做DCT、量化，编码到o；t为表号（0亮度 1色度），c为分量号*/
+static uint8_t *Jpeg_Block(JPEG_ENC *e, uint8_t *o, uint8_t t, uint8_t c)
+{
+	int32_t *d = e->blk;
+	const uint16_t *r = e->recip[t];
+	int16_t q[64];
+	int32_t v;
+	uint8_t i, k, run, cat;
+
+	for(i = 0; i < 64; i += 8)
+		Jpeg_Fdct8(d + i, 1);
+	for(i = 0; i < 8; i++)
+		Jpeg_Fdct8(d + i, 8);
+	for(i = 0; i < 64; i++)
+	{
+		v = d[i];
+		if(v < 0)
+			q[i] = -(int16_t)(((uint32_t)-v * r[i] + (1UL << 14)) >> 15);
+		else
+			q[i] = (int16_t)(((uint32_t)v * r[i] + (1UL << 14)) >> 15);
+	}
+
+	/*DC差分*/
+	v = q[0] - e->dc[c];
+	e->dc[c] = q[0];
+	cat = Jpeg_Cat(v);
+	o = Jpeg_Bits(e, o, jpeg_dc_code[t][cat], jpeg_dc_size[t][cat]);
+	if(cat)
+		o = Jpeg_Bits(e, o, (v < 0) ? v - 1 : v, cat);
+
+	/*AC按Z字形顺序，连续16个0写ZRL，末尾的0写EOB*/
+	run = 0;
+	for(k = 1; k < 64; k++)
+	{
+		v = q[jpeg_zigzag[k]];
+		if(v == 0)
+		{
+			run++;
+			continue;
+		}
+		while(run > 15)
+		{
+			o = Jpeg_Bits(e, o, jpeg_ac_code[t][0xF0], jpeg_ac_size[t][0xF0]);
+			run -= 16;
+		}
+		cat = Jpeg_Cat(v);
+		i = (run << 4) | cat;
+		o = Jpeg_Bits(e, o, jpeg_ac_code[t][i], jpeg_ac_size[t][i]);
+		o = Jpeg_Bits(e, o, (v < 0) ? v - 1 : v, cat);
+		run = 0;
+	}
+	if(run)
+		o = Jpeg_Bits(e, o, jpeg_ac_code[t][0x00], jpeg_ac_size[t][0x00]);
+	return o;
+}
+
+static uint8_t *Jpeg_Put16(uint8_t *o, uint16_t v)
+{
+	*o++ = v >> 8;
+	*o++ = v;
+	return o;
+}
+
+static uint8_t *Jpeg_Dht(uint8_t *o, uint8_t id, const uint8_t *bits, const uint8_t *val)
+{
+	uint8_t i, n = 0;
+
+	*o++ = id;
+	for(i = 0; i < 16; i++)
+	{
+		*o++ = bits[i];
+		n += bits[i];
+	}
+	for(i = 0; i < n; i++)
+		*o++ = val[i];
+	return o;
+}
+
+uint16_t Jpeg_Begin(JPEG_ENC *e, uint8_t *out, uint16_t width, uint16_t height, uint8_t pix)
+{
+	static const uint8_t jfif[14] = {'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0};
+	static const uint8_t dc_val[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+	uint8_t *o = out;
+	uint8_t t, i, tables;
+
+	e->pix = pix;
+	e->comps = (pix == JPEG_PIX_GRAY) ? 1 : 3;
+	e->width = width;
+	e->height = height;
+	e->dc[0] = e->dc[1] = e->dc[2] = 0;
+	e->acc = 0;
+	e->bits = 0;
+	tables = (e->comps == 1) ? 1 : 2;
+
+	o = Jpeg_Put16(o, 0xFFD8);                   /*SOI*/
+	o = Jpeg_Put16(o, 0xFFE0);                   /*APP0 JFIF*/
+	o = Jpeg_Put16(o, 2 + sizeof(jfif));
+	for(i = 0; i < sizeof(jfif); i++)
+		*o++ = jfif[i];
+
+	o = Jpeg_Put16(o, 0xFFDB);                   /*DQT，Z字形顺序*/
+	o = Jpeg_Put16(o, 2 + 65 * tables);
+	for(t = 0; t < tables; t++)
+	{
+		*o++ = t;
+		for(i = 0; i < 64; i++)
+			*o++ = e->qtbl[t][jpeg_zigzag[i]];
+	}
+
+	o = Jpeg_Put16(o, 0xFFC0);                   /*SOF0*/
+	o = Jpeg_Put16(o, 8 + 3 * e->comps);
+	*o++ = 8;
+	o = Jpeg_Put16(o, height);
+	o = Jpeg_Put16(o, width);
+	*o++ = e->comps;
+	for(i = 0; i < e->comps; i++)
+	{
+		*o++ = i + 1;
+		*o++ = (e->comps == 3 && i == 0) ? 0x22 : 0x11;
+		*o++ = (i == 0) ? 0 : 1;
+	}
+
+	o = Jpeg_Put16(o, 0xFFC4);                   /*DHT*/
+	o = Jpeg_Put16(o, 2 + tables * (17 + 12 + 17 + 162));
+	for(t = 0; t < tables; t++)
+	{
+		o = Jpeg_Dht(o, 0x00 | t, jpeg_dc_bits[t], dc_val);
+		o = Jpeg_Dht(o, 0x10 | t, jpeg_ac_bits[t], jpeg_ac_val[t]);
+	}
+
+	o = Jpeg_Put16(o, 0xFFDA);                   /*SOS*/
+	o = Jpeg_Put16(o, 6 + 2 * e->comps);
+	*o++ = e->comps;
+	for(i = 0; i < e->comps; i++)
+	{
+		*o++ = i + 1;
+		*o++ = (i == 0) ? 0x00 : 0x11;
+	}
+	*o++ = 0;
+	*o++ = 63;
+	*o++ = 0;
+	return o - out;
+}
+
+uint16_t Jpeg_Mcu(JPEG_ENC *e, const uint8_t *p, uint16_t stride, uint16_t x, uint8_t lines, uint8_t *out)
+{
+	uint8_t n = JPEG_MCU_LINES(e);
+	uint16_t last = e->width - 1;
+	uint8_t *o = out;
+	const uint8_t *row;
+	int16_t *y = e->y;
+	int32_t *d = e->blk;
+	uint16_t xx, v;
+	uint8_t i, j, k, r, g, b;
+	int32_t cb, cr;
+
+	for(i = 0; i < 64; i++)
+		e->cb[i] = e->cr[i] = 0;
+	for(j = 0; j < n; j++)
+	{
+		row = p + (uint32_t)((j < lines) ? j : lines - 1) * stride;
+		for(i = 0; i < n; i++)
+		{
+			xx = (x + i < last) ? x + i : last;
+			k = ((j >> 1) << 3) | (i >> 1);
+			if(e->pix == JPEG_PIX_GRAY)
+				y[j * 16 + i] = row[xx];
+			else if(e->pix == JPEG_PIX_YUYV)
+			{
+				y[j * 16 + i] = row[xx * 2];
+				e->cb[k] += row[(xx & ~1) * 2 + 1];
+				e->cr[k] += row[(xx & ~1) * 2 + 3];
+			}
+			else
+			{
+				v = (row[xx * 2] << 8) | row[xx * 2 + 1];   /*高字节在前*/
+				r = ((v >> 8) & 0xF8) | (v >> 13);
+				g = ((v >> 3) & 0xFC) | ((v >> 9) & 0x03);
+				b = ((v << 3) & 0xF8) | ((v >> 2) & 0x07);
+				y[j * 16 + i] = (77 * r + 150 * g + 29 * b + 128) >> 8;
+				cb = -43 * r - 85 * g + 128 * b;
+				cr = 128 * r - 107 * g - 21 * b;
+				e->cb[k] += (cb + 32768 + 128) >> 8;
+				e->cr[k] += (cr + 32768 + 128) >> 8;
+			}
+		}
+	}
+
+	/*Y：灰度1块，彩色4块*/
+	for(k = 0; k < ((e->comps == 1) ? 1 : 4); k++)
+	{
+		for(j = 0; j < 8; j++)
+			for(i = 0; i < 8; i++)
+				d[j * 8 + i] = y[(j + (k >> 1) * 8) * 16 + i + (k & 1) * 8] - 128;
+		o = Jpeg_Block(e, o, 0, 0);
+	}
+	if(e->comps == 3)
+	{
+		for(i = 0; i < 64; i++)
+			d[i] = ((e->cb[i] + 2) >> 2) - 128;
+		o = Jpeg_Block(e, o, 1, 1);
+		for(i = 0; i < 64; i++)
+			d[i] = ((e->cr[i] + 2) >> 2) - 128;
+		o = Jpeg_Block(e, o, 1, 2);
+	}
+	return o - out;
+}
+
+uint16_t Jpeg_End(JPEG_ENC *e, uint8_t *out)
+{
+	uint8_t *o = out;
+
+	if(e->bits)
+		o = Jpeg_Bits(e, o, 0x7F, 8 - e->bits);  /*不足一个字节补1*/
+	o = Jpeg_Put16(o, 0xFFD9);                   /*EOI*/
+	return o - out;
+}
@@ -0,0 +1,49 @@
+#ifndef __JPEG_H
+#define __JPEG_H
+
+#include <stdint.h>
+
+/*基线JPEG编码：AAN定点DCT + 标准Huffman表（附录K），灰度或YCbCr 4:2:0
+  按MCU行输入（灰度8行，彩色16行），输出标准JFIF码流，PC端任何JPEG库都能解*/
+
+/*像素类型，取值与OV7725_FORMAT_xxx相同*/
+#define JPEG_PIX_RGB565			0		/*2字节，转YCbCr 4:2:0*/
+#define JPEG_PIX_YUYV			1		/*2字节，直接取Y U V，U V隔行取平均*/
+#define JPEG_PIX_GRAY			2		/*1字节，单分量*/
+
+#define JPEG_HEAD_MAX			640		/*文件头最大字节数*/
+#define JPEG_MCU_MAX			2600	/*一个MCU编码后的最大字节数（含0xFF后补的0）*/
+#define JPEG_END_MAX			4		/*结束时补齐的字节和EOI*/
+
+#define JPEG_MCU_LINES(e)		(((e)->comps == 1) ? 8 : 16)
+
+typedef struct
+{
+	uint8_t  comps;                         /*1：灰度 3：YCbCr 4:2:0*/
+	uint8_t  pix;                           /*JPEG_PIX_xxx*/
+	uint8_t  quality;                       /*1~100*/
+	uint8_t  bits;                          /*acc中未写出的位数*/
+	uint16_t width;
+	uint16_t height;
+	uint32_t acc;
+	int16_t  dc[3];                         /*各分量上一块的DC*/
+	uint8_t  qtbl[2][64];                   /*写进DQT的量化表，自然顺序*/
+	uint16_t recip[2][64];                  /*量化除数的倒数（Q15），已含AAN的缩放*/
+	int16_t  y[256];                        /*一个MCU的Y，16x16（灰度只用8x8）*/
+	int16_t  cb[64];                        /*2x2求和后的Cb Cr*/
+	int16_t  cr[64];
+	int32_t  blk[64];                       /*DCT工作区*/
+}JPEG_ENC;
+
+/*设置质量1~100，按IJG的方法缩放标准量化表，下一帧开始用*/
+void Jpeg_Quality(JPEG_ENC *e, uint8_t quality);
+/*开始一帧：写文件头，返回字节数（不大于JPEG_HEAD_MAX）*/
+uint16_t Jpeg_Begin(JPEG_ENC *e, uint8_t *out, uint16_t width, uint16_t height, uint8_t pix);
+/*编一个MCU，返回字节数（不大于JPEG_MCU_MAX）
+  p指向这一MCU行的第一行，stride为行字节数，x为MCU左边的列，lines为这一MCU行实有的行数
+  右边、下边超出图像的像素重复最后一列、最后一行*/
+uint16_t Jpeg_Mcu(JPEG_ENC *e, const uint8_t *p, uint16_t stride, uint16_t x, uint8_t lines, uint8_t *out);
+/*结束一帧：补齐最后一个字节，写EOI，返回字节数*/
+uint16_t Jpeg_End(JPEG_ENC *e, uint8_t *out);
+
+#endif
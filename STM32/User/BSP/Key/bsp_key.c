@@ -1,5 +1,5 @@
 #include "bsp_key.h" 
-#include <includes.h>   //ʹuC/OSں˻ͷļ
+#include <includes.h>   //使用uC/OS内核机制须包含该头文件
 
 
 
@@ -53,18 +53,18 @@ static void Key2_Config ( void )
 
 
 /**
-  * @brief  ⰴǷ񱻵
-  * @param  GPIOx ڵĶ˿
-  * @param  GPIO_Pin ڵĹܽ
-  * @param  ucPushState ʱĵƽ
-  *   òΪֵ֮һ
-  *     @arg 1 :ߵƽ
-  *     @arg 0 :͵ƽ
-  * @param  pKeyPress ڴŰǷ񱻰¹Ǿ̬	
-  * @retval Ƿ񱻵
-	*   ÷ֵΪֵ֮һ
-  *     @arg 1 :
-  *     @arg 0 :δ
+  * @brief  检测按键是否被单击
+  * @param  GPIOx ：按键所在的端口
+  * @param  GPIO_Pin ：按键所在的管脚
+  * @param  ucPushState ：按键被按下时的电平极性
+  *   该参数为以下值之一：
+  *     @arg 1 :高电平
+  *     @arg 0 :低电平
+  * @param  pKeyPress ：用于存放按键是否被按下过，须是静态变量	
+  * @retval 按键是否被单击
+	*   该返回值为以下值之一：
+  *     @arg 1 :按键被单击
+  *     @arg 0 :按键未被单击
   */
 uint8_t Key_Scan ( GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, uint8_t ucPushState, uint8_t * pKeyPress )
 {			
@@ -76,7 +76,7 @@ uint8_t Key_Scan ( GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, uint8_t ucPushState,
 	
 	if ( ucKeyState == ucPushState )
 	{
-//		Key_Delay( 10000 );	         //ĳuC/OSʱ
+//		Key_Delay( 10000 );	         //改成uC/OS的延时函数
 		OSTimeDlyHMSM ( 0, 0, 0, 20, OS_OPT_TIME_DLY, & err );
 		
 		ucKeyState = GPIO_ReadInputDataBit ( GPIOx, GPIO_Pin );
@@ -97,17 +97,17 @@ uint8_t Key_Scan ( GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, uint8_t ucPushState,
 
 
 /**
-  * @brief  ⰴ״̬
-  * @param  GPIOx ڵĶ˿
-  * @param  GPIO_Pin ڵĹܽ
-  * @param  ucPushState ʱĵƽ
-  *   òΪֵ֮һ
-  *     @arg 1 :ߵƽ
-  *     @arg 0 :͵ƽ
-  * @retval ĵǰ״̬
-	*   ÷ֵΪֵ֮һ
-  *     @arg 1 :
-  *     @arg 0 :ͷ
+  * @brief  检测按键的状态
+  * @param  GPIOx ：按键所在的端口
+  * @param  GPIO_Pin ：按键所在的管脚
+  * @param  ucPushState ：按键被按下时的电平极性
+  *   该参数为以下值之一：
+  *     @arg 1 :高电平
+  *     @arg 0 :低电平
+  * @retval 按键的当前状态
+	*   该返回值为以下值之一：
+  *     @arg 1 :按键被按下
+  *     @arg 0 :按键被释放
   */
 uint8_t Key_ReadStatus ( GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, uint8_t ucPushState )
 {			
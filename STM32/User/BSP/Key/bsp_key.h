@@ -7,7 +7,7 @@
 
 
 
-/************************************  KEY1 *********************************/
+/************************************ 配置 KEY1 *********************************/
 #define               macKEY1_GPIO_CLK                      RCC_APB2Periph_GPIOA
 #define               macKEY1_GPIO_PORT    	                GPIOA			   
 #define               macKEY1_GPIO_PIN		                  GPIO_Pin_0
@@ -15,7 +15,7 @@
 
 
 
-/************************************  KEY2 *********************************/
+/************************************ 配置 KEY2 *********************************/
 #define               macKEY2_GPIO_CLK                      RCC_APB2Periph_GPIOC
 #define               macKEY2_GPIO_PORT    	                GPIOC
 #define               macKEY2_GPIO_PIN		                  GPIO_Pin_13
@@ -4,20 +4,20 @@
   * @author  fire
   * @version V1.0
   * @date    2013-xx-xx
-  * @brief   TIM2 1ms ʱӦbsp
+  * @brief   TIM2 1ms 定时应用bsp
   ******************************************************************************
   * @attention
   *
-  * ʵƽ̨:Ұ ISO-MINI STM32  
-  * ̳    :http://www.firebbs.cn
-  * Ա    :https://fire-stm32.taobao.com
+  * 实验平台:野火 ISO-MINI STM32 开发板 
+  * 论坛    :http://www.firebbs.cn
+  * 淘宝    :https://fire-stm32.taobao.com
   *
   ******************************************************************************
   */ 
 
 #include "bsp_TiMbase.h" 
 
-/// TIM2жȼ
+/// TIM2中断优先级配置
 void TIM2_NVIC_Configuration(void)
 {
     NVIC_InitTypeDef NVIC_InitStructure; 
@@ -32,26 +32,26 @@ void TIM2_NVIC_Configuration(void)
 
 /*
  * TIM_Period / Auto Reload Register(ARR) = 1000   TIM_Prescaler--71 
- * жΪ = 1/(72MHZ /72) * 1000 = 1ms
+ * 中断周期为 = 1/(72MHZ /72) * 1000 = 1ms
  *
- * TIMxCLK/CK_PSC --> TIMxCNT --> TIM_Period(ARR) --> ж TIMxCNTΪ0¼ 
+ * TIMxCLK/CK_PSC --> TIMxCNT --> TIM_Period(ARR) --> 中断 且TIMxCNT重置为0重新计数 
  */
 void TIM2_Configuration(void)
 {
     TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
 		
-		/* TIM2CLK Ϊ 72MHZ */
+		/* 设置TIM2CLK 为 72MHZ */
     RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2 , ENABLE);
     //TIM_DeInit(TIM2);
 	
-	/* ԶװؼĴڵֵ(ֵ) */
+	/* 自动重装载寄存器周期的值(计数值) */
     TIM_TimeBaseStructure.TIM_Period=1000;
 	
-    /* ۼ TIM_PeriodƵʺһ»ж */
-	  /* ʱԤƵΪ72 */
+    /* 累计 TIM_Period个频率后产生一个更新或者中断 */
+	  /* 时钟预分频数为72 */
     TIM_TimeBaseStructure.TIM_Prescaler= 71;
 	
-		/* ⲿʱӽвʱӷƵ,ûõ */
+		/* 对外部时钟进行采样的时钟分频,这里没有用到 */
     TIM_TimeBaseStructure.TIM_ClockDivision=TIM_CKD_DIV1;
 	
     TIM_TimeBaseStructure.TIM_CounterMode=TIM_CounterMode_Up; 
@@ -63,6 +63,6 @@ void TIM2_Configuration(void)
 		
     TIM_Cmd(TIM2, ENABLE);																		
     
-    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2 , DISABLE);		/*ȹرյȴʹ*/    
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2 , DISABLE);		/*先关闭等待使用*/    
 }
 /*********************************************END OF FILE**********************/
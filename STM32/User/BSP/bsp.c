@@ -170,17 +170,17 @@ void SystemReset(void)
 
 void  BSP_Init (void)
 {
-	Key_Initial ();     //ʼ
+	Key_Initial ();     //初始化按键
 	
-	LED_Init ();        //ʼ LED
+	LED_Init ();        //初始化 LED
 	
-	USARTx_Config ();   //ʼ USART1
+	USARTx_Config ();   //初始化 USART1
 	
-	ILI9341_Init();			//Һʼ
+	ILI9341_Init();			//液晶屏初始化
 	
-	Camera_Init();			//ͷʼ
+	Camera_Init();			//摄像头初始化
 	
-	W5500_Init();  			//W5500ʼ
+	W5500_Init();  			//W5500初始化
 	
 }
 
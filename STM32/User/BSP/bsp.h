@@ -71,31 +71,32 @@
 #include  <lib_mem.h>
 #include  <lib_str.h>
 
-#include "stm32f10x.h"          // Modified by fire (ԭ #include  <stm32f10x_lib.h>)  
+#include "stm32f10x.h"          // Modified by fire (原是 #include  <stm32f10x_lib.h>)  
 #include "misc.h"
 
 #include  <app_cfg.h>
 
-#include "bsp_key.h"            // Modified by fire (ûʹİʹԼļ)
+#include "bsp_key.h"            // Modified by fire (没有使用评估板的板载驱动，使用自己的裸机板载驱动文件)
 #include "bsp_led.h"           
 #include "bsp_usart1.h"
 
-//OV7725ͷļ
+//OV7725的头文件
 #include "./ov7725/bsp_ov7725.h"
+#include "./ov7725/bsp_ov7725_dma.h"
 #include "./lcd/bsp_ili9341_lcd.h"
 #include "./sccb/bsp_sccb.h"
 #include "./font/fonts.h"
 
-//W5500ͷļ
+//W5500头文件
 #include "w5500.h"
 #include "W5500_conf.h"
 #include "socket.h"
 #include "utility.h"
 
-//IMAGE_APPͷļ
+//IMAGE_APP头文件
 #include "image.h"
 
-//Źͷļ
+//看门狗头文件
 #include "bsp_iwdg.h"
 
 
@@ -4,21 +4,21 @@
   * @file    bsp_ili9341_lcd.c
   * @version V1.0
   * @date    2013-xx-xx
-  * @brief   Һģأ֧Ӣģ
+  * @brief   液晶屏字模相关（仅支持英文）
   ******************************************************************************
   * @attention
   *
-  * ʵƽ̨: F103-ָ STM32  
-  * ̳    :http://www.firebbs.cn
-  * Ա    :https://fire-stm32.taobao.com
+  * 实验平台:秉火 F103-指南者 STM32 开发板 
+  * 论坛    :http://www.firebbs.cn
+  * 淘宝    :https://fire-stm32.taobao.com
   *
   ******************************************************************************
   */ 
 #include "./font/fonts.h"
 /*
- * ASCIIƫ32С:16߶ȣ* 8 ȣ
+ * 常用ASCII表，偏移量32，大小:16（高度）* 8 （宽度）
  */
-const uint8_t ASCII8x16_Table [ ] = {       //@conslons壬ʽ˳ȡ
+const uint8_t ASCII8x16_Table [ ] = {       //@conslons字体，阴码点阵格式，逐行顺向取摸
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x08,0x00,0x08,0x18,0x00,0x00,0x00,
 0x00,0x00,0x00,0x34,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -117,9 +117,9 @@ const uint8_t ASCII8x16_Table [ ] = {       //@conslons
 };  
 
 /*
- * ASCIIƫ32С:24߶ȣ* 16 ȣ
+ * 常用ASCII表，偏移量32，大小:24（高度）* 16 （宽度）
  */
-const uint8_t ASCII16x24_Table [ ] = {       //@conslons壬ʽ˳ȡ
+const uint8_t ASCII16x24_Table [ ] = {       //@conslons字体，阴码点阵格式，逐行顺向取摸
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -408,9 +408,9 @@ const uint8_t ASCII16x24_Table [ ] = {       //@conslons
 };
 
 /*
- * ASCIIƫ32С:32߶ȣ* 24 ȣ
+ * 常用ASCII表，偏移量32，大小:32（高度）* 24 （宽度）
  */
-const uint8_t ASCII24x32_Table [ ] = {       //@conslons壬ʽ˳ȡ
+const uint8_t ASCII24x32_Table [ ] = {       //@conslons字体，阴码点阵格式，逐行顺向取摸
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -23,7 +23,7 @@ extern sFONT Font24x32;
 extern sFONT Font16x24;
 extern sFONT Font8x16;
 
-//Ҫ֧ҪʵֱɲοҺʾӢģֿⲿFLASH
+//要支持中文需要实现本函数，可参考“液晶显示中英文（字库在外部FLASH）”例程
 #define      GetGBKCode( ucBuffer, usChar ) 
 
 
@@ -2,10 +2,10 @@
 #include "bsp_iwdg.h"   
 
 /*
- *  IWDG ĳʱʱ
+ * 设置 IWDG 的超时时间
  * Tout = prv/40 * rlv (s)
- *      prv[4,8,16,32,64,128,256]
- * prv:ԤƵֵȡֵ£
+ *      prv可以是[4,8,16,32,64,128,256]
+ * prv:预分频器值，取值如下：
  *     @arg IWDG_Prescaler_4: IWDG prescaler set to 4
  *     @arg IWDG_Prescaler_8: IWDG prescaler set to 8
  *     @arg IWDG_Prescaler_16: IWDG prescaler set to 16
@@ -14,34 +14,34 @@
  *     @arg IWDG_Prescaler_128: IWDG prescaler set to 128
  *     @arg IWDG_Prescaler_256: IWDG prescaler set to 256
  *
- * rlv:ԤƵֵȡֵΧΪ0-0XFFF
- * þ
- * IWDG_Config(IWDG_Prescaler_64 ,625);  // IWDG 1s ʱ
+ * rlv:预分频器值，取值范围为：0-0XFFF
+ * 函数调用举例：
+ * IWDG_Config(IWDG_Prescaler_64 ,625);  // IWDG 1s 超时溢出
  */
 
 void IWDG_Config(uint8_t prv ,uint16_t rlv)
 {	
-	// ʹ ԤƵĴPRװؼĴRLRд
+	// 使能 预分频寄存器PR和重装载寄存器RLR可写
 	IWDG_WriteAccessCmd( IWDG_WriteAccess_Enable );
 	
-	// ԤƵֵ
+	// 设置预分频器值
 	IWDG_SetPrescaler( prv );
 	
-	// װؼĴֵ
+	// 设置重装载寄存器值
 	IWDG_SetReload( rlv );
 	
-	// װؼĴֵŵ
+	// 把重装载寄存器的值放到计数器中
 	IWDG_ReloadCounter();
 	
-	// ʹ IWDG
+	// 使能 IWDG
 	IWDG_Enable();	
 }
 
-// ι
+// 喂狗
 void IWDG_Feed(void)
 {
-	// װؼĴֵŵУιֹIWDGλ
-	// ֵ0ʱϵͳλ
+	// 把重装载寄存器的值放到计数器中，喂狗，防止IWDG复位
+	// 当计数器的值减到0的时候会产生系统复位
 	IWDG_ReloadCounter();
 }
 
@@ -3,13 +3,13 @@
   * @file    bsp_ili9341_lcd.c
   * @version V1.0
   * @date    2013-xx-xx
-  * @brief   ili9341Һ
+  * @brief   ili9341液晶屏驱动
   ******************************************************************************
   * @attention
   *
-  * ʵƽ̨: F103-ָ STM32  
-  * ̳    :http://www.firebbs.cn
-  * Ա    :https://fire-stm32.taobao.com
+  * 实验平台:秉火 F103-指南者 STM32 开发板 
+  * 论坛    :http://www.firebbs.cn
+  * 淘宝    :https://fire-stm32.taobao.com
   *
   ******************************************************************************
   */ 
@@ -17,21 +17,21 @@
 #include "./lcd/bsp_ili9341_lcd.h"
 #include "./font/fonts.h"	
 
-//Һɨ跽仯XYؿ
-//ILI9341_GramScan÷ʱԶ
+//根据液晶扫描方向而变化的XY像素宽度
+//调用ILI9341_GramScan函数设置方向时会自动更改
 uint16_t LCD_X_LENGTH = ILI9341_LESS_PIXEL;
 uint16_t LCD_Y_LENGTH = ILI9341_MORE_PIXEL;
 
-//ҺɨģʽҪڷѡļ
-//ѡֵΪ0-7
-//ILI9341_GramScan÷ʱԶ
-//LCDճʼʱʹñĬֵ
+//液晶屏扫描模式，本变量主要用于方便选择触摸屏的计算参数
+//参数可选值为0-7
+//调用ILI9341_GramScan函数设置方向时会自动更改
+//LCD刚初始化完成时会使用本默认值
 uint8_t LCD_SCAN_MODE = 3;
 
 
-static sFONT *LCD_Currentfonts = &Font8x16;  //Ӣ
-static uint16_t CurrentTextColor   = BLACK;//ǰɫ
-static uint16_t CurrentBackColor   = WHITE;//ɫ
+static sFONT *LCD_Currentfonts = &Font8x16;  //英文字体
+static uint16_t CurrentTextColor   = BLACK;//前景色
+static uint16_t CurrentBackColor   = WHITE;//背景色
 
 
 static void                   ILI9341_Delay               ( __IO uint32_t nCount );
@@ -46,9 +46,9 @@ static uint16_t               ILI9341_Read_PixelData      ( void );
 
 
 /**
-  * @brief  ILI9341д
-  * @param  usCmd :ҪдĴַ
-  * @retval 
+  * @brief  向ILI9341写入命令
+  * @param  usCmd :要写入的命令（表寄存器地址）
+  * @retval 无
   */	
  void ILI9341_Write_Cmd ( uint16_t usCmd )
 {
@@ -58,9 +58,9 @@ static uint16_t               ILI9341_Read_PixelData      ( void );
 
 
 /**
-  * @brief  ILI9341д
-  * @param  usData :Ҫд
-  * @retval 
+  * @brief  向ILI9341写入数据
+  * @param  usData :要写入的数据
+  * @retval 无
   */	
  void ILI9341_Write_Data ( uint16_t usData )
 {
@@ -70,9 +70,9 @@ static uint16_t               ILI9341_Read_PixelData      ( void );
 
 
 /**
-  * @brief  ILI9341ȡ
-  * @param  
-  * @retval ȡ
+  * @brief  从ILI9341读取数据
+  * @param  无
+  * @retval 读取到的数据
   */	
  uint16_t ILI9341_Read_Data ( void )
 {
@@ -82,9 +82,9 @@ static uint16_t               ILI9341_Read_PixelData      ( void );
 
 
 /**
-  * @brief   ILI9341 ʱ
-  * @param  nCount ʱֵ
-  * @retval 
+  * @brief  用于 ILI9341 简单延时函数
+  * @param  nCount ：延时计数值
+  * @retval 无
   */	
 static void ILI9341_Delay ( __IO uint32_t nCount )
 {
@@ -94,20 +94,20 @@ static void ILI9341_Delay ( __IO uint32_t nCount )
 
 
 /**
-  * @brief  ʼILI9341IO
-  * @param  
-  * @retval 
+  * @brief  初始化ILI9341的IO引脚
+  * @param  无
+  * @retval 无
   */
 static void ILI9341_GPIO_Config ( void )
 {
 	GPIO_InitTypeDef GPIO_InitStructure;
 
-	/* ʹFSMCӦӦܽʱ*/
+	/* 使能FSMC对应相应管脚时钟*/
 	RCC_APB2PeriphClockCmd ( 	
-													/*ź*/
+													/*控制信号*/
 													ILI9341_CS_CLK|ILI9341_DC_CLK|ILI9341_WR_CLK|
 													ILI9341_RD_CLK	|ILI9341_BK_CLK|ILI9341_RST_CLK|
-													/*ź*/
+													/*数据信号*/
 													ILI9341_D0_CLK|ILI9341_D1_CLK|	ILI9341_D2_CLK | 
 													ILI9341_D3_CLK | ILI9341_D4_CLK|ILI9341_D5_CLK|
 													ILI9341_D6_CLK | ILI9341_D7_CLK|ILI9341_D8_CLK|
@@ -116,7 +116,7 @@ static void ILI9341_GPIO_Config ( void )
 													ILI9341_D15_CLK	, ENABLE );
 		
 	
-	/* FSMCӦ,FSMC-D0~D15 */	
+	/* 配置FSMC相对应的数据线,FSMC-D0~D15 */	
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
 	GPIO_InitStructure.GPIO_Mode =  GPIO_Mode_AF_PP;
 	
@@ -170,7 +170,7 @@ static void ILI9341_GPIO_Config ( void )
 	
 
 	
-	/* FSMCӦĿ
+	/* 配置FSMC相对应的控制线
 	 * FSMC_NOE   :LCD-RD
 	 * FSMC_NWE   :LCD-WR
 	 * FSMC_NE1   :LCD-CS
@@ -192,7 +192,7 @@ static void ILI9341_GPIO_Config ( void )
 	GPIO_Init ( ILI9341_DC_PORT, & GPIO_InitStructure );
 	
 
-  /* LCDλRSTƹܽ*/
+  /* 配置LCD复位RST控制管脚*/
 	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
 	
@@ -200,7 +200,7 @@ static void ILI9341_GPIO_Config ( void )
 	GPIO_Init ( ILI9341_RST_PORT, & GPIO_InitStructure );
 	
 	
-	/* LCDƹܽBK*/
+	/* 配置LCD背光控制管脚BK*/
 	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;  
 	
@@ -210,34 +210,34 @@ static void ILI9341_GPIO_Config ( void )
 
 
  /**
-  * @brief  LCD  FSMC ģʽ
-  * @param  
-  * @retval 
+  * @brief  LCD  FSMC 模式配置
+  * @param  无
+  * @retval 无
   */
 static void ILI9341_FSMC_Config ( void )
 {
 	FSMC_NORSRAMInitTypeDef  FSMC_NORSRAMInitStructure;
 	FSMC_NORSRAMTimingInitTypeDef  readWriteTiming; 	
 	
-	/* ʹFSMCʱ*/
+	/* 使能FSMC时钟*/
 	RCC_AHBPeriphClockCmd ( RCC_AHBPeriph_FSMC, ENABLE );
 
-	//ַʱ䣨ADDSETΪ1HCLK 2/72M=28ns
-	readWriteTiming.FSMC_AddressSetupTime      = 0x01;	 //ַʱ
-	//ݱʱ䣨DATAST+ 1HCLK = 5/72M=70ns	
-	readWriteTiming.FSMC_DataSetupTime         = 0x04;	 //ݽʱ
-	//ѡƵģʽ
-	//ģʽB,첽NOR FLASHģʽILI93418080ʱƥ
+	//地址建立时间（ADDSET）为1个HCLK 2/72M=28ns
+	readWriteTiming.FSMC_AddressSetupTime      = 0x01;	 //地址建立时间
+	//数据保持时间（DATAST）+ 1个HCLK = 5/72M=70ns	
+	readWriteTiming.FSMC_DataSetupTime         = 0x04;	 //数据建立时间
+	//选择控制的模式
+	//模式B,异步NOR FLASH模式，与ILI9341的8080时序匹配
 	readWriteTiming.FSMC_AccessMode            = FSMC_AccessMode_B;	
 	
-	/*ģʽB޹*/
-	//ַʱ䣨ADDHLDģʽAδõ
-	readWriteTiming.FSMC_AddressHoldTime       = 0x00;	 //ַʱ
-	//תڣڸģʽNOR
+	/*以下配置与模式B无关*/
+	//地址保持时间（ADDHLD）模式A未用到
+	readWriteTiming.FSMC_AddressHoldTime       = 0x00;	 //地址保持时间
+	//设置总线转换周期，仅用于复用模式的NOR操作
 	readWriteTiming.FSMC_BusTurnAroundDuration = 0x00;
-	//ʱӷƵͬ͵Ĵ洢
+	//设置时钟分频，仅用于同步类型的存储器
 	readWriteTiming.FSMC_CLKDivision           = 0x00;
-	//ݱʱ䣬ͬ͵NOR	
+	//数据保持时间，仅用于同步型的NOR	
 	readWriteTiming.FSMC_DataLatency           = 0x00;	
 
 	
@@ -259,7 +259,7 @@ static void ILI9341_FSMC_Config ( void )
 	FSMC_NORSRAMInit ( & FSMC_NORSRAMInitStructure ); 
 	
 	
-	/* ʹ FSMC_Bank1_NORSRAM4 */
+	/* 使能 FSMC_Bank1_NORSRAM4 */
 	FSMC_NORSRAMCmd ( FSMC_Bank1_NORSRAMx, ENABLE );  
 		
 		
@@ -267,9 +267,9 @@ static void ILI9341_FSMC_Config ( void )
 
 
 /**
- * @brief  ʼILI9341Ĵ
- * @param  
- * @retval 
+ * @brief  初始化ILI9341寄存器
+ * @param  无
+ * @retval 无
  */
 static void ILI9341_REG_Config ( void )
 {
@@ -394,7 +394,7 @@ static void ILI9341_REG_Config ( void )
 	/* memory access control set */
 	DEBUG_DELAY ();
 	ILI9341_Write_Cmd ( 0x36 ); 	
-	ILI9341_Write_Data ( 0xC8 );    /*  Ͻǵ ()½ (յ)ɨ跽ʽ*/
+	ILI9341_Write_Data ( 0xC8 );    /*竖屏  左上角到 (起点)到右下角 (终点)扫描方式*/
 	DEBUG_DELAY ();
 	
 	/* column address control set */
@@ -430,40 +430,40 @@ static void ILI9341_REG_Config ( void )
 
 
 /**
- * @brief  ILI9341ʼҪõlcdһҪ
- * @param  
- * @retval 
+ * @brief  ILI9341初始化函数，如果要用到lcd，一定要调用这个函数
+ * @param  无
+ * @retval 无
  */
 void ILI9341_Init ( void )
 {
 	ILI9341_GPIO_Config ();
 	ILI9341_FSMC_Config ();
 	
-	ILI9341_BackLed_Control ( ENABLE );      //LCD
+	ILI9341_BackLed_Control ( ENABLE );      //点亮LCD背光灯
 	ILI9341_Rst ();
 	ILI9341_REG_Config ();
 	
-	//Ĭɨ跽 6 ģʽΪ󲿷Һ̵Ĭʾ    Ϊģʽ3 
+	//设置默认扫描方向，其中 6 模式为大部分液晶例程的默认显示方向    更改为模式3 
 	ILI9341_GramScan(LCD_SCAN_MODE);
 	
-	//LCDʾʼ
+	//LCD显示初始化
 	LCD_SetFont(&Font8x16);
 	LCD_SetColors(RED,BLACK);
 	
-	ILI9341_Clear(0,0,LCD_X_LENGTH,LCD_Y_LENGTH);	/* ʾȫ */
+	ILI9341_Clear(0,0,LCD_X_LENGTH,LCD_Y_LENGTH);	/* 清屏，显示全黑 */
 	
 	ILI9341_DispStringLine_EN(LINE(0),"BH OV7725 Test Demo");
-	printf("\r\n ** ILI9341ʼɹ ** \r\n");
+	printf("\r\n ** ILI9341初始化成功 ** \r\n");
 }
 
 
 /**
- * @brief  ILI9341LED
- * @param  enumState ǷʹܱLED
-  *   òΪֵ֮һ
-  *     @arg ENABLE :ʹܱLED
-  *     @arg DISABLE :ñLED
- * @retval 
+ * @brief  ILI9341背光LED控制
+ * @param  enumState ：决定是否使能背光LED
+  *   该参数为以下值之一：
+  *     @arg ENABLE :使能背光LED
+  *     @arg DISABLE :禁用背光LED
+ * @retval 无
  */
 void ILI9341_BackLed_Control ( FunctionalState enumState )
 {
@@ -477,13 +477,13 @@ void ILI9341_BackLed_Control ( FunctionalState enumState )
 
 
 /**
- * @brief  ILI9341 λ
- * @param  
- * @retval 
+ * @brief  ILI9341 软件复位
+ * @param  无
+ * @retval 无
  */
 void ILI9341_Rst ( void )
 {			
-	GPIO_ResetBits ( ILI9341_RST_PORT, ILI9341_RST_PIN );	 //͵ƽλ
+	GPIO_ResetBits ( ILI9341_RST_PORT, ILI9341_RST_PIN );	 //低电平复位
 
 	ILI9341_Delay ( 0xAFF ); 					   
 
@@ -497,42 +497,42 @@ void ILI9341_Rst ( void )
 
 
 /**
- * @brief  ILI9341GRAMɨ跽 
- * @param  ucOption ѡGRAMɨ跽 
- *     @arg 0-7 :ѡֵΪ0-7˸
+ * @brief  设置ILI9341的GRAM的扫描方向 
+ * @param  ucOption ：选择GRAM的扫描方向 
+ *     @arg 0-7 :参数可选值为0-7这八个方向
  *
- *	0356 ģʽʺϴʾ֣
- *				Ƽʹģʽʾ	ģʽʾֻоЧ			
+ *	！！！其中0、3、5、6 模式适合从左至右显示文字，
+ *				不推荐使用其它模式显示文字	其它模式显示文字会有镜像效果			
  *		
- *	0246 ģʽXΪ240YΪ320
- *	1357 ģʽXΪ320YΪ240
+ *	其中0、2、4、6 模式的X方向像素为240，Y方向像素为320
+ *	其中1、3、5、7 模式下X方向像素为320，Y方向像素为240
  *
- *	 6 ģʽΪ󲿷Һ̵Ĭʾ
- *	 3 ģʽΪͷʹõķ
- *	 0 ģʽΪBMPͼƬʾʹõķ
+ *	其中 6 模式为大部分液晶例程的默认显示方向
+ *	其中 3 模式为摄像头例程使用的方向
+ *	其中 0 模式为BMP图片显示例程使用的方向
  *
- * @retval 
- * @note  ͼAʾϣVʾ£<ʾ>ʾ
-					XʾXᣬYʾY
+ * @retval 无
+ * @note  坐标图例：A表示向上，V表示向下，<表示向左，>表示向右
+					X表示X轴，Y表示Y轴
 
 ------------------------------------------------------------
-ģʽ0				.		ģʽ1		.	ģʽ2			.	ģʽ3					
+模式0：				.		模式1：		.	模式2：			.	模式3：					
 					A		.					A		.		A					.		A									
 					|		.					|		.		|					.		|							
 					Y		.					X		.		Y					.		X					
 					0		.					1		.		2					.		3					
 	<--- X0 o		.	<----Y1	o		.		o 2X--->  .		o 3Y--->	
 ------------------------------------------------------------	
-ģʽ4				.	ģʽ5			.	ģʽ6			.	ģʽ7					
+模式4：				.	模式5：			.	模式6：			.	模式7：					
 	<--- X4 o		.	<--- Y5 o		.		o 6X--->  .		o 7Y--->	
 					4		.					5		.		6					.		7	
 					Y		.					X		.		Y					.		X						
 					|		.					|		.		|					.		|							
 					V		.					V		.		V					.		V		
 ---------------------------------------------------------				
-											 LCDʾ
+											 LCD屏示例
 								|-----------------|
-								|			Logo		|
+								|			秉火Logo		|
 								|									|
 								|									|
 								|									|
@@ -542,46 +542,46 @@ void ILI9341_Rst ( void )
 								|									|
 								|									|
 								|-----------------|
-								Ļ棨240320
+								屏幕正面（宽240，高320）
 
  *******************************************************/
 void ILI9341_GramScan ( uint8_t ucOption )
 {	
-	//飬ֻ0-7
+	//参数检查，只可输入0-7
 	if(ucOption >7 )
 		return;
 	
-	//ģʽLCD_SCAN_MODEֵҪڴѡ
+	//根据模式更新LCD_SCAN_MODE的值，主要用于触摸屏选择计算参数
 	LCD_SCAN_MODE = ucOption;
 	
-	//ģʽXYؿ
+	//根据模式更新XY方向的像素宽度
 	if(ucOption%2 == 0)	
 	{
-		//0 2 4 6ģʽXؿΪ240YΪ320
+		//0 2 4 6模式下X方向像素宽度为240，Y方向为320
 		LCD_X_LENGTH = ILI9341_LESS_PIXEL;
 		LCD_Y_LENGTH =	ILI9341_MORE_PIXEL;
 	}
 	else				
 	{
-		//1 3 5 7ģʽXؿΪ320YΪ240
+		//1 3 5 7模式下X方向像素宽度为320，Y方向为240
 		LCD_X_LENGTH = ILI9341_MORE_PIXEL;
 		LCD_Y_LENGTH =	ILI9341_LESS_PIXEL; 
 	}
 
-	//0x36ĸ3λGRAMɨ跽	
+	//0x36命令参数的高3位可用于设置GRAM扫描方向	
 	ILI9341_Write_Cmd ( 0x36 ); 
-	ILI9341_Write_Data ( 0x08 |(ucOption<<5));//ucOptionֵLCD0-7ģʽ
+	ILI9341_Write_Data ( 0x08 |(ucOption<<5));//根据ucOption的值设置LCD参数，共0-7种模式
 	ILI9341_Write_Cmd ( CMD_SetCoordinateX ); 
-	ILI9341_Write_Data ( 0x00 );		/* x ʼ8λ */
-	ILI9341_Write_Data ( 0x00 );		/* x ʼ8λ */
-	ILI9341_Write_Data ( ((LCD_X_LENGTH-1)>>8)&0xFF ); /* x 8λ */	
-	ILI9341_Write_Data ( (LCD_X_LENGTH-1)&0xFF );				/* x 8λ */
+	ILI9341_Write_Data ( 0x00 );		/* x 起始坐标高8位 */
+	ILI9341_Write_Data ( 0x00 );		/* x 起始坐标低8位 */
+	ILI9341_Write_Data ( ((LCD_X_LENGTH-1)>>8)&0xFF ); /* x 结束坐标高8位 */	
+	ILI9341_Write_Data ( (LCD_X_LENGTH-1)&0xFF );				/* x 结束坐标低8位 */
 
 	ILI9341_Write_Cmd ( CMD_SetCoordinateY ); 
-	ILI9341_Write_Data ( 0x00 );		/* y ʼ8λ */
-	ILI9341_Write_Data ( 0x00 );		/* y ʼ8λ */
-	ILI9341_Write_Data ( ((LCD_Y_LENGTH-1)>>8)&0xFF );	/* y 8λ */	 
-	ILI9341_Write_Data ( (LCD_Y_LENGTH-1)&0xFF );				/* y 8λ */
+	ILI9341_Write_Data ( 0x00 );		/* y 起始坐标高8位 */
+	ILI9341_Write_Data ( 0x00 );		/* y 起始坐标低8位 */
+	ILI9341_Write_Data ( ((LCD_Y_LENGTH-1)>>8)&0xFF );	/* y 结束坐标高8位 */	 
+	ILI9341_Write_Data ( (LCD_Y_LENGTH-1)&0xFF );				/* y 结束坐标低8位 */
 
 	/* write gram start */
 	ILI9341_Write_Cmd ( CMD_SetPixel );	
@@ -590,22 +590,22 @@ void ILI9341_GramScan ( uint8_t ucOption )
 
 
 /**
- * @brief  ILI9341ʾϿһ
- * @param  usX ضɨ跽´ڵX
- * @param  usY ضɨ跽´ڵY
- * @param  usWidth ڵĿ
- * @param  usHeight ڵĸ߶
- * @retval 
+ * @brief  在ILI9341显示器上开辟一个窗口
+ * @param  usX ：在特定扫描方向下窗口的起点X坐标
+ * @param  usY ：在特定扫描方向下窗口的起点Y坐标
+ * @param  usWidth ：窗口的宽度
+ * @param  usHeight ：窗口的高度
+ * @retval 无
  */
 void ILI9341_OpenWindow ( uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight )
 {	
-	ILI9341_Write_Cmd ( CMD_SetCoordinateX ); 				 /* X */
-	ILI9341_Write_Data ( usX >> 8  );	 /* ȸ8λȻ8λ */
-	ILI9341_Write_Data ( usX & 0xff  );	 /* ʼͽ*/
+	ILI9341_Write_Cmd ( CMD_SetCoordinateX ); 				 /* 设置X坐标 */
+	ILI9341_Write_Data ( usX >> 8  );	 /* 先高8位，然后低8位 */
+	ILI9341_Write_Data ( usX & 0xff  );	 /* 设置起始点和结束点*/
 	ILI9341_Write_Data ( ( usX + usWidth - 1 ) >> 8  );
 	ILI9341_Write_Data ( ( usX + usWidth - 1 ) & 0xff  );
 
-	ILI9341_Write_Cmd ( CMD_SetCoordinateY ); 			     /* Y*/
+	ILI9341_Write_Cmd ( CMD_SetCoordinateY ); 			     /* 设置Y坐标*/
 	ILI9341_Write_Data ( usY >> 8  );
 	ILI9341_Write_Data ( usY & 0xff  );
 	ILI9341_Write_Data ( ( usY + usHeight - 1 ) >> 8 );
@@ -615,10 +615,10 @@ void ILI9341_OpenWindow ( uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t
 
 
 /**
- * @brief  趨ILI9341Ĺ
- * @param  usX ضɨ跽¹X
- * @param  usY ضɨ跽¹Y
- * @retval 
+ * @brief  设定ILI9341的光标坐标
+ * @param  usX ：在特定扫描方向下光标的X坐标
+ * @param  usY ：在特定扫描方向下光标的Y坐标
+ * @retval 无
  */
 static void ILI9341_SetCursor ( uint16_t usX, uint16_t usY )	
 {
@@ -627,10 +627,10 @@ static void ILI9341_SetCursor ( uint16_t usX, uint16_t usY )
 
 
 /**
- * @brief  ILI9341ʾĳһɫص
- * @param  ulAmout_Point ҪɫصĿ
- * @param  usColor ɫ
- * @retval 
+ * @brief  在ILI9341显示器上以某一颜色填充像素点
+ * @param  ulAmout_Point ：要填充颜色的像素点的总数目
+ * @param  usColor ：颜色
+ * @retval 无
  */
 static __inline void ILI9341_FillColor ( uint32_t ulAmout_Point, uint16_t usColor )
 {
@@ -648,13 +648,13 @@ static __inline void ILI9341_FillColor ( uint32_t ulAmout_Point, uint16_t usColo
 
 
 /**
- * @brief  ILI9341ʾĳһĳɫ
- * @param  usX ضɨ跽´ڵX
- * @param  usY ضɨ跽´ڵY
- * @param  usWidth ڵĿ
- * @param  usHeight ڵĸ߶
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  对ILI9341显示器的某一窗口以某种颜色进行清屏
+ * @param  usX ：在特定扫描方向下窗口的起点X坐标
+ * @param  usY ：在特定扫描方向下窗口的起点Y坐标
+ * @param  usWidth ：窗口的宽度
+ * @param  usHeight ：窗口的高度
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_Clear ( uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight )
 {
@@ -666,11 +666,11 @@ void ILI9341_Clear ( uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHe
 
 
 /**
- * @brief  ILI9341ʾĳһĳɫ
- * @param  usX ضɨ跽¸õX
- * @param  usY ضɨ跽¸õY
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  对ILI9341显示器的某一点以某种颜色进行填充
+ * @param  usX ：在特定扫描方向下该点的X坐标
+ * @param  usY ：在特定扫描方向下该点的Y坐标
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_SetPointPixel ( uint16_t usX, uint16_t usY )	
 {	
@@ -685,16 +685,16 @@ void ILI9341_SetPointPixel ( uint16_t usX, uint16_t usY )
 
 
 /**
- * @brief  ȡILI9341 GRAN һ
- * @param  
- * @retval 
+ * @brief  读取ILI9341 GRAN 的一个像素数据
+ * @param  无
+ * @retval 像素数据
  */
 static uint16_t ILI9341_Read_PixelData ( void )	
 {	
 	uint16_t usR=0, usG=0, usB=0 ;
 
 	
-	ILI9341_Write_Cmd ( 0x2E );   /*  */
+	ILI9341_Write_Cmd ( 0x2E );   /* 读数据 */
 	
 	usR = ILI9341_Read_Data (); 	/*FIRST READ OUT DUMMY DATA*/
 	
@@ -708,10 +708,10 @@ static uint16_t ILI9341_Read_PixelData ( void )
 
 
 /**
- * @brief  ȡ ILI9341 ʾĳһ
- * @param  usX ضɨ跽¸õX
- * @param  usY ضɨ跽¸õY
- * @retval 
+ * @brief  获取 ILI9341 显示器上某一个坐标点的像素数据
+ * @param  usX ：在特定扫描方向下该点的X坐标
+ * @param  usY ：在特定扫描方向下该点的Y坐标
+ * @retval 像素数据
  */
 uint16_t ILI9341_GetPointPixel ( uint16_t usX, uint16_t usY )
 { 
@@ -728,13 +728,13 @@ uint16_t ILI9341_GetPointPixel ( uint16_t usX, uint16_t usY )
 
 
 /**
- * @brief   ILI9341 ʾʹ Bresenham 㷨߶ 
- * @param  usX1 ضɨ跽߶εһ˵X
- * @param  usY1 ضɨ跽߶εһ˵Y
- * @param  usX2 ضɨ跽߶εһ˵X
- * @param  usY2 ضɨ跽߶εһ˵Y
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  在 ILI9341 显示器上使用 Bresenham 算法画线段 
+ * @param  usX1 ：在特定扫描方向下线段的一个端点X坐标
+ * @param  usY1 ：在特定扫描方向下线段的一个端点Y坐标
+ * @param  usX2 ：在特定扫描方向下线段的另一个端点X坐标
+ * @param  usY2 ：在特定扫描方向下线段的另一个端点Y坐标
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_DrawLine ( uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t usY2 )
 {
@@ -745,7 +745,7 @@ void ILI9341_DrawLine ( uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t us
 	int32_t lIncrease_X, lIncrease_Y; 	
 	
 	
-	lDelta_X = usX2 - usX1; // 
+	lDelta_X = usX2 - usX1; //计算坐标增量 
 	lDelta_Y = usY2 - usY1; 
 	
 	usX_Current = usX1; 
@@ -753,10 +753,10 @@ void ILI9341_DrawLine ( uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t us
 	
 	
 	if ( lDelta_X > 0 ) 
-		lIncrease_X = 1; //õ 
+		lIncrease_X = 1; //设置单步方向 
 	
 	else if ( lDelta_X == 0 ) 
-		lIncrease_X = 0;//ֱ 
+		lIncrease_X = 0;//垂直线 
 	
 	else 
   { 
@@ -769,7 +769,7 @@ void ILI9341_DrawLine ( uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t us
 		lIncrease_Y = 1; 
 	
 	else if ( lDelta_Y == 0 )
-		lIncrease_Y = 0;//ˮƽ 
+		lIncrease_Y = 0;//水平线 
 	
 	else 
   {
@@ -779,15 +779,15 @@ void ILI9341_DrawLine ( uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t us
 
 	
 	if (  lDelta_X > lDelta_Y )
-		lDistance = lDelta_X; //ѡȡ 
+		lDistance = lDelta_X; //选取基本增量坐标轴 
 	
 	else 
 		lDistance = lDelta_Y; 
 
 	
-	for ( us = 0; us <= lDistance + 1; us ++ )// 
+	for ( us = 0; us <= lDistance + 1; us ++ )//画线输出 
 	{  
-		ILI9341_SetPointPixel ( usX_Current, usY_Current );// 
+		ILI9341_SetPointPixel ( usX_Current, usY_Current );//画点 
 		
 		lError_X += lDelta_X ; 
 		lError_Y += lDelta_Y ; 
@@ -811,17 +811,17 @@ void ILI9341_DrawLine ( uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t us
 
 
 /**
- * @brief   ILI9341 ʾϻһ
- * @param  usX_Start ضɨ跽¾εʼX
- * @param  usY_Start ضɨ跽¾εʼY
- * @param  usWidthεĿȣλأ
- * @param  usHeightεĸ߶ȣλأ
- * @param  ucFilled ѡǷþ
-  *   òΪֵ֮һ
-  *     @arg 0 :ľ
-  *     @arg 1 :ʵľ 
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  在 ILI9341 显示器上画一个矩形
+ * @param  usX_Start ：在特定扫描方向下矩形的起始点X坐标
+ * @param  usY_Start ：在特定扫描方向下矩形的起始点Y坐标
+ * @param  usWidth：矩形的宽度（单位：像素）
+ * @param  usHeight：矩形的高度（单位：像素）
+ * @param  ucFilled ：选择是否填充该矩形
+  *   该参数为以下值之一：
+  *     @arg 0 :空心矩形
+  *     @arg 1 :实心矩形 
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_DrawRectangle ( uint16_t usX_Start, uint16_t usY_Start, uint16_t usWidth, uint16_t usHeight, uint8_t ucFilled )
 {
@@ -842,16 +842,16 @@ void ILI9341_DrawRectangle ( uint16_t usX_Start, uint16_t usY_Start, uint16_t us
 
 
 /**
- * @brief   ILI9341 ʾʹ Bresenham 㷨Բ
- * @param  usX_Center ضɨ跽ԲĵX
- * @param  usY_Center ضɨ跽ԲĵY
- * @param  usRadiusԲİ뾶λأ
- * @param  ucFilled ѡǷԲ
-  *   òΪֵ֮һ
-  *     @arg 0 :Բ
-  *     @arg 1 :ʵԲ
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  在 ILI9341 显示器上使用 Bresenham 算法画圆
+ * @param  usX_Center ：在特定扫描方向下圆心的X坐标
+ * @param  usY_Center ：在特定扫描方向下圆心的Y坐标
+ * @param  usRadius：圆的半径（单位：像素）
+ * @param  ucFilled ：选择是否填充该圆
+  *   该参数为以下值之一：
+  *     @arg 0 :空心圆
+  *     @arg 1 :实心圆
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_DrawCircle ( uint16_t usX_Center, uint16_t usY_Center, uint16_t usRadius, uint8_t ucFilled )
 {
@@ -861,7 +861,7 @@ void ILI9341_DrawCircle ( uint16_t usX_Center, uint16_t usY_Center, uint16_t usR
 	
 	sCurrentX = 0; sCurrentY = usRadius;	  
 	
-	sError = 3 - ( usRadius << 1 );     //ж¸λõı־
+	sError = 3 - ( usRadius << 1 );     //判断下个点位置的标志
 	
 	
 	while ( sCurrentX <= sCurrentY )
@@ -872,7 +872,7 @@ void ILI9341_DrawCircle ( uint16_t usX_Center, uint16_t usY_Center, uint16_t usR
 		if ( ucFilled ) 			
 			for ( sCountY = sCurrentX; sCountY <= sCurrentY; sCountY ++ ) 
 			{                      
-				ILI9341_SetPointPixel ( usX_Center + sCurrentX, usY_Center + sCountY );           //1о 
+				ILI9341_SetPointPixel ( usX_Center + sCurrentX, usY_Center + sCountY );           //1，研究对象 
 				ILI9341_SetPointPixel ( usX_Center - sCurrentX, usY_Center + sCountY );           //2       
 				ILI9341_SetPointPixel ( usX_Center - sCountY,   usY_Center + sCurrentX );           //3
 				ILI9341_SetPointPixel ( usX_Center - sCountY,   usY_Center - sCurrentX );           //4
@@ -884,7 +884,7 @@ void ILI9341_DrawCircle ( uint16_t usX_Center, uint16_t usY_Center, uint16_t usR
 		
 		else
 		{          
-			ILI9341_SetPointPixel ( usX_Center + sCurrentX, usY_Center + sCurrentY );             //1о
+			ILI9341_SetPointPixel ( usX_Center + sCurrentX, usY_Center + sCurrentY );             //1，研究对象
 			ILI9341_SetPointPixel ( usX_Center - sCurrentX, usY_Center + sCurrentY );             //2      
 			ILI9341_SetPointPixel ( usX_Center - sCurrentY, usY_Center + sCurrentX );             //3
 			ILI9341_SetPointPixel ( usX_Center - sCurrentY, usY_Center - sCurrentX );             //4
@@ -914,12 +914,12 @@ void ILI9341_DrawCircle ( uint16_t usX_Center, uint16_t usY_Center, uint16_t usR
 }
 
 /**
- * @brief   ILI9341 ʾʾһӢַ
- * @param  usX ضɨ跽ַʼX
- * @param  usY ضɨ跽¸õʼY
- * @param  cChar ҪʾӢַ
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  在 ILI9341 显示器上显示一个英文字符
+ * @param  usX ：在特定扫描方向下字符的起始X坐标
+ * @param  usY ：在特定扫描方向下该点的起始Y坐标
+ * @param  cChar ：要显示的英文字符
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_DispChar_EN ( uint16_t usX, uint16_t usY, const char cChar )
 {
@@ -927,26 +927,26 @@ void ILI9341_DispChar_EN ( uint16_t usX, uint16_t usY, const char cChar )
 	uint16_t ucRelativePositon;
 	uint8_t *Pfont;
 	
-	//asciiƫƣģASCIIǰ32ͼηţ
+	//对ascii码表偏移（字模表不包含ASCII表的前32个非图形符号）
 	ucRelativePositon = cChar - ' ';
 	
-	//ÿģֽ
+	//每个字模的字节数
 	fontLength = (LCD_Currentfonts->Width*LCD_Currentfonts->Height)/8;
 		
-	//ģ׵ַ
-	/*asciiƫֵÿģֽģƫλ*/
+	//字模首地址
+	/*ascii码表偏移值乘以每个字模的字节数，求出字模的偏移位置*/
 	Pfont = (uint8_t *)&LCD_Currentfonts->table[ucRelativePositon * fontLength];
 	
-	//ʾ
+	//设置显示窗口
 	ILI9341_OpenWindow ( usX, usY, LCD_Currentfonts->Width, LCD_Currentfonts->Height);
 	
 	ILI9341_Write_Cmd ( CMD_SetPixel );			
 
-	//ֽڶȡģ
-	//ǰֱʾڣʾݻԶ
+	//按字节读取字模数据
+	//由于前面直接设置了显示窗口，显示数据会自动换行
 	for ( byteCount = 0; byteCount < fontLength; byteCount++ )
 	{
-			//һλһλҪʾɫ
+			//一位一位处理要显示的颜色
 			for ( bitCount = 0; bitCount < 8; bitCount++ )
 			{
 					if ( Pfont[byteCount] & (0x80>>bitCount) )
@@ -959,14 +959,14 @@ void ILI9341_DispChar_EN ( uint16_t usX, uint16_t usY, const char cChar )
 
 
 /**
- * @brief   ILI9341 ʾʾӢַ
- * @param  line ضɨ跽ַʼY
-  *   ʹúLINE(0)LINE(1)ȷʽָ꣬
-  *   LINE(x)ݵǰѡYֵ
-	*		ʾʹLINEʱҪӢóFont8x16
- * @param  pStr ҪʾӢַ׵ַ
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  在 ILI9341 显示器上显示英文字符串
+ * @param  line ：在特定扫描方向下字符串的起始Y坐标
+  *   本参数可使用宏LINE(0)、LINE(1)等方式指定文字坐标，
+  *   宏LINE(x)会根据当前选择的字体来计算Y坐标值。
+	*		显示中文且使用LINE宏时，需要把英文字体设置成Font8x16
+ * @param  pStr ：要显示的英文字符串的首地址
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_DispStringLine_EN (  uint16_t line,  char * pStr )
 {
@@ -998,12 +998,12 @@ void ILI9341_DispStringLine_EN (  uint16_t line,  char * pStr )
 
 
 /**
- * @brief   ILI9341 ʾʾӢַ
- * @param  usX ضɨ跽ַʼX
- * @param  usY ضɨ跽ַʼY
- * @param  pStr ҪʾӢַ׵ַ
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  在 ILI9341 显示器上显示英文字符串
+ * @param  usX ：在特定扫描方向下字符的起始X坐标
+ * @param  usY ：在特定扫描方向下字符的起始Y坐标
+ * @param  pStr ：要显示的英文字符串的首地址
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_DispString_EN ( 	uint16_t usX ,uint16_t usY,  char * pStr )
 {
@@ -1033,12 +1033,12 @@ void ILI9341_DispString_EN ( 	uint16_t usX ,uint16_t usY,  char * pStr )
 
 
 /**
- * @brief   ILI9341 ʾʾӢַ(Y᷽)
- * @param  usX ضɨ跽ַʼX
- * @param  usY ضɨ跽ַʼY
- * @param  pStr ҪʾӢַ׵ַ
- * @note ʹLCD_SetBackColorLCD_SetTextColorLCD_SetColorsɫ
- * @retval 
+ * @brief  在 ILI9341 显示器上显示英文字符串(沿Y轴方向)
+ * @param  usX ：在特定扫描方向下字符的起始X坐标
+ * @param  usY ：在特定扫描方向下字符的起始Y坐标
+ * @param  pStr ：要显示的英文字符串的首地址
+ * @note 可使用LCD_SetBackColor、LCD_SetTextColor、LCD_SetColors函数设置颜色
+ * @retval 无
  */
 void ILI9341_DispString_EN_YDir (	 uint16_t usX,uint16_t usY ,  char * pStr )
 {	
@@ -1066,12 +1066,12 @@ void ILI9341_DispString_EN_YDir (	 uint16_t usX,uint16_t usY ,  char * pStr )
 
 
 /**
-  * @brief  Ӣ
-  * @param  fonts: ָҪѡ
-	*		Ϊֵ֮һ
-  * 	@argFont24x32;
-  * 	@argFont16x24;
-  * 	@argFont8x16;
+  * @brief  设置英文字体类型
+  * @param  fonts: 指定要选择的字体
+	*		参数为以下值之一
+  * 	@arg：Font24x32;
+  * 	@arg：Font16x24;
+  * 	@arg：Font8x16;
   * @retval None
   */
 void LCD_SetFont(sFONT *fonts)
@@ -1080,9 +1080,9 @@ void LCD_SetFont(sFONT *fonts)
 }
 
 /**
-  * @brief  ȡǰ
+  * @brief  获取当前字体类型
   * @param  None.
-  * @retval صǰ
+  * @retval 返回当前字体类型
   */
 sFONT *LCD_GetFont(void)
 {
@@ -1091,9 +1091,9 @@ sFONT *LCD_GetFont(void)
 
 
 /**
-  * @brief  LCDǰ()ɫ,RGB565
-  * @param  TextColor: ָǰ()ɫ
-  * @param  BackColor: ָɫ
+  * @brief  设置LCD的前景(字体)及背景颜色,RGB565
+  * @param  TextColor: 指定前景(字体)颜色
+  * @param  BackColor: 指定背景颜色
   * @retval None
   */
 void LCD_SetColors(uint16_t TextColor, uint16_t BackColor) 
@@ -1103,9 +1103,9 @@ void LCD_SetColors(uint16_t TextColor, uint16_t BackColor)
 }
 
 /**
-  * @brief  ȡLCDǰ()ɫ,RGB565
-  * @param  TextColor: 洢ǰ()ɫָ
-  * @param  BackColor: 洢ɫָ
+  * @brief  获取LCD的前景(字体)及背景颜色,RGB565
+  * @param  TextColor: 用来存储前景(字体)颜色的指针变量
+  * @param  BackColor: 用来存储背景颜色的指针变量
   * @retval None
   */
 void LCD_GetColors(uint16_t *TextColor, uint16_t *BackColor)
@@ -1115,8 +1115,8 @@ void LCD_GetColors(uint16_t *TextColor, uint16_t *BackColor)
 }
 
 /**
-  * @brief  LCDǰ()ɫ,RGB565
-  * @param  Color: ָǰ()ɫ 
+  * @brief  设置LCD的前景(字体)颜色,RGB565
+  * @param  Color: 指定前景(字体)颜色 
   * @retval None
   */
 void LCD_SetTextColor(uint16_t Color)
@@ -1125,8 +1125,8 @@ void LCD_SetTextColor(uint16_t Color)
 }
 
 /**
-  * @brief  LCDıɫ,RGB565
-  * @param  Color: ָɫ 
+  * @brief  设置LCD的背景颜色,RGB565
+  * @param  Color: 指定背景颜色 
   * @retval None
   */
 void LCD_SetBackColor(uint16_t Color)
@@ -1135,15 +1135,15 @@ void LCD_SetBackColor(uint16_t Color)
 }
 
 /**
-  * @brief  ĳ
-  * @param  Line: ָҪɾ
-  *   ʹúLINE(0)LINE(1)ȷʽָҪɾУ
-  *   LINE(x)ݵǰѡYֵɾǰ߶ȵĵxС
+  * @brief  清除某行文字
+  * @param  Line: 指定要删除的行
+  *   本参数可使用宏LINE(0)、LINE(1)等方式指定要删除的行，
+  *   宏LINE(x)会根据当前选择的字体来计算Y坐标值，并删除当前字体高度的第x行。
   * @retval None
   */
 void LCD_ClearLine(uint16_t Line)
 {
-  ILI9341_Clear(0,Line,LCD_X_LENGTH,((sFONT *)LCD_GetFont())->Height);	/* ʾȫ */
+  ILI9341_Clear(0,Line,LCD_X_LENGTH,((sFONT *)LCD_GetFont())->Height);	/* 清屏，显示全黑 */
 
 }
 /*********************end of file*************************/
@@ -7,65 +7,65 @@
 
 
 /***************************************************************************************
-2^26 =0X0400 0000 = 64MB,ÿ BANK 4*64MB = 256MB
+2^26 =0X0400 0000 = 64MB,每个 BANK 有4*64MB = 256MB
 64MB:FSMC_Bank1_NORSRAM1:0X6000 0000 ~ 0X63FF FFFF
 64MB:FSMC_Bank1_NORSRAM2:0X6400 0000 ~ 0X67FF FFFF
 64MB:FSMC_Bank1_NORSRAM3:0X6800 0000 ~ 0X6BFF FFFF
 64MB:FSMC_Bank1_NORSRAM4:0X6C00 0000 ~ 0X6FFF FFFF
 
-ѡBANK1-BORSRAM1  TFTַΧΪ0X6000 0000 ~ 0X63FF FFFF
-FSMC_A16 LCDDC(Ĵ/ѡ)
-Ĵַ = 0X60000000
-RAMַ = 0X60020000 = 0X60000000+2^16*2 = 0X60000000 + 0X20000 = 0X60020000
-ѡͬĵַʱַҪ¼  
+选择BANK1-BORSRAM1 连接 TFT，地址范围为0X6000 0000 ~ 0X63FF FFFF
+FSMC_A16 接LCD的DC(寄存器/数据选择)脚
+寄存器基地址 = 0X60000000
+RAM基地址 = 0X60020000 = 0X60000000+2^16*2 = 0X60000000 + 0X20000 = 0X60020000
+当选择不同的地址线时，地址要重新计算  
 ****************************************************************************************/
 
-/******************************* ILI9341 ʾ FSMC  ***************************/
-//FSMC_Bank1_NORSRAMLCDĵַ
+/******************************* ILI9341 显示屏的 FSMC 参数定义 ***************************/
+//FSMC_Bank1_NORSRAM用于LCD命令操作的地址
 #define      FSMC_Addr_ILI9341_CMD         ( ( uint32_t ) 0x60000000 )
 
-//FSMC_Bank1_NORSRAMLCDݲĵַ      
+//FSMC_Bank1_NORSRAM用于LCD数据操作的地址      
 #define      FSMC_Addr_ILI9341_DATA        ( ( uint32_t ) 0x60020000 )
 
-//ƬѡžNOR/SRAM
+//由片选引脚决定的NOR/SRAM块
 #define      FSMC_Bank1_NORSRAMx           FSMC_Bank1_NORSRAM1
 
 
 
-/******************************* ILI9341 ʾ8080ͨѶŶ ***************************/
-/******ź******/
-//ƬѡѡNOR/SRAM
+/******************************* ILI9341 显示屏8080通讯引脚定义 ***************************/
+/******控制信号线******/
+//片选，选择NOR/SRAM块
 #define      ILI9341_CS_CLK                RCC_APB2Periph_GPIOD   
 #define      ILI9341_CS_PORT               GPIOD
 #define      ILI9341_CS_PIN                GPIO_Pin_7
 
-//DCţʹFSMCĵַźſƣž˷LCDʱʹõĵַ
-//PD11ΪFSMC_A16
+//DC引脚，使用FSMC的地址信号控制，本引脚决定了访问LCD时使用的地址
+//PD11为FSMC_A16
 #define      ILI9341_DC_CLK                RCC_APB2Periph_GPIOD   
 #define      ILI9341_DC_PORT               GPIOD
 #define      ILI9341_DC_PIN                GPIO_Pin_11
 
-//дʹ
+//写使能
 #define      ILI9341_WR_CLK                RCC_APB2Periph_GPIOD   
 #define      ILI9341_WR_PORT               GPIOD
 #define      ILI9341_WR_PIN                GPIO_Pin_5
 
-//ʹ
+//读使能
 #define      ILI9341_RD_CLK                RCC_APB2Periph_GPIOD   
 #define      ILI9341_RD_PORT               GPIOD
 #define      ILI9341_RD_PIN                GPIO_Pin_4
 
-//λ
+//复位引脚
 #define      ILI9341_RST_CLK               RCC_APB2Periph_GPIOE
 #define      ILI9341_RST_PORT              GPIOE
 #define      ILI9341_RST_PIN               GPIO_Pin_1
 
-//
+//背光引脚
 #define      ILI9341_BK_CLK                RCC_APB2Periph_GPIOD    
 #define      ILI9341_BK_PORT               GPIOD
 #define      ILI9341_BK_PIN                GPIO_Pin_12
 
-/********ź***************/
+/********数据信号线***************/
 #define      ILI9341_D0_CLK                RCC_APB2Periph_GPIOD   
 #define      ILI9341_D0_PORT               GPIOD
 #define      ILI9341_D0_PIN                GPIO_Pin_14
@@ -130,52 +130,52 @@ RAM
 #define      ILI9341_D15_PORT               GPIOD
 #define      ILI9341_D15_PIN                GPIO_Pin_10
 
-/*************************************** Ԥ ******************************************/
+/*************************************** 调试预用 ******************************************/
 #define      DEBUG_DELAY()                
 
-/***************************** ILI934 ʾʼ ***************************/
-#define      ILI9341_DispWindow_X_Star		    0     //ʼX
-#define      ILI9341_DispWindow_Y_Star		    0     //ʼY
+/***************************** ILI934 显示区域的起始坐标和总行列数 ***************************/
+#define      ILI9341_DispWindow_X_Star		    0     //起始点的X坐标
+#define      ILI9341_DispWindow_Y_Star		    0     //起始点的Y坐标
 
-#define 			ILI9341_LESS_PIXEL	  							240			//Һ϶̷ؿ
-#define 			ILI9341_MORE_PIXEL	 								320			//Һϳؿ
+#define 			ILI9341_LESS_PIXEL	  							240			//液晶屏较短方向的像素宽度
+#define 			ILI9341_MORE_PIXEL	 								320			//液晶屏较长方向的像素宽度
 
-//Һɨ跽仯XYؿ
-//ILI9341_GramScan÷ʱԶ
+//根据液晶扫描方向而变化的XY像素宽度
+//调用ILI9341_GramScan函数设置方向时会自动更改
 extern uint16_t LCD_X_LENGTH,LCD_Y_LENGTH; 
 
-//Һɨģʽ
-//ѡֵΪ0-7
+//液晶屏扫描模式
+//参数可选值为0-7
 extern uint8_t LCD_SCAN_MODE;
 
-/*******************************  ILI934 ʾɫ ********************************/
-#define      BACKGROUND		                BLACK   //Ĭϱɫ
-
-#define      WHITE		 		                  0xFFFF	   //ɫ
-#define      BLACK                         0x0000	   //ɫ 
-#define      GREY                          0xF7DE	   //ɫ 
-#define      BLUE                          0x001F	   //ɫ 
-#define      BLUE2                         0x051F	   //ǳɫ 
-#define      RED                           0xF800	   //ɫ 
-#define      MAGENTA                       0xF81F	   //ɫɫ 
-#define      GREEN                         0x07E0	   //ɫ 
-#define      CYAN                          0x7FFF	   //ɫɫ 
-#define      YELLOW                        0xFFE0	   //ɫ 
+/******************************* 定义 ILI934 显示屏常用颜色 ********************************/
+#define      BACKGROUND		                BLACK   //默认背景颜色
+
+#define      WHITE		 		                  0xFFFF	   //白色
+#define      BLACK                         0x0000	   //黑色 
+#define      GREY                          0xF7DE	   //灰色 
+#define      BLUE                          0x001F	   //蓝色 
+#define      BLUE2                         0x051F	   //浅蓝色 
+#define      RED                           0xF800	   //红色 
+#define      MAGENTA                       0xF81F	   //红紫色，洋红色 
+#define      GREEN                         0x07E0	   //绿色 
+#define      CYAN                          0x7FFF	   //蓝绿色，青色 
+#define      YELLOW                        0xFFE0	   //黄色 
 #define      BRED                          0xF81F
 #define      GRED                          0xFFE0
 #define      GBLUE                         0x07FF
 
 
 
-/*******************************  ILI934  ********************************/
-#define      CMD_SetCoordinateX		 		    0x2A	     //X
-#define      CMD_SetCoordinateY		 		    0x2B	     //Y
-#define      CMD_SetPixel		 		          0x2C	     //
+/******************************* 定义 ILI934 常用命令 ********************************/
+#define      CMD_SetCoordinateX		 		    0x2A	     //设置X坐标
+#define      CMD_SetCoordinateY		 		    0x2B	     //设置Y坐标
+#define      CMD_SetPixel		 		          0x2C	     //填充像素
 
 
 
 
-/**********************************  ILI934  ***************************************/
+/********************************** 声明 ILI934 函数 ***************************************/
 void                     ILI9341_Init                    ( void );
 void                     ILI9341_Rst                     ( void );
 void                     ILI9341_BackLed_Control         ( FunctionalState enumState );
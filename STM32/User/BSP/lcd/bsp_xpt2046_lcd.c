@@ -5,7 +5,7 @@
 
 
 
-/*******************************  XPT2046 صľ̬ ***************************/
+/******************************* 声明 XPT2046 相关的静态函数 ***************************/
 static void                   XPT2046_EXTI_Config                   ( void );
 static void                   XPT2046_EXTI_NVIC_Config              ( void );
 static void                   XPT2046_GPIO_SPI_Config               ( void );
@@ -21,18 +21,18 @@ static void                   ILI9341_DrawCross                     ( uint16_t u
 
 
 
-/*******************************  XPT2046 ȫֱ ***************************/
-strType_XPT2046_TouchPara strXPT2046_TouchPara = { 0.085958, -0.001073, -4.979353, -0.001750, 0.065168, -13.318824 };  //ʼֵΪɨ跽ʽ2µһУ׼ϵУ׼ʱʹøĬϵ
-                                              // { 0.001030, 0.064188, -10.804098, -0.085584, 0.001420, 324.127036 };  //ʼֵΪɨ跽ʽ1µһУ׼ϵУ׼ʱʹøĬϵ
+/******************************* 定义 XPT2046 全局变量 ***************************/
+strType_XPT2046_TouchPara strXPT2046_TouchPara = { 0.085958, -0.001073, -4.979353, -0.001750, 0.065168, -13.318824 };  //初始值为扫描方式2下的一组校准系数，不校准触摸屏时可使用该组默认系数
+                                              // { 0.001030, 0.064188, -10.804098, -0.085584, 0.001420, 324.127036 };  //初始值为扫描方式1下的一组校准系数，不校准触摸屏时可使用该组默认系数
 
 volatile uint8_t ucXPT2046_TouchFlag = 0;
 
 
 
 /**
-  * @brief  XPT2046 ʼ
-  * @param  
-  * @retval 
+  * @brief  XPT2046 初始化函数
+  * @param  无
+  * @retval 无
   */	
 void XPT2046_Init ( void )
 {
@@ -44,9 +44,9 @@ void XPT2046_Init ( void )
 
 
 /**
-  * @brief   XPT2046 ⲿжȼ
-  * @param  
-  * @retval 
+  * @brief  配置 XPT2046 外部中断优先级
+  * @param  无
+  * @retval 无
   */	
 static void XPT2046_EXTI_NVIC_Config ( void )
 {
@@ -56,7 +56,7 @@ static void XPT2046_EXTI_NVIC_Config ( void )
   /* Configure one bit for preemption priority */
   NVIC_PriorityGroupConfig(NVIC_PriorityGroup_1);
   
-  /* жԴ */
+  /* 配置中断源 */
   NVIC_InitStructure.NVIC_IRQChannel = macXPT2046_EXTI_IRQ;
   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
@@ -67,9 +67,9 @@ static void XPT2046_EXTI_NVIC_Config ( void )
 
 
 /**
-  * @brief   XPT2046 ⲿж
-  * @param  
-  * @retval 
+  * @brief  配置 XPT2046 外部中断
+  * @param  无
+  * @retval 无
   */	
 static void XPT2046_EXTI_Config ( void )
 {
@@ -85,14 +85,14 @@ static void XPT2046_EXTI_Config ( void )
 
 	/* EXTI line gpio config*/	
   GPIO_InitStructure.GPIO_Pin = macXPT2046_EXTI_GPIO_PIN;       
-  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;	 // 
+  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;	 // 上拉输入
   GPIO_Init(macXPT2046_EXTI_GPIO_PORT, &GPIO_InitStructure);
 
 	/* EXTI line mode config */
   GPIO_EXTILineConfig(macXPT2046_EXTI_SOURCE_PORT, macXPT2046_EXTI_SOURCE_PIN); 
   EXTI_InitStructure.EXTI_Line = macXPT2046_EXTI_LINE;
   EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-  EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling; //½ж
+  EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling; //下降沿中断
   EXTI_InitStructure.EXTI_LineCmd = ENABLE;
 	
   EXTI_Init(&EXTI_InitStructure); 
@@ -101,19 +101,19 @@ static void XPT2046_EXTI_Config ( void )
 
 
 /**
-  * @brief   XPT2046 ģSPI
-  * @param  
-  * @retval 
+  * @brief  配置 XPT2046 的模拟SPI
+  * @param  无
+  * @retval 无
   */	
 static void XPT2046_GPIO_SPI_Config ( void ) 
 { 
   GPIO_InitTypeDef  GPIO_InitStructure;
 	
 
-  /* GPIOʱ */
+  /* 开启GPIO时钟 */
   RCC_APB2PeriphClockCmd ( macXPT2046_SPI_GPIO_CLK, ENABLE );
 
-  /* ģSPI GPIOʼ */          
+  /* 模拟SPI GPIO初始化 */          
   GPIO_InitStructure.GPIO_Pin=macXPT2046_SPI_CLK_PIN;
   GPIO_InitStructure.GPIO_Speed=GPIO_Speed_10MHz ;	  
   GPIO_InitStructure.GPIO_Mode=GPIO_Mode_Out_PP;
@@ -122,17 +122,17 @@ static void XPT2046_GPIO_SPI_Config ( void )
   GPIO_InitStructure.GPIO_Pin = macXPT2046_SPI_MOSI_PIN;
   GPIO_Init(macXPT2046_SPI_MOSI_PORT, &GPIO_InitStructure);
 
-  GPIO_InitStructure.GPIO_Pin = macXPT2046_SPI_MF103-ָ_PIN; 
+  GPIO_InitStructure.GPIO_Pin = macXPT2046_SPI_MF103-指南者_PIN; 
   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz ;
   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;      
-  GPIO_Init(macXPT2046_SPI_MF103-ָ_PORT, &GPIO_InitStructure);
+  GPIO_Init(macXPT2046_SPI_MF103-指南者_PORT, &GPIO_InitStructure);
 
   GPIO_InitStructure.GPIO_Pin = macXPT2046_SPI_CS_PIN; 
   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz ;
   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;      
   GPIO_Init(macXPT2046_SPI_CS_PORT, &GPIO_InitStructure); 
    
-  /* ƬѡѡXPT2046 */
+  /* 拉低片选，选择XPT2046 */
   macXPT2046_CS_DISABLE();
 
 }
@@ -141,9 +141,9 @@ static void XPT2046_GPIO_SPI_Config ( void )
 
 
 /**
-  * @brief   XPT2046 ļ΢뼶ʱ
-  * @param  nCount ʱֵλΪ΢
-  * @retval 
+  * @brief  用于 XPT2046 的简单微秒级延时函数
+  * @param  nCount ：延时计数值，单位为微妙
+  * @retval 无
   */	
 static void XPT2046_DelayUS ( __IO uint32_t ulCount )
 {
@@ -152,9 +152,9 @@ static void XPT2046_DelayUS ( __IO uint32_t ulCount )
 
 	for ( i = 0; i < ulCount; i ++ )
 	{
-		uint8_t uc = 12;     //ֵΪ12Լ1΢  
+		uint8_t uc = 12;     //设置值为12，大约延1微秒  
 	      
-		while ( uc -- );     //1΢	
+		while ( uc -- );     //延1微秒	
 
 	}
 	
@@ -163,12 +163,12 @@ static void XPT2046_DelayUS ( __IO uint32_t ulCount )
 
 
 /**
-  * @brief  XPT2046 д
-  * @param  ucCmd 
-  *   òΪֵ֮һ
-  *     @arg 0x90 :ͨY+ѡ
-  *     @arg 0xd0 :ͨX+ѡ
-  * @retval 
+  * @brief  XPT2046 的写入命令
+  * @param  ucCmd ：命令
+  *   该参数为以下值之一：
+  *     @arg 0x90 :通道Y+的选择控制字
+  *     @arg 0xd0 :通道X+的选择控制字
+  * @retval 无
   */
 static void XPT2046_WriteCMD ( uint8_t ucCmd ) 
 {
@@ -196,9 +196,9 @@ static void XPT2046_WriteCMD ( uint8_t ucCmd )
 
 
 /**
-  * @brief  XPT2046 Ķȡ
-  * @param  
-  * @retval ȡ
+  * @brief  XPT2046 的读取命令
+  * @param  无
+  * @retval 读取到的数据
   */
 static uint16_t XPT2046_ReadCMD ( void ) 
 {
@@ -215,7 +215,7 @@ static uint16_t XPT2046_ReadCMD ( void )
 	{
 		macXPT2046_CLK_LOW();    
 	
-		usTemp = macXPT2046_MF103-ָ();
+		usTemp = macXPT2046_MF103-指南者();
 		
 		usBuf |= usTemp << ( 11 - i );
 	
@@ -229,12 +229,12 @@ static uint16_t XPT2046_ReadCMD ( void )
 
 
 /**
-  * @brief   XPT2046 ѡһģͨADCADC
+  * @brief  对 XPT2046 选择一个模拟通道后，启动ADC，并返回ADC采样结果
   * @param  ucChannel
-  *   òΪֵ֮һ
-  *     @arg 0x90 :ͨY+ѡ
-  *     @arg 0xd0 :ͨX+ѡ
-  * @retval ͨADC
+  *   该参数为以下值之一：
+  *     @arg 0x90 :通道Y+的选择控制字
+  *     @arg 0xd0 :通道X+的选择控制字
+  * @retval 该通道的ADC采样结果
   */
 static uint16_t XPT2046_ReadAdc ( uint8_t ucChannel )
 {
@@ -246,10 +246,10 @@ static uint16_t XPT2046_ReadAdc ( uint8_t ucChannel )
 
 
 /**
-  * @brief  ȡ XPT2046 XͨYͨADֵ12 bit4096
-  * @param  sX_Ad XͨADֵĵַ
-  * @param  sY_Ad YͨADֵĵַ
-  * @retval 
+  * @brief  读取 XPT2046 的X通道和Y通道的AD值（12 bit，最大是4096）
+  * @param  sX_Ad ：存放X通道AD值的地址
+  * @param  sY_Ad ：存放Y通道AD值的地址
+  * @retval 无
   */
 static void XPT2046_ReadAdc_XY ( int16_t * sX_Ad, int16_t * sY_Ad )  
 { 
@@ -272,17 +272,17 @@ static void XPT2046_ReadAdc_XY ( int16_t * sX_Ad, int16_t * sY_Ad )
 
  
 /**
-  * @brief  ڴ XPT2046 ĻʱȡһADֵԸ˲
-  * @param  
-  * @retval ˲֮ADֵ
+  * @brief  在触摸 XPT2046 屏幕时获取一组坐标的AD值，并对该坐标进行滤波
+  * @param  无
+  * @retval 滤波之后的坐标AD值
   */
-#if   0                 //ע⣺УϾ׼ԸӣٶȽ
+#if   0                 //注意：校正较精准，但是相对复杂，速度较慢
 static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenCoordinate )
 {
 	uint8_t ucCount = 0;
 	
 	int16_t sAD_X, sAD_Y;
-	int16_t sBufferArray [ 2 ] [ 9 ] = { { 0 }, { 0 } };  //XY9β
+	int16_t sBufferArray [ 2 ] [ 9 ] = { { 0 }, { 0 } };  //坐标X和Y进行9次采样
 
 	int32_t lAverage  [ 3 ], lDifference [ 3 ];
 	
@@ -296,39 +296,39 @@ static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenC
 		
 		ucCount ++; 
 			 
-	} while ( ( macXPT2046_EXTI_Read() == macXPT2046_EXTI_ActiveLevel ) && ( ucCount < 9 ) ); 	//ûʱTP_INT_INźΪ  ucCount<9*/
+	} while ( ( macXPT2046_EXTI_Read() == macXPT2046_EXTI_ActiveLevel ) && ( ucCount < 9 ) ); 	//用户点击触摸屏时即TP_INT_IN信号为低 并且 ucCount<9*/
 	 
 	
-	/*ʵ*/
+	/*如果触笔弹起*/
 	if ( macXPT2046_EXTI_Read() != macXPT2046_EXTI_ActiveLevel )
-		ucXPT2046_TouchFlag = 0;			//жϱ־λ		
+		ucXPT2046_TouchFlag = 0;			//触摸中断标志复位		
 
 	
-	/* ɹ9,˲ */ 
+	/* 如果成功采样9次,进行滤波 */ 
 	if ( ucCount == 9 )   								
 	{  
-		/* Ϊ,ֱ3ȡƽֵ */
+		/* 为减少运算量,分别分3组取平均值 */
 		lAverage  [ 0 ] = ( sBufferArray [ 0 ] [ 0 ] + sBufferArray [ 0 ] [ 1 ] + sBufferArray [ 0 ] [ 2 ] ) / 3;
 		lAverage  [ 1 ] = ( sBufferArray [ 0 ] [ 3 ] + sBufferArray [ 0 ] [ 4 ] + sBufferArray [ 0 ] [ 5 ] ) / 3;
 		lAverage  [ 2 ] = ( sBufferArray [ 0 ] [ 6 ] + sBufferArray [ 0 ] [ 7 ] + sBufferArray [ 0 ] [ 8 ] ) / 3;
 		
-		/* 3ݵĲֵ */
+		/* 计算3组数据的差值 */
 		lDifference [ 0 ] = lAverage  [ 0 ]-lAverage  [ 1 ];
 		lDifference [ 1 ] = lAverage  [ 1 ]-lAverage  [ 2 ];
 		lDifference [ 2 ] = lAverage  [ 2 ]-lAverage  [ 0 ];
 		
-		/* ֵȡֵ */
+		/* 对上述差值取绝对值 */
 		lDifference [ 0 ] = lDifference [ 0 ]>0?lDifference [ 0 ]: ( -lDifference [ 0 ] );
 		lDifference [ 1 ] = lDifference [ 1 ]>0?lDifference [ 1 ]: ( -lDifference [ 1 ] );
 		lDifference [ 2 ] = lDifference [ 2 ]>0?lDifference [ 2 ]: ( -lDifference [ 2 ] );
 		
 		
-		/* жϾԲֵǷ񶼳ֵޣ3ԲֵֵжβΪҰ,㣬ֵȡΪ2 */
+		/* 判断绝对差值是否都超过差值门限，如果这3个绝对差值都超过门限值，则判定这次采样点为野点,抛弃采样点，差值门限取为2 */
 		if (  lDifference [ 0 ] > macXPT2046_THRESHOLD_CalDiff  &&  lDifference [ 1 ] > macXPT2046_THRESHOLD_CalDiff  &&  lDifference [ 2 ] > macXPT2046_THRESHOLD_CalDiff  ) 
 			return 0;
 		
 		
-		/* ǵƽֵͬʱֵstrScreenCoordinate */ 
+		/* 计算它们的平均值，同时赋值给strScreenCoordinate */ 
 		if ( lDifference [ 0 ] < lDifference [ 1 ] )
 		{
 			if ( lDifference [ 2 ] < lDifference [ 0 ] ) 
@@ -344,7 +344,7 @@ static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenC
 			pScreenCoordinate ->x = ( lAverage  [ 1 ] + lAverage  [ 2 ] ) / 2;
 		
 		
-		/* ͬϣYƽֵ */
+		/* 同上，计算Y的平均值 */
 		lAverage  [ 0 ] = ( sBufferArray [ 1 ] [ 0 ] + sBufferArray [ 1 ] [ 1 ] + sBufferArray [ 1 ] [ 2 ] ) / 3;
 		lAverage  [ 1 ] = ( sBufferArray [ 1 ] [ 3 ] + sBufferArray [ 1 ] [ 4 ] + sBufferArray [ 1 ] [ 5 ] ) / 3;
 		lAverage  [ 2 ] = ( sBufferArray [ 1 ] [ 6 ] + sBufferArray [ 1 ] [ 7 ] + sBufferArray [ 1 ] [ 8 ] ) / 3;
@@ -353,7 +353,7 @@ static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenC
 		lDifference [ 1 ] = lAverage  [ 1 ] - lAverage  [ 2 ];
 		lDifference [ 2 ] = lAverage  [ 2 ] - lAverage  [ 0 ];
 		
-		/* ȡֵ */
+		/* 取绝对值 */
 		lDifference [ 0 ] = lDifference [ 0 ] > 0 ? lDifference [ 0 ] : ( - lDifference [ 0 ] );
 		lDifference [ 1 ] = lDifference [ 1 ] > 0 ? lDifference [ 1 ] : ( - lDifference [ 1 ] );
 		lDifference [ 2 ] = lDifference [ 2 ] > 0 ? lDifference [ 2 ] : ( - lDifference [ 2 ] );
@@ -396,18 +396,18 @@ static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenC
 }
 
 
-#else     //ע⣺Ӧʵר,Ǻܾ׼Ǽ򵥣ٶȱȽϿ   
+#else     //注意：画板应用实例专用,不是很精准，但是简单，速度比较快   
 static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenCoordinate )
 {
 	uint8_t ucCount = 0, i;
 	
 	int16_t sAD_X, sAD_Y;
-	int16_t sBufferArray [ 2 ] [ 10 ] = { { 0 },{ 0 } };  //XYжβ
+	int16_t sBufferArray [ 2 ] [ 10 ] = { { 0 },{ 0 } };  //坐标X和Y进行多次采样
 	
 	int32_t lX_Min, lX_Max, lY_Min, lY_Max;
 
 
-	/* ѭ10 */ 
+	/* 循环采样10次 */ 
 	do					       				
 	{		  
 		XPT2046_ReadAdc_XY ( & sAD_X, & sAD_Y );  
@@ -417,15 +417,15 @@ static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenC
 		
 		ucCount ++;  
 		
-	}	while ( ( macXPT2046_EXTI_Read() == macXPT2046_EXTI_ActiveLevel ) && ( ucCount < 10 ) );//ûʱTP_INT_INźΪ  ucCount<10
+	}	while ( ( macXPT2046_EXTI_Read() == macXPT2046_EXTI_ActiveLevel ) && ( ucCount < 10 ) );//用户点击触摸屏时即TP_INT_IN信号为低 并且 ucCount<10
 	
 	
-	/*ʵ*/
+	/*如果触笔弹起*/
 	if ( macXPT2046_EXTI_Read() != macXPT2046_EXTI_ActiveLevel )
-		ucXPT2046_TouchFlag = 0;			//жϱ־λ
+		ucXPT2046_TouchFlag = 0;			//中断标志复位
 
 	
-	/*ɹ10*/
+	/*如果成功采样10个样本*/
 	if ( ucCount ==10 )		 					
 	{
 		lX_Max = lX_Min = sBufferArray [ 0 ] [ 0 ];
@@ -452,7 +452,7 @@ static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenC
 		}
 		
 		
-		/*ȥСֵֵ֮ƽֵ*/
+		/*去除最小值和最大值之后求平均值*/
 		pScreenCoordinate ->x =  ( sBufferArray [ 0 ] [ 0 ] + sBufferArray [ 0 ] [ 1 ] + sBufferArray [ 0 ] [ 2 ] + sBufferArray [ 0 ] [ 3 ] + sBufferArray [ 0 ] [ 4 ] + 
 		                           sBufferArray [ 0 ] [ 5 ] + sBufferArray [ 0 ] [ 6 ] + sBufferArray [ 0 ] [ 7 ] + sBufferArray [ 0 ] [ 8 ] + sBufferArray [ 0 ] [ 9 ] - lX_Min-lX_Max ) >> 3;
 		
@@ -476,21 +476,21 @@ static uint8_t XPT2046_ReadAdc_Smooth_XY ( strType_XPT2046_Coordinate * pScreenC
 
 
 /**
-  * @brief   XPT2046 Уϵע⣺ֻLCDʹǶȷǳСʱ,湫ʽ
-  * @param  pDisplayCoordinate ĻΪʾ֪
-  * @param  pstrScreenSample ֪㴥ʱ XPT2046 
-  * @param  pCalibrationFactor Ϊ趨ͲĻУϵ
-  * @retval ״̬
-	*   ÷ֵΪֵ֮һ
-  *     @arg 1 :ɹ
-  *     @arg 0 :ʧ
+  * @brief  计算 XPT2046 触摸坐标校正系数（注意：只有在LCD和触摸屏间的误差角度非常小时,才能运用下面公式）
+  * @param  pDisplayCoordinate ：屏幕人为显示的已知坐标
+  * @param  pstrScreenSample ：对已知坐标点触摸时 XPT2046 产生的坐标
+  * @param  pCalibrationFactor ：根据人为设定坐标和采样回来的坐标计算出来的屏幕触摸校正系数
+  * @retval 计算状态
+	*   该返回值为以下值之一：
+  *     @arg 1 :计算成功
+  *     @arg 0 :计算失败
   */
 static uint8_t XPT2046_Calculate_CalibrationFactor ( strType_XPT2046_Coordinate * pDisplayCoordinate, strType_XPT2046_Coordinate * pScreenSample, strType_XPT2046_Calibration * pCalibrationFactor )
 {
 	uint8_t ucRet = 1;
 
 	
-	/* K ( X0X2 )  ( Y1Y2 ) ( X1X2 )  ( Y0Y2 ) */
+	/* K＝ ( X0－X2 )  ( Y1－Y2 )－ ( X1－X2 )  ( Y0－Y2 ) */
 	pCalibrationFactor -> Divider =  ( ( pScreenSample [ 0 ] .x - pScreenSample [ 2 ] .x ) *  ( pScreenSample [ 1 ] .y - pScreenSample [ 2 ] .y ) ) - 
 									                 ( ( pScreenSample [ 1 ] .x - pScreenSample [ 2 ] .x ) *  ( pScreenSample [ 0 ] .y - pScreenSample [ 2 ] .y ) ) ;
 	
@@ -500,29 +500,29 @@ static uint8_t XPT2046_Calculate_CalibrationFactor ( strType_XPT2046_Coordinate
 
 	else
 	{
-		/* A (  ( XD0XD2 )  ( Y1Y2 ) ( XD1XD2 )  ( Y0Y2 ) )K	*/
+		/* A＝ (  ( XD0－XD2 )  ( Y1－Y2 )－ ( XD1－XD2 )  ( Y0－Y2 ) )／K	*/
 		pCalibrationFactor -> An =  ( ( pDisplayCoordinate [ 0 ] .x - pDisplayCoordinate [ 2 ] .x ) *  ( pScreenSample [ 1 ] .y - pScreenSample [ 2 ] .y ) ) - 
 								                ( ( pDisplayCoordinate [ 1 ] .x - pDisplayCoordinate [ 2 ] .x ) *  ( pScreenSample [ 0 ] .y - pScreenSample [ 2 ] .y ) );
 		
-		/* B (  ( X0X2 )  ( XD1XD2 ) ( XD0XD2 )  ( X1X2 ) )K	*/
+		/* B＝ (  ( X0－X2 )  ( XD1－XD2 )－ ( XD0－XD2 )  ( X1－X2 ) )／K	*/
 		pCalibrationFactor -> Bn =  ( ( pScreenSample [ 0 ] .x - pScreenSample [ 2 ] .x ) *  ( pDisplayCoordinate [ 1 ] .x - pDisplayCoordinate [ 2 ] .x ) ) - 
 								                ( ( pDisplayCoordinate [ 0 ] .x - pDisplayCoordinate [ 2 ] .x ) *  ( pScreenSample [ 1 ] .x - pScreenSample [ 2 ] .x ) );
 		
-		/* C ( Y0 ( X2XD1X1XD2 )+Y1 ( X0XD2X2XD0 )+Y2 ( X1XD0X0XD1 ) )K */
+		/* C＝ ( Y0 ( X2XD1－X1XD2 )+Y1 ( X0XD2－X2XD0 )+Y2 ( X1XD0－X0XD1 ) )／K */
 		pCalibrationFactor -> Cn =  ( pScreenSample [ 2 ] .x * pDisplayCoordinate [ 1 ] .x - pScreenSample [ 1 ] .x * pDisplayCoordinate [ 2 ] .x ) * pScreenSample [ 0 ] .y +
 								                ( pScreenSample [ 0 ] .x * pDisplayCoordinate [ 2 ] .x - pScreenSample [ 2 ] .x * pDisplayCoordinate [ 0 ] .x ) * pScreenSample [ 1 ] .y +
 								                ( pScreenSample [ 1 ] .x * pDisplayCoordinate [ 0 ] .x - pScreenSample [ 0 ] .x * pDisplayCoordinate [ 1 ] .x ) * pScreenSample [ 2 ] .y ;
 		
-		/* D (  ( YD0YD2 )  ( Y1Y2 ) ( YD1YD2 )  ( Y0Y2 ) )K	*/
+		/* D＝ (  ( YD0－YD2 )  ( Y1－Y2 )－ ( YD1－YD2 )  ( Y0－Y2 ) )／K	*/
 		pCalibrationFactor -> Dn =  ( ( pDisplayCoordinate [ 0 ] .y - pDisplayCoordinate [ 2 ] .y ) *  ( pScreenSample [ 1 ] .y - pScreenSample [ 2 ] .y ) ) - 
 								                ( ( pDisplayCoordinate [ 1 ] .y - pDisplayCoordinate [ 2 ] .y ) *  ( pScreenSample [ 0 ] .y - pScreenSample [ 2 ] .y ) ) ;
 		
-		/* E (  ( X0X2 )  ( YD1YD2 ) ( YD0YD2 )  ( X1X2 ) )K	*/
+		/* E＝ (  ( X0－X2 )  ( YD1－YD2 )－ ( YD0－YD2 )  ( X1－X2 ) )／K	*/
 		pCalibrationFactor -> En =  ( ( pScreenSample [ 0 ] .x - pScreenSample [ 2 ] .x ) *  ( pDisplayCoordinate [ 1 ] .y - pDisplayCoordinate [ 2 ] .y ) ) - 
 								                ( ( pDisplayCoordinate [ 0 ] .y - pDisplayCoordinate [ 2 ] .y ) *  ( pScreenSample [ 1 ] .x - pScreenSample [ 2 ] .x ) ) ;
 		
 		
-		/* F ( Y0 ( X2YD1X1YD2 )+Y1 ( X0YD2X2YD0 )+Y2 ( X1YD0X0YD1 ) )K */
+		/* F＝ ( Y0 ( X2YD1－X1YD2 )+Y1 ( X0YD2－X2YD0 )+Y2 ( X1YD0－X0YD1 ) )／K */
 		pCalibrationFactor -> Fn =  ( pScreenSample [ 2 ] .x * pDisplayCoordinate [ 1 ] .y - pScreenSample [ 1 ] .x * pDisplayCoordinate [ 2 ] .y ) * pScreenSample [ 0 ] .y +
 								                ( pScreenSample [ 0 ] .x * pDisplayCoordinate [ 2 ] .y - pScreenSample [ 2 ] .x * pDisplayCoordinate [ 0 ] .y ) * pScreenSample [ 1 ] .y +
 								                ( pScreenSample [ 1 ] .x * pDisplayCoordinate [ 0 ] .y - pScreenSample [ 0 ] .x * pDisplayCoordinate [ 1 ] .y ) * pScreenSample [ 2 ] .y;
@@ -537,10 +537,10 @@ static uint8_t XPT2046_Calculate_CalibrationFactor ( strType_XPT2046_Coordinate
 
 
 /**
-  * @brief   ILI9341 ʾУʱҪʮ
-  * @param  usX ضɨ跽ʮֽX
-  * @param  usY ضɨ跽ʮֽY
-  * @retval 
+  * @brief  在 ILI9341 上显示校正触摸时需要的十字
+  * @param  usX ：在特定扫描方向下十字交叉点的X坐标
+  * @param  usY ：在特定扫描方向下十字交叉点的Y坐标
+  * @retval 无
   */
 static void ILI9341_DrawCross ( uint16_t usX, uint16_t usY )
 {
@@ -551,12 +551,12 @@ static void ILI9341_DrawCross ( uint16_t usX, uint16_t usY )
 
 
 /**
-  * @brief  XPT2046 У׼
-  * @param  
-  * @retval У׼
-	*   ÷ֵΪֵ֮һ
-  *     @arg 1 :У׼ɹ
-  *     @arg 0 :У׼ʧ
+  * @brief  XPT2046 触摸屏校准
+  * @param  无
+  * @retval 校准结果
+	*   该返回值为以下值之一：
+  *     @arg 1 :校准成功
+  *     @arg 0 :校准失败
   */
 uint8_t XPT2046_Touch_Calibrate ( void )
 {
@@ -586,7 +586,7 @@ uint8_t XPT2046_Touch_Calibrate ( void )
 	  #endif
 		
 		
-		/* 趨ʮֽ */ 
+		/* 设定“十”字交叉点的坐标 */ 
 		strCrossCoordinate [ 0 ] .x = usScreenWidth >> 2;
 		strCrossCoordinate [ 0 ] .y = usScreenHeigth >> 2;
 		
@@ -613,30 +613,30 @@ uint8_t XPT2046_Touch_Calibrate ( void )
 			sprintf ( cStr, "%d", i + 1 );
 			ILI9341_DispString_EN ( usScreenWidth >> 1, ( usScreenHeigth >> 1 ) - macHEIGHT_EN_CHAR, cStr, macBACKGROUND, macRED );
 		
-			XPT2046_DelayUS ( 100000 );		                                                   //ʵʱбҪ
+			XPT2046_DelayUS ( 100000 );		                                                   //适当的延时很有必要
 			
-			ILI9341_DrawCross ( strCrossCoordinate [ i ] .x, strCrossCoordinate [ i ] .y );  //ʾУõġʮ
+			ILI9341_DrawCross ( strCrossCoordinate [ i ] .x, strCrossCoordinate [ i ] .y );  //显示校正用的“十”字
 
-			while ( ! XPT2046_ReadAdc_Smooth_XY ( & strScreenSample [ i ] ) );               //ȡXPT2046ݵpCoordinateptrΪʱʾûд㱻
+			while ( ! XPT2046_ReadAdc_Smooth_XY ( & strScreenSample [ i ] ) );               //读取XPT2046数据到变量pCoordinate，当ptr为空时表示没有触点被按下
 
 		}
 		
 		
-		XPT2046_Calculate_CalibrationFactor ( strCrossCoordinate, strScreenSample, & CalibrationFactor ) ;  	 //ԭʼ ԭʼתϵ
+		XPT2046_Calculate_CalibrationFactor ( strCrossCoordinate, strScreenSample, & CalibrationFactor ) ;  	 //用原始参数计算出 原始参数与坐标的转换系数
 		
 		if ( CalibrationFactor .Divider == 0 ) goto Failure;
 		
 			
-		usTest_x = ( ( CalibrationFactor .An * strScreenSample [ 3 ] .x ) + ( CalibrationFactor .Bn * strScreenSample [ 3 ] .y ) + CalibrationFactor .Cn ) / CalibrationFactor .Divider;		//ȡһXֵ	 
-		usTest_y = ( ( CalibrationFactor .Dn * strScreenSample [ 3 ] .x ) + ( CalibrationFactor .En * strScreenSample [ 3 ] .y ) + CalibrationFactor .Fn ) / CalibrationFactor .Divider;    //ȡһYֵ
+		usTest_x = ( ( CalibrationFactor .An * strScreenSample [ 3 ] .x ) + ( CalibrationFactor .Bn * strScreenSample [ 3 ] .y ) + CalibrationFactor .Cn ) / CalibrationFactor .Divider;		//取一个点计算X值	 
+		usTest_y = ( ( CalibrationFactor .Dn * strScreenSample [ 3 ] .x ) + ( CalibrationFactor .En * strScreenSample [ 3 ] .y ) + CalibrationFactor .Fn ) / CalibrationFactor .Divider;    //取一个点计算Y值
 		
-		usGap_x = ( usTest_x > strCrossCoordinate [ 3 ] .x ) ? ( usTest_x - strCrossCoordinate [ 3 ] .x ) : ( strCrossCoordinate [ 3 ] .x - usTest_x );   //ʵXľԲ
-		usGap_y = ( usTest_y > strCrossCoordinate [ 3 ] .y ) ? ( usTest_y - strCrossCoordinate [ 3 ] .y ) : ( strCrossCoordinate [ 3 ] .y - usTest_y );   //ʵYľԲ
+		usGap_x = ( usTest_x > strCrossCoordinate [ 3 ] .x ) ? ( usTest_x - strCrossCoordinate [ 3 ] .x ) : ( strCrossCoordinate [ 3 ] .x - usTest_x );   //实际X坐标与计算坐标的绝对差
+		usGap_y = ( usTest_y > strCrossCoordinate [ 3 ] .y ) ? ( usTest_y - strCrossCoordinate [ 3 ] .y ) : ( strCrossCoordinate [ 3 ] .y - usTest_y );   //实际Y坐标与计算坐标的绝对差
 		
-    if ( ( usGap_x > 10 ) || ( usGap_y > 10 ) ) goto Failure;       //ͨ޸ֵĴС    
+    if ( ( usGap_x > 10 ) || ( usGap_y > 10 ) ) goto Failure;       //可以通过修改这两个值的大小来调整精度    
 		
 
-    /* У׼ϵΪȫֱ */ 
+    /* 校准系数为全局变量 */ 
 		strXPT2046_TouchPara .dX_X = ( CalibrationFactor .An * 1.0 ) / CalibrationFactor .Divider;
 		strXPT2046_TouchPara .dX_Y = ( CalibrationFactor .Bn * 1.0 ) / CalibrationFactor .Divider;
 		strXPT2046_TouchPara .dX   = ( CalibrationFactor .Cn * 1.0 ) / CalibrationFactor .Divider;
@@ -645,8 +645,8 @@ uint8_t XPT2046_Touch_Calibrate ( void )
 		strXPT2046_TouchPara .dY_Y = ( CalibrationFactor .En * 1.0 ) / CalibrationFactor .Divider;
 		strXPT2046_TouchPara .dY   = ( CalibrationFactor .Fn * 1.0 ) / CalibrationFactor .Divider;
 
-//    /* ӡУУ׼ϵ */ 
-//		printf ( "У׼ϵ£\r\n" );
+//    /* 打印校校准系数 */ 
+//		printf ( "校准系数如下：\r\n" );
 //		
 //    for ( i = 0; i < 6; i ++ )
 //		{
@@ -690,17 +690,17 @@ uint8_t XPT2046_Touch_Calibrate ( void )
 
    
 /**
-  * @brief  ȡ XPT2046 㣨У׼󣩵
-  * @param  pDisplayCoordinate ָŻȡĴ
-  * @param  pTouchParaУ׼ϵ
-  * @retval ȡ
-	*   ÷ֵΪֵ֮һ
-  *     @arg 1 :ȡɹ
-  *     @arg 0 :ȡʧ
+  * @brief  获取 XPT2046 触摸点（校准后）的坐标
+  * @param  pDisplayCoordinate ：该指针存放获取到的触摸点坐标
+  * @param  pTouchPara：坐标校准系数
+  * @retval 获取情况
+	*   该返回值为以下值之一：
+  *     @arg 1 :获取成功
+  *     @arg 0 :获取失败
   */
 uint8_t XPT2046_Get_TouchedPoint ( strType_XPT2046_Coordinate * pDisplayCoordinate, strType_XPT2046_TouchPara * pTouchPara )
 {
-	uint8_t ucRet = 1;           //򷵻0
+	uint8_t ucRet = 1;           //若正常，则返回0
 	
 	strType_XPT2046_Coordinate strScreenCoordinate; 
 	
@@ -712,7 +712,7 @@ uint8_t XPT2046_Get_TouchedPoint ( strType_XPT2046_Coordinate * pDisplayCoordina
 
   }
 	 
-	else ucRet = 0;            //ȡĴϢ򷵻0
+	else ucRet = 0;            //如果获取的触点信息有误，则返回0
 	
 	
 	
@@ -7,29 +7,29 @@ static void                         LED_GPIO_Config                  ( void );
 
 
  /**
-  * @brief   LED  GPIO 
-  * @param  
-  * @retval 
+  * @brief  配置 LED 的 GPIO 功能
+  * @param  无
+  * @retval 无
   */
 static void LED_GPIO_Config ( void )
 {		
-	/*һGPIO_InitTypeDef͵Ľṹ*/
+	/*定义一个GPIO_InitTypeDef类型的结构体*/
 	GPIO_InitTypeDef GPIO_InitStructure;
 
 
-	/*  LED1  */
+	/* 配置 LED1 引脚 */
 	RCC_APB2PeriphClockCmd ( macLED1_GPIO_CLK, ENABLE ); 															   
 	GPIO_InitStructure.GPIO_Pin = macLED1_GPIO_PIN;	
 	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;   
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz; 
 	GPIO_Init ( macLED1_GPIO_PORT, & GPIO_InitStructure );	
 
-	/*  LED2  */
+	/* 配置 LED2 引脚 */
 	RCC_APB2PeriphClockCmd ( macLED2_GPIO_CLK, ENABLE ); 															   
 	GPIO_InitStructure.GPIO_Pin = macLED2_GPIO_PIN;	
 	GPIO_Init ( macLED2_GPIO_PORT, & GPIO_InitStructure );	
 
-	/*  LED3  */
+	/* 配置 LED3 引脚 */
 	RCC_APB2PeriphClockCmd ( macLED3_GPIO_CLK, ENABLE ); 															   
 	GPIO_InitStructure.GPIO_Pin = macLED3_GPIO_PIN;	
 	GPIO_Init ( macLED3_GPIO_PORT, & GPIO_InitStructure );		
@@ -38,9 +38,9 @@ static void LED_GPIO_Config ( void )
 
 
  /**
-  * @brief  LED ʼ
-  * @param  
-  * @retval 
+  * @brief  LED 初始化函数
+  * @param  无
+  * @retval 无
   */
 void LED_Init ( void )
 {
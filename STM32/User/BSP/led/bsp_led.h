@@ -7,7 +7,7 @@
  
  
  
-/****************************** LED ò***************************************/
+/****************************** LED 引脚配置参数定义***************************************/
 #define             macLED1_GPIO_APBxClock_FUN              RCC_APB2PeriphClockCmd
 #define             macLED1_GPIO_CLK                        RCC_APB2Periph_GPIOB
 #define             macLED1_GPIO_PORT                       GPIOB
@@ -25,7 +25,7 @@
 
 
 
-/****************************** LED 궨***************************************/
+/****************************** LED 函数宏定义***************************************/
 #define             macLED1_ON()                            GPIO_ResetBits ( macLED1_GPIO_PORT, macLED1_GPIO_PIN )
 #define             macLED1_OFF()                           GPIO_SetBits ( macLED1_GPIO_PORT, macLED1_GPIO_PIN )
 #define             macLED1_TOGGLE()                        GPIO_ReadOutputDataBit ( macLED1_GPIO_PORT, macLED1_GPIO_PIN ) ? \
@@ -43,7 +43,7 @@
 
 
 
-/************************** PAD ********************************/
+/************************** PAD 函数声明********************************/
 void                               LED_Init                         ( void );
  
  
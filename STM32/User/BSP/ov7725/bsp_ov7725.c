@@ -3,31 +3,34 @@
   * @file    bsp_ov7725.c
   * @version V1.0
   * @date    2013-xx-xx
-  * @brief   OV7725
+  * @brief   OV7725驱动
   ******************************************************************************
   * @attention
   *
-  * ʵƽ̨: F103-ָ STM32  
-  * ̳    :http://www.firebbs.cn
-  * Ա    :https://fire-stm32.taobao.com
+  * 实验平台:秉火 F103-指南者 STM32 开发板 
+  * 论坛    :http://www.firebbs.cn
+  * 淘宝    :https://fire-stm32.taobao.com
   *
   ******************************************************************************
   */ 
 #include "./led/bsp_led.h" 
 #include "./ov7725/bsp_ov7725.h"
+#include "./ov7725/bsp_ov7725_dma.h"
 #include "./sccb/bsp_sccb.h"
 #include "./lcd/bsp_ili9341_lcd.h"
 #include "./usart/bsp_usart1.h"
+#include  <os.h>
+#include  <app_cfg.h>
 
-//ͷʼ
-//ע⣺ʹַʽʼṹ壬Ҫc/c++ѡѡ C99 mode
+//摄像头初始化配置
+//注意：使用这种方式初始化结构体，要在c/c++选项中选择 C99 mode
 OV7725_MODE_PARAM cam_mode =
 {
 	
-/*°ͷãвԣһ飬ע͵*/
-/************1*********ʾ*****************************/
+/*以下包含几组摄像头配置，可自行测试，保留一组，把其余配置注释掉即可*/
+/************配置1*********横屏显示*****************************/
 	
-	.QVGA_VGA = 0,	//QVGAģʽ
+	.QVGA_VGA = 0,	//QVGA模式
 	.cam_sx = 0,
 	.cam_sy = 0,	
 	
@@ -36,74 +39,74 @@ OV7725_MODE_PARAM cam_mode =
 	
 	.lcd_sx = 0,
 	.lcd_sy = 0,
-	.lcd_scan = 3, //LCDɨģʽÿ1357ģʽ
+	.lcd_scan = 3, //LCD扫描模式，本横屏配置可用1、3、5、7模式
 	
-	//¿ɸԼҪΧṹͶ	
-	.light_mode = 0,//Զģʽ
+	//以下可根据自己的需要调整，参数范围见结构体类型定义	
+	.light_mode = 0,//自动光照模式
 	.saturation = 0,	
 	.brightness = 0,
 	.contrast = 0,
-	.effect = 0,		//ģʽ
+	.effect = 0,		//正常模式
 	
 	
-/**********2*********ʾ****************************/	
-/*ʾҪVGAģʽֱͬ£QVGA֡Ե*/
-/*VGAģʽֱΪ640*480ȡ240*320ͼʾ*/
-/*ֳ̲֧320*240 240*320ķֱ*/
+/**********配置2*********竖屏显示****************************/	
+/*竖屏显示需要VGA模式，同分辨率情况下，比QVGA帧率稍低*/
+/*VGA模式分辨率为640*480，从中取出240*320的图像进行竖屏显示*/
+/*本工程不支持超过320*240或 240*320的分辨率配置*/
 
-//	.QVGA_VGA = 1,	//VGAģʽ
-//	//ȡVGAģʽеĴڣɸʵҪ
+//	.QVGA_VGA = 1,	//VGA模式
+//	//取VGA模式居中的窗口，可根据实际需要调整
 //	.cam_sx = (640-240)/2,
 //	.cam_sy = (480-320)/2,	
 //	
 //	.cam_width = 240, 
-//	.cam_height = 320, //VGAģʽ£ֵſԴ240
+//	.cam_height = 320, //在VGA模式下，此值才可以大于240
 //	
 //	.lcd_sx = 0,
 //	.lcd_sy = 0,
-//	.lcd_scan = 0, //LCDɨģʽÿ0246ģʽ
+//	.lcd_scan = 0, //LCD扫描模式，本竖屏配置可用0、2、4、6模式
 //	
-//	//¿ɸԼҪΧṹͶ
-//	.light_mode = 0,//Զģʽ
+//	//以下可根据自己的需要调整，参数范围见结构体类型定义
+//	.light_mode = 0,//自动光照模式
 //	.saturation = 0,	
 //	.brightness = 0,
 //	.contrast = 0,
-//	.effect = 0,		//ģʽ
+//	.effect = 0,		//正常模式
 	
 	
-	/*******3************Сֱ****************************/	
-	/*С320*240ֱʵģʹQVGAģʽ,õʱעҺ߽*/
+	/*******配置3************小分辨率****************************/	
+	/*小于320*240分辨率的，可使用QVGA模式,设置的时候注意液晶屏边界*/
 	
-//	.QVGA_VGA = 0,	//QVGAģʽ
-//	//ȡQVGAģʽеĴڣɸʵҪ
+//	.QVGA_VGA = 0,	//QVGA模式
+//	//取QVGA模式居中的窗口，可根据实际需要调整
 //	.cam_sx = (320-100)/2,
 //	.cam_sy = (240-150)/2,	
 //	
 //	.cam_width = 100, 
 //	.cam_height = 150, 
 //	
-//	/*ҺʾλҲԸҪעⲻҪ߽缴*/
+//	/*液晶屏的显示位置也可以根据需要调整，注意不要超过边界即可*/
 //	.lcd_sx = 50,
 //	.lcd_sy = 50,
-//	.lcd_scan = 3, //LCDɨģʽ0-7ģʽ֧֣עⲻҪ߽缴
+//	.lcd_scan = 3, //LCD扫描模式，0-7模式都支持，注意不要超过边界即可
 
-//	//¿ɸԼҪΧṹͶ	
-//	.light_mode = 0,//Զģʽ
+//	//以下可根据自己的需要调整，参数范围见结构体类型定义	
+//	.light_mode = 0,//自动光照模式
 //	.saturation = 0,	
 //	.brightness = 0,
 //	.contrast = 0,
-//	.effect = 0,		//ģʽ
+//	.effect = 0,		//正常模式
 
 };
 
 
 typedef struct Reg
 {
-	uint8_t Address;			       /*Ĵַ*/
-	uint8_t Value;		           /*Ĵֵ*/
+	uint8_t Address;			       /*寄存器地址*/
+	uint8_t Value;		           /*寄存器值*/
 }Reg_Info;
 
-/* Ĵ */
+/* 寄存器参数配置 */
 Reg_Info Sensor_Config[] =
 {
 	{REG_CLKRC,     0x00}, /*clock config*/
@@ -160,8 +163,8 @@ Reg_Info Sensor_Config[] =
 	{REG_USAT,		0x65},
 	{REG_VSAT,		0x65},
 	{REG_UVADJ0,	0x81},
-	//{REG_SDE,		  0x20},	//ڰ
-	{REG_SDE,		  0x06},	//ɫ	SDEĴʵЧ
+	//{REG_SDE,		  0x20},	//黑白
+	{REG_SDE,		  0x06},	//彩色	调节SDE这个寄存器还可以实现其他效果
 	
     /*GAMMA config*/
 	{REG_GAM1,		0x0c},
@@ -197,56 +200,57 @@ Reg_Info Sensor_Config[] =
 	{REG_COM3,		0xd0},/*Horizontal mirror image*/
 
 	/*night mode auto frame rate control*/
-	{REG_COM5,		0xf5},	 /*ҹӻ£Զ֡ʣ֤նȻ*/
-	//{REG_COM5,		0x31},	/*ҹӻ֡ʲ*/
+	{REG_COM5,		0xf5},	 /*在夜视环境下，自动降低帧率，保证低照度画面质量*/
+	//{REG_COM5,		0x31},	/*夜视环境帧率不变*/
 };
 
-uint8_t OV7725_REG_NUM = sizeof(Sensor_Config)/sizeof(Sensor_Config[0]);	  /*ṹԱĿ*/
+uint8_t OV7725_REG_NUM = sizeof(Sensor_Config)/sizeof(Sensor_Config[0]);	  /*结构体数组成员数目*/
 
-volatile uint8_t Ov7725_vsync ;	 /* ֡ͬźű־жϺmainʹ */
+OV7725_FRAME_PIPE ov7725_pipe;	 /* 帧流水线状态，在中断函数和采集任务里面使用 */
+uint8_t ov7725_present = 0;	 /* 1：检测到摄像头 */
 
 
 
 /************************************************
- * FIFO_GPIO_Config
- *   FIFO GPIO
- *   
- *   
- * ע  
+ * 函数名：FIFO_GPIO_Config
+ * 描述  ：FIFO GPIO配置
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：无
  ************************************************/
 static void FIFO_GPIO_Config(void)
 {
     GPIO_InitTypeDef GPIO_InitStructure;
 	
-		/*ʱ*/
+		/*开启时钟*/
 	  RCC_APB2PeriphClockCmd (OV7725_OE_GPIO_CLK|OV7725_WRST_GPIO_CLK|
 															OV7725_RRST_GPIO_CLK|OV7725_RCLK_GPIO_CLK|
 															OV7725_WE_GPIO_CLK|OV7725_DATA_GPIO_CLK, ENABLE );
 	
-		/*(FIFO_OE--FIFOʹ)*/
+		/*(FIFO_OE--FIFO输出使能)*/
 		GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_Out_PP;
     GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;	
 		GPIO_InitStructure.GPIO_Pin = OV7725_OE_GPIO_PIN;
 		GPIO_Init(OV7725_OE_GPIO_PORT, &GPIO_InitStructure);
 	
-			/*(FIFO_WRST--FIFOдλ)*/
+			/*(FIFO_WRST--FIFO写复位)*/
 		GPIO_InitStructure.GPIO_Pin = OV7725_WRST_GPIO_PIN;
 		GPIO_Init(OV7725_WRST_GPIO_PORT, &GPIO_InitStructure);
 	
-			/*(FIFO_RRST--FIFOλ) */
+			/*(FIFO_RRST--FIFO读复位) */
 		GPIO_InitStructure.GPIO_Pin = OV7725_RRST_GPIO_PIN;
 		GPIO_Init(OV7725_RRST_GPIO_PORT, &GPIO_InitStructure);
 		
-		/*(FIFO_RCLK-FIFOʱ)*/
+		/*(FIFO_RCLK-FIFO读时钟)*/
 		GPIO_InitStructure.GPIO_Pin = OV7725_RCLK_GPIO_PIN;
 		GPIO_Init(OV7725_RCLK_GPIO_PORT, &GPIO_InitStructure);
 
-		/*(FIFO_WE--FIFOдʹ)*/
+		/*(FIFO_WE--FIFO写使能)*/
 		GPIO_InitStructure.GPIO_Pin = OV7725_WE_GPIO_PIN;	
 		GPIO_Init(OV7725_WE_GPIO_PORT, &GPIO_InitStructure);
 	
 
-    /*(FIFO_DATA--FIFO)*/
+    /*(FIFO_DATA--FIFO输出数据)*/
 		GPIO_InitStructure.GPIO_Pin = 	OV7725_DATA_0_GPIO_PIN | OV7725_DATA_1_GPIO_PIN |
 																			OV7725_DATA_2_GPIO_PIN | OV7725_DATA_3_GPIO_PIN |
 																			OV7725_DATA_4_GPIO_PIN | 	OV7725_DATA_5_GPIO_PIN |
@@ -256,19 +260,19 @@ static void FIFO_GPIO_Config(void)
 		GPIO_Init(OV7725_DATA_GPIO_PORT, &GPIO_InitStructure);
 		
 		
-    FIFO_OE_L();	  					/*ʹFIFOʹ*/
-    FIFO_WE_H();   						/*ʹFIFOд*/
+    FIFO_OE_L();	  					/*拉低使FIFO输出使能*/
+    FIFO_WE_H();   						/*拉高使FIFO写允许*/
 		
 		
 }
 
 
 /************************************************
- * VSYNC_GPIO_Config
- *   OV7725 VSYNCж
- *   
- *   
- * ע  
+ * 函数名：VSYNC_GPIO_Config
+ * 描述  ：OV7725 VSYNC中断相关配置
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：无
  ************************************************/
 static void VSYNC_GPIO_Config(void)
 {
@@ -276,16 +280,16 @@ static void VSYNC_GPIO_Config(void)
 	EXTI_InitTypeDef EXTI_InitStructure;
 	NVIC_InitTypeDef NVIC_InitStructure;
 	
-	/*ʼʱӣעжҪAFIO*/
+	/*初始化时钟，注意中断要开AFIO*/
 	  RCC_APB2PeriphClockCmd ( RCC_APB2Periph_AFIO|OV7725_VSYNC_GPIO_CLK, ENABLE );	 
     
-	/*ʼ*/
+	/*初始化引脚*/
 	GPIO_InitStructure.GPIO_Pin =  OV7725_VSYNC_GPIO_PIN;
     GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN_FLOATING;
     GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
 	GPIO_Init(OV7725_VSYNC_GPIO_PORT, &GPIO_InitStructure);
 
-	/*ж*/
+	/*配置中断*/
     GPIO_EXTILineConfig(OV7725_VSYNC_EXTI_SOURCE_PORT, OV7725_VSYNC_EXTI_SOURCE_PIN);
     EXTI_InitStructure.EXTI_Line = OV7725_VSYNC_EXTI_LINE;
     EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
@@ -294,7 +298,7 @@ static void VSYNC_GPIO_Config(void)
     EXTI_Init(&EXTI_InitStructure);
     EXTI_GenerateSWInterrupt(OV7725_VSYNC_EXTI_LINE);		
 	
-	/*ȼ*/
+	/*配置优先级*/
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_1);
     NVIC_InitStructure.NVIC_IRQChannel = OV7725_VSYNC_EXTI_IRQ;
     NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
@@ -305,11 +309,11 @@ static void VSYNC_GPIO_Config(void)
 
 
 /************************************************
- * OV7725_GPIO_Config
- *   ʼͷӵIO
- *   
- *   
- * ע  
+ * 函数名：OV7725_GPIO_Config
+ * 描述  ：初始化控制摄像头相接的IO
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：无
  ************************************************/
 void OV7725_GPIO_Config(void)
 {
@@ -319,11 +323,11 @@ void OV7725_GPIO_Config(void)
 }
 
 /************************************************
- * Sensor_Init
- *   Sensorʼ
- *   
- *   1ɹ0ʧ
- * ע  
+ * 函数名：Sensor_Init
+ * 描述  ：Sensor初始化
+ * 输入  ：无
+ * 输出  ：返回1成功，返回0失败
+ * 注意  ：无
  ************************************************/
 ErrorStatus OV7725_Init(void)
 {
@@ -332,19 +336,19 @@ ErrorStatus OV7725_Init(void)
 	
 	//DEBUG("ov7725 Register Config Start......");
 	
-	if( 0 == SCCB_WriteByte ( 0x12, 0x80 ) ) /*λsensor */
+	if( 0 == SCCB_WriteByte ( 0x12, 0x80 ) ) /*复位sensor */
 	{
 		//DEBUG("sccb write data error");		
 		return ERROR ;
 	}	
 
-	if( 0 == SCCB_ReadByte( &Sensor_IDCode, 1, 0x0b ) )	 /* ȡsensor ID*/
+	if( 0 == SCCB_ReadByte( &Sensor_IDCode, 1, 0x0b ) )	 /* 读取sensor ID号*/
 	{
 		//DEBUG("read id faild");		
 		return ERROR;
 	}
 	//DEBUG("Sensor ID is 0x%x", Sensor_IDCode);	
-	//OV7725
+	//配置OV7725
 	if(Sensor_IDCode == OV7725_ID)
 	{
 		for( i = 0 ; i < OV7725_REG_NUM ; i++ )
@@ -362,68 +366,265 @@ ErrorStatus OV7725_Init(void)
 	}
 	//DEBUG("ov7725 Register Config Success");
 	
+	OV7725_Reg_Load();
 	return SUCCESS;
 }
 
+/*寄存器影子：配置完成后从传感器读一遍，之后读寄存器只读影子，不再走SCCB。
+  写寄存器先改影子、记入待写位图，OV7725_Reg_Flush()在帧间隙一次写出，
+  改了又改回传感器中的值的不再写；
+  写出的寄存器记入待校验位图，OV7725_Reg_Verify()在空闲时逐个读回核对。
+  增益、曝光等由传感器自动改写的寄存器，影子只是初始化时的值，不要读改写*/
+static uint8_t  ov7725_reg[256];
+static uint8_t  ov7725_reg_hw[256];             /*传感器中的值：读到或写出的*/
+static uint32_t ov7725_reg_dirty[256 / 32];     /*影子已改，还没写到传感器*/
+static uint32_t ov7725_reg_check[256 / 32];     /*已写到传感器，还没读回校验*/
+static uint8_t  ov7725_reg_dirty_cnt = 0;
+static uint8_t  ov7725_reg_check_cnt = 0;
+static SCCB_REG ov7725_reg_batch[OV7725_REG_BATCH];   /*一批SCCB传输的寄存器表*/
+OV7725_REG_STAT ov7725_reg_stat;
+
+/************************************************
+ * 函数名：OV7725_Reg_Load
+ * 描述  ：从传感器读出全部寄存器到影子
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：OV7725_Init写完配置表后调用，按OV7725_REG_BATCH个一批读
+ ************************************************/
+void OV7725_Reg_Load(void)
+{
+	SCCB_XFER xfer;
+	uint16_t reg, i;
+	
+	xfer.regs = ov7725_reg_batch;
+	xfer.read = 1;
+	for(reg = 0; reg <= OV7725_REG_LAST; reg += xfer.n)
+	{
+		xfer.n = 0;
+		while(xfer.n < OV7725_REG_BATCH && reg + xfer.n <= OV7725_REG_LAST)
+		{
+			ov7725_reg_batch[xfer.n].addr = reg + xfer.n;
+			xfer.n++;
+		}
+		if(SCCB_Xfer_Start(&xfer) == SUCCESS)
+			SCCB_Xfer_Wait(&xfer, SCCB_TIMEOUT);
+		for(i = 0; i < xfer.done; i++)
+			ov7725_reg[reg + i] = ov7725_reg_hw[reg + i] = ov7725_reg_batch[i].value;
+	}
+	for(reg = 0; reg < 256 / 32; reg++)
+	{
+		ov7725_reg_dirty[reg] = 0;
+		ov7725_reg_check[reg] = 0;
+	}
+	ov7725_reg_dirty_cnt = 0;
+	ov7725_reg_check_cnt = 0;
+}
+
+/************************************************
+ * 函数名：OV7725_Reg_Read
+ * 描述  ：读寄存器（影子）
+ * 输入  ：reg:寄存器地址
+ * 输出  ：寄存器值
+ * 注意  ：不访问SCCB
+ ************************************************/
+uint8_t OV7725_Reg_Read(uint8_t reg)
+{
+	return ov7725_reg[reg];
+}
+
+/************************************************
+ * 函数名：OV7725_Reg_Write
+ * 描述  ：写寄存器，只改影子并记入待写
+ * 输入  ：reg:寄存器地址 value:值
+ * 输出  ：无
+ * 注意  ：值没有变化的不再写；同一寄存器多次写只写最后一次，
+ *         最后与传感器中的值相同的不写
+ ************************************************/
+void OV7725_Reg_Write(uint8_t reg, uint8_t value)
+{
+	uint32_t bit = 1u << (reg & 0x1f);
+	
+	if(ov7725_reg[reg] == value)
+		return;
+	ov7725_reg[reg] = value;
+	if(value == ov7725_reg_hw[reg])
+	{
+		if(ov7725_reg_dirty[reg >> 5] & bit)
+		{
+			ov7725_reg_dirty[reg >> 5] &= ~bit;
+			ov7725_reg_dirty_cnt--;
+		}
+	}
+	else if(!(ov7725_reg_dirty[reg >> 5] & bit))
+	{
+		ov7725_reg_dirty[reg >> 5] |= bit;
+		ov7725_reg_dirty_cnt++;
+	}
+}
+
+/************************************************
+ * 函数名：OV7725_Reg_Flush
+ * 描述  ：把待写的寄存器写到传感器
+ * 输入  ：无
+ * 输出  ：写出的寄存器个数
+ * 注意  ：在采集任务的帧间隙调用，SCCB传输期间任务挂起；写失败的留到下次
+ ************************************************/
+uint8_t OV7725_Reg_Flush(void)
+{
+	CPU_TS ts;
+	SCCB_XFER xfer;
+	uint16_t reg;
+	uint32_t bit;
+	uint8_t i, n = 0;
+	
+	if(ov7725_reg_dirty_cnt == 0)
+		return 0;
+	ts = OS_TS_GET();
+	xfer.regs = ov7725_reg_batch;
+	xfer.read = 0;
+	for(reg = 0; reg < 256; )
+	{
+		/*收集一批待写的寄存器，一次启动，传完才唤醒*/
+		xfer.n = 0;
+		for( ; reg < 256 && xfer.n < OV7725_REG_BATCH; reg++)
+		{
+			if(ov7725_reg_dirty[reg >> 5] & (1u << (reg & 0x1f)))
+			{
+				ov7725_reg_batch[xfer.n].addr = reg;
+				ov7725_reg_batch[xfer.n].value = ov7725_reg[reg];
+				xfer.n++;
+			}
+		}
+		if(xfer.n == 0)
+			break;
+		if(SCCB_Xfer_Start(&xfer) != SUCCESS || SCCB_Xfer_Wait(&xfer, SCCB_TIMEOUT) != SUCCESS)
+			ov7725_reg_stat.write_err++;
+		for(i = 0; i < xfer.done; i++)
+		{
+			reg = ov7725_reg_batch[i].addr;
+			bit = 1u << (reg & 0x1f);
+			ov7725_reg_hw[reg] = ov7725_reg_batch[i].value;
+			if(ov7725_reg[reg] != ov7725_reg_batch[i].value)
+				continue;                   /*传输期间又改了，留到下次*/
+			ov7725_reg_dirty[reg >> 5] &= ~bit;
+			ov7725_reg_dirty_cnt--;
+			if(!(ov7725_reg_check[reg >> 5] & bit))
+			{
+				ov7725_reg_check[reg >> 5] |= bit;
+				ov7725_reg_check_cnt++;
+			}
+			n++;
+		}
+		if(xfer.done < xfer.n)
+			break;                          /*出错，其余的下次再写*/
+		reg = ov7725_reg_batch[xfer.n - 1].addr + 1;
+	}
+	ov7725_reg_stat.writes += n;
+	ov7725_reg_stat.flush_us = (OS_TS_GET() - ts) / (SystemCoreClock / 1000000u);
+	if(ov7725_reg_stat.flush_us > ov7725_reg_stat.flush_max_us)
+		ov7725_reg_stat.flush_max_us = ov7725_reg_stat.flush_us;
+	return n;
+}
+
+/************************************************
+ * 函数名：OV7725_Reg_Verify
+ * 描述  ：读回一个已写的寄存器，与影子不符则记入待写
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：每次只做一次SCCB读，在采集任务等待VSYNC前调用
+ ************************************************/
+void OV7725_Reg_Verify(void)
+{
+	static uint8_t pos = 0;
+	uint16_t i;
+	uint8_t reg, value;
+	uint32_t bit;
+	
+	if(ov7725_reg_check_cnt == 0)
+		return;
+	for(i = 0; i < 256; i++, pos++)
+	{
+		reg = pos;
+		bit = 1u << (reg & 0x1f);
+		if(ov7725_reg_check[reg >> 5] & bit)
+			break;
+	}
+	ov7725_reg_check[reg >> 5] &= ~bit;
+	ov7725_reg_check_cnt--;
+	pos = reg + 1;
+	
+	if(!SCCB_ReadByte(&value, 1, reg))
+		return;
+	ov7725_reg_stat.verified++;
+	if(value != ov7725_reg[reg] && !(ov7725_reg_dirty[reg >> 5] & bit))
+	{
+		ov7725_reg_stat.mismatch++;
+		ov7725_reg_hw[reg] = value;
+		ov7725_reg_dirty[reg >> 5] |= bit;     /*下一帧间隙重写*/
+		ov7725_reg_dirty_cnt++;
+		OV7725_DEBUG("reg 0x%02x read 0x%02x, expect 0x%02x", reg, value, ov7725_reg[reg]);
+	}
+}
+
 
 
 /**
-  * @brief  ùģʽ
-  * @param  mode :ģʽΧ[0~5]
-			@arg 0:Զ
-			@arg 1:
-			@arg 2:
-			@arg 3:칫
-			@arg 4:
-			@arg 5:ҹ
-  * @retval 
+  * @brief  设置光照模式
+  * @param  mode :光照模式，参数范围[0~5]
+			@arg 0:自动
+			@arg 1:晴天
+			@arg 2:多云
+			@arg 3:办公室
+			@arg 4:家里
+			@arg 5:夜晚
+  * @retval 无
   */
 void OV7725_Light_Mode(uint8_t mode)
 {
 	switch(mode)
 	{
-		case 0:	//AutoԶģʽ
-			SCCB_WriteByte(0x13, 0xff); //AWB on 
-			SCCB_WriteByte(0x0e, 0x65);
-			SCCB_WriteByte(0x2d, 0x00);
-			SCCB_WriteByte(0x2e, 0x00);
+		case 0:	//Auto，自动模式
+			OV7725_Reg_Write(0x13, 0xff); //AWB on 
+			OV7725_Reg_Write(0x0e, 0x65);
+			OV7725_Reg_Write(0x2d, 0x00);
+			OV7725_Reg_Write(0x2e, 0x00);
 			break;
-		case 1://sunny
-			SCCB_WriteByte(0x13, 0xfd); //AWB off
-			SCCB_WriteByte(0x01, 0x5a);
-			SCCB_WriteByte(0x02, 0x5c);
-			SCCB_WriteByte(0x0e, 0x65);
-			SCCB_WriteByte(0x2d, 0x00);
-			SCCB_WriteByte(0x2e, 0x00);
+		case 1://sunny，晴天
+			OV7725_Reg_Write(0x13, 0xfd); //AWB off
+			OV7725_Reg_Write(0x01, 0x5a);
+			OV7725_Reg_Write(0x02, 0x5c);
+			OV7725_Reg_Write(0x0e, 0x65);
+			OV7725_Reg_Write(0x2d, 0x00);
+			OV7725_Reg_Write(0x2e, 0x00);
 			break;	
-		case 2://cloudy
-			SCCB_WriteByte(0x13, 0xfd); //AWB off
-			SCCB_WriteByte(0x01, 0x58);
-			SCCB_WriteByte(0x02, 0x60);
-			SCCB_WriteByte(0x0e, 0x65);
-			SCCB_WriteByte(0x2d, 0x00);
-			SCCB_WriteByte(0x2e, 0x00);
+		case 2://cloudy，多云
+			OV7725_Reg_Write(0x13, 0xfd); //AWB off
+			OV7725_Reg_Write(0x01, 0x58);
+			OV7725_Reg_Write(0x02, 0x60);
+			OV7725_Reg_Write(0x0e, 0x65);
+			OV7725_Reg_Write(0x2d, 0x00);
+			OV7725_Reg_Write(0x2e, 0x00);
 			break;	
-		case 3://office칫
-			SCCB_WriteByte(0x13, 0xfd); //AWB off
-			SCCB_WriteByte(0x01, 0x84);
-			SCCB_WriteByte(0x02, 0x4c);
-			SCCB_WriteByte(0x0e, 0x65);
-			SCCB_WriteByte(0x2d, 0x00);
-			SCCB_WriteByte(0x2e, 0x00);
+		case 3://office，办公室
+			OV7725_Reg_Write(0x13, 0xfd); //AWB off
+			OV7725_Reg_Write(0x01, 0x84);
+			OV7725_Reg_Write(0x02, 0x4c);
+			OV7725_Reg_Write(0x0e, 0x65);
+			OV7725_Reg_Write(0x2d, 0x00);
+			OV7725_Reg_Write(0x2e, 0x00);
 			break;	
-		case 4://home
-			SCCB_WriteByte(0x13, 0xfd); //AWB off
-			SCCB_WriteByte(0x01, 0x96);
-			SCCB_WriteByte(0x02, 0x40);
-			SCCB_WriteByte(0x0e, 0x65);
-			SCCB_WriteByte(0x2d, 0x00);
-			SCCB_WriteByte(0x2e, 0x00);
+		case 4://home，家里
+			OV7725_Reg_Write(0x13, 0xfd); //AWB off
+			OV7725_Reg_Write(0x01, 0x96);
+			OV7725_Reg_Write(0x02, 0x40);
+			OV7725_Reg_Write(0x0e, 0x65);
+			OV7725_Reg_Write(0x2d, 0x00);
+			OV7725_Reg_Write(0x2e, 0x00);
 			break;	
 		
-		case 5://nightҹ
-			SCCB_WriteByte(0x13, 0xff); //AWB on
-			SCCB_WriteByte(0x0e, 0xe5);
+		case 5://night，夜晚
+			OV7725_Reg_Write(0x13, 0xff); //AWB on
+			OV7725_Reg_Write(0x0e, 0xe5);
 			break;	
 		
 		default:
@@ -436,17 +637,17 @@ void OV7725_Light_Mode(uint8_t mode)
 
 
 /**
-  * @brief  ñͶ
-  * @param  sat:Ͷ,Χ[-4 ~ +4]             	
-  * @retval 
+  * @brief  设置饱和度
+  * @param  sat:饱和度,参数范围[-4 ~ +4]             	
+  * @retval 无
   */
 void OV7725_Color_Saturation(int8_t sat)
 {
 
  	if(sat >=-4 && sat<=4)
 	{	
-		SCCB_WriteByte(REG_USAT, (sat+4)<<4); 
-		SCCB_WriteByte(REG_VSAT, (sat+4)<<4);
+		OV7725_Reg_Write(REG_USAT, (sat+4)<<4); 
+		OV7725_Reg_Write(REG_VSAT, (sat+4)<<4);
 	}
 	else
 	{
@@ -457,9 +658,9 @@ void OV7725_Color_Saturation(int8_t sat)
 
 
 /**
-  * @brief  ùն
-	* @param  bri:նȣΧ[-4~+4]
-  * @retval 
+  * @brief  设置光照度
+	* @param  bri:光照度，参数范围[-4~+4]
+  * @retval 无
   */
 void OV7725_Brightness(int8_t bri)
 {
@@ -517,20 +718,20 @@ void OV7725_Brightness(int8_t bri)
 			break;
 	}
 
-		SCCB_WriteByte(REG_BRIGHT, BRIGHT_Value); //AWB on
-		SCCB_WriteByte(REG_SIGN, SIGN_Value);
+		OV7725_Reg_Write(REG_BRIGHT, BRIGHT_Value); //AWB on
+		OV7725_Reg_Write(REG_SIGN, SIGN_Value);
 }		
 
 /**
-  * @brief  öԱȶ
-	* @param  cnst:ԱȶȣΧ[-4~+4]
-  * @retval 
+  * @brief  设置对比度
+	* @param  cnst:对比度，参数范围[-4~+4]
+  * @retval 无
   */
 void OV7725_Contrast(int8_t cnst)
 {
 	if(cnst >= -4 && cnst <=4)
 	{
-		SCCB_WriteByte(REG_CNST, (0x30-(4-cnst)*4));
+		OV7725_Reg_Write(REG_CNST, (0x30-(4-cnst)*4));
 	}
 	else
 	{
@@ -540,59 +741,59 @@ void OV7725_Contrast(int8_t cnst)
 
 
 /**
-  * @brief  Ч
-	* @param  eff:ЧΧ[0~6]:
-			@arg 0:
-			@arg 1:ڰ
-			@arg 2:ƫ
-			@arg 3:
-			@arg 4:ƫ
-			@arg 5:ƫ
-			@arg 6:
-  * @retval 
+  * @brief  设置特殊效果
+	* @param  eff:特殊效果，参数范围[0~6]:
+			@arg 0:正常
+			@arg 1:黑白
+			@arg 2:偏蓝
+			@arg 3:复古
+			@arg 4:偏红
+			@arg 5:偏绿
+			@arg 6:反相
+  * @retval 无
   */
 void OV7725_Special_Effect(uint8_t eff)
 {
 	switch(eff)
 	{
-		case 0://
-			SCCB_WriteByte(0xa6, 0x06);
-			SCCB_WriteByte(0x60, 0x80);
-			SCCB_WriteByte(0x61, 0x80);
+		case 0://正常
+			OV7725_Reg_Write(0xa6, 0x06);
+			OV7725_Reg_Write(0x60, 0x80);
+			OV7725_Reg_Write(0x61, 0x80);
 		break;
 		
-		case 1://ڰ
-			SCCB_WriteByte(0xa6, 0x26);
-			SCCB_WriteByte(0x60, 0x80);
-			SCCB_WriteByte(0x61, 0x80);
+		case 1://黑白
+			OV7725_Reg_Write(0xa6, 0x26);
+			OV7725_Reg_Write(0x60, 0x80);
+			OV7725_Reg_Write(0x61, 0x80);
 		break;	
 		
-		case 2://ƫ
-			SCCB_WriteByte(0xa6, 0x1e);
-			SCCB_WriteByte(0x60, 0xa0);
-			SCCB_WriteByte(0x61, 0x40);	
+		case 2://偏蓝
+			OV7725_Reg_Write(0xa6, 0x1e);
+			OV7725_Reg_Write(0x60, 0xa0);
+			OV7725_Reg_Write(0x61, 0x40);	
 		break;	
 		
-		case 3://
-			SCCB_WriteByte(0xa6, 0x1e);
-			SCCB_WriteByte(0x60, 0x40);
-			SCCB_WriteByte(0x61, 0xa0);	
+		case 3://复古
+			OV7725_Reg_Write(0xa6, 0x1e);
+			OV7725_Reg_Write(0x60, 0x40);
+			OV7725_Reg_Write(0x61, 0xa0);	
 		break;	
 		
-		case 4://ƫ
-			SCCB_WriteByte(0xa6, 0x1e);
-			SCCB_WriteByte(0x60, 0x80);
-			SCCB_WriteByte(0x61, 0xc0);		
+		case 4://偏红
+			OV7725_Reg_Write(0xa6, 0x1e);
+			OV7725_Reg_Write(0x60, 0x80);
+			OV7725_Reg_Write(0x61, 0xc0);		
 		break;	
 		
-		case 5://ƫ
-			SCCB_WriteByte(0xa6, 0x1e);
-			SCCB_WriteByte(0x60, 0x60);
-			SCCB_WriteByte(0x61, 0x60);		
+		case 5://偏绿
+			OV7725_Reg_Write(0xa6, 0x1e);
+			OV7725_Reg_Write(0x60, 0x60);
+			OV7725_Reg_Write(0x61, 0x60);		
 		break;	
 		
-		case 6://
-			SCCB_WriteByte(0xa6, 0x46);
+		case 6://反相
+			OV7725_Reg_Write(0xa6, 0x46);
 		break;	
 				
 		default:
@@ -604,20 +805,20 @@ void OV7725_Special_Effect(uint8_t eff)
 
 
 /**
-  * @brief  ͼڣֱʣQVGA
-	* @param  sx:xʼλ
-	* @param  sy:yʼλ
-	* @param  width:ڿ
-	* @param  height:ڸ߶
-	* @param QVGA_VGA:0,QVGAģʽ1VGAģʽ
+  * @brief  设置图像输出窗口（分辨率）QVGA
+	* @param  sx:窗口x起始位置
+	* @param  sy:窗口y起始位置
+	* @param  width:窗口宽度
+	* @param  height:窗口高度
+	* @param QVGA_VGA:0,QVGA模式，1，VGA模式
   *
-	* @note 	QVGAģʽ Ҫsx + width <= 320 ,sy+height <= 240
-	* 			 	VGAģʽҪsx + width <= 640 ,sy+height <= 480
-	*					 Һֱ  FIFOռ ƣ̲ڳ320*240
-	*         ʹVGAģʽҪΪOV7725޷ֱӽXYQVGAʹƽʾ
-	*					óVGAģʽʹʾ
-	*					QVGAģʽֱͬ VGAģʽ ͼ֡
-  * @retval 
+	* @note 	QVGA模式 参数要求，sx + width <= 320 ,sy+height <= 240
+	* 			 	VGA模式参数要求，sx + width <= 640 ,sy+height <= 480
+	*					但由于 液晶屏分辨率 和 FIFO空间 的限制，本工程不适用于超过320*240的配置
+	*         使用VGA模式主要是因为OV7725无法直接交换XY方向，QVGA不方便使用竖平显示，
+	*					设置成VGA模式，可以使用竖屏显示，
+	*					相对QVGA模式，同样分辨率下 VGA模式 图像采样帧率稍慢
+  * @retval 无
   */
 void OV7725_Window_Set(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height,uint8_t QVGA_VGA)
 {
@@ -626,72 +827,72 @@ void OV7725_Window_Set(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height,ui
 	/***********QVGA or VGA *************/
 	if(QVGA_VGA == 0)
 	{
-		/*QVGA RGB565 */
-		SCCB_WriteByte(REG_COM7,0x46); 
+		/*QVGA RGB565 / YUV */
+		OV7725_Reg_Write(REG_COM7,OV7725_FORMAT_IS_RGB(cam_mode.format) ? 0x46 : 0x40); 
 	}
 	else
 	{
-			/*VGA RGB565 */
-		SCCB_WriteByte(REG_COM7,0x06); 
+			/*VGA RGB565 / YUV */
+		OV7725_Reg_Write(REG_COM7,OV7725_FORMAT_IS_RGB(cam_mode.format) ? 0x06 : 0x00); 
 	}
 
 	/***************HSTART*********************/
-	//ȡĴԭݣHStartƫֵԭʼƫֲĻϼϴƫ	
-	SCCB_ReadByte(&reg_raw,1,REG_HSTART);
+	//读取寄存器的原内容，HStart包含偏移值，在原始偏移植的基础上加上窗口偏移	
+	reg_raw = OV7725_Reg_Read(REG_HSTART);
 	
-	//sxΪƫƣ8λ洢HSTART2λHREF
+	//sx为窗口偏移，高8位存储在HSTART，低2位在HREF
 	cal_temp = (reg_raw + (sx>>2));	
-	SCCB_WriteByte(REG_HSTART,cal_temp ); 
+	OV7725_Reg_Write(REG_HSTART,cal_temp ); 
 	
 	/***************HSIZE*********************/
-	//ˮƽȣ8λ洢HSIZE2λ洢HREF
-	SCCB_WriteByte(REG_HSIZE,width>>2);//HSIZEλ 
+	//水平宽度，高8位存储在HSIZE，低2位存储在HREF
+	OV7725_Reg_Write(REG_HSIZE,width>>2);//HSIZE左移两位 
 	
 	
 	/***************VSTART*********************/
-	//ȡĴԭݣVStartƫֵԭʼƫֲĻϼϴƫ	
-	SCCB_ReadByte(&reg_raw,1,REG_VSTRT);	
-	//syΪƫƣ8λ洢HSTART1λHREF
+	//读取寄存器的原内容，VStart包含偏移值，在原始偏移植的基础上加上窗口偏移	
+	reg_raw = OV7725_Reg_Read(REG_VSTRT);	
+	//sy为窗口偏移，高8位存储在HSTART，低1位在HREF
 	cal_temp = (reg_raw + (sy>>1));	
 	
-	SCCB_WriteByte(REG_VSTRT,cal_temp);
+	OV7725_Reg_Write(REG_VSTRT,cal_temp);
 	
 	/***************VSIZE*********************/
-	//ֱ߶ȣ8λ洢VSIZE1λ洢HREF
-	SCCB_WriteByte(REG_VSIZE,height>>1);//VSIZEһλ
+	//垂直高度，高8位存储在VSIZE，低1位存储在HREF
+	OV7725_Reg_Write(REG_VSIZE,height>>1);//VSIZE左移一位
 	
 	/***************VSTART*********************/
-	//ȡĴԭ	
-	SCCB_ReadByte(&reg_raw,1,REG_HREF);	
-	//ˮƽȵĵ2λֱ߶ȵĵ1λˮƽƫƵĵ2λֱƫƵĵ1λӵHREF
+	//读取寄存器的原内容	
+	reg_raw = OV7725_Reg_Read(REG_HREF);	
+	//把水平宽度的低2位、垂直高度的低1位，水平偏移的低2位，垂直偏移的低1位的配置添加到HREF
 	cal_temp = (reg_raw |(width&0x03)|((height&0x01)<<2)|((sx&0x03)<<4)|((sy&0x01)<<6));	
 	
-	SCCB_WriteByte(REG_HREF,cal_temp);
+	OV7725_Reg_Write(REG_HREF,cal_temp);
 	
 	/***************HOUTSIZIE /VOUTSIZE*********************/
-	SCCB_WriteByte(REG_HOutSize,width>>2);
-	SCCB_WriteByte(REG_VOutSize,height>>1);
+	OV7725_Reg_Write(REG_HOutSize,width>>2);
+	OV7725_Reg_Write(REG_VOutSize,height>>1);
 	
-	//ȡĴԭ	
-	SCCB_ReadByte(&reg_raw,1,REG_EXHCH);	
+	//读取寄存器的原内容	
+	reg_raw = OV7725_Reg_Read(REG_EXHCH);	
 	cal_temp = (reg_raw |(width&0x03)|((height&0x01)<<2));	
 
-	SCCB_WriteByte(REG_EXHCH,cal_temp);	
+	OV7725_Reg_Write(REG_EXHCH,cal_temp);	
 }
 
 
 /**
-  * @brief  ͼڣֱʣVGA
-	* @param  sx:xʼλ
-	* @param  sy:yʼλ
-	* @param  width:ڿ
-	* @param  height:ڸ߶
-	* @note 	Ҫsx + width <= 640 ,sy+height <= 480
-	*					 Һֱ  FIFOռ ƣ̲ڳ320*240
-	*         ʹñҪΪOV7725޷ֱӽXYQVGAʹƽʾ
-	*					ʹñóVGAģʽʹʾ
-	*					QVGAģʽֱͬ VGAģʽ ͼ֡
-  * @retval 
+  * @brief  设置图像输出窗口（分辨率）VGA
+	* @param  sx:窗口x起始位置
+	* @param  sy:窗口y起始位置
+	* @param  width:窗口宽度
+	* @param  height:窗口高度
+	* @note 	本函数参数要求，sx + width <= 640 ,sy+height <= 480
+	*					但由于 液晶屏分辨率 和 FIFO空间 的限制，本工程不适用于超过320*240的配置
+	*         使用本函数主要是因为OV7725无法直接交换XY方向，QVGA不方便使用竖平显示，
+	*					使用本函数设置成VGA模式，可以使用竖屏显示，
+	*					相对QVGA模式，同样分辨率下 VGA模式 图像采样帧率稍慢
+  * @retval 无
   */
 void OV7725_Window_VGA_Set(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height)
 {
@@ -700,60 +901,60 @@ void OV7725_Window_VGA_Set(uint16_t sx,uint16_t sy,uint16_t width,uint16_t heigh
 
 	/***********QVGA or VGA *************/
 	/*VGA RGB565 */
-	SCCB_WriteByte(REG_COM7,0x06); 
+	OV7725_Reg_Write(REG_COM7,0x06); 
 
 	/***************HSTART*********************/
-	//ȡĴԭݣHStartƫֵԭʼƫֲĻϼϴƫ	
-	SCCB_ReadByte(&reg_raw,1,REG_HSTART);
+	//读取寄存器的原内容，HStart包含偏移值，在原始偏移植的基础上加上窗口偏移	
+	reg_raw = OV7725_Reg_Read(REG_HSTART);
 	
-	//sxΪƫƣ8λ洢HSTART2λHREF
+	//sx为窗口偏移，高8位存储在HSTART，低2位在HREF
 	cal_temp = (reg_raw + (sx>>2));	
-	SCCB_WriteByte(REG_HSTART,cal_temp ); 
+	OV7725_Reg_Write(REG_HSTART,cal_temp ); 
 	
 	/***************HSIZE*********************/
-	//ˮƽȣ8λ洢HSIZE2λ洢HREF
-	SCCB_WriteByte(REG_HSIZE,width>>2);//HSIZEλ 320 
+	//水平宽度，高8位存储在HSIZE，低2位存储在HREF
+	OV7725_Reg_Write(REG_HSIZE,width>>2);//HSIZE左移两位 320 
 	
 	
 	/***************VSTART*********************/
-	//ȡĴԭݣVStartƫֵԭʼƫֲĻϼϴƫ	
-	SCCB_ReadByte(&reg_raw,1,REG_VSTRT);	
-	//syΪƫƣ8λ洢HSTART1λHREF
+	//读取寄存器的原内容，VStart包含偏移值，在原始偏移植的基础上加上窗口偏移	
+	reg_raw = OV7725_Reg_Read(REG_VSTRT);	
+	//sy为窗口偏移，高8位存储在HSTART，低1位在HREF
 	cal_temp = (reg_raw + (sy>>1));	
 	
-	SCCB_WriteByte(REG_VSTRT,cal_temp);
+	OV7725_Reg_Write(REG_VSTRT,cal_temp);
 	
 	/***************VSIZE*********************/
-	//ֱ߶ȣ8λ洢VSIZE1λ洢HREF
-	SCCB_WriteByte(REG_VSIZE,height>>1);//VSIZEһλ 240
+	//垂直高度，高8位存储在VSIZE，低1位存储在HREF
+	OV7725_Reg_Write(REG_VSIZE,height>>1);//VSIZE左移一位 240
 	
 	/***************VSTART*********************/
-	//ȡĴԭ	
-	SCCB_ReadByte(&reg_raw,1,REG_HREF);	
-	//ˮƽȵĵ2λֱ߶ȵĵ1λˮƽƫƵĵ2λֱƫƵĵ1λӵHREF
+	//读取寄存器的原内容	
+	reg_raw = OV7725_Reg_Read(REG_HREF);	
+	//把水平宽度的低2位、垂直高度的低1位，水平偏移的低2位，垂直偏移的低1位的配置添加到HREF
 	cal_temp = (reg_raw |(width&0x03)|((height&0x01)<<2)|((sx&0x03)<<4)|((sy&0x01)<<6));	
 	
-	SCCB_WriteByte(REG_VSTRT,cal_temp);
+	OV7725_Reg_Write(REG_VSTRT,cal_temp);
 	
 	/***************HOUTSIZIE /VOUTSIZE*********************/
-	SCCB_WriteByte(REG_HOutSize,width>>2);
-	SCCB_WriteByte(REG_VOutSize,height>>1);
+	OV7725_Reg_Write(REG_HOutSize,width>>2);
+	OV7725_Reg_Write(REG_VOutSize,height>>1);
 	
-	//ȡĴԭ	
-	SCCB_ReadByte(&reg_raw,1,REG_EXHCH);	
+	//读取寄存器的原内容	
+	reg_raw = OV7725_Reg_Read(REG_EXHCH);	
 	
 	cal_temp = (reg_raw |(width&0x03)|((height&0x01)<<2));	
 
-	SCCB_WriteByte(REG_EXHCH,cal_temp);	
+	OV7725_Reg_Write(REG_EXHCH,cal_temp);	
 }
 
 /**
-  * @brief  ʾλ
-	* @param  sx:xʼʾλ
-	* @param  sy:yʼʾλ
-	* @param  width:ʾڿ,ҪOV7725_Window_Setеwidthһ
-	* @param  height:ʾڸ߶ȣҪOV7725_Window_Setеheightһ
-  * @retval 
+  * @brief  设置显示位置
+	* @param  sx:x起始显示位置
+	* @param  sy:y起始显示位置
+	* @param  width:显示窗口宽度,要求跟OV7725_Window_Set函数中的width一致
+	* @param  height:显示窗口高度，要求跟OV7725_Window_Set函数中的height一致
+  * @retval 无
   */
 void ImagDisp(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height)
 {
@@ -767,68 +968,984 @@ void ImagDisp(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height)
 	{
 		for(j = 0; j < height; j++)
 		{
-			READ_FIFO_PIXEL(Camera_Data);		/* FIFOһrgb565صCamera_Data */
+			READ_FIFO_PIXEL(Camera_Data);		/* 从FIFO读出一个rgb565像素到Camera_Data变量 */
 			ILI9341_Write_Data(Camera_Data);
 		}
 	}
 }
 
+/**
+  * @brief  从FIFO读出若干行RGB565数据
+	* @param  buf:存放数据，需按4字节对齐
+	* @param  width:行宽（像素）
+	* @param  lines:行数
+  * @retval 无
+  * @note   宽度为2的倍数时一行是整字，每行用OV7725_ReadBytes按字读；奇数宽度逐字节读
+  */
+void OV7725_ReadLines(uint8_t *buf, uint16_t width, uint16_t lines)
+{
+	uint32_t n;
+	uint8_t Camera_Data;
+
+	if((width & 1) == 0)
+	{
+		for(; lines > 0; lines--)
+			buf += OV7725_ReadBytes(buf, width * 2);
+		return;
+	}
+	for(n = (uint32_t)width * lines * 2; n > 0; n--)
+	{
+		READ_FIFO_PIXEL(Camera_Data);
+		*buf++ = Camera_Data;
+	}
+}
+
+/**
+  * @brief  从FIFO读出n字节，不按行对齐，用于行跨包的原始图像包
+	* @param  buf:存放数据，需按4字节对齐
+	* @param  n:字节数，4的倍数
+  * @retval 读出的字节数（n）
+  * @note   每次循环读16字节（4个字）并按32位写入，不足16字节的部分逐字读
+  */
+uint16_t OV7725_ReadBytes(uint8_t *buf, uint16_t n)
+{
+	uint32_t *dst = (uint32_t *)buf;
+	uint16_t i;
+
+	for(i = n / 16; i > 0; i--)
+	{
+		READ_FIFO_WORD(dst[0]);
+		READ_FIFO_WORD(dst[1]);
+		READ_FIFO_WORD(dst[2]);
+		READ_FIFO_WORD(dst[3]);
+		dst += 4;
+	}
+	for(i = (n & 15) / 4; i > 0; i--)
+	{
+		READ_FIFO_WORD(dst[0]);
+		dst++;
+	}
+	return n;
+}
+
+/*边读边算的读出（只留Y、合并、隔列、RGB332）按字取数据。
+  CPU读方式直接读FIFO；DMA读方式每次先OV7725_SRC_BEGIN给出这次读的字节数，
+  由TIM8+DMA一段段读进行缓冲，CPU从行缓冲取，见bsp_ov7725_dma.c。
+  主机测试（OV7725_FIFO_SIM）用CPU读，测DMA方式时在编译选项里定义为1*/
+#ifndef OV7725_READ_SRC_DMA
+#if (APP_CFG_OV7725_READ_MODE == OV7725_READ_DMA) && !defined(OV7725_FIFO_SIM)
+#define OV7725_READ_SRC_DMA         1
+#else
+#define OV7725_READ_SRC_DMA         0
+#endif
+#endif
+
+#if (OV7725_READ_SRC_DMA)
+static const uint32_t *ov7725_src;
+static uint16_t ov7725_src_words;               //行缓冲中还没取的字数
+#define OV7725_SRC_BEGIN(n)         do{\
+	                                  OV7725_DMA_StreamBegin(n);\
+	                                  ov7725_src_words = 0;\
+                                    }while(0)
+#define OV7725_SRC_WORD(WORD)       do{\
+	                                  if(ov7725_src_words == 0)\
+	                                    ov7725_src = OV7725_DMA_StreamNext(&ov7725_src_words);\
+	                                  WORD = *ov7725_src++;\
+	                                  ov7725_src_words--;\
+                                    }while(0)
+#else
+#define OV7725_SRC_BEGIN(n)         ((void)0)
+#define OV7725_SRC_WORD(WORD)       READ_FIFO_WORD(WORD)
+#endif
+
+/*合并用的行累加器，每个输出像素一个字，只需一行*/
+static uint32_t ov7725_bin_acc[640 / 2];
+
+/*RGB565展开：G移到高半字，R、B留在低半字，分量之间留出空位，
+  一个字里三个分量同时相加，16个像素相加也不会进位到相邻分量*/
+#define RGB565_SPREAD(P)            ((((uint32_t)(P)) | ((uint32_t)(P) << 16)) & 0x07E0F81Fu)
+#define RGB565_FOLD(S)              ((uint16_t)(((S) & 0x07E0F81Fu) | (((S) & 0x07E0F81Fu) >> 16)))
+/*每个分量加factor*factor/2，四舍五入*/
+#define RGB565_ROUND_2              ((2u << 21) | (2u << 11) | 2u)
+#define RGB565_ROUND_4              ((8u << 21) | (8u << 11) | 8u)
+
+/**
+  * @brief  从FIFO读出factor行，每factor*factor个像素取平均，合并成一行
+	* @param  out:输出，RGB565高字节在前，灰度每像素1字节
+	* @param  width:输入行宽（像素），需为2*factor的倍数且不大于640
+	* @param  factor:2或4
+	* @param  format:OV7725_FORMAT_RGB565，或OV7725_FORMAT_GRAY（FIFO中为YUYV，只用Y）
+  * @retval 输出字节数
+  * @note   一次读4字节即2个像素；结果为各分量 (和 + factor*factor/2) / (factor*factor)
+  */
+uint16_t OV7725_ReadBinned(uint8_t *out, uint16_t width, uint8_t factor, uint8_t format)
+{
+	uint32_t w, sum;
+	uint16_t x, n;
+	uint16_t out_w = width / factor;
+	uint16_t words = factor / 2;                    //每个输出像素在一行中的字数
+	uint8_t shift = (factor == 2) ? 2 : 4;
+	uint8_t line;
+
+	for(x = 0; x < out_w; x++)
+		ov7725_bin_acc[x] = 0;
+
+	OV7725_SRC_BEGIN((uint32_t)width * 2 * factor);
+	for(line = 0; line < factor; line++)
+	{
+		if(format == OV7725_FORMAT_GRAY)
+		{
+			for(x = 0; x < out_w; x++)
+			{
+				sum = 0;
+				for(n = words; n > 0; n--)
+				{
+					OV7725_SRC_WORD(w);
+					w = (w >> (OV7725_Y_OFFSET * 8)) & 0x00ff00ffu;    //两个Y各占一个半字
+					sum += w;
+				}
+				ov7725_bin_acc[x] += (sum & 0xffff) + (sum >> 16);
+			}
+		}
+		else
+		{
+			for(x = 0; x < out_w; x++)
+			{
+				sum = 0;
+				for(n = words; n > 0; n--)
+				{
+					OV7725_SRC_WORD(w);
+					w = ((w & 0x00ff00ffu) << 8) | ((w >> 8) & 0x00ff00ffu); //每个半字高低字节交换，得到两个像素
+					sum += RGB565_SPREAD(w & 0xffff) + RGB565_SPREAD(w >> 16);
+				}
+				ov7725_bin_acc[x] += sum;
+			}
+		}
+	}
+
+	if(format == OV7725_FORMAT_GRAY)
+	{
+		for(x = 0; x < out_w; x++)
+			out[x] = (uint8_t)((ov7725_bin_acc[x] + (1u << (shift - 1))) >> shift);
+		return out_w;
+	}
+	for(x = 0; x < out_w; x++)
+	{
+		w = RGB565_FOLD((ov7725_bin_acc[x] + ((factor == 2) ? RGB565_ROUND_2 : RGB565_ROUND_4)) >> shift);
+		*out++ = (uint8_t)(w >> 8);
+		*out++ = (uint8_t)w;
+	}
+	return out_w * 2;
+}
+
+/*读一行中[x, end)这几个输出像素的原始数据累加进ov7725_bin_acc
+  save不为NULL时同时把原始像素依次存入save（RGB565高字节在前，灰度只存Y），返回存到的位置*/
+static uint8_t *OV7725_BinSpan(uint16_t x, uint16_t end, uint16_t words, uint8_t format, uint8_t *save)
+{
+	uint32_t w, sum;
+	uint16_t n;
+
+	if(format == OV7725_FORMAT_GRAY)
+	{
+		for(; x < end; x++)
+		{
+			sum = 0;
+			for(n = words; n > 0; n--)
+			{
+				OV7725_SRC_WORD(w);
+				w = (w >> (OV7725_Y_OFFSET * 8)) & 0x00ff00ffu;
+				if(save)
+				{
+					*save++ = (uint8_t)w;
+					*save++ = (uint8_t)(w >> 16);
+				}
+				sum += w;
+			}
+			ov7725_bin_acc[x] += (sum & 0xffff) + (sum >> 16);
+		}
+	}
+	else
+	{
+		for(; x < end; x++)
+		{
+			sum = 0;
+			for(n = words; n > 0; n--)
+			{
+				OV7725_SRC_WORD(w);
+				w = ((w & 0x00ff00ffu) << 8) | ((w >> 8) & 0x00ff00ffu);
+				if(save)
+				{
+					*save++ = (uint8_t)(w >> 8);
+					*save++ = (uint8_t)w;
+					*save++ = (uint8_t)(w >> 24);
+					*save++ = (uint8_t)(w >> 16);
+				}
+				sum += RGB565_SPREAD(w & 0xffff) + RGB565_SPREAD(w >> 16);
+			}
+			ov7725_bin_acc[x] += sum;
+		}
+	}
+	return save;
+}
+
+/**
+  * @brief  同OV7725_ReadBinned，另外把这factor行中[roi_x, roi_x+roi_w)的原始像素逐行存入roi
+	* @param  roi:原始像素输出，共factor*roi_w个像素，NULL时只合并
+	* @param  roi_x, roi_w:需为factor的倍数
+  * @retval 合并后一行的输出字节数
+  * @note   用于区域加权传输：ROI内全分辨率，ROI外只发合并后的行
+  */
+uint16_t OV7725_ReadBinnedRoi(uint8_t *out, uint16_t width, uint8_t factor, uint8_t format,
+                              uint8_t *roi, uint16_t roi_x, uint16_t roi_w)
+{
+	uint32_t w;
+	uint16_t x;
+	uint16_t out_w = width / factor;
+	uint16_t x0 = roi_x / factor, x1 = (roi_x + roi_w) / factor;
+	uint16_t words = factor / 2;
+	uint8_t shift = (factor == 2) ? 2 : 4;
+	uint8_t line;
+
+	for(x = 0; x < out_w; x++)
+		ov7725_bin_acc[x] = 0;
+
+	OV7725_SRC_BEGIN((uint32_t)width * 2 * factor);
+	for(line = 0; line < factor; line++)
+	{
+		OV7725_BinSpan(0, x0, words, format, NULL);
+		roi = OV7725_BinSpan(x0, x1, words, format, roi);
+		OV7725_BinSpan(x1, out_w, words, format, NULL);
+	}
+
+	if(format == OV7725_FORMAT_GRAY)
+	{
+		for(x = 0; x < out_w; x++)
+			out[x] = (uint8_t)((ov7725_bin_acc[x] + (1u << (shift - 1))) >> shift);
+		return out_w;
+	}
+	for(x = 0; x < out_w; x++)
+	{
+		w = RGB565_FOLD((ov7725_bin_acc[x] + ((factor == 2) ? RGB565_ROUND_2 : RGB565_ROUND_4)) >> shift);
+		*out++ = (uint8_t)(w >> 8);
+		*out++ = (uint8_t)w;
+	}
+	return out_w * 2;
+}
+
 /************************************************
- * Camera_Init
- *   ͷʼ
- *   
- *   1ɹ0ʧ
- * ע  
+ * 函数名：Camera_Init
+ * 描述  ：摄像头初始化
+ * 输入  ：无
+ * 输出  ：返回1成功，返回0失败
+ * 注意  ：无
  ************************************************/
 ErrorStatus Camera_Init(void)
 {
 	uint8_t retry = 0;
-	/* ov7725 gpio ʼ */
+	/* ov7725 gpio 初始化 */
 	OV7725_GPIO_Config();
 	macLED1_ON();
-	/* ov7725 ĴĬóʼ */
+	/* ov7725 寄存器默认配置初始化 */
 	while(OV7725_Init() != SUCCESS)
 	{
 		retry++;
 		if(retry>5)
 		{
-			printf("\r\nûм⵽OV7725ͷ\r\n");
+			printf("\r\n没有检测到OV7725摄像头\r\n");
 			ILI9341_DispStringLine_EN(LINE(2),"No OV7725 module detected!");
-			while(1);
+			return ERROR;                 //没有摄像头时只能用合成测试图案
 		}
 	}
 
-	/*ͷģʽ*/
+	/*根据摄像头参数组配置模式*/
 	OV7725_Special_Effect(cam_mode.effect);
-	/*ģʽ*/
+	/*光照模式*/
 	OV7725_Light_Mode(cam_mode.light_mode);
-	/*Ͷ*/
+	/*饱和度*/
 	OV7725_Color_Saturation(cam_mode.saturation);
-	/*ն*/
+	/*光照度*/
 	OV7725_Brightness(cam_mode.brightness);
-	/*Աȶ*/
+	/*对比度*/
 	OV7725_Contrast(cam_mode.contrast);
-	/*Ч*/
+	/*特殊效果*/
 	OV7725_Special_Effect(cam_mode.effect);
 	
-	/*ͼģʽС*/
+	/*设置图像采样及模式大小*/
 	OV7725_Window_Set(cam_mode.cam_sx,
 					  cam_mode.cam_sy,
 					  cam_mode.cam_width,
 					  cam_mode.cam_height,
 					  cam_mode.QVGA_VGA);
 
-	/* Һɨģʽ */
+	/* 设置液晶扫描模式 */
+	OV7725_Reg_Flush();
+	
 	ILI9341_GramScan( cam_mode.lcd_scan );
 	
 	
 	
 	ILI9341_DispStringLine_EN(LINE(2),"OV7725 initialize success!");
-	printf("\r\nOV7725ͷʼ\r\n");
+	printf("\r\nOV7725摄像头初始化完成\r\n");
+	
+	ov7725_pipe.frame_bytes = (uint32_t)cam_mode.cam_width * cam_mode.cam_height * 2;
+	ov7725_present = 1;
+	
+	return SUCCESS;
+}
+
+/************************************************
+ * 函数名：OV7725_ColorBar
+ * 描述  ：打开/关闭传感器彩条测试图案
+ * 输入  ：on:1打开 0关闭
+ * 输出  ：SUCCESS:已设置 ERROR:没有摄像头
+ * 注意  ：彩条经过传感器DSP，不保证逐字节不变
+ ************************************************/
+ErrorStatus OV7725_ColorBar(uint8_t on)
+{
+	uint8_t reg_raw;
+	
+	if(!ov7725_present)
+		return ERROR;
+	reg_raw = OV7725_Reg_Read(REG_COM3);
+	if(on)
+		reg_raw |= 0x01;                      //COM3[0]：彩条输出
+	else
+		reg_raw &= ~0x01;
+	OV7725_Reg_Write(REG_COM3, reg_raw);
+	return SUCCESS;
+}
+
+/************************************************
+ * 函数名：OV7725_Frame_VSYNC
+ * 描述  ：VSYNC中断处理：结束正在写的帧，FIFO放得下就接着写下一帧
+ * 输入  ：无
+ * 输出  ：1：有一帧写完，0：没有
+ * 注意  ：在VSYNC中断中调用
+ ************************************************/
+uint8_t OV7725_Frame_VSYNC(void)
+{
+	uint8_t done = 0;
+	
+	if(ov7725_pipe.writing)
+	{
+		ov7725_pipe.write_seq++;
+		ov7725_pipe.captured++;
+		done = 1;
+	}
+	
+	if(ov7725_pipe.hold)
+	{
+		FIFO_WE_L();                          //窗口寄存器在改，这一帧不要
+		ov7725_pipe.writing = 0;
+		return done;
+	}
+	
+	/*未读的帧（含正在读的）加上新的一帧要放得下*/
+	if((ov7725_pipe.write_seq - ov7725_pipe.read_seq + 1) * ov7725_pipe.frame_bytes <= OV7725_FIFO_SIZE)
+	{
+		if(ov7725_pipe.write_seq == ov7725_pipe.read_seq)
+		{
+			/*FIFO已读空，写指针复位重新对齐*/
+			FIFO_WRST_L();
+			FIFO_WE_H();
+			ov7725_pipe.rewind_seq = ov7725_pipe.write_seq + 1;
+			FIFO_WRST_H();
+		}
+		FIFO_WE_H();                          //写允许，下一帧紧接着写入
+		ov7725_pipe.writing = 1;
+	}
+	else
+	{
+		FIFO_WE_L();                          //写暂停，这一帧丢掉
+		ov7725_pipe.writing = 0;
+		ov7725_pipe.dropped++;
+	}
+	
+	return done;
+}
+
+/************************************************
+ * 函数名：OV7725_Frame_Begin
+ * 描述  ：开始读下一帧
+ * 输入  ：无
+ * 输出  ：1：有写完未读的帧，读指针已就绪，0：没有
+ * 注意  ：在采集任务中调用，读完调用OV7725_Frame_End
+ ************************************************/
+uint8_t OV7725_Frame_Begin(void)
+{
+	if(ov7725_pipe.read_seq == ov7725_pipe.write_seq)
+		return 0;
+	if(ov7725_pipe.read_seq + 1 == ov7725_pipe.rewind_seq)
+	{
+		FIFO_PREPARE;                         //该帧从地址0写入，复位读指针
+		ov7725_pipe.read_addr = 0;
+	}
+	return 1;
+}
+
+/************************************************
+ * 函数名：OV7725_Frame_End
+ * 描述  ：一帧读完，释放它在FIFO中的空间
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：无
+ ************************************************/
+void OV7725_Frame_End(void)
+{
+	ov7725_pipe.read_addr = (ov7725_pipe.read_addr + ov7725_pipe.frame_bytes) % OV7725_FIFO_SIZE;
+	ov7725_pipe.read_seq++;
+}
+
+/************************************************
+ * 函数名：OV7725_Frame_Rewind
+ * 描述  ：读指针回到正在读的帧的开头，重读这一帧
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：在OV7725_Frame_Begin与OV7725_Frame_End之间调用
+ *         读指针只能复位到地址0，再空读到该帧的起点read_addr，
+ *         read_addr按帧尾相接、到头回绕累加，空读不超过FIFO容量
+ *         写指针只在FIFO读空时复位，该帧读完前不会被覆盖
+ ************************************************/
+void OV7725_Frame_Rewind(void)
+{
+	FIFO_PREPARE;
+	OV7725_Skip(ov7725_pipe.read_addr);
+}
+
+/************************************************
+ * 函数名：OV7725_Frame_Skip
+ * 描述  ：正在读的帧不读完，空读到帧尾，接着读下一帧
+ * 输入  ：left:这一帧还没读的字节数
+ * 输出  ：无
+ * 注意  ：在OV7725_Frame_Begin之后代替OV7725_Frame_End调用，计入overrun
+ *         与Discard不同，后面已写完的帧保留，写也不停
+ ************************************************/
+void OV7725_Frame_Skip(uint32_t left)
+{
+	OV7725_Skip(left);
+	ov7725_pipe.overrun++;
+	ov7725_pipe.read_addr = (ov7725_pipe.read_addr + ov7725_pipe.frame_bytes) % OV7725_FIFO_SIZE;
+	ov7725_pipe.read_seq++;
+}
+
+/************************************************
+ * 函数名：OV7725_Frame_Discard
+ * 描述  ：丢弃FIFO中所有未读帧，停止写，下一个VSYNC重新对齐读写指针
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：读一帧中途失败或改变分辨率时调用
+ ************************************************/
+void OV7725_Frame_Discard(void)
+{
+	CPU_SR_ALLOC();
+	
+	CPU_CRITICAL_ENTER();
+	FIFO_WE_L();
+	ov7725_pipe.writing = 0;
+	ov7725_pipe.overrun += ov7725_pipe.write_seq - ov7725_pipe.read_seq;
+	ov7725_pipe.read_seq = ov7725_pipe.write_seq;
+	CPU_CRITICAL_EXIT();
+}
+
+/************************************************
+ * 函数名：OV7725_Frame_Hold
+ * 描述  ：暂停写FIFO并清空帧流水线，准备改传感器寄存器
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：内部调用，改完后清ov7725_pipe.hold
+ ************************************************/
+static void OV7725_Frame_Hold(void)
+{
+	CPU_SR_ALLOC();
+	
+	CPU_CRITICAL_ENTER();
+	ov7725_pipe.hold = 1;
+	FIFO_WE_L();
+	ov7725_pipe.writing = 0;
+	ov7725_pipe.read_seq = ov7725_pipe.write_seq;
+	CPU_CRITICAL_EXIT();
+}
+
+/************************************************
+ * 函数名：OV7725_Default_Reg
+ * 描述  ：查Sensor_Config表中寄存器的初始值
+ * 输入  ：reg:寄存器地址
+ * 输出  ：初始值，表中没有返回0
+ * 注意  ：内部调用
+ ************************************************/
+static uint8_t OV7725_Default_Reg(uint8_t reg)
+{
+	uint8_t i;
+	
+	for(i = 0; i < OV7725_REG_NUM; i++)
+	{
+		if(Sensor_Config[i].Address == reg)
+			return Sensor_Config[i].Value;
+	}
+	return 0;
+}
+
+/************************************************
+ * 函数名：OV7725_Window_Change
+ * 描述  ：运行中改变窗口的位置和大小，可在QVGA、VGA之间切换
+ * 输入  ：sx,sy:窗口起点 width,height:窗口大小 QVGA_VGA:0,QVGA 1,VGA
+ * 输出  ：SUCCESS:已改变 ERROR:参数不合法，窗口不变
+ * 注意  ：在采集任务的帧间隙调用，FIFO中未读的帧全部丢弃（不计入overrun）
+ *         宽度为4的倍数且不小于16，高度为偶数；一帧（每像素2字节）要放得进FIFO，
+ *         VGA最大 640*304 或 320*480 等
+ ************************************************/
+ErrorStatus OV7725_Window_Change(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height,uint8_t QVGA_VGA)
+{
+	uint16_t max_w = QVGA_VGA ? 640 : 320;
+	uint16_t max_h = QVGA_VGA ? 480 : 240;
+	
+	if(width < 16 || (width & 0x03) || height < 2 || (height & 0x01)
+	   || (cam_mode.format == OV7725_FORMAT_RGB332 && (height & 0x03))
+	   || sx + width > max_w || sy + height > max_h
+	   || (uint32_t)width * height * 2 > OV7725_FIFO_SIZE)
+		return ERROR;
+	
+	OV7725_Frame_Hold();
 	
-	Ov7725_vsync = 0;
+	/*OV7725_Window_Set在寄存器原值上加偏移，先恢复初始值*/
+	OV7725_Reg_Write(REG_HSTART, QVGA_VGA ? OV7725_VGA_HSTART : OV7725_Default_Reg(REG_HSTART));
+	OV7725_Reg_Write(REG_VSTRT,  QVGA_VGA ? OV7725_VGA_VSTRT : OV7725_Default_Reg(REG_VSTRT));
+	OV7725_Reg_Write(REG_HREF,   OV7725_Default_Reg(REG_HREF));
+	OV7725_Reg_Write(REG_EXHCH,  OV7725_Default_Reg(REG_EXHCH));
+	OV7725_Window_Set(sx, sy, width, height, QVGA_VGA);
 	
+	cam_mode.QVGA_VGA = QVGA_VGA;
+	cam_mode.cam_sx = sx;
+	cam_mode.cam_sy = sy;
+	cam_mode.cam_width = width;
+	cam_mode.cam_height = height;
+	ov7725_pipe.frame_bytes = (uint32_t)width * height * 2;
+	OV7725_Reg_Flush();                     //改过的寄存器一次写出
+	ov7725_pipe.hold = 0;                   //下一个VSYNC起按新窗口写入
+	
+	OV7725_INFO("window %d,%d %dx%d %s", sx, sy, width, height, QVGA_VGA ? "VGA" : "QVGA");
+	return SUCCESS;
+}
+
+/************************************************
+ * 函数名：OV7725_Format_Change
+ * 描述  ：运行中切换输出格式
+ * 输入  ：format:OV7725_FORMAT_xxx
+ * 输出  ：SUCCESS:已切换 ERROR:格式不支持
+ * 注意  ：在采集任务的帧间隙调用，FIFO中未读的帧全部丢弃（不计入overrun）
+ *         GRAY与YUV422、RGB332与RGB565传感器输出相同，FIFO中每帧字节数不变
+ *         RGB332每包4行，窗口高度需为4的倍数
+ ************************************************/
+ErrorStatus OV7725_Format_Change(uint8_t format)
+{
+	uint8_t com7;
+	
+	if(format > OV7725_FORMAT_RGB332 || (format == OV7725_FORMAT_RGB332 && (cam_mode.cam_height & 0x03)))
+		return ERROR;
+	
+	OV7725_Frame_Hold();
+	
+	cam_mode.format = format;
+	com7 = (cam_mode.QVGA_VGA == 0) ? 0x40 : 0x00;
+	if(OV7725_FORMAT_IS_RGB(format))
+		com7 |= 0x06;
+	OV7725_Reg_Write(REG_COM7, com7);
+	
+	OV7725_Reg_Flush();
+	ov7725_pipe.hold = 0;
+	
+	OV7725_INFO("format %d", format);
+	return SUCCESS;
+}
+
+/************************************************
+ * 函数名：OV7725_FrameRate_Set
+ * 描述  ：运行中改变传感器帧率
+ * 输入  ：div:CLKRC分频，帧率=OV7725_FPS_BASE/(div+1)
+ * 输出  ：SUCCESS:已改变 ERROR:参数不合法或没有摄像头
+ * 注意  ：FIFO写时钟就是像素时钟，正在写的帧仍然完整，不用暂停流水线
+ *         只写影子，由采集任务在帧间隙OV7725_Reg_Flush()
+ ************************************************/
+ErrorStatus OV7725_FrameRate_Set(uint8_t div)
+{
+	if(div > OV7725_CLK_DIV_MAX || !ov7725_present)
+		return ERROR;
+	
+	OV7725_Reg_Write(REG_CLKRC, (OV7725_Default_Reg(REG_CLKRC) & 0xc0) | div);
+	cam_mode.clk_div = div;
+	
+	OV7725_INFO("clkrc div %d, %d fps", div, OV7725_FPS_BASE / (div + 1));
 	return SUCCESS;
 }
 
+/************************************************
+ * 函数名：OV7725_Keep_Y
+ * 描述  ：把读出的YUYV数据就地压缩为只有Y的灰度数据
+ * 输入  ：buf:数据，4字节对齐 len:字节数，4的倍数
+ * 输出  ：压缩后的字节数（len/2）
+ * 注意  ：写位置总在读位置之前，可以就地处理
+ ************************************************/
+uint16_t OV7725_Keep_Y(uint8_t *buf, uint16_t len)
+{
+	uint32_t *src = (uint32_t *)buf;
+	uint16_t *dst = (uint16_t *)buf;
+	uint32_t w;
+	uint16_t i;
+	
+	/*小端：一个字里是 Y0 U Y1 V，取第0和第2字节*/
+	for(i = 0; i < len / 4; i++)
+	{
+		w = src[i] >> (OV7725_Y_OFFSET * 8);
+		dst[i] = (uint16_t)((w & 0x00ff) | ((w >> 8) & 0xff00));
+	}
+	return len / 2;
+}
+
+/************************************************
+ * 函数名：OV7725_ReadY
+ * 描述  ：从FIFO读出YUYV数据，边读边丢U、V，只存Y
+ * 输入  ：buf:存放Y，2字节对齐 n:Y的个数，2的倍数
+ * 输出  ：存入的字节数（n）
+ * 注意  ：用于一包原始数据放不下缓存的宽行（VGA灰度）
+ ************************************************/
+uint16_t OV7725_ReadY(uint8_t *buf, uint16_t n)
+{
+	uint16_t *dst = (uint16_t *)buf;
+	uint32_t w;
+	uint16_t i;
+	
+	OV7725_SRC_BEGIN((uint32_t)n * 2);
+	for(i = 0; i < n / 2; i++)
+	{
+		OV7725_SRC_WORD(w);
+		w >>= (OV7725_Y_OFFSET * 8);
+		dst[i] = (uint16_t)((w & 0x00ff) | ((w >> 8) & 0xff00));
+	}
+	return n;
+}
+
+/************************************************
+ * 函数名：OV7725_Skip
+ * 描述  ：空读FIFO，读指针前移n字节
+ * 输入  ：n:字节数
+ * 输出  ：无
+ * 注意  ：无
+ ************************************************/
+void OV7725_Skip(uint32_t n)
+{
+	while(n--)
+	{
+		FIFO_RCLK_L();
+		FIFO_RCLK_H();
+	}
+}
+
+/************************************************
+ * 函数名：OV7725_ReadHalf
+ * 描述  ：从FIFO读一行，只留偶数或奇数列的像素
+ * 输入  ：out:输出，RGB565高字节在前，灰度每像素1字节
+ *         width:行宽（像素），2的倍数 phase:0留偶数列，1留奇数列
+ *         format:OV7725_FORMAT_RGB565，或OV7725_FORMAT_GRAY（FIFO中为YUYV，只用Y）
+ * 输出  ：存入的字节数
+ * 注意  ：一次读4字节即2个像素，取其中一个
+ ************************************************/
+uint16_t OV7725_ReadHalf(uint8_t *out, uint16_t width, uint8_t phase, uint8_t format)
+{
+	uint8_t *o = out;
+	uint8_t shift = phase * 16;
+	uint32_t w;
+	uint16_t x;
+
+	OV7725_SRC_BEGIN((uint32_t)width * 2);
+	if(format == OV7725_FORMAT_GRAY)
+	{
+		shift += OV7725_Y_OFFSET * 8;
+		for(x = 0; x < width; x += 2)
+		{
+			OV7725_SRC_WORD(w);
+			*o++ = (uint8_t)(w >> shift);
+		}
+	}
+	else
+	{
+		for(x = 0; x < width; x += 2)
+		{
+			OV7725_SRC_WORD(w);
+			w >>= shift;
+			*o++ = (uint8_t)w;                        //先读的是高字节
+			*o++ = (uint8_t)(w >> 8);
+		}
+	}
+	return o - out;
+}
+
+/*RGB565转RGB332的4x4有序抖动表，下标为 (行&3)*4+(列&3) 和分量值，值已移到RGB332中的位置
+  输出=min(最大级, floor(v*最大级/输入最大值 + (M+0.5)/16))，M为4x4 Bayer矩阵，平均后无偏*/
+static const uint8_t ov7725_dither_r[16][32] = {
+	{
+		  0,   0,   0,   0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  64,  96,  96,
+		 96,  96, 128, 128, 128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 224
+	},
+	{
+		  0,   0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,  96,  96,
+		128, 128, 128, 128, 160, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224, 224
+	},
+	{
+		  0,   0,   0,   0,  32,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,
+		 96,  96, 128, 128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 192, 224
+	},
+	{
+		  0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  64,  96,  96,  96,  96, 128,
+		128, 128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 192, 224, 224, 224
+	},
+	{
+		  0,  32,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,  96,  96, 128,
+		128, 128, 128, 160, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224, 224, 224
+	},
+	{
+		  0,   0,   0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  64,  96,  96,  96,
+		 96, 128, 128, 128, 128, 160, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224
+	},
+	{
+		  0,  32,  32,  32,  32,  64,  64,  64,  64,  64,  96,  96,  96,  96, 128, 128,
+		128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224, 224, 224, 224
+	},
+	{
+		  0,   0,   0,  32,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,  96,
+		128, 128, 128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 192, 224, 224
+	},
+	{
+		  0,   0,   0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  64,  96,  96,  96,
+		 96, 128, 128, 128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 192, 224
+	},
+	{
+		  0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  64,  96,  96,  96,  96, 128,
+		128, 128, 128, 160, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224, 224, 224
+	},
+	{
+		  0,   0,   0,   0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,
+		 96,  96, 128, 128, 128, 128, 160, 160, 160, 160, 160, 192, 192, 192, 192, 224
+	},
+	{
+		  0,   0,  32,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,  96,  96,
+		128, 128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 192, 224, 224, 224
+	},
+	{
+		  0,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,  96,  96, 128, 128,
+		128, 128, 160, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224, 224, 224, 224
+	},
+	{
+		  0,   0,   0,  32,  32,  32,  32,  64,  64,  64,  64,  64,  96,  96,  96,  96,
+		128, 128, 128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224, 224
+	},
+	{
+		  0,  32,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,  96, 128, 128,
+		128, 128, 128, 160, 160, 160, 160, 192, 192, 192, 192, 192, 224, 224, 224, 224
+	},
+	{
+		  0,   0,   0,  32,  32,  32,  32,  32,  64,  64,  64,  64,  96,  96,  96,  96,
+		 96, 128, 128, 128, 128, 160, 160, 160, 160, 160, 192, 192, 192, 192, 224, 224
+	}
+};
+
+static const uint8_t ov7725_dither_g[16][64] = {
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,
+		  4,   4,   8,   8,   8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,
+		 12,  12,  12,  12,  16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,
+		 20,  20,  20,  20,  20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,
+		  8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,
+		 16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,
+		 20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,
+		  4,   8,   8,   8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,
+		 12,  12,  12,  16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,
+		 20,  20,  20,  20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,   8,
+		  8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,  16,
+		 16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,  20,
+		 20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,   8,   8,   8,
+		  8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,  16,  16,  16,
+		 16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,  20,  20,  24,
+		 24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+		  8,   8,   8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,
+		 12,  12,  16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,
+		 20,  20,  20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28
+	},
+	{
+		  0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,   8,   8,   8,   8,
+		  8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,  16,  16,  16,  16,
+		 16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,  20,  20,  24,  24,
+		 24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,
+		  8,   8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,
+		 12,  16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,
+		 20,  20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,
+		  4,   8,   8,   8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,
+		 12,  12,  12,  16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,
+		 20,  20,  20,  20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28
+	},
+	{
+		  0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,   8,   8,
+		  8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,  16,  16,
+		 16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+		 24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,
+		  4,   4,   8,   8,   8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,
+		 12,  12,  12,  12,  16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,
+		 20,  20,  20,  20,  20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28
+	},
+	{
+		  0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,   8,
+		  8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,  16,
+		 16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,  20,
+		 20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,   8,   8,   8,   8,
+		  8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,  16,  16,  16,  16,
+		 16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,  20,  20,  24,  24,
+		 24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,
+		  8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,
+		 16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,
+		 20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,   8,   8,   8,   8,
+		  8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,  12,  16,  16,  16,
+		 16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,  20,  20,  20,  24,
+		 24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28,  28,  28,  28,  28
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,   4,   8,
+		  8,   8,   8,   8,   8,   8,   8,   8,  12,  12,  12,  12,  12,  12,  12,  12,
+		 12,  16,  16,  16,  16,  16,  16,  16,  16,  16,  20,  20,  20,  20,  20,  20,
+		 20,  20,  20,  24,  24,  24,  24,  24,  24,  24,  24,  24,  28,  28,  28,  28
+	}
+};
+
+static const uint8_t ov7725_dither_b[16][32] = {
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,
+		  2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,
+		  2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3
+	},
+	{
+		  0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,
+		  2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,
+		  2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,
+		  2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,
+		  2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,
+		  2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   3,   3
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3
+	}
+};
+
+/************************************************
+ * 函数名：OV7725_ReadRGB332
+ * 描述  ：从FIFO读出RGB565数据，边读边按4x4有序抖动查表转成RGB332，每像素1字节
+ * 输入  ：buf:存放RGB332 width:行宽（像素），2的倍数 lines:行数
+ * 输出  ：存入的字节数（width*lines）
+ * 注意  ：抖动的行相位从buf的第一行算起，一包的行数为4的倍数，各包的相位相同
+ ************************************************/
+uint16_t OV7725_ReadRGB332(uint8_t *buf, uint16_t width, uint16_t lines)
+{
+	const uint8_t (*r)[32] = ov7725_dither_r;
+	const uint8_t (*g)[64] = ov7725_dither_g;
+	const uint8_t (*b)[32] = ov7725_dither_b;
+	uint8_t *o = buf;
+	uint32_t w;
+	uint16_t x, p;
+	uint8_t line, d;
+
+	OV7725_SRC_BEGIN((uint32_t)width * lines * 2);
+	for(line = 0; line < lines; line++)
+	{
+		for(x = 0; x < width; x += 2)
+		{
+			OV7725_SRC_WORD(w);                          //小端：高0 低0 高1 低1
+			d = ((line & 3) << 2) | (x & 3);
+			p = ((w & 0xff) << 8) | ((w >> 8) & 0xff);
+			*o++ = r[d][p >> 11] | g[d][(p >> 5) & 0x3f] | b[d][p & 0x1f];
+			p = ((w >> 8) & 0xff00) | (w >> 24);
+			d++;
+			*o++ = r[d][p >> 11] | g[d][(p >> 5) & 0x3f] | b[d][p & 0x1f];
+		}
+	}
+	return width * lines;
+}
+
 /****************************End OF File*************************************/
@@ -4,36 +4,99 @@
 #include "stm32f10x.h"
 
 
-/*ͷýṹ*/
+/*摄像头配置结构体*/
 typedef struct
 {	
 
 	
-	uint8_t QVGA_VGA; //0QVGA1VGA
+	uint8_t QVGA_VGA; //0：QVGA，1VGA
 	
-	/*VGA:sx + width <= 320  240 ,sy+height <= 320  240*/
+	/*VGA:sx + width <= 320 或 240 ,sy+height <= 320 或 240*/
 	/*QVGA:sx + width <= 320 ,sy+height <= 240*/
-	uint16_t cam_sx; //ͷXʼλ
-	uint16_t cam_sy; //ͷYʼλ
+	uint16_t cam_sx; //摄像头窗口X起始位置
+	uint16_t cam_sy; //摄像头窗口Y起始位置
 	
-	uint16_t cam_width;//ͼֱʣ
-	uint16_t cam_height;//ͼֱʣ
+	uint16_t cam_width;//图像分辨率，宽
+	uint16_t cam_height;//图像分辨率，高
 	
-	uint16_t lcd_sx;//ͼʾҺXʼλ
-	uint16_t lcd_sy;//ͼʾҺYʼλ
-	uint8_t lcd_scan;//Һɨģʽ0-7
+	uint16_t lcd_sx;//图像显示在液晶屏的X起始位置
+	uint16_t lcd_sy;//图像显示在液晶屏的Y起始位置
+	uint8_t lcd_scan;//液晶屏的扫描模式（0-7）
 	
-	uint8_t light_mode;//ģʽΧ[0~5]
-	int8_t saturation;//Ͷ,Χ[-4 ~ +4]   
-	int8_t brightness;//նȣΧ[-4~+4]
-	int8_t contrast;//ԱȶȣΧ[-4~+4]
-	uint8_t effect;	//ЧΧ[0~6]:	
+	uint8_t light_mode;//光照模式，参数范围[0~5]
+	int8_t saturation;//饱和度,参数范围[-4 ~ +4]   
+	int8_t brightness;//光照度，参数范围[-4~+4]
+	int8_t contrast;//对比度，参数范围[-4~+4]
+	uint8_t effect;	//特殊效果，参数范围[0~6]:	
+	
+	uint8_t format;	//输出格式，OV7725_FORMAT_xxx，缺省0为RGB565
+	uint8_t clk_div;	//帧率分频，即CLKRC[5:0]，帧率=OV7725_FPS_BASE/(clk_div+1)
 
 
 }OV7725_MODE_PARAM;
 
+/*输出格式*/
+#define OV7725_FORMAT_RGB565    0   //RGB565，每像素2字节
+#define OV7725_FORMAT_YUV422    1   //YUYV，每像素2字节
+#define OV7725_FORMAT_GRAY      2   //传感器输出YUYV，读出时只留Y，每像素1字节
+#define OV7725_FORMAT_RGB332    3   //传感器输出RGB565，读出时抖动成RGB332，每像素1字节，每包4行
+
+#define OV7725_FORMAT_IS_RGB(f) ((f) == OV7725_FORMAT_RGB565 || (f) == OV7725_FORMAT_RGB332)   //传感器输出RGB565
+
+/*CLKRC分频为0时的帧率（XCLK 24MHz，COM4 PLL 4倍）*/
+#define OV7725_FPS_BASE         60
+#define OV7725_CLK_DIV_MAX      0x3f
+
+/*YUV输出时Y在每个2字节中的位置（COM3[3]交换高低字节后改为1）*/
+#define OV7725_Y_OFFSET         0
+
+
+/*FIFO帧流水线
+  AL422B共384K字节，QVGA RGB565一帧150K字节，读当前帧的同时可以写下一帧。
+  写指针只在FIFO中没有未读帧时复位，之后各帧首尾相接，地址到头自动回绕；
+  VSYNC中断只在未读帧加上新的一帧放得下时才打开写，写指针永远追不上读指针*/
+#define OV7725_FIFO_SIZE        393216u
+
+/*VGA模式窗口起点的初始值（Sensor_Config中为QVGA的值）*/
+#define OV7725_VGA_HSTART       0x23
+#define OV7725_VGA_VSTRT        0x07
+
+typedef struct
+{
+	volatile uint32_t write_seq;   //已写完的帧序号，VSYNC中断中加1
+	volatile uint32_t read_seq;    //已读完的帧序号，采集任务中加1
+	volatile uint32_t rewind_seq;  //从FIFO地址0开始写的帧序号，读该帧前要复位读指针
+	uint32_t read_addr;            //正在读（或下一个要读）的帧在FIFO中的起始地址，重读时用
+	volatile uint8_t  writing;     //1：正在写一帧
+	volatile uint8_t  hold;        //1：正在改变窗口，VSYNC不打开写
+	uint32_t frame_bytes;          //一帧字节数，改变分辨率时更新
+	
+	volatile uint32_t captured;    //写入FIFO的帧数
+	volatile uint32_t dropped;     //FIFO没有空间，跳过不写的帧数
+	volatile uint32_t overrun;     //已写入但没能读完被丢弃的帧数
+}OV7725_FRAME_PIPE;
+
+extern OV7725_FRAME_PIPE ov7725_pipe;
+extern uint8_t ov7725_present;
+
+/*寄存器影子统计，可在调试器中查看*/
+#define OV7725_REG_LAST         0xAC      //影子初始化时读到的最后一个寄存器
+#define OV7725_REG_BATCH        16        //一次SCCB传输的寄存器数
+
+typedef struct
+{
+	uint32_t writes;               //写到传感器的寄存器数
+	uint32_t write_err;            //SCCB写失败次数，失败的下次重写
+	uint32_t verified;             //读回校验的寄存器数
+	uint32_t mismatch;             //读回与影子不符的次数，不符的下次重写
+	uint32_t flush_us;             //上一次OV7725_Reg_Flush的时间
+	uint32_t flush_max_us;
+}OV7725_REG_STAT;
+
+extern OV7725_REG_STAT ov7725_reg_stat;
+
 
-/* Ĵ궨 */
+/* 寄存器宏定义 */
 #define REG_GAIN      0x00
 #define REG_BLUE      0x01
 #define REG_RED       0x02
@@ -185,34 +248,34 @@ typedef struct
 
 
 
-/************************** OV7725 Ŷ********************************/
-// FIFO ʹܣģеOE
+/************************** OV7725 连接引脚定义********************************/
+// FIFO 输出使能，即模块中的OE
 #define      OV7725_OE_GPIO_CLK                       RCC_APB2Periph_GPIOA
 #define      OV7725_OE_GPIO_PORT                      GPIOA
 #define      OV7725_OE_GPIO_PIN                       GPIO_Pin_3
 
-// FIFO дλ
+// FIFO 写复位
 #define      OV7725_WRST_GPIO_CLK                     RCC_APB2Periph_GPIOC
 #define      OV7725_WRST_GPIO_PORT                    GPIOC
 #define      OV7725_WRST_GPIO_PIN                     GPIO_Pin_4
 
-// FIFO λ
+// FIFO 读复位
 #define      OV7725_RRST_GPIO_CLK                     RCC_APB2Periph_GPIOA
 #define      OV7725_RRST_GPIO_PORT                    GPIOA
 #define      OV7725_RRST_GPIO_PIN                     GPIO_Pin_2
 
-// FIFO ʱ
+// FIFO 读时钟
 #define      OV7725_RCLK_GPIO_CLK                     RCC_APB2Periph_GPIOC
 #define      OV7725_RCLK_GPIO_PORT                    GPIOC
 #define      OV7725_RCLK_GPIO_PIN                     GPIO_Pin_5
 
-// FIFO дʹ
+// FIFO 写使能
 #define      OV7725_WE_GPIO_CLK                       RCC_APB2Periph_GPIOD
 #define      OV7725_WE_GPIO_PORT                      GPIOD
 #define      OV7725_WE_GPIO_PIN                       GPIO_Pin_3
 
 
-// 8λݿ
+// 8位数据口
 #define      OV7725_DATA_GPIO_CLK                     RCC_APB2Periph_GPIOB
 #define      OV7725_DATA_GPIO_PORT                    GPIOB
 #define      OV7725_DATA_0_GPIO_PIN                   GPIO_Pin_8
@@ -224,7 +287,7 @@ typedef struct
 #define      OV7725_DATA_6_GPIO_PIN                   GPIO_Pin_14
 #define      OV7725_DATA_7_GPIO_PIN                   GPIO_Pin_15
 
-// OV7725ж
+// OV7725场中断
 #define      OV7725_VSYNC_GPIO_CLK                    RCC_APB2Periph_GPIOE
 #define      OV7725_VSYNC_GPIO_PORT                   GPIOC
 #define      OV7725_VSYNC_GPIO_PIN                    GPIO_Pin_3
@@ -239,18 +302,18 @@ typedef struct
 
 
 #define FIFO_OE_H()     OV7725_OE_GPIO_PORT->BSRR =OV7725_OE_GPIO_PIN	  
-#define FIFO_OE_L()     OV7725_OE_GPIO_PORT->BRR  =OV7725_OE_GPIO_PIN	  /*ʹFIFOʹ*/
+#define FIFO_OE_L()     OV7725_OE_GPIO_PORT->BRR  =OV7725_OE_GPIO_PIN	  /*拉低使FIFO输出使能*/
 
-#define FIFO_WRST_H()   OV7725_WRST_GPIO_PORT->BSRR =OV7725_WRST_GPIO_PIN	  /*FIFOд(fromͷ)ָ˶ */
-#define FIFO_WRST_L()   OV7725_WRST_GPIO_PORT->BRR  =OV7725_WRST_GPIO_PIN	  /*ʹFIFOд(fromͷ)ָ븴λ*/
+#define FIFO_WRST_H()   OV7725_WRST_GPIO_PORT->BSRR =OV7725_WRST_GPIO_PIN	  /*拉高允许FIFO写(数据from摄像头)指针运动 */
+#define FIFO_WRST_L()   OV7725_WRST_GPIO_PORT->BRR  =OV7725_WRST_GPIO_PIN	  /*拉低使FIFO写(数据from摄像头)指针复位*/
 
-#define FIFO_RRST_H()   OV7725_RRST_GPIO_PORT->BSRR =OV7725_RRST_GPIO_PIN	  /*FIFO(ݴFIFO)ָ˶ */
-#define FIFO_RRST_L()   OV7725_RRST_GPIO_PORT->BRR  =OV7725_RRST_GPIO_PIN	  /*ʹFIFO(ݴFIFO)ָ븴λ */
+#define FIFO_RRST_H()   OV7725_RRST_GPIO_PORT->BSRR =OV7725_RRST_GPIO_PIN	  /*拉高允许FIFO读(数据从FIFO输出)指针运动 */
+#define FIFO_RRST_L()   OV7725_RRST_GPIO_PORT->BRR  =OV7725_RRST_GPIO_PIN	  /*拉低使FIFO读(数据从FIFO输出)指针复位 */
 
 #define FIFO_RCLK_H()   OV7725_RCLK_GPIO_PORT->BSRR =OV7725_RCLK_GPIO_PIN	  
-#define FIFO_RCLK_L()   OV7725_RCLK_GPIO_PORT->BRR  =OV7725_RCLK_GPIO_PIN	  /*FIFOʱ*/
+#define FIFO_RCLK_L()   OV7725_RCLK_GPIO_PORT->BRR  =OV7725_RCLK_GPIO_PIN	  /*FIFO输出数据时钟*/
 
-#define FIFO_WE_H()     OV7725_WE_GPIO_PORT->BSRR =OV7725_WE_GPIO_PIN	  /*ʹFIFOд*/
+#define FIFO_WE_H()     OV7725_WE_GPIO_PORT->BSRR =OV7725_WE_GPIO_PIN	  /*拉高使FIFO写允许*/
 #define FIFO_WE_L()     OV7725_WE_GPIO_PORT->BRR  =OV7725_WE_GPIO_PIN
 
 #if 0
@@ -272,6 +335,25 @@ typedef struct
                                     }while(0)									
 									
 									
+/*从FIFO读4个字节拼成一个字，先读的字节在低地址（小端）
+  数据口在PB8~PB15，IDR&0xff00 正好是第2个字节的位置，少做一次移位*/
+#define READ_FIFO_WORD(WORD)        do{\
+	                                  uint32_t b0_,b1_,b2_,b3_;\
+	                                  FIFO_RCLK_L();\
+	                                  b0_ = (OV7725_DATA_GPIO_PORT->IDR >> 8) & 0x00ff;\
+	                                  FIFO_RCLK_H();\
+	                                  FIFO_RCLK_L();\
+	                                  b1_ = OV7725_DATA_GPIO_PORT->IDR & 0xff00;\
+	                                  FIFO_RCLK_H();\
+	                                  FIFO_RCLK_L();\
+	                                  b2_ = (OV7725_DATA_GPIO_PORT->IDR & 0xff00) << 8;\
+	                                  FIFO_RCLK_H();\
+	                                  FIFO_RCLK_L();\
+	                                  b3_ = (OV7725_DATA_GPIO_PORT->IDR & 0xff00) << 16;\
+	                                  FIFO_RCLK_H();\
+	                                  WORD = b0_ | b1_ | b2_ | b3_;\
+                                    }while(0)
+
 #define FIFO_PREPARE                do{\
 	                                  FIFO_RRST_L();\
 	                                  FIFO_RCLK_L();\
@@ -281,12 +363,16 @@ typedef struct
 	                                  FIFO_RCLK_H();\
                                     }while(0)
 
+#ifdef OV7725_FIFO_SIM
+#include "ov7725_fifo_sim.h"        //主机测试：读口接到FIFO模型，见Test/shim
+#endif
+
 #define OV7725_ID       0x21
 																		
 																		
 																		
 
-/*Ϣ*/
+/*信息输出*/
 #define OV7725_DEBUG_ON         0
 
 #define OV7725_INFO(fmt,arg...)           printf("<<-OV7725-INFO->> "fmt"\n",##arg)
@@ -309,6 +395,31 @@ void OV7725_Contrast(int8_t cnst);
 void OV7725_Special_Effect(uint8_t eff);
 void VSYNC_Init(void);				
 void OV7725_Window_Set(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height,uint8_t QVGA_VGA);
+void OV7725_ReadLines(uint8_t *buf, uint16_t width, uint16_t lines);
+uint16_t OV7725_ReadBytes(uint8_t *buf, uint16_t n);
+uint16_t OV7725_ReadBinned(uint8_t *out, uint16_t width, uint8_t factor, uint8_t format);
+uint16_t OV7725_ReadBinnedRoi(uint8_t *out, uint16_t width, uint8_t factor, uint8_t format,
+                              uint8_t *roi, uint16_t roi_x, uint16_t roi_w);
+uint8_t OV7725_Frame_VSYNC(void);
+uint8_t OV7725_Frame_Begin(void);
+void OV7725_Frame_End(void);
+void OV7725_Frame_Discard(void);
+void OV7725_Frame_Skip(uint32_t left);
+void OV7725_Frame_Rewind(void);
+ErrorStatus OV7725_Window_Change(uint16_t sx,uint16_t sy,uint16_t width,uint16_t height,uint8_t QVGA_VGA);
+ErrorStatus OV7725_Format_Change(uint8_t format);
+ErrorStatus OV7725_FrameRate_Set(uint8_t div);
+void OV7725_Reg_Load(void);
+uint8_t OV7725_Reg_Read(uint8_t reg);
+void OV7725_Reg_Write(uint8_t reg, uint8_t value);
+uint8_t OV7725_Reg_Flush(void);
+void OV7725_Reg_Verify(void);
+ErrorStatus OV7725_ColorBar(uint8_t on);
+uint16_t OV7725_Keep_Y(uint8_t *buf, uint16_t len);
+uint16_t OV7725_ReadY(uint8_t *buf, uint16_t n);
+uint16_t OV7725_ReadRGB332(uint8_t *buf, uint16_t width, uint16_t lines);
+void OV7725_Skip(uint32_t n);
+uint16_t OV7725_ReadHalf(uint8_t *out, uint16_t width, uint8_t phase, uint8_t format);
 
 #endif
 
@@ -0,0 +1,314 @@
+/**
+  ******************************************************************************
+  * @file    bsp_ov7725_dma.c
+  * @version V1.0
+  * @date    2019-xx-xx
+  * @brief   OV7725 FIFO 定时器+DMA读出驱动
+  ******************************************************************************
+  * @attention
+  *
+  * 用TIM8产生FIFO读时钟RCLK，DMA把数据口搬进暂存区，
+  * 读一段数据只在结束时产生一次中断，CPU不再逐字节翻转RCLK
+  *
+  * GPIO寄存器只能按字访问（RM0008 GPIO寄存器说明），DMA按字读整个IDR，
+  * 内存宽度设为半字，只存低16位（RM0008 DMA数据宽度：宽到窄截去高位），
+  * 一个字节占暂存区一个半字；暂存区分两半乒乓，DMA读下一段时CPU从上一段
+  * 取出bit8~15存进行缓冲区
+  *
+  * 只留Y、合并、RGB332、隔列这些边读边算的读出，由bsp_ov7725.c每次先调用
+  * OV7725_DMA_StreamBegin()给出要读的字节数，再一段段取OV7725_DMA_StreamNext()
+  * 返回的行缓冲；CPU处理这一段时DMA把下一段读进另一半暂存区。
+  * 连续写W5500（SendPictureStream）和空读（OV7725_Skip）仍由CPU翻转RCLK
+  *
+  ******************************************************************************
+  */
+#include "./ov7725/bsp_ov7725.h"
+#include "./ov7725/bsp_ov7725_dma.h"
+#include "./usart/bsp_usart1.h"
+
+static uint32_t rclk_pin = OV7725_RCLK_GPIO_PIN;    /* DMA写BSRR/BRR用的引脚掩码 */
+static OS_SEM   ov7725_dma_sem;                     /* 一段数据读完信号量 */
+static uint16_t ov7725_dma_stage[2][OV7725_DMA_CHUNK];   /* DMA按字读IDR、存低半字的乒乓暂存区 */
+static uint32_t ov7725_dma_line[OV7725_DMA_CHUNK / 4];   /* 派生读出的行缓冲 */
+static uint32_t ov7725_stream_left;                 /* 派生读出：还没启动DMA的字节数 */
+static uint16_t ov7725_stream_n;                    /* 派生读出：正在读的一段的字节数，0为没有 */
+static uint8_t  ov7725_stream_half;                 /* 派生读出：正在读的一段所在的暂存区 */
+uint8_t ov7725_read_err = 0;
+
+
+/************************************************
+ * 函数名：OV7725_DMA_Channel_Config
+ * 描述  ：配置一个DMA通道
+ * 输入  ：ch:通道 periph:外设地址 mem:内存地址 dir:方向
+ *         mem_inc:内存地址是否自增 mem_size:内存数据宽度（外设都按字访问） prio:优先级
+ * 输出  ：无
+ * 注意  ：内部调用
+ ************************************************/
+static void OV7725_DMA_Channel_Config(DMA_Channel_TypeDef *ch, uint32_t periph, uint32_t mem,
+                                      uint32_t dir, uint32_t mem_inc, uint32_t mem_size, uint32_t prio)
+{
+	DMA_InitTypeDef DMA_InitStructure;
+
+	DMA_DeInit(ch);
+	DMA_InitStructure.DMA_PeripheralBaseAddr = periph;
+	DMA_InitStructure.DMA_MemoryBaseAddr = mem;
+	DMA_InitStructure.DMA_DIR = dir;
+	DMA_InitStructure.DMA_BufferSize = 1;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = mem_inc;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+	DMA_InitStructure.DMA_MemoryDataSize = mem_size;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = prio;
+	DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+	DMA_Init(ch, &DMA_InitStructure);
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_Init
+ * 描述  ：FIFO读出定时器、DMA、中断初始化
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：需在OSInit之后调用（创建信号量）
+ ************************************************/
+void OV7725_DMA_Init(void)
+{
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+	TIM_OCInitTypeDef TIM_OCInitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+	OS_ERR err;
+
+	RCC_AHBPeriphClockCmd(OV7725_DMA_CLK, ENABLE);
+	RCC_APB2PeriphClockCmd(OV7725_RCLK_TIM_CLK, ENABLE);
+
+	OSSemCreate(&ov7725_dma_sem, "ov7725 dma sem", 0, &err);
+
+	/*数据口整个IDR(PB8~PB15在bit8~15)按字读，低半字 -> 暂存区，内存地址自增*/
+	OV7725_DMA_Channel_Config(OV7725_DATA_DMA_CHANNEL, (uint32_t)&OV7725_DATA_GPIO_PORT->IDR, (uint32_t)ov7725_dma_stage[0],
+	                          DMA_DIR_PeripheralSRC, DMA_MemoryInc_Enable, DMA_MemoryDataSize_HalfWord, DMA_Priority_VeryHigh);
+	/*RCLK拉低/拉高，内存地址不变*/
+	OV7725_DMA_Channel_Config(OV7725_RCLK_L_DMA_CHANNEL, (uint32_t)&OV7725_RCLK_GPIO_PORT->BRR, (uint32_t)&rclk_pin,
+	                          DMA_DIR_PeripheralDST, DMA_MemoryInc_Disable, DMA_MemoryDataSize_Word, DMA_Priority_High);
+	OV7725_DMA_Channel_Config(OV7725_RCLK_H_DMA_CHANNEL, (uint32_t)&OV7725_RCLK_GPIO_PORT->BSRR, (uint32_t)&rclk_pin,
+	                          DMA_DIR_PeripheralDST, DMA_MemoryInc_Disable, DMA_MemoryDataSize_Word, DMA_Priority_High);
+	DMA_ITConfig(OV7725_RCLK_H_DMA_CHANNEL, DMA_IT_TC, ENABLE);
+
+	/*TIM8时基：一个周期读一个字节*/
+	TIM_DeInit(OV7725_RCLK_TIM);
+	TIM_TimeBaseStructure.TIM_Period = OV7725_RCLK_TIM_PERIOD - 1;
+	TIM_TimeBaseStructure.TIM_Prescaler = 0;
+	TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+	TIM_TimeBaseInit(OV7725_RCLK_TIM, &TIM_TimeBaseStructure);
+
+	/*比较通道只产生DMA请求，不输出到引脚（PC6/PC7是SCCB）*/
+	TIM_OCStructInit(&TIM_OCInitStructure);
+	TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+	TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Disable;
+	TIM_OCInitStructure.TIM_Pulse = OV7725_RCLK_TIM_SAMPLE;
+	TIM_OC1Init(OV7725_RCLK_TIM, &TIM_OCInitStructure);
+	TIM_OCInitStructure.TIM_Pulse = OV7725_RCLK_TIM_FALL;
+	TIM_OC2Init(OV7725_RCLK_TIM, &TIM_OCInitStructure);
+
+	TIM_DMACmd(OV7725_RCLK_TIM, TIM_DMA_CC1 | TIM_DMA_CC2 | TIM_DMA_Update, ENABLE);
+
+	/*块读完中断，优先级低于VSYNC*/
+	NVIC_InitStructure.NVIC_IRQChannel = OV7725_DMA_IRQ;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_Start
+ * 描述  ：启动从FIFO读出len字节到暂存区stage
+ * 输入  ：stage:暂存区（每字节一个半字） len:字节数，不超过OV7725_DMA_CHUNK
+ * 输出  ：无
+ * 注意  ：调用前FIFO读指针已就绪（FIFO_PREPARE或上一段读完），RCLK为高
+ ************************************************/
+static void OV7725_DMA_Start(uint16_t *stage, uint16_t len)
+{
+	/*上一段结束到中断里停定时器之间多走的周期会留下没响应的DMA请求，
+	  先关掉定时器的DMA请求、清标志，再使能通道，免得一使能就多搬一次*/
+	TIM_DMACmd(OV7725_RCLK_TIM, TIM_DMA_CC1 | TIM_DMA_CC2 | TIM_DMA_Update, DISABLE);
+	TIM_SetCounter(OV7725_RCLK_TIM, 0);
+	TIM_ClearFlag(OV7725_RCLK_TIM, TIM_FLAG_CC1 | TIM_FLAG_CC2 | TIM_FLAG_Update);
+
+	DMA_Cmd(OV7725_DATA_DMA_CHANNEL, DISABLE);
+	DMA_Cmd(OV7725_RCLK_L_DMA_CHANNEL, DISABLE);
+	DMA_Cmd(OV7725_RCLK_H_DMA_CHANNEL, DISABLE);
+
+	OV7725_DATA_DMA_CHANNEL->CMAR = (uint32_t)stage;
+	DMA_SetCurrDataCounter(OV7725_DATA_DMA_CHANNEL, len);
+	DMA_SetCurrDataCounter(OV7725_RCLK_L_DMA_CHANNEL, len);
+	DMA_SetCurrDataCounter(OV7725_RCLK_H_DMA_CHANNEL, len);
+	DMA_ClearITPendingBit(OV7725_DMA_IT_GL);
+
+	DMA_Cmd(OV7725_DATA_DMA_CHANNEL, ENABLE);
+	DMA_Cmd(OV7725_RCLK_L_DMA_CHANNEL, ENABLE);
+	DMA_Cmd(OV7725_RCLK_H_DMA_CHANNEL, ENABLE);
+
+	/*计数从0开始：先采样，再拉低，溢出时拉高*/
+	TIM_DMACmd(OV7725_RCLK_TIM, TIM_DMA_CC1 | TIM_DMA_CC2 | TIM_DMA_Update, ENABLE);
+	TIM_Cmd(OV7725_RCLK_TIM, ENABLE);
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_Unpack
+ * 描述  ：从暂存区的IDR低半字里取出数据字节（bit8~15）
+ * 输入  ：buf:目标缓冲区 stage:暂存区 len:字节数
+ * 输出  ：无
+ * 注意  ：无
+ ************************************************/
+void OV7725_DMA_Unpack(uint8_t *buf, const uint16_t *stage, uint16_t len)
+{
+	while(len >= 4)
+	{
+		buf[0] = (uint8_t)(stage[0] >> 8);
+		buf[1] = (uint8_t)(stage[1] >> 8);
+		buf[2] = (uint8_t)(stage[2] >> 8);
+		buf[3] = (uint8_t)(stage[3] >> 8);
+		buf += 4;
+		stage += 4;
+		len -= 4;
+	}
+	while(len--)
+		*buf++ = (uint8_t)(*stage++ >> 8);
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_Wait
+ * 描述  ：挂起等待当前段读完
+ * 输入  ：p_err:返回错误类型
+ * 输出  ：无
+ * 注意  ：超时则停止定时器和DMA，本帧数据作废
+ ************************************************/
+static void OV7725_DMA_Wait(OS_ERR *p_err)
+{
+	OSSemPend(&ov7725_dma_sem, OV7725_DMA_TIMEOUT, OS_OPT_PEND_BLOCKING, 0, p_err);
+	if(*p_err != OS_ERR_NONE)
+	{
+		TIM_Cmd(OV7725_RCLK_TIM, DISABLE);
+		DMA_Cmd(OV7725_DATA_DMA_CHANNEL, DISABLE);
+		DMA_Cmd(OV7725_RCLK_L_DMA_CHANNEL, DISABLE);
+		DMA_Cmd(OV7725_RCLK_H_DMA_CHANNEL, DISABLE);
+		FIFO_RCLK_H();
+		OV7725_DEBUG("fifo dma timeout");
+	}
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_ReadBlock
+ * 描述  ：从FIFO读出len字节到buf，读完前任务挂起
+ * 输入  ：buf:目标缓冲区 len:字节数 p_err:返回错误类型
+ * 输出  ：无
+ * 注意  ：按OV7725_DMA_CHUNK分段，一段读完先启动下一段再取出这一段
+ ************************************************/
+void OV7725_DMA_ReadBlock(uint8_t *buf, uint16_t len, OS_ERR *p_err)
+{
+	uint8_t  half = 0;
+	uint16_t n, next;
+
+	*p_err = OS_ERR_NONE;
+	if(len == 0)
+		return;
+
+	n = (len > OV7725_DMA_CHUNK) ? OV7725_DMA_CHUNK : len;
+	OV7725_DMA_Start(ov7725_dma_stage[half], n);
+	while(1)
+	{
+		OV7725_DMA_Wait(p_err);
+		if(*p_err != OS_ERR_NONE)
+			return;
+
+		len -= n;
+		next = (len > OV7725_DMA_CHUNK) ? OV7725_DMA_CHUNK : len;
+		if(next)
+			OV7725_DMA_Start(ov7725_dma_stage[half ^ 1], next);   //另一半接着读
+
+		OV7725_DMA_Unpack(buf, ov7725_dma_stage[half], n);
+		buf += n;
+		if(next == 0)
+			break;
+		half ^= 1;
+		n = next;
+	}
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_StreamBegin
+ * 描述  ：开始一次派生读出：启动第一段DMA
+ * 输入  ：len:这次要读的字节数，4的倍数
+ * 输出  ：无
+ * 注意  ：之后用OV7725_DMA_StreamNext取数据，要正好取完len字节；
+ *         DMA不会多读FIFO，取完后可以接着用CPU读或空读
+ ************************************************/
+void OV7725_DMA_StreamBegin(uint32_t len)
+{
+	ov7725_stream_half = 0;
+	ov7725_stream_n = (len > OV7725_DMA_CHUNK) ? OV7725_DMA_CHUNK : len;
+	ov7725_stream_left = len - ov7725_stream_n;
+	if(ov7725_stream_n)
+		OV7725_DMA_Start(ov7725_dma_stage[0], ov7725_stream_n);
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_StreamNext
+ * 描述  ：等当前一段读完，启动下一段，把这一段取进行缓冲
+ * 输入  ：words:返回行缓冲中的字数
+ * 输出  ：行缓冲，先读的字节在低地址
+ * 注意  ：超时或已经取完时置ov7725_read_err，返回行缓冲原有的内容，
+ *         调用者照常算完；读指针位置不确定，本帧作废
+ ************************************************/
+const uint32_t *OV7725_DMA_StreamNext(uint16_t *words)
+{
+	OS_ERR   err;
+	uint16_t n = ov7725_stream_n;
+
+	*words = OV7725_DMA_CHUNK / 4;
+	if(n == 0)
+	{
+		ov7725_read_err = 1;
+		return ov7725_dma_line;
+	}
+	OV7725_DMA_Wait(&err);
+	if(err != OS_ERR_NONE)
+	{
+		ov7725_read_err = 1;
+		ov7725_stream_n = 0;
+		ov7725_stream_left = 0;
+		return ov7725_dma_line;
+	}
+	ov7725_stream_n = (ov7725_stream_left > OV7725_DMA_CHUNK) ? OV7725_DMA_CHUNK : ov7725_stream_left;
+	ov7725_stream_left -= ov7725_stream_n;
+	if(ov7725_stream_n)
+		OV7725_DMA_Start(ov7725_dma_stage[ov7725_stream_half ^ 1], ov7725_stream_n);   //另一半接着读
+	OV7725_DMA_Unpack((uint8_t *)ov7725_dma_line, ov7725_dma_stage[ov7725_stream_half], n);
+	ov7725_stream_half ^= 1;
+	*words = n / 4;
+	return ov7725_dma_line;
+}
+
+/************************************************
+ * 函数名：OV7725_DMA_ISR
+ * 描述  ：RCLK拉高通道传输完成中断处理
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：在中断服务函数中调用
+ ************************************************/
+void OV7725_DMA_ISR(void)
+{
+	OS_ERR err;
+
+	if(DMA_GetITStatus(OV7725_DMA_IT_TC) != RESET)
+	{
+		/*三个通道都已传完，停止定时器即可*/
+		TIM_Cmd(OV7725_RCLK_TIM, DISABLE);
+		DMA_ClearITPendingBit(OV7725_DMA_IT_GL);
+		OSSemPost(&ov7725_dma_sem, OS_OPT_POST_1, &err);
+	}
+}
+
+/****************************End OF File*************************************/
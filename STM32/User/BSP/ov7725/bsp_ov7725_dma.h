@@ -0,0 +1,48 @@
+#ifndef __OV7725_DMA_H
+#define __OV7725_DMA_H
+
+#include "stm32f10x.h"
+#include  <os.h>
+
+
+/************************** FIFO 定时器/DMA 读出定义********************************/
+/*
+ * TIM8 每计数一个周期读出FIFO的一个字节：
+ *   CC1  事件 -> DMA2 通道3 按字读数据口IDR(数据在PB8~PB15)，存低半字到暂存区
+ *   CC2  事件 -> DMA2 通道5 写BRR拉低RCLK
+ *   更新 事件 -> DMA2 通道1 写BSRR拉高RCLK，FIFO读指针前进
+ * 三个通道都是正常模式、传输数目相同，最后一个通道传输完成即整段读完
+ * 一块按OV7725_DMA_CHUNK字节分段，两段暂存区轮流用，CPU取出bit8~15
+ * 派生读出（只留Y、合并、RGB332、隔列）也按段读进行缓冲，见OV7725_DMA_StreamNext
+ * 时序模型见 Test/test_fifo_dma.c
+ */
+#define      OV7725_RCLK_TIM                          TIM8
+#define      OV7725_RCLK_TIM_CLK                      RCC_APB2Periph_TIM8
+#define      OV7725_RCLK_TIM_PERIOD                   36      /* 72MHz/36 = 2M字节/s，每字节3次DMA传输，留出总线竞争的余量 */
+#define      OV7725_RCLK_TIM_SAMPLE                   9       /* CC1：采样数据口 */
+#define      OV7725_RCLK_TIM_FALL                     18      /* CC2：拉低RCLK */
+
+#define      OV7725_DMA_CLK                           RCC_AHBPeriph_DMA2
+#define      OV7725_DATA_DMA_CHANNEL                  DMA2_Channel3   /* TIM8_CH1 */
+#define      OV7725_RCLK_L_DMA_CHANNEL                DMA2_Channel5   /* TIM8_CH2 */
+#define      OV7725_RCLK_H_DMA_CHANNEL                DMA2_Channel1   /* TIM8_UP  */
+
+#define      OV7725_DMA_IT_TC                         DMA2_IT_TC1
+#define      OV7725_DMA_IT_GL                         DMA2_IT_GL1
+#define      OV7725_DMA_IRQ                           DMA2_Channel1_IRQn
+#define      OV7725_DMA_INT_FUNCTION                  DMA2_Channel1_IRQHandler
+
+#define      OV7725_DMA_TIMEOUT                       10      /* 等待一段读完的超时（时钟节拍） */
+#define      OV7725_DMA_CHUNK                         640     /* 一段的字节数：QVGA RGB565一行，暂存区共2*2*640字节 */
+
+
+extern uint8_t ov7725_read_err;     /* 派生读出中DMA超时置1，由调用者清零并丢弃本帧 */
+
+void OV7725_DMA_Init(void);
+void OV7725_DMA_Unpack(uint8_t *buf, const uint16_t *stage, uint16_t len);
+void OV7725_DMA_ReadBlock(uint8_t *buf, uint16_t len, OS_ERR *p_err);
+void OV7725_DMA_StreamBegin(uint32_t len);
+const uint32_t *OV7725_DMA_StreamNext(uint16_t *words);
+void OV7725_DMA_ISR(void);
+
+#endif
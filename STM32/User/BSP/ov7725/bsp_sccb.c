@@ -1,18 +1,18 @@
 #include "bsp_sccb.h"
 
-#define DEV_ADR  ADDR_OV7725 			 /*豸ַ*/
+#define DEV_ADR  ADDR_OV7725 			 /*设备地址定义*/
 
 /********************************************************************
- * SCCB_Configuration
- *   SCCBܽ
- *   
- *   
- * ע          
+ * 函数名：SCCB_Configuration
+ * 描述  ：SCCB管脚配置
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：无        
  ********************************************************************/
 void SCCB_GPIO_Config(void)
 {
   GPIO_InitTypeDef  GPIO_InitStructure; 
-  /* SCL(PC6)SDA(PC7)ܽ */
+  /* SCL(PC6)、SDA(PC7)管脚配置 */
   RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC, ENABLE);
   GPIO_InitStructure.GPIO_Pin =  GPIO_Pin_6 | GPIO_Pin_7;
   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
@@ -21,11 +21,11 @@ void SCCB_GPIO_Config(void)
 }
 
 /********************************************************************
- * SCCB_delay
- *   ӳʱ
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_delay
+ * 描述  ：延迟时间
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：内部调用        
  ********************************************************************/
 static void SCCB_delay(void)
 {	
@@ -37,11 +37,11 @@ static void SCCB_delay(void)
 }
 
 /********************************************************************
- * SCCB_Start
- *   SCCBʼź
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_Start
+ * 描述  ：SCCB起始信号
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：内部调用        
  ********************************************************************/
 static int SCCB_Start(void)
 {
@@ -49,11 +49,11 @@ static int SCCB_Start(void)
 	SCL_H;
 	SCCB_delay();
 	if(!SDA_read)
-	return DISABLE;	/* SDAΪ͵ƽæ,˳ */
+	return DISABLE;	/* SDA线为低电平则总线忙,退出 */
 	SDA_L;
 	SCCB_delay();
 	if(SDA_read) 
-	return DISABLE;	/* SDAΪߵƽ߳,˳ */
+	return DISABLE;	/* SDA线为高电平则总线出错,退出 */
 	SDA_L;
 	SCCB_delay();
 	return ENABLE;
@@ -62,11 +62,11 @@ static int SCCB_Start(void)
 
 
 /********************************************************************
- * SCCB_Stop
- *   SCCBֹͣź
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_Stop
+ * 描述  ：SCCB停止信号
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：内部调用        
  ********************************************************************/
 static void SCCB_Stop(void)
 {
@@ -83,11 +83,11 @@ static void SCCB_Stop(void)
 
 
 /********************************************************************
- * SCCB_Ack
- *   SCCBӦʽ
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_Ack
+ * 描述  ：SCCB应答方式
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：内部调用        
  ********************************************************************/
 static void SCCB_Ack(void)
 {	
@@ -104,11 +104,11 @@ static void SCCB_Ack(void)
 
 
 /********************************************************************
- * SCCB_NoAck
- *   SCCB Ӧʽ
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_NoAck
+ * 描述  ：SCCB 无应答方式
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：内部调用        
  ********************************************************************/
 static void SCCB_NoAck(void)
 {	
@@ -123,11 +123,11 @@ static void SCCB_NoAck(void)
 }
 
 /********************************************************************
- * SCCB_WaitAck
- *   SCCB ȴӦ
- *   
- *   Ϊ:=1ACK,=0ACK
- * ע  ڲ        
+ * 函数名：SCCB_WaitAck
+ * 描述  ：SCCB 等待应答
+ * 输入  ：无
+ * 输出  ：返回为:=1有ACK,=0无ACK
+ * 注意  ：内部调用        
  ********************************************************************/
 static int SCCB_WaitAck(void) 	
 {
@@ -149,11 +149,11 @@ static int SCCB_WaitAck(void)
 
 
  /*******************************************************************
- * SCCB_SendByte
- *   ݴӸλλ
- *   SendByte: ͵
- *   
- * ע  ڲ        
+ * 函数名：SCCB_SendByte
+ * 描述  ：数据从高位到低位
+ * 输入  ：SendByte: 发送的数据
+ * 输出  ：无
+ * 注意  ：内部调用        
  *********************************************************************/
 static void SCCB_SendByte(uint8_t SendByte) 
 {
@@ -178,11 +178,11 @@ static void SCCB_SendByte(uint8_t SendByte)
 
 
  /******************************************************************
- * SCCB_ReceiveByte
- *   ݴӸλλ
- *   
- *   SCCB߷ص
- * ע  ڲ        
+ * 函数名：SCCB_ReceiveByte
+ * 描述  ：数据从高位到低位
+ * 输入  ：无
+ * 输出  ：SCCB总线返回的数据
+ * 注意  ：内部调用        
  *******************************************************************/
 static int SCCB_ReceiveByte(void)  
 { 
@@ -211,11 +211,11 @@ static int SCCB_ReceiveByte(void)
 
 
  /*****************************************************************************************
- * SCCB_WriteByte
- *   дһֽ
- *   - WriteAddress: дַ 	- SendByte: д	- DeviceAddress: 
- *   Ϊ:=1ɹд,=0ʧ
- * ע          
+ * 函数名：SCCB_WriteByte
+ * 描述  ：写一字节数据
+ * 输入  ：- WriteAddress: 待写入地址 	- SendByte: 待写入数据	- DeviceAddress: 器件类型
+ * 输出  ：返回为:=1成功写入,=0失败
+ * 注意  ：无        
  *****************************************************************************************/           
 int SCCB_WriteByte( uint16_t WriteAddress , uint8_t SendByte )
 {		
@@ -223,13 +223,13 @@ int SCCB_WriteByte( uint16_t WriteAddress , uint8_t SendByte )
 	{
 	    return DISABLE;
 	}
-    SCCB_SendByte( DEV_ADR );                    /* ַ */
+    SCCB_SendByte( DEV_ADR );                    /* 器件地址 */
     if( !SCCB_WaitAck() )
 	{
 		SCCB_Stop(); 
 		return DISABLE;
 	}
-    SCCB_SendByte((uint8_t)(WriteAddress & 0x00FF));   /* õʼַ */      
+    SCCB_SendByte((uint8_t)(WriteAddress & 0x00FF));   /* 设置低起始地址 */      
     SCCB_WaitAck();	
     SCCB_SendByte(SendByte);
     SCCB_WaitAck();   
@@ -238,11 +238,11 @@ int SCCB_WriteByte( uint16_t WriteAddress , uint8_t SendByte )
 }
 
 /******************************************************************************************************************
- * SCCB_ReadByte
- *   ȡһ
- *   - pBuffer: Ŷ 	- length: 	- ReadAddress: ַ		 - DeviceAddress: 
- *   Ϊ:=1ɹ,=0ʧ
- * ע          
+ * 函数名：SCCB_ReadByte
+ * 描述  ：读取一串数据
+ * 输入  ：- pBuffer: 存放读出数据 	- length: 待读出长度	- ReadAddress: 待读出地址		 - DeviceAddress: 器件类型
+ * 输出  ：返回为:=1成功读入,=0失败
+ * 注意  ：无        
  **********************************************************************************************************************/           
 int SCCB_ReadByte(uint8_t* pBuffer, uint16_t length, uint8_t ReadAddress)
 {	
@@ -250,13 +250,13 @@ int SCCB_ReadByte(uint8_t* pBuffer, uint16_t length, uint8_t ReadAddress)
 	{
 	    return DISABLE;
 	}
-    SCCB_SendByte( DEV_ADR );         /* ַ */
+    SCCB_SendByte( DEV_ADR );         /* 器件地址 */
     if( !SCCB_WaitAck() )
 	{
 		SCCB_Stop(); 
 		return DISABLE;
 	}
-    SCCB_SendByte( ReadAddress );     /* õʼַ */      
+    SCCB_SendByte( ReadAddress );     /* 设置低起始地址 */      
     SCCB_WaitAck();	
     SCCB_Stop(); 
 	
@@ -264,7 +264,7 @@ int SCCB_ReadByte(uint8_t* pBuffer, uint16_t length, uint8_t ReadAddress)
 	{
 		return DISABLE;
 	}
-    SCCB_SendByte( DEV_ADR + 1 );     /* ַ */ 
+    SCCB_SendByte( DEV_ADR + 1 );     /* 器件地址 */ 
     if(!SCCB_WaitAck())
 	{
 		SCCB_Stop(); 
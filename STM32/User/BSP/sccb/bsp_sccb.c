@@ -3,34 +3,71 @@
   * @file    bsp_sccb.c
   * @version V1.0
   * @date    2013-xx-xx
-  * @brief   ģI2C SCCBЭ
+  * @brief   模拟I2C SCCB协议驱动
   ******************************************************************************
   * @attention
   *
-  * ʵƽ̨: F103-ָ STM32  
-  * ̳    :http://www.firebbs.cn
-  * Ա    :https://fire-stm32.taobao.com
+  * 实验平台:秉火 F103-指南者 STM32 开发板 
+  * 论坛    :http://www.firebbs.cn
+  * 淘宝    :https://fire-stm32.taobao.com
+  *
+  * SCL由TIM6中断按SCCB_BUS_HZ逐步翻转，不再用延时循环空等；
+  * 调用任务在传输期间挂起，一批寄存器（SCCB_XFER）传完才唤醒。
   *
   ******************************************************************************
   */ 
 
 #include "./sccb/bsp_sccb.h"
 
-#define DEV_ADR  ADDR_OV7725 			 /*豸ַ*/
+#define DEV_ADR  ADDR_OV7725 			 /*设备地址定义*/
+
+/*总线操作，每个寄存器按操作表依次执行*/
+#define SCCB_OP_START       0       /* 起始信号，2拍 */
+#define SCCB_OP_STOP        1       /* 停止信号，3拍 */
+#define SCCB_OP_DEV_W       2       /* 发器件写地址，检查应答，9位*2拍 */
+#define SCCB_OP_DEV_R       3       /* 发器件读地址，检查应答 */
+#define SCCB_OP_ADDR        4       /* 发寄存器地址，SCCB第9位不检查 */
+#define SCCB_OP_DATA        5       /* 发寄存器值 */
+#define SCCB_OP_RECV        6       /* 收一个字节，第9位主机发NACK */
+#define SCCB_OP_END         7       /* 本寄存器结束 */
+
+/*写：起始 器件 地址 值 停止；读：先写地址，再起始 器件+1 收 停止*/
+static const uint8_t sccb_write_ops[] = {SCCB_OP_START, SCCB_OP_DEV_W, SCCB_OP_ADDR, SCCB_OP_DATA, SCCB_OP_STOP, SCCB_OP_END};
+static const uint8_t sccb_read_ops[]  = {SCCB_OP_START, SCCB_OP_DEV_W, SCCB_OP_ADDR, SCCB_OP_STOP,
+                                         SCCB_OP_START, SCCB_OP_DEV_R, SCCB_OP_RECV, SCCB_OP_STOP, SCCB_OP_END};
+static const uint8_t sccb_abort_ops[] = {SCCB_OP_STOP, SCCB_OP_END};
+
+/*状态机，只在定时器中断和启动传输时访问*/
+static struct
+{
+	SCCB_XFER *xfer;                /* 正在传的一批 */
+	const uint8_t *ops;             /* 当前寄存器的操作表 */
+	uint8_t op;                     /* 当前操作 */
+	uint8_t tick;                   /* 当前操作的第几拍 */
+	uint8_t byte;                   /* 正在收发的字节 */
+	uint8_t err;                    /* 1：出错，停止信号后结束本批 */
+}sccb;
+
+static OS_SEM sccb_sem;             /* 一批传完信号量 */
+static CPU_TS sccb_ts;
+SCCB_STAT sccb_stat;
 
 /********************************************************************
- * SCCB_Configuration
- *   SCCBܽ
- *   
- *   
- * ע          
+ * 函数名：SCCB_Configuration
+ * 描述  ：SCCB管脚、定时器、中断配置
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：需在OSInit之后调用（创建信号量）
  ********************************************************************/
 void SCCB_GPIO_Config(void)
 {
   GPIO_InitTypeDef  GPIO_InitStructure; 
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+	OS_ERR err;
 	
 	
-  /* SCL(PC6)SDA(PC7)ܽ */
+  /* SCL(PC6)、SDA(PC7)管脚配置 */
 	OV7725_SIO_C_SCK_APBxClock_FUN ( OV7725_SIO_C_GPIO_CLK, ENABLE );
   GPIO_InitStructure.GPIO_Pin =  OV7725_SIO_C_GPIO_PIN ;
   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
@@ -41,273 +78,309 @@ void SCCB_GPIO_Config(void)
   GPIO_InitStructure.GPIO_Pin =  OV7725_SIO_D_GPIO_PIN ;
   GPIO_Init(OV7725_SIO_D_GPIO_PORT, &GPIO_InitStructure);
 	
-}
-
-/********************************************************************
- * SCCB_delay
- *   ӳʱ
- *   
- *   
- * ע  ڲ        
- ********************************************************************/
-static void SCCB_delay(void)
-{	
-   uint16_t i = 400; 
-   while(i) 
-   { 
-     i--; 
-   } 
-}
-
-/********************************************************************
- * SCCB_Start
- *   SCCBʼź
- *   
- *   
- * ע  ڲ        
- ********************************************************************/
-static int SCCB_Start(void)
-{
-	SDA_H;
 	SCL_H;
-	SCCB_delay();
-	if(!SDA_read)
-	return DISABLE;	/* SDAΪ͵ƽæ,˳ */
-	SDA_L;
-	SCCB_delay();
-	if(SDA_read) 
-	return DISABLE;	/* SDAΪߵƽ߳,˳ */
-	SDA_L;
-	SCCB_delay();
-	return ENABLE;
+	SDA_H;
+	
+	OSSemCreate(&sccb_sem, "sccb sem", 0, &err);
+	
+	/*TIM6时基：每半个SCL周期更新一次，APB1定时器时钟为SystemCoreClock*/
+	RCC_APB1PeriphClockCmd(SCCB_TIM_CLK, ENABLE);
+	TIM_DeInit(SCCB_TIM);
+	TIM_TimeBaseStructure.TIM_Period = SystemCoreClock / (SCCB_BUS_HZ * SCCB_TICKS_PER_BIT) - 1;
+	TIM_TimeBaseStructure.TIM_Prescaler = 0;
+	TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+	TIM_TimeBaseInit(SCCB_TIM, &TIM_TimeBaseStructure);
+	TIM_ClearFlag(SCCB_TIM, TIM_FLAG_Update);
+	TIM_ITConfig(SCCB_TIM, TIM_IT_Update, ENABLE);
+	
+	/*总线节拍由主机决定，晚一点没关系，优先级低于VSYNC和FIFO DMA*/
+	NVIC_InitStructure.NVIC_IRQChannel = SCCB_TIM_IRQ;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
 }
 
-
-
 /********************************************************************
- * SCCB_Stop
- *   SCCBֹͣź
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_Next_Reg
+ * 描述  ：开始传输本批的下一个寄存器
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：内部调用        
  ********************************************************************/
-static void SCCB_Stop(void)
+static void SCCB_Next_Reg(void)
 {
-	SCL_L;
-	SCCB_delay();
-	SDA_L;
-	SCCB_delay();
-	SCL_H;
-	SCCB_delay();
-	SDA_H;
-	SCCB_delay();
+	sccb.ops = sccb.xfer->read ? sccb_read_ops : sccb_write_ops;
+	sccb.op = 0;
+	sccb.tick = 0;
 }
 
-
-
 /********************************************************************
- * SCCB_Ack
- *   SCCBӦʽ
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_Xfer_Start
+ * 描述  ：启动一批寄存器读写，立即返回
+ * 输入  ：xfer:regs、n、read由调用者填好
+ * 输出  ：SUCCESS:已启动 ERROR:上一批还没传完或n为0
+ * 注意  ：传输期间xfer和regs不能释放
  ********************************************************************/
-static void SCCB_Ack(void)
-{	
-	SCL_L;
-	SCCB_delay();
-	SDA_L;
-	SCCB_delay();
-	SCL_H;
-	SCCB_delay();
-	SCL_L;
-	SCCB_delay();
+ErrorStatus SCCB_Xfer_Start(SCCB_XFER *xfer)
+{
+	OS_ERR err;
+	
+	if(sccb.xfer != 0 || xfer->n == 0)
+		return ERROR;
+	
+	xfer->done = 0;
+	xfer->state = SCCB_XFER_BUSY;
+	OSSemSet(&sccb_sem, 0, &err);
+	sccb.xfer = xfer;
+	sccb.err = 0;
+	SCCB_Next_Reg();
+	sccb_ts = OS_TS_GET();
+	
+	TIM_SetCounter(SCCB_TIM, 0);
+	TIM_Cmd(SCCB_TIM, ENABLE);
+	return SUCCESS;
 }
 
-
-
 /********************************************************************
- * SCCB_NoAck
- *   SCCB Ӧʽ
- *   
- *   
- * ע  ڲ        
+ * 函数名：SCCB_Xfer_Wait
+ * 描述  ：挂起等待一批传完
+ * 输入  ：xfer:SCCB_Xfer_Start启动的一批 timeout:超时（时钟节拍）
+ * 输出  ：SUCCESS:全部传完 ERROR:出错或超时，xfer->done为传完的个数
+ * 注意  ：系统还没运行时查询等待
  ********************************************************************/
-static void SCCB_NoAck(void)
-{	
-	SCL_L;
-	SCCB_delay();
-	SDA_H;
-	SCCB_delay();
-	SCL_H;
-	SCCB_delay();
-	SCL_L;
-	SCCB_delay();
+ErrorStatus SCCB_Xfer_Wait(SCCB_XFER *xfer, OS_TICK timeout)
+{
+	OS_ERR err;
+	
+	if(OSRunning == OS_STATE_OS_RUNNING)
+	{
+		while(xfer->state == SCCB_XFER_BUSY)
+		{
+			OSSemPend(&sccb_sem, timeout, OS_OPT_PEND_BLOCKING, 0, &err);
+			if(err == OS_ERR_TIMEOUT)
+				break;
+		}
+	}
+	else
+	{
+		while(xfer->state == SCCB_XFER_BUSY);
+	}
+	
+	if(xfer->state == SCCB_XFER_BUSY)
+	{
+		/*超时：停止状态机，释放总线*/
+		TIM_Cmd(SCCB_TIM, DISABLE);
+		sccb.xfer = 0;
+		SCL_H;
+		SDA_H;
+		xfer->state = SCCB_XFER_ERR;
+		sccb_stat.timeouts++;
+	}
+	return (xfer->state == SCCB_XFER_OK) ? SUCCESS : ERROR;
 }
 
 /********************************************************************
- * SCCB_WaitAck
- *   SCCB ȴӦ
- *   
- *   Ϊ:=1ACK,=0ACK
- * ע  ڲ        
+ * 函数名：SCCB_Tick
+ * 描述  ：走总线状态机的一拍
+ * 输入  ：无
+ * 输出  ：1：本批传完，需调用SCCB_Done
+ * 注意  ：在定时器中断中调用
  ********************************************************************/
-static int SCCB_WaitAck(void) 	
+uint8_t SCCB_Tick(void)
 {
-	SCL_L;
-	SCCB_delay();
-	SDA_H;			
-	SCCB_delay();
-	SCL_H;
-	SCCB_delay();
-	if(SDA_read)
+	uint8_t op, q, bit;
+	uint8_t last = 0;
+	SCCB_REG *reg;
+	
+	if(sccb.xfer == 0)
+		return 0;                       /* 超时中止后迟到的一拍 */
+	op = sccb.ops[sccb.op];
+	q = sccb.tick & 0x01;
+	bit = sccb.tick >> 1;
+	reg = &sccb.xfer->regs[sccb.xfer->done];
+	
+	switch(op)
 	{
-      SCL_L;
-      return DISABLE;
+		case SCCB_OP_START:
+			if(q == 0)
+			{
+				SDA_H;
+				SCL_H;
+			}
+			else
+			{
+				if(!SDA_read)
+					sccb.err = 1;       /* SDA线为低电平则总线忙 */
+				SDA_L;
+				last = 1;
+			}
+			break;
+			
+		case SCCB_OP_STOP:
+			if(sccb.tick == 0)
+			{
+				SCL_L;
+				SDA_L;
+			}
+			else if(sccb.tick == 1)
+				SCL_H;
+			else
+			{
+				SDA_H;                  /* SCL为高时SDA上升 */
+				last = 1;
+			}
+			break;
+			
+		case SCCB_OP_RECV:
+			if(q == 0)
+			{
+				SCL_L;
+				SDA_H;                  /* 释放SDA；第9位为NACK */
+			}
+			else
+			{
+				SCL_H;
+				if(bit < 8)
+					sccb.byte = (sccb.byte << 1) | (SDA_read ? 1 : 0);
+				else
+				{
+					reg->value = sccb.byte;
+					last = 1;
+				}
+			}
+			break;
+			
+		default:                        /* 发一个字节 */
+			if(q == 0)
+			{
+				SCL_L;
+				if(bit == 0)
+				{
+					if(op == SCCB_OP_DEV_W)
+						sccb.byte = DEV_ADR;
+					else if(op == SCCB_OP_DEV_R)
+						sccb.byte = DEV_ADR + 1;
+					else if(op == SCCB_OP_ADDR)
+						sccb.byte = reg->addr;
+					else
+						sccb.byte = reg->value;
+				}
+				if(bit < 8 && !(sccb.byte & (0x80 >> bit)))
+					SDA_L;
+				else
+					SDA_H;              /* 1或第9位释放SDA等应答 */
+			}
+			else
+			{
+				SCL_H;
+				if(bit == 8)
+				{
+					if(SDA_read && (op == SCCB_OP_DEV_W || op == SCCB_OP_DEV_R))
+						sccb.err = 1;   /* 器件无应答 */
+					last = 1;
+				}
+			}
+			break;
 	}
-	SCL_L;
-	return ENABLE;
+	
+	if(!last)
+	{
+		sccb.tick++;
+		return 0;
+	}
+	
+	sccb.tick = 0;
+	if(sccb.err && sccb.ops != sccb_abort_ops)
+	{
+		sccb.ops = sccb_abort_ops;      /* 发停止信号后结束本批 */
+		sccb.op = 0;
+		return 0;
+	}
+	if(sccb.ops[++sccb.op] != SCCB_OP_END)
+		return 0;
+	
+	if(!sccb.err)
+	{
+		sccb.xfer->done++;
+		if(sccb.xfer->done < sccb.xfer->n)
+		{
+			SCCB_Next_Reg();
+			return 0;
+		}
+	}
+	TIM_Cmd(SCCB_TIM, DISABLE);
+	return 1;
 }
 
-
-
- /*******************************************************************
- * SCCB_SendByte
- *   ݴӸλλ
- *   SendByte: ͵
- *   
- * ע  ڲ        
- *********************************************************************/
-static void SCCB_SendByte(uint8_t SendByte) 
+/********************************************************************
+ * 函数名：SCCB_Done
+ * 描述  ：本批传完，唤醒等待的任务
+ * 输入  ：无
+ * 输出  ：无
+ * 注意  ：在定时器中断中、OSIntEnter之后调用
+ ********************************************************************/
+void SCCB_Done(void)
 {
-    uint8_t i=8;
-    while(i--)
-    {
-        SCL_L;
-        SCCB_delay();
-      if(SendByte&0x80)
-        SDA_H;  
-      else 
-        SDA_L;   
-        SendByte<<=1;
-        SCCB_delay();
-		SCL_H;
-        SCCB_delay();
-    }
-    SCL_L;
-}
-
-
-
-
- /******************************************************************
- * SCCB_ReceiveByte
- *   ݴӸλλ
- *   
- *   SCCB߷ص
- * ע  ڲ        
- *******************************************************************/
-static int SCCB_ReceiveByte(void)  
-{ 
-    uint8_t i=8;
-    uint8_t ReceiveByte=0;
-
-    SDA_H;				
-    while(i--)
-    {
-      ReceiveByte<<=1;      
-      SCL_L;
-      SCCB_delay();
-	  SCL_H;
-      SCCB_delay();	
-      if(SDA_read)
-      {
-        ReceiveByte|=0x01;
-      }
-    }
-    SCL_L;
-    return ReceiveByte;
+	OS_ERR err;
+	SCCB_XFER *xfer = sccb.xfer;
+	
+	sccb.xfer = 0;
+	sccb_stat.regs += xfer->done;
+	sccb_stat.last_us = (OS_TS_GET() - sccb_ts) / (SystemCoreClock / 1000000u);
+	if(sccb.err)
+		sccb_stat.errors++;
+	xfer->state = sccb.err ? SCCB_XFER_ERR : SCCB_XFER_OK;
+	OSSemPost(&sccb_sem, OS_OPT_POST_1, &err);
 }
 
-
-
-
-
  /*****************************************************************************************
- * SCCB_WriteByte
- *   дһֽ
- *   - WriteAddress: дַ 	- SendByte: д	- DeviceAddress: 
- *   Ϊ:=1ɹд,=0ʧ
- * ע          
+ * 函数名：SCCB_WriteByte
+ * 描述  ：写一字节数据
+ * 输入  ：- WriteAddress: 待写入地址 	- SendByte: 待写入数据	- DeviceAddress: 器件类型
+ * 输出  ：返回为:=1成功写入,=0失败
+ * 注意  ：传输期间调用任务挂起
  *****************************************************************************************/           
 int SCCB_WriteByte( uint16_t WriteAddress , uint8_t SendByte )
 {		
-    if(!SCCB_Start())
-	{
-	    return DISABLE;
-	}
-    SCCB_SendByte( DEV_ADR );                    /* ַ */
-    if( !SCCB_WaitAck() )
-	{
-		SCCB_Stop(); 
+	SCCB_REG reg;
+	SCCB_XFER xfer;
+	
+	reg.addr = (uint8_t)(WriteAddress & 0x00FF);
+	reg.value = SendByte;
+	xfer.regs = &reg;
+	xfer.n = 1;
+	xfer.read = 0;
+	if(SCCB_Xfer_Start(&xfer) != SUCCESS)
 		return DISABLE;
-	}
-    SCCB_SendByte((uint8_t)(WriteAddress & 0x00FF));   /* õʼַ */      
-    SCCB_WaitAck();	
-    SCCB_SendByte(SendByte);
-    SCCB_WaitAck();   
-    SCCB_Stop(); 
-    return ENABLE;
+	return (SCCB_Xfer_Wait(&xfer, SCCB_TIMEOUT) == SUCCESS) ? ENABLE : DISABLE;
 }
 
 /******************************************************************************************************************
- * SCCB_ReadByte
- *   ȡһ
- *   - pBuffer: Ŷ 	- length: 	- ReadAddress: ַ		 - DeviceAddress: 
- *   Ϊ:=1ɹ,=0ʧ
- * ע          
+ * 函数名：SCCB_ReadByte
+ * 描述  ：读取一串数据
+ * 输入  ：- pBuffer: 存放读出数据 	- length: 待读出长度	- ReadAddress: 待读出地址		 - DeviceAddress: 器件类型
+ * 输出  ：返回为:=1成功读入,=0失败
+ * 注意  ：length大于1时依次读ReadAddress开始的连续寄存器（OV7725不支持地址自增）
  **********************************************************************************************************************/           
 int SCCB_ReadByte(uint8_t* pBuffer, uint16_t length, uint8_t ReadAddress)
 {	
-    if(!SCCB_Start())
-	{
-	    return DISABLE;
-	}
-    SCCB_SendByte( DEV_ADR );         /* ַ */
-    if( !SCCB_WaitAck() )
-	{
-		SCCB_Stop(); 
-		return DISABLE;
-	}
-    SCCB_SendByte( ReadAddress );     /* õʼַ */      
-    SCCB_WaitAck();	
-    SCCB_Stop(); 
+	SCCB_REG reg;
+	SCCB_XFER xfer;
 	
-    if(!SCCB_Start())
+	xfer.regs = &reg;
+	xfer.n = 1;
+	xfer.read = 1;
+	while(length)
 	{
-		return DISABLE;
+		reg.addr = ReadAddress++;
+		if(SCCB_Xfer_Start(&xfer) != SUCCESS || SCCB_Xfer_Wait(&xfer, SCCB_TIMEOUT) != SUCCESS)
+			return DISABLE;
+		*pBuffer++ = reg.value;
+		length--;
 	}
-    SCCB_SendByte( DEV_ADR + 1 );     /* ַ */ 
-    if(!SCCB_WaitAck())
-	{
-		SCCB_Stop(); 
-		return DISABLE;
-	}
-    while(length)
-    {
-      *pBuffer = SCCB_ReceiveByte();
-      if(length == 1)
-	  {
-		  SCCB_NoAck();
-	  }
-      else
-	  {
-		SCCB_Ack(); 
-	  }
-      pBuffer++;
-      length--;
-    }
-    SCCB_Stop();
-    return ENABLE;
+	return ENABLE;
 }
 /*********************************************END OF FILE**********************/
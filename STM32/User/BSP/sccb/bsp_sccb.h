@@ -4,10 +4,11 @@
 
 
 #include "stm32f10x.h"
+#include  <os.h>
 
 
 
-/************************** OV7725 Ŷ********************************/
+/************************** OV7725 连接引脚定义********************************/
 #define      OV7725_SIO_C_SCK_APBxClock_FUN              RCC_APB2PeriphClockCmd
 #define      OV7725_SIO_C_GPIO_CLK                       RCC_APB2Periph_GPIOC
 #define      OV7725_SIO_C_GPIO_PORT                      GPIOC
@@ -20,20 +21,79 @@
 
 
 
-#define SCL_H         GPIO_SetBits(OV7725_SIO_C_GPIO_PORT , OV7725_SIO_C_GPIO_PIN) 
-#define SCL_L         GPIO_ResetBits(OV7725_SIO_C_GPIO_PORT , OV7725_SIO_C_GPIO_PIN) 
+#define SCL_H         (OV7725_SIO_C_GPIO_PORT->BSRR = OV7725_SIO_C_GPIO_PIN)
+#define SCL_L         (OV7725_SIO_C_GPIO_PORT->BRR  = OV7725_SIO_C_GPIO_PIN)
    
-#define SDA_H         GPIO_SetBits(OV7725_SIO_D_GPIO_PORT , OV7725_SIO_D_GPIO_PIN) 
-#define SDA_L         GPIO_ResetBits(OV7725_SIO_D_GPIO_PORT , OV7725_SIO_D_GPIO_PIN) 
+#define SDA_H         (OV7725_SIO_D_GPIO_PORT->BSRR = OV7725_SIO_D_GPIO_PIN)
+#define SDA_L         (OV7725_SIO_D_GPIO_PORT->BRR  = OV7725_SIO_D_GPIO_PIN)
 
-#define SCL_read      GPIO_ReadInputDataBit(OV7725_SIO_C_GPIO_PORT , OV7725_SIO_C_GPIO_PIN) 
-#define SDA_read      GPIO_ReadInputDataBit(OV7725_SIO_D_GPIO_PORT , OV7725_SIO_D_GPIO_PIN) 
+#define SCL_read      (OV7725_SIO_C_GPIO_PORT->IDR & OV7725_SIO_C_GPIO_PIN)
+#define SDA_read      (OV7725_SIO_D_GPIO_PORT->IDR & OV7725_SIO_D_GPIO_PIN)
+
+#ifdef SCCB_SIM
+#include "sccb_sim.h"        //主机测试：引脚接到从机模型，见Test/shim
+#endif
 
 #define ADDR_OV7725   0x42
 
 
+/************************** SCCB 定时器驱动定义********************************/
+/*
+ * TIM6每半个SCL周期中断一次，中断里走一步总线状态机，每位两拍：
+ *   拍0：SCL拉低，紧接着改SDA    拍1：SCL拉高，紧接着采样SDA
+ * 从机在SCL下降沿之后才改SDA，到拉高时已稳定了半个周期，拉高后马上采样即可。
+ * TIM6没有比较通道，同一拍里两次引脚操作相隔几个APB2周期。
+ * 传输期间调用任务挂起在信号量上，整批寄存器传完才唤醒
+ */
+#define      SCCB_TIM                                    TIM6
+#define      SCCB_TIM_CLK                                RCC_APB1Periph_TIM6
+#define      SCCB_TIM_IRQ                                TIM6_IRQn
+#define      SCCB_TIM_INT_FUNCTION                       TIM6_IRQHandler
+
+#define      SCCB_BUS_HZ                                 50000   /* SCL频率，定时器周期按SystemCoreClock算出 */
+#define      SCCB_TICKS_PER_BIT                          2       /* 每位的中断次数，中断频率为SCCB_BUS_HZ的2倍 */
+#define      SCCB_TIMEOUT                                100     /* 等待一批传完的超时（时钟节拍） */
+
+
+/*一个寄存器：地址和值，读时值由SCCB填写*/
+typedef struct
+{
+	uint8_t addr;
+	uint8_t value;
+}SCCB_REG;
+
+/*一批寄存器传输*/
+#define SCCB_XFER_IDLE      0
+#define SCCB_XFER_BUSY      1
+#define SCCB_XFER_OK        2
+#define SCCB_XFER_ERR       3   /* 总线忙或器件无应答，done之后的寄存器没有传 */
+
+typedef struct
+{
+	SCCB_REG *regs;                 /* 寄存器表 */
+	uint8_t   n;                    /* 寄存器个数 */
+	uint8_t   read;                 /* 0：写 1：读 */
+	volatile uint8_t done;          /* 已传完的寄存器个数 */
+	volatile uint8_t state;         /* SCCB_XFER_xxx */
+}SCCB_XFER;
+
+/*传输统计，可在调试器中查看*/
+typedef struct
+{
+	uint32_t regs;                  /* 传完的寄存器数 */
+	uint32_t errors;                /* 出错的批数 */
+	uint32_t timeouts;              /* 超时中止的批数 */
+	uint32_t last_us;               /* 上一批从启动到唤醒的时间 */
+}SCCB_STAT;
+
+extern SCCB_STAT sccb_stat;
+
 
 void SCCB_GPIO_Config(void);
+ErrorStatus SCCB_Xfer_Start(SCCB_XFER *xfer);
+ErrorStatus SCCB_Xfer_Wait(SCCB_XFER *xfer, OS_TICK timeout);
+uint8_t SCCB_Tick(void);
+void SCCB_Done(void);
 int SCCB_WriteByte( u16 WriteAddress , u8 SendByte);
 int SCCB_ReadByte(u8* pBuffer,   u16 length,   u8 ReadAddress);
 
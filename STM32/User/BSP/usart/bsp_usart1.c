@@ -2,9 +2,9 @@
 
 
  /**
-  * @brief  USARTx GPIO ,ģʽá115200 8-N-1
-  * @param  
-  * @retval 
+  * @brief  USARTx GPIO 配置,工作模式配置。115200 8-N-1
+  * @param  无
+  * @retval 无
   */
 void USARTx_Config(void)
 {
@@ -41,23 +41,23 @@ void USARTx_Config(void)
 }
 
 
-/// ضc⺯printfUSART1
+/// 重定向c库函数printf到USART1
 int fputc(int ch, FILE *f)
 {
-		/* һֽݵUSART1 */
+		/* 发送一个字节数据到USART1 */
 		USART_SendData(macUSARTx, (uint8_t) ch);
 		
-		/* ȴ */
+		/* 等待发送完毕 */
 		while (USART_GetFlagStatus(macUSARTx, USART_FLAG_TXE) == RESET);		
 	
 		return (ch);
 }
 
 
-/// ضc⺯scanfUSART1
+/// 重定向c库函数scanf到USART1
 int fgetc(FILE *f)
 {
-		/* ȴ1 */
+		/* 等待串口1输入数据 */
 		while (USART_GetFlagStatus(macUSARTx, USART_FLAG_RXNE) == RESET);
 
 		return (int)USART_ReceiveData(macUSARTx);
@@ -7,7 +7,7 @@
 
 
 
-/**************************USART********************************/
+/**************************USART参数定义********************************/
 #define             macUSART_BAUD_RATE                       115200
 
 #define             macUSARTx                                USART1
@@ -26,13 +26,15 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f10x_it.h"
 #include "./ov7725/bsp_ov7725.h"
+#include "./ov7725/bsp_ov7725_dma.h"
+#include "./sccb/bsp_sccb.h"
 #include "w5500_conf.h"
 #include <includes.h>
 //#include "./systick/bsp_SysTick.h"
 
 
-//VSYNCжϴ־
-extern uint8_t Ov7725_vsync;
+//采集任务控制块，一帧写完后向它发送任务信号量
+extern OS_TCB  AppTaskOV7725TCB;
 /** @addtogroup STM32F10x_StdPeriph_Template
   * @{
   */
@@ -146,33 +148,59 @@ void SysTick_Handler(void)
 }
 
 
-/* ov7725 ж  */
+/* ov7725 场中断 服务程序 */
 void OV7725_VSYNC_EXTI_INT_FUNCTION ( void )
 {	
-	OSIntEnter();   //ж
+	OS_ERR err;
+
+	OSIntEnter();   //进入中断
 	
-    if ( EXTI_GetITStatus(OV7725_VSYNC_EXTI_LINE) != RESET ) 	//EXTI_Line0·ϵжǷ͵NVIC 
+    if ( EXTI_GetITStatus(OV7725_VSYNC_EXTI_LINE) != RESET ) 	//检查EXTI_Line0线路上的中断请求是否发送到了NVIC 
     {
-        if( Ov7725_vsync == 0 )
-        {
-            FIFO_WRST_L(); 	                      //ʹFIFOд(fromͷ)ָ븴λ
-            FIFO_WE_H();	                        //ʹFIFOд
-            
-            Ov7725_vsync = 1;	   	
-            FIFO_WE_H();                          //ʹFIFOд
-            FIFO_WRST_H();                        //ʹFIFOд(fromͷ)ָ˶
-        }
-        else if( Ov7725_vsync == 1 )
+        if( OV7725_Frame_VSYNC() )           //一帧写完，FIFO有空间时已接着写下一帧
         {
-            FIFO_WE_L();                          //ʹFIFOдͣ
-            Ov7725_vsync = 2;
+            OSTaskSemPost(&AppTaskOV7725TCB, OS_OPT_POST_NONE, &err);   //通知采集任务读FIFO
         }        
-        EXTI_ClearITPendingBit(OV7725_VSYNC_EXTI_LINE);		    //EXTI_Line0·־λ        
+        EXTI_ClearITPendingBit(OV7725_VSYNC_EXTI_LINE);		    //清除EXTI_Line0线路挂起标志位        
     }    
 	
 	OSIntExit();
 }
 
+/* ov7725 FIFO DMA读完一块 服务程序 */
+void OV7725_DMA_INT_FUNCTION ( void )
+{
+	OSIntEnter();   //进入中断
+
+	OV7725_DMA_ISR();
+
+	OSIntExit();
+}
+
+#if (APP_CFG_WIZ_SPI_DMA_EN == DEF_ENABLED)
+/* W5500 SPI DMA传完一块 服务程序 */
+void WIZ_SPIx_DMA_INT_FUNCTION ( void )
+{
+	OSIntEnter();   //进入中断
+
+	wiz_spi_dma_isr();
+
+	OSIntExit();
+}
+#endif
+
+/*SCCB总线节拍中断：每拍都进出OS开销太大，一批传完才进入OS唤醒任务*/
+void SCCB_TIM_INT_FUNCTION ( void )
+{
+	TIM_ClearITPendingBit(SCCB_TIM, TIM_IT_Update);
+	if(SCCB_Tick())
+	{
+		OSIntEnter();
+		SCCB_Done();
+		OSIntExit();
+	}
+}
+
 /******************************************************************************/
 /*                 STM32F10x Peripherals Interrupt Handlers                   */
 /*  Add here the Interrupt Handler for the used peripheral(s) (PPP), for the  */
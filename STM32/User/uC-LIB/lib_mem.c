@@ -1570,7 +1570,7 @@ void  Mem_PoolCreate (MEM_POOL          *pmem_pool,
 *********************************************************************************************************
 *                                      Mem_PoolBlkGetNbrAvail()
 *
-* Description : Get memory pools remaining number of blocks available to allocate.
+* Description : Get memory pool抯 remaining number of blocks available to allocate.
 *
 * Argument(s) : pmem_pool   Pointer to a memory pool structure.
 *
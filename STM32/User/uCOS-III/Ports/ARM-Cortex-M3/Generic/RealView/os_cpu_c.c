@@ -338,9 +338,9 @@ void  OSTaskSwHook (void)
 
 void  OSTimeTickHook (void)
 {
-#if OS_CFG_APP_HOOKS_EN > 0u                               //ʹܣĬʹܣ;
-    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {    //ָ OS_AppTimeTickHookPtr ǿ
-        (*OS_AppTimeTickHookPtr)();                        //øָŵĺַ
+#if OS_CFG_APP_HOOKS_EN > 0u                               //如果使能（默认使能）了特殊用途钩子
+    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {    //如果指针 OS_AppTimeTickHookPtr 非空
+        (*OS_AppTimeTickHookPtr)();                        //调用该指针存放的函数（地址）
     }
 #endif
 }
@@ -362,16 +362,16 @@ void  OSTimeTickHook (void)
 
 void  OS_CPU_SysTickHandler (void)
 {
-    CPU_SR_ALLOC();       //䱣ж״̬ľֲжϵʱԱж״̬
+    CPU_SR_ALLOC();       //分配保存中断状态的局部变量，后面关中断的时候可以保存中断状态
 
 
-    CPU_CRITICAL_ENTER(); // CPU_CRITICAL_ENTER()  CPU_CRITICAL_EXIT() ֮γٽΣڼʱܵ
-    OSIntNestingCtr++;    //жʱжǶҪ1       
+    CPU_CRITICAL_ENTER(); // CPU_CRITICAL_ENTER() 和 CPU_CRITICAL_EXIT() 之间形成临界段，避免期间程序运行时受到干扰
+    OSIntNestingCtr++;    //进入中断时中断嵌套数要加1       
     CPU_CRITICAL_EXIT();
 
-    OSTimeTick();        // OSTimeTick()                              
+    OSTimeTick();        //调用 OSTimeTick() 函数                             
 
-    OSIntExit();         //˳жϣؼжǶ1             
+    OSIntExit();         //退出中断，里面回家中断嵌套数减1             
 }
 
 
@@ -392,20 +392,20 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 {
     CPU_INT32U  prio;
 
-    /* д SysTick ؼֵ */
-    CPU_REG_NVIC_ST_RELOAD = cnts - 1u;                     // SysTick ԸüֵΪѭʱ
+    /* 填写 SysTick 的重载计数值 */
+    CPU_REG_NVIC_ST_RELOAD = cnts - 1u;                     // SysTick 以该计数值为周期循环计数定时
 
-    /*  SysTick жȼ */                           
+    /* 设置 SysTick 中断优先级 */                           
     prio  = CPU_REG_NVIC_SHPRI3;                            
     prio &= DEF_BIT_FIELD(24, 0);
-    prio |= DEF_BIT_MASK(OS_CPU_CFG_SYSTICK_PRIO, 24);      //ΪĬϵȼ0иȼĬΪ
+    prio |= DEF_BIT_MASK(OS_CPU_CFG_SYSTICK_PRIO, 24);      //设置为默认的最高优先级0，在裸机例程中该优先级默认为最低
 
     CPU_REG_NVIC_SHPRI3 = prio;
 
-    /* ʹ SysTick ʱԴ */                   
+    /* 使能 SysTick 的时钟源和启动计数器 */                   
     CPU_REG_NVIC_ST_CTRL |= CPU_REG_NVIC_ST_CTRL_CLKSOURCE |
                             CPU_REG_NVIC_ST_CTRL_ENABLE;
-    /* ʹ SysTick Ķʱж */                            
+    /* 使能 SysTick 的定时中断 */                            
     CPU_REG_NVIC_ST_CTRL |= CPU_REG_NVIC_ST_CTRL_TICKINT;
 }
 
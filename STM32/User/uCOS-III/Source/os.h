@@ -71,80 +71,80 @@ extern "C" {
 */
 
 
-#if      OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u && defined(CPU_CFG_INT_DIS_MEAS_EN) //ʹ˲Եʱ͹жʱ
-#define  OS_SCHED_LOCK_TIME_MEAS_START()    OS_SchedLockTimeMeasStart()          //ʹøúʼԵʱ
-#else                                                                            //˲Եʱжʱ
-#define  OS_SCHED_LOCK_TIME_MEAS_START()                                         //Եʱ
+#if      OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u && defined(CPU_CFG_INT_DIS_MEAS_EN) //如果使能了测试调度器被锁时间和关中断时间
+#define  OS_SCHED_LOCK_TIME_MEAS_START()    OS_SchedLockTimeMeasStart()          //使用该函数开始测试调度器被锁时间
+#else                                                                            //如果禁用了测试调度器被锁时间或关中断时间
+#define  OS_SCHED_LOCK_TIME_MEAS_START()                                         //不测试调度器被锁时间
 #endif
 
 
-#if      OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u && defined(CPU_CFG_INT_DIS_MEAS_EN) //ʹ˲Եʱ͹жʱ
-#define  OS_SCHED_LOCK_TIME_MEAS_STOP()     OS_SchedLockTimeMeasStop()           //ʹøúԵʱ
-#else                                                                            //˲Եʱжʱ
-#define  OS_SCHED_LOCK_TIME_MEAS_STOP()                                          //Եʱ
+#if      OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u && defined(CPU_CFG_INT_DIS_MEAS_EN) //如果使能了测试调度器被锁时间和关中断时间
+#define  OS_SCHED_LOCK_TIME_MEAS_STOP()     OS_SchedLockTimeMeasStop()           //使用该函数结束测试调度器被锁时间
+#else                                                                            //如果禁用了测试调度器被锁时间或关中断时间
+#define  OS_SCHED_LOCK_TIME_MEAS_STOP()                                          //不测试调度器被锁时间
 #endif
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                          //ʹܣĬʹˣжӳٷ 
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                          //如果使能（默认使能了）中断延迟发布 
                                                                
-#define  OS_CRITICAL_ENTER()                                  /**/                    \
+#define  OS_CRITICAL_ENTER()                                  /*加锁调度器*/                    \
          do {                                                                                   \
-             CPU_CRITICAL_ENTER();                            /*ж*/                        \
-             OSSchedLockNestingCtr++;                         /**/                  \
-             if (OSSchedLockNestingCtr == 1u) {               /*ձϣһѣ*/  \
-                 OS_SCHED_LOCK_TIME_MEAS_START();             /*ʼԵʱ*/        \
+             CPU_CRITICAL_ENTER();                            /*关中断*/                        \
+             OSSchedLockNestingCtr++;                         /*给调度器加锁*/                  \
+             if (OSSchedLockNestingCtr == 1u) {               /*如果调度器刚被上（第一把）锁*/  \
+                 OS_SCHED_LOCK_TIME_MEAS_START();             /*开始测试调度器被锁时间*/        \
              }                                                                                  \
-             CPU_CRITICAL_EXIT();                             /*ж*/                        \
+             CPU_CRITICAL_EXIT();                             /*开中断*/                        \
          } while (0)
                                                                
-#define  OS_CRITICAL_ENTER_CPU_EXIT()                         /*ж*/          \
+#define  OS_CRITICAL_ENTER_CPU_EXIT()                         /*加锁调度器，并开中断*/          \
          do {                                                                                   \
-             OSSchedLockNestingCtr++;                         /**/                  \
+             OSSchedLockNestingCtr++;                         /*给调度器加锁*/                  \
                                                                                                 \
-             if (OSSchedLockNestingCtr == 1u) {               /*ձϣһѣ*/  \
-                 OS_SCHED_LOCK_TIME_MEAS_START();             /*ʼԵʱ*/        \
+             if (OSSchedLockNestingCtr == 1u) {               /*如果调度器刚被上（第一把）锁*/  \
+                 OS_SCHED_LOCK_TIME_MEAS_START();             /*开始测试调度器被锁时间*/        \
              }                                                                                  \
-             CPU_CRITICAL_EXIT();                             /*ж*/                        \
+             CPU_CRITICAL_EXIT();                             /*开中断*/                        \
          } while (0)
 
                                                               
-#define  OS_CRITICAL_EXIT()                                   /*жϢжϢ*/      \
-         do {                                                 /* OS_IntQTask                      */      \
-             CPU_CRITICAL_ENTER();                            /*ж*/                                            \
-             OSSchedLockNestingCtr--;                         /**/                                      \
-             if (OSSchedLockNestingCtr == (OS_NESTING_CTR)0) {/**/                                \
-                 OS_SCHED_LOCK_TIME_MEAS_STOP();              /*Եʱϣµʱ*/    \
-                 if (OSIntQNbrEntries > (OS_OBJ_QTY)0) {      /*жϢзǿ*/                              \
-                     CPU_CRITICAL_EXIT();                     /*ж*/                                            \
-                     OS_Sched0();                             /*ǿƵȼΪ0 OS_IntQTask ȼΪ0*/ \
-                 } else {                                     /*жϢΪ*/                              \
-                     CPU_CRITICAL_EXIT();                     /*ж*/                                            \
+#define  OS_CRITICAL_EXIT()                                   /*减锁调度器，如果有中断消息发布，调度中断消息*/      \
+         do {                                                 /*队列任务 OS_IntQTask 。                     */      \
+             CPU_CRITICAL_ENTER();                            /*关中断*/                                            \
+             OSSchedLockNestingCtr--;                         /*给调度器减锁*/                                      \
+             if (OSSchedLockNestingCtr == (OS_NESTING_CTR)0) {/*如果调度器被开启了*/                                \
+                 OS_SCHED_LOCK_TIME_MEAS_STOP();              /*测试调度器被锁时间完毕，更新调度器被锁最大时间*/    \
+                 if (OSIntQNbrEntries > (OS_OBJ_QTY)0) {      /*如果中断消息队列非空*/                              \
+                     CPU_CRITICAL_EXIT();                     /*开中断*/                                            \
+                     OS_Sched0();                             /*强制调度优先级为0的任务（ OS_IntQTask 任务优先级为0）*/ \
+                 } else {                                     /*如果中断消息队列为空*/                              \
+                     CPU_CRITICAL_EXIT();                     /*开中断*/                                            \
                  }                                                                                                  \
-             } else {                                         /*δ*/                              \
-                 CPU_CRITICAL_EXIT();                         /*ж*/                                            \
+             } else {                                         /*如果调度器尚未被开启*/                              \
+                 CPU_CRITICAL_EXIT();                         /*开中断*/                                            \
              }                                                                                                      \
          } while (0)
 
-#define  OS_CRITICAL_EXIT_NO_SCHED()                          /*Ȳ*/                        \
+#define  OS_CRITICAL_EXIT_NO_SCHED()                          /*减锁调度器，不附带调度操作*/                        \
          do {                                                                                                       \
-             CPU_CRITICAL_ENTER();                            /*ж*/                                            \
-             OSSchedLockNestingCtr--;                         /**/                                      \
-             if (OSSchedLockNestingCtr == (OS_NESTING_CTR)0) {/**/                                \
-                 OS_SCHED_LOCK_TIME_MEAS_STOP();              /*Եʱϣµʱ*/    \
+             CPU_CRITICAL_ENTER();                            /*关中断*/                                            \
+             OSSchedLockNestingCtr--;                         /*给调度器减锁*/                                      \
+             if (OSSchedLockNestingCtr == (OS_NESTING_CTR)0) {/*如果调度器被开启了*/                                \
+                 OS_SCHED_LOCK_TIME_MEAS_STOP();              /*测试调度器被锁时间完毕，更新调度器被锁最大时间*/    \
              }                                                                                                      \
-             CPU_CRITICAL_EXIT();                             /*ж*/                                            \
+             CPU_CRITICAL_EXIT();                             /*开中断*/                                            \
          } while (0)
 
 
-#else                                                                //ãĬʹˣжӳٷ
+#else                                                                //如果禁用（默认使能了）中断延迟发布
 
 
-#define  OS_CRITICAL_ENTER()                    CPU_CRITICAL_ENTER() //ж
+#define  OS_CRITICAL_ENTER()                    CPU_CRITICAL_ENTER() //关中断
 
-#define  OS_CRITICAL_ENTER_CPU_EXIT()                                //û
+#define  OS_CRITICAL_ENTER_CPU_EXIT()                                //没操作
 
-#define  OS_CRITICAL_EXIT()                     CPU_CRITICAL_EXIT()  //ж
+#define  OS_CRITICAL_EXIT()                     CPU_CRITICAL_EXIT()  //开中断
 
-#define  OS_CRITICAL_EXIT_NO_SCHED()            CPU_CRITICAL_EXIT()  //ж
+#define  OS_CRITICAL_EXIT_NO_SCHED()            CPU_CRITICAL_EXIT()  //开中断
 
 #endif
 
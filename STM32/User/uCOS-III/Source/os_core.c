@@ -568,36 +568,36 @@ void  OSSchedUnlock (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u                        //ʹʱƬת
-void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,               //ʹ/ʱƬת
-                            OS_TICK       dflt_time_quanta, //ĬʱƬ,0ʹϵͳֵ
-                            OS_ERR       *p_err)            //ش
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u                        //如果使能了时间片轮转调度
+void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,               //使能/禁用时间片轮转调度
+                            OS_TICK       dflt_time_quanta, //默认时间片,0表使用系统值
+                            OS_ERR       *p_err)            //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {          // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return;                          //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return;                          //返回，停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                                    //ж
-    if (en != DEF_ENABLED) {                                 //ʱƬת
+    CPU_CRITICAL_ENTER();                                    //关中断
+    if (en != DEF_ENABLED) {                                 //禁用时间片轮转调度
         OSSchedRoundRobinEn = DEF_DISABLED;
-    } else {                                                 //ʹʱƬת
+    } else {                                                 //使能时间片轮转调度
         OSSchedRoundRobinEn = DEF_ENABLED;
     }
 
-    if (dflt_time_quanta > (OS_TICK)0) {                    //ûԶĬʱƬ
+    if (dflt_time_quanta > (OS_TICK)0) {                    //用户自定义默认时间片
         OSSchedRoundRobinDfltTimeQuanta = dflt_time_quanta;
-    } else {                                                //ʹϵͳֵΪĬʱƬ
+    } else {                                                //使用系统值作为默认时间片
         OSSchedRoundRobinDfltTimeQuanta = (OS_TICK)(OSCfg_TickRate_Hz / (OS_RATE_HZ)10);
     }
-    CPU_CRITICAL_EXIT();                                    //ж
-   *p_err = OS_ERR_NONE;                                    //Ϊ޴
+    CPU_CRITICAL_EXIT();                                    //开中断
+   *p_err = OS_ERR_NONE;                                    //错误类型为“无错误”
 }
 #endif
 
@@ -622,59 +622,59 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,               //ʹ
 ************************************************************************************************************************
 */
 
-#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u            //ʹʱƬת
-void  OSSchedRoundRobinYield (OS_ERR  *p_err)   //ش
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u            //如果使能了时间片轮转调度
+void  OSSchedRoundRobinYield (OS_ERR  *p_err)   //返回错误类型
 {
     OS_RDY_LIST  *p_rdy_list;
     OS_TCB       *p_tcb;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                      //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {                // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();        //ִаȫ쳣
-        return;                                //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                      //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {                //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();        //执行安全检测异常函数
+        return;                                //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_YIELD_ISR;              //ΪжзʱƬ
-        return;                                //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数是在中断中被调用
+       *p_err = OS_ERR_YIELD_ISR;              //错误类型为“在中断中放弃时间片”
+        return;                                //返回，停止执行
     }
 #endif
 
-    if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //
-       *p_err = OS_ERR_SCHED_LOCKED;                 //Ϊ
-        return;                                      //أִֹͣ
+    if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //如果调度器被锁
+       *p_err = OS_ERR_SCHED_LOCKED;                 //错误类型为“调度器被锁”
+        return;                                      //返回，停止执行
     }
 
-    if (OSSchedRoundRobinEn != DEF_TRUE) {           //ʱת
-       *p_err = OS_ERR_ROUND_ROBIN_DISABLED;         //ΪδʹʱƬתȡ
-        return;                                      //أִֹͣ
+    if (OSSchedRoundRobinEn != DEF_TRUE) {           //如果禁用了时间轮转调度
+       *p_err = OS_ERR_ROUND_ROBIN_DISABLED;         //错误类型为“未使能时间片轮转调度”
+        return;                                      //返回，停止执行
     }
 
-    CPU_CRITICAL_ENTER();                            //ж
-    p_rdy_list = &OSRdyList[OSPrioCur];              //ȡǰȼľб
-    if (p_rdy_list->NbrEntries < (OS_OBJ_QTY)2) {    //бֻ1
-        CPU_CRITICAL_EXIT();                         //ж
-       *p_err = OS_ERR_ROUND_ROBIN_1;                //Ϊбֻ1
-        return;                                      //أִֹͣ
+    CPU_CRITICAL_ENTER();                            //关中断
+    p_rdy_list = &OSRdyList[OSPrioCur];              //获取当前优先级的就绪列表
+    if (p_rdy_list->NbrEntries < (OS_OBJ_QTY)2) {    //如果就绪列表只有1个任务
+        CPU_CRITICAL_EXIT();                         //开中断
+       *p_err = OS_ERR_ROUND_ROBIN_1;                //错误类型为“就绪列表只有1个任务”
+        return;                                      //返回，停止执行
     }
-    /* иȼֹ1ֹͣеǰ */
-    OS_RdyListMoveHeadToTail(p_rdy_list);            //ѵǰƵбβ
-    p_tcb = p_rdy_list->HeadPtr;                     //ȡбͷ׼У
-    if (p_tcb->TimeQuanta == (OS_TICK)0) {           //ʹĬϵʱƬ
+    /* 如果具有该优先级的任务不止1个，停止运行当前任务 */
+    OS_RdyListMoveHeadToTail(p_rdy_list);            //把当前任务移到就绪列表的尾端
+    p_tcb = p_rdy_list->HeadPtr;                     //获取就绪列表头端任务（准备运行）
+    if (p_tcb->TimeQuanta == (OS_TICK)0) {           //使用默认的时间片
         p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
-    } else {                                         //ʹԶʱƬ
+    } else {                                         //使用自定义的时间片
         p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;    
     }
 
-    CPU_CRITICAL_EXIT();                             //ж
+    CPU_CRITICAL_EXIT();                             //开中断
 
-    OSSched();                                       //ͷУ
-   *p_err = OS_ERR_NONE;                             //Ϊ޴
+    OSSched();                                       //调度任务（头端任务运行）
+   *p_err = OS_ERR_NONE;                             //错误类型为“无错误”
 }
 #endif
 
@@ -870,36 +870,36 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-void  OS_Pend (OS_PEND_DATA  *p_pend_data,  //ȴбԪ
-               OS_PEND_OBJ   *p_obj,        //ȴں˶
-               OS_STATE       pending_on,   //ȴֶں
-               OS_TICK        timeout)      //ȴ
+void  OS_Pend (OS_PEND_DATA  *p_pend_data,  //待插入等待列表的元素
+               OS_PEND_OBJ   *p_obj,        //等待的内核对象
+               OS_STATE       pending_on,   //等待哪种对象内核
+               OS_TICK        timeout)      //等待期限
 {
     OS_PEND_LIST  *p_pend_list;
 
 
 
-    OSTCBCurPtr->PendOn     = pending_on;                    //Դãʼȴ
-    OSTCBCurPtr->PendStatus = OS_STATUS_PEND_OK;             //ȴ
+    OSTCBCurPtr->PendOn     = pending_on;                    //资源不可用，开始等待
+    OSTCBCurPtr->PendStatus = OS_STATUS_PEND_OK;             //正常等待中
 
-    OS_TaskBlock(OSTCBCurPtr,                                //ǰ
-                 timeout);                                   // timeout 0Ľб
+    OS_TaskBlock(OSTCBCurPtr,                                //阻塞当前运行任务，
+                 timeout);                                   //如果 timeout 非0，把任务插入的节拍列表
 
-    if (p_obj != (OS_PEND_OBJ *)0) {                         //ȴǿ
-        p_pend_list             = &p_obj->PendList;          //ȡĵȴб p_pend_list
-        p_pend_data->PendObjPtr = p_obj;                     //ҪȴĶ
-        OS_PendDataInit((OS_TCB       *)OSTCBCurPtr,         //ʼ p_pend_dataȴб
+    if (p_obj != (OS_PEND_OBJ *)0) {                         //如果等待对象非空
+        p_pend_list             = &p_obj->PendList;          //获取对象的等待列表到 p_pend_list
+        p_pend_data->PendObjPtr = p_obj;                     //保存要等待的对象
+        OS_PendDataInit((OS_TCB       *)OSTCBCurPtr,         //初始化 p_pend_data（待插入等待列表）
                         (OS_PEND_DATA *)p_pend_data,
                         (OS_OBJ_QTY    )1);
-        OS_PendListInsertPrio(p_pend_list,                   //ȼ p_pend_data 뵽ȴб
+        OS_PendListInsertPrio(p_pend_list,                   //按优先级将 p_pend_data 插入到等待列表
                               p_pend_data);
-    } else {                                                 //ȴΪ
-        OSTCBCurPtr->PendDataTblEntries = (OS_OBJ_QTY    )0; //㵱ǰĵȴ
+    } else {                                                 //如果等待对象为空
+        OSTCBCurPtr->PendDataTblEntries = (OS_OBJ_QTY    )0; //清零当前任务的等待域数据
         OSTCBCurPtr->PendDataTblPtr     = (OS_PEND_DATA *)0; 
     }
-#if OS_CFG_DBG_EN > 0u                                       //ʹ˵Դͱ 
-    OS_PendDbgNameAdd(p_obj,                                 //ź DbgNamePtr ԪΪȴ
-                      OSTCBCurPtr);                          //бȼߵơ
+#if OS_CFG_DBG_EN > 0u                                       //如果使能了调试代码和变量 
+    OS_PendDbgNameAdd(p_obj,                                 //更新信号量的 DbgNamePtr 元素为其等待
+                      OSTCBCurPtr);                          //列表中优先级最高的任务的名称。
 #endif
 }
 
@@ -924,61 +924,61 @@ void  OS_Pend (OS_PEND_DATA  *p_pend_data,  //
 ************************************************************************************************************************
 */
 
-void  OS_PendAbort (OS_PEND_OBJ  *p_obj,   //ȴ
-                    OS_TCB       *p_tcb,   //ƿָ
-                    CPU_TS        ts)      //ȴֹʱʱ
+void  OS_PendAbort (OS_PEND_OBJ  *p_obj,   //被等待对象的类型
+                    OS_TCB       *p_tcb,   //任务控制块指针
+                    CPU_TS        ts)      //等待被中止时的时间戳
 {
-    switch (p_tcb->TaskState) {                             //״̬ദ                    
-        case OS_TASK_STATE_RDY:                             //Ǿ״̬
-        case OS_TASK_STATE_DLY:                             //ʱ״̬
-        case OS_TASK_STATE_SUSPENDED:                       //ǹ״̬
-        case OS_TASK_STATE_DLY_SUSPENDED:                   //ʱб
-             break;                                         //Щȴ޹أֱ
-
-        case OS_TASK_STATE_PEND:                            //޵ȴ״̬
-        case OS_TASK_STATE_PEND_TIMEOUT:                    //޵ȴ״̬
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {  //ڵȴźϢ
-                 OS_PendAbort1(p_obj,                       //ǿƽĳһĵȴ
+    switch (p_tcb->TaskState) {                             //根据任务状态分类处理                    
+        case OS_TASK_STATE_RDY:                             //如果任务是就绪状态
+        case OS_TASK_STATE_DLY:                             //如果任务是延时状态
+        case OS_TASK_STATE_SUSPENDED:                       //如果任务是挂起状态
+        case OS_TASK_STATE_DLY_SUSPENDED:                   //如果任务是在延时中被挂起
+             break;                                         //这些情况均与等待无关，直接跳出
+
+        case OS_TASK_STATE_PEND:                            //如果任务是无期限等待状态
+        case OS_TASK_STATE_PEND_TIMEOUT:                    //如果任务是有期限等待状态
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {  //如果任务在等待多个信号量或消息队列
+                 OS_PendAbort1(p_obj,                       //强制解除任务对某一对象的等待
                                p_tcb,
                                ts);
              }
-#if (OS_MSG_EN > 0u)                                //ʹлϢ
-             p_tcb->MsgPtr     = (void      *)0;    //λϢ
+#if (OS_MSG_EN > 0u)                                //如果使能了任务队列或消息队列
+             p_tcb->MsgPtr     = (void      *)0;    //清除（复位）任务的消息域
              p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
 #endif
-             p_tcb->TS         = ts;                        //ȴֹʱʱƿ
-             if (p_obj != (OS_PEND_OBJ *)0) {               //ȴǿ
-                 OS_PendListRemove(p_tcb);                  //еȴбƳ
+             p_tcb->TS         = ts;                        //保存等待被中止时的时间戳到任务控制块
+             if (p_obj != (OS_PEND_OBJ *)0) {               //如果等待对象非空
+                 OS_PendListRemove(p_tcb);                  //将任务从所有等待列表中移除
              }
-             OS_TaskRdy(p_tcb);                             //׼
-             p_tcb->TaskState  = OS_TASK_STATE_RDY;         //޸״̬Ϊ״̬
-             p_tcb->PendStatus = OS_STATUS_PEND_ABORT;      //ĵȴֹ
-             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;   //Ŀǰûеȴκζ
-             break;                                         //
-
-        case OS_TASK_STATE_PEND_SUSPENDED:                  //޵ȴб
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:          //޵ȴб
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {  //ڵȴźϢ
-                 OS_PendAbort1(p_obj,                       //ǿƽĳһĵȴ
+             OS_TaskRdy(p_tcb);                             //让任务进准备运行
+             p_tcb->TaskState  = OS_TASK_STATE_RDY;         //修改任务状态为就绪状态
+             p_tcb->PendStatus = OS_STATUS_PEND_ABORT;      //标记任务的等待被中止
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;   //标记任务目前没有等待任何对象
+             break;                                         //跳出
+
+        case OS_TASK_STATE_PEND_SUSPENDED:                  //如果任务在无期限等待中被挂起
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:          //如果任务在有期限等待中被挂起
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {  //如果任务在等待多个信号量或消息队列
+                 OS_PendAbort1(p_obj,                       //强制解除任务对某一对象的等待
                                p_tcb,
                                ts);
              }
-#if (OS_MSG_EN > 0u)                              //ʹлϢ
-             p_tcb->MsgPtr     = (void      *)0;  //λϢ
+#if (OS_MSG_EN > 0u)                              //如果使能了任务队列或消息队列
+             p_tcb->MsgPtr     = (void      *)0;  //清除（复位）任务的消息域
              p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
 #endif
-             p_tcb->TS         = ts;                        //ȴֹʱʱƿ
-             if (p_obj != (OS_PEND_OBJ *)0) {               //ȴǿ
-                 OS_PendListRemove(p_tcb);                  //еȴбƳ
+             p_tcb->TS         = ts;                        //保存等待被中止时的时间戳到任务控制块
+             if (p_obj != (OS_PEND_OBJ *)0) {               //如果等待对象非空
+                 OS_PendListRemove(p_tcb);                  //将任务从所有等待列表中移除
              }
-             OS_TickListRemove(p_tcb);                      //б
-             p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;   //޸״̬Ϊ״̬
-             p_tcb->PendStatus = OS_STATUS_PEND_ABORT;      //ĵȴֹ
-             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;   //Ŀǰûеȴκζ
-             break;                                         //
+             OS_TickListRemove(p_tcb);                      //让任务脱离节拍列表
+             p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;   //修改任务状态为挂起状态
+             p_tcb->PendStatus = OS_STATUS_PEND_ABORT;      //标记任务的等待被中止
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;   //标记任务目前没有等待任何对象
+             break;                                         //跳出
 
-        default:                                            //״̬Ԥ
-             break;                                         //账ֱ
+        default:                                            //如果任务状态超出预期
+             break;                                         //不需处理，直接跳出
     }
 }
 
@@ -1318,7 +1318,7 @@ void  OS_PendListChangePrio (OS_TCB   *p_tcb,
 
 void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 {
-    p_pend_list->HeadPtr    = (OS_PEND_DATA *)0;   //λȴбгԱ
+    p_pend_list->HeadPtr    = (OS_PEND_DATA *)0;   //复位等待列表的所有成员
     p_pend_list->TailPtr    = (OS_PEND_DATA *)0;
     p_pend_list->NbrEntries = (OS_OBJ_QTY    )0;
 }
@@ -1690,57 +1690,57 @@ void  OS_PendListRemove1 (OS_PEND_LIST  *p_pend_list,
 ************************************************************************************************************************
 */
 
-void  OS_PendObjDel (OS_PEND_OBJ  *p_obj,  //ɾ
-                     OS_TCB       *p_tcb,  //ƿָ
-                     CPU_TS        ts)     //źɾʱʱ
+void  OS_PendObjDel (OS_PEND_OBJ  *p_obj,  //被删除对象的类型
+                     OS_TCB       *p_tcb,  //任务控制块指针
+                     CPU_TS        ts)     //信号量被删除时的时间戳
 {
-    switch (p_tcb->TaskState) {                             //״̬ദ   
-        case OS_TASK_STATE_RDY:                             //Ǿ״̬
-        case OS_TASK_STATE_DLY:                             //ʱ״̬
-        case OS_TASK_STATE_SUSPENDED:                       //ǹ״̬
-        case OS_TASK_STATE_DLY_SUSPENDED:                   //ʱб
-             break;                                         //Щȴ޹أֱ
-
-        case OS_TASK_STATE_PEND:                            //޵ȴ״̬
-        case OS_TASK_STATE_PEND_TIMEOUT:                    //޵ȴ״̬
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {  //ڵȴźϢ
-                 OS_PendObjDel1(p_obj,                      //ǿƽĳһĵȴ 
+    switch (p_tcb->TaskState) {                             //根据任务状态分类处理   
+        case OS_TASK_STATE_RDY:                             //如果任务是就绪状态
+        case OS_TASK_STATE_DLY:                             //如果任务是延时状态
+        case OS_TASK_STATE_SUSPENDED:                       //如果任务是挂起状态
+        case OS_TASK_STATE_DLY_SUSPENDED:                   //如果任务是在延时中被挂起
+             break;                                         //这些情况均与等待无关，直接跳出
+
+        case OS_TASK_STATE_PEND:                            //如果任务是无期限等待状态
+        case OS_TASK_STATE_PEND_TIMEOUT:                    //如果任务是有期限等待状态
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {  //如果任务在等待多个信号量或消息队列
+                 OS_PendObjDel1(p_obj,                      //强制解除任务对某一对象的等待 
                                 p_tcb,
                                 ts);
              }
-#if (OS_MSG_EN > 0u)                               //ʹлϢ
-             p_tcb->MsgPtr     = (void *)0;        //λϢ
+#if (OS_MSG_EN > 0u)                               //如果使能了任务队列或消息队列
+             p_tcb->MsgPtr     = (void *)0;        //清除（复位）任务的消息域
              p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
 #endif
-             p_tcb->TS         = ts;                      //ȴֹʱʱƿ
-             OS_PendListRemove(p_tcb);                    //еȴбƳ
-             OS_TaskRdy(p_tcb);                           //׼
-             p_tcb->TaskState  = OS_TASK_STATE_RDY;       //޸״̬Ϊ״̬
-             p_tcb->PendStatus = OS_STATUS_PEND_DEL;      //ĵȴɾ          
-             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING; //Ŀǰûеȴκζ
-             break;                                       //
-
-        case OS_TASK_STATE_PEND_SUSPENDED:                //޵ȴб
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:        //޵ȴб
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {//ڵȴźϢ
-                 OS_PendObjDel1(p_obj,                    //ǿƽĳһĵȴ
+             p_tcb->TS         = ts;                      //保存等待被中止时的时间戳到任务控制块
+             OS_PendListRemove(p_tcb);                    //将任务从所有等待列表中移除
+             OS_TaskRdy(p_tcb);                           //让任务进准备运行
+             p_tcb->TaskState  = OS_TASK_STATE_RDY;       //修改任务状态为就绪状态
+             p_tcb->PendStatus = OS_STATUS_PEND_DEL;      //标记任务的等待对象被删除          
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING; //标记任务目前没有等待任何对象
+             break;                                       //跳出
+
+        case OS_TASK_STATE_PEND_SUSPENDED:                //如果任务在无期限等待中被挂起
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:        //如果任务在有期限等待中被挂起
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {//如果任务在等待多个信号量或消息队列
+                 OS_PendObjDel1(p_obj,                    //强制解除任务对某一对象的等待
                                 p_tcb,
                                 ts);
              }
-#if (OS_MSG_EN > 0u)                              //ʹлϢ
-             p_tcb->MsgPtr     = (void      *)0;  //λϢ
+#if (OS_MSG_EN > 0u)                              //如果使能了任务队列或消息队列
+             p_tcb->MsgPtr     = (void      *)0;  //清除（复位）任务的消息域
              p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
 #endif
-             p_tcb->TS         = ts;                       //ȴֹʱʱƿ
-             OS_TickListRemove(p_tcb);                     //б 
-             OS_PendListRemove(p_tcb);                     //еȴбƳ
-             p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;  //޸״̬Ϊ״̬
-             p_tcb->PendStatus = OS_STATUS_PEND_DEL;       //ĵȴɾ    
-             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;  //Ŀǰûеȴκζ
-             break;                                        //
+             p_tcb->TS         = ts;                       //保存等待被中止时的时间戳到任务控制块
+             OS_TickListRemove(p_tcb);                     //让任务脱离节拍列表 
+             OS_PendListRemove(p_tcb);                     //将任务从所有等待列表中移除
+             p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;  //修改任务状态为挂起状态
+             p_tcb->PendStatus = OS_STATUS_PEND_DEL;       //标记任务的等待对象被删除    
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;  //标记任务目前没有等待任何对象
+             break;                                        //跳出
 
-        default:                                           //״̬Ԥ
-             break;                                        //账ֱ
+        default:                                           //如果任务状态超出预期
+             break;                                        //不需处理，直接跳出
     }
 }
 
@@ -1841,77 +1841,77 @@ void  OS_PendObjDel1 (OS_PEND_OBJ  *p_obj,
 ************************************************************************************************************************
 */
 
-void  OS_Post (OS_PEND_OBJ  *p_obj,     //ں˶ָ
-               OS_TCB       *p_tcb,     //ƿ
-               void         *p_void,    //Ϣ
-               OS_MSG_SIZE   msg_size,  //ϢС
-               CPU_TS        ts)        //ʱ
+void  OS_Post (OS_PEND_OBJ  *p_obj,     //内核对象类型指针
+               OS_TCB       *p_tcb,     //任务控制块
+               void         *p_void,    //消息
+               OS_MSG_SIZE   msg_size,  //消息大小
+               CPU_TS        ts)        //时间戳
 {
-    switch (p_tcb->TaskState) {                               //״̬ദ
-        case OS_TASK_STATE_RDY:                               //ھ״̬
-        case OS_TASK_STATE_DLY:                               //ʱ״̬
-        case OS_TASK_STATE_SUSPENDED:                         //ڹ״̬
-        case OS_TASK_STATE_DLY_SUSPENDED:                     //ʱб״̬
-             break;                                           //ôֱ
-
-        case OS_TASK_STATE_PEND:                              //޵ȴ״̬
-        case OS_TASK_STATE_PEND_TIMEOUT:                      //޵ȴ״̬
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {    //ڵȴźϢ
-                 OS_Post1(p_obj,                              //ĸں˶󱻷
+    switch (p_tcb->TaskState) {                               //根据任务状态分类处理
+        case OS_TASK_STATE_RDY:                               //如果任务处于就绪状态
+        case OS_TASK_STATE_DLY:                               //如果任务处于延时状态
+        case OS_TASK_STATE_SUSPENDED:                         //如果任务处于挂起状态
+        case OS_TASK_STATE_DLY_SUSPENDED:                     //如果任务处于延时中被挂起状态
+             break;                                           //不用处理，直接跳出
+
+        case OS_TASK_STATE_PEND:                              //如果任务处于无期限等待状态
+        case OS_TASK_STATE_PEND_TIMEOUT:                      //如果任务处于有期限等待状态
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {    //如果任务在等待多个信号量或消息队列
+                 OS_Post1(p_obj,                              //标记哪个内核对象被发布
                           p_tcb,
                           p_void,
                           msg_size,
                           ts);
-             } else {                                         //ڵȴźϢ
-#if (OS_MSG_EN > 0u)                                          //ʹлϢ
-                 p_tcb->MsgPtr  = p_void;                     //Ϣȴ
+             } else {                                         //如果任务不是在等待多个信号量或消息队列
+#if (OS_MSG_EN > 0u)                                          //如果使能了任务队列或消息队列
+                 p_tcb->MsgPtr  = p_void;                     //保存消息到等待任务
                  p_tcb->MsgSize = msg_size;                   
 #endif
-                 p_tcb->TS      = ts;                         //ʱȴ
+                 p_tcb->TS      = ts;                         //保存时间戳到等待任务
              }
-             if (p_obj != (OS_PEND_OBJ *)0) {                 //ں˶Ϊ
-                 OS_PendListRemove(p_tcb);                    //ӵȴбƳõȴ
-#if OS_CFG_DBG_EN > 0u                                        //ʹ˵Դͱ 
-                 OS_PendDbgNameRemove(p_obj,                  //Ƴں˶ĵ
+             if (p_obj != (OS_PEND_OBJ *)0) {                 //如果内核对象为空
+                 OS_PendListRemove(p_tcb);                    //从等待列表移除该等待任务
+#if OS_CFG_DBG_EN > 0u                                        //如果使能了调试代码和变量 
+                 OS_PendDbgNameRemove(p_obj,                  //移除内核对象的调试名
                                       p_tcb);
 #endif
              }
-             OS_TaskRdy(p_tcb);                               //øõȴ׼
-             p_tcb->TaskState  = OS_TASK_STATE_RDY;           //״̬Ϊ״̬
-             p_tcb->PendStatus = OS_STATUS_PEND_OK;           //ȴ״̬
-             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;     //ǲٵȴ
+             OS_TaskRdy(p_tcb);                               //让该等待任务准备运行
+             p_tcb->TaskState  = OS_TASK_STATE_RDY;           //任务状态改为就绪状态
+             p_tcb->PendStatus = OS_STATUS_PEND_OK;           //清除等待状态
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;     //标记不再等待
              break;
 
-        case OS_TASK_STATE_PEND_SUSPENDED:                    //޵ȴб
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:            //޵ȴб
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {    //ڵȴźϢ
-                 OS_Post1(p_obj,                              //ĸں˶󱻷
+        case OS_TASK_STATE_PEND_SUSPENDED:                    //如果任务在无期限等待中被挂起
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:            //如果任务在有期限等待中被挂起
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {    //如果任务在等待多个信号量或消息队列
+                 OS_Post1(p_obj,                              //标记哪个内核对象被发布
                           p_tcb,
                           p_void,
                           msg_size,
                           ts);
-             } else {                                         //ڵȴźϢ
-#if (OS_MSG_EN > 0u)                                          //ʹ˵Դͱ
-                 p_tcb->MsgPtr  = p_void;                     //Ϣȴ
+             } else {                                         //如果任务不在等待多个信号量或消息队列
+#if (OS_MSG_EN > 0u)                                          //如果使能了调试代码和变量
+                 p_tcb->MsgPtr  = p_void;                     //保存消息到等待任务
                  p_tcb->MsgSize = msg_size;                     
 #endif
-                 p_tcb->TS      = ts;                         //ʱȴ
+                 p_tcb->TS      = ts;                         //保存时间戳到等待任务
              }
-             OS_TickListRemove(p_tcb);                        //ӽбƳõȴ
-             if (p_obj != (OS_PEND_OBJ *)0) {                 //ں˶Ϊ
-                 OS_PendListRemove(p_tcb);                    //ӵȴбƳõȴ
-#if OS_CFG_DBG_EN > 0u                                        //ʹ˵Դͱ 
-                 OS_PendDbgNameRemove(p_obj,                  //Ƴں˶ĵ
+             OS_TickListRemove(p_tcb);                        //从节拍列表移除该等待任务
+             if (p_obj != (OS_PEND_OBJ *)0) {                 //如果内核对象为空
+                 OS_PendListRemove(p_tcb);                    //从等待列表移除该等待任务
+#if OS_CFG_DBG_EN > 0u                                        //如果使能了调试代码和变量 
+                 OS_PendDbgNameRemove(p_obj,                  //移除内核对象的调试名
                                       p_tcb);
 #endif
              }
-             p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;     //״̬Ϊ״̬
-             p_tcb->PendStatus = OS_STATUS_PEND_OK;           //ȴ״̬
-             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;     //ǲٵȴ
+             p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;     //任务状态改为被挂起状态
+             p_tcb->PendStatus = OS_STATUS_PEND_OK;           //清除等待状态
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;     //标记不再等待
              break;
 
-        default:                                              //״̬Ԥ
-             break;                                           //ֱ
+        default:                                              //如果任务状态超出预期
+             break;                                           //直接跳出
     }
 }
 
@@ -67,57 +67,57 @@ const  CPU_CHAR  *os_flag__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-void  OSFlagCreate (OS_FLAG_GRP  *p_grp,  //¼־ָ
-                    CPU_CHAR     *p_name, //¼־
-                    OS_FLAGS      flags,  //־ʼֵ
-                    OS_ERR       *p_err)  //ش
+void  OSFlagCreate (OS_FLAG_GRP  *p_grp,  //事件标志组指针
+                    CPU_CHAR     *p_name, //命名事件标志组
+                    OS_FLAGS      flags,  //标志初始值
+                    OS_ERR       *p_err)  //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
-
-#ifdef OS_SAFETY_CRITICAL               //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return;                         //أִֹͣ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
+
+#ifdef OS_SAFETY_CRITICAL               //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return;                         //返回，停止执行
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508               //ʹ˰ȫؼ
-    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //ڵOSSafetyCriticalStart()󴴽
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //ΪǷں˶
-        return;                                  //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL_IEC61508               //如果使能了安全关键
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //如果在调用OSSafetyCriticalStart()后创建
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //错误类型为“非法创建内核对象”
+        return;                                  //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_CREATE_ISR;             //Ϊжд
-        return;                                //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数是在中断中被调用
+       *p_err = OS_ERR_CREATE_ISR;             //错误类型为“在中断中创建对象”
+        return;                                //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u           //ʹ˲
-    if (p_grp == (OS_FLAG_GRP *)0) { // p_grp Ϊ                                      
-       *p_err = OS_ERR_OBJ_PTR_NULL; //ΪΪա
-        return;                      //أִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u           //如果使能了参数检测
+    if (p_grp == (OS_FLAG_GRP *)0) { //如果 p_grp 为空                                      
+       *p_err = OS_ERR_OBJ_PTR_NULL; //错误类型为“创建对象为空”
+        return;                      //返回，停止执行
     }
 #endif
 
-    OS_CRITICAL_ENTER();               //ٽ
-    p_grp->Type    = OS_OBJ_TYPE_FLAG; //ǴݽṹΪ¼־
-    p_grp->NamePtr = p_name;           //¼־
-    p_grp->Flags   = flags;            //ñ־ʼֵ
-    p_grp->TS      = (CPU_TS)0;        //¼־ʱ
-    OS_PendListInit(&p_grp->PendList); //ʼ¼־ĵȴб  
+    OS_CRITICAL_ENTER();               //进入临界段
+    p_grp->Type    = OS_OBJ_TYPE_FLAG; //标记创建对象数据结构为事件标志组
+    p_grp->NamePtr = p_name;           //标记事件标志组的名称
+    p_grp->Flags   = flags;            //设置标志初始值
+    p_grp->TS      = (CPU_TS)0;        //清零事件标志组的时间戳
+    OS_PendListInit(&p_grp->PendList); //初始化该事件标志组的等待列表  
 
-#if OS_CFG_DBG_EN > 0u                 //ʹ˵Դͱ
-    OS_FlagDbgListAdd(p_grp);          //ñ־ӵ¼־˫
+#if OS_CFG_DBG_EN > 0u                 //如果使能了调试代码和变量
+    OS_FlagDbgListAdd(p_grp);          //将该标志组添加到事件标志组双向调试链表
 #endif
-    OSFlagQty++;                       //¼־1
+    OSFlagQty++;                       //事件标志组个数加1
 
-    OS_CRITICAL_EXIT_NO_SCHED();       //˳ٽΣ޵ȣ
-   *p_err = OS_ERR_NONE;               //Ϊ޴
+    OS_CRITICAL_EXIT_NO_SCHED();       //退出临界段（无调度）
+   *p_err = OS_ERR_NONE;               //错误类型为“无错误”
 }
 
 /*$PAGE*/
@@ -152,10 +152,10 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,  //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_FLAG_DEL_EN > 0u                 //ʹ OSFlagDel() 
-OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp, //¼־ָ
-                       OS_OPT        opt,   //ѡ
-                       OS_ERR       *p_err) //ش
+#if OS_CFG_FLAG_DEL_EN > 0u                 //如果使能了 OSFlagDel() 函数
+OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp, //事件标志组指针
+                       OS_OPT        opt,   //选项
+                       OS_ERR       *p_err) //返回错误类型
 {
     OS_OBJ_QTY        cnt;
     OS_OBJ_QTY        nbr_tasks;
@@ -163,70 +163,70 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp, //
     OS_PEND_LIST     *p_pend_list;
     OS_TCB           *p_tcb;
     CPU_TS            ts;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
-
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_OBJ_QTY)0);         //0д󣩣ִֹͣ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
+
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_OBJ_QTY)0);         //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_DEL_ISR;                //Ϊжɾ
-        return ((OS_OBJ_QTY)0);                //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数在中断中被调用
+       *p_err = OS_ERR_DEL_ISR;                //错误类型为“在中断中删除对象”
+        return ((OS_OBJ_QTY)0);                //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                //ʹ˲
-    if (p_grp == (OS_FLAG_GRP *)0) {      // p_grp Ϊ 
-       *p_err  = OS_ERR_OBJ_PTR_NULL;     //ΪΪա
-        return ((OS_OBJ_QTY)0);           //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                //如果使能了参数检测
+    if (p_grp == (OS_FLAG_GRP *)0) {      //如果 p_grp 为空 
+       *p_err  = OS_ERR_OBJ_PTR_NULL;     //错误类型为“对象为空”
+        return ((OS_OBJ_QTY)0);           //返回0（有错误），停止执行
     }
-    switch (opt) {                        //ѡദ
-        case OS_OPT_DEL_NO_PEND:          //ѡԤ
+    switch (opt) {                        //根据选项分类处理
+        case OS_OPT_DEL_NO_PEND:          //如果选项在预期内
         case OS_OPT_DEL_ALWAYS:
-             break;                       //ֱ
+             break;                       //直接跳出
 
-        default:                          //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;  //ΪѡǷ
-             return ((OS_OBJ_QTY)0);      //0д󣩣ִֹͣ
+        default:                          //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;  //错误类型为“选项非法”
+             return ((OS_OBJ_QTY)0);      //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u           //ʹ˶ͼ
-    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {// p_grp ¼־
-       *p_err = OS_ERR_OBJ_TYPE;          //Ϊ
-        return ((OS_OBJ_QTY)0);           //0д󣩣ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u           //如果使能了对象类型检测
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {//如果 p_grp 不是事件标志组类型
+       *p_err = OS_ERR_OBJ_TYPE;          //错误类型为“对象类型有误”
+        return ((OS_OBJ_QTY)0);           //返回0（有错误），停止执行
     }
 #endif
-    OS_CRITICAL_ENTER();                         //ٽ
-    p_pend_list = &p_grp->PendList;              //ȡϢеĵȴб
-    cnt         = p_pend_list->NbrEntries;       //ȡȴöе
-    nbr_tasks   = cnt;                           //Ŀ
-    switch (opt) {                               //ѡദ
-        case OS_OPT_DEL_NO_PEND:                 //ֻûȴʱɾ
-             if (nbr_tasks == (OS_OBJ_QTY)0) {   //ûڵȴñ־
-#if OS_CFG_DBG_EN > 0u                           //ʹ˵Դͱ
-                 OS_FlagDbgListRemove(p_grp);    //ñ־ӱ־бƳ
+    OS_CRITICAL_ENTER();                         //进入临界段
+    p_pend_list = &p_grp->PendList;              //获取消息队列的等待列表
+    cnt         = p_pend_list->NbrEntries;       //获取等待该队列的任务数
+    nbr_tasks   = cnt;                           //按照任务数目逐个处理
+    switch (opt) {                               //根据选项分类处理
+        case OS_OPT_DEL_NO_PEND:                 //如果只在没任务等待时进行删除
+             if (nbr_tasks == (OS_OBJ_QTY)0) {   //如果没有任务在等待该标志组
+#if OS_CFG_DBG_EN > 0u                           //如果使能了调试代码和变量
+                 OS_FlagDbgListRemove(p_grp);    //将该标志组从标志组调试列表移除
 #endif
-                 OSFlagQty--;                    //־Ŀ1
-                 OS_FlagClr(p_grp);              //ñ־
+                 OSFlagQty--;                    //标志组数目减1
+                 OS_FlagClr(p_grp);              //清除该标志组的内容
 
-                 OS_CRITICAL_EXIT();             //˳ٽ
-                *p_err = OS_ERR_NONE;            //Ϊ޴
+                 OS_CRITICAL_EXIT();             //退出临界段
+                *p_err = OS_ERR_NONE;            //错误类型为“无错误”
              } else {
-                 OS_CRITICAL_EXIT();             //˳ٽ
-                *p_err = OS_ERR_TASK_WAITING;    //Ϊڵȴ־顱
+                 OS_CRITICAL_EXIT();             //退出临界段
+                *p_err = OS_ERR_TASK_WAITING;    //错误类型为“有任务在等待标志组”
              }
-             break;                              //
+             break;                              //跳出
 
-        case OS_OPT_DEL_ALWAYS:                  //ɾ־
-             ts = OS_TS_GET();                   //ȡʱ
-             while (cnt > 0u) {                  //Ƴñ־ȴбе
+        case OS_OPT_DEL_ALWAYS:                  //如果必须删除标志组
+             ts = OS_TS_GET();                   //获取时间戳
+             while (cnt > 0u) {                  //逐个移除该标志组等待列表中的任务
                  p_pend_data = p_pend_list->HeadPtr;
                  p_tcb       = p_pend_data->TCBPtr;
                  OS_PendObjDel((OS_PEND_OBJ *)((void *)p_grp),
@@ -234,22 +234,22 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp, //
                                ts);
                  cnt--;
              }
-#if OS_CFG_DBG_EN > 0u                           //ʹ˵Դͱ 
-             OS_FlagDbgListRemove(p_grp);        //ñ־ӱ־бƳ
+#if OS_CFG_DBG_EN > 0u                           //如果使能了调试代码和变量 
+             OS_FlagDbgListRemove(p_grp);        //将该标志组从标志组调试列表移除
 #endif
-             OSFlagQty--;                        //־Ŀ1
-             OS_FlagClr(p_grp);                  //ñ־
-             OS_CRITICAL_EXIT_NO_SCHED();        //˳ٽΣ޵ȣ
-             OSSched();                          //
-            *p_err = OS_ERR_NONE;                //Ϊ޴
-             break;                              //
-
-        default:                                 //ѡԤ
-             OS_CRITICAL_EXIT();                 //˳ٽ
-            *p_err = OS_ERR_OPT_INVALID;         //ΪѡǷ
-             break;                              //
+             OSFlagQty--;                        //标志组数目减1
+             OS_FlagClr(p_grp);                  //清除该标志组的内容
+             OS_CRITICAL_EXIT_NO_SCHED();        //退出临界段（无调度）
+             OSSched();                          //调度任务
+            *p_err = OS_ERR_NONE;                //错误类型为“无错误”
+             break;                              //跳出
+
+        default:                                 //如果选项超出预期
+             OS_CRITICAL_EXIT();                 //退出临界段
+            *p_err = OS_ERR_OPT_INVALID;         //错误类型为“选项非法”
+             break;                              //跳出
     }
-    return (nbr_tasks);                          //ɾ־ǰȴ
+    return (nbr_tasks);                          //返回删除标志组前等待其的任务数
 }
 #endif
 
@@ -312,42 +312,42 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp, //
 ************************************************************************************************************************
 */
 
-OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,   //¼־ָ
-                      OS_FLAGS      flags,   //ѡҪı־λ
-                      OS_TICK       timeout, //ȴޣλʱӽģ
-                      OS_OPT        opt,     //ѡ
-                      CPU_TS       *p_ts,    //صȵ¼־ʱʱ
-                      OS_ERR       *p_err)   //ش
+OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,   //事件标志组指针
+                      OS_FLAGS      flags,   //选定要操作的标志位
+                      OS_TICK       timeout, //等待期限（单位：时钟节拍）
+                      OS_OPT        opt,     //选项
+                      CPU_TS       *p_ts,    //返回等到事件标志时的时间戳
+                      OS_ERR       *p_err)   //返回错误类型
 {
     CPU_BOOLEAN   consume;
     OS_FLAGS      flags_rdy;
     OS_OPT        mode;
     OS_PEND_DATA  pend_data;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
-
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_FLAGS)0);           //0д󣩣ִֹͣ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
+
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_FLAGS)0);           //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_PEND_ISR;                //Ϊжֹȴ
-        return ((OS_FLAGS)0);                   //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_PEND_ISR;                //错误类型为“在中断中中止等待”
+        return ((OS_FLAGS)0);                   //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u               //ʹ˲
-    if (p_grp == (OS_FLAG_GRP *)0) {     // p_grp Ϊ
-       *p_err = OS_ERR_OBJ_PTR_NULL;     //ΪΪա
-        return ((OS_FLAGS)0);            //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u               //如果使能了参数检测
+    if (p_grp == (OS_FLAG_GRP *)0) {     //如果 p_grp 为空
+       *p_err = OS_ERR_OBJ_PTR_NULL;     //错误类型为“对象为空”
+        return ((OS_FLAGS)0);            //返回0（有错误），停止执行
     }
-    switch (opt) {                       //ѡദ
-        case OS_OPT_PEND_FLAG_CLR_ALL:   //ѡԤ
+    switch (opt) {                       //根据选项分类处理
+        case OS_OPT_PEND_FLAG_CLR_ALL:   //如果选项在预期内
         case OS_OPT_PEND_FLAG_CLR_ANY:
         case OS_OPT_PEND_FLAG_SET_ALL:
         case OS_OPT_PEND_FLAG_SET_ANY:
@@ -363,253 +363,253 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,   //
         case OS_OPT_PEND_FLAG_CLR_ANY | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING:
         case OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING:
         case OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING:
-             break;                     //ֱ
+             break;                     //直接跳出
 
-        default:                        //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;//ΪѡǷ
-             return ((OS_OBJ_QTY)0);    //0д󣩣ִֹͣ
+        default:                        //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;//错误类型为“选项非法”
+             return ((OS_OBJ_QTY)0);    //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //ʹ˶ͼ
-    if (p_grp->Type != OS_OBJ_TYPE_FLAG) { // p_grp ¼־ 
-       *p_err = OS_ERR_OBJ_TYPE;           //Ϊ
-        return ((OS_FLAGS)0);              //0д󣩣ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //如果使能了对象类型检测
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG) { //如果 p_grp 不是事件标志组类型 
+       *p_err = OS_ERR_OBJ_TYPE;           //错误类型为“对象类型有误”
+        return ((OS_FLAGS)0);              //返回0（有错误），停止执行
     }
 #endif
 
-    if ((opt & OS_OPT_PEND_FLAG_CONSUME) != (OS_OPT)0) { //ѡ˱־λƥԶȡ
+    if ((opt & OS_OPT_PEND_FLAG_CONSUME) != (OS_OPT)0) { //选择了标志位匹配后自动取反
         consume = DEF_TRUE;
-    } else {                                             //δѡ־λƥԶȡ
+    } else {                                             //未选择标志位匹配后自动取反
         consume = DEF_FALSE;
     }
 
-    if (p_ts != (CPU_TS *)0) {      // p_ts ǿ
-       *p_ts = (CPU_TS)0;           //ʼ㣩p_tsڷʱ
+    if (p_ts != (CPU_TS *)0) {      //如果 p_ts 非空
+       *p_ts = (CPU_TS)0;           //初始化（清零）p_ts，待用于返回时间戳
     }
 
-    mode = opt & OS_OPT_PEND_FLAG_MASK;                    //ѡȡԱ־λҪ
-    CPU_CRITICAL_ENTER();                                  //ж
-    switch (mode) {                                        //¼ģʽദ
-        case OS_OPT_PEND_FLAG_SET_ALL:                     //Ҫб־λҪ1
-             flags_rdy = (OS_FLAGS)(p_grp->Flags & flags); //ȡҪı־λֵ
-             if (flags_rdy == flags) {                     //ֵֵƥ
-                 if (consume == DEF_TRUE) {                //Ҫ󽫱־λƥȡ
-                     p_grp->Flags &= ~flags_rdy;           //0־ر־λ
+    mode = opt & OS_OPT_PEND_FLAG_MASK;                    //从选项中提取对标志位的要求
+    CPU_CRITICAL_ENTER();                                  //关中断
+    switch (mode) {                                        //根据事件触发模式分类处理
+        case OS_OPT_PEND_FLAG_SET_ALL:                     //如果要求所有标志位均要置1
+             flags_rdy = (OS_FLAGS)(p_grp->Flags & flags); //提取想要的标志位的值
+             if (flags_rdy == flags) {                     //如果该值与期望值匹配
+                 if (consume == DEF_TRUE) {                //如果要求将标志位匹配后取反
+                     p_grp->Flags &= ~flags_rdy;           //清0标志组的相关标志位
                  }
-                 OSTCBCurPtr->FlagsRdy = flags_rdy;        //ȴı־ֵ
-                 if (p_ts != (CPU_TS *)0) {                // p_ts ǿ
-                    *p_ts  = p_grp->TS;                    //ȡȵ־ʱʱ
+                 OSTCBCurPtr->FlagsRdy = flags_rdy;        //保存让任务脱离等待的标志值
+                 if (p_ts != (CPU_TS *)0) {                //如果 p_ts 非空
+                    *p_ts  = p_grp->TS;                    //获取任务等到标志组时的时间戳
                  }
-                 CPU_CRITICAL_EXIT();                      //ж        
-                *p_err = OS_ERR_NONE;                      //Ϊ޴
-                 return (flags_rdy);                       //ȴı־ֵ
-             } else {                                      //Ҫ־λֵֵƥ                  
-                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //ѡ˲
-                     CPU_CRITICAL_EXIT();                  //ж
-                    *p_err = OS_ERR_PEND_WOULD_BLOCK;      //Ϊ  
-                     return ((OS_FLAGS)0);                 //0д󣩣ִֹͣ
-                 } else {                                  //ѡ˶
-                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //
-                         CPU_CRITICAL_EXIT();              //ж
-                        *p_err = OS_ERR_SCHED_LOCKED;      //Ϊ
-                         return ((OS_FLAGS)0);             //0д󣩣ִֹͣ
+                 CPU_CRITICAL_EXIT();                      //开中断        
+                *p_err = OS_ERR_NONE;                      //错误类型为“无错误”
+                 return (flags_rdy);                       //返回让任务脱离等待的标志值
+             } else {                                      //如果想要标志位的值与期望值不匹配                  
+                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //如果选择了不堵塞任务
+                     CPU_CRITICAL_EXIT();                  //关中断
+                    *p_err = OS_ERR_PEND_WOULD_BLOCK;      //错误类型为“渴求堵塞”  
+                     return ((OS_FLAGS)0);                 //返回0（有错误），停止执行
+                 } else {                                  //如果选择了堵塞任务
+                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //如果调度器被锁
+                         CPU_CRITICAL_EXIT();              //关中断
+                        *p_err = OS_ERR_SCHED_LOCKED;      //错误类型为“调度器被锁”
+                         return ((OS_FLAGS)0);             //返回0（有错误），停止执行
                      }
                  }
-                 /* δ */
-                 OS_CRITICAL_ENTER_CPU_EXIT();             //ٽΣؿж           
-                 OS_FlagBlock(&pend_data,                  //ǰ񣬵ȴ¼־
+                 /* 如果调度器未被锁 */
+                 OS_CRITICAL_ENTER_CPU_EXIT();             //进入临界段，重开中断           
+                 OS_FlagBlock(&pend_data,                  //阻塞当前运行任务，等待事件标志组
                               p_grp,
                               flags,
                               opt,
                               timeout);
-                 OS_CRITICAL_EXIT_NO_SCHED();              //˳ٽΣ޵ȣ
+                 OS_CRITICAL_EXIT_NO_SCHED();              //退出临界段（无调度）
              }
-             break;                                        //
+             break;                                        //跳出
 
-        case OS_OPT_PEND_FLAG_SET_ANY:                     //Ҫб־λ1
-             flags_rdy = (OS_FLAGS)(p_grp->Flags & flags); //ȡҪı־λֵ
-             if (flags_rdy != (OS_FLAGS)0) {               //λ1         
-                 if (consume == DEF_TRUE) {                //Ҫ󽫱־λƥȡ             
-                     p_grp->Flags &= ~flags_rdy;           //0ʪ־ر־λ          
+        case OS_OPT_PEND_FLAG_SET_ANY:                     //如果要求有标志位被置1即可
+             flags_rdy = (OS_FLAGS)(p_grp->Flags & flags); //提取想要的标志位的值
+             if (flags_rdy != (OS_FLAGS)0) {               //如果有位被置1         
+                 if (consume == DEF_TRUE) {                //如果要求将标志位匹配后取反             
+                     p_grp->Flags &= ~flags_rdy;           //清0湿巾标志组的相关标志位          
                  }
-                 OSTCBCurPtr->FlagsRdy = flags_rdy;        //ȴı־ֵ
-                 if (p_ts != (CPU_TS *)0) {                // p_ts ǿ
-                    *p_ts  = p_grp->TS;                    //ȡȵ־ʱʱ
+                 OSTCBCurPtr->FlagsRdy = flags_rdy;        //保存让任务脱离等待的标志值
+                 if (p_ts != (CPU_TS *)0) {                //如果 p_ts 非空
+                    *p_ts  = p_grp->TS;                    //获取任务等到标志组时的时间戳
                  }
-                 CPU_CRITICAL_EXIT();                      //ж                
-                *p_err = OS_ERR_NONE;                      //Ϊ޴
-                 return (flags_rdy);                       //ȴı־ֵ
-             } else {                                      //ûλ1                          
-                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //ûö
-                     CPU_CRITICAL_EXIT();                  //ж
-                    *p_err = OS_ERR_PEND_WOULD_BLOCK;      //Ϊ     
-                     return ((OS_FLAGS)0);                 //0д󣩣ִֹͣ
-                 } else {                                  //˶          
-                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //
-                         CPU_CRITICAL_EXIT();              //ж
-                        *p_err = OS_ERR_SCHED_LOCKED;      //Ϊ
-                         return ((OS_FLAGS)0);             //0д󣩣ִֹͣ
+                 CPU_CRITICAL_EXIT();                      //开中断                
+                *p_err = OS_ERR_NONE;                      //错误类型为“无错误”
+                 return (flags_rdy);                       //返回让任务脱离等待的标志值
+             } else {                                      //如果没有位被置1                          
+                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //如果没设置堵塞任务
+                     CPU_CRITICAL_EXIT();                  //关中断
+                    *p_err = OS_ERR_PEND_WOULD_BLOCK;      //错误类型为“渴求堵塞”     
+                     return ((OS_FLAGS)0);                 //返回0（有错误），停止执行
+                 } else {                                  //如果设置了堵塞任务          
+                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //如果调度器被锁
+                         CPU_CRITICAL_EXIT();              //关中断
+                        *p_err = OS_ERR_SCHED_LOCKED;      //错误类型为“调度器被锁”
+                         return ((OS_FLAGS)0);             //返回0（有错误），停止执行
                      }
                  }
-                 /* û */                                    
-                 OS_CRITICAL_ENTER_CPU_EXIT();             //ٽΣؿж             
-                 OS_FlagBlock(&pend_data,                  //ǰ񣬵ȴ¼־
+                 /* 如果调度器没被锁 */                                    
+                 OS_CRITICAL_ENTER_CPU_EXIT();             //进入临界段，重开中断             
+                 OS_FlagBlock(&pend_data,                  //阻塞当前运行任务，等待事件标志组
                               p_grp,
                               flags,
                               opt,
                               timeout);
-                 OS_CRITICAL_EXIT_NO_SCHED();              //˳жϣ޵ȣ
+                 OS_CRITICAL_EXIT_NO_SCHED();              //退出中断（无调度）
              }
-             break;                                        //
-
-#if OS_CFG_FLAG_MODE_CLR_EN > 0u                           //ʹ˱־λ0ģʽ
-        case OS_OPT_PEND_FLAG_CLR_ALL:                     //Ҫб־λҪ0
-             flags_rdy = (OS_FLAGS)(~p_grp->Flags & flags);//ȡҪı־λֵ
-             if (flags_rdy == flags) {                     //ֵֵƥ
-                 if (consume == DEF_TRUE) {                //Ҫ󽫱־λƥ0
-                     p_grp->Flags |= flags_rdy;            //1־ر־λ
+             break;                                        //跳出
+
+#if OS_CFG_FLAG_MODE_CLR_EN > 0u                           //如果使能了标志位清0触发模式
+        case OS_OPT_PEND_FLAG_CLR_ALL:                     //如果要求所有标志位均要清0
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & flags);//提取想要的标志位的值
+             if (flags_rdy == flags) {                     //如果该值与期望值匹配
+                 if (consume == DEF_TRUE) {                //如果要求将标志位匹配后清0
+                     p_grp->Flags |= flags_rdy;            //置1标志组的相关标志位
                  }
-                 OSTCBCurPtr->FlagsRdy = flags_rdy;        //ȴı־ֵ
-                 if (p_ts != (CPU_TS *)0) {                // p_ts ǿ
-                    *p_ts  = p_grp->TS;                    //ȡȵ־ʱʱ
+                 OSTCBCurPtr->FlagsRdy = flags_rdy;        //保存让任务脱离等待的标志值
+                 if (p_ts != (CPU_TS *)0) {                //如果 p_ts 非空
+                    *p_ts  = p_grp->TS;                    //获取任务等到标志组时的时间戳
                  }
-                 CPU_CRITICAL_EXIT();                      //ж
-                *p_err = OS_ERR_NONE;                      //Ϊ޴
-                 return (flags_rdy);                       //0д󣩣ִֹͣ
-             } else {                                      //Ҫ־λֵֵƥ
-                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //ѡ˲
-                     CPU_CRITICAL_EXIT();                  //ж
-                    *p_err = OS_ERR_PEND_WOULD_BLOCK;      //Ϊ
-                     return ((OS_FLAGS)0);                 //0д󣩣ִֹͣ
-                 } else {                                  //ѡ˶
-                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //
-                         CPU_CRITICAL_EXIT();              //ж           
-                        *p_err = OS_ERR_SCHED_LOCKED;      //Ϊ
-                         return ((OS_FLAGS)0);             //0д󣩣ִֹͣ
+                 CPU_CRITICAL_EXIT();                      //开中断
+                *p_err = OS_ERR_NONE;                      //错误类型为“无错误”
+                 return (flags_rdy);                       //返回0（有错误），停止执行
+             } else {                                      //如果想要标志位的值与期望值不匹配
+                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //如果选择了不堵塞任务
+                     CPU_CRITICAL_EXIT();                  //关中断
+                    *p_err = OS_ERR_PEND_WOULD_BLOCK;      //错误类型为“渴求堵塞”
+                     return ((OS_FLAGS)0);                 //返回0（有错误），停止执行
+                 } else {                                  //如果选择了堵塞任务
+                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //如果调度器被锁
+                         CPU_CRITICAL_EXIT();              //关中断           
+                        *p_err = OS_ERR_SCHED_LOCKED;      //错误类型为“调度器被锁”
+                         return ((OS_FLAGS)0);             //返回0（有错误），停止执行
                      }
                  }
-                 /* δ */                                          
-                 OS_CRITICAL_ENTER_CPU_EXIT();             //ٽΣؿж      
-                 OS_FlagBlock(&pend_data,                  //ǰ񣬵ȴ¼־
+                 /* 如果调度器未被锁 */                                          
+                 OS_CRITICAL_ENTER_CPU_EXIT();             //进入临界段，重开中断      
+                 OS_FlagBlock(&pend_data,                  //阻塞当前运行任务，等待事件标志组
                               p_grp,
                               flags,
                               opt,
                               timeout);
-                 OS_CRITICAL_EXIT_NO_SCHED();             //˳ٽΣ޵ȣ
+                 OS_CRITICAL_EXIT_NO_SCHED();             //退出临界段（无调度）
              }
-             break;                                       //
+             break;                                       //跳出
 
-        case OS_OPT_PEND_FLAG_CLR_ANY:                    //Ҫб־λ0
-             flags_rdy = (OS_FLAGS)(~p_grp->Flags & flags);//ȡҪı־λֵ
-             if (flags_rdy != (OS_FLAGS)0) {              //λ0
-                 if (consume == DEF_TRUE) {               //Ҫ󽫱־λƥȡ 
-                     p_grp->Flags |= flags_rdy;           //1ʪ־ر־λ  
+        case OS_OPT_PEND_FLAG_CLR_ANY:                    //如果要求有标志位被清0即可
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & flags);//提取想要的标志位的值
+             if (flags_rdy != (OS_FLAGS)0) {              //如果有位被清0
+                 if (consume == DEF_TRUE) {               //如果要求将标志位匹配后取反 
+                     p_grp->Flags |= flags_rdy;           //置1湿巾标志组的相关标志位  
                  }
-                 OSTCBCurPtr->FlagsRdy = flags_rdy;       //ȴı־ֵ 
-                 if (p_ts != (CPU_TS *)0) {               // p_ts ǿ
-                    *p_ts  = p_grp->TS;                   //ȡȵ־ʱʱ
+                 OSTCBCurPtr->FlagsRdy = flags_rdy;       //保存让任务脱离等待的标志值 
+                 if (p_ts != (CPU_TS *)0) {               //如果 p_ts 非空
+                    *p_ts  = p_grp->TS;                   //获取任务等到标志组时的时间戳
                  }
-                 CPU_CRITICAL_EXIT();                     //ж 
-                *p_err = OS_ERR_NONE;                     //Ϊ޴
-                 return (flags_rdy);                      //0д󣩣ִֹͣ
-             } else {                                     //ûλ0
-                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //ûö
-                     CPU_CRITICAL_EXIT();                 //ж
-                    *p_err = OS_ERR_PEND_WOULD_BLOCK;     //Ϊ
-                     return ((OS_FLAGS)0);                //0д󣩣ִֹͣ
-                 } else {                                 //˶  
-                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //
-                         CPU_CRITICAL_EXIT();             //ж
-                        *p_err = OS_ERR_SCHED_LOCKED;     //Ϊ
-                         return ((OS_FLAGS)0);            //0д󣩣ִֹͣ
+                 CPU_CRITICAL_EXIT();                     //开中断 
+                *p_err = OS_ERR_NONE;                     //错误类型为“无错误”
+                 return (flags_rdy);                      //返回0（有错误），停止执行
+             } else {                                     //如果没有位被清0
+                 if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //如果没设置堵塞任务
+                     CPU_CRITICAL_EXIT();                 //开中断
+                    *p_err = OS_ERR_PEND_WOULD_BLOCK;     //错误类型为“渴求堵塞”
+                     return ((OS_FLAGS)0);                //返回0（有错误），停止执行
+                 } else {                                 //如果设置了堵塞任务  
+                     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //如果调度器被锁
+                         CPU_CRITICAL_EXIT();             //开中断
+                        *p_err = OS_ERR_SCHED_LOCKED;     //错误类型为“调度器被锁”
+                         return ((OS_FLAGS)0);            //返回0（有错误），停止执行
                      }
                  }
-                 /* û */                                          
-                 OS_CRITICAL_ENTER_CPU_EXIT();            //ٽΣؿж
-                 OS_FlagBlock(&pend_data,                 //ǰ񣬵ȴ¼־
+                 /* 如果调度器没被锁 */                                          
+                 OS_CRITICAL_ENTER_CPU_EXIT();            //进入临界段，重开中断
+                 OS_FlagBlock(&pend_data,                 //阻塞当前运行任务，等待事件标志组
                               p_grp,
                               flags,
                               opt,
                               timeout);
-                 OS_CRITICAL_EXIT_NO_SCHED();             //˳жϣ޵ȣ
+                 OS_CRITICAL_EXIT_NO_SCHED();             //退出中断（无调度）
              }
-             break;                                       //
+             break;                                       //跳出
 #endif
 
-        default:                                          //Ҫ󳬳Ԥ
+        default:                                          //如果要求超出预期
              CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_OPT_INVALID;                  //ΪѡǷ
-             return ((OS_FLAGS)0);                        //0д󣩣ִֹͣ
+            *p_err = OS_ERR_OPT_INVALID;                  //错误类型为“选项非法”
+             return ((OS_FLAGS)0);                        //返回0（有错误），停止执行
     }
 
-    OSSched();                                            //
-    /* ȵ¼־Լ */
-    CPU_CRITICAL_ENTER();                                 //ж
-    switch (OSTCBCurPtr->PendStatus) {                    //ĵȴ״̬ദ
-        case OS_STATUS_PEND_OK:                           //ȵ¼־
-             if (p_ts != (CPU_TS *)0) {                   // p_ts ǿ
-                *p_ts  = OSTCBCurPtr->TS;                 //صȵ־ʱʱ
+    OSSched();                                            //任务调度
+    /* 任务等到了事件标志组后得以继续运行 */
+    CPU_CRITICAL_ENTER();                                 //关中断
+    switch (OSTCBCurPtr->PendStatus) {                    //根据运行任务的等待状态分类处理
+        case OS_STATUS_PEND_OK:                           //如果等到了事件标志组
+             if (p_ts != (CPU_TS *)0) {                   //如果 p_ts 非空
+                *p_ts  = OSTCBCurPtr->TS;                 //返回等到标志组时的时间戳
              }
-            *p_err = OS_ERR_NONE;                         //Ϊ޴
-             break;                                       //
+            *p_err = OS_ERR_NONE;                         //错误类型为“无错误”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_ABORT:                        //ȴֹ
-             if (p_ts != (CPU_TS *)0) {                   // p_ts ǿ
-                *p_ts  = OSTCBCurPtr->TS;                 //صȴֹʱʱ
+        case OS_STATUS_PEND_ABORT:                        //如果等待被中止
+             if (p_ts != (CPU_TS *)0) {                   //如果 p_ts 非空
+                *p_ts  = OSTCBCurPtr->TS;                 //返回等待被中止时的时间戳
              }
-             CPU_CRITICAL_EXIT();                         //ж
-            *p_err = OS_ERR_PEND_ABORT;                   //Ϊȴֹ
-             break;                                       //
+             CPU_CRITICAL_EXIT();                         //开中断
+            *p_err = OS_ERR_PEND_ABORT;                   //错误类型为“等待被中止”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_TIMEOUT:                      //ȴʱ
-             if (p_ts != (CPU_TS *)0) {                   // p_ts ǿ
-                *p_ts  = (CPU_TS  )0;                     // p_ts
+        case OS_STATUS_PEND_TIMEOUT:                      //如果等待超时
+             if (p_ts != (CPU_TS *)0) {                   //如果 p_ts 非空
+                *p_ts  = (CPU_TS  )0;                     //清零 p_ts
              }
-             CPU_CRITICAL_EXIT();                         //ж
-            *p_err = OS_ERR_TIMEOUT;                      //Ϊʱ
-             break;                                       //
+             CPU_CRITICAL_EXIT();                         //开中断
+            *p_err = OS_ERR_TIMEOUT;                      //错误类型为“超时”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_DEL:                          //ȴɾ
-             if (p_ts != (CPU_TS *)0) {                   // p_ts ǿ
-                *p_ts  = OSTCBCurPtr->TS;                 //ضɾʱʱ
+        case OS_STATUS_PEND_DEL:                          //如果等待对象被删除
+             if (p_ts != (CPU_TS *)0) {                   //如果 p_ts 非空
+                *p_ts  = OSTCBCurPtr->TS;                 //返回对象被删时的时间戳
              }
-             CPU_CRITICAL_EXIT();                         //ж
-            *p_err = OS_ERR_OBJ_DEL;                      //Ϊɾ
-             break;                                       //
-
-        default:                                          //ȴ״̬Ԥ
-             CPU_CRITICAL_EXIT();                         //ж
-            *p_err = OS_ERR_STATUS_INVALID;               //Ϊ״̬Ƿ
-             break;                                       //
+             CPU_CRITICAL_EXIT();                         //开中断
+            *p_err = OS_ERR_OBJ_DEL;                      //错误类型为“对象被删”
+             break;                                       //跳出
+
+        default:                                          //如果等待状态超出预期
+             CPU_CRITICAL_EXIT();                         //开中断
+            *p_err = OS_ERR_STATUS_INVALID;               //错误类型为“状态非法”
+             break;                                       //跳出
     }
-    if (*p_err != OS_ERR_NONE) {                          //д
-        return ((OS_FLAGS)0);                             //0д󣩣ִֹͣ
+    if (*p_err != OS_ERR_NONE) {                          //如果有错误存在
+        return ((OS_FLAGS)0);                             //返回0（有错误），停止执行
     }
-    /* ûд */
-    flags_rdy = OSTCBCurPtr->FlagsRdy;                    //ȡȴı־ֵ
-    if (consume == DEF_TRUE) {                            //Ҫȡ¼ı־λ
-        switch (mode) {                                   //¼ģʽദ
-            case OS_OPT_PEND_FLAG_SET_ALL:                //ͨ1־¼ķ
+    /* 如果没有错误存在 */
+    flags_rdy = OSTCBCurPtr->FlagsRdy;                    //读取让任务脱离等待的标志值
+    if (consume == DEF_TRUE) {                            //如果需要取反触发事件的标志位
+        switch (mode) {                                   //根据事件触发模式分类处理
+            case OS_OPT_PEND_FLAG_SET_ALL:                //如果是通过置1来标志事件的发生
             case OS_OPT_PEND_FLAG_SET_ANY:                                           
-                 p_grp->Flags &= ~flags_rdy;              //0־ﴥ¼ı־λ
-                 break;                                   //
+                 p_grp->Flags &= ~flags_rdy;              //清0标志组里触发事件的标志位
+                 break;                                   //跳出
 
-#if OS_CFG_FLAG_MODE_CLR_EN > 0u                          //ʹ˱־λ0ģʽ
-            case OS_OPT_PEND_FLAG_CLR_ALL:                //ͨ0־¼ķ
+#if OS_CFG_FLAG_MODE_CLR_EN > 0u                          //如果使能了标志位清0触发模式
+            case OS_OPT_PEND_FLAG_CLR_ALL:                //如果是通过清0来标志事件的发生
             case OS_OPT_PEND_FLAG_CLR_ANY:                 
-                 p_grp->Flags |=  flags_rdy;              //1־ﴥ¼ı־λ
-                 break;                                   //
+                 p_grp->Flags |=  flags_rdy;              //置1标志组里触发事件的标志位
+                 break;                                   //跳出
 #endif
-            default:                                      //ģʽԤ
-                 CPU_CRITICAL_EXIT();                     //ж
-                *p_err = OS_ERR_OPT_INVALID;              //ΪѡǷ
-                 return ((OS_FLAGS)0);                    //0д󣩣ִֹͣ
+            default:                                      //如果触发模式超出预期
+                 CPU_CRITICAL_EXIT();                     //开中断
+                *p_err = OS_ERR_OPT_INVALID;              //错误类型为“选项非法”
+                 return ((OS_FLAGS)0);                    //返回0（有错误），停止执行
         }
     }
-    CPU_CRITICAL_EXIT();                                  //ж
-   *p_err = OS_ERR_NONE;                                  //Ϊ޴
-    return (flags_rdy);                                   //ȴı־ֵ
+    CPU_CRITICAL_EXIT();                                  //开中断
+   *p_err = OS_ERR_NONE;                                  //错误类型为“无错误”
+    return (flags_rdy);                                   //返回让任务脱离等待的标志值
 }
 
 /*$PAGE*/
@@ -646,87 +646,87 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,   //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_FLAG_PEND_ABORT_EN > 0u                //ʹ OSFlagPendAbort() 
-OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp, //¼־ָ
-                             OS_OPT        opt,   //ѡ
-                             OS_ERR       *p_err) //ش
+#if OS_CFG_FLAG_PEND_ABORT_EN > 0u                //如果使能了 OSFlagPendAbort() 函数
+OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp, //事件标志组指针
+                             OS_OPT        opt,   //选项
+                             OS_ERR       *p_err) //返回错误类型
 {
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
     OS_OBJ_QTY     nbr_tasks;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
-
-#ifdef OS_SAFETY_CRITICAL                //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return ((OS_OBJ_QTY)0u);         //0д󣩣ִֹͣ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
+
+#ifdef OS_SAFETY_CRITICAL                //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return ((OS_OBJ_QTY)0u);         //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u           //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {  //úжб
-       *p_err = OS_ERR_PEND_ABORT_ISR;           //Ϊжд
-        return ((OS_OBJ_QTY)0u);                 //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u           //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {  //如果该函数是在中断中被调用
+       *p_err = OS_ERR_PEND_ABORT_ISR;           //错误类型为“在中断中创建对象”
+        return ((OS_OBJ_QTY)0u);                 //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                 //ʹ˲
-    if (p_grp == (OS_FLAG_GRP *)0) {       // p_grp Ϊ
-       *p_err  =  OS_ERR_OBJ_PTR_NULL;     //ΪΪա
-        return ((OS_OBJ_QTY)0u);           //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                 //如果使能了参数检测
+    if (p_grp == (OS_FLAG_GRP *)0) {       //如果 p_grp 为空
+       *p_err  =  OS_ERR_OBJ_PTR_NULL;     //错误类型为“创建对象为空”
+        return ((OS_OBJ_QTY)0u);           //返回0（有错误），停止执行
     }
-    switch (opt) {                         //ѡദ  
-        case OS_OPT_PEND_ABORT_1:          //ѡԤ
+    switch (opt) {                         //根据选项分类处理  
+        case OS_OPT_PEND_ABORT_1:          //如果选项在预期内
         case OS_OPT_PEND_ABORT_ALL:
         case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
         case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
-             break;                        //ֱ
+             break;                        //直接跳出
 
-        default:                           //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;   //ΪѡǷ
-             return ((OS_OBJ_QTY)0u);      //0д󣩣ִֹͣ
+        default:                           //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;   //错误类型为“选项非法”
+             return ((OS_OBJ_QTY)0u);      //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u              //ʹ˶ͼ
-    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {   // p_grp ¼־  
-       *p_err = OS_ERR_OBJ_TYPE;             //Ϊ 
-        return ((OS_OBJ_QTY)0u);             //0д󣩣ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u              //如果使能了对象类型检测
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {   //如果 p_grp 不是事件标志组类型  
+       *p_err = OS_ERR_OBJ_TYPE;             //错误类型为“对象类型有误” 
+        return ((OS_OBJ_QTY)0u);             //返回0（有错误），停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                            //ж
-    p_pend_list = &p_grp->PendList;                  //ȡϢеĵȴб
-    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0u) { //ûڵȴ
-        CPU_CRITICAL_EXIT();                         //ж
-       *p_err = OS_ERR_PEND_ABORT_NONE;              //Ϊûڵȴ
-        return ((OS_OBJ_QTY)0u);                     //0д󣩣ִֹͣ
+    CPU_CRITICAL_ENTER();                            //关中断
+    p_pend_list = &p_grp->PendList;                  //获取消息队列的等待列表
+    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0u) { //如果没有任务在等待
+        CPU_CRITICAL_EXIT();                         //开中断
+       *p_err = OS_ERR_PEND_ABORT_NONE;              //错误类型为“没任务在等待”
+        return ((OS_OBJ_QTY)0u);                     //返回0（有错误），停止执行
     }
-    /* ڵȴ */
-    OS_CRITICAL_ENTER_CPU_EXIT();                     //ٽΣؿж 
-    nbr_tasks = 0u;                                   //׼ֹĵȴ
-    ts        = OS_TS_GET();                          //ȡʱ
-    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0u) {//ڵȴ
-        p_tcb = p_pend_list->HeadPtr->TCBPtr;         //ȡͷˣȼ
-        OS_PendAbort((OS_PEND_OBJ *)((void *)p_grp),  //ֹ p_grp ĵȴ
+    /* 如果有任务在等待 */
+    OS_CRITICAL_ENTER_CPU_EXIT();                     //进入临界段，重开中断 
+    nbr_tasks = 0u;                                   //准备计数被中止的等待任务
+    ts        = OS_TS_GET();                          //获取时间戳
+    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0u) {//如果还有任务在等待
+        p_tcb = p_pend_list->HeadPtr->TCBPtr;         //获取头端（最高优先级）任务
+        OS_PendAbort((OS_PEND_OBJ *)((void *)p_grp),  //中止该任务对 p_grp 的等待
                      p_tcb,
                      ts);
         nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {           //ѡֹеȴ
-            break;                                    //ټֹ
+        if (opt != OS_OPT_PEND_ABORT_ALL) {           //如果不是选择了中止所有等待任务
+            break;                                    //立即跳出，不再继续中止
         }
     }
-    OS_CRITICAL_EXIT_NO_SCHED();                      //˳ٽΣ޵ȣ
+    OS_CRITICAL_EXIT_NO_SCHED();                      //退出临界段（无调度）
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) { //ѡ
-        OSSched();                                    //
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) { //如果选择了任务调度
+        OSSched();                                    //进行任务调度
     }
 
-   *p_err = OS_ERR_NONE;                              //Ϊ޴
-    return (nbr_tasks);                               //رֹĿ
+   *p_err = OS_ERR_NONE;                              //错误类型为“无错误”
+    return (nbr_tasks);                               //返回被中止的任务数目
 }
 #endif
 
@@ -817,52 +817,52 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp, //¼־ָ
-                      OS_FLAGS      flags, //ѡҪı־λ
-                      OS_OPT        opt,   //ѡ
-                      OS_ERR       *p_err) //ش
+OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp, //事件标志组指针
+                      OS_FLAGS      flags, //选定要操作的标志位
+                      OS_OPT        opt,   //选项
+                      OS_ERR       *p_err) //返回错误类型
 {
     OS_FLAGS  flags_cur;
     CPU_TS    ts;
 
 
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_FLAGS)0);           //0ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_FLAGS)0);           //返回0，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u               //ʹܣĬʹܣ˲
-    if (p_grp == (OS_FLAG_GRP *)0) {     // p_grp Ϊ 
-       *p_err  = OS_ERR_OBJ_PTR_NULL;    //Ϊ¼־Ϊա
-        return ((OS_FLAGS)0);            //0ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u               //如果使能（默认使能）了参数检测
+    if (p_grp == (OS_FLAG_GRP *)0) {     //如果参数 p_grp 为空 
+       *p_err  = OS_ERR_OBJ_PTR_NULL;    //错误类型为“事件标志组对象为空”
+        return ((OS_FLAGS)0);            //返回0，停止执行
     }
-    switch (opt) {                       //ѡദ
-        case OS_OPT_POST_FLAG_SET:       //ѡԤ֮
+    switch (opt) {                       //根据选项分类处理
+        case OS_OPT_POST_FLAG_SET:       //如果选项在预期之内
         case OS_OPT_POST_FLAG_CLR:
         case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
         case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
-             break;                      //ֱ
+             break;                      //直接跳出
 
-        default:                         //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID; //ΪѡǷ
-             return ((OS_FLAGS)0);       //0ִֹͣ
+        default:                         //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID; //错误类型为“选项非法”
+             return ((OS_FLAGS)0);       //返回0，停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //ʹ˶ͼ
-    if (p_grp->Type != OS_OBJ_TYPE_FLAG) { // p_grp ¼־
-       *p_err = OS_ERR_OBJ_TYPE;           //͡
-        return ((OS_FLAGS)0);              //0ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //如果使能了对象类型检测
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG) { //如果 p_grp 不是事件标志组类型
+       *p_err = OS_ERR_OBJ_TYPE;           //错误类型“对象类型有误”
+        return ((OS_FLAGS)0);              //返回0，停止执行
     }
 #endif
 
-    ts = OS_TS_GET();                             //ȡʱ              
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u              //ʹжӳٷ
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {    //úжб
-        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_FLAG,//ñ־鷢жϢ
+    ts = OS_TS_GET();                             //获取时间戳              
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u              //如果使能了中断延迟发布
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {    //如果该函数是在中断中被调用
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_FLAG,//将该标志组发布到中断消息队列
                     (void      *)p_grp,
                     (void      *)0,
                     (OS_MSG_SIZE)0,
@@ -870,17 +870,17 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp, //
                     (OS_OPT     )opt,
                     (CPU_TS     )ts,
                     (OS_ERR    *)p_err);
-        return ((OS_FLAGS)0);                     //0ִֹͣ
+        return ((OS_FLAGS)0);                     //返回0，停止执行
     }
 #endif
-    /* ûʹжӳٷ */
-    flags_cur = OS_FlagPost(p_grp,               //־ֱӷ
+    /* 如果没有使能中断延迟发布 */
+    flags_cur = OS_FlagPost(p_grp,               //将标志组直接发布
                             flags,
                             opt,
                             ts,
                             p_err);
 
-    return (flags_cur);                         //صǰ־λֵ
+    return (flags_cur);                         //返回当前标志位的值
 }
 
 /*$PAGE*/
@@ -920,17 +920,17 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp, //
 ************************************************************************************************************************
 */
 
-void  OS_FlagBlock (OS_PEND_DATA  *p_pend_data,  //ȴбԪ
-                    OS_FLAG_GRP   *p_grp,        //¼־
-                    OS_FLAGS       flags,        //Ҫı־λ
-                    OS_OPT         opt,          //ѡ
-                    OS_TICK        timeout)      //ȴ
+void  OS_FlagBlock (OS_PEND_DATA  *p_pend_data,  //等待列表元素
+                    OS_FLAG_GRP   *p_grp,        //事件标志组
+                    OS_FLAGS       flags,        //要操作的标志位
+                    OS_OPT         opt,          //选项
+                    OS_TICK        timeout)      //等待期限
 {
-    OSTCBCurPtr->FlagsPend = flags;          //Ҫȴı־λ              
-    OSTCBCurPtr->FlagsOpt  = opt;            //Ա־λҪ
+    OSTCBCurPtr->FlagsPend = flags;          //保存需要等待的标志位              
+    OSTCBCurPtr->FlagsOpt  = opt;            //保存对标志位的要求
     OSTCBCurPtr->FlagsRdy  = (OS_FLAGS)0;
 
-    OS_Pend(p_pend_data,                     //񣬵ȴ¼־
+    OS_Pend(p_pend_data,                     //阻塞任务，等待事件标志组
             (OS_PEND_OBJ *)((void *)p_grp),
              OS_TASK_PEND_ON_FLAG,
              timeout);
@@ -1017,18 +1017,18 @@ void  OS_FlagInit (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-#if OS_CFG_DBG_EN > 0u                        //ʹܣĬʹܣ˵Դͱ
-void  OS_FlagDbgListAdd (OS_FLAG_GRP  *p_grp) //¼־뵽¼־бǰ
+#if OS_CFG_DBG_EN > 0u                        //如果使能（默认使能）了调试代码和变量
+void  OS_FlagDbgListAdd (OS_FLAG_GRP  *p_grp) //将事件标志组插入到事件标志组调试列表的最前端
 {
-    p_grp->DbgNamePtr                = (CPU_CHAR    *)((void *)" "); //Ȳָκ
-    p_grp->DbgPrevPtr                = (OS_FLAG_GRP *)0;             //ñ־Ϊбǰ
-    if (OSFlagDbgListPtr == (OS_FLAG_GRP *)0) {                      //бΪ
-        p_grp->DbgNextPtr            = (OS_FLAG_GRP *)0;             //öеһԪҲΪ
-    } else {                                                         //бǿ
-        p_grp->DbgNextPtr            =  OSFlagDbgListPtr;            //бԭԪΪöеһԪ
-        OSFlagDbgListPtr->DbgPrevPtr =  p_grp;                       //ԭԪصǰΪ˸ö
+    p_grp->DbgNamePtr                = (CPU_CHAR    *)((void *)" "); //先不指向任何任务的名称
+    p_grp->DbgPrevPtr                = (OS_FLAG_GRP *)0;             //将该标志组作为列表的最前端
+    if (OSFlagDbgListPtr == (OS_FLAG_GRP *)0) {                      //如果列表为空
+        p_grp->DbgNextPtr            = (OS_FLAG_GRP *)0;             //该队列的下一个元素也为空
+    } else {                                                         //如果列表非空
+        p_grp->DbgNextPtr            =  OSFlagDbgListPtr;            //列表原来的首元素作为该队列的下一个元素
+        OSFlagDbgListPtr->DbgPrevPtr =  p_grp;                       //原来的首元素的前面变为了该队列
     }
-    OSFlagDbgListPtr                 =  p_grp;                       //ñ־ΪбԪ
+    OSFlagDbgListPtr                 =  p_grp;                       //该标志组成为列表的新首元素
 }
 
 
@@ -1106,11 +1106,11 @@ void  OS_FlagDbgListRemove (OS_FLAG_GRP  *p_grp)
 ************************************************************************************************************************
 */
 
-OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp, //¼־ָ
-                       OS_FLAGS      flags, //ѡҪı־λ
-                       OS_OPT        opt,   //ѡ
-                       CPU_TS        ts,    //ʱ
-                       OS_ERR       *p_err) //ش
+OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp, //事件标志组指针
+                       OS_FLAGS      flags, //选定要操作的标志位
+                       OS_OPT        opt,   //选项
+                       CPU_TS        ts,    //时间戳
+                       OS_ERR       *p_err) //返回错误类型
 {
     OS_FLAGS        flags_cur;
     OS_FLAGS        flags_rdy;
@@ -1119,102 +1119,102 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp, //
     OS_PEND_DATA   *p_pend_data_next;
     OS_PEND_LIST   *p_pend_list;
     OS_TCB         *p_tcb;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ 
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。 
 	
-    CPU_CRITICAL_ENTER();                                //ж
-    switch (opt) {                                       //ѡദ
-        case OS_OPT_POST_FLAG_SET:                       //Ҫѡλ1
+    CPU_CRITICAL_ENTER();                                //关中断
+    switch (opt) {                                       //根据选项分类处理
+        case OS_OPT_POST_FLAG_SET:                       //如果要求将选定位置1
         case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
-             p_grp->Flags |=  flags;                     //ѡλ1
-             break;                                      //
+             p_grp->Flags |=  flags;                     //将选定位置1
+             break;                                      //跳出
 
-        case OS_OPT_POST_FLAG_CLR:                       //Ҫѡλ0
+        case OS_OPT_POST_FLAG_CLR:                       //如果要求将选定位请0
         case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
-             p_grp->Flags &= ~flags;                     //ѡλ0
-             break;                                      //
+             p_grp->Flags &= ~flags;                     //将选定位请0
+             break;                                      //跳出
 
-        default:                                         //ѡԤ
-             CPU_CRITICAL_EXIT();                        //ж
-            *p_err = OS_ERR_OPT_INVALID;                 //ΪѡǷ
-             return ((OS_FLAGS)0);                       //0ִֹͣ
+        default:                                         //如果选项超出预期
+             CPU_CRITICAL_EXIT();                        //开中断
+            *p_err = OS_ERR_OPT_INVALID;                 //错误类型为“选项非法”
+             return ((OS_FLAGS)0);                       //返回0，停止执行
     }
-    p_grp->TS   = ts;                                    //ʱ¼־
-    p_pend_list = &p_grp->PendList;                      //ȡ¼־ĵȴб
-    if (p_pend_list->NbrEntries == 0u) {                 //ûڵȴ־
-        CPU_CRITICAL_EXIT();                             //ж
-       *p_err = OS_ERR_NONE;                             //Ϊ޴
-        return (p_grp->Flags);                           //¼־ı־ֵ
+    p_grp->TS   = ts;                                    //将时间戳存入事件标志组
+    p_pend_list = &p_grp->PendList;                      //获取事件标志组的等待列表
+    if (p_pend_list->NbrEntries == 0u) {                 //如果没有任务在等待标志组
+        CPU_CRITICAL_EXIT();                             //开中断
+       *p_err = OS_ERR_NONE;                             //错误类型为“无错误”
+        return (p_grp->Flags);                           //返回事件标志组的标志值
     }
-    /* ڵȴ־ */
-    OS_CRITICAL_ENTER_CPU_EXIT();                     //ٽΣؿж
-    p_pend_data = p_pend_list->HeadPtr;               //ȡȴбͷȴ
+    /* 如果有任务在等待标志组 */
+    OS_CRITICAL_ENTER_CPU_EXIT();                     //进入临界段，重开中断
+    p_pend_data = p_pend_list->HeadPtr;               //获取等待列表头个等待任务
     p_tcb       = p_pend_data->TCBPtr;
-    while (p_tcb != (OS_TCB *)0) {                    //ͷβȴб
+    while (p_tcb != (OS_TCB *)0) {                    //从头至尾遍历等待列表的所有任务
         p_pend_data_next = p_pend_data->NextPtr;
-        mode             = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK; //ȡı־ѡ
-        switch (mode) {                               //ı־ѡദ
-            case OS_OPT_PEND_FLAG_SET_ALL:            //Ҫȴı־λ1
+        mode             = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK; //获取任务的标志选项
+        switch (mode) {                               //根据任务的标志选项分类处理
+            case OS_OPT_PEND_FLAG_SET_ALL:            //如果要求任务等待的标志位都得置1
                  flags_rdy = (OS_FLAGS)(p_grp->Flags & p_tcb->FlagsPend); 
-                 if (flags_rdy == p_tcb->FlagsPend) { //ȴı־λ1
-                     OS_FlagTaskRdy(p_tcb,            //ø׼
+                 if (flags_rdy == p_tcb->FlagsPend) { //如果任务等待的标志位都置1了
+                     OS_FlagTaskRdy(p_tcb,            //让该任务准备运行
                                     flags_rdy,
                                     ts);
                  }
-                 break;                               //
+                 break;                               //跳出
 
-            case OS_OPT_PEND_FLAG_SET_ANY:            //Ҫȴı־λ1λ1
+            case OS_OPT_PEND_FLAG_SET_ANY:            //如果要求任务等待的标志位有1位置1即可
                  flags_rdy = (OS_FLAGS)(p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != (OS_FLAGS)0) {      //ȴı־λ1
-                     OS_FlagTaskRdy(p_tcb,            //ø׼
+                 if (flags_rdy != (OS_FLAGS)0) {      //如果任务等待的标志位有置1的
+                     OS_FlagTaskRdy(p_tcb,            //让该任务准备运行
                                     flags_rdy,
                                     ts);
                  }
-                 break;                              //
+                 break;                              //跳出
 
-#if OS_CFG_FLAG_MODE_CLR_EN > 0u                     //ʹ˱־λ0ģʽ
-            case OS_OPT_PEND_FLAG_CLR_ALL:           //Ҫȴı־λ0
+#if OS_CFG_FLAG_MODE_CLR_EN > 0u                     //如果使能了标志位清0触发模式
+            case OS_OPT_PEND_FLAG_CLR_ALL:           //如果要求任务等待的标志位都得请0
                  flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {//ȴı־λ0
-                     OS_FlagTaskRdy(p_tcb,           //ø׼
+                 if (flags_rdy == p_tcb->FlagsPend) {//如果任务等待的标志位都请0了
+                     OS_FlagTaskRdy(p_tcb,           //让该任务准备运行
                                     flags_rdy,
                                     ts);
                  }
-                 break;            //
+                 break;            //跳出
 
-            case OS_OPT_PEND_FLAG_CLR_ANY:          //Ҫȴı־λ1λ0
+            case OS_OPT_PEND_FLAG_CLR_ANY:          //如果要求任务等待的标志位有1位请0即可
                  flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != (OS_FLAGS)0) {    //ȴı־λ0
-                     OS_FlagTaskRdy(p_tcb,          //ø׼
+                 if (flags_rdy != (OS_FLAGS)0) {    //如果任务等待的标志位有请0的
+                     OS_FlagTaskRdy(p_tcb,          //让该任务准备运行
                                     flags_rdy,
                                     ts);
                  }
-                 break;                            //
+                 break;                            //跳出
 #endif
-            default:                               //־ѡԤ
-                 OS_CRITICAL_EXIT();               //˳ٽ
-                *p_err = OS_ERR_FLAG_PEND_OPT;     //Ϊ־ѡǷ
-                 return ((OS_FLAGS)0);             //0ֹͣ
+            default:                               //如果标志选项超出预期
+                 OS_CRITICAL_EXIT();               //退出临界段
+                *p_err = OS_ERR_FLAG_PEND_OPT;     //错误类型为“标志选项非法”
+                 return ((OS_FLAGS)0);             //返回0，停止运行
         }
-        p_pend_data = p_pend_data_next;            //׼һȴ
-        if (p_pend_data != (OS_PEND_DATA *)0) {    //
-            p_tcb = p_pend_data->TCBPtr;           //ȡƿ
-        } else {                                   //񲻴
-            p_tcb = (OS_TCB *)0;                   // p_tcb˳ while ѭ
+        p_pend_data = p_pend_data_next;            //准备处理下一个等待任务
+        if (p_pend_data != (OS_PEND_DATA *)0) {    //如果该任务存在
+            p_tcb = p_pend_data->TCBPtr;           //获取该任务的任务控制块
+        } else {                                   //如果该任务不存在
+            p_tcb = (OS_TCB *)0;                   //清空 p_tcb，退出 while 循环
         }
     }
-    OS_CRITICAL_EXIT_NO_SCHED();                  //˳ٽΣ޵ȣ
+    OS_CRITICAL_EXIT_NO_SCHED();                  //退出临界段（无调度）
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {  // opt ûѡ񡰷ʱ
-        OSSched();                                    //
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {  //如果 opt 没选择“发布时不调度任务”
+        OSSched();                                    //任务调度
     }
 
-    CPU_CRITICAL_ENTER();        //ж
-    flags_cur = p_grp->Flags;    //ȡ¼־ı־ֵ
-    CPU_CRITICAL_EXIT();         //ж
-   *p_err     = OS_ERR_NONE;     //Ϊ޴
-    return (flags_cur);          //¼־ĵǰ־ֵ
+    CPU_CRITICAL_ENTER();        //关中断
+    flags_cur = p_grp->Flags;    //获取事件标志组的标志值
+    CPU_CRITICAL_EXIT();         //开中断
+   *p_err     = OS_ERR_NONE;     //错误类型为“无错误”
+    return (flags_cur);          //返回事件标志组的当前标志值
 }
 
 /*$PAGE*/
@@ -1238,35 +1238,35 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp, //
 ************************************************************************************************************************
 */
 
-void   OS_FlagTaskRdy (OS_TCB    *p_tcb,            //ƿָ
-                       OS_FLAGS   flags_rdy,        //ı־λ    
-                       CPU_TS     ts)               //¼־鱻ʱʱ
+void   OS_FlagTaskRdy (OS_TCB    *p_tcb,            //任务控制块指针
+                       OS_FLAGS   flags_rdy,        //让任务就绪的标志位    
+                       CPU_TS     ts)               //事件标志组被发布时的时间戳
 {
-    p_tcb->FlagsRdy   = flags_rdy;                  //¼־λ
-    p_tcb->PendStatus = OS_STATUS_PEND_OK;          //ĵȴ״̬
-    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;    //ûеȴκζ
-    p_tcb->TS         = ts;                         //¼ȴʱʱ
-    switch (p_tcb->TaskState) {                     //״̬ദ
-        case OS_TASK_STATE_RDY:                     //Ǿ״̬
-        case OS_TASK_STATE_DLY:                     //ʱ״̬
-        case OS_TASK_STATE_DLY_SUSPENDED:           //ʱб״̬
-        case OS_TASK_STATE_SUSPENDED:               //Ǳ״̬
-             break;                                 //ֱ账
-
-        case OS_TASK_STATE_PEND:                    //޵ȴ״̬
-        case OS_TASK_STATE_PEND_TIMEOUT:            //޵ȴ״̬
-             OS_TaskRdy(p_tcb);                     //״̬
-             p_tcb->TaskState = OS_TASK_STATE_RDY;  //޸״̬Ϊ״̬
-             break;                                 //
-
-        case OS_TASK_STATE_PEND_SUSPENDED:              //޵ȴб״̬
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:      //޵ȴб״̬
-             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;//޸״̬Ϊ״̬
-             break;                                     //
-
-        default:                                        //״̬Ԥ
-             break;                                     //ֱ
+    p_tcb->FlagsRdy   = flags_rdy;                  //标记让任务就绪的事件标志位
+    p_tcb->PendStatus = OS_STATUS_PEND_OK;          //清除任务的等待状态
+    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;    //标记任务没有等待任何对象
+    p_tcb->TS         = ts;                         //记录任务脱离等待时的时间戳
+    switch (p_tcb->TaskState) {                     //根据任务的任务状态分类处理
+        case OS_TASK_STATE_RDY:                     //如果任务是就绪状态
+        case OS_TASK_STATE_DLY:                     //如果任务是延时状态
+        case OS_TASK_STATE_DLY_SUSPENDED:           //如果任务是延时中被挂起状态
+        case OS_TASK_STATE_SUSPENDED:               //如果任务是被挂起状态
+             break;                                 //直接跳出，不需处理
+
+        case OS_TASK_STATE_PEND:                    //如果任务是无期限等待状态
+        case OS_TASK_STATE_PEND_TIMEOUT:            //如果任务是有期限等待状态
+             OS_TaskRdy(p_tcb);                     //让任务进入就绪状态
+             p_tcb->TaskState = OS_TASK_STATE_RDY;  //修改任务的状态为就绪状态
+             break;                                 //跳出
+
+        case OS_TASK_STATE_PEND_SUSPENDED:              //如果任务是无期限等待中被挂起状态
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:      //如果任务是有期限等待中被挂起状态
+             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;//修改任务的状态为被挂起状态
+             break;                                     //跳出
+
+        default:                                        //如果任务状态超出预期
+             break;                                     //直接跳出
     }
-    OS_PendListRemove(p_tcb);                           //ӵȴбƳ       
+    OS_PendListRemove(p_tcb);                           //将任务从等待列表移除       
 }
 #endif
@@ -88,34 +88,34 @@ const  CPU_CHAR  *os_int__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-void  OS_IntQPost (OS_OBJ_TYPE   type,        //ں˶
-                   void         *p_obj,       //ں˶
-                   void         *p_void,      //ϢлϢ
-                   OS_MSG_SIZE   msg_size,    //ϢĿ
-                   OS_FLAGS      flags,       //¼־
-                   OS_OPT        opt,         //ں˶ʱѡ
-                   CPU_TS        ts,          //ں˶ʱʱ
-                   OS_ERR       *p_err)       //ش
+void  OS_IntQPost (OS_OBJ_TYPE   type,        //内核对象类型
+                   void         *p_obj,       //被发布的内核对象
+                   void         *p_void,      //消息队列或任务消息
+                   OS_MSG_SIZE   msg_size,    //消息的数目
+                   OS_FLAGS      flags,       //事件标志组
+                   OS_OPT        opt,         //发布内核对象时的选项
+                   CPU_TS        ts,          //发布内核对象时的时间戳
+                   OS_ERR       *p_err)       //返回错误类型
 {
-    CPU_SR_ALLOC();  //ʹõٽΣڹ/жʱʱú꣬úͶһֲ
-                     //ڱжǰ CPU ״̬Ĵ SRٽιжֻ豣SR
-                     //жʱֵԭ 
-
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return;                         //أִ
+    CPU_SR_ALLOC();  //使用到临界段（在关/开中断时）时必需该宏，该宏声明和定义一个局部变
+                     //量，用于保存关中断前的 CPU 状态寄存器 SR（临界段关中断只需保存SR）
+                     //，开中断时将该值还原。 
+
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return;                         //返回，不继续执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                                   //ж
-    if (OSIntQNbrEntries < OSCfg_IntQSize) {                //ж϶δռ     /* Make sure we haven't already filled the ISR queue      */
+    CPU_CRITICAL_ENTER();                                   //关中断
+    if (OSIntQNbrEntries < OSCfg_IntQSize) {                //如果中断队列未占满     /* Make sure we haven't already filled the ISR queue      */
         OSIntQNbrEntries++;
 
-        if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {       //ж϶еʹĿʷ¼
+        if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {       //更新中断队列的最大使用数目的历史记录
             OSIntQNbrEntriesMax = OSIntQNbrEntries;
         }
-        /* Ҫύں˶Ϣ뵽ж϶ڵϢ¼ */
+        /* 将要重新提交的内核对象的信息放入到中断队列入口的信息记录块 */
         OSIntQInPtr->Type       = type;                     /* Save object type being posted                          */
         OSIntQInPtr->ObjPtr     = p_obj;                    /* Save pointer to object being posted                    */
         OSIntQInPtr->MsgPtr     = p_void;                   /* Save pointer to message if posting to a message queue  */
@@ -124,22 +124,22 @@ void  OS_IntQPost (OS_OBJ_TYPE   type,        //
         OSIntQInPtr->Opt        = opt;                      /* Save post options                                      */
         OSIntQInPtr->TS         = ts;                       /* Save time stamp                                        */
 
-        OSIntQInPtr             =  OSIntQInPtr->NextPtr;    //ָһж϶
-        /* ж϶й OSIntQTask  */
-        OSRdyList[0].NbrEntries = (OS_OBJ_QTY)1;            //¾бϵȼ0Ϊ1 
-        OSRdyList[0].HeadPtr    = &OSIntQTaskTCB;           //þбͷָβָ붼ָ OSIntQTask 
+        OSIntQInPtr             =  OSIntQInPtr->NextPtr;    //指向下一个中断队列入口
+        /* 让中断队列管理任务 OSIntQTask 就绪 */
+        OSRdyList[0].NbrEntries = (OS_OBJ_QTY)1;            //更新就绪列表上的优先级0的任务数为1个 
+        OSRdyList[0].HeadPtr    = &OSIntQTaskTCB;           //该就绪列表的头指针和尾指针都指向 OSIntQTask 任务
         OSRdyList[0].TailPtr    = &OSIntQTaskTCB;
-        OS_PrioInsert(0u);                                  //ȼбȼ0
-        if (OSPrioCur != 0) {                               //ǰеĲ OSIntQTask 
-            OSPrioSaved         = OSPrioCur;                //浱ǰȼ
+        OS_PrioInsert(0u);                                  //在优先级列表中增加优先级0
+        if (OSPrioCur != 0) {                               //如果当前运行的不是 OSIntQTask 任务
+            OSPrioSaved         = OSPrioCur;                //保存当前任务的优先级
         }
 
-       *p_err                   = OS_ERR_NONE;              //شΪ޴
-    } else {                                                //ж϶ռ
-        OSIntQOvfCtr++;                                     //ж϶Ŀ1
-       *p_err                   = OS_ERR_INT_Q_FULL;        //شΪ޴
+       *p_err                   = OS_ERR_NONE;              //返回错误类型为“无错误”
+    } else {                                                //如果中断队列已占满
+        OSIntQOvfCtr++;                                     //中断队列溢出数目加1
+       *p_err                   = OS_ERR_INT_Q_FULL;        //返回错误类型为“无错误”
     }
-    CPU_CRITICAL_EXIT();                                    //ж
+    CPU_CRITICAL_EXIT();                                    //开中断
 }
 
 /*$PAGE*/
@@ -162,9 +162,9 @@ void  OS_IntQRePost (void)
     OS_ERR  err;
 
 
-    switch (OSIntQOutPtr->Type) {   //ں˶ͷദ
-        case OS_OBJ_TYPE_FLAG:      //¼־
-#if OS_CFG_FLAG_EN > 0u             //ʹ¼־򷢲¼־
+    switch (OSIntQOutPtr->Type) {   //根据内核对象类型分类处理
+        case OS_OBJ_TYPE_FLAG:      //如果对象类型是事件标志
+#if OS_CFG_FLAG_EN > 0u             //如果使能了事件标志，则发布事件标志
              (void)OS_FlagPost((OS_FLAG_GRP *) OSIntQOutPtr->ObjPtr,
                                (OS_FLAGS     ) OSIntQOutPtr->Flags,
                                (OS_OPT       ) OSIntQOutPtr->Opt,
@@ -173,8 +173,8 @@ void  OS_IntQRePost (void)
 #endif
              break;
 
-        case OS_OBJ_TYPE_Q:         //Ϣ
-#if OS_CFG_Q_EN > 0u                //ʹϢУ򷢲Ϣ
+        case OS_OBJ_TYPE_Q:         //如果对象类型是消息队列
+#if OS_CFG_Q_EN > 0u                //如果使能了消息队列，则发布消息队列
              OS_QPost((OS_Q      *) OSIntQOutPtr->ObjPtr,
                       (void      *) OSIntQOutPtr->MsgPtr,
                       (OS_MSG_SIZE) OSIntQOutPtr->MsgSize,
@@ -184,8 +184,8 @@ void  OS_IntQRePost (void)
 #endif
              break;
 
-        case OS_OBJ_TYPE_SEM:       //Ƕֵź
-#if OS_CFG_SEM_EN > 0u              //ʹ˶ֵź򷢲ֵź
+        case OS_OBJ_TYPE_SEM:       //如果对象类型是多值信号量
+#if OS_CFG_SEM_EN > 0u              //如果使能了多值信号量，则发布多值信号量
              (void)OS_SemPost((OS_SEM *) OSIntQOutPtr->ObjPtr,
                               (OS_OPT  ) OSIntQOutPtr->Opt,
                               (CPU_TS  ) OSIntQOutPtr->TS,
@@ -193,8 +193,8 @@ void  OS_IntQRePost (void)
 #endif
              break;
 
-        case OS_OBJ_TYPE_TASK_MSG:  //Ϣ
-#if OS_CFG_TASK_Q_EN > 0u           //ʹϢ򷢲Ϣ
+        case OS_OBJ_TYPE_TASK_MSG:  //如果对象类型是任务消息
+#if OS_CFG_TASK_Q_EN > 0u           //如果使能了任务消息，则发布任务消息
              OS_TaskQPost((OS_TCB    *) OSIntQOutPtr->ObjPtr,
                           (void      *) OSIntQOutPtr->MsgPtr,
                           (OS_MSG_SIZE) OSIntQOutPtr->MsgSize,
@@ -204,37 +204,37 @@ void  OS_IntQRePost (void)
 #endif
              break;
 
-        case OS_OBJ_TYPE_TASK_RESUME://ǻָ
-#if OS_CFG_TASK_SUSPEND_EN > 0u      //ʹ˺ OSTaskSuspend()  OSTaskResume()ָ
+        case OS_OBJ_TYPE_TASK_RESUME://如果对象类型是恢复任务
+#if OS_CFG_TASK_SUSPEND_EN > 0u      //如果使能了函数 OSTaskSuspend() 和 OSTaskResume()，则恢复该任务
              (void)OS_TaskResume((OS_TCB *) OSIntQOutPtr->ObjPtr,
                                  (OS_ERR *)&err);
 #endif
              break;
 
-        case OS_OBJ_TYPE_TASK_SIGNAL://ź
-             (void)OS_TaskSemPost((OS_TCB *) OSIntQOutPtr->ObjPtr,//ź
+        case OS_OBJ_TYPE_TASK_SIGNAL://如果对象类型是任务信号量
+             (void)OS_TaskSemPost((OS_TCB *) OSIntQOutPtr->ObjPtr,//发布任务信号量
                                   (OS_OPT  ) OSIntQOutPtr->Opt,
                                   (CPU_TS  ) OSIntQOutPtr->TS,
                                   (OS_ERR *)&err);
              break;
 
-        case OS_OBJ_TYPE_TASK_SUSPEND://ǹ
-#if OS_CFG_TASK_SUSPEND_EN > 0u       //ʹ˺ OSTaskSuspend()  OSTaskResume()
+        case OS_OBJ_TYPE_TASK_SUSPEND://如果对象类型是挂起任务
+#if OS_CFG_TASK_SUSPEND_EN > 0u       //如果使能了函数 OSTaskSuspend() 和 OSTaskResume()，则挂起该任务
              (void)OS_TaskSuspend((OS_TCB *) OSIntQOutPtr->ObjPtr,
                                   (OS_ERR *)&err);
 #endif
              break;
 
-        case OS_OBJ_TYPE_TICK:       //ʱӽ
-#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u //ʹʱƬתȣתȾеǰȼ
+        case OS_OBJ_TYPE_TICK:       //如果对象类型是时钟节拍
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u //如果使能了时间片轮转调度，则轮转调度具有当前优先级的任务
              OS_SchedRoundRobin(&OSRdyList[OSPrioSaved]);
 #endif
 
-             (void)OS_TaskSemPost((OS_TCB *)&OSTickTaskTCB,    //źʱӽ
+             (void)OS_TaskSemPost((OS_TCB *)&OSTickTaskTCB,    //发送信号量给时钟节拍任务
                                   (OS_OPT  ) OS_OPT_POST_NONE,
                                   (CPU_TS  ) OSIntQOutPtr->TS,
                                   (OS_ERR *)&err);
-#if OS_CFG_TMR_EN > 0u               //ʹʱźʱ
+#if OS_CFG_TMR_EN > 0u               //如果使能了软件定时器，发送信号量给定时器任务
              OSTmrUpdateCtr--;
              if (OSTmrUpdateCtr == (OS_CTR)0u) {
                  OSTmrUpdateCtr = OSTmrUpdateCnt;
@@ -276,30 +276,30 @@ void  OS_IntQTask (void  *p_arg)
 
 
     p_arg = p_arg;                                          /* Not using 'p_arg', prevent compiler warning            */
-    while (DEF_ON) {                                        //ѭ
+    while (DEF_ON) {                                        //进入死循环
         done = DEF_FALSE;
         while (done == DEF_FALSE) {
-            CPU_CRITICAL_ENTER();                           //ж
-            if (OSIntQNbrEntries == (OS_OBJ_QTY)0u) {       //ж϶ں˶󷢲
-                OSRdyList[0].NbrEntries = (OS_OBJ_QTY)0u;   //ӾбƳж϶й OS_IntQTask
+            CPU_CRITICAL_ENTER();                           //关中断
+            if (OSIntQNbrEntries == (OS_OBJ_QTY)0u) {       //如果中断队列里的内核对象发布完毕
+                OSRdyList[0].NbrEntries = (OS_OBJ_QTY)0u;   //从就绪列表移除中断队列管理任务 OS_IntQTask
                 OSRdyList[0].HeadPtr    = (OS_TCB   *)0;
                 OSRdyList[0].TailPtr    = (OS_TCB   *)0;
-                OS_PrioRemove(0u);                          //ȼƳȼ0
-                CPU_CRITICAL_EXIT();                        //ж
-                OSSched();                                  //
-                done = DEF_TRUE;                            //˳ѭ
-            } else {                                        //ж϶ﻹں˶
-                CPU_CRITICAL_EXIT();                        //ж
-                ts_start = OS_TS_GET();                     //ȡʱ
-                OS_IntQRePost();                            //ж϶ں˶
-                ts_end   = OS_TS_GET() - ts_start;          //ôηʱ
-                if (OSIntQTaskTimeMax < ts_end) {           //ж϶зں˶ʱʷ¼
+                OS_PrioRemove(0u);                          //从优先级表格移除优先级0
+                CPU_CRITICAL_EXIT();                        //开中断
+                OSSched();                                  //任务调度
+                done = DEF_TRUE;                            //退出循环
+            } else {                                        //如果中断队列里还有内核对象
+                CPU_CRITICAL_EXIT();                        //开中断
+                ts_start = OS_TS_GET();                     //获取时间戳
+                OS_IntQRePost();                            //发布中断队列里的内核对象
+                ts_end   = OS_TS_GET() - ts_start;          //计算该次发布时间
+                if (OSIntQTaskTimeMax < ts_end) {           //更新中断队列发布内核对象的最大时间的历史记录
                     OSIntQTaskTimeMax = ts_end;
                 }
-                CPU_CRITICAL_ENTER();                       //ж
-                OSIntQOutPtr = OSIntQOutPtr->NextPtr;       //ж϶гתһ
-                OSIntQNbrEntries--;                         //ж϶еĳԱĿ1
-                CPU_CRITICAL_EXIT();                        //ж
+                CPU_CRITICAL_ENTER();                       //关中断
+                OSIntQOutPtr = OSIntQOutPtr->NextPtr;       //中断队列出口转至下一个
+                OSIntQNbrEntries--;                         //中断队列的成员数目减1
+                CPU_CRITICAL_EXIT();                        //开中断
             }
         }
     }
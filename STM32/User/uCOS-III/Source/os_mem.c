@@ -72,12 +72,12 @@ const  CPU_CHAR  *os_mem__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-void  OSMemCreate (OS_MEM       *p_mem,    //ڴƿ
-                   CPU_CHAR     *p_name,   //ڴ
-                   void         *p_addr,   //ڴ׵ַ
-                   OS_MEM_QTY    n_blks,   //ڴĿ
-                   OS_MEM_SIZE   blk_size, //ڴСλֽڣ
-                   OS_ERR       *p_err)    //ش
+void  OSMemCreate (OS_MEM       *p_mem,    //内存分区控制块
+                   CPU_CHAR     *p_name,   //命名内存分区
+                   void         *p_addr,   //内存分区首地址
+                   OS_MEM_QTY    n_blks,   //内存块数目
+                   OS_MEM_SIZE   blk_size, //内存块大小（单位：字节）
+                   OS_ERR       *p_err)    //返回错误类型
 {
 #if OS_CFG_ARG_CHK_EN > 0u      
     CPU_DATA       align_msk;
@@ -85,85 +85,85 @@ void  OSMemCreate (OS_MEM       *p_mem,    //
     OS_MEM_QTY     i;
     OS_MEM_QTY     loops;
     CPU_INT08U    *p_blk;
-    void         **p_link;               //ָ룬ָָ
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    void         **p_link;               //二级指针，存放指针的指针
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return;                          //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return;                          //返回，停止执行
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508               //ʹ˰ȫؼ
-    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //ڵOSSafetyCriticalStart()󴴽
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //ΪǷں˶
-        return;                                  //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL_IEC61508               //如果使能了安全关键
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //如果在调用OSSafetyCriticalStart()后创建
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //错误类型为“非法创建内核对象”
+        return;                                  //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_MEM_CREATE_ISR;         //Ϊжд
-        return;                                //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数是在中断中被调用
+       *p_err = OS_ERR_MEM_CREATE_ISR;         //错误类型为“在中断中创建对象”
+        return;                                //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                             //ʹ˲
-    if (p_addr == (void *)0) {                         // p_addr Ϊ      
-       *p_err   = OS_ERR_MEM_INVALID_P_ADDR;           //ΪַǷ
-        return;                                        //أִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                             //如果使能了参数检测
+    if (p_addr == (void *)0) {                         //如果 p_addr 为空      
+       *p_err   = OS_ERR_MEM_INVALID_P_ADDR;           //错误类型为“分区地址非法”
+        return;                                        //返回，停止执行
     }
-    if (n_blks < (OS_MEM_QTY)2) {                      //ڴĿ2
-       *p_err = OS_ERR_MEM_INVALID_BLKS;               //ΪڴĿǷ
-        return;                                        //أִֹͣ
+    if (n_blks < (OS_MEM_QTY)2) {                      //如果分区的内存块数目少于2
+       *p_err = OS_ERR_MEM_INVALID_BLKS;               //错误类型为“内存块数目非法”
+        return;                                        //返回，停止执行
     }
-    if (blk_size < sizeof(void *)) {                   //ڴռСָ
-       *p_err = OS_ERR_MEM_INVALID_SIZE;               //ΪڴռǷ
-        return;                                        //أִֹͣ
+    if (blk_size < sizeof(void *)) {                   //如果内存块空间小于指针的
+       *p_err = OS_ERR_MEM_INVALID_SIZE;               //错误类型为“内存空间非法”
+        return;                                        //返回，停止执行
     }
-    align_msk = sizeof(void *) - 1u;                   //ʼڴַǷ
+    align_msk = sizeof(void *) - 1u;                   //开始检查内存地址是否对齐
     if (align_msk > 0u) {
-        if (((CPU_ADDR)p_addr & align_msk) != 0u){     //׵ַû
-           *p_err = OS_ERR_MEM_INVALID_P_ADDR;         //ΪַǷ
-            return;                                    //أִֹͣ
+        if (((CPU_ADDR)p_addr & align_msk) != 0u){     //如果分区首地址没对齐
+           *p_err = OS_ERR_MEM_INVALID_P_ADDR;         //错误类型为“分区地址非法”
+            return;                                    //返回，停止执行
         }
-        if ((blk_size & align_msk) != 0u) {            //ڴַû     
-           *p_err = OS_ERR_MEM_INVALID_SIZE;           //ΪڴСǷ
-            return;                                    //أִֹͣ
+        if ((blk_size & align_msk) != 0u) {            //如果内存块地址没对齐     
+           *p_err = OS_ERR_MEM_INVALID_SIZE;           //错误类型为“内存块大小非法”
+            return;                                    //返回，停止执行
         }
     }
 #endif
-    /* ڴ鴮һ */
-    p_link = (void **)p_addr;                          //ڴ׵ַתΪָ
-    p_blk  = (CPU_INT08U *)p_addr;                     //׸ڴַ
+    /* 将空闲内存块串联成一个单向链表 */
+    p_link = (void **)p_addr;                          //内存分区首地址转为二级指针
+    p_blk  = (CPU_INT08U *)p_addr;                     //首个内存块地址
     loops  = n_blks - 1u;
-    for (i = 0u; i < loops; i++) {                     //ڴɵ
-        p_blk +=  blk_size;                            //һڴַ
-       *p_link = (void  *)p_blk;                       //ڵǰڴ鱣һڴַ
-        p_link = (void **)(void *)p_blk;               //һڴĵַתΪָ 
+    for (i = 0u; i < loops; i++) {                     //将内存块逐个串成单向链表
+        p_blk +=  blk_size;                            //下一内存块地址
+       *p_link = (void  *)p_blk;                       //在当前内存块保存下一个内存块地址
+        p_link = (void **)(void *)p_blk;               //下一个内存块的地址转为二级指针 
     }
-   *p_link             = (void *)0;                    //һڴָ
+   *p_link             = (void *)0;                    //最后一个内存块指向空
 
-    OS_CRITICAL_ENTER();                               //ٽ
-    p_mem->Type        = OS_OBJ_TYPE_MEM;              //ö   
-    p_mem->NamePtr     = p_name;                       //ڴ     
-    p_mem->AddrPtr     = p_addr;                       //洢ڴ׵ַ     
-    p_mem->FreeListPtr = p_addr;                       //ʼڴص׵ַ 
-    p_mem->NbrFree     = n_blks;                       //洢ڴĿ   
-    p_mem->NbrMax      = n_blks;                       //洢ڴĿ
-    p_mem->BlkSize     = blk_size;                     //洢ڴĿռС  
+    OS_CRITICAL_ENTER();                               //进入临界段
+    p_mem->Type        = OS_OBJ_TYPE_MEM;              //设置对象的类型   
+    p_mem->NamePtr     = p_name;                       //保存内存分区的命名     
+    p_mem->AddrPtr     = p_addr;                       //存储内存分区的首地址     
+    p_mem->FreeListPtr = p_addr;                       //初始化空闲内存块池的首地址 
+    p_mem->NbrFree     = n_blks;                       //存储空闲内存块的数目   
+    p_mem->NbrMax      = n_blks;                       //存储内存块的总数目
+    p_mem->BlkSize     = blk_size;                     //存储内存块的空间大小  
 
-#if OS_CFG_DBG_EN > 0u            //ʹ˵Դͱ 
-    OS_MemDbgListAdd(p_mem);      //ڴڴ˫б
+#if OS_CFG_DBG_EN > 0u            //如果使能了调试代码和变量 
+    OS_MemDbgListAdd(p_mem);      //将内存管理对象插入内存管理双向调试列表
 #endif
 
-    OSMemQty++;                   //ڴĿ1
+    OSMemQty++;                   //内存管理对象数目加1
 
-    OS_CRITICAL_EXIT_NO_SCHED();  //˳ٽΣ޵ȣ
-   *p_err = OS_ERR_NONE;          //Ϊ޴
+    OS_CRITICAL_EXIT_NO_SCHED();  //退出临界段（无调度）
+   *p_err = OS_ERR_NONE;          //错误类型为“无错误”
 }
 
 /*$PAGE*/
@@ -187,40 +187,40 @@ void  OSMemCreate (OS_MEM       *p_mem,    //
 ************************************************************************************************************************
 */
 
-void  *OSMemGet (OS_MEM  *p_mem, //ڴ
-                 OS_ERR  *p_err) //ش
+void  *OSMemGet (OS_MEM  *p_mem, //内存管理对象
+                 OS_ERR  *p_err) //返回错误类型
 {
     void    *p_blk;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return ((void *)0);              //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return ((void *)0);              //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                 //ʹ˲
-    if (p_mem == (OS_MEM *)0) {            // p_mem Ϊ            
-       *p_err  = OS_ERR_MEM_INVALID_P_MEM; //ΪڴǷ
-        return ((void *)0);                //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                 //如果使能了参数检测
+    if (p_mem == (OS_MEM *)0) {            //如果 p_mem 为空            
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM; //错误类型为“内存分区非法”
+        return ((void *)0);                //返回0（有错误），停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                    //ж
-    if (p_mem->NbrFree == (OS_MEM_QTY)0) {   //ûпеڴ
-        CPU_CRITICAL_EXIT();                 //ж
-       *p_err = OS_ERR_MEM_NO_FREE_BLKS;     //Ϊûпڴ顱  
-        return ((void *)0);                  //0д󣩣ִֹͣ
+    CPU_CRITICAL_ENTER();                    //关中断
+    if (p_mem->NbrFree == (OS_MEM_QTY)0) {   //如果没有空闲的内存块
+        CPU_CRITICAL_EXIT();                 //开中断
+       *p_err = OS_ERR_MEM_NO_FREE_BLKS;     //错误类型为“没有空闲内存块”  
+        return ((void *)0);                  //返回0（有错误），停止执行
     }
-    p_blk              = p_mem->FreeListPtr; //пڴ飬ͻȡ
-    p_mem->FreeListPtr = *(void **)p_blk;    //ڴָ
-    p_mem->NbrFree--;                        //ڴĿ1
-    CPU_CRITICAL_EXIT();                     //ж
-   *p_err = OS_ERR_NONE;                     //Ϊ޴
-    return (p_blk);                          //ػȡڴ
+    p_blk              = p_mem->FreeListPtr; //如果还有空闲内存块，就获取它
+    p_mem->FreeListPtr = *(void **)p_blk;    //调整空闲内存块指针
+    p_mem->NbrFree--;                        //空闲内存块数目减1
+    CPU_CRITICAL_EXIT();                     //开中断
+   *p_err = OS_ERR_NONE;                     //错误类型为“无错误”
+    return (p_blk);                          //返回获取到的内存块
 }
 
 /*$PAGE*/
@@ -244,43 +244,43 @@ void  *OSMemGet (OS_MEM  *p_mem, //
 ************************************************************************************************************************
 */
 
-void  OSMemPut (OS_MEM  *p_mem,   //ڴ
-                void    *p_blk,   //Ҫ˻صڴ
-                OS_ERR  *p_err)   //ش
+void  OSMemPut (OS_MEM  *p_mem,   //内存管理对象
+                void    *p_blk,   //要退回的内存块
+                OS_ERR  *p_err)   //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return;                          //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return;                          //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                  //ʹ˲
-    if (p_mem == (OS_MEM *)0) {             // p_mem Ϊ                
-       *p_err  = OS_ERR_MEM_INVALID_P_MEM;  //ΪڴǷ
-        return;                             //أִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                  //如果使能了参数检测
+    if (p_mem == (OS_MEM *)0) {             //如果 p_mem 为空                
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;  //错误类型为“内存分区非法”
+        return;                             //返回，停止执行
     }
-    if (p_blk == (void *)0) {               //ڴΪ
-       *p_err  = OS_ERR_MEM_INVALID_P_BLK;  //Ϊ"ڴǷ"
-        return;                             //أִֹͣ
+    if (p_blk == (void *)0) {               //如果内存块为空
+       *p_err  = OS_ERR_MEM_INVALID_P_BLK;  //错误类型为"内存块非法"
+        return;                             //返回，停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                    //ж
-    if (p_mem->NbrFree >= p_mem->NbrMax) {   //еڴѾ˳                
-        CPU_CRITICAL_EXIT();                 //ж
-       *p_err = OS_ERR_MEM_FULL;             //Ϊڴ
-        return;                              //أִֹͣ
+    CPU_CRITICAL_ENTER();                    //关中断
+    if (p_mem->NbrFree >= p_mem->NbrMax) {   //如果所有的内存块已经退出分区                
+        CPU_CRITICAL_EXIT();                 //开中断
+       *p_err = OS_ERR_MEM_FULL;             //错误类型为“内存分区已满”
+        return;                              //返回，停止执行
     }
-    *(void **)p_blk    = p_mem->FreeListPtr; //ڴڴ
-    p_mem->FreeListPtr = p_blk;              //ڴ˻صǰ
-    p_mem->NbrFree++;                        //ڴĿ1
-    CPU_CRITICAL_EXIT();                     //ж
-   *p_err              = OS_ERR_NONE;        //Ϊ޴
+    *(void **)p_blk    = p_mem->FreeListPtr; //把内存块插入空闲内存块链表
+    p_mem->FreeListPtr = p_blk;              //内存块退回到链表的最前端
+    p_mem->NbrFree++;                        //空闲内存块数目加1
+    CPU_CRITICAL_EXIT();                     //开中断
+   *p_err              = OS_ERR_NONE;        //错误类型为“无错误”
 }
 
 /*$PAGE*/
@@ -298,17 +298,17 @@ void  OSMemPut (OS_MEM  *p_mem,   //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_DBG_EN > 0u                                  //ʹ˵Դͱ 
-void  OS_MemDbgListAdd (OS_MEM  *p_mem)                 //ڴ뵽ڴбǰ
+#if OS_CFG_DBG_EN > 0u                                  //如果使能了调试代码和变量 
+void  OS_MemDbgListAdd (OS_MEM  *p_mem)                 //将内存管理对象插入到内存管理调试列表的最前端
 {
-    p_mem->DbgPrevPtr               = (OS_MEM *)0;      //öΪбǰ
-    if (OSMemDbgListPtr == (OS_MEM *)0) {               //бΪ
-        p_mem->DbgNextPtr           = (OS_MEM *)0;      //öеһԪҲΪ
-    } else {                                            //бǿ
-        p_mem->DbgNextPtr           =  OSMemDbgListPtr; //бԭԪΪöеһԪ
-        OSMemDbgListPtr->DbgPrevPtr =  p_mem;           //ԭԪصǰΪ˸ö
+    p_mem->DbgPrevPtr               = (OS_MEM *)0;      //将该对象作为列表的最前端
+    if (OSMemDbgListPtr == (OS_MEM *)0) {               //如果列表为空
+        p_mem->DbgNextPtr           = (OS_MEM *)0;      //该队列的下一个元素也为空
+    } else {                                            //如果列表非空
+        p_mem->DbgNextPtr           =  OSMemDbgListPtr; //列表原来的首元素作为该队列的下一个元素
+        OSMemDbgListPtr->DbgPrevPtr =  p_mem;           //原来的首元素的前面变为了该队列
     }
-    OSMemDbgListPtr                 =  p_mem;           //öΪбԪ
+    OSMemDbgListPtr                 =  p_mem;           //该对象成为列表的新首元素
 }
 #endif
 
@@ -118,118 +118,118 @@ const  CPU_CHAR  *os_pend_multi__c = "$Id: $";
 ************************************************************************************************************************
 */
 /*$PAGE*/
-OS_OBJ_QTY  OSPendMulti (OS_PEND_DATA  *p_pend_data_tbl,  //ȴ飩
-                         OS_OBJ_QTY     tbl_size,         //ȴĿ
-                         OS_TICK        timeout,          //ʱλʱӽ䣩
-                         OS_OPT         opt,              //ѡ
-                         OS_ERR        *p_err)            //ش
+OS_OBJ_QTY  OSPendMulti (OS_PEND_DATA  *p_pend_data_tbl,  //等待对象（数组）
+                         OS_OBJ_QTY     tbl_size,         //等待对象的数目
+                         OS_TICK        timeout,          //超时（单位：时钟借配）
+                         OS_OPT         opt,              //选项
+                         OS_ERR        *p_err)            //返回错误类型
 {
     CPU_BOOLEAN   valid;
     OS_OBJ_QTY    nbr_obj_rdy;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬úͶһֲ
-                    //ڱжǰ CPU ״̬Ĵ SRٽιжֻ豣SR
-                    //жʱֵԭ 
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和定义一个局部变
+                    //量，用于保存关中断前的 CPU 状态寄存器 SR（临界段关中断只需保存SR）
+                    //，开中断时将该值还原。 
 	
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_OBJ_QTY)0);         //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_OBJ_QTY)0);         //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹܣĬʹܣжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_PEND_ISR;               //ΪжϺжʱ
-        return ((OS_OBJ_QTY)0);                //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能（默认使能）了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数是在中断中被调用
+       *p_err = OS_ERR_PEND_ISR;               //错误类型为“在中断函数中定时”
+        return ((OS_OBJ_QTY)0);                //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                       //ʹܣĬʹܣ˲
-    if (p_pend_data_tbl == (OS_PEND_DATA *)0) {  // p_pend_data_tbl Ϊ
-       *p_err = OS_ERR_PTR_INVALID;              //Ϊȴ󲻿á
-        return ((OS_OBJ_QTY)0);                  //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                       //如果使能（默认使能）了参数检测
+    if (p_pend_data_tbl == (OS_PEND_DATA *)0) {  //如果参数 p_pend_data_tbl 为空
+       *p_err = OS_ERR_PTR_INVALID;              //错误类型为“等待对象不可用”
+        return ((OS_OBJ_QTY)0);                  //返回0（有错误），停止执行
     }
-    if (tbl_size == (OS_OBJ_QTY)0) {             // tbl_size Ϊ0
-       *p_err = OS_ERR_PTR_INVALID;              //Ϊȴ󲻿á
-        return ((OS_OBJ_QTY)0);                  //0д󣩣ִֹͣ
+    if (tbl_size == (OS_OBJ_QTY)0) {             //如果 tbl_size 为0
+       *p_err = OS_ERR_PTR_INVALID;              //错误类型为“等待对象不可用”
+        return ((OS_OBJ_QTY)0);                  //返回0（有错误），停止执行
     }
-    switch (opt) {                               //ѡദ
-        case OS_OPT_PEND_BLOCKING:               //ѡԤ
+    switch (opt) {                               //根据选项分类处理
+        case OS_OPT_PEND_BLOCKING:               //如果选项在预期内
         case OS_OPT_PEND_NON_BLOCKING:
-             break;                              //ֱ
+             break;                              //直接跳出
 
-        default:                                 //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;         //ΪѡǷ
-             return ((OS_OBJ_QTY)0);             //0д󣩣ִֹͣ
+        default:                                 //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;         //错误类型为“选项非法”
+             return ((OS_OBJ_QTY)0);             //返回0（有错误），停止执行
     }
 #endif
-    /* ֤ʵȴǷֻжֵźϢ */ 
+    /* 证实等待对象是否只有多值信号量或消息队列 */ 
     valid = OS_PendMultiValidate(p_pend_data_tbl,          
                                  tbl_size);
-    if (valid == DEF_FALSE) {              //ȴֻжֵźϢ  
-       *p_err = OS_ERR_OBJ_TYPE;           //Ϊ                     
-        return ((OS_OBJ_QTY)0);            //0д󣩣ִֹͣ
+    if (valid == DEF_FALSE) {              //如果等待对象不是只有多值信号量或消息队列  
+       *p_err = OS_ERR_OBJ_TYPE;           //错误类型为“对象类型有误”                     
+        return ((OS_OBJ_QTY)0);            //返回0（有错误），停止执行
     }
-    /* ȴȷʵֻжֵźϢ */ 
+    /* 如果等待对象确实只有多值信号量或消息队列 */ 
 /*$PAGE*/
-    CPU_CRITICAL_ENTER();                                 //ж
-    nbr_obj_rdy = OS_PendMultiGetRdy(p_pend_data_tbl,     //鿴Ƿжύ
+    CPU_CRITICAL_ENTER();                                 //关中断
+    nbr_obj_rdy = OS_PendMultiGetRdy(p_pend_data_tbl,     //查看是否有对象被提交了
                                      tbl_size);
-    if (nbr_obj_rdy > (OS_OBJ_QTY)0) {                    //ж󱻷
-        CPU_CRITICAL_EXIT();                              //ж
-       *p_err = OS_ERR_NONE;                              //Ϊ޴
-        return ((OS_OBJ_QTY)nbr_obj_rdy);                 //رĵȴĿ
+    if (nbr_obj_rdy > (OS_OBJ_QTY)0) {                    //如果有对象被发布
+        CPU_CRITICAL_EXIT();                              //开中断
+       *p_err = OS_ERR_NONE;                              //错误类型为“无错误”
+        return ((OS_OBJ_QTY)nbr_obj_rdy);                 //返回被发布的等待对象的数目
     }
-    /* Ŀǰûж󱻷 */
-    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //ѡ˲
-        CPU_CRITICAL_EXIT();                              //ж
-       *p_err = OS_ERR_PEND_WOULD_BLOCK;                  //Ϊ
-        return ((OS_OBJ_QTY)0);                           //0д󣩣ִֹͣ
-    } else {                                              //ѡ
-        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {  //
-            CPU_CRITICAL_EXIT();                          //ж
-           *p_err = OS_ERR_SCHED_LOCKED;                  //Ϊ
-            return ((OS_OBJ_QTY)0);                       //0д󣩣ִֹͣ
+    /* 如果目前没有对象被发布 */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //如果选择了不阻塞任务
+        CPU_CRITICAL_EXIT();                              //开中断
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                  //错误类型为“渴望阻塞”
+        return ((OS_OBJ_QTY)0);                           //返回0（有错误），停止执行
+    } else {                                              //如果选择了阻塞任务
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {  //如果调度器被锁
+            CPU_CRITICAL_EXIT();                          //开中断
+           *p_err = OS_ERR_SCHED_LOCKED;                  //错误类型为“调度器被锁”
+            return ((OS_OBJ_QTY)0);                       //返回0（有错误），停止执行
         }
     }
                                                             
-    OS_CRITICAL_ENTER_CPU_EXIT();                         //ؿж
+    OS_CRITICAL_ENTER_CPU_EXIT();                         //锁调度器，重开中断
                                                            
-    OS_PendMultiWait(p_pend_data_tbl,                     //ǰȵж󱻷ʱ
+    OS_PendMultiWait(p_pend_data_tbl,                     //挂起当前任务等到有对象被发布或超时
                      tbl_size,
                      timeout);
 
-    OS_CRITICAL_EXIT_NO_SCHED();                          //޵ȣ
+    OS_CRITICAL_EXIT_NO_SCHED();                          //解锁调度器（无调度）
 
-    OSSched();                                            //
-    /* ȵˣһԼ */
-    CPU_CRITICAL_ENTER();                                 //ж
-    switch (OSTCBCurPtr->PendStatus) {                    //ݵǰĵȴ״̬ദ
-        case OS_STATUS_PEND_OK:                           //Ѿȵ˶
-            *p_err = OS_ERR_NONE;                         //Ϊ޴
-             break;                                       //
+    OSSched();                                            //调度任务
+    /* 任务等到了（一个）对象后得以继续运行 */
+    CPU_CRITICAL_ENTER();                                 //关中断
+    switch (OSTCBCurPtr->PendStatus) {                    //根据当前任务的等待状态分类处理
+        case OS_STATUS_PEND_OK:                           //如果任务已经等到了对象
+            *p_err = OS_ERR_NONE;                         //错误类型为“无错误”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_ABORT:                        //ĵȴֹ
-            *p_err = OS_ERR_PEND_ABORT;                   //Ϊȴֹ
-             break;                                       //
+        case OS_STATUS_PEND_ABORT:                        //如果任务的等待被中止
+            *p_err = OS_ERR_PEND_ABORT;                   //错误类型为“等待对象被中止”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_TIMEOUT:                      //ȴʱ
-            *p_err = OS_ERR_TIMEOUT;                      //Ϊȴʱ
-             break;                                       //
+        case OS_STATUS_PEND_TIMEOUT:                      //如果等待超时
+            *p_err = OS_ERR_TIMEOUT;                      //错误类型为“等待超时”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_DEL:                          //ȴĶɾ
-            *p_err = OS_ERR_OBJ_DEL;                      //Ϊȴɾ
-            break;                                        //
+        case OS_STATUS_PEND_DEL:                          //如果任务等待的对象被删除
+            *p_err = OS_ERR_OBJ_DEL;                      //错误类型为“等待对象被删”
+            break;                                        //跳出
 
-        default:                                          //ĵȴ״̬Ԥ
-            *p_err = OS_ERR_STATUS_INVALID;               //Ϊ״̬Ƿ
-             break;                                       //
+        default:                                          //如果任务的等待状态超出预期
+            *p_err = OS_ERR_STATUS_INVALID;               //错误类型为“状态非法”
+             break;                                       //跳出
     }
 
-    OSTCBCurPtr->PendStatus = OS_STATUS_PEND_OK;         //λĵȴ״̬
-    CPU_CRITICAL_EXIT();                                 //ж
+    OSTCBCurPtr->PendStatus = OS_STATUS_PEND_OK;         //复位任务的等待状态
+    CPU_CRITICAL_EXIT();                                 //开中断
 
-    return ((OS_OBJ_QTY)1);                              //رĿΪ1
+    return ((OS_OBJ_QTY)1);                              //返回被发布对象数目为1
 }
 
 /*$PAGE*/
@@ -251,8 +251,8 @@ OS_OBJ_QTY  OSPendMulti (OS_PEND_DATA  *p_pend_data_tbl,  //
 ************************************************************************************************************************
 */
 
-OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl, //ȴ
-                                OS_OBJ_QTY     tbl_size)        //ȴĿ
+OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl, //等待对象
+                                OS_OBJ_QTY     tbl_size)        //等待对象数目
 {
     OS_OBJ_QTY   i;
     OS_OBJ_QTY   nbr_obj_rdy;
@@ -270,24 +270,24 @@ OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl, //
 
 
     nbr_obj_rdy = (OS_OBJ_QTY)0;
-    for (i = 0u; i < tbl_size; i++) {                          //ȴ
-        p_pend_data_tbl->RdyObjPtr  = (OS_PEND_OBJ  *)0;       //ȴ
+    for (i = 0u; i < tbl_size; i++) {                          //逐个检测等待对象
+        p_pend_data_tbl->RdyObjPtr  = (OS_PEND_OBJ  *)0;       //清零等待对象的所有数据
         p_pend_data_tbl->RdyMsgPtr  = (void         *)0;
         p_pend_data_tbl->RdyMsgSize = (OS_MSG_SIZE   )0;
         p_pend_data_tbl->RdyTS      = (CPU_TS        )0;
         p_pend_data_tbl->NextPtr    = (OS_PEND_DATA *)0;
         p_pend_data_tbl->PrevPtr    = (OS_PEND_DATA *)0;
         p_pend_data_tbl->TCBPtr     = (OS_TCB       *)0;
-#if OS_CFG_Q_EN > 0u                                           //ʹϢ          
-        p_q = (OS_Q *)((void *)p_pend_data_tbl->PendObjPtr);   //öΪϢд
-        if (p_q->Type == OS_OBJ_TYPE_Q) {                      //öȷΪϢ
-            p_void = OS_MsgQGet(&p_q->MsgQ,                    //ӸϢлȡϢ
+#if OS_CFG_Q_EN > 0u                                           //如果使能了消息队列          
+        p_q = (OS_Q *)((void *)p_pend_data_tbl->PendObjPtr);   //将该对象视为消息队列处理
+        if (p_q->Type == OS_OBJ_TYPE_Q) {                      //如果该对象确为消息队列类型
+            p_void = OS_MsgQGet(&p_q->MsgQ,                    //从该消息队列获取消息
                                 &msg_size,
                                 &ts,
                                 &err);
-            if (err == OS_ERR_NONE) {                          //ȡϢɹ
+            if (err == OS_ERR_NONE) {                          //如果获取消息成功
                 p_pend_data_tbl->RdyObjPtr  = p_pend_data_tbl->PendObjPtr;
-                p_pend_data_tbl->RdyMsgPtr  = p_void;          //յϢ
+                p_pend_data_tbl->RdyMsgPtr  = p_void;          //保存接收到的消息
                 p_pend_data_tbl->RdyMsgSize = msg_size;
                 p_pend_data_tbl->RdyTS      = ts;
                 nbr_obj_rdy++;
@@ -295,11 +295,11 @@ OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl, //
         }
 #endif
 
-#if OS_CFG_SEM_EN > 0u                                           //ʹ˶ֵź
-        p_sem = (OS_SEM *)((void *)p_pend_data_tbl->PendObjPtr); //öΪֵź
-        if (p_sem->Type == OS_OBJ_TYPE_SEM) {                    //öȷΪֵź
-            if (p_sem->Ctr > 0u) {                               //ź
-                p_sem->Ctr--;                                    //ȴԻź
+#if OS_CFG_SEM_EN > 0u                                           //如果使能了多值信号量
+        p_sem = (OS_SEM *)((void *)p_pend_data_tbl->PendObjPtr); //将该对象视为多值信号量处理
+        if (p_sem->Type == OS_OBJ_TYPE_SEM) {                    //如果该对象确为多值信号量类型
+            if (p_sem->Ctr > 0u) {                               //如果该信号量可用
+                p_sem->Ctr--;                                    //等待任务可以获得信号量
                 p_pend_data_tbl->RdyObjPtr  = p_pend_data_tbl->PendObjPtr;
                 p_pend_data_tbl->RdyTS      = p_sem->TS;
                 nbr_obj_rdy++;
@@ -307,9 +307,9 @@ OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl, //
         }
 #endif
 
-        p_pend_data_tbl++;                                       //һȴ
+        p_pend_data_tbl++;                                       //检测下一个等待对象
     }
-    return (nbr_obj_rdy);                                        //رĶĿ
+    return (nbr_obj_rdy);                                        //返回被发布的对象的数目
 }
 
 /*$PAGE*/
@@ -332,8 +332,8 @@ OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl, //
 ************************************************************************************************************************
 */
 
-CPU_BOOLEAN  OS_PendMultiValidate (OS_PEND_DATA  *p_pend_data_tbl, //ȴ
-                                   OS_OBJ_QTY     tbl_size)        //ȴĿ
+CPU_BOOLEAN  OS_PendMultiValidate (OS_PEND_DATA  *p_pend_data_tbl, //等待对象
+                                   OS_OBJ_QTY     tbl_size)        //等待对象数目
 {
     OS_OBJ_QTY  i;
     OS_OBJ_QTY  ctr;
@@ -345,32 +345,32 @@ CPU_BOOLEAN  OS_PendMultiValidate (OS_PEND_DATA  *p_pend_data_tbl, //
 #endif
 
 
-    for (i = 0u; i < tbl_size; i++) {                           //жϵȴ
-        if (p_pend_data_tbl->PendObjPtr == (OS_PEND_OBJ *)0) {  //ȴ󲻴
-            return (DEF_FALSE);                                 //أ֤ʧ
+    for (i = 0u; i < tbl_size; i++) {                           //逐个判断等待对象
+        if (p_pend_data_tbl->PendObjPtr == (OS_PEND_OBJ *)0) {  //如果等待对象不存在
+            return (DEF_FALSE);                                 //返回，验证失败
         }
 
-        ctr = 0u;                                               //0 ctr
-#if OS_CFG_SEM_EN  > 0u                                         //ʹ˶ֵź
-        p_sem = (OS_SEM *)((void *)p_pend_data_tbl->PendObjPtr);//ȡȴ
-        if (p_sem->Type == OS_OBJ_TYPE_SEM) {                   //öǶֵź        
-            ctr++;                                              //ctr Ϊ1
+        ctr = 0u;                                               //置0 ctr
+#if OS_CFG_SEM_EN  > 0u                                         //如果使能了多值信号量
+        p_sem = (OS_SEM *)((void *)p_pend_data_tbl->PendObjPtr);//获取等待对象
+        if (p_sem->Type == OS_OBJ_TYPE_SEM) {                   //如果该对象是多值信号量类型        
+            ctr++;                                              //ctr 为1
         }
 #endif
 
-#if OS_CFG_Q_EN > 0u                                            //ʹϢ
-        p_q = (OS_Q *)((void *)p_pend_data_tbl->PendObjPtr);    //ȡȴ
-        if (p_q->Type == OS_OBJ_TYPE_Q) {                       //öϢ 
-            ctr++;                                              //ctr Ϊ1
+#if OS_CFG_Q_EN > 0u                                            //如果使能了消息队列
+        p_q = (OS_Q *)((void *)p_pend_data_tbl->PendObjPtr);    //获取等待对象
+        if (p_q->Type == OS_OBJ_TYPE_Q) {                       //如果该对象是消息队列类型 
+            ctr++;                                              //ctr 为1
         }
 #endif
 
-        if (ctr == (OS_OBJ_QTY)0) {                             // ctr = 0
-            return (DEF_FALSE);                                 //أ֤ʧ
+        if (ctr == (OS_OBJ_QTY)0) {                             //如果 ctr = 0
+            return (DEF_FALSE);                                 //返回，验证失败
         }
-        p_pend_data_tbl++;                                      //֤һȴ
+        p_pend_data_tbl++;                                      //验证下一个等待对象
     }
-    return (DEF_TRUE);                                          //أ֤ɹ
+    return (DEF_TRUE);                                          //返回，验证成功
 }
 
 /*$PAGE*/
@@ -394,9 +394,9 @@ CPU_BOOLEAN  OS_PendMultiValidate (OS_PEND_DATA  *p_pend_data_tbl, //
 ************************************************************************************************************************
 */
 
-void  OS_PendMultiWait (OS_PEND_DATA  *p_pend_data_tbl, //ȴ
-                        OS_OBJ_QTY     tbl_size,        //ȴĿ
-                        OS_TICK        timeout)         //ʱλʱӽģ
+void  OS_PendMultiWait (OS_PEND_DATA  *p_pend_data_tbl, //等待对象
+                        OS_OBJ_QTY     tbl_size,        //等待对象数目
+                        OS_TICK        timeout)         //超时（单位：时钟节拍）
 {
     OS_OBJ_QTY      i;
     OS_PEND_LIST   *p_pend_list;
@@ -411,36 +411,36 @@ void  OS_PendMultiWait (OS_PEND_DATA  *p_pend_data_tbl, //
 
 
 
-    OSTCBCurPtr->PendOn             = OS_TASK_PEND_ON_MULTI;   //ȴ󲻿ãʼȴ
+    OSTCBCurPtr->PendOn             = OS_TASK_PEND_ON_MULTI;   //等待对象不可用，开始等待
     OSTCBCurPtr->PendStatus         = OS_STATUS_PEND_OK;
     OSTCBCurPtr->PendDataTblEntries = tbl_size;
     OSTCBCurPtr->PendDataTblPtr     = p_pend_data_tbl;
 
-    OS_TaskBlock(OSTCBCurPtr,                                   //ǰ
+    OS_TaskBlock(OSTCBCurPtr,                                   //阻塞当前运行任务
                  timeout);                                    
 
-    for (i = 0u; i < tbl_size; i++) {                           //ȴȴб
-        p_pend_data_tbl->TCBPtr = OSTCBCurPtr;                  //еĵȴ󶼰󶨵ǰ
+    for (i = 0u; i < tbl_size; i++) {                           //逐个将等待对象插入等待列表
+        p_pend_data_tbl->TCBPtr = OSTCBCurPtr;                  //所有的等待对象都绑定当前任务
 
-#if OS_CFG_SEM_EN > 0u                                          //ʹ˶ֵź
-        p_sem = (OS_SEM *)((void *)p_pend_data_tbl->PendObjPtr);//Ϊֵź
-        if (p_sem->Type == OS_OBJ_TYPE_SEM) {                   //öȷΪֵź
-            p_pend_list = &p_sem->PendList;                     //ȡźĵȴб
-            OS_PendListInsertPrio(p_pend_list,                  //ǰõȴб
+#if OS_CFG_SEM_EN > 0u                                          //如果使能了多值信号量
+        p_sem = (OS_SEM *)((void *)p_pend_data_tbl->PendObjPtr);//将对象视为多值信号量处理
+        if (p_sem->Type == OS_OBJ_TYPE_SEM) {                   //如果该对象确为多值信号量
+            p_pend_list = &p_sem->PendList;                     //获取该信号量的等待列表
+            OS_PendListInsertPrio(p_pend_list,                  //将当前任务插入该等待列表
                                   p_pend_data_tbl);
         }
 #endif
 
-#if OS_CFG_Q_EN > 0u                                            //ʹϢ
-        p_q = (OS_Q *)((void *)p_pend_data_tbl->PendObjPtr);    //ΪϢд
-        if (p_q->Type == OS_OBJ_TYPE_Q) {                       //öȷΪϢ
-            p_pend_list = &p_q->PendList;                       //ȡϢеĵȴб
-            OS_PendListInsertPrio(p_pend_list,                  //ǰõȴб
+#if OS_CFG_Q_EN > 0u                                            //如果使能了消息队列
+        p_q = (OS_Q *)((void *)p_pend_data_tbl->PendObjPtr);    //将对象视为消息队列处理
+        if (p_q->Type == OS_OBJ_TYPE_Q) {                       //如果该对象确为消息队列
+            p_pend_list = &p_q->PendList;                       //获取该消息队列的等待列表
+            OS_PendListInsertPrio(p_pend_list,                  //将当前任务插入该等待列表
                                   p_pend_data_tbl);
         }
 #endif
 
-        p_pend_data_tbl++;                                      //һȴ
+        p_pend_data_tbl++;                                      //处理下一个等待对象
     }
 }
 
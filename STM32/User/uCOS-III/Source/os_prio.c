@@ -62,7 +62,7 @@ void  OS_PrioInit (void)
 
 
                                                             /* Clear the bitmap table ... no task is ready            */
-    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) { //ȼλӳ
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) { //清零就绪优先级位映像表
          OSPrioTbl[i] = (CPU_DATA)0;
     }
 }
@@ -68,62 +68,62 @@ const  CPU_CHAR  *os_q__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-void  OSQCreate (OS_Q        *p_q,     //Ϣָ
-                 CPU_CHAR    *p_name,  //Ϣ
-                 OS_MSG_QTY   max_qty, //ϢдСΪ0
-                 OS_ERR      *p_err)   //ش
+void  OSQCreate (OS_Q        *p_q,     //消息队列指针
+                 CPU_CHAR    *p_name,  //消息队列名称
+                 OS_MSG_QTY   max_qty, //消息队列大小（不能为0）
+                 OS_ERR      *p_err)   //返回错误类型
 
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL               //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return;                         //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return;                         //返回，停止执行
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508               //ʹ˰ȫؼ
-    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //ڵOSSafetyCriticalStart()󴴽
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //ΪǷں˶
-        return;                                  //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL_IEC61508               //如果使能了安全关键
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //如果在调用OSSafetyCriticalStart()后创建
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //错误类型为“非法创建内核对象”
+        return;                                  //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_CREATE_ISR;             //Ϊжд
-        return;                                //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数是在中断中被调用
+       *p_err = OS_ERR_CREATE_ISR;             //错误类型为“在中断中创建对象”
+        return;                                //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u            //ʹ˲
-    if (p_q == (OS_Q *)0) {           // p_q Ϊ                       
-       *p_err = OS_ERR_OBJ_PTR_NULL;  //ΪΪա
-        return;                       //أִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u            //如果使能了参数检测
+    if (p_q == (OS_Q *)0) {           //如果 p_q 为空                       
+       *p_err = OS_ERR_OBJ_PTR_NULL;  //错误类型为“创建对象为空”
+        return;                       //返回，停止执行
     }
-    if (max_qty == (OS_MSG_QTY)0) {   // max_qty = 0            
-       *p_err = OS_ERR_Q_SIZE;        //ΪпռΪ0
-        return;                       //أִֹͣ
+    if (max_qty == (OS_MSG_QTY)0) {   //如果 max_qty = 0            
+       *p_err = OS_ERR_Q_SIZE;        //错误类型为“队列空间为0”
+        return;                       //返回，停止执行
     }
 #endif
 
-    OS_CRITICAL_ENTER();             //ٽ
-    p_q->Type    = OS_OBJ_TYPE_Q;    //ǴݽṹΪϢ  
-    p_q->NamePtr = p_name;           //Ϣе
-    OS_MsgQInit(&p_q->MsgQ,          //ʼϢ
+    OS_CRITICAL_ENTER();             //进入临界段
+    p_q->Type    = OS_OBJ_TYPE_Q;    //标记创建对象数据结构为消息队列  
+    p_q->NamePtr = p_name;           //标记消息队列的名称
+    OS_MsgQInit(&p_q->MsgQ,          //初始化消息队列
                 max_qty);
-    OS_PendListInit(&p_q->PendList); //ʼϢеĵȴб   
+    OS_PendListInit(&p_q->PendList); //初始化该消息队列的等待列表   
 
-#if OS_CFG_DBG_EN > 0u               //ʹ˵Դͱ
-    OS_QDbgListAdd(p_q);             //öӵϢ˫
+#if OS_CFG_DBG_EN > 0u               //如果使能了调试代码和变量
+    OS_QDbgListAdd(p_q);             //将该队列添加到消息队列双向调试链表
 #endif
-    OSQQty++;                        //Ϣи1
+    OSQQty++;                        //消息队列个数加1
 
-    OS_CRITICAL_EXIT_NO_SCHED();     //˳ٽΣ޵ȣ
-   *p_err = OS_ERR_NONE;             //Ϊ޴
+    OS_CRITICAL_EXIT_NO_SCHED();     //退出临界段（无调度）
+   *p_err = OS_ERR_NONE;             //错误类型为“无错误”
 }
 
 /*$PAGE*/
@@ -163,10 +163,10 @@ void  OSQCreate (OS_Q        *p_q,     //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_Q_DEL_EN > 0u             //ʹ OSQDel() 
-OS_OBJ_QTY  OSQDel (OS_Q    *p_q,    //Ϣָ
-                    OS_OPT   opt,    //ѡ
-                    OS_ERR  *p_err)  //ش
+#if OS_CFG_Q_DEL_EN > 0u             //如果使能了 OSQDel() 函数
+OS_OBJ_QTY  OSQDel (OS_Q    *p_q,    //消息队列指针
+                    OS_OPT   opt,    //选项
+                    OS_ERR  *p_err)  //返回错误类型
 {
     OS_OBJ_QTY     cnt;
     OS_OBJ_QTY     nbr_tasks;
@@ -174,71 +174,71 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,    //
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_OBJ_QTY)0);         //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_OBJ_QTY)0);         //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_DEL_ISR;                 //Ϊжɾ
-        return ((OS_OBJ_QTY)0);                 //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_DEL_ISR;                 //错误类型为“在中断中删除对象”
+        return ((OS_OBJ_QTY)0);                 //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                //ʹ˲
-    if (p_q == (OS_Q *)0) {               // p_q Ϊ
-       *p_err =  OS_ERR_OBJ_PTR_NULL;     //ΪΪա
-        return ((OS_OBJ_QTY)0u);          //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                //如果使能了参数检测
+    if (p_q == (OS_Q *)0) {               //如果 p_q 为空
+       *p_err =  OS_ERR_OBJ_PTR_NULL;     //错误类型为“对象为空”
+        return ((OS_OBJ_QTY)0u);          //返回0（有错误），停止执行
     }
-    switch (opt) {                        //ѡദ
-        case OS_OPT_DEL_NO_PEND:          //ѡԤ
+    switch (opt) {                        //根据选项分类处理
+        case OS_OPT_DEL_NO_PEND:          //如果选项在预期内
         case OS_OPT_DEL_ALWAYS:  
-             break;                       //ֱ
+             break;                       //直接跳出
 
         default:
-            *p_err =  OS_ERR_OPT_INVALID; //ѡԤ
-             return ((OS_OBJ_QTY)0u);     //0д󣩣ִֹͣ
+            *p_err =  OS_ERR_OPT_INVALID; //如果选项超出预期
+             return ((OS_OBJ_QTY)0u);     //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u       //ʹ˶ͼ
-    if (p_q->Type != OS_OBJ_TYPE_Q) { // p_q Ϣ
-       *p_err = OS_ERR_OBJ_TYPE;      //Ϊ
-        return ((OS_OBJ_QTY)0);       //0д󣩣ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u       //如果使能了对象类型检测
+    if (p_q->Type != OS_OBJ_TYPE_Q) { //如果 p_q 不是消息队列类型
+       *p_err = OS_ERR_OBJ_TYPE;      //错误类型为“对象类型有误”
+        return ((OS_OBJ_QTY)0);       //返回0（有错误），停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                                  //ж
-    p_pend_list = &p_q->PendList;                          //ȡϢеĵȴб
-    cnt         = p_pend_list->NbrEntries;                 //ȡȴöе
-    nbr_tasks   = cnt;                                     //Ŀ
-    switch (opt) {                                         //ѡദ
-        case OS_OPT_DEL_NO_PEND:                           //ֻûȴɾ
-             if (nbr_tasks == (OS_OBJ_QTY)0) {             //ûڵȴö
-#if OS_CFG_DBG_EN > 0u                                     //ʹ˵Դͱ  
-                 OS_QDbgListRemove(p_q);                   //öдϢебƳ
+    CPU_CRITICAL_ENTER();                                  //关中断
+    p_pend_list = &p_q->PendList;                          //获取消息队列的等待列表
+    cnt         = p_pend_list->NbrEntries;                 //获取等待该队列的任务数
+    nbr_tasks   = cnt;                                     //按照任务数目逐个处理
+    switch (opt) {                                         //根据选项分类处理
+        case OS_OPT_DEL_NO_PEND:                           //如果只在没有任务等待的情况下删除队列
+             if (nbr_tasks == (OS_OBJ_QTY)0) {             //如果没有任务在等待该队列
+#if OS_CFG_DBG_EN > 0u                                     //如果使能了调试代码和变量  
+                 OS_QDbgListRemove(p_q);                   //将该队列从消息队列调试列表移除
 #endif
-                 OSQQty--;                                 //ϢĿ1
-                 OS_QClr(p_q);                             //öе
-                 CPU_CRITICAL_EXIT();                      //ж
-                *p_err = OS_ERR_NONE;                      //Ϊ޴
-             } else {                                      //ڵȴö
-                 CPU_CRITICAL_EXIT();                      //ж
-                *p_err = OS_ERR_TASK_WAITING;              //ΪڵȴöС
+                 OSQQty--;                                 //消息队列数目减1
+                 OS_QClr(p_q);                             //清除该队列的内容
+                 CPU_CRITICAL_EXIT();                      //开中断
+                *p_err = OS_ERR_NONE;                      //错误类型为“无错误”
+             } else {                                      //如果有任务在等待该队列
+                 CPU_CRITICAL_EXIT();                      //开中断
+                *p_err = OS_ERR_TASK_WAITING;              //错误类型为“有任务在等待该队列”
              }
              break;
 
-        case OS_OPT_DEL_ALWAYS:                             //ɾź
-             OS_CRITICAL_ENTER_CPU_EXIT();                  //ٽΣؿж
-             ts = OS_TS_GET();                              //ȡʱ
-             while (cnt > 0u) {                             //Ƴöеȴбе
+        case OS_OPT_DEL_ALWAYS:                             //如果必须删除信号量
+             OS_CRITICAL_ENTER_CPU_EXIT();                  //进入临界段，重开中断
+             ts = OS_TS_GET();                              //获取时间戳
+             while (cnt > 0u) {                             //逐个移除该队列等待列表中的任务
                  p_pend_data = p_pend_list->HeadPtr;
                  p_tcb       = p_pend_data->TCBPtr;
                  OS_PendObjDel((OS_PEND_OBJ *)((void *)p_q),
@@ -246,22 +246,22 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,    //
                                ts);
                  cnt--;
              }
-#if OS_CFG_DBG_EN > 0u                                     //ʹ˵Դͱ 
-             OS_QDbgListRemove(p_q);                       //öдϢебƳ
-#endif
-             OSQQty--;                                     //ϢĿ1
-             OS_QClr(p_q);                                 //Ϣ
-             OS_CRITICAL_EXIT_NO_SCHED();                  //˳ٽΣ޵ȣ
-             OSSched();                                    //
-            *p_err = OS_ERR_NONE;                          //Ϊ޴
-             break;                                        //
-
-        default:                                           //ѡԤ
-             CPU_CRITICAL_EXIT();                          //ж
-            *p_err = OS_ERR_OPT_INVALID;                   //ΪѡǷ
-             break;                                        //
-    }
-    return (nbr_tasks);                                    //ɾǰȴ
+#if OS_CFG_DBG_EN > 0u                                     //如果使能了调试代码和变量 
+             OS_QDbgListRemove(p_q);                       //将该队列从消息队列调试列表移除
+#endif
+             OSQQty--;                                     //消息队列数目减1
+             OS_QClr(p_q);                                 //清除消息队列内容
+             OS_CRITICAL_EXIT_NO_SCHED();                  //退出临界段（无调度）
+             OSSched();                                    //调度任务
+            *p_err = OS_ERR_NONE;                          //错误类型为“无错误”
+             break;                                        //跳出
+
+        default:                                           //如果选项超出预期
+             CPU_CRITICAL_EXIT();                          //开中断
+            *p_err = OS_ERR_OPT_INVALID;                   //错误类型为“选项非法”
+             break;                                        //跳出
+    }
+    return (nbr_tasks);                                    //返回删除队列前等待其的任务数
 }
 #endif
 
@@ -290,48 +290,48 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,    //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_Q_FLUSH_EN > 0u             //ʹ OSQFlush() 
-OS_MSG_QTY  OSQFlush (OS_Q    *p_q,    //Ϣָ
-                      OS_ERR  *p_err)  //ش
+#if OS_CFG_Q_FLUSH_EN > 0u             //如果使能了 OSQFlush() 函数
+OS_MSG_QTY  OSQFlush (OS_Q    *p_q,    //消息队列指针
+                      OS_ERR  *p_err)  //返回错误类型
 {
     OS_MSG_QTY  entries;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_MSG_QTY)0);         //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_MSG_QTY)0);         //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_FLUSH_ISR;               //ΪжնС
-        return ((OS_MSG_QTY)0);                 //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_FLUSH_ISR;               //错误类型为“在中断中请空队列”
+        return ((OS_MSG_QTY)0);                 //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u            //ʹ˲
-    if (p_q == (OS_Q *)0) {           // p_q Ϊ
-       *p_err = OS_ERR_OBJ_PTR_NULL;  //ΪΪա
-        return ((OS_MSG_QTY)0);       //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u            //如果使能了参数检测
+    if (p_q == (OS_Q *)0) {           //如果 p_q 为空
+       *p_err = OS_ERR_OBJ_PTR_NULL;  //错误类型为“对象为空”
+        return ((OS_MSG_QTY)0);       //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u       //ʹ˶ͼ
-    if (p_q->Type != OS_OBJ_TYPE_Q) { // p_q Ϣ  
-       *p_err = OS_ERR_OBJ_TYPE;      //Ϊ
-        return ((OS_MSG_QTY)0);       //0д󣩣ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u       //如果使能了对象类型检测
+    if (p_q->Type != OS_OBJ_TYPE_Q) { //如果 p_q 不是消息队列类型  
+       *p_err = OS_ERR_OBJ_TYPE;      //错误类型为“对象类型有误”
+        return ((OS_MSG_QTY)0);       //返回0（有错误），停止执行
     }
 #endif
 
-    OS_CRITICAL_ENTER();                  //ٽ
-    entries = OS_MsgQFreeAll(&p_q->MsgQ); //ѶеϢͷŻϢ
-    OS_CRITICAL_EXIT();                   //˳ٽ
-   *p_err   = OS_ERR_NONE;                //Ϊ޴
-    return ((OS_MSG_QTY)entries);         //նǰеϢĿ
+    OS_CRITICAL_ENTER();                  //进入临界段
+    entries = OS_MsgQFreeAll(&p_q->MsgQ); //把队列的所有消息均释放回消息池
+    OS_CRITICAL_EXIT();                   //退出临界段
+   *p_err   = OS_ERR_NONE;                //错误类型为“无错误”
+    return ((OS_MSG_QTY)entries);         //返回清空队列前队列的消息数目
 }
 #endif
 
@@ -381,141 +381,141 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,    //
 ************************************************************************************************************************
 */
 
-void  *OSQPend (OS_Q         *p_q,       //Ϣָ
-                OS_TICK       timeout,   //ȴޣλʱӽģ
-                OS_OPT        opt,       //ѡ
-                OS_MSG_SIZE  *p_msg_size,//ϢСλֽڣ
-                CPU_TS       *p_ts,      //ȡȵϢʱʱ
-                OS_ERR       *p_err)     //ش
+void  *OSQPend (OS_Q         *p_q,       //消息队列指针
+                OS_TICK       timeout,   //等待期限（单位：时钟节拍）
+                OS_OPT        opt,       //选项
+                OS_MSG_SIZE  *p_msg_size,//返回消息大小（单位：字节）
+                CPU_TS       *p_ts,      //获取等到消息时的时间戳
+                OS_ERR       *p_err)     //返回错误类型
 {
     OS_PEND_DATA  pend_data;
     void         *p_void;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((void *)0);             //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((void *)0);             //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_PEND_ISR;               //Ϊжֹȴ
-        return ((void *)0);                    //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数在中断中被调用
+       *p_err = OS_ERR_PEND_ISR;               //错误类型为“在中断中中止等待”
+        return ((void *)0);                    //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                //ʹ˲
-    if (p_q == (OS_Q *)0) {               // p_q Ϊ
-       *p_err = OS_ERR_OBJ_PTR_NULL;      //ΪΪա
-        return ((void *)0);               //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                //如果使能了参数检测
+    if (p_q == (OS_Q *)0) {               //如果 p_q 为空
+       *p_err = OS_ERR_OBJ_PTR_NULL;      //错误类型为“对象为空”
+        return ((void *)0);               //返回0（有错误），停止执行
     }
-    if (p_msg_size == (OS_MSG_SIZE *)0) { // p_msg_size Ϊ
-       *p_err = OS_ERR_PTR_INVALID;       //Ϊָ벻á
-        return ((void *)0);               //0д󣩣ִֹͣ
+    if (p_msg_size == (OS_MSG_SIZE *)0) { //如果 p_msg_size 为空
+       *p_err = OS_ERR_PTR_INVALID;       //错误类型为“指针不可用”
+        return ((void *)0);               //返回0（有错误），停止执行
     }
-    switch (opt) {                        //ѡദ
-        case OS_OPT_PEND_BLOCKING:        //ѡԤ
+    switch (opt) {                        //根据选项分类处理
+        case OS_OPT_PEND_BLOCKING:        //如果选项在预期内
         case OS_OPT_PEND_NON_BLOCKING:
-             break;                       //ֱ
+             break;                       //直接跳出
 
-        default:                          //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;  //شΪѡǷ
-             return ((void *)0);          //0д󣩣ִֹͣ
+        default:                          //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;  //返回错误类型为“选项非法”
+             return ((void *)0);          //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u        //ʹ˶ͼ
-    if (p_q->Type != OS_OBJ_TYPE_Q) {  // p_q Ϣ
-       *p_err = OS_ERR_OBJ_TYPE;       //Ϊ
-        return ((void *)0);            //0д󣩣ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u        //如果使能了对象类型检测
+    if (p_q->Type != OS_OBJ_TYPE_Q) {  //如果 p_q 不是消息队列类型
+       *p_err = OS_ERR_OBJ_TYPE;       //错误类型为“对象类型有误”
+        return ((void *)0);            //返回0（有错误），停止执行
     }
 #endif
 
-    if (p_ts != (CPU_TS *)0) {  // p_ts ǿ
-       *p_ts  = (CPU_TS  )0;    //ʼ㣩p_tsڷʱ
+    if (p_ts != (CPU_TS *)0) {  //如果 p_ts 非空
+       *p_ts  = (CPU_TS  )0;    //初始化（清零）p_ts，待用于返回时间戳
     }
 
-    CPU_CRITICAL_ENTER();                                 //ж
-    p_void = OS_MsgQGet(&p_q->MsgQ,                       //ϢлȡһϢ
+    CPU_CRITICAL_ENTER();                                 //关中断
+    p_void = OS_MsgQGet(&p_q->MsgQ,                       //从消息队列获取一个消息
                         p_msg_size,
                         p_ts,
                         p_err);
-    if (*p_err == OS_ERR_NONE) {                          //ȡϢɹ
-        CPU_CRITICAL_EXIT();                              //ж
-        return (p_void);                                  //Ϣ
-    }
-    /* ȡϢɹ */
-    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //ѡ˲
-        CPU_CRITICAL_EXIT();                              //ж
-       *p_err = OS_ERR_PEND_WOULD_BLOCK;                  //Ϊȴ
-        return ((void *)0);                               //0д󣩣ִֹͣ
-    } else {                                              //ѡ˶
-        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {  //
-            CPU_CRITICAL_EXIT();                          //ж
-           *p_err = OS_ERR_SCHED_LOCKED;                  //Ϊ
-            return ((void *)0);                           //0д󣩣ִֹͣ
+    if (*p_err == OS_ERR_NONE) {                          //如果获取消息成功
+        CPU_CRITICAL_EXIT();                              //开中断
+        return (p_void);                                  //返回消息内容
+    }
+    /* 如果获取消息不成功 */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //如果选择了不堵塞任务
+        CPU_CRITICAL_EXIT();                              //开中断
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                  //错误类型为“等待渴求堵塞”
+        return ((void *)0);                               //返回0（有错误），停止执行
+    } else {                                              //如果选择了堵塞任务
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {  //如果调度器被锁
+            CPU_CRITICAL_EXIT();                          //开中断
+           *p_err = OS_ERR_SCHED_LOCKED;                  //错误类型为“调度器被锁”
+            return ((void *)0);                           //返回0（有错误），停止执行
         }
     }
-    /* δ */                                
-    OS_CRITICAL_ENTER_CPU_EXIT();                         //ؿж
-    OS_Pend(&pend_data,                                   //ǰ񣬵ȴϢУ 
-            (OS_PEND_OBJ *)((void *)p_q),                 //ǰб
-            OS_TASK_PEND_ON_Q,                            //뵽б͵ȴб
+    /* 如果调度器未被锁 */                                
+    OS_CRITICAL_ENTER_CPU_EXIT();                         //锁调度器，重开中断
+    OS_Pend(&pend_data,                                   //堵塞当前任务，等待消息队列， 
+            (OS_PEND_OBJ *)((void *)p_q),                 //将当前任务脱离就绪列表，并
+            OS_TASK_PEND_ON_Q,                            //插入到节拍列表和等待列表。
             timeout);
-    OS_CRITICAL_EXIT_NO_SCHED();                          //е
-
-    OSSched();                                            //ҵȼ
-    /* ǰ񣨻ϢеϢԼ */
-    CPU_CRITICAL_ENTER();                                 //ж
-    switch (OSTCBCurPtr->PendStatus) {                    //ݵǰĵȴ״̬ദ
-        case OS_STATUS_PEND_OK:                           //ȴ״̬  
-             p_void     = OSTCBCurPtr->MsgPtr;            //ӣʱڣƿȡϢ
-            *p_msg_size = OSTCBCurPtr->MsgSize;           //ȡϢС
-             if (p_ts  != (CPU_TS *)0) {                  // p_ts ǿ
-                *p_ts   =  OSTCBCurPtr->TS;               //ȡȵϢʱʱ
+    OS_CRITICAL_EXIT_NO_SCHED();                          //开调度器，但不进行调度
+
+    OSSched();                                            //找到并调度最高优先级就绪任务
+    /* 当前任务（获得消息队列的消息）得以继续运行 */
+    CPU_CRITICAL_ENTER();                                 //关中断
+    switch (OSTCBCurPtr->PendStatus) {                    //根据当前运行任务的等待状态分类处理
+        case OS_STATUS_PEND_OK:                           //如果等待状态正常  
+             p_void     = OSTCBCurPtr->MsgPtr;            //从（发布时放于）任务控制块提取消息
+            *p_msg_size = OSTCBCurPtr->MsgSize;           //提取消息大小
+             if (p_ts  != (CPU_TS *)0) {                  //如果 p_ts 非空
+                *p_ts   =  OSTCBCurPtr->TS;               //获取任务等到消息时的时间戳
              }
-            *p_err      = OS_ERR_NONE;                    //Ϊ޴
-             break;                                       //
-
-        case OS_STATUS_PEND_ABORT:                        //ȴֹ
-             p_void     = (void      *)0;                 //ϢΪ
-            *p_msg_size = (OS_MSG_SIZE)0;                 //ϢСΪ0
-             if (p_ts  != (CPU_TS *)0) {                  // p_ts ǿ
-                *p_ts   =  OSTCBCurPtr->TS;               //ȡȴֹʱʱ
+            *p_err      = OS_ERR_NONE;                    //错误类型为“无错误”
+             break;                                       //跳出
+
+        case OS_STATUS_PEND_ABORT:                        //如果等待被中止
+             p_void     = (void      *)0;                 //返回消息内容为空
+            *p_msg_size = (OS_MSG_SIZE)0;                 //返回消息大小为0
+             if (p_ts  != (CPU_TS *)0) {                  //如果 p_ts 非空
+                *p_ts   =  OSTCBCurPtr->TS;               //获取等待被中止时的时间戳
              }
-            *p_err      = OS_ERR_PEND_ABORT;              //Ϊȴֹ
-             break;                                       //
-
-        case OS_STATUS_PEND_TIMEOUT:                      //ȴʱ
-             p_void     = (void      *)0;                 //ϢΪ
-            *p_msg_size = (OS_MSG_SIZE)0;                 //ϢСΪ0
-             if (p_ts  != (CPU_TS *)0) {                  // p_ts ǿ
-                *p_ts   = (CPU_TS  )0;                    // p_ts
+            *p_err      = OS_ERR_PEND_ABORT;              //错误类型为“等待被中止”
+             break;                                       //跳出
+
+        case OS_STATUS_PEND_TIMEOUT:                      //如果等待超时
+             p_void     = (void      *)0;                 //返回消息内容为空
+            *p_msg_size = (OS_MSG_SIZE)0;                 //返回消息大小为0
+             if (p_ts  != (CPU_TS *)0) {                  //如果 p_ts 非空
+                *p_ts   = (CPU_TS  )0;                    //清零 p_ts
              }
-            *p_err      = OS_ERR_TIMEOUT;                 //Ϊȴʱ
-             break;                                       //
-
-        case OS_STATUS_PEND_DEL:                          //ȴں˶ɾ
-             p_void     = (void      *)0;                 //ϢΪ
-            *p_msg_size = (OS_MSG_SIZE)0;                 //ϢСΪ0
-             if (p_ts  != (CPU_TS *)0) {                  // p_ts ǿ
-                *p_ts   =  OSTCBCurPtr->TS;               //ȡɾʱʱ
+            *p_err      = OS_ERR_TIMEOUT;                 //错误类型为“等待超时”
+             break;                                       //跳出
+
+        case OS_STATUS_PEND_DEL:                          //如果等待的内核对象被删除
+             p_void     = (void      *)0;                 //返回消息内容为空
+            *p_msg_size = (OS_MSG_SIZE)0;                 //返回消息大小为0
+             if (p_ts  != (CPU_TS *)0) {                  //如果 p_ts 非空
+                *p_ts   =  OSTCBCurPtr->TS;               //获取对象被删时的时间戳
              }
-            *p_err      = OS_ERR_OBJ_DEL;                 //Ϊȴɾ
-             break;                                       //
+            *p_err      = OS_ERR_OBJ_DEL;                 //错误类型为“等待对象被删”
+             break;                                       //跳出
 
-        default:                                          //ȴ״̬Ԥ
-             p_void     = (void      *)0;                 //ϢΪ
-            *p_msg_size = (OS_MSG_SIZE)0;                 //ϢСΪ0
-            *p_err      = OS_ERR_STATUS_INVALID;          //Ϊ״̬Ƿ
-             break;                                       //
+        default:                                          //如果等待状态超出预期
+             p_void     = (void      *)0;                 //返回消息内容为空
+            *p_msg_size = (OS_MSG_SIZE)0;                 //返回消息大小为0
+            *p_err      = OS_ERR_STATUS_INVALID;          //错误类型为“状态非法”
+             break;                                       //跳出
     }
-    CPU_CRITICAL_EXIT();                                  //ж
-    return (p_void);                                      //Ϣ
+    CPU_CRITICAL_EXIT();                                  //开中断
+    return (p_void);                                      //返回消息内容
 }
 
 
@@ -551,87 +551,87 @@ void  *OSQPend (OS_Q         *p_q,       //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_Q_PEND_ABORT_EN > 0u            //ʹ OSQPendAbort() 
-OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,    //Ϣ
-                          OS_OPT   opt,    //ѡ
-                          OS_ERR  *p_err)  //ش
+#if OS_CFG_Q_PEND_ABORT_EN > 0u            //如果使能了 OSQPendAbort() 函数
+OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,    //消息队列
+                          OS_OPT   opt,    //选项
+                          OS_ERR  *p_err)  //返回错误类型
 {
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
     OS_OBJ_QTY     nbr_tasks;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return ((OS_OBJ_QTY)0u);         //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return ((OS_OBJ_QTY)0u);         //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u           //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {  //úжб
-       *p_err =  OS_ERR_PEND_ABORT_ISR;          //Ϊжֹȴ
-        return ((OS_OBJ_QTY)0u);                 //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u           //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {  //如果该函数在中断中被调用
+       *p_err =  OS_ERR_PEND_ABORT_ISR;          //错误类型为“在中断中中止等待”
+        return ((OS_OBJ_QTY)0u);                 //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                                  //0д󣩣ִֹͣ
-    if (p_q == (OS_Q *)0) {                                 // p_q Ϊ
-       *p_err =  OS_ERR_OBJ_PTR_NULL;                       //ΪΪա
-        return ((OS_OBJ_QTY)0u);                            //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                                  //返回0（有错误），停止执行
+    if (p_q == (OS_Q *)0) {                                 //如果 p_q 为空
+       *p_err =  OS_ERR_OBJ_PTR_NULL;                       //错误类型为“对象为空”
+        return ((OS_OBJ_QTY)0u);                            //返回0（有错误），停止执行
     }
-    switch (opt) {                                          //ѡദ
-        case OS_OPT_PEND_ABORT_1:                           //ѡԤ֮
+    switch (opt) {                                          //根据选项分类处理
+        case OS_OPT_PEND_ABORT_1:                           //如果选项在预期之内
         case OS_OPT_PEND_ABORT_ALL:
         case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
         case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
-             break;                                         //ֱ
+             break;                                         //直接跳出
 
-        default:                                            //ѡԤ
-            *p_err =  OS_ERR_OPT_INVALID;                   //ΪѡǷ
-             return ((OS_OBJ_QTY)0u);                       //0д󣩣ִֹͣ
+        default:                                            //如果选项超出预期
+            *p_err =  OS_ERR_OPT_INVALID;                   //错误类型为“选项非法”
+             return ((OS_OBJ_QTY)0u);                       //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u        //ʹ˶ͼ
-    if (p_q->Type != OS_OBJ_TYPE_Q) {  // p_q Ϣ
-       *p_err =  OS_ERR_OBJ_TYPE;      //Ϊ
-        return ((OS_OBJ_QTY)0u);       //0д󣩣ִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u        //如果使能了对象类型检测
+    if (p_q->Type != OS_OBJ_TYPE_Q) {  //如果 p_q 不是消息队列类型
+       *p_err =  OS_ERR_OBJ_TYPE;      //错误类型为“对象类型有误”
+        return ((OS_OBJ_QTY)0u);       //返回0（有错误），停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                            //ж
-    p_pend_list = &p_q->PendList;                    //ȡϢеĵȴб
-    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0u) { //ûڵȴ
-        CPU_CRITICAL_EXIT();                         //ж
-       *p_err =  OS_ERR_PEND_ABORT_NONE;             //Ϊûڵȴ
+    CPU_CRITICAL_ENTER();                            //关中断
+    p_pend_list = &p_q->PendList;                    //获取消息队列的等待列表
+    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0u) { //如果没有任务在等待
+        CPU_CRITICAL_EXIT();                         //开中断
+       *p_err =  OS_ERR_PEND_ABORT_NONE;             //错误类型为“没任务在等待”
         return ((OS_OBJ_QTY)0u);
     }
-    /* ڵȴ */
-    OS_CRITICAL_ENTER_CPU_EXIT();                     //ؿж   
-    nbr_tasks = 0u;                                   //׼ֹĵȴ
-    ts        = OS_TS_GET();                          //ȡʱ
-    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0u) {//ڵȴ
-        p_tcb = p_pend_list->HeadPtr->TCBPtr;         //ȡͷˣȼ
-        OS_PendAbort((OS_PEND_OBJ *)((void *)p_q),    //ֹ p_q ĵȴ
+    /* 如果有任务在等待 */
+    OS_CRITICAL_ENTER_CPU_EXIT();                     //锁调度器，重开中断   
+    nbr_tasks = 0u;                                   //准备计数被中止的等待任务
+    ts        = OS_TS_GET();                          //获取时间戳
+    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0u) {//如果还有任务在等待
+        p_tcb = p_pend_list->HeadPtr->TCBPtr;         //获取头端（最高优先级）任务
+        OS_PendAbort((OS_PEND_OBJ *)((void *)p_q),    //中止该任务对 p_q 的等待
                      p_tcb,
                      ts);
         nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {           //ѡֹеȴ
-            break;                                    //ټֹ
+        if (opt != OS_OPT_PEND_ABORT_ALL) {           //如果不是选择了中止所有等待任务
+            break;                                    //立即跳出，不再继续中止
         }
     }
-    OS_CRITICAL_EXIT_NO_SCHED();                      //
+    OS_CRITICAL_EXIT_NO_SCHED();                      //减锁调度器，但不调度
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) { //ѡ
-        OSSched();                                    //
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) { //如果选择了任务调度
+        OSSched();                                    //进行任务调度
     }
 
-   *p_err = OS_ERR_NONE;                              //Ϊ޴
-    return (nbr_tasks);                               //رֹĿ
+   *p_err = OS_ERR_NONE;                              //错误类型为“无错误”
+    return (nbr_tasks);                               //返回被中止的任务数目
 }
 #endif
 
@@ -685,30 +685,30 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,    //
 ************************************************************************************************************************
 */
 
-void  OSQPost (OS_Q         *p_q,      //Ϣָ
-               void         *p_void,   //Ϣָ
-               OS_MSG_SIZE   msg_size, //ϢСλֽڣ
-               OS_OPT        opt,      //ѡ 
-               OS_ERR       *p_err)    //ش
+void  OSQPost (OS_Q         *p_q,      //消息队列指针
+               void         *p_void,   //消息指针
+               OS_MSG_SIZE   msg_size, //消息大小（单位：字节）
+               OS_OPT        opt,      //选项 
+               OS_ERR       *p_err)    //返回错误类型
 {
     CPU_TS  ts;
 
 
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return;                         //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return;                         //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u             //ʹ˲
-    if (p_q == (OS_Q *)0) {            // p_q Ϊ  
-       *p_err = OS_ERR_OBJ_PTR_NULL;   //Ϊں˶Ϊա
-        return;                        //أִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u             //如果使能了参数检测
+    if (p_q == (OS_Q *)0) {            //如果 p_q 为空  
+       *p_err = OS_ERR_OBJ_PTR_NULL;   //错误类型为“内核对象为空”
+        return;                        //返回，停止执行
     }
-    switch (opt) {                         //ѡദ
-        case OS_OPT_POST_FIFO:             //ѡԤ
+    switch (opt) {                         //根据选项分类处理
+        case OS_OPT_POST_FIFO:             //如果选项在预期内
         case OS_OPT_POST_LIFO:
         case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
         case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
@@ -716,26 +716,26 @@ void  OSQPost (OS_Q         *p_q,      //
         case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
         case OS_OPT_POST_FIFO | OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
         case OS_OPT_POST_LIFO | OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
-             break;                       //ֱ
+             break;                       //直接跳出
 
-        default:                          //ѡԤ
-            *p_err =  OS_ERR_OPT_INVALID; //ΪѡǷ
-             return;                      //أִֹͣ
+        default:                          //如果选项超出预期
+            *p_err =  OS_ERR_OPT_INVALID; //错误类型为“选项非法”
+             return;                      //返回，停止执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u       //ʹ˶ͼ  
-    if (p_q->Type != OS_OBJ_TYPE_Q) { // p_q Ϣ 
-       *p_err = OS_ERR_OBJ_TYPE;      //Ϊʹ
-        return;                       //أִֹͣ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u       //如果使能了对象类型检测  
+    if (p_q->Type != OS_OBJ_TYPE_Q) { //如果 p_q 不是消息队列类型 
+       *p_err = OS_ERR_OBJ_TYPE;      //错误类型为“对象类型错误”
+        return;                       //返回，停止执行
     }
 #endif
 
-    ts = OS_TS_GET();                 //ȡʱ
+    ts = OS_TS_GET();                 //获取时间戳
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u            //ʹжӳٷ
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_Q, //ϢжϢ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u            //如果使能了中断延迟发布
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_Q, //将该消息发布到中断消息队列
                     (void      *)p_q,
                     (void      *)p_void,
                     (OS_MSG_SIZE)msg_size,
@@ -743,11 +743,11 @@ void  OSQPost (OS_Q         *p_q,      //
                     (OS_OPT     )opt,
                     (CPU_TS     )ts,
                     (OS_ERR    *)p_err);
-        return;                                //أδִֹͣ  
+        return;                                //返回（尚未发布），停止执行  
     }
 #endif
 
-    OS_QPost(p_q,                              //Ϣͨʽ
+    OS_QPost(p_q,                              //将消息按照普通方式
              p_void,
              msg_size,
              opt,
@@ -799,18 +799,18 @@ void  OS_QClr (OS_Q  *p_q)
 */
 
 
-#if OS_CFG_DBG_EN > 0u             //ʹܣĬʹܣ˵Դͱ
-void  OS_QDbgListAdd (OS_Q  *p_q)  //Ϣв뵽Ϣбǰ
+#if OS_CFG_DBG_EN > 0u             //如果使能（默认使能）了调试代码和变量
+void  OS_QDbgListAdd (OS_Q  *p_q)  //将消息队列插入到消息队列列表的最前端
 {
-    p_q->DbgNamePtr               = (CPU_CHAR *)((void *)" "); //Ȳָκ
-    p_q->DbgPrevPtr               = (OS_Q     *)0;             //öΪбǰ
-    if (OSQDbgListPtr == (OS_Q *)0) {                          //бΪ
-        p_q->DbgNextPtr           = (OS_Q     *)0;             //öеһԪҲΪ
-    } else {                                                   //бǿ
-        p_q->DbgNextPtr           =  OSQDbgListPtr;            //бԭԪΪöеһԪ
-        OSQDbgListPtr->DbgPrevPtr =  p_q;                      //ԭԪصǰΪ˸ö
-    }
-    OSQDbgListPtr                 =  p_q;                      //źΪбԪ
+    p_q->DbgNamePtr               = (CPU_CHAR *)((void *)" "); //先不指向任何任务的名称
+    p_q->DbgPrevPtr               = (OS_Q     *)0;             //将该队列作为列表的最前端
+    if (OSQDbgListPtr == (OS_Q *)0) {                          //如果列表为空
+        p_q->DbgNextPtr           = (OS_Q     *)0;             //该队列的下一个元素也为空
+    } else {                                                   //如果列表非空
+        p_q->DbgNextPtr           =  OSQDbgListPtr;            //列表原来的首元素作为该队列的下一个元素
+        OSQDbgListPtr->DbgPrevPtr =  p_q;                      //原来的首元素的前面变为了该队列
+    }
+    OSQDbgListPtr                 =  p_q;                      //该信号量成为列表的新首元素
 }
 
 
@@ -919,12 +919,12 @@ void  OS_QInit (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-void  OS_QPost (OS_Q         *p_q,      //Ϣָ
-                void         *p_void,   //Ϣָ
-                OS_MSG_SIZE   msg_size, //ϢСλֽڣ
-                OS_OPT        opt,      //ѡ
-                CPU_TS        ts,       //Ϣʱʱ
-                OS_ERR       *p_err)    //ش
+void  OS_QPost (OS_Q         *p_q,      //消息队列指针
+                void         *p_void,   //消息指针
+                OS_MSG_SIZE   msg_size, //消息大小（单位：字节）
+                OS_OPT        opt,      //选项
+                CPU_TS        ts,       //消息被发布时的时间戳
+                OS_ERR       *p_err)    //返回错误类型
 {
     OS_OBJ_QTY     cnt;
     OS_OPT         post_type;
@@ -932,38 +932,38 @@ void  OS_QPost (OS_Q         *p_q,      //
     OS_PEND_DATA  *p_pend_data;
     OS_PEND_DATA  *p_pend_data_next;
     OS_TCB        *p_tcb;
-    CPU_SR_ALLOC();  //ʹõٽΣڹ/жʱʱú꣬ú
-									   //һֲڱжǰ CPU ״̬Ĵ
-									   // SRٽιжֻ豣SRжʱֵԭ
-
-    OS_CRITICAL_ENTER();                              //ٽ
-    p_pend_list = &p_q->PendList;                     //ȡöеĵȴб
-    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {   //ûڵȴö
-        if ((opt & OS_OPT_POST_LIFO) == (OS_OPT)0) {  //Ϣеĩ
+    CPU_SR_ALLOC();  //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+									   //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+									   // SR（临界段关中断只需保存SR），开中断时将该值还原。
+
+    OS_CRITICAL_ENTER();                              //进入临界段
+    p_pend_list = &p_q->PendList;                     //取出该队列的等待列表
+    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {   //如果没有任务在等待该队列
+        if ((opt & OS_OPT_POST_LIFO) == (OS_OPT)0) {  //把消息发布到队列的末端
             post_type = OS_OPT_POST_FIFO;
-        } else {                                      //Ϣеǰ
+        } else {                                      //把消息发布到队列的前端
             post_type = OS_OPT_POST_LIFO;
         }
-        OS_MsgQPut(&p_q->MsgQ,                        //ϢϢ          /* Place message in the message queue                     */
+        OS_MsgQPut(&p_q->MsgQ,                        //把消息放入消息队列          /* Place message in the message queue                     */
                    p_void,
                    msg_size,
                    post_type,
                    ts,
                    p_err);
-        OS_CRITICAL_EXIT();                          //˳ٽ
-        return;                                      //أִ
+        OS_CRITICAL_EXIT();                          //退出临界段
+        return;                                      //返回，执行完毕
     }
-    /* ڵȴö */
-    if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {     //ҪϢеȴ
-        cnt = p_pend_list->NbrEntries;              //ȡȴĿ
-    } else {                                        //ҪϢһȴ
-        cnt = (OS_OBJ_QTY)1;                        //ҪĿΪ1
+    /* 如果有任务在等待该队列 */
+    if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {     //如果要把消息发布给所有等待任务
+        cnt = p_pend_list->NbrEntries;              //获取等待任务数目
+    } else {                                        //如果要把消息发布给一个等待任务
+        cnt = (OS_OBJ_QTY)1;                        //要处理的任务数目为1
     }
-    p_pend_data = p_pend_list->HeadPtr;             //ȡȴбͷ
-    while (cnt > 0u) {                              //ҪĿ
+    p_pend_data = p_pend_list->HeadPtr;             //获取等待列表的头部（任务）
+    while (cnt > 0u) {                              //根据要发布的任务数目逐个发布
         p_tcb            = p_pend_data->TCBPtr;
         p_pend_data_next = p_pend_data->NextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_q),       //Ϣ
+        OS_Post((OS_PEND_OBJ *)((void *)p_q),       //把消息发布给任务
                 p_tcb,
                 p_void,
                 msg_size,
@@ -971,11 +971,11 @@ void  OS_QPost (OS_Q         *p_q,      //
         p_pend_data = p_pend_data_next;
         cnt--;
     }
-    OS_CRITICAL_EXIT_NO_SCHED();                    //˳ٽΣ޵ȣ
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {//ûѡ񡰷겻
-        OSSched();                                  //
+    OS_CRITICAL_EXIT_NO_SCHED();                    //退出临界段（无调度）
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {//如果没选择“发布完不调度任务”
+        OSSched();                                  //任务调度
     }
-   *p_err = OS_ERR_NONE;                            //Ϊ޴
+   *p_err = OS_ERR_NONE;                            //错误类型为“无错误”
 }
 
 #endif
@@ -70,57 +70,57 @@ const  CPU_CHAR  *os_sem__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-void  OSSemCreate (OS_SEM      *p_sem,  //ֵźƿָ
-                   CPU_CHAR    *p_name, //ֵź
-                   OS_SEM_CTR   cnt,    //ԴĿ¼Ƿ־
-                   OS_ERR      *p_err)  //ش
+void  OSSemCreate (OS_SEM      *p_sem,  //多值信号量控制块指针
+                   CPU_CHAR    *p_name, //多值信号量名称
+                   OS_SEM_CTR   cnt,    //资源数目或事件是否发生标志
+                   OS_ERR      *p_err)  //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬úͶһֲ
-                    //ڱжǰ CPU ״̬Ĵ SRٽιжֻ豣SR
-                    //жʱֵԭ 
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和定义一个局部变
+                    //量，用于保存关中断前的 CPU 状态寄存器 SR（临界段关中断只需保存SR）
+                    //，开中断时将该值还原。 
 	
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return;                         //أִ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return;                         //返回，不继续执行
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508                //ʹܣĬϽã˰ȫؼ
-    if (OSSafetyCriticalStartFlag == DEF_TRUE) {  //ڵ OSSafetyCriticalStart() 󴴽öֵź
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;   //ΪǷں˶
-        return;                                   //أִ
+#ifdef OS_SAFETY_CRITICAL_IEC61508                //如果使能（默认禁用）了安全关键
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {  //如果是在调用 OSSafetyCriticalStart() 后创建该多值信号量
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;   //错误类型为“非法创建内核对象”
+        return;                                   //返回，不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u            //ʹܣĬʹܣжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {    //úжб
-       *p_err = OS_ERR_CREATE_ISR;                //ΪжϺжʱ
-        return;                                   //أִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u            //如果使能（默认使能）了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {    //如果该函数是在中断中被调用
+       *p_err = OS_ERR_CREATE_ISR;                //错误类型为“在中断函数中定时”
+        return;                                   //返回，不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u            //ʹܣĬʹܣ˲
-    if (p_sem == (OS_SEM *)0) {       // p_sem Ϊ  
-       *p_err = OS_ERR_OBJ_PTR_NULL;  //ΪֵźΪա
-        return;                       //أִ
+#if OS_CFG_ARG_CHK_EN > 0u            //如果使能（默认使能）了参数检测
+    if (p_sem == (OS_SEM *)0) {       //如果参数 p_sem 为空  
+       *p_err = OS_ERR_OBJ_PTR_NULL;  //错误类型为“多值信号量对象为空”
+        return;                       //返回，不继续执行
     }
 #endif
 
-    OS_CRITICAL_ENTER();               //ٽ
-    p_sem->Type    = OS_OBJ_TYPE_SEM;  //ʼֵźָ  
+    OS_CRITICAL_ENTER();               //进入临界段
+    p_sem->Type    = OS_OBJ_TYPE_SEM;  //初始化多值信号量指标  
     p_sem->Ctr     = cnt;                                 
     p_sem->TS      = (CPU_TS)0;
     p_sem->NamePtr = p_name;                               
-    OS_PendListInit(&p_sem->PendList); //ʼöֵźĵȴб     
+    OS_PendListInit(&p_sem->PendList); //初始化该多值信号量的等待列表     
 
-#if OS_CFG_DBG_EN > 0u       //ʹܣĬʹܣ˵Դͱ 
-    OS_SemDbgListAdd(p_sem); //źӵֵź˫
+#if OS_CFG_DBG_EN > 0u       //如果使能（默认使能）了调试代码和变量 
+    OS_SemDbgListAdd(p_sem); //将该信号量添加到多值信号量双向调试链表
 #endif
-    OSSemQty++;              //ֵź1
+    OSSemQty++;              //多值信号量个数加1
 
-    OS_CRITICAL_EXIT_NO_SCHED();     //˳ٽΣ޵ȣ
-   *p_err = OS_ERR_NONE;             //Ϊ޴
+    OS_CRITICAL_EXIT_NO_SCHED();     //退出临界段（无调度）
+   *p_err = OS_ERR_NONE;             //错误类型为“无错误”
 }
 
 /*$PAGE*/
@@ -159,10 +159,10 @@ void  OSSemCreate (OS_SEM      *p_sem,  //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_SEM_DEL_EN > 0u             //ʹ OSSemDel()  
-OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,  //ֵźָ
-                      OS_OPT   opt,    //ѡ
-                      OS_ERR  *p_err)  //ش
+#if OS_CFG_SEM_DEL_EN > 0u             //如果使能了 OSSemDel() 函数 
+OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,  //多值信号量指针
+                      OS_OPT   opt,    //选项
+                      OS_ERR  *p_err)  //返回错误类型
 {
     OS_OBJ_QTY     cnt;
     OS_OBJ_QTY     nbr_tasks;
@@ -174,67 +174,67 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,  //
 
 
 
-#ifdef OS_SAFETY_CRITICAL                      //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {                //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();        //ִаȫ쳣
-        return ((OS_OBJ_QTY)0);                //0д󣩣ִ
+#ifdef OS_SAFETY_CRITICAL                      //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {                //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();        //执行安全检测异常函数
+        return ((OS_OBJ_QTY)0);                //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_DEL_ISR;                //شΪжɾ
-        return ((OS_OBJ_QTY)0);                //0д󣩣ִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数在中断中被调用
+       *p_err = OS_ERR_DEL_ISR;                //返回错误类型为“在中断中删除”
+        return ((OS_OBJ_QTY)0);                //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                    //ʹ˲
-    if (p_sem == (OS_SEM *)0) {               // p_sem Ϊ
-       *p_err = OS_ERR_OBJ_PTR_NULL;          //شΪں˶Ϊա
-        return ((OS_OBJ_QTY)0);               //0д󣩣ִ
+#if OS_CFG_ARG_CHK_EN > 0u                    //如果使能了参数检测
+    if (p_sem == (OS_SEM *)0) {               //如果 p_sem 为空
+       *p_err = OS_ERR_OBJ_PTR_NULL;          //返回错误类型为“内核对象为空”
+        return ((OS_OBJ_QTY)0);               //返回0（有错误），不继续执行
     }
-    switch (opt) {                            //ѡദ
-        case OS_OPT_DEL_NO_PEND:              //ѡԤ֮
+    switch (opt) {                            //根据选项分类处理
+        case OS_OPT_DEL_NO_PEND:              //如果选项在预期之内
         case OS_OPT_DEL_ALWAYS:
-             break;                           //ֱ
+             break;                           //直接跳出
 
-        default:                              //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;      //شΪѡǷ
-             return ((OS_OBJ_QTY)0);          //0д󣩣ִ
+        default:                              //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;      //返回错误类型为“选项非法”
+             return ((OS_OBJ_QTY)0);          //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u              //ʹ˶ͼ
-    if (p_sem->Type != OS_OBJ_TYPE_SEM) {    // p_sem Ƕֵź
-       *p_err = OS_ERR_OBJ_TYPE;             //شΪں˶ʹ
-        return ((OS_OBJ_QTY)0);              //0д󣩣ִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u              //如果使能了对象类型检测
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {    //如果 p_sem 不是多值信号量类型
+       *p_err = OS_ERR_OBJ_TYPE;             //返回错误类型为“内核对象类型错误”
+        return ((OS_OBJ_QTY)0);              //返回0（有错误），不继续执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                      //ж
-    p_pend_list = &p_sem->PendList;            //ȡźĵȴб p_pend_list
-    cnt         = p_pend_list->NbrEntries;     //ȡȴź
+    CPU_CRITICAL_ENTER();                      //关中断
+    p_pend_list = &p_sem->PendList;            //获取信号量的等待列表到 p_pend_list
+    cnt         = p_pend_list->NbrEntries;     //获取等待该信号量的任务数
     nbr_tasks   = cnt;
-    switch (opt) {                             //ѡദ
-        case OS_OPT_DEL_NO_PEND:               //ֻûȴɾź
-             if (nbr_tasks == (OS_OBJ_QTY)0) { //ûڵȴź
-#if OS_CFG_DBG_EN > 0u                         //ʹ˵Դͱ   
-                 OS_SemDbgListRemove(p_sem);   //źźбƳ
-#endif
-                 OSSemQty--;                   //źĿ1
-                 OS_SemClr(p_sem);             //ź
-                 CPU_CRITICAL_EXIT();          //ж
-                *p_err = OS_ERR_NONE;          //شΪ޴
-             } else {                          //ڵȴź
-                 CPU_CRITICAL_EXIT();          //ж
-                *p_err = OS_ERR_TASK_WAITING;  //شΪڵȴź
+    switch (opt) {                             //根据选项分类处理
+        case OS_OPT_DEL_NO_PEND:               //如果只在没有任务等待的情况下删除信号量
+             if (nbr_tasks == (OS_OBJ_QTY)0) { //如果没有任务在等待该信号量
+#if OS_CFG_DBG_EN > 0u                         //如果使能了调试代码和变量   
+                 OS_SemDbgListRemove(p_sem);   //将该信号量从信号量调试列表移除
+#endif
+                 OSSemQty--;                   //信号量数目减1
+                 OS_SemClr(p_sem);             //清除信号量内容
+                 CPU_CRITICAL_EXIT();          //开中断
+                *p_err = OS_ERR_NONE;          //返回错误类型为“无错误”
+             } else {                          //如果有任务在等待该信号量
+                 CPU_CRITICAL_EXIT();          //开中断
+                *p_err = OS_ERR_TASK_WAITING;  //返回错误类型为“有任务在等待该信号量”
              }
              break;
 
-        case OS_OPT_DEL_ALWAYS:                             //ɾź
-             OS_CRITICAL_ENTER_CPU_EXIT();                  //ж
-             ts = OS_TS_GET();                              //ȡʱ
-             while (cnt > 0u) {                             //Ƴźȴбе
+        case OS_OPT_DEL_ALWAYS:                             //如果必须删除信号量
+             OS_CRITICAL_ENTER_CPU_EXIT();                  //锁调度器，并开中断
+             ts = OS_TS_GET();                              //获取时间戳
+             while (cnt > 0u) {                             //逐个移除该信号量等待列表中的任务
                  p_pend_data = p_pend_list->HeadPtr;
                  p_tcb       = p_pend_data->TCBPtr;
                  OS_PendObjDel((OS_PEND_OBJ *)((void *)p_sem),
@@ -242,22 +242,22 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,  //
                                ts);
                  cnt--;
              }
-#if OS_CFG_DBG_EN > 0u                                      //ʹ˵Դͱ 
-             OS_SemDbgListRemove(p_sem);                    //źźбƳ
-#endif
-             OSSemQty--;                                    //źĿ1
-             OS_SemClr(p_sem);                              //ź
-             OS_CRITICAL_EXIT_NO_SCHED();                   //е
-             OSSched();                                     //ȣִȼľ
-            *p_err = OS_ERR_NONE;                           //شΪ޴
+#if OS_CFG_DBG_EN > 0u                                      //如果使能了调试代码和变量 
+             OS_SemDbgListRemove(p_sem);                    //将该信号量从信号量调试列表移除
+#endif
+             OSSemQty--;                                    //信号量数目减1
+             OS_SemClr(p_sem);                              //清除信号量内容
+             OS_CRITICAL_EXIT_NO_SCHED();                   //减锁调度器，但不进行调度
+             OSSched();                                     //任务调度，执行最高优先级的就绪任务
+            *p_err = OS_ERR_NONE;                           //返回错误类型为“无错误”
              break;
 
-        default:                                            //ѡԤ
-             CPU_CRITICAL_EXIT();                           //ж
-            *p_err = OS_ERR_OPT_INVALID;                    //شΪѡǷ
+        default:                                            //如果选项超出预期
+             CPU_CRITICAL_EXIT();                           //开中断
+            *p_err = OS_ERR_OPT_INVALID;                    //返回错误类型为“选项非法”
              break;
     }
-    return ((OS_OBJ_QTY)nbr_tasks);                         //ɾźǰȴ
+    return ((OS_OBJ_QTY)nbr_tasks);                         //返回删除信号量前等待其的任务数
 }
 #endif
 
@@ -308,11 +308,11 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,  //
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,   //ֵźָ
-                       OS_TICK   timeout, //ȴʱʱ
-                       OS_OPT    opt,     //ѡ
-                       CPU_TS   *p_ts,    //ȵźʱʱ
-                       OS_ERR   *p_err)   //ش
+OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,   //多值信号量指针
+                       OS_TICK   timeout, //等待超时时间
+                       OS_OPT    opt,     //选项
+                       CPU_TS   *p_ts,    //等到信号量时的时间戳
+                       OS_ERR   *p_err)   //返回错误类型
 {
     OS_SEM_CTR    ctr;
     OS_PEND_DATA  pend_data;
@@ -320,119 +320,119 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,   //
 
 
 
-#ifdef OS_SAFETY_CRITICAL                       //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {                 //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();         //ִаȫ쳣
-        return ((OS_SEM_CTR)0);                 //0д󣩣ִ
+#ifdef OS_SAFETY_CRITICAL                       //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {                 //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();         //执行安全检测异常函数
+        return ((OS_SEM_CTR)0);                 //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_PEND_ISR;                //شΪжеȴ
-        return ((OS_SEM_CTR)0);                 //0д󣩣ִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_PEND_ISR;                //返回错误类型为“在中断中等待”
+        return ((OS_SEM_CTR)0);                 //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                     //ʹ˲
-    if (p_sem == (OS_SEM *)0) {                // p_sem Ϊ
-       *p_err = OS_ERR_OBJ_PTR_NULL;           //شΪں˶Ϊա
-        return ((OS_SEM_CTR)0);                //0д󣩣ִ
+#if OS_CFG_ARG_CHK_EN > 0u                     //如果使能了参数检测
+    if (p_sem == (OS_SEM *)0) {                //如果 p_sem 为空
+       *p_err = OS_ERR_OBJ_PTR_NULL;           //返回错误类型为“内核对象为空”
+        return ((OS_SEM_CTR)0);                //返回0（有错误），不继续执行
     }
-    switch (opt) {                             //ѡദ
-        case OS_OPT_PEND_BLOCKING:             //ѡ񡰵ȴж
-        case OS_OPT_PEND_NON_BLOCKING:         //ѡ񡰵ȴ󲻽ж
-             break;                            //ֱ
+    switch (opt) {                             //根据选项分类处理
+        case OS_OPT_PEND_BLOCKING:             //如果选择“等待不到对象进行堵塞”
+        case OS_OPT_PEND_NON_BLOCKING:         //如果选择“等待不到对象不进行堵塞”
+             break;                            //直接跳出，不处理
 
-        default:                               //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;       //شΪѡǷ
-             return ((OS_SEM_CTR)0);           //0д󣩣ִ
+        default:                               //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;       //返回错误类型为“选项非法”
+             return ((OS_SEM_CTR)0);           //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u               //ʹ˶ͼ
-    if (p_sem->Type != OS_OBJ_TYPE_SEM) {     // p_sem Ƕֵź
-       *p_err = OS_ERR_OBJ_TYPE;              //شΪں˶ʹ
-        return ((OS_SEM_CTR)0);               //0д󣩣ִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u               //如果使能了对象类型检测
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {     //如果 p_sem 不是多值信号量类型
+       *p_err = OS_ERR_OBJ_TYPE;              //返回错误类型为“内核对象类型错误”
+        return ((OS_SEM_CTR)0);               //返回0（有错误），不继续执行
     }
 #endif
 
-    if (p_ts != (CPU_TS *)0) {                // p_ts ǿ
-       *p_ts  = (CPU_TS)0;                    //ʼ㣩p_tsڷʱ
+    if (p_ts != (CPU_TS *)0) {                //如果 p_ts 非空
+       *p_ts  = (CPU_TS)0;                    //初始化（清零）p_ts，待用于返回时间戳
     }
-    CPU_CRITICAL_ENTER();                     //ж
-    if (p_sem->Ctr > (OS_SEM_CTR)0) {         //Դ
-        p_sem->Ctr--;                         //ԴĿ1
-        if (p_ts != (CPU_TS *)0) {            // p_ts ǿ
-           *p_ts  = p_sem->TS;                //ȡźһηʱ
+    CPU_CRITICAL_ENTER();                     //关中断
+    if (p_sem->Ctr > (OS_SEM_CTR)0) {         //如果资源可用
+        p_sem->Ctr--;                         //资源数目减1
+        if (p_ts != (CPU_TS *)0) {            //如果 p_ts 非空
+           *p_ts  = p_sem->TS;                //获取该信号量最后一次发布的时间戳
         }
-        ctr   = p_sem->Ctr;                   //ȡźĵǰԴĿ
-        CPU_CRITICAL_EXIT();                  //ж
-       *p_err = OS_ERR_NONE;                  //شΪ޴
-        return (ctr);                         //źĵǰԴĿִ
-    }
-
-    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {    //ûԴãѡ˲
-        ctr   = p_sem->Ctr;                                 //ȡźԴĿ ctr
-        CPU_CRITICAL_EXIT();                                //ж
-       *p_err = OS_ERR_PEND_WOULD_BLOCK;                    //شΪȴ  
-        return (ctr);                                       //źĵǰԴĿִ
-    } else {                                                //ûԴãѡ˶
-        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    //
-            CPU_CRITICAL_EXIT();                            //ж
-           *p_err = OS_ERR_SCHED_LOCKED;                    //شΪ
-            return ((OS_SEM_CTR)0);                         //0д󣩣ִ
+        ctr   = p_sem->Ctr;                   //获取信号量的当前资源数目
+        CPU_CRITICAL_EXIT();                  //开中断
+       *p_err = OS_ERR_NONE;                  //返回错误类型为“无错误”
+        return (ctr);                         //返回信号量的当前资源数目，不继续执行
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {    //如果没有资源可用，而且选择了不堵塞任务
+        ctr   = p_sem->Ctr;                                 //获取信号量的资源数目到 ctr
+        CPU_CRITICAL_EXIT();                                //开中断
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                    //返回错误类型为“等待渴求堵塞”  
+        return (ctr);                                       //返回信号量的当前资源数目，不继续执行
+    } else {                                                //如果没有资源可用，但选择了堵塞任务
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    //如果调度器被锁
+            CPU_CRITICAL_EXIT();                            //开中断
+           *p_err = OS_ERR_SCHED_LOCKED;                    //返回错误类型为“调度器被锁”
+            return ((OS_SEM_CTR)0);                         //返回0（有错误），不继续执行
         }
     }
                                                             
-    OS_CRITICAL_ENTER_CPU_EXIT();                           //ؿж
-    OS_Pend(&pend_data,                                     //ȴ񣬽ǰб
-            (OS_PEND_OBJ *)((void *)p_sem),                 //뵽б͵ȴб
+    OS_CRITICAL_ENTER_CPU_EXIT();                           //锁调度器，并重开中断
+    OS_Pend(&pend_data,                                     //堵塞等待任务，将当前任务脱离就绪列表，
+            (OS_PEND_OBJ *)((void *)p_sem),                 //并插入到节拍列表和等待列表。
             OS_TASK_PEND_ON_SEM,
             timeout);
 
-    OS_CRITICAL_EXIT_NO_SCHED();                            //е
+    OS_CRITICAL_EXIT_NO_SCHED();                            //开调度器，但不进行调度
 
-    OSSched();                                              //ҵȼ
-    /* ǰ񣨻źԼ */
-    CPU_CRITICAL_ENTER();                                   //ж
-    switch (OSTCBCurPtr->PendStatus) {                      //ݵǰĵȴ״̬ദ
-        case OS_STATUS_PEND_OK:                             //ȴ״̬
-             if (p_ts != (CPU_TS *)0) {                     // p_ts ǿ
-                *p_ts  =  OSTCBCurPtr->TS;                  //ȡźűʱ
+    OSSched();                                              //找到并调度最高优先级就绪任务
+    /* 当前任务（获得信号量）得以继续运行 */
+    CPU_CRITICAL_ENTER();                                   //关中断
+    switch (OSTCBCurPtr->PendStatus) {                      //根据当前运行任务的等待状态分类处理
+        case OS_STATUS_PEND_OK:                             //如果等待状态正常
+             if (p_ts != (CPU_TS *)0) {                     //如果 p_ts 非空
+                *p_ts  =  OSTCBCurPtr->TS;                  //获取信号被发布的时间戳
              }
-            *p_err = OS_ERR_NONE;                           //شΪ޴
+            *p_err = OS_ERR_NONE;                           //返回错误类型为“无错误”
              break;
 
-        case OS_STATUS_PEND_ABORT:                          //ȴֹֹ
-             if (p_ts != (CPU_TS *)0) {                     // p_ts ǿ
-                *p_ts  =  OSTCBCurPtr->TS;                  //ȡȴֹʱ
+        case OS_STATUS_PEND_ABORT:                          //如果等待被终止中止
+             if (p_ts != (CPU_TS *)0) {                     //如果 p_ts 非空
+                *p_ts  =  OSTCBCurPtr->TS;                  //获取等待被中止的时间戳
              }
-            *p_err = OS_ERR_PEND_ABORT;                     //شΪȴֹ
+            *p_err = OS_ERR_PEND_ABORT;                     //返回错误类型为“等待被中止”
              break;
 
-        case OS_STATUS_PEND_TIMEOUT:                        //ȴʱ
-             if (p_ts != (CPU_TS *)0) {                     // p_ts ǿ
-                *p_ts  = (CPU_TS  )0;                       // p_ts
+        case OS_STATUS_PEND_TIMEOUT:                        //如果等待超时
+             if (p_ts != (CPU_TS *)0) {                     //如果 p_ts 非空
+                *p_ts  = (CPU_TS  )0;                       //清零 p_ts
              }
-            *p_err = OS_ERR_TIMEOUT;                        //شΪȴʱ
+            *p_err = OS_ERR_TIMEOUT;                        //返回错误类型为“等待超时”
              break;
 
-        case OS_STATUS_PEND_DEL:                            //ȴں˶ɾ
-             if (p_ts != (CPU_TS *)0) {                     // p_ts ǿ
-                *p_ts  =  OSTCBCurPtr->TS;                  //ȡں˶ɾʱ
+        case OS_STATUS_PEND_DEL:                            //如果等待的内核对象被删除
+             if (p_ts != (CPU_TS *)0) {                     //如果 p_ts 非空
+                *p_ts  =  OSTCBCurPtr->TS;                  //获取内核对象被删除的时间戳
              }
-            *p_err = OS_ERR_OBJ_DEL;                        //شΪȴɾ
+            *p_err = OS_ERR_OBJ_DEL;                        //返回错误类型为“等待对象被删除”
              break;
 
-        default:                                            //ȴ״̬Ԥ
-            *p_err = OS_ERR_STATUS_INVALID;                 //شΪȴ״̬Ƿ
-             CPU_CRITICAL_EXIT();                           //ж
-             return ((OS_SEM_CTR)0);                        //0д󣩣ִ
+        default:                                            //如果等待状态超出预期
+            *p_err = OS_ERR_STATUS_INVALID;                 //返回错误类型为“等待状态非法”
+             CPU_CRITICAL_EXIT();                           //开中断
+             return ((OS_SEM_CTR)0);                        //返回0（有错误），不继续执行
     }
-    ctr = p_sem->Ctr;                                       //ȡźĵǰԴĿ
-    CPU_CRITICAL_EXIT();                                    //ж
-    return (ctr);                                           //źĵǰԴĿ
+    ctr = p_sem->Ctr;                                       //获取信号量的当前资源数目
+    CPU_CRITICAL_EXIT();                                    //开中断
+    return (ctr);                                           //返回信号量的当前资源数目
 }
 
 /*$PAGE*/
@@ -467,10 +467,10 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,   //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_SEM_PEND_ABORT_EN > 0u           //ʹ OSSemPendAbort() 
-OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem, //ֵźָ
-                            OS_OPT   opt,   //ѡ
-                            OS_ERR  *p_err) //ش
+#if OS_CFG_SEM_PEND_ABORT_EN > 0u           //如果使能了 OSSemPendAbort() 函数
+OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem, //多值信号量指针
+                            OS_OPT   opt,   //选项
+                            OS_ERR  *p_err) //返回错误类型
 {
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
@@ -480,74 +480,74 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem, //
 
 
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_OBJ_QTY)0u);        //0д󣩣ִ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_OBJ_QTY)0u);        //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) { //úжб
-       *p_err =  OS_ERR_PEND_ABORT_ISR;         //شΪжֹȴ
-        return ((OS_OBJ_QTY)0u);                //0д󣩣ִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) { //如果该函数在中断中被调用
+       *p_err =  OS_ERR_PEND_ABORT_ISR;         //返回错误类型为“在中断中中止等待”
+        return ((OS_OBJ_QTY)0u);                //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                      //ʹ˲
-    if (p_sem == (OS_SEM *)0) {                 // p_sem Ϊ
-       *p_err =  OS_ERR_OBJ_PTR_NULL;           //شΪں˶Ϊա
-        return ((OS_OBJ_QTY)0u);                //0д󣩣ִ
+#if OS_CFG_ARG_CHK_EN > 0u                      //如果使能了参数检测
+    if (p_sem == (OS_SEM *)0) {                 //如果 p_sem 为空
+       *p_err =  OS_ERR_OBJ_PTR_NULL;           //返回错误类型为“内核对象为空”
+        return ((OS_OBJ_QTY)0u);                //返回0（有错误），不继续执行
     }
-    switch (opt) {                                          //ѡദ
-        case OS_OPT_PEND_ABORT_1:                           //ѡԤ
+    switch (opt) {                                          //根据选项分类处理
+        case OS_OPT_PEND_ABORT_1:                           //如果选项在预期内
         case OS_OPT_PEND_ABORT_ALL:
         case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
         case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
-             break;                                         //ֱ
+             break;                                         //不处理，直接跳出
 
-        default:                                            //ѡԤ
-            *p_err =  OS_ERR_OPT_INVALID;                   //شΪѡǷ
-             return ((OS_OBJ_QTY)0u);                       //0д󣩣ִ
+        default:                                            //如果选项超出预期
+            *p_err =  OS_ERR_OPT_INVALID;                   //返回错误类型为“选项非法”
+             return ((OS_OBJ_QTY)0u);                       //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u             //ʹ˶ͼ
-    if (p_sem->Type != OS_OBJ_TYPE_SEM) {   // p_sem Ƕֵź
-       *p_err =  OS_ERR_OBJ_TYPE;           //شΪں˶ʹ
-        return ((OS_OBJ_QTY)0u);            //0д󣩣ִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u             //如果使能了对象类型检测
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {   //如果 p_sem 不是多值信号量类型
+       *p_err =  OS_ERR_OBJ_TYPE;           //返回错误类型为“内核对象类型错误”
+        return ((OS_OBJ_QTY)0u);            //返回0（有错误），不继续执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                             //ж
-    p_pend_list = &p_sem->PendList;                   //ȡ p_sem ĵȴб p_pend_list
-    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0u) {  //ûڵȴ p_sem
-        CPU_CRITICAL_EXIT();                          //ж
-       *p_err =  OS_ERR_PEND_ABORT_NONE;              //شΪûڵȴ
-        return ((OS_OBJ_QTY)0u);                      //0д󣩣ִ
+    CPU_CRITICAL_ENTER();                             //关中断
+    p_pend_list = &p_sem->PendList;                   //获取 p_sem 的等待列表到 p_pend_list
+    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0u) {  //如果没有任务在等待 p_sem
+        CPU_CRITICAL_EXIT();                          //开中断
+       *p_err =  OS_ERR_PEND_ABORT_NONE;              //返回错误类型为“没有任务在等待”
+        return ((OS_OBJ_QTY)0u);                      //返回0（有错误），不继续执行
     }
 
-    OS_CRITICAL_ENTER_CPU_EXIT();                      //ж
+    OS_CRITICAL_ENTER_CPU_EXIT();                      //加锁调度器，并开中断
     nbr_tasks = 0u;
-    ts        = OS_TS_GET();                           //ȡʱ
-    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0u) { //ڵȴ p_sem
-        p_tcb = p_pend_list->HeadPtr->TCBPtr;          //ȡȼߵĵȴ
-        OS_PendAbort((OS_PEND_OBJ *)((void *)p_sem),   //ֹ p_sem ĵȴ
+    ts        = OS_TS_GET();                           //获取时间戳
+    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0u) { //如果有任务在等待 p_sem
+        p_tcb = p_pend_list->HeadPtr->TCBPtr;          //获取优先级最高的等待任务
+        OS_PendAbort((OS_PEND_OBJ *)((void *)p_sem),   //中止该任务对 p_sem 的等待
                      p_tcb,
                      ts);
         nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {            //ѡֹеȴ
-            break;                                     //ټֹ
+        if (opt != OS_OPT_PEND_ABORT_ALL) {            //如果不是选择了中止所有等待任务
+            break;                                     //立即跳出，不再继续中止
         }
     }
-    OS_CRITICAL_EXIT_NO_SCHED();                       //
+    OS_CRITICAL_EXIT_NO_SCHED();                       //减锁调度器，但不调度
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) {  //ѡ
-        OSSched();                                     //
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) {  //如果选择了任务调度
+        OSSched();                                     //进行任务调度
     }
 
-   *p_err = OS_ERR_NONE;   //شΪ޴
-    return (nbr_tasks);    //رֹĿ
+   *p_err = OS_ERR_NONE;   //返回错误类型为“无错误”
+    return (nbr_tasks);    //返回被中止的任务数目
 }
 #endif
 
@@ -581,52 +581,52 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem, //
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,    //ֵźƿָ
-                       OS_OPT   opt,      //ѡ
-                       OS_ERR  *p_err)    //ش
+OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,    //多值信号量控制块指针
+                       OS_OPT   opt,      //选项
+                       OS_ERR  *p_err)    //返回错误类型
 {
     OS_SEM_CTR  ctr;
     CPU_TS      ts;
 
 
 
-#ifdef OS_SAFETY_CRITICAL                 //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {           //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();   //ִаȫ쳣
-        return ((OS_SEM_CTR)0);           //0д󣩣ִ
+#ifdef OS_SAFETY_CRITICAL                 //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {           //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();   //执行安全检测异常函数
+        return ((OS_SEM_CTR)0);           //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                //ʹܣĬʹܣ˲⹦   
-    if (p_sem == (OS_SEM *)0) {           // p_sem Ϊ
-       *p_err  = OS_ERR_OBJ_PTR_NULL;     //شΪں˶ָΪա
-        return ((OS_SEM_CTR)0);           //0д󣩣ִ
+#if OS_CFG_ARG_CHK_EN > 0u                //如果使能（默认使能）了参数检测功能   
+    if (p_sem == (OS_SEM *)0) {           //如果 p_sem 为空
+       *p_err  = OS_ERR_OBJ_PTR_NULL;     //返回错误类型为“内核对象指针为空”
+        return ((OS_SEM_CTR)0);           //返回0（有错误），不继续执行
     }
-    switch (opt) {                                   //ѡദ
-        case OS_OPT_POST_1:                          //ѡԤڣ
+    switch (opt) {                                   //根据选项情况分类处理
+        case OS_OPT_POST_1:                          //如果选项在预期内，不处理
         case OS_OPT_POST_ALL:
         case OS_OPT_POST_1   | OS_OPT_POST_NO_SCHED:
         case OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
              break;
 
-        default:                                     //ѡԤ
-            *p_err =  OS_ERR_OPT_INVALID;            //شΪѡǷ
-             return ((OS_SEM_CTR)0u);                //0д󣩣ִ
+        default:                                     //如果选项超出预期
+            *p_err =  OS_ERR_OPT_INVALID;            //返回错误类型为“选项非法”
+             return ((OS_SEM_CTR)0u);                //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //ʹ˶ͼ           
-    if (p_sem->Type != OS_OBJ_TYPE_SEM) {  // p_sem ͲǶֵź
-       *p_err = OS_ERR_OBJ_TYPE;           //شΪʹ
-        return ((OS_SEM_CTR)0);            //0д󣩣ִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //如果使能了对象类型检测           
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {  //如果 p_sem 的类型不是多值信号量类型
+       *p_err = OS_ERR_OBJ_TYPE;           //返回错误类型为“对象类型错误”
+        return ((OS_SEM_CTR)0);            //返回0（有错误），不继续执行
     }
 #endif
 
-    ts = OS_TS_GET();                             //ȡʱ
+    ts = OS_TS_GET();                             //获取时间戳
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u              //ʹжӳٷ
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {    //úжб
-        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_SEM, //źжϢ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u              //如果使能了中断延迟发布
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {    //如果该函数是在中断中被调用
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_SEM, //将该信号量发布到中断消息队列
                     (void      *)p_sem,
                     (void      *)0,
                     (OS_MSG_SIZE)0,
@@ -634,16 +634,16 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,    //
                     (OS_OPT     )opt,
                     (CPU_TS     )ts,
                     (OS_ERR    *)p_err);
-        return ((OS_SEM_CTR)0);                   //0δִ        
+        return ((OS_SEM_CTR)0);                   //返回0（尚未发布），不继续执行        
     }
 #endif
 
-    ctr = OS_SemPost(p_sem,                       //źͨʽ
+    ctr = OS_SemPost(p_sem,                       //将信号量按照普通方式处理
                      opt,
                      ts,
                      p_err);
 
-    return (ctr);                                 //źŵĵǰֵ
+    return (ctr);                                 //返回信号的当前计数值
 }
 
 /*$PAGE*/
@@ -672,54 +672,54 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,    //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_SEM_SET_EN > 0u           //ʹ OSSemSet() 
-void  OSSemSet (OS_SEM      *p_sem,  //ֵźָ
-                OS_SEM_CTR   cnt,    //źֵ
-                OS_ERR      *p_err)  //ش
+#if OS_CFG_SEM_SET_EN > 0u           //如果使能 OSSemSet() 函数
+void  OSSemSet (OS_SEM      *p_sem,  //多值信号量指针
+                OS_SEM_CTR   cnt,    //信号量计数值
+                OS_ERR      *p_err)  //返回错误类型
 {
     OS_PEND_LIST  *p_pend_list;
     CPU_SR_ALLOC();
 
 
 
-#ifdef OS_SAFETY_CRITICAL                //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return;                          //0д󣩣ִ
+#ifdef OS_SAFETY_CRITICAL                //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return;                          //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_SET_ISR;                 //شΪжá
-        return;                                 //0д󣩣ִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_SET_ISR;                 //返回错误类型为“在中断中设置”
+        return;                                 //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u            //ʹ˲
-    if (p_sem == (OS_SEM *)0) {       // p_sem Ϊ
-       *p_err = OS_ERR_OBJ_PTR_NULL;  //شΪں˶Ϊա
-        return;                       //0д󣩣ִ
+#if OS_CFG_ARG_CHK_EN > 0u            //如果使能了参数检测
+    if (p_sem == (OS_SEM *)0) {       //如果 p_sem 为空
+       *p_err = OS_ERR_OBJ_PTR_NULL;  //返回错误类型为“内核对象为空”
+        return;                       //返回0（有错误），不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //ʹ˶ͼ
-    if (p_sem->Type != OS_OBJ_TYPE_SEM) {  // p_sem Ƕֵź 
-       *p_err = OS_ERR_OBJ_TYPE;           //شΪں˶ʹ
-        return;                            //0д󣩣ִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //如果使能了对象类型检测
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {  //如果 p_sem 不是多值信号量类型 
+       *p_err = OS_ERR_OBJ_TYPE;           //返回错误类型为“内核对象类型错误”
+        return;                            //返回0（有错误），不继续执行
     }
 #endif
 
-   *p_err = OS_ERR_NONE;                               //شΪ޴
-    CPU_CRITICAL_ENTER();                              //ж
-    if (p_sem->Ctr > (OS_SEM_CTR)0) {                  //źֵ>0˵û
-        p_sem->Ctr = cnt;                              //ȴֱüֵ
-    } else {                                           //źֵ=0
-        p_pend_list = &p_sem->PendList;                //ȡźĵȴб
-        if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {//ûڵȴź
-            p_sem->Ctr = cnt;                          //ֱźżֵ
-        } else {                                       //ڵȴź
-           *p_err      = OS_ERR_TASK_WAITING;          //شΪȴ
+   *p_err = OS_ERR_NONE;                               //返回错误类型为“无错误”
+    CPU_CRITICAL_ENTER();                              //关中断
+    if (p_sem->Ctr > (OS_SEM_CTR)0) {                  //如果信号量计数值>0，说明没
+        p_sem->Ctr = cnt;                              //被等待可以直接设置计数值。
+    } else {                                           //如果信号量计数值=0
+        p_pend_list = &p_sem->PendList;                //获取信号量的等待列表
+        if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {//如果没任务在等待信号量
+            p_sem->Ctr = cnt;                          //可以直接设置信号计数值
+        } else {                                       //如果有任务在等待信号量
+           *p_err      = OS_ERR_TASK_WAITING;          //返回错误类型为“有任务等待”
         }
     }
     CPU_CRITICAL_EXIT();
@@ -768,18 +768,18 @@ void  OS_SemClr (OS_SEM  *p_sem)
 */
 
 
-#if OS_CFG_DBG_EN > 0u                   //ʹܣĬʹܣ˵Դͱ      
-void  OS_SemDbgListAdd (OS_SEM  *p_sem)  //öֵź뵽ֵźбǰ
+#if OS_CFG_DBG_EN > 0u                   //如果使能（默认使能）了调试代码和变量      
+void  OS_SemDbgListAdd (OS_SEM  *p_sem)  //将该多值信号量插入到多值信号量列表的最前端
 {
-    p_sem->DbgNamePtr               = (CPU_CHAR *)((void *)" "); //Ȳָκ
-    p_sem->DbgPrevPtr               = (OS_SEM   *)0;             //źΪбǰ
-    if (OSSemDbgListPtr == (OS_SEM *)0) {                        //бΪ
-        p_sem->DbgNextPtr           = (OS_SEM   *)0;             //źһԪҲΪ
-    } else {                                                     //бǿ
-        p_sem->DbgNextPtr           =  OSSemDbgListPtr;          //бԭԪΪźһԪ
-        OSSemDbgListPtr->DbgPrevPtr =  p_sem;                    //ԭԪصǰΪ˸ź
-    }
-    OSSemDbgListPtr                 =  p_sem;                    //źΪбԪ
+    p_sem->DbgNamePtr               = (CPU_CHAR *)((void *)" "); //先不指向任何任务的名称
+    p_sem->DbgPrevPtr               = (OS_SEM   *)0;             //将该信号量作为列表的最前端
+    if (OSSemDbgListPtr == (OS_SEM *)0) {                        //如果列表为空
+        p_sem->DbgNextPtr           = (OS_SEM   *)0;             //该信号量的下一个元素也为空
+    } else {                                                     //如果列表非空
+        p_sem->DbgNextPtr           =  OSSemDbgListPtr;          //列表原来的首元素作为该信号量的下一个元素
+        OSSemDbgListPtr->DbgPrevPtr =  p_sem;                    //原来的首元素的前面变为了该信号量
+    }
+    OSSemDbgListPtr                 =  p_sem;                    //该信号量成为列表的新首元素
 }
 
 
@@ -881,10 +881,10 @@ void  OS_SemInit (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem, //ֵźָ
-                        OS_OPT   opt,   //ѡ
-                        CPU_TS   ts,    //ʱ
-                        OS_ERR  *p_err) //ش
+OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem, //多值信号量指针
+                        OS_OPT   opt,   //选项
+                        CPU_TS   ts,    //时间戳
+                        OS_ERR  *p_err) //返回错误类型
 {
     OS_OBJ_QTY     cnt;
     OS_SEM_CTR     ctr;
@@ -896,13 +896,13 @@ OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem, //
 
 
 
-    CPU_CRITICAL_ENTER();                                   //ж
-    p_pend_list = &p_sem->PendList;                         //ȡźĵȴб
-    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {         //ûڵȴź
-        switch (sizeof(OS_SEM_CTR)) {                       //жǷ񽫵¸źֵ
-            case 1u:                                        //жϣشΪ
-                 if (p_sem->Ctr == DEF_INT_08U_MAX_VAL) {   //ֵ0д󣩣
-                     CPU_CRITICAL_EXIT();                   //ִС
+    CPU_CRITICAL_ENTER();                                   //关中断
+    p_pend_list = &p_sem->PendList;                         //取出该信号量的等待列表
+    if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {         //如果没有任务在等待该信号量
+        switch (sizeof(OS_SEM_CTR)) {                       //判断是否将导致该信号量计数值溢出，
+            case 1u:                                        //如果溢出，则开中断，返回错误类型为
+                 if (p_sem->Ctr == DEF_INT_08U_MAX_VAL) {   //“计数值溢出”，返回0（有错误），
+                     CPU_CRITICAL_EXIT();                   //不继续执行。
                     *p_err = OS_ERR_SEM_OVF;
                      return ((OS_SEM_CTR)0);
                  }
@@ -927,39 +927,39 @@ OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem, //
             default:
                  break;
         }
-        p_sem->Ctr++;                                       //źֵ1
-        ctr       = p_sem->Ctr;                             //ȡźֵ ctr
-        p_sem->TS = ts;                                     //ʱ
-        CPU_CRITICAL_EXIT();                                //ж
-       *p_err     = OS_ERR_NONE;                            //شΪ޴
-        return (ctr);                                       //źļִֵ
-    }
-
-    OS_CRITICAL_ENTER_CPU_EXIT();                           //ж
-    if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {             //Ҫźеȴ
-        cnt = p_pend_list->NbrEntries;                      //ȡȴĿ cnt
-    } else {                                                //Ҫźȼߵĵȴ
-        cnt = (OS_OBJ_QTY)1;                                //ҪΪ1cnt 1
-    }
-    p_pend_data = p_pend_list->HeadPtr;                     //ȡȴб׸ p_pend_data
-    while (cnt > 0u) {                                      //Ҫ
-        p_tcb            = p_pend_data->TCBPtr;             //ȡǰ
-        p_pend_data_next = p_pend_data->NextPtr;            //ȡһ
-        OS_Post((OS_PEND_OBJ *)((void *)p_sem),             //źǰ
+        p_sem->Ctr++;                                       //信号量计数值不溢出则加1
+        ctr       = p_sem->Ctr;                             //获取信号量计数值到 ctr
+        p_sem->TS = ts;                                     //保存时间戳
+        CPU_CRITICAL_EXIT();                                //则开中断
+       *p_err     = OS_ERR_NONE;                            //返回错误类型为“无错误”
+        return (ctr);                                       //返回信号量的计数值，不继续执行
+    }
+
+    OS_CRITICAL_ENTER_CPU_EXIT();                           //加锁调度器，但开中断
+    if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {             //如果要将信号量发布给所有等待任务
+        cnt = p_pend_list->NbrEntries;                      //获取等待任务数目到 cnt
+    } else {                                                //如果要将信号量发布给优先级最高的等待任务
+        cnt = (OS_OBJ_QTY)1;                                //将要操作的任务数为1，cnt 置1
+    }
+    p_pend_data = p_pend_list->HeadPtr;                     //获取等待列表的首个任务到 p_pend_data
+    while (cnt > 0u) {                                      //逐个处理要发布的任务
+        p_tcb            = p_pend_data->TCBPtr;             //取出当前任务
+        p_pend_data_next = p_pend_data->NextPtr;            //取出下一个任务
+        OS_Post((OS_PEND_OBJ *)((void *)p_sem),             //发布信号量给当前任务
                 p_tcb,
                 (void      *)0,
                 (OS_MSG_SIZE)0,
                 ts);
-        p_pend_data = p_pend_data_next;                     //һ          
+        p_pend_data = p_pend_data_next;                     //处理下一个任务          
         cnt--;
     }
-    ctr = p_sem->Ctr;                                       //ȡźֵ ctr
-    OS_CRITICAL_EXIT_NO_SCHED();                            //ִ
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {        // opt ûѡ񡰷ʱ
-        OSSched();                                          //
+    ctr = p_sem->Ctr;                                       //获取信号量计数值到 ctr
+    OS_CRITICAL_EXIT_NO_SCHED();                            //减锁调度器，但不执行任务调度
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {        //如果 opt 没选择“发布时不调度任务”
+        OSSched();                                          //任务调度
     }
-   *p_err = OS_ERR_NONE;                                    //شΪ޴
-    return (ctr);                                           //źĵǰֵ
+   *p_err = OS_ERR_NONE;                                    //返回错误类型为“无错误”
+    return (ctr);                                           //返回信号量的当前计数值
 }
 
 #endif
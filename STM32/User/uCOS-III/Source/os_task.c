@@ -58,105 +58,105 @@ const  CPU_CHAR  *os_task__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_CHANGE_PRIO_EN > 0u           //ʹ˺ OSTaskChangePrio()
-void  OSTaskChangePrio (OS_TCB   *p_tcb,      //Ŀƿָ
-                        OS_PRIO   prio_new,   //ȼ
-                        OS_ERR   *p_err)      //ش
+#if OS_CFG_TASK_CHANGE_PRIO_EN > 0u           //如果使能了函数 OSTaskChangePrio()
+void  OSTaskChangePrio (OS_TCB   *p_tcb,      //目标任务的任务控制块指针
+                        OS_PRIO   prio_new,   //新优先级
+                        OS_ERR   *p_err)      //返回错误类型
 {
     CPU_BOOLEAN   self;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                       //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {                 // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();         //ִаȫ쳣
-        return;                                 //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                       //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {                 //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();         //执行安全检测异常函数
+        return;                                 //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_TASK_CHANGE_PRIO_ISR;    //Ϊжиıȼ
-        return;                                 //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_TASK_CHANGE_PRIO_ISR;    //错误类型为“在中断中改变优先级”
+        return;                                 //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u            //ʹжӳٷ
-    if (prio_new == 0) {                        // prio_new Ϊ0
-       *p_err = OS_ERR_PRIO_INVALID;            //ΪȼǷ
-        return;                                 //أִֹͣ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u            //如果使能了中断延迟发布
+    if (prio_new == 0) {                        //如果 prio_new 为0
+       *p_err = OS_ERR_PRIO_INVALID;            //错误类型为“优先级非法”
+        return;                                 //返回，停止执行
     }
 #endif
 
-    if (prio_new >= (OS_CFG_PRIO_MAX - 1u)) {   // prio_new ƷΧ
-       *p_err = OS_ERR_PRIO_INVALID;            //ΪȼǷ
-        return;                                 //أִֹͣ
+    if (prio_new >= (OS_CFG_PRIO_MAX - 1u)) {   //如果 prio_new 超出限制范围
+       *p_err = OS_ERR_PRIO_INVALID;            //错误类型为“优先级非法”
+        return;                                 //返回，停止执行
     }
 
-    if (p_tcb == (OS_TCB *)0) {                 // p_tcb Ϊ
-        CPU_CRITICAL_ENTER();                   //ж
-        p_tcb = OSTCBCurPtr;                    //ĿΪǰ
-        CPU_CRITICAL_EXIT();                    //ж
-        self  = DEF_TRUE;                       //Ŀ
-    } else {                                    // p_tcb ǿ
-        self  = DEF_FALSE;                      //Ŀ
+    if (p_tcb == (OS_TCB *)0) {                 //如果 p_tcb 为空
+        CPU_CRITICAL_ENTER();                   //关中断
+        p_tcb = OSTCBCurPtr;                    //目标任务为当前任务（自身）
+        CPU_CRITICAL_EXIT();                    //开中断
+        self  = DEF_TRUE;                       //目标任务是自身
+    } else {                                    //如果 p_tcb 非空
+        self  = DEF_FALSE;                      //目标任务不是自身
     }
 
-    OS_CRITICAL_ENTER();                        //ٽ
-    switch (p_tcb->TaskState) {                 //Ŀ״̬ദ
-        case OS_TASK_STATE_RDY:                 //Ǿ״̬
-             OS_RdyListRemove(p_tcb);           //ӾбƳ
-             p_tcb->Prio = prio_new;            //Ϊȼ
-             OS_PrioInsert(p_tcb->Prio);        //ȼнȼλ1
-             if (self == DEF_TRUE) {            //Ŀ
-                 OS_RdyListInsertHead(p_tcb);   //Ŀбͷ
-             } else {                           //Ŀ
-                 OS_RdyListInsertTail(p_tcb);   //Ŀбβ
+    OS_CRITICAL_ENTER();                        //进入临界段
+    switch (p_tcb->TaskState) {                 //根据目标任务状态分类处理
+        case OS_TASK_STATE_RDY:                 //如果是就绪状态
+             OS_RdyListRemove(p_tcb);           //将任务从就绪列表移除
+             p_tcb->Prio = prio_new;            //为任务设置新优先级
+             OS_PrioInsert(p_tcb->Prio);        //在优先级表格中将该优先级位置1
+             if (self == DEF_TRUE) {            //如果目标任务是自身
+                 OS_RdyListInsertHead(p_tcb);   //将目标任务插至就绪列表头端
+             } else {                           //如果目标任务不是自身
+                 OS_RdyListInsertTail(p_tcb);   //将目标任务插至就绪列表尾端
              }
-             break;                             //
+             break;                             //跳出
 
-        case OS_TASK_STATE_DLY:                 //ʱ״̬   
-        case OS_TASK_STATE_SUSPENDED:           //ǹ״̬
-        case OS_TASK_STATE_DLY_SUSPENDED:       //ʱб״̬
-             p_tcb->Prio = prio_new;            //ֱ޸ȼ
-             break;                             //
+        case OS_TASK_STATE_DLY:                 //如果是延时状态   
+        case OS_TASK_STATE_SUSPENDED:           //如果是挂起状态
+        case OS_TASK_STATE_DLY_SUSPENDED:       //如果是延时中被挂起状态
+             p_tcb->Prio = prio_new;            //直接修改任务的优先级
+             break;                             //跳出
 
-        case OS_TASK_STATE_PEND:                //ȴ״̬
+        case OS_TASK_STATE_PEND:                //如果包含等待状态
         case OS_TASK_STATE_PEND_TIMEOUT:
         case OS_TASK_STATE_PEND_SUSPENDED:
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             switch (p_tcb->PendOn) {          //ȴĶദ
-                 case OS_TASK_PEND_ON_TASK_Q:  //ȴϢ
-                 case OS_TASK_PEND_ON_TASK_SEM://ȴź
-                 case OS_TASK_PEND_ON_FLAG:    //ȴ¼־
-                      p_tcb->Prio = prio_new;  //ֱ޸ȼ
-                      break;                   //
-
-                 case OS_TASK_PEND_ON_MUTEX:   //ȴǻź
-                 case OS_TASK_PEND_ON_MULTI:   //ȴǶں˶
-                 case OS_TASK_PEND_ON_Q:       //ȴϢ
-                 case OS_TASK_PEND_ON_SEM:     //ȴǶֵź
-                      OS_PendListChangePrio(p_tcb,    //ıȼ
-                                            prio_new);//ڵȴбеλá
-                      break;                   //
+             switch (p_tcb->PendOn) {          //根据任务等待的对象分类处理
+                 case OS_TASK_PEND_ON_TASK_Q:  //如果等待的是任务消息
+                 case OS_TASK_PEND_ON_TASK_SEM://如果等待的是任务信号量
+                 case OS_TASK_PEND_ON_FLAG:    //如果等待的是事件标志组
+                      p_tcb->Prio = prio_new;  //直接修改任务的优先级
+                      break;                   //跳出
+
+                 case OS_TASK_PEND_ON_MUTEX:   //如果等待的是互斥信号量
+                 case OS_TASK_PEND_ON_MULTI:   //如果等待的是多个内核对象
+                 case OS_TASK_PEND_ON_Q:       //如果等待的是消息队列
+                 case OS_TASK_PEND_ON_SEM:     //如果等待的是多值信号量
+                      OS_PendListChangePrio(p_tcb,    //改变任务的优先级和
+                                            prio_new);//在等待列表中的位置。
+                      break;                   //跳出
  
-                 default:                      //ȴĶ󳬳Ԥ
-                      break;                   //ֱ
+                 default:                      //如果任务等待的对象超出预期
+                      break;                   //直接跳出
             }
-             break;                            //
+             break;                            //跳出
  
-        default:                               //Ŀ״̬Ԥ
-             OS_CRITICAL_EXIT();               //˳ٽ
-            *p_err = OS_ERR_STATE_INVALID;     //Ϊ״̬Ƿ
-             return;                           //أִֹͣ
+        default:                               //如果目标任务状态超出预期
+             OS_CRITICAL_EXIT();               //退出临界段
+            *p_err = OS_ERR_STATE_INVALID;     //错误类型为“状态非法”
+             return;                           //返回，停止执行
     }
 
-    OS_CRITICAL_EXIT_NO_SCHED();               //˳ٽΣ޵ȣ
+    OS_CRITICAL_EXIT_NO_SCHED();               //退出临界段（无调度）
 
-    OSSched();                                 //
+    OSSched();                                 //调度任务
 
-   *p_err = OS_ERR_NONE;                       //Ϊ޴
+   *p_err = OS_ERR_NONE;                       //错误类型为“无错误”
 }
 #endif
 
@@ -246,19 +246,19 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,      //Ŀ
 ************************************************************************************************************************
 */
 /*$PAGE*/
-void  OSTaskCreate (OS_TCB        *p_tcb,        //ƿָ
-                    CPU_CHAR      *p_name,       //
-                    OS_TASK_PTR    p_task,       //
-                    void          *p_arg,        //ݸĲ
-                    OS_PRIO        prio,         //ȼ
-                    CPU_STK       *p_stk_base,   //ջַ
-                    CPU_STK_SIZE   stk_limit,    //ջʣ
-                    CPU_STK_SIZE   stk_size,     //ջС
-                    OS_MSG_QTY     q_size,       //Ϣ
-                    OS_TICK        time_quanta,  //ʱƬ
-                    void          *p_ext,        //չ
-                    OS_OPT         opt,          //ѡ
-                    OS_ERR        *p_err)        //ش
+void  OSTaskCreate (OS_TCB        *p_tcb,        //任务控制块指针
+                    CPU_CHAR      *p_name,       //命名任务
+                    OS_TASK_PTR    p_task,       //任务函数
+                    void          *p_arg,        //传递给任务函数的参数
+                    OS_PRIO        prio,         //任务优先级
+                    CPU_STK       *p_stk_base,   //任务堆栈基地址
+                    CPU_STK_SIZE   stk_limit,    //堆栈的剩余限制
+                    CPU_STK_SIZE   stk_size,     //堆栈大小
+                    OS_MSG_QTY     q_size,       //任务消息容量
+                    OS_TICK        time_quanta,  //时间片
+                    void          *p_ext,        //任务扩展
+                    OS_OPT         opt,          //选项
+                    OS_ERR        *p_err)        //返回错误类型
 {
     CPU_STK_SIZE   i;
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
@@ -274,90 +274,90 @@ void  OSTaskCreate (OS_TCB        *p_tcb,        //
 
 
 
-#ifdef OS_SAFETY_CRITICAL                             //ʹ˰ȫ         
-    if (p_err == (OS_ERR *)0) {                       //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();               //ִаȫ쳣
-        return;                                       //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                             //如果使能了安全检测         
+    if (p_err == (OS_ERR *)0) {                       //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();               //执行安全检测异常函数
+        return;                                       //返回，停止执行
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508                    //ʹ˰ȫؼ
-    if (OSSafetyCriticalStartFlag == DEF_TRUE) {      //ڵOSSafetyCriticalStart()󴴽
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;       //ΪǷں˶
-        return;                                       //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL_IEC61508                    //如果使能了安全关键
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {      //如果在调用OSSafetyCriticalStart()后创建
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;       //错误类型为“非法创建内核对象”
+        return;                                       //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u                //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {        //úжб
-       *p_err = OS_ERR_TASK_CREATE_ISR;               //Ϊжд
-        return;                                       //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u                //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {        //如果该函数是在中断中被调用
+       *p_err = OS_ERR_TASK_CREATE_ISR;               //错误类型为“在中断中创建对象”
+        return;                                       //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                            //ʹ˲      
-    if (p_tcb == (OS_TCB *)0) {                       // p_tcb Ϊ     
-       *p_err = OS_ERR_TCB_INVALID;                   //ΪƿǷ
-        return;                                       //أִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                            //如果使能了参数检测      
+    if (p_tcb == (OS_TCB *)0) {                       //如果 p_tcb 为空     
+       *p_err = OS_ERR_TCB_INVALID;                   //错误类型为“任务控制块非法”
+        return;                                       //返回，停止执行
     }
-    if (p_task == (OS_TASK_PTR)0) {                   // p_task Ϊ
-       *p_err = OS_ERR_TASK_INVALID;                  //ΪǷ
-        return;                                       //أִֹͣ
+    if (p_task == (OS_TASK_PTR)0) {                   //如果 p_task 为空
+       *p_err = OS_ERR_TASK_INVALID;                  //错误类型为“任务函数非法”
+        return;                                       //返回，停止执行
     }
-    if (p_stk_base == (CPU_STK *)0) {                 // p_stk_base Ϊ      
-       *p_err = OS_ERR_STK_INVALID;                   //ΪջǷ
-        return;                                       //أִֹͣ
+    if (p_stk_base == (CPU_STK *)0) {                 //如果 p_stk_base 为空      
+       *p_err = OS_ERR_STK_INVALID;                   //错误类型为“任务堆栈非法”
+        return;                                       //返回，停止执行
     }
-    if (stk_size < OSCfg_StkSizeMin) {                      //ĶջռССҪ
-       *p_err = OS_ERR_STK_SIZE_INVALID;                    //ΪջռǷ
-        return;                                             //أִֹͣ
+    if (stk_size < OSCfg_StkSizeMin) {                      //如果分配给任务的堆栈空间小于最小要求
+       *p_err = OS_ERR_STK_SIZE_INVALID;                    //错误类型为“任务堆栈空间非法”
+        return;                                             //返回，停止执行
     }
-    if (stk_limit >= stk_size) {                            //ջƿռռջ
-       *p_err = OS_ERR_STK_LIMIT_INVALID;                   //ΪջƷǷ
-        return;                                             //أִֹͣ
+    if (stk_limit >= stk_size) {                            //如果堆栈限制空间占尽了整个堆栈
+       *p_err = OS_ERR_STK_LIMIT_INVALID;                   //错误类型为“堆栈限制非法”
+        return;                                             //返回，停止执行
     }
-    if (prio >= OS_CFG_PRIO_MAX) {                          //ȼƷΧ     
-       *p_err = OS_ERR_PRIO_INVALID;                        //ΪiȼǷ
-        return;                                             //أִֹͣ
+    if (prio >= OS_CFG_PRIO_MAX) {                          //如果任务优先级超出了限制范围     
+       *p_err = OS_ERR_PRIO_INVALID;                        //错误类型为i“优先级非法”
+        return;                                             //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                        //ʹжӳٷ
-    if (prio == (OS_PRIO)0) {                               //ȼ0жӳύ裩
-        if (p_tcb != &OSIntQTaskTCB) {                      // p_tcb жӳύ
-           *p_err = OS_ERR_PRIO_INVALID;                    //ΪȼǷ
-            return;                                         //أִֹͣ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                        //如果使能了中断延迟发布
+    if (prio == (OS_PRIO)0) {                               //如果优先级是0（中断延迟提交任务所需）
+        if (p_tcb != &OSIntQTaskTCB) {                      //如果 p_tcb 不是中断延迟提交任务
+           *p_err = OS_ERR_PRIO_INVALID;                    //错误类型为“优先级非法”
+            return;                                         //返回，停止执行
         }
     }
 #endif
 
-    if (prio == (OS_CFG_PRIO_MAX - 1u)) {                   //ȼΪͣ裩
-        if (p_tcb != &OSIdleTaskTCB) {                      // p_tcb ǿ
-           *p_err = OS_ERR_PRIO_INVALID;                    //ΪȼǷ
-            return;                                         //أִֹͣ
+    if (prio == (OS_CFG_PRIO_MAX - 1u)) {                   //如果任务的优先级为最低（空闲任务所需）
+        if (p_tcb != &OSIdleTaskTCB) {                      //如果 p_tcb 不是空闲任务
+           *p_err = OS_ERR_PRIO_INVALID;                    //错误类型为“优先级非法”
+            return;                                         //返回，停止执行
         }
     }
 
-    OS_TaskInitTCB(p_tcb);                                  //ʼƿ p_tcb
+    OS_TaskInitTCB(p_tcb);                                  //初始化任务控制块 p_tcb
 
-   *p_err = OS_ERR_NONE;                                    //Ϊ޴
+   *p_err = OS_ERR_NONE;                                    //错误类型为“无错误”
     
-    if ((opt & OS_OPT_TASK_STK_CHK) != (OS_OPT)0) {         //ѡ˼ջ
-        if ((opt & OS_OPT_TASK_STK_CLR) != (OS_OPT)0) {     //ѡջ
-            p_sp = p_stk_base;                              //ȡջĻַ
-            for (i = 0u; i < stk_size; i++) {               //ջ飩Ԫ
+    if ((opt & OS_OPT_TASK_STK_CHK) != (OS_OPT)0) {         //如果选择了检测堆栈
+        if ((opt & OS_OPT_TASK_STK_CLR) != (OS_OPT)0) {     //如果选择了清零堆栈
+            p_sp = p_stk_base;                              //获取堆栈的基地址
+            for (i = 0u; i < stk_size; i++) {               //将堆栈（数组）元素逐个清零
                *p_sp = (CPU_STK)0;                          
                 p_sp++;
             }
         }
     }
-    /* ʼĶջṹ */                                               
-#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)         // CPU ջΪӸߵ
-    p_stk_limit = p_stk_base + stk_limit;                   //ջƿռ俿ջĵ͵ַ
-#else                                                       // CPU ջΪӵ͵
-    p_stk_limit = p_stk_base + (stk_size - 1u) - stk_limit; //ջƿռ俿ջĸߵַ
+    /* 初始化任务的堆栈结构 */                                               
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)         //如果 CPU 的栈增长方向为从高到低
+    p_stk_limit = p_stk_base + stk_limit;                   //堆栈限制空间靠堆栈的低地址端
+#else                                                       //如果 CPU 的栈增长方向为从低到高
+    p_stk_limit = p_stk_base + (stk_size - 1u) - stk_limit; //堆栈限制空间靠堆栈的高地址端
 #endif
-    /* ʼջ */
+    /* 初始化任务堆栈 */
     p_sp = OSTaskStkInit(p_task,                            
                          p_arg,
                          p_stk_base,
@@ -365,44 +365,44 @@ void  OSTaskCreate (OS_TCB        *p_tcb,        //
                          stk_size,
                          opt);
 
-    /* ʼƿ */                                                        
-    p_tcb->TaskEntryAddr = p_task;                          //ַ
-    p_tcb->TaskEntryArg  = p_arg;                           //洫ݸĲ
+    /* 初始化任务控制块 */                                                        
+    p_tcb->TaskEntryAddr = p_task;                          //保存任务地址
+    p_tcb->TaskEntryArg  = p_arg;                           //保存传递给任务函数的参数
 
-    p_tcb->NamePtr       = p_name;                          //
+    p_tcb->NamePtr       = p_name;                          //保存任务名称
 
-    p_tcb->Prio          = prio;                            //ռ
+    p_tcb->Prio          = prio;                            //保存任务遇险记
 
-    p_tcb->StkPtr        = p_sp;                            //ջջָ
-    p_tcb->StkLimitPtr   = p_stk_limit;                     //ջƵٽַ
+    p_tcb->StkPtr        = p_sp;                            //保存堆栈的栈顶指针
+    p_tcb->StkLimitPtr   = p_stk_limit;                     //保存堆栈限制的临界地址
 
-    p_tcb->TimeQuanta    = time_quanta;                     //ʱƬ
-#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u                        //ʹʱƬת
-    if (time_quanta == (OS_TICK)0) {                        // time_quanta Ϊ0
-        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta; //ʹĬϵʱƬСС
-    } else {                                                // time_quanta 0
-        p_tcb->TimeQuantaCtr = time_quanta;                 //ʱƬΪ time_quanta
+    p_tcb->TimeQuanta    = time_quanta;                     //保存时间片
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u                        //如果使能了时间片轮转调度
+    if (time_quanta == (OS_TICK)0) {                        //如果 time_quanta 为0
+        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta; //使用默认的时间片小小
+    } else {                                                //如果 time_quanta 非0
+        p_tcb->TimeQuantaCtr = time_quanta;                 //时间片为 time_quanta
     }
 #endif
-    p_tcb->ExtPtr        = p_ext;                           //չֵָ
-    p_tcb->StkBasePtr    = p_stk_base;                      //ջĻַ
-    p_tcb->StkSize       = stk_size;                        //ջĴС
-    p_tcb->Opt           = opt;                             //ѡ
+    p_tcb->ExtPtr        = p_ext;                           //保存任务扩展部分的指针
+    p_tcb->StkBasePtr    = p_stk_base;                      //保存堆栈的基地址
+    p_tcb->StkSize       = stk_size;                        //保存堆栈的大小
+    p_tcb->Opt           = opt;                             //保存选项
 
-#if OS_CFG_TASK_REG_TBL_SIZE > 0u                           //ʹĴ
-    for (reg_nbr = 0u; reg_nbr < OS_CFG_TASK_REG_TBL_SIZE; reg_nbr++) { //ĴʼΪ0
+#if OS_CFG_TASK_REG_TBL_SIZE > 0u                           //如果允许使用任务寄存器
+    for (reg_nbr = 0u; reg_nbr < OS_CFG_TASK_REG_TBL_SIZE; reg_nbr++) { //将任务寄存器初始化为0
         p_tcb->RegTbl[reg_nbr] = (OS_REG)0;
     }
 #endif
 
-#if OS_CFG_TASK_Q_EN > 0u                                   //ʹϢ
-    OS_MsgQInit(&p_tcb->MsgQ,                               //ʼϢ
+#if OS_CFG_TASK_Q_EN > 0u                                   //如果使能了任务消息队列
+    OS_MsgQInit(&p_tcb->MsgQ,                               //初始化任务消息队列
                 q_size);
-#else                                                       //Ϣ
-    (void)&q_size;                                          // q_size Ч
+#else                                                       //如果禁用了任务消息队列
+    (void)&q_size;                                          //参数 q_size 无效
 #endif
 
-    OSTaskCreateHook(p_tcb);                                //ûĹӺ
+    OSTaskCreateHook(p_tcb);                                //调用用户定义的钩子函数
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     for (id = 0u; id < OS_CFG_TLS_TBL_SIZE; id++) {
@@ -410,25 +410,25 @@ void  OSTaskCreate (OS_TCB        *p_tcb,        //
     }
     OS_TLS_TaskCreate(p_tcb);                               /* Call TLS hook                                          */
 #endif
-    /* б */                                  
-    OS_CRITICAL_ENTER();                                    //ٽ
-    OS_PrioInsert(p_tcb->Prio);                             //þȼλӳӦȼھ״̬
-    OS_RdyListInsertTail(p_tcb);                            //´бβ
+    /* 把任务插入就绪列表 */                                  
+    OS_CRITICAL_ENTER();                                    //进入临界段
+    OS_PrioInsert(p_tcb->Prio);                             //置就绪优先级位映像表中相应优先级处于就绪状态
+    OS_RdyListInsertTail(p_tcb);                            //将新创建的任务插入就绪列表尾端
 
-#if OS_CFG_DBG_EN > 0u                                      //ʹ˵Դͱ 
-    OS_TaskDbgListAdd(p_tcb);                               //뵽˫б
+#if OS_CFG_DBG_EN > 0u                                      //如果使能了调试代码和变量 
+    OS_TaskDbgListAdd(p_tcb);                               //把任务插入到任务调试双向列表
 #endif
 
-    OSTaskQty++;                                            //Ŀ1
+    OSTaskQty++;                                            //任务数目加1
 
-    if (OSRunning != OS_STATE_OS_RUNNING) {                 //ϵͳδ
-        OS_CRITICAL_EXIT();                                 //˳ٽ
-        return;                                             //أִֹͣ
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 //如果系统尚未启动
+        OS_CRITICAL_EXIT();                                 //退出临界段
+        return;                                             //返回，停止执行
     }
-    /* ϵͳѾ */
-    OS_CRITICAL_EXIT_NO_SCHED();                            //˳ٽΣ޵ȣ
+    /* 如果系统已经启动 */
+    OS_CRITICAL_EXIT_NO_SCHED();                            //退出临界段（无调度）
 
-    OSSched();                                              //
+    OSSched();                                              //进行任务调度
 }
 
 /*$PAGE*/
@@ -456,113 +456,113 @@ void  OSTaskCreate (OS_TCB        *p_tcb,        //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_DEL_EN > 0u                      //ʹ˺ OSTaskDel()
-void  OSTaskDel (OS_TCB  *p_tcb,                 //Ŀƿָ
-                 OS_ERR  *p_err)                 //ش
+#if OS_CFG_TASK_DEL_EN > 0u                      //如果使能了函数 OSTaskDel()
+void  OSTaskDel (OS_TCB  *p_tcb,                 //目标任务控制块指针
+                 OS_ERR  *p_err)                 //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                      //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {                // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();        //ִаȫ쳣
-        return;                                //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                      //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {                //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();        //执行安全检测异常函数
+        return;                                //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_TASK_DEL_ISR;           //Ϊжɾ
-        return;                                //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数在中断中被调用
+       *p_err = OS_ERR_TASK_DEL_ISR;           //错误类型为“在中断中删除任务”
+        return;                                //返回，停止执行
     }
 #endif
 
-    if (p_tcb == &OSIdleTaskTCB) {             //Ŀǿ
-       *p_err = OS_ERR_TASK_DEL_IDLE;          //Ϊɾ
-        return;                                //أִֹͣ
+    if (p_tcb == &OSIdleTaskTCB) {             //如果目标任务是空闲任务
+       *p_err = OS_ERR_TASK_DEL_IDLE;          //错误类型为“删除空闲任务”
+        return;                                //返回，停止执行
     }
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u           //ʹжӳٷ
-    if (p_tcb == &OSIntQTaskTCB) {             //Ŀжӳύ
-       *p_err = OS_ERR_TASK_DEL_INVALID;       //ΪǷɾ
-        return;                                //أִֹͣ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u           //如果使能了中断延迟发布
+    if (p_tcb == &OSIntQTaskTCB) {             //如果目标任务是中断延迟提交任务
+       *p_err = OS_ERR_TASK_DEL_INVALID;       //错误类型为“非法删除任务”
+        return;                                //返回，停止执行
     }
 #endif
 
-    if (p_tcb == (OS_TCB *)0) {                // p_tcb Ϊ
-        CPU_CRITICAL_ENTER();                  //ж
-        p_tcb  = OSTCBCurPtr;                  //ĿΪ
-        CPU_CRITICAL_EXIT();                   //ж
+    if (p_tcb == (OS_TCB *)0) {                //如果 p_tcb 为空
+        CPU_CRITICAL_ENTER();                  //关中断
+        p_tcb  = OSTCBCurPtr;                  //目标任务设为自身
+        CPU_CRITICAL_EXIT();                   //开中断
     }
 
-    OS_CRITICAL_ENTER();                       //ٽ
-    switch (p_tcb->TaskState) {                //Ŀ״̬ദ
-        case OS_TASK_STATE_RDY:                //Ǿ״̬
-             OS_RdyListRemove(p_tcb);          //ӾбƳ
-             break;                            //
+    OS_CRITICAL_ENTER();                       //进入临界段
+    switch (p_tcb->TaskState) {                //根据目标任务的任务状态分类处理
+        case OS_TASK_STATE_RDY:                //如果是就绪状态
+             OS_RdyListRemove(p_tcb);          //将任务从就绪列表移除
+             break;                            //跳出
 
-        case OS_TASK_STATE_SUSPENDED:          //ǹ״̬
-             break;                            //ֱ
+        case OS_TASK_STATE_SUSPENDED:          //如果是挂起状态
+             break;                            //直接跳出
 
-        case OS_TASK_STATE_DLY:                //ʱ״̬
+        case OS_TASK_STATE_DLY:                //如果包含延时状态
         case OS_TASK_STATE_DLY_SUSPENDED:      
-             OS_TickListRemove(p_tcb);         //ӽбƳ
-             break;                            //
+             OS_TickListRemove(p_tcb);         //将任务从节拍列表移除
+             break;                            //跳出
 
-        case OS_TASK_STATE_PEND:               //ȴ״̬
+        case OS_TASK_STATE_PEND:               //如果包含等待状态
         case OS_TASK_STATE_PEND_SUSPENDED:
         case OS_TASK_STATE_PEND_TIMEOUT:
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             OS_TickListRemove(p_tcb);         //ӽбƳ
-             switch (p_tcb->PendOn) {          //ĵȴദ
-                 case OS_TASK_PEND_ON_NOTHING: //ûڵȴں˶
-                 case OS_TASK_PEND_ON_TASK_Q:  //ȴϢ            
-                 case OS_TASK_PEND_ON_TASK_SEM://ȴź
-                      break;                   //ֱ
-
-                 case OS_TASK_PEND_ON_FLAG:    //ȴ¼־  
-                 case OS_TASK_PEND_ON_MULTI:   //ȴں˶
-                 case OS_TASK_PEND_ON_MUTEX:   //ȴǻź
-                 case OS_TASK_PEND_ON_Q:       //ȴϢ
-                 case OS_TASK_PEND_ON_SEM:     //ȴǶֵź
-                      OS_PendListRemove(p_tcb);//ӵȴбƳ
-                      break;                   //
-
-                 default:                      //ȴ󳬳Ԥ
-                      break;                   //ֱ
+             OS_TickListRemove(p_tcb);         //将任务从节拍列表移除
+             switch (p_tcb->PendOn) {          //根据任务的等待对象分类处理
+                 case OS_TASK_PEND_ON_NOTHING: //如果没在等待内核对象
+                 case OS_TASK_PEND_ON_TASK_Q:  //如果等待的是任务消息队列            
+                 case OS_TASK_PEND_ON_TASK_SEM://如果等待的是任务信号量
+                      break;                   //直接跳出
+
+                 case OS_TASK_PEND_ON_FLAG:    //如果等待的是事件标志组  
+                 case OS_TASK_PEND_ON_MULTI:   //如果等待多个内核对象
+                 case OS_TASK_PEND_ON_MUTEX:   //如果等待的是互斥信号量
+                 case OS_TASK_PEND_ON_Q:       //如果等待的是消息队列
+                 case OS_TASK_PEND_ON_SEM:     //如果等待的是多值信号量
+                      OS_PendListRemove(p_tcb);//将任务从等待列表移除
+                      break;                   //跳出
+
+                 default:                      //如果等待对象超出预期
+                      break;                   //直接跳出
              }
-             break;                            //
+             break;                            //跳出
 
-        default:                               //Ŀ״̬Ԥ
-            OS_CRITICAL_EXIT();                //˳ٽ
-           *p_err = OS_ERR_STATE_INVALID;      //Ϊ״̬Ƿ
-            return;                            //أִֹͣ
+        default:                               //如果目标任务状态超出预期
+            OS_CRITICAL_EXIT();                //退出临界段
+           *p_err = OS_ERR_STATE_INVALID;      //错误类型为“状态非法”
+            return;                            //返回，停止执行
     }
 
-#if OS_CFG_TASK_Q_EN > 0u                      //ʹϢ
-    (void)OS_MsgQFreeAll(&p_tcb->MsgQ);        //ͷϢ
+#if OS_CFG_TASK_Q_EN > 0u                      //如果使能了任务消息队列
+    (void)OS_MsgQFreeAll(&p_tcb->MsgQ);        //释放任务的所有任务消息
 #endif
 
-    OSTaskDelHook(p_tcb);                      //ûԶĹӺ
+    OSTaskDelHook(p_tcb);                      //调用用户自定义的钩子函数
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_TaskDel(p_tcb);                                  /* Call TLS hook                                          */
 #endif
 
-#if OS_CFG_DBG_EN > 0u                         //ʹ˵Դͱ
-    OS_TaskDbgListRemove(p_tcb);               //˫бƳ
+#if OS_CFG_DBG_EN > 0u                         //如果使能了调试代码和变量
+    OS_TaskDbgListRemove(p_tcb);               //将任务从任务调试双向列表移除
 #endif
-    OSTaskQty--;                               //Ŀ1
+    OSTaskQty--;                               //任务数目减1
 
-    OS_TaskInitTCB(p_tcb);                     //ʼƿ
-    p_tcb->TaskState = (OS_STATE)OS_TASK_STATE_DEL;//궨ѱɾ
+    OS_TaskInitTCB(p_tcb);                     //初始化任务控制块
+    p_tcb->TaskState = (OS_STATE)OS_TASK_STATE_DEL;//标定任务已被删除
 
-    OS_CRITICAL_EXIT_NO_SCHED();               //˳ٽΣ޵ȣ
+    OS_CRITICAL_EXIT_NO_SCHED();               //退出临界段（无调度）
 
-   *p_err = OS_ERR_NONE;                       //Ϊ޴
+   *p_err = OS_ERR_NONE;                       //错误类型为“无错误”
 
-    OSSched();                                 //
+    OSSched();                                 //调度任务
 }
 #endif
 
@@ -668,131 +668,131 @@ OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_Q_EN > 0u                     //ʹϢ
-void  *OSTaskQPend (OS_TICK       timeout,    //ȴޣλʱӽģ
-                    OS_OPT        opt,        //ѡ
-                    OS_MSG_SIZE  *p_msg_size, //Ϣ
-                    CPU_TS       *p_ts,       //ʱ
-                    OS_ERR       *p_err)      //ش
+#if OS_CFG_TASK_Q_EN > 0u                     //如果使能了任务消息队列
+void  *OSTaskQPend (OS_TICK       timeout,    //等待期限（单位：时钟节拍）
+                    OS_OPT        opt,        //选项
+                    OS_MSG_SIZE  *p_msg_size, //返回消息长度
+                    CPU_TS       *p_ts,       //返回时间戳
+                    OS_ERR       *p_err)      //返回错误类型
 {
     OS_MSG_Q     *p_msg_q;
     void         *p_void;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((void *)0);             //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((void *)0);             //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_PEND_ISR;                //Ϊжֹȴ
-        return ((void *)0);                     //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_PEND_ISR;                //错误类型为“在中断中中止等待”
+        return ((void *)0);                     //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                   //ʹ˲
-    if (p_msg_size == (OS_MSG_SIZE *)0) {    // p_msg_size Ϊ
-       *p_err = OS_ERR_PTR_INVALID;          //Ϊָ벻á
-        return ((void *)0);                  //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                   //如果使能了参数检测
+    if (p_msg_size == (OS_MSG_SIZE *)0) {    //如果 p_msg_size 为空
+       *p_err = OS_ERR_PTR_INVALID;          //错误类型为“指针不可用”
+        return ((void *)0);                  //返回0（有错误），停止执行
     }
-    switch (opt) {                           //ѡദ
-        case OS_OPT_PEND_BLOCKING:           //ѡԤ
+    switch (opt) {                           //根据选项分类处理
+        case OS_OPT_PEND_BLOCKING:           //如果选项在预期内
         case OS_OPT_PEND_NON_BLOCKING:
-             break;                          //ֱ
+             break;                          //直接跳出
 
-        default:                             //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;     //ΪѡǷ
-             return ((void *)0);             //0д󣩣ִֹͣ
+        default:                             //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;     //错误类型为“选项非法”
+             return ((void *)0);             //返回0（有错误），停止执行
     }
 #endif
 
-    if (p_ts != (CPU_TS *)0) {    // p_ts ǿ
-       *p_ts  = (CPU_TS  )0;      //ʼ㣩p_tsڷʱ
+    if (p_ts != (CPU_TS *)0) {    //如果 p_ts 非空
+       *p_ts  = (CPU_TS  )0;      //初始化（清零）p_ts，待用于返回时间戳
     }
 
-    CPU_CRITICAL_ENTER();                                  //ж
-    p_msg_q = &OSTCBCurPtr->MsgQ;                          //ȡǰϢ
-    p_void  = OS_MsgQGet(p_msg_q,                          //ӶȡһϢ
+    CPU_CRITICAL_ENTER();                                  //关中断
+    p_msg_q = &OSTCBCurPtr->MsgQ;                          //获取当前任务的消息队列
+    p_void  = OS_MsgQGet(p_msg_q,                          //从队列里获取一个消息
                          p_msg_size,
                          p_ts,
                          p_err);
-    if (*p_err == OS_ERR_NONE) {                          //ȡϢɹ
-#if OS_CFG_TASK_PROFILE_EN > 0u                        //ʹƿļ
-        if (p_ts != (CPU_TS *)0) {                                         // p_ts 
-            OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - *p_ts;               //ǿգ
-            if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {//ȴ
-                OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;  //Ϣе
-            }                                                              //ʱ¼
+    if (*p_err == OS_ERR_NONE) {                          //如果获取消息成功
+#if OS_CFG_TASK_PROFILE_EN > 0u                        //如果使能了任务控制块的简况变量
+        if (p_ts != (CPU_TS *)0) {                                         //如果 p_ts 
+            OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - *p_ts;               //非空，更新
+            if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {//等待任务消
+                OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;  //息队列的最
+            }                                                              //长时间记录。
         }
 #endif
-        CPU_CRITICAL_EXIT();                             //ж 
-        return (p_void);                                 //Ϣ
-    }
-    /* ȡϢɹûϢ */
-    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //ѡ˲
-       *p_err = OS_ERR_PEND_WOULD_BLOCK;                 //Ϊȱ
-        CPU_CRITICAL_EXIT();                             //ж
-        return ((void *)0);                              //0д󣩣ִֹͣ
-    } else {                                             //ѡ˶
-        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //
-            CPU_CRITICAL_EXIT();                         //ж
-           *p_err = OS_ERR_SCHED_LOCKED;                 //Ϊ
-            return ((void *)0);                          //0д󣩣ִֹͣ
+        CPU_CRITICAL_EXIT();                             //开中断 
+        return (p_void);                                 //返回消息内容
+    }
+    /* 如果获取消息不成功（队列里没有消息） */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) { //如果选择了不堵塞任务
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                 //错误类型为“缺乏阻塞”
+        CPU_CRITICAL_EXIT();                             //开中断
+        return ((void *)0);                              //返回0（有错误），停止执行
+    } else {                                             //如果选择了堵塞任务
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) { //如果调度器被锁
+            CPU_CRITICAL_EXIT();                         //开中断
+           *p_err = OS_ERR_SCHED_LOCKED;                 //错误类型为“调度器被锁”
+            return ((void *)0);                          //返回0（有错误），停止执行
         }
     }
-    /* δ */                                                       
-    OS_CRITICAL_ENTER_CPU_EXIT();                        //ؿж
-    OS_Pend((OS_PEND_DATA *)0,                           //ǰ񣬵ȴϢ 
+    /* 如果调度器未被锁 */                                                       
+    OS_CRITICAL_ENTER_CPU_EXIT();                        //锁调度器，重开中断
+    OS_Pend((OS_PEND_DATA *)0,                           //阻塞当前任务，等待消息 
             (OS_PEND_OBJ  *)0,
             (OS_STATE      )OS_TASK_PEND_ON_TASK_Q,
             (OS_TICK       )timeout);
-    OS_CRITICAL_EXIT_NO_SCHED();                         //޵ȣ
-
-    OSSched();                                           //
-    /* ǰ񣨻ϢеϢԼ */
-    CPU_CRITICAL_ENTER();                                //ж
-    switch (OSTCBCurPtr->PendStatus) {                   //ĵȴ״̬ദ
-        case OS_STATUS_PEND_OK:                          //ѳɹϢ
-             p_void      = OSTCBCurPtr->MsgPtr;          //ȡϢݵַ
-            *p_msg_size  = OSTCBCurPtr->MsgSize;         //ȡϢ
-             if (p_ts != (CPU_TS *)0) {                  // p_ts ǿ
-                *p_ts  = OSTCBCurPtr->TS;                //ȡȵϢʱʱ
-#if OS_CFG_TASK_PROFILE_EN > 0u                          //ʹƿļ
-                OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - OSTCBCurPtr->TS;     //µȴ
-                if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {//Ϣ
-                    OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;  //е
-                }                                                              //ʱ
-#endif                                                                         //¼
+    OS_CRITICAL_EXIT_NO_SCHED();                         //解锁调度器（无调度）
+
+    OSSched();                                           //调度任务
+    /* 当前任务（获得消息队列的消息）得以继续运行 */
+    CPU_CRITICAL_ENTER();                                //关中断
+    switch (OSTCBCurPtr->PendStatus) {                   //根据任务的等待状态分类处理
+        case OS_STATUS_PEND_OK:                          //如果任务已成功获得消息
+             p_void      = OSTCBCurPtr->MsgPtr;          //提取消息内容地址
+            *p_msg_size  = OSTCBCurPtr->MsgSize;         //提取消息长度
+             if (p_ts != (CPU_TS *)0) {                  //如果 p_ts 非空
+                *p_ts  = OSTCBCurPtr->TS;                //获取任务等到消息时的时间戳
+#if OS_CFG_TASK_PROFILE_EN > 0u                          //如果使能了任务控制块的简况变量
+                OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - OSTCBCurPtr->TS;     //更新等待
+                if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {//任务消息
+                    OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;  //队列的最
+                }                                                              //长时间记
+#endif                                                                         //录。
              }
-            *p_err = OS_ERR_NONE;                        //Ϊ޴
-             break;                                      //
-
-        case OS_STATUS_PEND_ABORT:                       //ȴֹ
-             p_void     = (void      *)0;                //ϢΪ
-            *p_msg_size = (OS_MSG_SIZE)0;                //ϢСΪ0
-             if (p_ts  != (CPU_TS *)0) {                 // p_ts ǿ
-                *p_ts   = (CPU_TS  )0;                   // p_ts
+            *p_err = OS_ERR_NONE;                        //错误类型为“无错误”
+             break;                                      //跳出
+
+        case OS_STATUS_PEND_ABORT:                       //如果等待被中止
+             p_void     = (void      *)0;                //返回消息内容为空
+            *p_msg_size = (OS_MSG_SIZE)0;                //返回消息大小为0
+             if (p_ts  != (CPU_TS *)0) {                 //如果 p_ts 非空
+                *p_ts   = (CPU_TS  )0;                   //清零 p_ts
              }
-            *p_err      =  OS_ERR_PEND_ABORT;            //Ϊȴֹ
-             break;                                      //
-
-        case OS_STATUS_PEND_TIMEOUT:                     //ȴʱ
-        default:                                         //״̬Ԥڡ
-             p_void     = (void      *)0;                //ϢΪ
-            *p_msg_size = (OS_MSG_SIZE)0;                //ϢСΪ0
-             if (p_ts  != (CPU_TS *)0) {                 // p_ts ǿ
+            *p_err      =  OS_ERR_PEND_ABORT;            //错误类型为“等待被中止”
+             break;                                      //跳出
+
+        case OS_STATUS_PEND_TIMEOUT:                     //如果等待超时，
+        default:                                         //或者任务状态超出预期。
+             p_void     = (void      *)0;                //返回消息内容为空
+            *p_msg_size = (OS_MSG_SIZE)0;                //返回消息大小为0
+             if (p_ts  != (CPU_TS *)0) {                 //如果 p_ts 非空
                 *p_ts   =  OSTCBCurPtr->TS;
              }
-            *p_err      =  OS_ERR_TIMEOUT;               //Ϊȴʱ
-             break;                                      //
+            *p_err      =  OS_ERR_TIMEOUT;               //错误类为“等待超时”
+             break;                                      //跳出
     }
-    CPU_CRITICAL_EXIT();                                 //ж
-    return (p_void);                                     //Ϣݵַ
+    CPU_CRITICAL_EXIT();                                 //开中断
+    return (p_void);                                     //返回消息内容地址
 }
 #endif
 
@@ -824,69 +824,69 @@ void  *OSTaskQPend (OS_TICK       timeout,    //
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_PEND_ABORT_EN > 0u)//ʹ˸ú
-CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,                   //Ŀ
-                               OS_OPT   opt,                     //ѡ
-                               OS_ERR  *p_err)                   //ش
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_PEND_ABORT_EN > 0u)//如果使能了该函数
+CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,                   //目标任务
+                               OS_OPT   opt,                     //选项
+                               OS_ERR  *p_err)                   //返回错误类型
 {
     CPU_TS         ts;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return (DEF_FALSE);             //أд󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return (DEF_FALSE);             //返回（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_PEND_ABORT_ISR;         //Ϊжֹȴ
-        return (DEF_FALSE);                    //أд󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数在中断中被调用
+       *p_err = OS_ERR_PEND_ABORT_ISR;         //错误类型为“在中断中中止等待”
+        return (DEF_FALSE);                    //返回（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                   //ʹ˲
-    switch (opt) {                           //ѡദ
-        case OS_OPT_POST_NONE:               //ѡԤ
+#if OS_CFG_ARG_CHK_EN > 0u                   //如果使能了参数检测
+    switch (opt) {                           //根据选项分类处理
+        case OS_OPT_POST_NONE:               //如果选项在预期内
         case OS_OPT_POST_NO_SCHED:
-             break;                          //ֱ
+             break;                          //直接跳出
 
-        default:                             //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;     //ΪѡǷ
-             return (DEF_FALSE);             //أд󣩣ִֹͣ
+        default:                             //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;     //错误类型为“选项非法”
+             return (DEF_FALSE);             //返回（有错误），停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                           //ж
-#if OS_CFG_ARG_CHK_EN > 0u                          //ʹ˲
-    if ((p_tcb == (OS_TCB *)0) ||                   //ĿΪգ
-        (p_tcb == OSTCBCurPtr)) {                   //
-        CPU_CRITICAL_EXIT();                        //ж
-       *p_err = OS_ERR_PEND_ABORT_SELF;             //Ϊֹ
-        return (DEF_FALSE);                         //أд󣩣ִֹͣ
+    CPU_CRITICAL_ENTER();                           //关中断
+#if OS_CFG_ARG_CHK_EN > 0u                          //如果使能了参数检测
+    if ((p_tcb == (OS_TCB *)0) ||                   //如果目标任务为空，
+        (p_tcb == OSTCBCurPtr)) {                   //或是自身。
+        CPU_CRITICAL_EXIT();                        //开中断
+       *p_err = OS_ERR_PEND_ABORT_SELF;             //错误类型为“中止自身”
+        return (DEF_FALSE);                         //返回（有错误），停止执行
     }
 #endif
 
-    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_Q) {  //ûڵȴϢ
-        CPU_CRITICAL_EXIT();                        //ж
-       *p_err = OS_ERR_PEND_ABORT_NONE;             //Ϊֹ
-        return (DEF_FALSE);                         //أд󣩣ִֹͣ
+    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_Q) {  //如果任务没在等待任务消息队列
+        CPU_CRITICAL_EXIT();                        //关中断
+       *p_err = OS_ERR_PEND_ABORT_NONE;             //错误类型为“中止对象有误”
+        return (DEF_FALSE);                         //返回（有错误），停止执行
     }
-    /* ڵȴϢ */
-    OS_CRITICAL_ENTER_CPU_EXIT();                   //ؿж
-    ts = OS_TS_GET();                               //ȡʱΪֹʱ
-    OS_PendAbort((OS_PEND_OBJ *)0,                  //ֹϢеĵȴ
+    /* 如果任务是在等待任务消息队列 */
+    OS_CRITICAL_ENTER_CPU_EXIT();                   //锁调度器，重开中断
+    ts = OS_TS_GET();                               //获取时间戳作为中止时间
+    OS_PendAbort((OS_PEND_OBJ *)0,                  //中止任务对其消息队列的等待
                  p_tcb,
                  ts);
-    OS_CRITICAL_EXIT_NO_SCHED();                    //޵ȣ
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {//ѡ˵
-        OSSched();                                  //
+    OS_CRITICAL_EXIT_NO_SCHED();                    //解锁调度器（无调度）
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {//如果选择了调度任务
+        OSSched();                                  //调度任务
     }
-   *p_err = OS_ERR_NONE;                            //Ϊ޴
-    return (DEF_TRUE);                              //أֹɹ
+   *p_err = OS_ERR_NONE;                            //错误类型为“无错误”
+    return (DEF_TRUE);                              //返回（中止成功）
 }
 #endif
 
@@ -926,43 +926,43 @@ CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,                   //Ŀ
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_Q_EN > 0u                  //ʹϢ
-void  OSTaskQPost (OS_TCB       *p_tcb,    //Ŀ
-                   void         *p_void,   //Ϣݵַ
-                   OS_MSG_SIZE   msg_size, //Ϣ
-                   OS_OPT        opt,      //ѡ
-                   OS_ERR       *p_err)    //ش
+#if OS_CFG_TASK_Q_EN > 0u                  //如果使能了任务消息队列
+void  OSTaskQPost (OS_TCB       *p_tcb,    //目标任务
+                   void         *p_void,   //消息内容地址
+                   OS_MSG_SIZE   msg_size, //消息长度
+                   OS_OPT        opt,      //选项
+                   OS_ERR       *p_err)    //返回错误类型
 {
     CPU_TS   ts;
 
 
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return;                         //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return;                         //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                //ʹ˲
-    switch (opt) {                        //ѡദ
-        case OS_OPT_POST_FIFO:            //ѡԤ
+#if OS_CFG_ARG_CHK_EN > 0u                //如果使能了参数检测
+    switch (opt) {                        //根据选项分类处理
+        case OS_OPT_POST_FIFO:            //如果选项在预期内
         case OS_OPT_POST_LIFO:
         case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
         case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
-             break;                       //ֱ
+             break;                       //直接跳出
 
-        default:                          //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;  //ΪѡǷ
-             return;                      //أִֹͣ
+        default:                          //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;  //错误类型为“选项非法”
+             return;                      //返回，停止执行
     }
 #endif
 
-    ts = OS_TS_GET();                                  //ȡʱ
+    ts = OS_TS_GET();                                  //获取时间戳
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                   //ʹжӳٷ
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {         //úжб
-        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_MSG, //ϢȷжϢ  
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                   //如果使能了中断延迟发布
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {         //如果该函数在中断中被调用
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_MSG, //将消息先发布到中断消息队列  
                     (void      *)p_tcb,
                     (void      *)p_void,
                     (OS_MSG_SIZE)msg_size,
@@ -970,11 +970,11 @@ void  OSTaskQPost (OS_TCB       *p_tcb,    //Ŀ
                     (OS_OPT     )opt,
                     (CPU_TS     )ts,
                     (OS_ERR    *)p_err);
-        return;                                         //
+        return;                                         //返回
     }
 #endif
 
-    OS_TaskQPost(p_tcb,                                 //Ϣֱӷ
+    OS_TaskQPost(p_tcb,                                 //将消息直接发布
                  p_void,
                  msg_size,
                  opt,
@@ -1007,39 +1007,39 @@ void  OSTaskQPost (OS_TCB       *p_tcb,    //Ŀ
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_REG_TBL_SIZE > 0u          //ΪĴ
-OS_REG  OSTaskRegGet (OS_TCB     *p_tcb,   //Ŀƿָ
-                      OS_REG_ID   id,      //Ĵid±꣩
-                      OS_ERR     *p_err)   //ش
+#if OS_CFG_TASK_REG_TBL_SIZE > 0u          //如果为任务定义了任务寄存器
+OS_REG  OSTaskRegGet (OS_TCB     *p_tcb,   //目标任务控制块的指针
+                      OS_REG_ID   id,      //任务寄存器的id（数组下标）
+                      OS_ERR     *p_err)   //返回错误类型
 {
     OS_REG     value;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                 //ʹ˰ȫ
+#ifdef OS_SAFETY_CRITICAL                 //如果使能了安全检测
 	123
-    if (p_err == (OS_ERR *)0) {           // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();   //ִаȫ쳣
-        return ((OS_REG)0);               //0д󣩣ִֹͣ
+    if (p_err == (OS_ERR *)0) {           //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();   //执行安全检测异常函数
+        return ((OS_REG)0);               //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                //ʹ˲
-    if (id >= OS_CFG_TASK_REG_TBL_SIZE) { // id Χ
-       *p_err = OS_ERR_REG_ID_INVALID;    //Ϊid Ƿ
-        return ((OS_REG)0);               //0д󣩣ִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                //如果使能了参数检测
+    if (id >= OS_CFG_TASK_REG_TBL_SIZE) { //如果 id 超出范围
+       *p_err = OS_ERR_REG_ID_INVALID;    //错误类型为“id 非法”
+        return ((OS_REG)0);               //返回0（有错误），停止执行
     }
 #endif
  
-    CPU_CRITICAL_ENTER();                 //ж
-    if (p_tcb == (OS_TCB *)0) {           // p_tcb Ϊ
-        p_tcb = OSTCBCurPtr;              //ĿΪǰ
-    }
-    value = p_tcb->RegTbl[id];            //ȡĴ
-    CPU_CRITICAL_EXIT();                  //ж
-   *p_err = OS_ERR_NONE;                  //Ϊ޴
-    return ((OS_REG)value);               //Ĵ
+    CPU_CRITICAL_ENTER();                 //关中断
+    if (p_tcb == (OS_TCB *)0) {           //如果 p_tcb 为空
+        p_tcb = OSTCBCurPtr;              //目标任务为当前运行任务（自身）
+    }
+    value = p_tcb->RegTbl[id];            //获取任务寄存器的内容
+    CPU_CRITICAL_EXIT();                  //开中断
+   *p_err = OS_ERR_NONE;                  //错误类型为“无错误”
+    return ((OS_REG)value);               //返回任务寄存器的内容
 }
 #endif
 
@@ -1117,37 +1117,37 @@ OS_REG_ID  OSTaskRegGetID (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_REG_TBL_SIZE > 0u        //ΪĴ
-void  OSTaskRegSet (OS_TCB     *p_tcb,   //Ŀƿָ
-                    OS_REG_ID   id,      //Ĵid±꣩
-                    OS_REG      value,   //Ĵ
-                    OS_ERR     *p_err)   //ش
+#if OS_CFG_TASK_REG_TBL_SIZE > 0u        //如果为任务定义了任务寄存器
+void  OSTaskRegSet (OS_TCB     *p_tcb,   //目标任务控制块的指针
+                    OS_REG_ID   id,      //任务寄存器的id（数组下标）
+                    OS_REG      value,   //设置任务寄存器的内容
+                    OS_ERR     *p_err)   //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {          // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return;                          //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return;                          //返回，停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                //ʹ˲
-    if (id >= OS_CFG_TASK_REG_TBL_SIZE) { // id Χ
-       *p_err = OS_ERR_REG_ID_INVALID;    //Ϊid Ƿ
-        return;                           //أִֹͣ
+#if OS_CFG_ARG_CHK_EN > 0u                //如果使能了参数检测
+    if (id >= OS_CFG_TASK_REG_TBL_SIZE) { //如果 id 超出范围
+       *p_err = OS_ERR_REG_ID_INVALID;    //错误类型为“id 非法”
+        return;                           //返回，停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                 //ж
-    if (p_tcb == (OS_TCB *)0) {           // p_tcb Ϊ
-        p_tcb = OSTCBCurPtr;              //ĿΪǰ
+    CPU_CRITICAL_ENTER();                 //关中断
+    if (p_tcb == (OS_TCB *)0) {           //如果 p_tcb 为空
+        p_tcb = OSTCBCurPtr;              //目标任务为当前运行任务（自身）
     }
-    p_tcb->RegTbl[id] = value;            //Ĵ
-    CPU_CRITICAL_EXIT();                  //ж
-   *p_err             = OS_ERR_NONE;      //Ϊ޴
+    p_tcb->RegTbl[id] = value;            //设置任务寄存器的内容
+    CPU_CRITICAL_EXIT();                  //开中断
+   *p_err             = OS_ERR_NONE;      //错误类型为“无错误”
 }
 #endif
 
@@ -1173,44 +1173,44 @@ void  OSTaskRegSet (OS_TCB     *p_tcb,   //Ŀ
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_SUSPEND_EN > 0u            //ʹ˺ OSTaskResume() 
-void  OSTaskResume (OS_TCB  *p_tcb,        //ƿָ
-                    OS_ERR  *p_err)        //ش
+#if OS_CFG_TASK_SUSPEND_EN > 0u            //如果使能了函数 OSTaskResume() 
+void  OSTaskResume (OS_TCB  *p_tcb,        //任务控制块指针
+                    OS_ERR  *p_err)        //返回错误类型
 {
-    CPU_SR_ALLOC();  //ʹõٽΣڹ/жʱʱú꣬ú
-									   //һֲڱжǰ CPU ״̬Ĵ
-									   // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC();  //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+									   //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+									   // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                 //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {           // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();   //ִаȫ쳣
-        return;                           //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                 //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {           //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();   //执行安全检测异常函数
+        return;                           //返回，停止执行
     }
 #endif
 
 #if (OS_CFG_ISR_POST_DEFERRED_EN   == 0u) && \
-    (OS_CFG_CALLED_FROM_ISR_CHK_EN >  0u)      //жӳٷжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //жеøú
-       *p_err = OS_ERR_TASK_RESUME_ISR;        //Ϊжлָ
-        return;                                //أִֹͣ
+    (OS_CFG_CALLED_FROM_ISR_CHK_EN >  0u)      //如果禁用了中断延迟发布和中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果在中断中调用该函数
+       *p_err = OS_ERR_TASK_RESUME_ISR;        //错误类型为“在中断中恢复任务”
+        return;                                //返回，停止执行
     }
 #endif
 
 
-    CPU_CRITICAL_ENTER();                     //ж
-#if OS_CFG_ARG_CHK_EN > 0u                    //ʹ˲
-    if ((p_tcb == (OS_TCB *)0) ||             //ָΪջ
+    CPU_CRITICAL_ENTER();                     //关中断
+#if OS_CFG_ARG_CHK_EN > 0u                    //如果使能了参数检测
+    if ((p_tcb == (OS_TCB *)0) ||             //如果被恢复任务为空或是自身
         (p_tcb == OSTCBCurPtr)) {
-        CPU_CRITICAL_EXIT();                  //ж
-       *p_err  = OS_ERR_TASK_RESUME_SELF;     //Ϊָ
-        return;                               //أִֹͣ
+        CPU_CRITICAL_EXIT();                  //开中断
+       *p_err  = OS_ERR_TASK_RESUME_SELF;     //错误类型为“恢复自身”
+        return;                               //返回，停止执行
     }
 #endif
-    CPU_CRITICAL_EXIT();                      //ж
+    CPU_CRITICAL_EXIT();                      //关中断
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                      //ʹжӳٷ
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {            //úжб
-        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_RESUME, //ѻָжϢ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                      //如果使能了中断延迟发布
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {            //如果该函数在中断中被调用
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_RESUME, //把恢复任务命令发布到中断消息队列
                     (void      *)p_tcb,
                     (void      *)0,
                     (OS_MSG_SIZE)0,
@@ -1218,11 +1218,11 @@ void  OSTaskResume (OS_TCB  *p_tcb,        //
                     (OS_OPT     )0,
                     (CPU_TS     )0,
                     (OS_ERR    *)p_err);
-        return;                                          //أִֹͣ
+        return;                                          //返回，停止执行
     }
 #endif
-    /* жӳٷжеøú */
-    OS_TaskResume(p_tcb, p_err);                        //ֱӽ p_tcb  
+    /* 如果禁用了中断延迟发布或不是在中断中调用该函数 */
+    OS_TaskResume(p_tcb, p_err);                        //直接将任务 p_tcb 挂起 
 }
 #endif
 
@@ -1260,121 +1260,121 @@ void  OSTaskResume (OS_TCB  *p_tcb,        //
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,  //ȴʱʱ
-                           OS_OPT    opt,      //ѡ
-                           CPU_TS   *p_ts,     //ʱ
-                           OS_ERR   *p_err)    //ش
+OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,  //等待超时时间
+                           OS_OPT    opt,      //选项
+                           CPU_TS   *p_ts,     //返回时间戳
+                           OS_ERR   *p_err)    //返回错误类型
 {
     OS_SEM_CTR    ctr;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return ((OS_SEM_CTR)0);          //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return ((OS_SEM_CTR)0);          //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_PEND_ISR;                //شΪжеȴ
-        return ((OS_SEM_CTR)0);                 //0д󣩣ִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数在中断中被调用
+       *p_err = OS_ERR_PEND_ISR;                //返回错误类型为“在中断中等待”
+        return ((OS_SEM_CTR)0);                 //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                  //ʹ˲
-    switch (opt) {                          //ѡദ
-        case OS_OPT_PEND_BLOCKING:          //ѡԤ
+#if OS_CFG_ARG_CHK_EN > 0u                  //如果使能了参数检测
+    switch (opt) {                          //根据选项分类处理
+        case OS_OPT_PEND_BLOCKING:          //如果选项在预期内
         case OS_OPT_PEND_NON_BLOCKING:
-             break;                         //ֱ
+             break;                         //直接跳出
 
-        default:                            //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;    //ΪѡǷ
-             return ((OS_SEM_CTR)0);        //0д󣩣ִֹͣ
+        default:                            //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;    //错误类型为“选项非法”
+             return ((OS_SEM_CTR)0);        //返回0（有错误），停止执行
     }
 #endif
 
-    if (p_ts != (CPU_TS *)0) {      // p_ts ǿ
-       *p_ts  = (CPU_TS  )0;        //㣨ʼp_ts
+    if (p_ts != (CPU_TS *)0) {      //如果 p_ts 非空
+       *p_ts  = (CPU_TS  )0;        //清零（初始化）p_ts
     }
 
-    CPU_CRITICAL_ENTER();                        //ж  
-    if (OSTCBCurPtr->SemCtr > (OS_SEM_CTR)0) {   //źǰ
-        OSTCBCurPtr->SemCtr--;                   //ź1
-        ctr    = OSTCBCurPtr->SemCtr;            //ȡźĵǰֵ
-        if (p_ts != (CPU_TS *)0) {               // p_ts ǿ
-           *p_ts  = OSTCBCurPtr->TS;             //źʱ
+    CPU_CRITICAL_ENTER();                        //关中断  
+    if (OSTCBCurPtr->SemCtr > (OS_SEM_CTR)0) {   //如果任务信号量当前可用
+        OSTCBCurPtr->SemCtr--;                   //信号量计数器减1
+        ctr    = OSTCBCurPtr->SemCtr;            //获取信号量的当前计数值
+        if (p_ts != (CPU_TS *)0) {               //如果 p_ts 非空
+           *p_ts  = OSTCBCurPtr->TS;             //返回信号量被发布的时间戳
         }
-#if OS_CFG_TASK_PROFILE_EN > 0u                  //ʹƿļ
-        OSTCBCurPtr->SemPendTime = OS_TS_GET() - OSTCBCurPtr->TS;     //ȴ
-        if (OSTCBCurPtr->SemPendTimeMax < OSTCBCurPtr->SemPendTime) { //ź
-            OSTCBCurPtr->SemPendTimeMax = OSTCBCurPtr->SemPendTime;   //ʱ¼
+#if OS_CFG_TASK_PROFILE_EN > 0u                  //如果使能了任务控制块的简况变量
+        OSTCBCurPtr->SemPendTime = OS_TS_GET() - OSTCBCurPtr->TS;     //更新任务等待
+        if (OSTCBCurPtr->SemPendTimeMax < OSTCBCurPtr->SemPendTime) { //任务信号量的
+            OSTCBCurPtr->SemPendTimeMax = OSTCBCurPtr->SemPendTime;   //最长时间记录。
         }
 #endif
-        CPU_CRITICAL_EXIT();                     //ж            
-       *p_err = OS_ERR_NONE;                     //Ϊ޴
-        return (ctr);                            //źĵǰֵ
-    }
-    /* źǰ */
-    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //ѡ˲
-        CPU_CRITICAL_EXIT();                              //ж
-       *p_err = OS_ERR_PEND_WOULD_BLOCK;                  //Ϊȱ
-        return ((OS_SEM_CTR)0);                           //0д󣩣ִֹͣ
-    } else {                                              //ѡ
-        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {  //
-            CPU_CRITICAL_EXIT();                          //ж
-           *p_err = OS_ERR_SCHED_LOCKED;                  //Ϊ
-            return ((OS_SEM_CTR)0);                       //0д󣩣ִֹͣ
+        CPU_CRITICAL_EXIT();                     //开中断            
+       *p_err = OS_ERR_NONE;                     //错误类型为“无错误”
+        return (ctr);                            //返回信号量的当前计数值
+    }
+    /* 如果任务信号量当前不可用 */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {  //如果选择了不阻塞任务
+        CPU_CRITICAL_EXIT();                              //开中断
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                  //错误类型为“缺乏阻塞”
+        return ((OS_SEM_CTR)0);                           //返回0（有错误），停止执行
+    } else {                                              //如果选择了阻塞任务
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {  //如果调度器被锁
+            CPU_CRITICAL_EXIT();                          //开中断
+           *p_err = OS_ERR_SCHED_LOCKED;                  //错误类型为“调度器被锁”
+            return ((OS_SEM_CTR)0);                       //返回0（有错误），停止执行
         }
     }
-    /* δ */
-    OS_CRITICAL_ENTER_CPU_EXIT();                         //ؿж                      
-    OS_Pend((OS_PEND_DATA *)0,                            //񣬵ȴź
-            (OS_PEND_OBJ  *)0,                            //ȴб
+    /* 如果调度器未被锁 */
+    OS_CRITICAL_ENTER_CPU_EXIT();                         //锁调度器，重开中断                      
+    OS_Pend((OS_PEND_DATA *)0,                            //阻塞任务，等待信号量。
+            (OS_PEND_OBJ  *)0,                            //不需插入等待列表。
             (OS_STATE      )OS_TASK_PEND_ON_TASK_SEM,
             (OS_TICK       )timeout);
-    OS_CRITICAL_EXIT_NO_SCHED();                          //޵ȣ
-
-    OSSched();                                            //
-    /* źԼ */
-    CPU_CRITICAL_ENTER();                                 //ж
-    switch (OSTCBCurPtr->PendStatus) {                    //ĵȴ״̬ദ
-        case OS_STATUS_PEND_OK:                           //ɹź
-             if (p_ts != (CPU_TS *)0) {                   //źʱ
+    OS_CRITICAL_EXIT_NO_SCHED();                          //开调度器（无调度）
+
+    OSSched();                                            //调度任务
+    /* 任务获得信号量后得以继续运行 */
+    CPU_CRITICAL_ENTER();                                 //关中断
+    switch (OSTCBCurPtr->PendStatus) {                    //根据任务的等待状态分类处理
+        case OS_STATUS_PEND_OK:                           //如果任务成功获得信号量
+             if (p_ts != (CPU_TS *)0) {                   //返回信号量被发布的时间戳
                 *p_ts                    =  OSTCBCurPtr->TS;
-#if OS_CFG_TASK_PROFILE_EN > 0u                           //ȴʱ¼
+#if OS_CFG_TASK_PROFILE_EN > 0u                           //更新最长等待时间记录
                 OSTCBCurPtr->SemPendTime = OS_TS_GET() - OSTCBCurPtr->TS;
                 if (OSTCBCurPtr->SemPendTimeMax < OSTCBCurPtr->SemPendTime) {
                     OSTCBCurPtr->SemPendTimeMax = OSTCBCurPtr->SemPendTime;
                 }
 #endif
              }
-            *p_err = OS_ERR_NONE;                         //Ϊ޴
-             break;                                       //
+            *p_err = OS_ERR_NONE;                         //错误类型为“无错误”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_ABORT:                        //ȴֹ
-             if (p_ts != (CPU_TS *)0) {                   //رֹʱʱ
+        case OS_STATUS_PEND_ABORT:                        //如果等待被中止
+             if (p_ts != (CPU_TS *)0) {                   //返回被终止时的时间戳
                 *p_ts  =  OSTCBCurPtr->TS;
              }
-            *p_err = OS_ERR_PEND_ABORT;                   //Ϊȴֹ
-             break;                                       //
+            *p_err = OS_ERR_PEND_ABORT;                   //错误类型为“等待被中止”
+             break;                                       //跳出
 
-        case OS_STATUS_PEND_TIMEOUT:                      //ȴʱ
-             if (p_ts != (CPU_TS *)0) {                   //ʱΪ0
+        case OS_STATUS_PEND_TIMEOUT:                      //如果等待超时
+             if (p_ts != (CPU_TS *)0) {                   //返回时间戳为0
                 *p_ts  = (CPU_TS  )0;
              }
-            *p_err = OS_ERR_TIMEOUT;                      //Ϊȴʱ
-             break;                                       //
+            *p_err = OS_ERR_TIMEOUT;                      //错误类型为“等待超时”
+             break;                                       //跳出
 
-        default:                                          //ȴ״̬Ԥ
-            *p_err = OS_ERR_STATUS_INVALID;               //Ϊ״̬Ƿ
-             break;                                       //
+        default:                                          //如果等待状态超出预期
+            *p_err = OS_ERR_STATUS_INVALID;               //错误类型为“状态非法”
+             break;                                       //跳出
     }                                                     
-    ctr = OSTCBCurPtr->SemCtr;                            //ȡźĵǰֵ
-    CPU_CRITICAL_EXIT();                                  //ж
-    return (ctr);                                         //źĵǰֵ
+    ctr = OSTCBCurPtr->SemCtr;                            //获取信号量的当前计数值
+    CPU_CRITICAL_EXIT();                                  //开中断
+    return (ctr);                                         //返回信号量的当前计数值
 }
 
 /*$PAGE*/
@@ -1406,68 +1406,68 @@ OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,  //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_SEM_PEND_ABORT_EN > 0u  //ʹ OSTaskSemPendAbort()
-CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb, //Ŀ
-                                 OS_OPT   opt,   //ѡ
-                                 OS_ERR  *p_err) //ش
+#if OS_CFG_TASK_SEM_PEND_ABORT_EN > 0u  //如果使能了 OSTaskSemPendAbort()
+CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb, //目标任务
+                                 OS_OPT   opt,   //选项
+                                 OS_ERR  *p_err) //返回错误类型
 {
     CPU_TS         ts;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL               //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return (DEF_FALSE);             //أʧܣִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return (DEF_FALSE);             //返回（失败），停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u           //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {   //úжб
-       *p_err = OS_ERR_PEND_ABORT_ISR;           //Ϊжд
-        return (DEF_FALSE);                      //أʧܣִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u           //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {   //如果该函数是在中断中被调用
+       *p_err = OS_ERR_PEND_ABORT_ISR;           //错误类型为“在中断中创建对象”
+        return (DEF_FALSE);                      //返回（失败），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                  //ʹ˲
-    switch (opt) {                          //ѡദ
-        case OS_OPT_POST_NONE:              //ѡԤ
+#if OS_CFG_ARG_CHK_EN > 0u                  //如果使能了参数检测
+    switch (opt) {                          //根据选项匪类处理
+        case OS_OPT_POST_NONE:              //如果选项在预期内
         case OS_OPT_POST_NO_SCHED:
-             break;                         //ֱ
+             break;                         //直接跳出
 
-        default:                            //ѡԤ
-            *p_err =  OS_ERR_OPT_INVALID;   //ΪѡǷ
-             return (DEF_FALSE);            //أʧܣִֹͣ
+        default:                            //如果选项超出预期
+            *p_err =  OS_ERR_OPT_INVALID;   //错误类型为“选项非法”
+             return (DEF_FALSE);            //返回（失败），停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                 //ж
-    if ((p_tcb == (OS_TCB *)0) ||         // p_tcb Ϊգ
-        (p_tcb == OSTCBCurPtr)) {         //p_tcb ָǰ
-        CPU_CRITICAL_EXIT();              //ж
-       *p_err = OS_ERR_PEND_ABORT_SELF;   //Ϊֹ
-        return (DEF_FALSE);               //أʧܣִֹͣ
+    CPU_CRITICAL_ENTER();                 //关中断
+    if ((p_tcb == (OS_TCB *)0) ||         //如果 p_tcb 为空，或者
+        (p_tcb == OSTCBCurPtr)) {         //p_tcb 指向当前运行任务。
+        CPU_CRITICAL_EXIT();              //开中断
+       *p_err = OS_ERR_PEND_ABORT_SELF;   //错误类型为“中止自身”
+        return (DEF_FALSE);               //返回（失败），停止执行
     }
-    /*  p_tcb Ŀ ǵǰ */
-    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_SEM) { //Ŀûڵȴź
-        CPU_CRITICAL_EXIT();                         //ж
-       *p_err = OS_ERR_PEND_ABORT_NONE;              //Ϊûڵȴź
-        return (DEF_FALSE);                          //أʧܣִֹͣ
+    /* 如果 p_tcb （目标任务） 不是当前运行任务（自身） */
+    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_SEM) { //如果目标任务没在等待任务信号量
+        CPU_CRITICAL_EXIT();                         //开中断
+       *p_err = OS_ERR_PEND_ABORT_NONE;              //错误类型为“没在等待任务信号量”
+        return (DEF_FALSE);                          //返回（失败），停止执行
     }
-    CPU_CRITICAL_EXIT();                             //ж
+    CPU_CRITICAL_EXIT();                             //开中断
 
-    OS_CRITICAL_ENTER();                             //ٽ
-    ts = OS_TS_GET();                                //ȡʱ
-    OS_PendAbort((OS_PEND_OBJ *)0,                   //ֹĿźĵȴ
+    OS_CRITICAL_ENTER();                             //进入临界段
+    ts = OS_TS_GET();                                //获取时间戳
+    OS_PendAbort((OS_PEND_OBJ *)0,                   //中止目标任务对信号量的等待
                  p_tcb, 
                  ts);
-    OS_CRITICAL_EXIT_NO_SCHED();                     //˳ٽΣ޵ȣ
-    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) { //ѡ
-        OSSched();                                   //
+    OS_CRITICAL_EXIT_NO_SCHED();                     //退出临界段（无调度）
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) { //如果选择了任务调度
+        OSSched();                                   //调度任务
     }
-   *p_err = OS_ERR_NONE;                             //Ϊ޴
-    return (DEF_TRUE);                               //أֹɹ
+   *p_err = OS_ERR_NONE;                             //错误类型为“无错误”
+    return (DEF_TRUE);                               //返回（中止成功）
 }
 #endif
 
@@ -1495,39 +1495,39 @@ CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb, //Ŀ
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,   //Ŀ
-                           OS_OPT   opt,     //ѡ
-                           OS_ERR  *p_err)   //ش
+OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,   //目标任务
+                           OS_OPT   opt,     //选项
+                           OS_ERR  *p_err)   //返回错误类型
 {
     OS_SEM_CTR  ctr;
     CPU_TS      ts;
 
 
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return ((OS_SEM_CTR)0);         //0д󣩣ִֹͣ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return ((OS_SEM_CTR)0);         //返回0（有错误），停止执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                  //ʹܣĬʹܣ˲⹦
-    switch (opt) {                          //ѡദ
-        case OS_OPT_POST_NONE:              //ѡԤ֮
+#if OS_CFG_ARG_CHK_EN > 0u                  //如果使能（默认使能）了参数检测功能
+    switch (opt) {                          //根据选项分类处理
+        case OS_OPT_POST_NONE:              //如果选项在预期之内
         case OS_OPT_POST_NO_SCHED:
-             break;                         //
+             break;                         //跳出
 
-        default:                            //ѡԤ
-            *p_err =  OS_ERR_OPT_INVALID;   //ΪѡǷ
-             return ((OS_SEM_CTR)0u);       //0д󣩣ִֹͣ
+        default:                            //如果选项超出预期
+            *p_err =  OS_ERR_OPT_INVALID;   //错误类型为“选项非法”
+             return ((OS_SEM_CTR)0u);       //返回0（有错误），停止执行
     }
 #endif
 
-    ts = OS_TS_GET();                                      //ȡʱ
+    ts = OS_TS_GET();                                      //获取时间戳
 
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                       //ʹжӳٷ
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {             //úжб
-        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_SIGNAL,  //źжϢ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                       //如果使能了中断延迟发布
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {             //如果该函数是在中断中被调用
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_SIGNAL,  //将该信号量发布到中断消息队列
                     (void      *)p_tcb,
                     (void      *)0,
                     (OS_MSG_SIZE)0,
@@ -1535,16 +1535,16 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,   //Ŀ
                     (OS_OPT     )0,
                     (CPU_TS     )ts,
                     (OS_ERR    *)p_err);
-        return ((OS_SEM_CTR)0);                           //0δ   
+        return ((OS_SEM_CTR)0);                           //返回0（尚未发布）   
     }
 #endif
 
-    ctr = OS_TaskSemPost(p_tcb,                          //źͨʽ
+    ctr = OS_TaskSemPost(p_tcb,                          //将信号量按照普通方式处理
                          opt,
                          ts,
                          p_err);
 
-    return (ctr);                                       //źŵĵǰֵ
+    return (ctr);                                       //返回信号的当前计数值
 }
 
 /*$PAGE*/
@@ -1735,38 +1735,38 @@ void  OSTaskStkChk (OS_TCB        *p_tcb,
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_SUSPEND_EN > 0u                         //ʹ˺ OSTaskSuspend()     
-void   OSTaskSuspend (OS_TCB  *p_tcb,                   //ƿָ
-                      OS_ERR  *p_err)                   //ش
+#if OS_CFG_TASK_SUSPEND_EN > 0u                         //如果使能了函数 OSTaskSuspend()     
+void   OSTaskSuspend (OS_TCB  *p_tcb,                   //任务控制块指针
+                      OS_ERR  *p_err)                   //返回错误类型
 {
-#ifdef OS_SAFETY_CRITICAL                               //ʹ˰ȫ
-    if (p_err == (OS_ERR *)0) {                         // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();                 //ִаȫ쳣
-        return;                                         //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                               //如果使能了安全检测
+    if (p_err == (OS_ERR *)0) {                         //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();                 //执行安全检测异常函数
+        return;                                         //返回，停止执行
     }
 #endif
 
 #if (OS_CFG_ISR_POST_DEFERRED_EN   == 0u) && \
-    (OS_CFG_CALLED_FROM_ISR_CHK_EN >  0u)               //жӳٷжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {          //жеøú
-       *p_err = OS_ERR_TASK_SUSPEND_ISR;                //Ϊжй
-        return;                                         //أִֹͣ
+    (OS_CFG_CALLED_FROM_ISR_CHK_EN >  0u)               //如果禁用了中断延迟发布和中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {          //如果在中断中调用该函数
+       *p_err = OS_ERR_TASK_SUSPEND_ISR;                //错误类型为“在中断中挂起任务”
+        return;                                         //返回，停止执行
     }
 #endif
 
-    if (p_tcb == &OSIdleTaskTCB) {                      // p_tcb ǿ   
-       *p_err = OS_ERR_TASK_SUSPEND_IDLE;               //Ϊ
-        return;                                         //أִֹͣ
+    if (p_tcb == &OSIdleTaskTCB) {                      //如果 p_tcb 是空闲任务   
+       *p_err = OS_ERR_TASK_SUSPEND_IDLE;               //错误类型为“挂起空闲任务”
+        return;                                         //返回，停止执行
     }
  
-#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                    //ʹжӳٷ
-    if (p_tcb == &OSIntQTaskTCB) {                      // p_tcb Ϊжӳύ
-       *p_err = OS_ERR_TASK_SUSPEND_INT_HANDLER;        //Ϊжӳύ
-        return;                                         //أִֹͣ
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                    //如果使能了中断延迟发布
+    if (p_tcb == &OSIntQTaskTCB) {                      //如果 p_tcb 为中断延迟提交任务
+       *p_err = OS_ERR_TASK_SUSPEND_INT_HANDLER;        //错误类型为“挂起中断延迟提交任务”
+        return;                                         //返回，停止执行
     }
 
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              //жеøú
-        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_SUSPEND,  //ѹжϢ
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              //如果在中断中调用该函数
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_SUSPEND,  //把挂起任务命令发布到中断消息队列
                     (void      *)p_tcb,
                     (void      *)0,
                     (OS_MSG_SIZE)0,
@@ -1774,11 +1774,11 @@ void   OSTaskSuspend (OS_TCB  *p_tcb,                   //
                     (OS_OPT     )0,
                     (CPU_TS     )0,
                     (OS_ERR    *)p_err);
-        return;                                            //أִֹͣ
+        return;                                            //返回，停止执行
     }
 #endif
-    /* жӳٷжеøú */
-    OS_TaskSuspend(p_tcb, p_err);                          //ֱӽ p_tcb 
+    /* 如果禁用了中断延迟发布或不是在中断中调用该函数 */
+    OS_TaskSuspend(p_tcb, p_err);                          //直接将任务 p_tcb 挂起
 }
 #endif
 
@@ -1803,44 +1803,44 @@ void   OSTaskSuspend (OS_TCB  *p_tcb,                   //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u                //ʹʱƬת
-void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,         //ƿָ
-                           OS_TICK   time_quanta,   //ʱƬ
-                           OS_ERR   *p_err)         //ش
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u                //如果使能了时间片轮转调度
+void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,         //任务控制块指针
+                           OS_TICK   time_quanta,   //设置时间片
+                           OS_ERR   *p_err)         //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-#ifdef OS_SAFETY_CRITICAL                //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {          // p_err Ϊ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return;                          //أִֹͣ
+#ifdef OS_SAFETY_CRITICAL                //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果 p_err 为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return;                          //返回，停止执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹжзǷü
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб
-       *p_err = OS_ERR_SET_ISR;                //Ϊжá
-        return;                                //أִֹͣ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能了中断中非法调用检测
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数在中断中被调用
+       *p_err = OS_ERR_SET_ISR;                //错误类型为“在中断中设置”
+        return;                                //返回，停止执行
     }
 #endif
 
-    CPU_CRITICAL_ENTER();                      //ж
-    if (p_tcb == (OS_TCB *)0) {                // p_tcb Ϊ
-        p_tcb = OSTCBCurPtr;                   //ĿΪǰ
+    CPU_CRITICAL_ENTER();                      //关中断
+    if (p_tcb == (OS_TCB *)0) {                //如果 p_tcb 为空
+        p_tcb = OSTCBCurPtr;                   //目标任务为当前运行任务
     }
 
-    if (time_quanta == 0u) {                   // time_quanta Ϊ0
-        p_tcb->TimeQuanta    = OSSchedRoundRobinDfltTimeQuanta; //ΪĬʱƬ
-    } else {                                   // time_quanta 0
-        p_tcb->TimeQuanta    = time_quanta;    // time_quanta ΪʱƬ
+    if (time_quanta == 0u) {                   //如果 time_quanta 为0
+        p_tcb->TimeQuanta    = OSSchedRoundRobinDfltTimeQuanta; //设置为默认时间片
+    } else {                                   //如果 time_quanta 非0
+        p_tcb->TimeQuanta    = time_quanta;    //把 time_quanta 设为任务的时间片
     }
-    if (p_tcb->TimeQuanta > p_tcb->TimeQuantaCtr) { //ʣʱƬСֵ
-        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;   //ʣʱƬΪֵ
+    if (p_tcb->TimeQuanta > p_tcb->TimeQuantaCtr) { //如果任务的剩余时间片小于新设置值
+        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;   //把剩余时间片调整为新设置值
     }
-    CPU_CRITICAL_EXIT();                       //ж
-   *p_err = OS_ERR_NONE;                       //Ϊ޴
+    CPU_CRITICAL_EXIT();                       //开中断
+   *p_err = OS_ERR_NONE;                       //错误类型为“无错误”
 }
 #endif
 
@@ -1859,17 +1859,17 @@ void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,         //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_DBG_EN > 0u                                    //ʹ˵Դͱ
-void  OS_TaskDbgListAdd (OS_TCB  *p_tcb)                  //뵽бǰ
+#if OS_CFG_DBG_EN > 0u                                    //如果使能了调试代码和变量
+void  OS_TaskDbgListAdd (OS_TCB  *p_tcb)                  //将任务插入到任务调试列表的最前端
 {
-    p_tcb->DbgPrevPtr                = (OS_TCB *)0;       //Ϊбǰ
-    if (OSTaskDbgListPtr == (OS_TCB *)0) {                //бΪ
-        p_tcb->DbgNextPtr            = (OS_TCB *)0;       //öеһԪҲΪ
-    } else {                                              //бǿ
-        p_tcb->DbgNextPtr            =  OSTaskDbgListPtr; //бԭԪΪһԪ
-        OSTaskDbgListPtr->DbgPrevPtr =  p_tcb;            //ԭԪصǰΪ˸
-    }
-    OSTaskDbgListPtr                 =  p_tcb;            //ΪбԪ
+    p_tcb->DbgPrevPtr                = (OS_TCB *)0;       //将该任务作为列表的最前端
+    if (OSTaskDbgListPtr == (OS_TCB *)0) {                //如果列表为空
+        p_tcb->DbgNextPtr            = (OS_TCB *)0;       //该队列的下一个元素也为空
+    } else {                                              //如果列表非空
+        p_tcb->DbgNextPtr            =  OSTaskDbgListPtr; //列表原来的首元素作为该任务的下一个元素
+        OSTaskDbgListPtr->DbgPrevPtr =  p_tcb;            //原来的首元素的前面变为了该任务
+    }
+    OSTaskDbgListPtr                 =  p_tcb;            //该任务成为列表的新首元素
 }
 
 
@@ -2124,66 +2124,66 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_Q_EN > 0u                   //ʹϢ
-void  OS_TaskQPost (OS_TCB       *p_tcb,    //Ŀ
-                    void         *p_void,   //Ϣݵַ
-                    OS_MSG_SIZE   msg_size, //Ϣ
-                    OS_OPT        opt,      //ѡ
-                    CPU_TS        ts,       //ʱ
-                    OS_ERR       *p_err)    //ش
+#if OS_CFG_TASK_Q_EN > 0u                   //如果使能了任务消息队列
+void  OS_TaskQPost (OS_TCB       *p_tcb,    //目标任务
+                    void         *p_void,   //消息内容地址
+                    OS_MSG_SIZE   msg_size, //消息长度
+                    OS_OPT        opt,      //选项
+                    CPU_TS        ts,       //时间戳
+                    OS_ERR       *p_err)    //返回错误类型
 {
-    CPU_SR_ALLOC();  //ʹõٽΣڹ/жʱʱú꣬ú
-									   //һֲڱжǰ CPU ״̬Ĵ
-									   // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC();  //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+									   //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+									   // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-    OS_CRITICAL_ENTER();                                   //ٽ
-    if (p_tcb == (OS_TCB *)0) {                            // p_tcb Ϊ
-        p_tcb = OSTCBCurPtr;                               //ĿΪ
+    OS_CRITICAL_ENTER();                                   //进入临界段
+    if (p_tcb == (OS_TCB *)0) {                            //如果 p_tcb 为空
+        p_tcb = OSTCBCurPtr;                               //目标任务为自身
     }
-   *p_err  = OS_ERR_NONE;                                  //Ϊ޴
-    switch (p_tcb->TaskState) {                            //״̬ദ
-        case OS_TASK_STATE_RDY:                            //Ŀûȴ״̬
+   *p_err  = OS_ERR_NONE;                                  //错误类型为“无错误”
+    switch (p_tcb->TaskState) {                            //根据任务状态分类处理
+        case OS_TASK_STATE_RDY:                            //如果目标任务没等待状态
         case OS_TASK_STATE_DLY:
         case OS_TASK_STATE_SUSPENDED:
         case OS_TASK_STATE_DLY_SUSPENDED:
-             OS_MsgQPut(&p_tcb->MsgQ,                      //ϢϢ
+             OS_MsgQPut(&p_tcb->MsgQ,                      //把消息放入任务消息队列
                         p_void,
                         msg_size,
                         opt,
                         ts,
                         p_err);
-             OS_CRITICAL_EXIT();                           //˳ٽ
-             break;                                        //
+             OS_CRITICAL_EXIT();                           //退出临界段
+             break;                                        //跳出
 
-        case OS_TASK_STATE_PEND:                           //Ŀеȴ״̬ 
+        case OS_TASK_STATE_PEND:                           //如果目标任务有等待状态 
         case OS_TASK_STATE_PEND_TIMEOUT:
         case OS_TASK_STATE_PEND_SUSPENDED:
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {//ȵϢ
-                 OS_Post((OS_PEND_OBJ *)0,                 //ϢĿ
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {//如果等的是任务消息队列
+                 OS_Post((OS_PEND_OBJ *)0,                 //把消息发布给目标任务
                          p_tcb,
                          p_void,
                          msg_size,
                          ts);
-                 OS_CRITICAL_EXIT_NO_SCHED();              //˳ٽΣ޵ȣ
-                 if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) { //Ҫ
-                     OSSched();                                    //
+                 OS_CRITICAL_EXIT_NO_SCHED();              //退出临界段（无调度）
+                 if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) { //如果要调度任务
+                     OSSched();                                    //调度任务
                  }
-             } else {                                      //ûڵȴϢ
-                 OS_MsgQPut(&p_tcb->MsgQ,                  //ϢϢ
+             } else {                                      //如果没在等待任务消息队列
+                 OS_MsgQPut(&p_tcb->MsgQ,                  //把消息放入任务消息队列
                             p_void,                        
                             msg_size,
                             opt,
                             ts,
                             p_err);
-                 OS_CRITICAL_EXIT();                      //˳ٽ
+                 OS_CRITICAL_EXIT();                      //退出临界段
              }
-             break;                                       //
+             break;                                       //跳出
 
-        default:                                          //״̬Ԥ
-             OS_CRITICAL_EXIT();                          //˳ٽ
-            *p_err = OS_ERR_STATE_INVALID;                //Ϊ״̬Ƿ
-             break;                                       //
+        default:                                          //如果状态超出预期
+             OS_CRITICAL_EXIT();                          //退出临界段
+            *p_err = OS_ERR_STATE_INVALID;                //错误类型为“状态非法”
+             break;                                       //跳出
     }
 }
 #endif
@@ -2212,65 +2212,65 @@ void  OS_TaskQPost (OS_TCB       *p_tcb,    //Ŀ
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_SUSPEND_EN > 0u           //ʹ˺ OSTaskResume()
-void  OS_TaskResume (OS_TCB  *p_tcb,      //ƿָ
-                     OS_ERR  *p_err)      //ش
+#if OS_CFG_TASK_SUSPEND_EN > 0u           //如果使能了函数 OSTaskResume()
+void  OS_TaskResume (OS_TCB  *p_tcb,      //任务控制块指针
+                     OS_ERR  *p_err)      //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
-    CPU_CRITICAL_ENTER();                                      //ж
-   *p_err  = OS_ERR_NONE;                                      //Ϊ޴
-    switch (p_tcb->TaskState) {                                // p_tcb ״̬ദ
-        case OS_TASK_STATE_RDY:                                //״̬ûй״̬
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
+    CPU_CRITICAL_ENTER();                                      //关中断
+   *p_err  = OS_ERR_NONE;                                      //错误类型为“无错误”
+    switch (p_tcb->TaskState) {                                //根据 p_tcb 的任务状态分类处理
+        case OS_TASK_STATE_RDY:                                //如果状态中没有挂起状态
         case OS_TASK_STATE_DLY:
         case OS_TASK_STATE_PEND:
         case OS_TASK_STATE_PEND_TIMEOUT:
-             CPU_CRITICAL_EXIT();                              //ж
-            *p_err = OS_ERR_TASK_NOT_SUSPENDED;                //Ϊδ
-             break;                                            //
-
-        case OS_TASK_STATE_SUSPENDED:                          //ǡ״̬
-             OS_CRITICAL_ENTER_CPU_EXIT();                     //ؿж
-             p_tcb->SuspendCtr--;                              //ĹǶ1
-             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //ǰΪ0
-                 p_tcb->TaskState = OS_TASK_STATE_RDY;         //޸״̬Ϊ״̬
-                 OS_TaskRdy(p_tcb);                            // p_tcb б
+             CPU_CRITICAL_EXIT();                              //开中断
+            *p_err = OS_ERR_TASK_NOT_SUSPENDED;                //错误类型为“任务未被挂起”
+             break;                                            //跳出
+
+        case OS_TASK_STATE_SUSPENDED:                          //如果是“挂起状态”
+             OS_CRITICAL_ENTER_CPU_EXIT();                     //锁调度器，重开中断
+             p_tcb->SuspendCtr--;                              //任务的挂起嵌套数减1
+             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //如果挂起前套数为0
+                 p_tcb->TaskState = OS_TASK_STATE_RDY;         //修改状态为“就绪状态”
+                 OS_TaskRdy(p_tcb);                            //把 p_tcb 插入就绪列表
              }
-             OS_CRITICAL_EXIT_NO_SCHED();                      //
-             break;                                            //
+             OS_CRITICAL_EXIT_NO_SCHED();                      //开调度器，不调度任务
+             break;                                            //跳出
 
-        case OS_TASK_STATE_DLY_SUSPENDED:                      //ǡʱб
-             p_tcb->SuspendCtr--;                              //ĹǶ1
-             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //ǰΪ0
-                 p_tcb->TaskState = OS_TASK_STATE_DLY;         //޸״̬Ϊʱ״̬
+        case OS_TASK_STATE_DLY_SUSPENDED:                      //如果是“延时中被挂起”
+             p_tcb->SuspendCtr--;                              //任务的挂起嵌套数减1
+             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //如果挂起前套数为0
+                 p_tcb->TaskState = OS_TASK_STATE_DLY;         //修改状态为“延时状态”
              }
-             CPU_CRITICAL_EXIT();                              //ж
-             break;                                            //
+             CPU_CRITICAL_EXIT();                              //开中断
+             break;                                            //跳出
 
-        case OS_TASK_STATE_PEND_SUSPENDED:                     //ǡ޵ȴб
-             p_tcb->SuspendCtr--;                              //ĹǶ1
-             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //ǰΪ0
-                 p_tcb->TaskState = OS_TASK_STATE_PEND;        //޸״̬Ϊ޵ȴ״̬
+        case OS_TASK_STATE_PEND_SUSPENDED:                     //如果是“无期限等待中被挂起”
+             p_tcb->SuspendCtr--;                              //任务的挂起嵌套数减1
+             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //如果挂起前套数为0
+                 p_tcb->TaskState = OS_TASK_STATE_PEND;        //修改状态为“无期限等待状态”
              }
-             CPU_CRITICAL_EXIT();                              //ж
-             break;                                            //
+             CPU_CRITICAL_EXIT();                              //开中断
+             break;                                            //跳出
 
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:             //ǡ޵ȴб
-             p_tcb->SuspendCtr--;                              //ĹǶ1
-             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //ǰΪ0
-                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;//޸״̬Ϊ޵ȴ״̬
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:             //如果是“有期限等待中被挂起”
+             p_tcb->SuspendCtr--;                              //任务的挂起嵌套数减1
+             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)0) {     //如果挂起前套数为0
+                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;//修改状态为“有期限等待状态”
              }
-             CPU_CRITICAL_EXIT();                              //ж
-             break;                                            //
+             CPU_CRITICAL_EXIT();                              //开中断
+             break;                                            //跳出
 
-        default:                                               // p_tcb ״̬Ԥ
-             CPU_CRITICAL_EXIT();                              //ж
-            *p_err = OS_ERR_STATE_INVALID;                     //Ϊ״̬Ƿ
-             return;                                           //
+        default:                                               //如果 p_tcb 任务状态超出预期
+             CPU_CRITICAL_EXIT();                              //开中断
+            *p_err = OS_ERR_STATE_INVALID;                     //错误类型为“状态非法”
+             return;                                           //跳出
     }
 
-    OSSched();                                                 //
+    OSSched();                                                 //调度任务
 }
 #endif
 
@@ -2340,34 +2340,34 @@ void  OS_TaskReturn (void)
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,   //Ŀ
-                            OS_OPT   opt,     //ѡ
-                            CPU_TS   ts,      //ʱ
-                            OS_ERR  *p_err)   //ش
+OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,   //目标任务
+                            OS_OPT   opt,     //选项
+                            CPU_TS   ts,      //时间戳
+                            OS_ERR  *p_err)   //返回错误类型
 {
     OS_SEM_CTR  ctr;
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬ú
-                    //һֲڱжǰ CPU ״̬Ĵ
-                    // SRٽιжֻ豣SRжʱֵԭ
-
-    OS_CRITICAL_ENTER();                               //ٽ
-    if (p_tcb == (OS_TCB *)0) {                        // p_tcb Ϊ
-        p_tcb = OSTCBCurPtr;                           //źԼ
-    }
-    p_tcb->TS = ts;                                    //¼źʱ
-   *p_err     = OS_ERR_NONE;                           //Ϊ޴
-    switch (p_tcb->TaskState) {                        //Ŀ״̬ദ
-        case OS_TASK_STATE_RDY:                        //Ŀûеȴ״̬
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+                    //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+                    // SR（临界段关中断只需保存SR），开中断时将该值还原。
+
+    OS_CRITICAL_ENTER();                               //进入临界段
+    if (p_tcb == (OS_TCB *)0) {                        //如果 p_tcb 为空
+        p_tcb = OSTCBCurPtr;                           //将任务信号量发给自己（任务）
+    }
+    p_tcb->TS = ts;                                    //记录信号量被发布的时间戳
+   *p_err     = OS_ERR_NONE;                           //错误类型为“无错误”
+    switch (p_tcb->TaskState) {                        //跟吴目标任务的任务状态分类处理
+        case OS_TASK_STATE_RDY:                        //如果目标任务没有等待状态
         case OS_TASK_STATE_DLY:
         case OS_TASK_STATE_SUSPENDED:
         case OS_TASK_STATE_DLY_SUSPENDED:
-             switch (sizeof(OS_SEM_CTR)) {                        //жǷ񽫵¸
-                 case 1u:                                         //ֵ
-                      if (p_tcb->SemCtr == DEF_INT_08U_MAX_VAL) { //жϣ
-                          OS_CRITICAL_EXIT();                     //شΪ
-                         *p_err = OS_ERR_SEM_OVF;                 //ֵ0
-                          return ((OS_SEM_CTR)0);                 //д󣩣
-                      }                                           //ִС
+             switch (sizeof(OS_SEM_CTR)) {                        //判断是否将导致该信
+                 case 1u:                                         //号量计数值溢出，如
+                      if (p_tcb->SemCtr == DEF_INT_08U_MAX_VAL) { //果溢出，则开中断，
+                          OS_CRITICAL_EXIT();                     //返回错误类型为“计
+                         *p_err = OS_ERR_SEM_OVF;                 //数值溢出”，返回0
+                          return ((OS_SEM_CTR)0);                 //（有错误），不继续
+                      }                                           //执行。
                       break;                                      
 
                  case 2u:
@@ -2389,35 +2389,35 @@ OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,   //Ŀ
                  default:
                       break;
              }
-             p_tcb->SemCtr++;                              //źֵ1
-             ctr = p_tcb->SemCtr;                          //ȡźĵǰֵ
-             OS_CRITICAL_EXIT();                           //˳ٽ
-             break;                                        //
+             p_tcb->SemCtr++;                              //信号量计数值不溢出则加1
+             ctr = p_tcb->SemCtr;                          //获取信号量的当前计数值
+             OS_CRITICAL_EXIT();                           //退出临界段
+             break;                                        //跳出
 
-        case OS_TASK_STATE_PEND:                           //еȴ״̬
+        case OS_TASK_STATE_PEND:                           //如果任务有等待状态
         case OS_TASK_STATE_PEND_TIMEOUT:
         case OS_TASK_STATE_PEND_SUSPENDED:
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) { //ȴź
-                 OS_Post((OS_PEND_OBJ *)0,                    //źĿ
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) { //如果正等待任务信号量
+                 OS_Post((OS_PEND_OBJ *)0,                    //发布信号量给目标任务
                          (OS_TCB      *)p_tcb,
                          (void        *)0,
                          (OS_MSG_SIZE  )0u,
                          (CPU_TS       )ts);
-                 ctr = p_tcb->SemCtr;                         //ȡźĵǰֵ
-                 OS_CRITICAL_EXIT_NO_SCHED();                 //˳ٽΣ޵ȣ
-                 if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) { //ѡ˵
-                     OSSched();                               //
+                 ctr = p_tcb->SemCtr;                         //获取信号量的当前计数值
+                 OS_CRITICAL_EXIT_NO_SCHED();                 //退出临界段（无调度）
+                 if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) { //如果选择了调度任务
+                     OSSched();                               //调度任务
                  }
-             } else {                                         //ûȴź
-                 switch (sizeof(OS_SEM_CTR)) {                         //жǷ񽫵
-                     case 1u:                                          //źֵ
-                          if (p_tcb->SemCtr == DEF_INT_08U_MAX_VAL) {  //
-                              OS_CRITICAL_EXIT();                      //жϣ
-                             *p_err = OS_ERR_SEM_OVF;                  //Ϊ
-                              return ((OS_SEM_CTR)0);                  //ֵ
-                          }                                            //0д󣩣
-                          break;                                       //ִС
+             } else {                                         //如果没等待任务信号量
+                 switch (sizeof(OS_SEM_CTR)) {                         //判断是否将导致
+                     case 1u:                                          //该信号量计数值
+                          if (p_tcb->SemCtr == DEF_INT_08U_MAX_VAL) {  //溢出，如果溢出，
+                              OS_CRITICAL_EXIT();                      //则开中断，返回
+                             *p_err = OS_ERR_SEM_OVF;                  //错误类型为“计
+                              return ((OS_SEM_CTR)0);                  //数值溢出”，返
+                          }                                            //回0（有错误），
+                          break;                                       //不继续执行。
 
                      case 2u:
                           if (p_tcb->SemCtr == DEF_INT_16U_MAX_VAL) {
@@ -2438,19 +2438,19 @@ OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,   //Ŀ
                      default:
                           break;
                  }
-                 p_tcb->SemCtr++;                            //źֵ1
-                 ctr = p_tcb->SemCtr;                        //ȡźĵǰֵ
-                 OS_CRITICAL_EXIT();                         //˳ٽ
+                 p_tcb->SemCtr++;                            //信号量计数值不溢出则加1
+                 ctr = p_tcb->SemCtr;                        //获取信号量的当前计数值
+                 OS_CRITICAL_EXIT();                         //退出临界段
              }
-             break;                                          //
+             break;                                          //跳出
 
-        default:                                             //״̬Ԥ
-             OS_CRITICAL_EXIT();                             //˳ٽ
-            *p_err = OS_ERR_STATE_INVALID;                   //Ϊ״̬Ƿ
-             ctr   = (OS_SEM_CTR)0;                          // ctr
-             break;                                          //
+        default:                                             //如果任务状态超出预期
+             OS_CRITICAL_EXIT();                             //退出临界段
+            *p_err = OS_ERR_STATE_INVALID;                   //错误类型为“状态非法”
+             ctr   = (OS_SEM_CTR)0;                          //清零 ctr
+             break;                                          //跳出
     }
-    return (ctr);                                            //źĵǰֵ
+    return (ctr);                                            //返回信号量的当前计数值
 }
 
 /*$PAGE*/
@@ -2483,69 +2483,69 @@ OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,   //Ŀ
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TASK_SUSPEND_EN > 0u          //ʹ˺ OSTaskSuspend()
-void   OS_TaskSuspend (OS_TCB  *p_tcb,   //ƿָ
-                       OS_ERR  *p_err)   //ش
+#if OS_CFG_TASK_SUSPEND_EN > 0u          //如果使能了函数 OSTaskSuspend()
+void   OS_TaskSuspend (OS_TCB  *p_tcb,   //任务控制块指针
+                       OS_ERR  *p_err)   //返回错误类型
 {
-    CPU_SR_ALLOC();  //ʹõٽΣڹ/жʱʱú꣬ú
-									   //һֲڱжǰ CPU ״̬Ĵ
-									   // SRٽιжֻ豣SRжʱֵԭ
+    CPU_SR_ALLOC();  //使用到临界段（在关/开中断时）时必需该宏，该宏声明和
+									   //定义一个局部变量，用于保存关中断前的 CPU 状态寄存器
+									   // SR（临界段关中断只需保存SR），开中断时将该值还原。
 
-    CPU_CRITICAL_ENTER();                                   //ж
-    if (p_tcb == (OS_TCB *)0) {                             // p_tcb Ϊ
-        p_tcb = OSTCBCurPtr;                                //
+    CPU_CRITICAL_ENTER();                                   //关中断
+    if (p_tcb == (OS_TCB *)0) {                             //如果 p_tcb 为空
+        p_tcb = OSTCBCurPtr;                                //挂起自身
     }
 
-    if (p_tcb == OSTCBCurPtr) {                             //ǹ
-        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    //
-            CPU_CRITICAL_EXIT();                            //ж
-           *p_err = OS_ERR_SCHED_LOCKED;                    //Ϊ
-            return;                                         //أִֹͣ
+    if (p_tcb == OSTCBCurPtr) {                             //如果是挂起自身
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    //如果调度器被锁
+            CPU_CRITICAL_EXIT();                            //开中断
+           *p_err = OS_ERR_SCHED_LOCKED;                    //错误类型为“调度器被锁”
+            return;                                         //返回，停止执行
         }
     }
 
-   *p_err = OS_ERR_NONE;                                      //Ϊ޴
-    switch (p_tcb->TaskState) {                               // p_tcb ״̬ദ
-        case OS_TASK_STATE_RDY:                               //Ǿ״̬
-             OS_CRITICAL_ENTER_CPU_EXIT();                    //ؿж
-             p_tcb->TaskState  =  OS_TASK_STATE_SUSPENDED;    //״̬Ϊ״̬
-             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //ǰΪ1
-             OS_RdyListRemove(p_tcb);                         //ӾбƳ
-             OS_CRITICAL_EXIT_NO_SCHED();                     //е
-             break;                                           //
-
-        case OS_TASK_STATE_DLY:                               //ʱ״̬
-             p_tcb->TaskState  = OS_TASK_STATE_DLY_SUSPENDED; //״̬Ϊʱб
-             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //ǰΪ1
-             CPU_CRITICAL_EXIT();                             //ж
-             break;                                           //
-
-        case OS_TASK_STATE_PEND:                              //޵ȴ״̬
-             p_tcb->TaskState  = OS_TASK_STATE_PEND_SUSPENDED;//״̬Ϊ޵ȴб
-             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //ǰΪ1
-             CPU_CRITICAL_EXIT();                             //ж
-             break;                                           //
-
-        case OS_TASK_STATE_PEND_TIMEOUT:                      //޵ȴ״̬
-             p_tcb->TaskState  = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED; //Ϊ޵ȴб
-             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //ǰΪ1
-             CPU_CRITICAL_EXIT();                             //ж
-             break;                                           //
-
-        case OS_TASK_STATE_SUSPENDED:                         //״̬й״̬
+   *p_err = OS_ERR_NONE;                                      //错误类型为“无错误”
+    switch (p_tcb->TaskState) {                               //根据 p_tcb 的任务状态分类处理
+        case OS_TASK_STATE_RDY:                               //如果是就绪状态
+             OS_CRITICAL_ENTER_CPU_EXIT();                    //锁调度器，重开中断
+             p_tcb->TaskState  =  OS_TASK_STATE_SUSPENDED;    //任务状态改为“挂起状态”
+             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //挂起前套数为1
+             OS_RdyListRemove(p_tcb);                         //将任务从就绪列表移除
+             OS_CRITICAL_EXIT_NO_SCHED();                     //开调度器，不进行调度
+             break;                                           //跳出
+
+        case OS_TASK_STATE_DLY:                               //如果是延时状态
+             p_tcb->TaskState  = OS_TASK_STATE_DLY_SUSPENDED; //任务状态改为“延时中被挂起”
+             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //挂起前套数为1
+             CPU_CRITICAL_EXIT();                             //开中断
+             break;                                           //跳出
+
+        case OS_TASK_STATE_PEND:                              //如果是无期限等待状态
+             p_tcb->TaskState  = OS_TASK_STATE_PEND_SUSPENDED;//任务状态改为“无期限等待中被挂起”
+             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //挂起前套数为1
+             CPU_CRITICAL_EXIT();                             //开中断
+             break;                                           //跳出
+
+        case OS_TASK_STATE_PEND_TIMEOUT:                      //如果是有期限等待状态
+             p_tcb->TaskState  = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED; //改为“有期限等待中被挂起”
+             p_tcb->SuspendCtr = (OS_NESTING_CTR)1;           //挂起前套数为1
+             CPU_CRITICAL_EXIT();                             //开中断
+             break;                                           //跳出
+
+        case OS_TASK_STATE_SUSPENDED:                         //如果状态中有挂起状态
         case OS_TASK_STATE_DLY_SUSPENDED:
         case OS_TASK_STATE_PEND_SUSPENDED:
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             p_tcb->SuspendCtr++;                             //Ƕ1
-             CPU_CRITICAL_EXIT();                             //ж
-             break;                                           //
-
-        default:                                              //״̬Ԥ
-             CPU_CRITICAL_EXIT();                             //ж
-            *p_err = OS_ERR_STATE_INVALID;                    //Ϊ״̬Ƿ
-             return;                                          //أִֹͣ
+             p_tcb->SuspendCtr++;                             //挂起嵌套数加1
+             CPU_CRITICAL_EXIT();                             //开中断
+             break;                                           //跳出
+
+        default:                                              //如果任务状态超出预期
+             CPU_CRITICAL_EXIT();                             //开中断
+            *p_err = OS_ERR_STATE_INVALID;                    //错误类型为“状态非法”
+             return;                                          //返回，停止执行
     } 
 
-    OSSched();                                                //
+    OSSched();                                                //调度任务
 }
 #endif
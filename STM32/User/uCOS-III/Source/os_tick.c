@@ -64,16 +64,16 @@ void  OS_TickTask (void  *p_arg)
     CPU_TS  ts;
 
 
-    p_arg = p_arg;                                           //Ԥ뾯棬ûʵ
+    p_arg = p_arg;                                           //预防编译警告，没有实际意义
 
-    while (DEF_ON) {                                         //ѭ
-        (void)OSTaskSemPend((OS_TICK  )0,                    //ȴʱжϵźյź
+    while (DEF_ON) {                                         //循环运行
+        (void)OSTaskSemPend((OS_TICK  )0,                    //等待来自时基中断的信号量，接收到信号量后继续运行
                             (OS_OPT   )OS_OPT_PEND_BLOCKING,
                             (CPU_TS  *)&ts,
                             (OS_ERR  *)&err);            
-        if (err == OS_ERR_NONE) {                            //ܵźûд
-            if (OSRunning == OS_STATE_OS_RUNNING) {          //ϵͳ
-                OS_TickListUpdate();                         //ʱȴʱ䣨ʱʱȣ
+        if (err == OS_ERR_NONE) {                            //如果上面接受的信号量没有错误
+            if (OSRunning == OS_STATE_OS_RUNNING) {          //如果操作系统正在运行
+                OS_TickListUpdate();                         //更新所有任务的时间等待时间（如延时、超时等）
             }
         }
     }
@@ -217,10 +217,10 @@ void  OS_TickListInit (void)
 ************************************************************************************************************************
 */
 
-void  OS_TickListInsert (OS_TCB   *p_tcb, //ƿ
-                         OS_TICK   time,  //ʱ
-                         OS_OPT    opt,   //ѡ
-                         OS_ERR   *p_err) //ش
+void  OS_TickListInsert (OS_TCB   *p_tcb, //任务控制块
+                         OS_TICK   time,  //时间
+                         OS_OPT    opt,   //选项
+                         OS_ERR   *p_err) //返回错误类型
 {
     OS_TICK            tick_delta;
     OS_TICK            tick_next;
@@ -231,89 +231,89 @@ void  OS_TickListInsert (OS_TCB   *p_tcb, //
 
 
 
-    if (opt == OS_OPT_TIME_MATCH) {                                // time Ǹʱ
-        tick_delta = time - OSTickCtr - 1u;                        //뵽ڻж೤ʱ
-        if (tick_delta > OS_TICK_TH_RDY) {                         //ʱʱ䳬
-            p_tcb->TickCtrMatch = (OS_TICK        )0u;             //ʱӽĵƥ0
-            p_tcb->TickRemain   = (OS_TICK        )0u;             //ʱʱӽ0
-            p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;              //񲻲б
-           *p_err               =  OS_ERR_TIME_ZERO_DLY;           //൱ڡ0ʱ
-            return;                                                //أб
+    if (opt == OS_OPT_TIME_MATCH) {                                //如果 time 是个绝对时间
+        tick_delta = time - OSTickCtr - 1u;                        //计算离到期还有多长时间
+        if (tick_delta > OS_TICK_TH_RDY) {                         //如果延时时间超过了门限
+            p_tcb->TickCtrMatch = (OS_TICK        )0u;             //将任务的时钟节拍的匹配变量置0
+            p_tcb->TickRemain   = (OS_TICK        )0u;             //将任务的延时还需时钟节拍数置0
+            p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;              //该任务不插入节拍列表
+           *p_err               =  OS_ERR_TIME_ZERO_DLY;           //错误类型相当于“0延时”
+            return;                                                //返回，不将任务插入节拍列表
         }
-        p_tcb->TickCtrMatch = time;                                //ȴƥΪ OSTickCtr = time
-        p_tcb->TickRemain   = tick_delta + 1u;                     //뵽ڻж೤ʱ
-
-    } else if (time > (OS_TICK)0u) {                               // time > 0
-        if (opt == OS_OPT_TIME_PERIODIC) {                         // time ʱ 
-            tick_next  = p_tcb->TickCtrPrev + time;                //Ҫƥʱӽܼ
-            tick_delta = tick_next - OSTickCtr - 1u;               //ƥ仹и೤ʱ
-            if (tick_delta < time) {                               // p_tcb->TickCtrPrev < OSTickCtr + 1 
-                p_tcb->TickCtrMatch = tick_next;                   // p_tcb->TickCtrPrev + time Ϊʱӽƥ
-            } else {                                               // p_tcb->TickCtrPrev >= OSTickCtr + 1 
-                p_tcb->TickCtrMatch = OSTickCtr + time;            // OSTickCtr + time Ϊʱӽƥ
+        p_tcb->TickCtrMatch = time;                                //任务等待的匹配点为 OSTickCtr = time
+        p_tcb->TickRemain   = tick_delta + 1u;                     //计算任务离到期还有多长时间
+
+    } else if (time > (OS_TICK)0u) {                               //如果 time > 0
+        if (opt == OS_OPT_TIME_PERIODIC) {                         //如果 time 是周期性时间 
+            tick_next  = p_tcb->TickCtrPrev + time;                //计算任务接下来要匹配的时钟节拍总计数
+            tick_delta = tick_next - OSTickCtr - 1u;               //计算任务离匹配还有个多长时间
+            if (tick_delta < time) {                               //如果 p_tcb->TickCtrPrev < OSTickCtr + 1 
+                p_tcb->TickCtrMatch = tick_next;                   //将 p_tcb->TickCtrPrev + time 设为时钟节拍匹配点
+            } else {                                               //如果 p_tcb->TickCtrPrev >= OSTickCtr + 1 
+                p_tcb->TickCtrMatch = OSTickCtr + time;            //将 OSTickCtr + time 设为时钟节拍匹配点
             }
-            p_tcb->TickRemain   = p_tcb->TickCtrMatch - OSTickCtr; //뵽ڻж೤ʱ
-            p_tcb->TickCtrPrev  = p_tcb->TickCtrMatch;             //浱ǰƥֵΪһʱ
+            p_tcb->TickRemain   = p_tcb->TickCtrMatch - OSTickCtr; //计算任务离到期还有多长时间
+            p_tcb->TickCtrPrev  = p_tcb->TickCtrMatch;             //保存当前匹配值为下一周期延时用
 
-        } else {                                                   // time ʱ
-            p_tcb->TickCtrMatch = OSTickCtr + time;                //ȴƥΪ OSTickCtr + time
-            p_tcb->TickRemain   = time;                            //뵽ڵʱ time
+        } else {                                                   //如果 time 是相对时间
+            p_tcb->TickCtrMatch = OSTickCtr + time;                //任务等待的匹配点为 OSTickCtr + time
+            p_tcb->TickRemain   = time;                            //计算任务离到期的时间就是 time
         }
 
-    } else {                                                       // time = 0
-        p_tcb->TickCtrMatch = (OS_TICK        )0u;                 //ʱӽĵƥ0
-        p_tcb->TickRemain   = (OS_TICK        )0u;                 //ʱʱӽ0
-        p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;                  //񲻲б
-       *p_err               =  OS_ERR_TIME_ZERO_DLY;               //Ϊ0ʱ
-        return;                                                    //أб
+    } else {                                                       //如果 time = 0
+        p_tcb->TickCtrMatch = (OS_TICK        )0u;                 //将任务的时钟节拍的匹配变量置0
+        p_tcb->TickRemain   = (OS_TICK        )0u;                 //将任务的延时还需时钟节拍数置0
+        p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;                  //该任务不插入节拍列表
+       *p_err               =  OS_ERR_TIME_ZERO_DLY;               //错误类型为“0延时”
+        return;                                                    //返回，不将任务插入节拍列表
     }
 
 
-    spoke   = (OS_TICK_SPOKE_IX)(p_tcb->TickCtrMatch % OSCfg_TickWheelSize); //ʹùϣ㷨ȡࣩ 
-    p_spoke = &OSCfg_TickWheel[spoke];                                       //OSCfg_TickWheelĸԪأ֯һб
-                                                                             //½бӦɷҵ
-    if (p_spoke->NbrEntries == (OS_OBJ_QTY)0u) {                 //ǰбΪ
-        p_tcb->TickNextPtr   = (OS_TCB   *)0;                    //ָбһָÿ
-        p_tcb->TickPrevPtr   = (OS_TCB   *)0;                    //ָбǰһָÿ
-        p_spoke->FirstPtr    =  p_tcb;                           //ǰΪýбĵһ
-        p_spoke->NbrEntries  = (OS_OBJ_QTY)1u;                   //беԪĿΪ1
-    } else {                                                     //ǰбǿ
-        p_tcb1     = p_spoke->FirstPtr;                          //ȡбеĵһ 
-        while (p_tcb1 != (OS_TCB *)0) {                          //
-            p_tcb1->TickRemain = p_tcb1->TickCtrMatch            //ʣȴʱ
+    spoke   = (OS_TICK_SPOKE_IX)(p_tcb->TickCtrMatch % OSCfg_TickWheelSize); //使用哈希算法（取余）来决定任务存于数组 
+    p_spoke = &OSCfg_TickWheel[spoke];                                       //OSCfg_TickWheel的哪个元素（组织一个节拍列表），
+                                                                             //与更新节拍列表相对应，可方便查找到期任务。
+    if (p_spoke->NbrEntries == (OS_OBJ_QTY)0u) {                 //如果当前节拍列表为空
+        p_tcb->TickNextPtr   = (OS_TCB   *)0;                    //任务中指向节拍列表中下一个任务的指针置空
+        p_tcb->TickPrevPtr   = (OS_TCB   *)0;                    //任务中指向节拍列表中前一个任务的指针置空
+        p_spoke->FirstPtr    =  p_tcb;                           //当前任务被列为该节拍列表的第一个任务
+        p_spoke->NbrEntries  = (OS_OBJ_QTY)1u;                   //节拍列表中的元素数目为1
+    } else {                                                     //如果当前节拍列表非空
+        p_tcb1     = p_spoke->FirstPtr;                          //获取列表中的第一个任务 
+        while (p_tcb1 != (OS_TCB *)0) {                          //如果该任务存在
+            p_tcb1->TickRemain = p_tcb1->TickCtrMatch            //计算该任务的剩余等待时间
                                - OSTickCtr;
-            if (p_tcb->TickRemain > p_tcb1->TickRemain) {        //ǰʣȴʱڸ
-                if (p_tcb1->TickNextPtr != (OS_TCB *)0) {        //бһԪ
-                    p_tcb1               =  p_tcb1->TickNextPtr; //õǰһȽ
-                } else {                                         //бһԪ
-                    p_tcb->TickNextPtr   = (OS_TCB *)0;          //ǰΪбһԪ
-                    p_tcb->TickPrevPtr   =  p_tcb1;              //ǵǰǰһԪ
-                    p_tcb1->TickNextPtr  =  p_tcb;               //ǰǸĺһԪ
-                    p_tcb1               = (OS_TCB *)0;          //ɣ˳ while ѭ
+            if (p_tcb->TickRemain > p_tcb1->TickRemain) {        //如果当前任务的剩余等待时间大于该任务的
+                if (p_tcb1->TickNextPtr != (OS_TCB *)0) {        //如果该任务不是列表的最后一个元素
+                    p_tcb1               =  p_tcb1->TickNextPtr; //让当前任务继续与该任务的下一个任务作比较
+                } else {                                         //如果该任务是列表的最后一个元素
+                    p_tcb->TickNextPtr   = (OS_TCB *)0;          //当前任务为列表的最后一个元素
+                    p_tcb->TickPrevPtr   =  p_tcb1;              //该任务是当前任务的前一个元素
+                    p_tcb1->TickNextPtr  =  p_tcb;               //当前任务是该任务的后一个元素
+                    p_tcb1               = (OS_TCB *)0;          //插入完成，退出 while 循环
                 }
-            } else {                                             //ǰʣȴʱ䲻ڸ
-                if (p_tcb1->TickPrevPtr == (OS_TCB *)0) {        //бĵһԪ
-                    p_tcb->TickPrevPtr   = (OS_TCB *)0;          //ǰΪбĵһԪ
-                    p_tcb->TickNextPtr   =  p_tcb1;              //ǵǰĺһԪ
-                    p_tcb1->TickPrevPtr  =  p_tcb;               //ǰǸǰһԪ
-                    p_spoke->FirstPtr    =  p_tcb;               //ǰбĵһԪ
-                } else {                                         //ҲбĵһԪ
-                    p_tcb0               =  p_tcb1->TickPrevPtr; // p_tcb0 ݴǰһ
-                    p_tcb->TickPrevPtr   =  p_tcb0;              //ǰһΪǰǰһ
-                    p_tcb->TickNextPtr   =  p_tcb1;              //Ϊǰĺһ
-                    p_tcb0->TickNextPtr  =  p_tcb;               // p_tcb0 ݴһΪǰ
-                    p_tcb1->TickPrevPtr  =  p_tcb;               // ǰһҲΪǰ
+            } else {                                             //如果当前任务的剩余等待时间不大于该任务的
+                if (p_tcb1->TickPrevPtr == (OS_TCB *)0) {        //如果该任务是列表的第一个元素
+                    p_tcb->TickPrevPtr   = (OS_TCB *)0;          //当前任务就作为列表的第一个元素
+                    p_tcb->TickNextPtr   =  p_tcb1;              //该任务是当前任务的后一个元素
+                    p_tcb1->TickPrevPtr  =  p_tcb;               //当前任务是该任务的前一个元素
+                    p_spoke->FirstPtr    =  p_tcb;               //当前任务是列表的第一个元素
+                } else {                                         //如果该任务也不是是列表的第一个元素
+                    p_tcb0               =  p_tcb1->TickPrevPtr; // p_tcb0 暂存该任务的前一个任务
+                    p_tcb->TickPrevPtr   =  p_tcb0;              //该任务的前一个任务作为当前任务的前一个任务
+                    p_tcb->TickNextPtr   =  p_tcb1;              //该任务作为当前任务的后一个任务
+                    p_tcb0->TickNextPtr  =  p_tcb;               // p_tcb0 暂存的任务的下一个任务改为当前任务
+                    p_tcb1->TickPrevPtr  =  p_tcb;               // 该任务的前一个任务也改为当前任务
                 }
-                p_tcb1 = (OS_TCB *)0;                            //ɣ˳ while ѭ
+                p_tcb1 = (OS_TCB *)0;                            //插入完成，退出 while 循环
             }
         }
-        p_spoke->NbrEntries++;                                   //беԪĿ1
+        p_spoke->NbrEntries++;                                   //节拍列表中的元素数目加1
     }
-    if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {          //½бԪĿ¼
+    if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {          //更新节拍列表的元素数目的最大记录
         p_spoke->NbrEntriesMax = p_spoke->NbrEntries;
     }
-    p_tcb->TickSpokePtr = p_spoke;                               //¼ǰĸб
-   *p_err               = OS_ERR_NONE;                           //Ϊ޴
+    p_tcb->TickSpokePtr = p_spoke;                               //记录当前任务存放于哪个节拍列表
+   *p_err               = OS_ERR_NONE;                           //错误类型为“无错误”
 }
 
 /*$PAGE*/
@@ -334,7 +334,7 @@ void  OS_TickListInsert (OS_TCB   *p_tcb, //
 ************************************************************************************************************************
 */
 
-void  OS_TickListRemove (OS_TCB  *p_tcb)                      //ӽбƳ
+void  OS_TickListRemove (OS_TCB  *p_tcb)                      //把任务从节拍列表移除
 {
     OS_TICK_SPOKE  *p_spoke;
     OS_TCB         *p_tcb1;
@@ -342,28 +342,28 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)                      //
 
 
 
-    p_spoke = p_tcb->TickSpokePtr;                            //ȡλĸб
-    if (p_spoke != (OS_TICK_SPOKE *)0) {                      //ȷڽб
-        p_tcb->TickRemain = (OS_TICK)0u;                      //ʱʱӽ0            
-        if (p_spoke->FirstPtr == p_tcb) {                     //Ϊбĵһ
-            p_tcb1            = (OS_TCB *)p_tcb->TickNextPtr; //ȡĺһΪ p_tcb1
-            p_spoke->FirstPtr = p_tcb1;                       // p_tcb1 Ϊбĵһ
-            if (p_tcb1 != (OS_TCB *)0) {                      // p_tcb1 ǿ
-                p_tcb1->TickPrevPtr = (OS_TCB *)0;            //p_tcb1 ǰѲ
+    p_spoke = p_tcb->TickSpokePtr;                            //获取任务位于哪个节拍列表
+    if (p_spoke != (OS_TICK_SPOKE *)0) {                      //如果任务的确在节拍列表中
+        p_tcb->TickRemain = (OS_TICK)0u;                      //将任务的延时还需时钟节拍数置0            
+        if (p_spoke->FirstPtr == p_tcb) {                     //如果任务为节拍列表的第一个任务
+            p_tcb1            = (OS_TCB *)p_tcb->TickNextPtr; //获取任务的后一个任务为 p_tcb1
+            p_spoke->FirstPtr = p_tcb1;                       //把 p_tcb1 作为节拍列表的第一个任务
+            if (p_tcb1 != (OS_TCB *)0) {                      //如果 p_tcb1 非空
+                p_tcb1->TickPrevPtr = (OS_TCB *)0;            //p_tcb1 前面已不存在任务
             }
-        } else {                                              //Ϊбĵһ
-            p_tcb1              = p_tcb->TickPrevPtr;         //ȡǰһΪ p_tcb1
-            p_tcb2              = p_tcb->TickNextPtr;         //ȡĺһΪ p_tcb2
-            p_tcb1->TickNextPtr = p_tcb2;                     // p_tcb2 Ϊ p_tcb1 ĺһ
-            if (p_tcb2 != (OS_TCB *)0) {                      // p_tcb2 ǿ
-                p_tcb2->TickPrevPtr = p_tcb1;                 // p_tcb1 Ϊ p_tcb2 ǰһ
+        } else {                                              //如果任务不为节拍列表的第一个任务
+            p_tcb1              = p_tcb->TickPrevPtr;         //获取任务的前一个任务为 p_tcb1
+            p_tcb2              = p_tcb->TickNextPtr;         //获取任务的后一个任务为 p_tcb2
+            p_tcb1->TickNextPtr = p_tcb2;                     //将 p_tcb2 作为 p_tcb1 的后一个任务
+            if (p_tcb2 != (OS_TCB *)0) {                      //如果 p_tcb2 非空
+                p_tcb2->TickPrevPtr = p_tcb1;                 //把 p_tcb1 作为 p_tcb2 的前一个任务
             }
         }
-        p_tcb->TickNextPtr  = (OS_TCB        *)0;             //ĺһ
-        p_tcb->TickPrevPtr  = (OS_TCB        *)0;             //ǰһ
-        p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;             //κνб
-        p_tcb->TickCtrMatch = (OS_TICK        )0u;            //ʱӽĵƥ0
-        p_spoke->NbrEntries--;                                //беԪĿ1
+        p_tcb->TickNextPtr  = (OS_TCB        *)0;             //清空任务的后一个任务
+        p_tcb->TickPrevPtr  = (OS_TCB        *)0;             //清空任务的前一个任务
+        p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;             //任务不再属于任何节拍列表
+        p_tcb->TickCtrMatch = (OS_TICK        )0u;            //将任务的时钟节拍的匹配变量置0
+        p_spoke->NbrEntries--;                                //节拍列表中的元素数目减1
     }
 }
 
@@ -421,99 +421,99 @@ void  OS_TickListUpdate (void)
     OS_TICK_SPOKE_IX   spoke;
     CPU_TS             ts_start;
     CPU_TS             ts_end;
-    CPU_SR_ALLOC();                                                   //ʹõٽΣڹ/жʱʱú꣬úͶһֲ
-                                                                      //ڱжǰ CPU ״̬Ĵ SRٽιжֻ豣SR
-                                                                      //жʱֵԭ
-    OS_CRITICAL_ENTER();                                              //ٽ
-    ts_start = OS_TS_GET();                                           //ȡ OS_TickTask() ʼʱ
-    OSTickCtr++;                                                      //ʱӽԼ
-    spoke    = (OS_TICK_SPOKE_IX)(OSTickCtr % OSCfg_TickWheelSize);   //ʹùϣ㷨ȡࣩСҵλ OSCfg_TickWheel 
-    p_spoke  = &OSCfg_TickWheel[spoke];                               //ĸԪأһбʱӦֻб
-    p_tcb    = p_spoke->FirstPtr;                                     //ȡб׸ƿĵַ
-    done     = DEF_FALSE;                                             //ʹ while õ
+    CPU_SR_ALLOC();                                                   //使用到临界段（在关/开中断时）时必需该宏，该宏声明和定义一个局部变
+                                                                      //量，用于保存关中断前的 CPU 状态寄存器 SR（临界段关中断只需保存SR）
+                                                                      //，开中断时将该值还原。
+    OS_CRITICAL_ENTER();                                              //进入临界段
+    ts_start = OS_TS_GET();                                           //获取 OS_TickTask() 任务的起始时间戳
+    OSTickCtr++;                                                      //时钟节拍数自加
+    spoke    = (OS_TICK_SPOKE_IX)(OSTickCtr % OSCfg_TickWheelSize);   //使用哈希算法（取余）缩小查找到期任务位于 OSCfg_TickWheel 数组的
+    p_spoke  = &OSCfg_TickWheel[spoke];                               //哪个元素（一个节拍列表），与任务插入数组时对应，下面只操作该列表。
+    p_tcb    = p_spoke->FirstPtr;                                     //获取节拍列表的首个任务控制块的地址
+    done     = DEF_FALSE;                                             //使下面 while 体得到运行
     while (done == DEF_FALSE) {
-        if (p_tcb != (OS_TCB *)0) {                                   //񲻿գڣ
-            p_tcb_next = p_tcb->TickNextPtr;                          //ȡбнڸһƿĵַ  
-            switch (p_tcb->TaskState) {                               //ݸ״̬
-                case OS_TASK_STATE_RDY:                               //״̬ʱ¼޹أ
+        if (p_tcb != (OS_TCB *)0) {                                   //如果该任务不空（存在）
+            p_tcb_next = p_tcb->TickNextPtr;                          //获取该列表中紧邻该任务的下一个任务控制块的地址  
+            switch (p_tcb->TaskState) {                               //根据该任务的任务状态处理
+                case OS_TASK_STATE_RDY:                               //如果任务状态均是与时间事件无关，就无需理会
                 case OS_TASK_STATE_PEND:
                 case OS_TASK_STATE_SUSPENDED:
                 case OS_TASK_STATE_PEND_SUSPENDED:
                      break;
 
-                case OS_TASK_STATE_DLY:                               //ʱ״̬
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //ʱĵʣʱ 
+                case OS_TASK_STATE_DLY:                               //如果是延时状态
+                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //计算延时的的剩余时间 
                                        - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {          // 
-                         p_tcb->TaskState = OS_TASK_STATE_RDY;        //޸״̬Ϊ״̬
-                         OS_TaskRdy(p_tcb);                           //
-                     } else {                                         //δУб϶Ҳδ
-                         done             = DEF_TRUE;                 //ٱб˳ while ѭ
+                     if (OSTickCtr == p_tcb->TickCtrMatch) {          //如果任务期满 
+                         p_tcb->TaskState = OS_TASK_STATE_RDY;        //修改任务状态量为就绪状态
+                         OS_TaskRdy(p_tcb);                           //让任务就绪
+                     } else {                                         //如果任务未期满（由于升序排列，该列表后面的任务肯定也未期满）
+                         done             = DEF_TRUE;                 //不再遍历该列表，退出 while 循环
                      }
                      break;
 
-                case OS_TASK_STATE_PEND_TIMEOUT:                      //޵ȴ״̬
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //޵ĵʣʱ
+                case OS_TASK_STATE_PEND_TIMEOUT:                      //如果是有期限等待状态
+                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //计算期限的的剩余时间
                                        - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {          // 
-#if (OS_MSG_EN > 0u)                                                  //ʹϢУͨϢлϢУ
-                         p_tcb->MsgPtr     = (void      *)0;          //񱣴յϢĵַĳԱ
-                         p_tcb->MsgSize    = (OS_MSG_SIZE)0u;         //񱣴յϢĳȵĳԱ
+                     if (OSTickCtr == p_tcb->TickCtrMatch) {          //如果任务期满 
+#if (OS_MSG_EN > 0u)                                                  //如果使能了消息队列（普通消息队列或任务消息队列）
+                         p_tcb->MsgPtr     = (void      *)0;          //把任务保存接收到消息的地址的成员清空
+                         p_tcb->MsgSize    = (OS_MSG_SIZE)0u;         //把任务保存接收到消息的长度的成员清零
 #endif
-                         p_tcb->TS         = OS_TS_GET();             //¼ȴʱ
-                         OS_PendListRemove(p_tcb);                    //ӵȴбƳ
-                         OS_TaskRdy(p_tcb);                           //
-                         p_tcb->TaskState  = OS_TASK_STATE_RDY;       //޸״̬Ϊ״̬
-                         p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;  //¼ȴ״̬Ϊʱ
-                         p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING; //¼ȴں˶Ϊ
-                     } else {                                         //δУб϶Ҳδ
-                         done              = DEF_TRUE;                //ٱб˳ while ѭ
+                         p_tcb->TS         = OS_TS_GET();             //记录任务结束等待的时间戳
+                         OS_PendListRemove(p_tcb);                    //从等待列表移除该任务
+                         OS_TaskRdy(p_tcb);                           //让任务就绪
+                         p_tcb->TaskState  = OS_TASK_STATE_RDY;       //修改任务状态量为就绪状态
+                         p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;  //记录等待状态为超时
+                         p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING; //记录等待内核对象变量为空
+                     } else {                                         //如果任务未期满（由于升序排列，该列表后面的任务肯定也未期满）
+                         done              = DEF_TRUE;                //不再遍历该列表，退出 while 循环
                      }
                      break;
 
-                case OS_TASK_STATE_DLY_SUSPENDED:                     //ʱб״̬
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //ʱĵʣʱ 
+                case OS_TASK_STATE_DLY_SUSPENDED:                     //如果是延时中被挂起状态
+                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //计算延时的的剩余时间 
                                        - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {          //
-                         p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED; //޸״̬Ϊ״̬
-                         OS_TickListRemove(p_tcb);                    //ӽбƳ
-                     } else {                                         //δУб϶Ҳδ
-                         done              = DEF_TRUE;                //ٱб˳ while ѭ
+                     if (OSTickCtr == p_tcb->TickCtrMatch) {          //如果任务期满
+                         p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED; //修改任务状态量为被挂起状态
+                         OS_TickListRemove(p_tcb);                    //从节拍列表移除该任务
+                     } else {                                         //如果任务未期满（由于升序排列，该列表后面的任务肯定也未期满）
+                         done              = DEF_TRUE;                //不再遍历该列表，退出 while 循环
                      }
                      break;
 
-                case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:            //޵ȴб״̬
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //޵ĵʣʱ
+                case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:            //如果是有期限等待中被挂起状态
+                     p_tcb->TickRemain = p_tcb->TickCtrMatch          //计算期限的的剩余时间
                                        - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {          // 
-#if (OS_MSG_EN > 0u)                                                  //ʹϢУͨϢлϢУ
-                         p_tcb->MsgPtr     = (void      *)0;          //񱣴յϢĵַĳԱ
-                         p_tcb->MsgSize    = (OS_MSG_SIZE)0u;         //񱣴յϢĳȵĳԱ
+                     if (OSTickCtr == p_tcb->TickCtrMatch) {          //如果任务期满 
+#if (OS_MSG_EN > 0u)                                                  //如果使能了消息队列（普通消息队列或任务消息队列）
+                         p_tcb->MsgPtr     = (void      *)0;          //把任务保存接收到消息的地址的成员清空
+                         p_tcb->MsgSize    = (OS_MSG_SIZE)0u;         //把任务保存接收到消息的长度的成员清零
 #endif
-                         p_tcb->TS         = OS_TS_GET();             //¼ȴʱ
-                         OS_PendListRemove(p_tcb);                    //ӵȴбƳ
-                         OS_TickListRemove(p_tcb);                    //ӽбƳ
-                         p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED; //޸״̬Ϊ״̬
-                         p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;  //¼ȴ״̬Ϊʱ
-                         p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING; //¼ȴں˶Ϊ
-                     } else {                                         //δУб϶Ҳδ
-                         done              = DEF_TRUE;                //ٱб˳ while ѭ
+                         p_tcb->TS         = OS_TS_GET();             //记录任务结束等待的时间戳
+                         OS_PendListRemove(p_tcb);                    //从等待列表移除该任务
+                         OS_TickListRemove(p_tcb);                    //从节拍列表移除该任务
+                         p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED; //修改任务状态量为被挂起状态
+                         p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;  //记录等待状态为超时
+                         p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING; //记录等待内核对象变量为空
+                     } else {                                         //如果任务未期满（由于升序排列，该列表后面的任务肯定也未期满）
+                         done              = DEF_TRUE;                //不再遍历该列表，退出 while 循环
                      }
                      break;
 
                 default:
                      break;
             }
-            p_tcb = p_tcb_next;                                       //бһ
-        } else {                                                      //Ϊգб϶Ҳǿյģ
-            done  = DEF_TRUE;                                         //ٱб˳ while ѭ
+            p_tcb = p_tcb_next;                                       //遍历节拍列表的下一个任务
+        } else {                                                      //如果该任务为空（节拍列表后面肯定也都是空的）
+            done  = DEF_TRUE;                                         //不再遍历该列表，退出 while 循环
         }
     }
-    ts_end = OS_TS_GET() - ts_start;                                  //ȡ OS_TickTask() Ľʱִʱ
-    if (OSTickTaskTimeMax < ts_end) {                                 // OS_TickTask() ʱ
+    ts_end = OS_TS_GET() - ts_start;                                  //获取 OS_TickTask() 任务的结束时间戳，并计算其执行时间
+    if (OSTickTaskTimeMax < ts_end) {                                 //更新 OS_TickTask() 任务的最大运行时间
         OSTickTaskTimeMax = ts_end;
     }
-    OS_CRITICAL_EXIT();                                               //˳ٽ
+    OS_CRITICAL_EXIT();                                               //退出临界段
 }
 
 
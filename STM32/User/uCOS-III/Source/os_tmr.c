@@ -101,69 +101,69 @@ const  CPU_CHAR  *os_tmr__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-void  OSTmrCreate (OS_TMR               *p_tmr,          //ʱƿָ
-                   CPU_CHAR             *p_name,         //ʱڵ
-                   OS_TICK               dly,            //ʼʱ
-                   OS_TICK               period,         //ڶʱؽ
-                   OS_OPT                opt,            //ѡ
-                   OS_TMR_CALLBACK_PTR   p_callback,     //ʱʱĻص
-                   void                 *p_callback_arg, //صĲ
-                   OS_ERR               *p_err)          //ش
+void  OSTmrCreate (OS_TMR               *p_tmr,          //定时器控制块指针
+                   CPU_CHAR             *p_name,         //命名定时器，有助于调试
+                   OS_TICK               dly,            //初始定时节拍数
+                   OS_TICK               period,         //周期定时重载节拍数
+                   OS_OPT                opt,            //选项
+                   OS_TMR_CALLBACK_PTR   p_callback,     //定时到期时的回调函数
+                   void                 *p_callback_arg, //传给回调函数的参数
+                   OS_ERR               *p_err)          //返回错误类型
 {
-    CPU_SR_ALLOC(); //ʹõٽΣڹ/жʱʱú꣬úͶһֲ
-                    //ڱжǰ CPU ״̬Ĵ SRٽιжֻ豣SR
-                    //жʱֵԭ 
-
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return;                         //أִжʱ
+    CPU_SR_ALLOC(); //使用到临界段（在关/开中断时）时必需该宏，该宏声明和定义一个局部变
+                    //量，用于保存关中断前的 CPU 状态寄存器 SR（临界段关中断只需保存SR）
+                    //，开中断时将该值还原。 
+
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return;                         //返回，不执行定时操作
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508               //ʹܣĬϽã˰ȫؼ
-    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //ڵ OSSafetyCriticalStart() 󴴽öʱ
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //ΪǷں˶
-        return;                                  //أִжʱ
+#ifdef OS_SAFETY_CRITICAL_IEC61508               //如果使能（默认禁用）了安全关键
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) { //如果是在调用 OSSafetyCriticalStart() 后创建该定时器
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;  //错误类型为“非法创建内核对象”
+        return;                                  //返回，不执行定时操作
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹܣĬʹܣжзǷü  
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб
-       *p_err = OS_ERR_TMR_ISR;                 //ΪжϺжʱ
-        return;                                 //أִжʱ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能（默认使能）了中断中非法调用检测  
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数是在中断中被调用
+       *p_err = OS_ERR_TMR_ISR;                 //错误类型为“在中断函数中定时”
+        return;                                 //返回，不执行定时操作
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u                          //ʹܣĬʹܣ˲
-    if (p_tmr == (OS_TMR *)0) {                     // p_tmr Ϊ
-       *p_err = OS_ERR_OBJ_PTR_NULL;                //ΪʱΪա
-        return;                                     //أִжʱ
+#if OS_CFG_ARG_CHK_EN > 0u                          //如果使能（默认使能）了参数检测
+    if (p_tmr == (OS_TMR *)0) {                     //如果参数 p_tmr 为空
+       *p_err = OS_ERR_OBJ_PTR_NULL;                //错误类型为“定时器对象为空”
+        return;                                     //返回，不执行定时操作
     }
 
-    switch (opt) {                                  //ʱѡ opt 
-        case OS_OPT_TMR_PERIODIC:                   //ѡԶʱ
-             if (period == (OS_TICK)0) {            //ʵΪ0
-                *p_err = OS_ERR_TMR_INVALID_PERIOD; //ΪʵЧ
-                 return;                            //أִжʱ
+    switch (opt) {                                  //根据延时选项参数 opt 分类操作
+        case OS_OPT_TMR_PERIODIC:                   //如果选择周期性定时
+             if (period == (OS_TICK)0) {            //如果周期重载实参为0
+                *p_err = OS_ERR_TMR_INVALID_PERIOD; //错误类型为“周期重载实参无效”
+                 return;                            //返回，不执行定时操作
              }
              break;
 
-        case OS_OPT_TMR_ONE_SHOT:                   //ѡһԶʱ
-             if (dly == (OS_TICK)0) {               //ʱʼʵΪ0
-                *p_err = OS_ERR_TMR_INVALID_DLY;    //ΪʱʼʵЧ
-                 return;                            //أִжʱ
+        case OS_OPT_TMR_ONE_SHOT:                   //如果选择一次性定时
+             if (dly == (OS_TICK)0) {               //如果定时初始实参为0
+                *p_err = OS_ERR_TMR_INVALID_DLY;    //错误类型为“定时初始实参无效”
+                 return;                            //返回，不执行定时操作
              }
              break;
 
-        default:                                    //ѡԤ
-            *p_err = OS_ERR_OPT_INVALID;            //ΪѡǷ
-             return;                                //أִжʱ
+        default:                                    //如果选项超出预期
+            *p_err = OS_ERR_OPT_INVALID;            //错误类型为“选项非法”
+             return;                                //返回，不执行定时操作
     }
 #endif
 
-    OS_CRITICAL_ENTER();         //ٽ
-    p_tmr->State          = (OS_STATE           )OS_TMR_STATE_STOPPED;  //ʼʱָ
+    OS_CRITICAL_ENTER();         //进入临界段
+    p_tmr->State          = (OS_STATE           )OS_TMR_STATE_STOPPED;  //初始化定时器指标
     p_tmr->Type           = (OS_OBJ_TYPE        )OS_OBJ_TYPE_TMR;
     p_tmr->NamePtr        = (CPU_CHAR          *)p_name;
     p_tmr->Dly            = (OS_TICK            )dly;
@@ -176,13 +176,13 @@ void  OSTmrCreate (OS_TMR               *p_tmr,          //
     p_tmr->NextPtr        = (OS_TMR            *)0;
     p_tmr->PrevPtr        = (OS_TMR            *)0;
 
-#if OS_CFG_DBG_EN > 0u           //ʹܣĬʹܣ˵Դͱ 
-    OS_TmrDbgListAdd(p_tmr);     //öʱӵʱ˫
+#if OS_CFG_DBG_EN > 0u           //如果使能（默认使能）了调试代码和变量 
+    OS_TmrDbgListAdd(p_tmr);     //将该定时添加到定时器双向调试链表
 #endif
-    OSTmrQty++;                  //ʱ1
+    OSTmrQty++;                  //定时器个数加1
 
-    OS_CRITICAL_EXIT_NO_SCHED(); //˳ٽΣ޵ȣ
-   *p_err = OS_ERR_NONE;         //Ϊ޴
+    OS_CRITICAL_EXIT_NO_SCHED(); //退出临界段（无调度）
+   *p_err = OS_ERR_NONE;         //错误类型为“无错误”
 }
 
 /*$PAGE*/
@@ -208,79 +208,79 @@ void  OSTmrCreate (OS_TMR               *p_tmr,          //
 ************************************************************************************************************************
 */
 
-#if OS_CFG_TMR_DEL_EN > 0u             //ʹܣĬۣ OSTmrDel() 
-CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr, //ʱƿָ
-                       OS_ERR  *p_err) //ش
+#if OS_CFG_TMR_DEL_EN > 0u             //如果使能（默认是嫩）了 OSTmrDel() 函数
+CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr, //定时器控制块指针
+                       OS_ERR  *p_err) //返回错误类型
 {
     OS_ERR       err;
-    CPU_BOOLEAN  success;  //ݴ溯ִн
+    CPU_BOOLEAN  success;  //暂存函数执行结果
 
 
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return (DEF_FALSE);             // DEF_FALSEִ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return (DEF_FALSE);             //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //ʹܣĬʹܣжзǷü 
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //úжб 
-       *p_err  = OS_ERR_TMR_ISR;                //ΪжϺжʱ
-        return (DEF_FALSE);                     // DEF_FALSEִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u          //如果使能（默认使能）了中断中非法调用检测 
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {  //如果该函数是在中断中被调用 
+       *p_err  = OS_ERR_TMR_ISR;                //错误类型为“在中断函数中定时”
+        return (DEF_FALSE);                     //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u          //ʹܣĬʹܣ˲
-    if (p_tmr == (OS_TMR *)0) {     //ʹ p_tmr ʵΪ
-       *p_err = OS_ERR_TMR_INVALID; //ΪЧĶʱ
-        return (DEF_FALSE);         // DEF_FALSEִ
+#if OS_CFG_ARG_CHK_EN > 0u          //如果使能（默认使能）了参数检测
+    if (p_tmr == (OS_TMR *)0) {     //如果使能 p_tmr 的实参为空
+       *p_err = OS_ERR_TMR_INVALID; //错误类型为“无效的定时器”
+        return (DEF_FALSE);         //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //ʹܣĬʹܣ˶ͼ
-    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {  //öʱĶ
-       *p_err = OS_ERR_OBJ_TYPE;           //Ϊʹ
-        return (DEF_FALSE);                // DEF_FALSEִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //如果使能（默认使能）了对象类型检测
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {  //如果该定时器的对象类型有误
+       *p_err = OS_ERR_OBJ_TYPE;           //错误类型为“对象类型错误”
+        return (DEF_FALSE);                //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-    OSSchedLock(&err);          //ס   
-#if OS_CFG_DBG_EN > 0u          //ʹܣĬʹܣ˵Դͱ 
-    OS_TmrDbgListRemove(p_tmr); //öʱӶʱ˫Ƴ
+    OSSchedLock(&err);          //锁住调度器   
+#if OS_CFG_DBG_EN > 0u          //如果使能（默认使能）了调试代码和变量 
+    OS_TmrDbgListRemove(p_tmr); //将该定时从定时器双向调试链表移除
 #endif
-    OSTmrQty--;                 //ʱ1
-
-    switch (p_tmr->State) {                       //ݶʱ״̬ദ
-        case OS_TMR_STATE_RUNNING:                //ʱ
-             OS_TmrUnlink(p_tmr);                 //ӵǰʱбƳʱ  
-             OS_TmrClr(p_tmr);                    //λʱָ
-             OSSchedUnlock(&err);                 //
-            *p_err   = OS_ERR_NONE;               //Ϊ޴
-             success = DEF_TRUE;                  //ִнΪ DEF_TRUE
+    OSTmrQty--;                 //定时器个数减1
+
+    switch (p_tmr->State) {                       //根据定时器的状态分类处理
+        case OS_TMR_STATE_RUNNING:                //如果定时器正在运行
+             OS_TmrUnlink(p_tmr);                 //从当前定时器轮列表移除定时器  
+             OS_TmrClr(p_tmr);                    //复位定时器的指标
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err   = OS_ERR_NONE;               //错误类型为“无错误”
+             success = DEF_TRUE;                  //执行结果暂为 DEF_TRUE
              break;
 
-        case OS_TMR_STATE_STOPPED:                //ʱѱֹͣ  
-        case OS_TMR_STATE_COMPLETED:              //ʱɵһζʱ
-             OS_TmrClr(p_tmr);                    //λʱָ
-             OSSchedUnlock(&err);                 //
-            *p_err   = OS_ERR_NONE;               //Ϊ޴
-             success = DEF_TRUE;                  //ִнΪ DEF_TRUE
+        case OS_TMR_STATE_STOPPED:                //如果定时器已被停止  
+        case OS_TMR_STATE_COMPLETED:              //如果定时器已完成第一次定时
+             OS_TmrClr(p_tmr);                    //复位定时器的指标
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err   = OS_ERR_NONE;               //错误类型为“无错误”
+             success = DEF_TRUE;                  //执行结果暂为 DEF_TRUE
              break;
              
-        case OS_TMR_STATE_UNUSED:                 //ʱѱɾ
-             OSSchedUnlock(&err);                 //
-            *p_err   = OS_ERR_TMR_INACTIVE;       //Ϊʱδ
-             success = DEF_FALSE;                 //ִнΪ DEF_FALSE
+        case OS_TMR_STATE_UNUSED:                 //如果定时器已被删除
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err   = OS_ERR_TMR_INACTIVE;       //错误类型为“定时器未激活”
+             success = DEF_FALSE;                 //执行结果暂为 DEF_FALSE
              break;
 
-        default:                                  //ʱ״̬Ԥ
-             OSSchedUnlock(&err);                 //
-            *p_err   = OS_ERR_TMR_INVALID_STATE;  //ΪʱЧ
-             success = DEF_FALSE;                 //ִнΪ DEF_FALSE
+        default:                                  //如果定时器的状态超出预期
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err   = OS_ERR_TMR_INVALID_STATE;  //错误类型为“定时器无效”
+             success = DEF_FALSE;                 //执行结果暂为 DEF_FALSE
              break;
     }
-    return (success);                             //ִн
+    return (success);                             //返回执行结果
 }
 #endif
 
@@ -418,73 +418,73 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 ************************************************************************************************************************
 */
 
-CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,  //ʱƿָ
-                         OS_ERR  *p_err)  //ش
+CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,  //定时器控制块指针
+                         OS_ERR  *p_err)  //返回错误类型
 {
     OS_ERR       err;
-    CPU_BOOLEAN  success; //ݴ溯ִн
+    CPU_BOOLEAN  success; //暂存函数执行结果
 
 
 
-#ifdef OS_SAFETY_CRITICAL               //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {         //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION(); //ִаȫ쳣
-        return (DEF_FALSE);             // DEF_FALSEִ
+#ifdef OS_SAFETY_CRITICAL               //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {         //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION(); //执行安全检测异常函数
+        return (DEF_FALSE);             //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹܣĬʹܣжзǷü 
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб               
-       *p_err = OS_ERR_TMR_ISR;                //ΪжϺжʱ
-        return (DEF_FALSE);                    // DEF_FALSEִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能（默认使能）了中断中非法调用检测 
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数是在中断中被调用               
+       *p_err = OS_ERR_TMR_ISR;                //错误类型为“在中断函数中定时”
+        return (DEF_FALSE);                    //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u           //ʹܣĬʹܣ˲
-    if (p_tmr == (OS_TMR *)0) {      //ʹ p_tmr ʵΪ
-       *p_err = OS_ERR_TMR_INVALID;  //ΪЧĶʱ
-        return (DEF_FALSE);          // DEF_FALSEִ
+#if OS_CFG_ARG_CHK_EN > 0u           //如果使能（默认使能）了参数检测
+    if (p_tmr == (OS_TMR *)0) {      //如果使能 p_tmr 的实参为空
+       *p_err = OS_ERR_TMR_INVALID;  //错误类型为“无效的定时器”
+        return (DEF_FALSE);          //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u           //ʹܣĬʹܣ˶ͼ
-    if (p_tmr->Type != OS_OBJ_TYPE_TMR) { //öʱĶ
-       *p_err = OS_ERR_OBJ_TYPE;          //Ϊʹ
-        return (DEF_FALSE);               // DEF_FALSEִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u           //如果使能（默认使能）了对象类型检测
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) { //如果该定时器的对象类型有误
+       *p_err = OS_ERR_OBJ_TYPE;          //错误类型为“对象类型错误”
+        return (DEF_FALSE);               //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-    OSSchedLock(&err);                            //ס     
-    switch (p_tmr->State) {                       //ݶʱ״̬ദ
-        case OS_TMR_STATE_RUNNING:                //ʱУ
-             OS_TmrUnlink(p_tmr);                 //ӶʱƳöʱ
-             OS_TmrLink(p_tmr, OS_OPT_LINK_DLY);  //öʱ²뵽ʱ
-             OSSchedUnlock(&err);                 //
-            *p_err   = OS_ERR_NONE;               //Ϊ޴
-             success = DEF_TRUE;                  //ִнΪ DEF_TRUE
+    OSSchedLock(&err);                            //锁住调度器     
+    switch (p_tmr->State) {                       //根据定时器的状态分类处理
+        case OS_TMR_STATE_RUNNING:                //如果定时器正在运行，则重启
+             OS_TmrUnlink(p_tmr);                 //从定时器轮里移除该定时器
+             OS_TmrLink(p_tmr, OS_OPT_LINK_DLY);  //将该定时器重新插入到定时器轮
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err   = OS_ERR_NONE;               //错误类型为“无错误”
+             success = DEF_TRUE;                  //执行结果暂为 DEF_TRUE
              break;
 
-        case OS_TMR_STATE_STOPPED:                //ʱѱֹͣ  
-        case OS_TMR_STATE_COMPLETED:              //ʱˣ  
-             OS_TmrLink(p_tmr, OS_OPT_LINK_DLY);  //öʱ²뵽ʱ
-             OSSchedUnlock(&err);                 //
-            *p_err   = OS_ERR_NONE;               //Ϊ޴
-             success = DEF_TRUE;                  //ִнΪ DEF_TRUE
+        case OS_TMR_STATE_STOPPED:                //如果定时器已被停止，则开启  
+        case OS_TMR_STATE_COMPLETED:              //如果定时器已完成了，则开启  
+             OS_TmrLink(p_tmr, OS_OPT_LINK_DLY);  //将该定时器重新插入到定时器轮
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err   = OS_ERR_NONE;               //错误类型为“无错误”
+             success = DEF_TRUE;                  //执行结果暂为 DEF_TRUE
              break;
 
-        case OS_TMR_STATE_UNUSED:                 //ʱδ
-             OSSchedUnlock(&err);                 //
-            *p_err   = OS_ERR_TMR_INACTIVE;       //Ϊʱδ
-             success = DEF_FALSE;                 //ִнΪ DEF_FALSE
+        case OS_TMR_STATE_UNUSED:                 //如果定时器未被创建
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err   = OS_ERR_TMR_INACTIVE;       //错误类型为“定时器未激活”
+             success = DEF_FALSE;                 //执行结果暂为 DEF_FALSE
              break;
 
-        default:                                  //ʱ״̬Ԥ
-             OSSchedUnlock(&err);                 //
-            *p_err = OS_ERR_TMR_INVALID_STATE;    //ΪʱЧ
-             success = DEF_FALSE;                 //ִнΪ DEF_FALSE
+        default:                                  //如果定时器的状态超出预期
+             OSSchedUnlock(&err);                 //解锁调度器
+            *p_err = OS_ERR_TMR_INVALID_STATE;    //错误类型为“定时器无效”
+             success = DEF_FALSE;                 //执行结果暂为 DEF_FALSE
              break;
     }
-    return (success);                             //ִн
+    return (success);                             //返回执行结果
 }
 
 /*$PAGE*/
@@ -604,101 +604,101 @@ OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
 ************************************************************************************************************************
 */
 
-CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,          //ʱƿָ
-                        OS_OPT   opt,            //ѡ
-                        void    *p_callback_arg, //ص²
-                        OS_ERR  *p_err)          //ش
+CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,          //定时器控制块指针
+                        OS_OPT   opt,            //选项
+                        void    *p_callback_arg, //传给回调函数的新参数
+                        OS_ERR  *p_err)          //返回错误类型
 {
     OS_TMR_CALLBACK_PTR  p_fnct;
     OS_ERR               err;
-    CPU_BOOLEAN          success;  //ݴ溯ִн
+    CPU_BOOLEAN          success;  //暂存函数执行结果
 
 
 
-#ifdef OS_SAFETY_CRITICAL                //ʹܣĬϽã˰ȫ
-    if (p_err == (OS_ERR *)0) {          //ʵΪ
-        OS_SAFETY_CRITICAL_EXCEPTION();  //ִаȫ쳣
-        return (DEF_FALSE);              // DEF_FALSEִ
+#ifdef OS_SAFETY_CRITICAL                //如果使能（默认禁用）了安全检测
+    if (p_err == (OS_ERR *)0) {          //如果错误类型实参为空
+        OS_SAFETY_CRITICAL_EXCEPTION();  //执行安全检测异常函数
+        return (DEF_FALSE);              //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //ʹܣĬʹܣжзǷü 
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //úжб 
-       *p_err = OS_ERR_TMR_ISR;                //ΪжϺжʱ
-        return (DEF_FALSE);                    // DEF_FALSEִ
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u         //如果使能（默认使能）了中断中非法调用检测 
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) { //如果该函数是在中断中被调用 
+       *p_err = OS_ERR_TMR_ISR;                //错误类型为“在中断函数中定时”
+        return (DEF_FALSE);                    //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_ARG_CHK_EN > 0u          //ʹܣĬʹܣ˲
-    if (p_tmr == (OS_TMR *)0) {     //ʹ p_tmr ʵΪ
-       *p_err = OS_ERR_TMR_INVALID; //ΪЧĶʱ
-        return (DEF_FALSE);         // DEF_FALSEִ
+#if OS_CFG_ARG_CHK_EN > 0u          //如果使能（默认使能）了参数检测
+    if (p_tmr == (OS_TMR *)0) {     //如果使能 p_tmr 的实参为空
+       *p_err = OS_ERR_TMR_INVALID; //错误类型为“无效的定时器”
+        return (DEF_FALSE);         //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //ʹܣĬʹܣ˶ͼ
-    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {  //öʱĶ
-       *p_err = OS_ERR_OBJ_TYPE;           //Ϊʹ
-        return (DEF_FALSE);                // DEF_FALSEִ
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u            //如果使能（默认使能）了对象类型检测
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {  //如果该定时器的对象类型有误
+       *p_err = OS_ERR_OBJ_TYPE;           //错误类型为“对象类型错误”
+        return (DEF_FALSE);                //返回 DEF_FALSE，不继续执行
     }
 #endif
 
-    OSSchedLock(&err);                                                   //ס  
-    switch (p_tmr->State) {                                              //ݶʱ״̬ദ
-        case OS_TMR_STATE_RUNNING:                                       //ʱ
-             OS_TmrUnlink(p_tmr);                                        //ӶʱбƳöʱ
-            *p_err = OS_ERR_NONE;                                        //Ϊ޴
-             switch (opt) {                                              //ѡദ
-                 case OS_OPT_TMR_CALLBACK:                               //ִлصʹôʱʱʵ
-                      p_fnct = p_tmr->CallbackPtr;                       //ȡʱĻص 
-                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {            //ص 
-                        (*p_fnct)((void *)p_tmr, p_tmr->CallbackPtrArg); //ʹôʱʱʵִлص
-                      } else {                                           //ص 
-                         *p_err = OS_ERR_TMR_NO_CALLBACK;                //Ϊʱûлص
+    OSSchedLock(&err);                                                   //锁住调度器  
+    switch (p_tmr->State) {                                              //根据定时器的状态分类处理
+        case OS_TMR_STATE_RUNNING:                                       //如果定时器正在运行
+             OS_TmrUnlink(p_tmr);                                        //从定时器轮列表里移除该定时器
+            *p_err = OS_ERR_NONE;                                        //错误类型为“无错误”
+             switch (opt) {                                              //根据选项分类处理
+                 case OS_OPT_TMR_CALLBACK:                               //执行回调函数，使用创建定时器时的实参
+                      p_fnct = p_tmr->CallbackPtr;                       //取定时器的回调函数 
+                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {            //如果回调函数存在 
+                        (*p_fnct)((void *)p_tmr, p_tmr->CallbackPtrArg); //使用创建定时器时的实参执行回调函数
+                      } else {                                           //如果回调函数不存在 
+                         *p_err = OS_ERR_TMR_NO_CALLBACK;                //错误类型为“定时器没有回调函数”
                       }
                       break;
 
-                 case OS_OPT_TMR_CALLBACK_ARG:                    //ִлصʹ p_callback_arg Ϊʵ
-                      p_fnct = p_tmr->CallbackPtr;                //ȡʱĻص 
-                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {     //ص 
-                        (*p_fnct)((void *)p_tmr, p_callback_arg); //ʹ p_callback_arg Ϊʵִлص
-                      } else {                                    //ص 
-                         *p_err = OS_ERR_TMR_NO_CALLBACK;         //Ϊʱûлص
+                 case OS_OPT_TMR_CALLBACK_ARG:                    //执行回调函数，使用 p_callback_arg 作为实参
+                      p_fnct = p_tmr->CallbackPtr;                //取定时器的回调函数 
+                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {     //如果回调函数存在 
+                        (*p_fnct)((void *)p_tmr, p_callback_arg); //使用 p_callback_arg 作为实参执行回调函数
+                      } else {                                    //如果回调函数不存在 
+                         *p_err = OS_ERR_TMR_NO_CALLBACK;         //错误类型为“定时器没有回调函数”
                       }
                       break;
 
-                 case OS_OPT_TMR_NONE:           //ֻͣʱ
+                 case OS_OPT_TMR_NONE:           //只需停掉定时器
                       break;
 
-                 default:                        //Ԥ
-                     OSSchedUnlock(&err);        //
-                    *p_err = OS_ERR_OPT_INVALID; //ΪѡЧ
-                     return (DEF_FALSE);         // DEF_FALSEִ
+                 default:                        //情况超出预期
+                     OSSchedUnlock(&err);        //解锁调度器
+                    *p_err = OS_ERR_OPT_INVALID; //错误类型为“选项无效”
+                     return (DEF_FALSE);         //返回 DEF_FALSE，不继续执行
              }
              OSSchedUnlock(&err);
              success = DEF_TRUE;
              break;
 
-        case OS_TMR_STATE_COMPLETED:            //ʱɵһζʱ                     
-        case OS_TMR_STATE_STOPPED:              //ʱѱֹͣ                 
-             OSSchedUnlock(&err);               //
-            *p_err   = OS_ERR_TMR_STOPPED;      //Ϊʱѱֹͣ
-             success = DEF_TRUE;                //ִнΪ DEF_TRUE
+        case OS_TMR_STATE_COMPLETED:            //如果定时器已完成第一次定时                     
+        case OS_TMR_STATE_STOPPED:              //如果定时器已被停止                 
+             OSSchedUnlock(&err);               //解锁调度器
+            *p_err   = OS_ERR_TMR_STOPPED;      //错误类型为“定时器已被停止”
+             success = DEF_TRUE;                //执行结果暂为 DEF_TRUE
              break;
 
-        case OS_TMR_STATE_UNUSED:               //öʱδ                    
-             OSSchedUnlock(&err);               //
-            *p_err   = OS_ERR_TMR_INACTIVE;     //Ϊʱδ
-             success = DEF_FALSE;               //ִнΪ DEF_FALSE
+        case OS_TMR_STATE_UNUSED:               //如果该定时器未被创建过                    
+             OSSchedUnlock(&err);               //解锁调度器
+            *p_err   = OS_ERR_TMR_INACTIVE;     //错误类型为“定时器未激活”
+             success = DEF_FALSE;               //执行结果暂为 DEF_FALSE
              break;
 
-        default:                                //ʱ״̬Ԥ
-             OSSchedUnlock(&err);               //
-            *p_err   = OS_ERR_TMR_INVALID_STATE;//Ϊʱ״̬Ƿ
-             success = DEF_FALSE;               //ִнΪ DEF_FALSE
+        default:                                //如果定时器状态超出预期
+             OSSchedUnlock(&err);               //解锁调度器
+            *p_err   = OS_ERR_TMR_INVALID_STATE;//错误类型为“定时器状态非法”
+             success = DEF_FALSE;               //执行结果暂为 DEF_FALSE
              break;
     }
-    return (success);                           //ִн
+    return (success);                           //返回执行结果
 } 
 
 /*$PAGE*/
@@ -903,8 +903,8 @@ void  OS_TmrInit (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
-void  OS_TmrLink (OS_TMR  *p_tmr,  //ʱƿָ
-                  OS_OPT   opt)    //ѡ
+void  OS_TmrLink (OS_TMR  *p_tmr,  //定时器控制块指针
+                  OS_OPT   opt)    //选项
 {
     OS_TMR_SPOKE     *p_spoke;
     OS_TMR           *p_tmr0;
@@ -913,42 +913,42 @@ void  OS_TmrLink (OS_TMR  *p_tmr,  //
 
 
 
-    p_tmr->State = OS_TMR_STATE_RUNNING;                           //öʱΪ״̬
-    if (opt == OS_OPT_LINK_PERIODIC) {                             //ʱٴβ
-        p_tmr->Match = p_tmr->Period + OSTmrTickCtr;               //ƥʱӸֵ
-    } else {                                                       //ʱ״β
-        if (p_tmr->Dly == (OS_TICK)0) {                            //ʱ Dly = 0
-            p_tmr->Match = p_tmr->Period + OSTmrTickCtr;           //ƥʱӸֵ
-        } else {                                                   //ʱ Dly != 0
-            p_tmr->Match = p_tmr->Dly    + OSTmrTickCtr;           //ƥʱӸ Dly
+    p_tmr->State = OS_TMR_STATE_RUNNING;                           //重置定时器为运行状态
+    if (opt == OS_OPT_LINK_PERIODIC) {                             //如果定时器是再次插入
+        p_tmr->Match = p_tmr->Period + OSTmrTickCtr;               //匹配时间加个周期重载值
+    } else {                                                       //如果定时器是首次插入
+        if (p_tmr->Dly == (OS_TICK)0) {                            //如果定时器的 Dly = 0
+            p_tmr->Match = p_tmr->Period + OSTmrTickCtr;           //匹配时间加个周期重载值
+        } else {                                                   //如果定时器的 Dly != 0
+            p_tmr->Match = p_tmr->Dly    + OSTmrTickCtr;           //匹配时间加个 Dly
         }
     }
-    spoke  = (OS_TMR_SPOKE_IX)(p_tmr->Match % OSCfg_TmrWheelSize); //ͨϣ㷨ýöʱ
-    p_spoke = &OSCfg_TmrWheel[spoke];                              //뵽ʱֵĸб
+    spoke  = (OS_TMR_SPOKE_IX)(p_tmr->Match % OSCfg_TmrWheelSize); //通过哈希算法觉得将该定时器
+    p_spoke = &OSCfg_TmrWheel[spoke];                              //插入到定时器轮的哪个列表。
 
-    if (p_spoke->FirstPtr ==  (OS_TMR *)0) {                //бΪգ
-        p_tmr->NextPtr      = (OS_TMR *)0;                  //ֱӽöʱΪбĵһԪء
+    if (p_spoke->FirstPtr ==  (OS_TMR *)0) {                //如果列表为空，
+        p_tmr->NextPtr      = (OS_TMR *)0;                  //直接将该定时器作为列表的第一个元素。
         p_tmr->PrevPtr      = (OS_TMR *)0;
         p_spoke->FirstPtr   = p_tmr;
         p_spoke->NbrEntries = 1u;
-    } else {                                                //бǿ
-        p_tmr->Remain  = p_tmr->Match                       //ʱ p_tmr ʣʱ
+    } else {                                                //如果列表非空
+        p_tmr->Remain  = p_tmr->Match                       //算出定时器 p_tmr 的剩余时间
                        - OSTmrTickCtr;
-        p_tmr1         = p_spoke->FirstPtr;                 //ȡб׸Ԫص p_tmr1
-        while (p_tmr1 != (OS_TMR *)0) {                     // p_tmr1 ǿ
-            p_tmr1->Remain = p_tmr1->Match                  // p_tmr1 ʣʱ
+        p_tmr1         = p_spoke->FirstPtr;                 //取列表的首个元素到 p_tmr1
+        while (p_tmr1 != (OS_TMR *)0) {                     //如果 p_tmr1 非空
+            p_tmr1->Remain = p_tmr1->Match                  //算出 p_tmr1 的剩余时间
                            - OSTmrTickCtr;
-            if (p_tmr->Remain > p_tmr1->Remain) {           // p_tmr ʣʱ p_tmr1 
-                if (p_tmr1->NextPtr  != (OS_TMR *)0) {      // p_tmr1 ǿ
-                    p_tmr1            = p_tmr1->NextPtr;    //ȡp_tmr1һʱΪµp_tmr1һѭ
-                } else {                                    // p_tmr1 Ϊ
-                    p_tmr->NextPtr    = (OS_TMR *)0;        // p_tmr 嵽 p_tmr1 ĺ棬ѭ
+            if (p_tmr->Remain > p_tmr1->Remain) {           //如果 p_tmr 的剩余时间大于 p_tmr1 的
+                if (p_tmr1->NextPtr  != (OS_TMR *)0) {      //如果 p_tmr1 后面非空
+                    p_tmr1            = p_tmr1->NextPtr;    //取p_tmr1后一个定时器为新的p_tmr1进行下一次循环
+                } else {                                    //如果 p_tmr1 后面为空
+                    p_tmr->NextPtr    = (OS_TMR *)0;        //将 p_tmr 插到 p_tmr1 的后面，结束循环
                     p_tmr->PrevPtr    =  p_tmr1;
                     p_tmr1->NextPtr   =  p_tmr;             
                     p_tmr1            = (OS_TMR *)0;        
                 }
-            } else {                                        // p_tmr ʣʱ䲻 p_tmr1 ģ
-                if (p_tmr1->PrevPtr == (OS_TMR *)0) {       // p_tmr 뵽 p_tmr1 ǰһѭ
+            } else {                                        //如果 p_tmr 的剩余时间不大于 p_tmr1 的，
+                if (p_tmr1->PrevPtr == (OS_TMR *)0) {       //将 p_tmr 插入到 p_tmr1 的前一个，结束循环。
                     p_tmr->PrevPtr    = (OS_TMR *)0;
                     p_tmr->NextPtr    = p_tmr1;
                     p_tmr1->PrevPtr   = p_tmr;
@@ -963,9 +963,9 @@ void  OS_TmrLink (OS_TMR  *p_tmr,  //
                 p_tmr1 = (OS_TMR *)0;                      
             }
         }
-        p_spoke->NbrEntries++;                              //бԪسԱ1
+        p_spoke->NbrEntries++;                              //列表元素成员数加1
     }
-    if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {     //бԱֵʷ¼
+    if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {     //更新列表成员数最大值历史记录
         p_spoke->NbrEntriesMax = p_spoke->NbrEntries;
     }
 }
@@ -1014,7 +1014,7 @@ void  OS_TmrResetPeak (void)
 ************************************************************************************************************************
 */
 
-void  OS_TmrUnlink (OS_TMR  *p_tmr)   //ʱƿָ
+void  OS_TmrUnlink (OS_TMR  *p_tmr)   //定时器控制块指针
 {
     OS_TMR_SPOKE    *p_spoke;
     OS_TMR          *p_tmr1;
@@ -1023,27 +1023,27 @@ void  OS_TmrUnlink (OS_TMR  *p_tmr)   //
 
 
 
-    spoke   = (OS_TMR_SPOKE_IX)(p_tmr->Match % OSCfg_TmrWheelSize); //ʱһͨϣ㷨ҳ
-    p_spoke = &OSCfg_TmrWheel[spoke];                               //öʱڶʱֵĸб
+    spoke   = (OS_TMR_SPOKE_IX)(p_tmr->Match % OSCfg_TmrWheelSize); //与插入时一样，通过哈希算法找出
+    p_spoke = &OSCfg_TmrWheel[spoke];                               //该定时器在定时器轮的哪个列表。
 
-    if (p_spoke->FirstPtr == p_tmr) {                       // p_tmr б׸Ԫ
-        p_tmr1            = (OS_TMR *)p_tmr->NextPtr;       //ȡ p_tmr һԪΪ p_tmr1(Ϊ)
-        p_spoke->FirstPtr = (OS_TMR *)p_tmr1;               //׸Ϊ p_tmr1 
-        if (p_tmr1 != (OS_TMR *)0) {                        // p_tmr1 ȷǿ
-            p_tmr1->PrevPtr = (OS_TMR *)0;                  //p_tmr1 ǰ
+    if (p_spoke->FirstPtr == p_tmr) {                       //如果 p_tmr 是列表的首个元素
+        p_tmr1            = (OS_TMR *)p_tmr->NextPtr;       //取 p_tmr 后一个元素为 p_tmr1(可能为空)
+        p_spoke->FirstPtr = (OS_TMR *)p_tmr1;               //表首改为 p_tmr1 
+        if (p_tmr1 != (OS_TMR *)0) {                        //如果 p_tmr1 确定非空
+            p_tmr1->PrevPtr = (OS_TMR *)0;                  //p_tmr1 的前面清空
         }
-    } else {                                                // p_tmr б׸Ԫ
-        p_tmr1          = (OS_TMR *)p_tmr->PrevPtr;         // p_tmr бƳ p_tmr 
-        p_tmr2          = (OS_TMR *)p_tmr->NextPtr;         //ǰԪһ.
+    } else {                                                //如果 p_tmr 不是列表的首个元素
+        p_tmr1          = (OS_TMR *)p_tmr->PrevPtr;         //将 p_tmr 从列表移除，并将 p_tmr 
+        p_tmr2          = (OS_TMR *)p_tmr->NextPtr;         //前后的两个元素连接在一起.
         p_tmr1->NextPtr = p_tmr2;
         if (p_tmr2 != (OS_TMR *)0) {                        
             p_tmr2->PrevPtr = (OS_TMR *)p_tmr1;
         }
     }
-    p_tmr->State   = OS_TMR_STATE_STOPPED;   //λ p_tmr ָ             
+    p_tmr->State   = OS_TMR_STATE_STOPPED;   //复位 p_tmr 的指标             
     p_tmr->NextPtr = (OS_TMR *)0;
     p_tmr->PrevPtr = (OS_TMR *)0;
-    p_spoke->NbrEntries--;                   //бԪسԱ1
+    p_spoke->NbrEntries--;                   //列表元素成员减1
 }
 
 /*$PAGE*/